@@ -54,6 +54,9 @@
 #define OXEN_DEFAULT_LOG_CATEGORY "net"
 
 #define ABSTRACT_SERVER_SEND_QUE_MAX_COUNT 1000
+// Limits on how much of the send queue gets gathered into a single socket write
+#define ABSTRACT_SERVER_SEND_BATCH_MAX_COUNT 64
+#define ABSTRACT_SERVER_SEND_BATCH_MAX_BYTES (128 * 1024)
 
 namespace epee
 {
@@ -120,7 +123,7 @@ namespace net_utils
     void save_dbg_log();
 
 
-		bool speed_limit_is_enabled() const; ///< tells us should we be sleeping here (e.g. do not sleep on RPC connections)
+		bool speed_limit_is_enabled() const; ///< tells us should we be throttling here (e.g. do not throttle RPC connections)
 
     bool cancel();
     
@@ -136,6 +139,13 @@ namespace net_utils
     virtual bool release();
     //------------------------------------------------------
     bool do_send_chunk(shared_sv chunk); ///< will send (or queue) a part of data. internal use only
+    /// starts an async write of the front of the send queue; m_send_que_lock must be held
+    void start_write(std::shared_ptr<connection<t_protocol_handler>> self);
+    /// as start_write, but first waits out `delay` (if positive) on m_throttle_write_timer, e.g.
+    /// to stay under the upload limit; m_send_que_lock must be held
+    void start_write_after(std::chrono::steady_clock::duration delay, std::shared_ptr<connection<t_protocol_handler>> self);
+    /// starts an async read of the socket into buffer_
+    void start_read();
 
     std::shared_ptr<connection<t_protocol_handler> > safe_shared_from_this();
     bool shutdown();
@@ -172,6 +182,7 @@ namespace net_utils
     std::mutex m_self_refs_lock;
     std::mutex m_chunking_lock; // held while we add small chunks of the big do_send() to small do_send_chunk()
     std::mutex m_shutdown_lock; // held while shutting down
+    size_t m_send_que_in_flight = 0; // number of m_send_que entries in the current write; guarded by m_send_que_lock
     
     t_connection_type m_connection_type;
     
@@ -182,6 +193,9 @@ namespace net_utils
     std::mutex m_throttle_speed_out_mutex;
 
     boost::asio::steady_timer m_timer;
+    boost::asio::steady_timer m_throttle_read_timer; // defers the next read while over the download limit
+    boost::asio::steady_timer m_throttle_write_timer; // defers the next write while over the upload limit
+    bool m_send_deferred = false; // a write is waiting on m_throttle_write_timer; guarded by m_send_que_lock
     bool m_local;
     bool m_ready_to_close;
     std::string m_host;
@@ -98,6 +98,8 @@ PRAGMA_WARNING_DISABLE_VS(4355)
 		m_throttle_speed_in("speed_in", "throttle_speed_in"),
 		m_throttle_speed_out("speed_out", "throttle_speed_out"),
 		m_timer(GET_IO_SERVICE(socket_)),
+		m_throttle_read_timer(GET_IO_SERVICE(socket_)),
+		m_throttle_write_timer(GET_IO_SERVICE(socket_)),
 		m_local(false),
 		m_ready_to_close(false)
   {
@@ -185,11 +187,7 @@ PRAGMA_WARNING_DISABLE_VS(4355)
 
     reset_timer(std::chrono::milliseconds(m_local ? NEW_CONNECTION_TIMEOUT_LOCAL : NEW_CONNECTION_TIMEOUT_REMOTE), false);
 
-    socket().async_read_some(boost::asio::buffer(buffer_),
-      strand_.wrap(
-        boost::bind(&connection<t_protocol_handler>::handle_read, self,
-          boost::asio::placeholders::error,
-          boost::asio::placeholders::bytes_transferred)));
+    start_read();
 #if !defined(_WIN32) || !defined(__i686)
 	// not supported before Windows7, too lazy for runtime check
 	// Just exclude for 32bit windows builds
@@ -312,26 +310,12 @@ PRAGMA_WARNING_DISABLE_VS(4355)
 			epee::net_utils::network_throttle_manager::network_throttle_manager::get_global_throttle_in().handle_trafic_exact(bytes_transferred);
 		}
 
-		double delay=0; // will be calculated - how much we should sleep to obey speed limit etc
-
-
-		if (speed_limit_is_enabled()) {
-			do // keep sleeping if we should sleep
-			{
-				{
-					std::lock_guard lock{epee::net_utils::network_throttle_manager::m_lock_get_global_throttle_in};
-					delay = epee::net_utils::network_throttle_manager::get_global_throttle_in().get_sleep_time_after_tick( bytes_transferred );
-				}
-				
-				delay *= 0.5;
-				long int ms = (long int)(delay * 100);
-				if (ms > 0) {
-					reset_timer(std::chrono::milliseconds(ms + 1), true);
-					std::this_thread::sleep_for(std::chrono::milliseconds{ms});
-				}
-			} while(delay > 0);
-		} // any form of sleeping
-		
+		// Count this read against the download limit; if that puts us over it, we hold off reading
+		// more from this peer (below) rather than sleeping: this thread serves other connections too.
+		std::chrono::steady_clock::duration throttle_delay{};
+		if (speed_limit_is_enabled())
+			throttle_delay = throttle_read(bytes_transferred);
+
       logger_handle_net_read(bytes_transferred);
       context.m_last_recv = std::chrono::steady_clock::now();
       context.m_recv_cnt += bytes_transferred;
@@ -351,12 +335,20 @@ PRAGMA_WARNING_DISABLE_VS(4355)
           shutdown();
       }else
       {
-        reset_timer(get_timeout_from_bytes_read(bytes_transferred), false);
-        socket().async_read_some(boost::asio::buffer(buffer_),
-          strand_.wrap(
-            boost::bind(&connection<t_protocol_handler>::handle_read, connection<t_protocol_handler>::shared_from_this(),
-              boost::asio::placeholders::error,
-              boost::asio::placeholders::bytes_transferred)));
+        const auto throttle_delay_ms = std::chrono::ceil<std::chrono::milliseconds>(throttle_delay);
+        reset_timer(get_timeout_from_bytes_read(bytes_transferred) + throttle_delay_ms, false);
+        if (throttle_delay_ms > 0ms)
+        {
+          m_throttle_read_timer.expires_from_now(throttle_delay);
+          m_throttle_read_timer.async_wait(strand_.wrap(
+            [self = connection<t_protocol_handler>::shared_from_this()](const boost::system::error_code& ec)
+            {
+              if (!ec && !self->m_was_shutdown)
+                self->start_read();
+            }));
+        }
+        else
+          start_read();
       }
     }else
     {
@@ -385,6 +377,16 @@ PRAGMA_WARNING_DISABLE_VS(4355)
   }
   //---------------------------------------------------------------------------------
   template<class t_protocol_handler>
+  void connection<t_protocol_handler>::start_read()
+  {
+    socket().async_read_some(boost::asio::buffer(buffer_),
+      strand_.wrap(
+        boost::bind(&connection<t_protocol_handler>::handle_read, connection<t_protocol_handler>::shared_from_this(),
+          boost::asio::placeholders::error,
+          boost::asio::placeholders::bytes_transferred)));
+  }
+  //---------------------------------------------------------------------------------
+  template<class t_protocol_handler>
   bool connection<t_protocol_handler>::call_run_once_service_io()
   {
     TRY_ENTRY();
@@ -512,32 +514,21 @@ PRAGMA_WARNING_DISABLE_VS(4355)
 
     m_send_que.push_back(std::move(chunk));
 
-    if(m_send_que.size() > 1)
-    { // active operation should be in progress, nothing to do, just wait last operation callback
-        auto size_now = m_send_que.back().size();
-        //do_send_handler_delayed( ptr , size_now ); // (((H))) // empty function
-      
+    if(m_send_que_in_flight || m_send_deferred)
+    { // active operation should be in progress (or be waiting out the upload limit), nothing to do,
+      // just wait last operation callback; handle_write (or the throttle timer) will pick this up
+      // (along with anything else queued by then) in its next write
     }
     else
     { // no active operation
-
-        if(m_send_que.size()!=1)
-        {
-            return false;
-        }
-
-        auto size_now = m_send_que.front().size();
+        std::chrono::steady_clock::duration throttle_delay{};
         if (speed_limit_is_enabled())
+        {
 			do_send_handler_write( m_send_que.back().data(), m_send_que.back().size() ); // (((H)))
+			throttle_delay = get_write_wait_time();
+        }
 
-        CHECK_AND_ASSERT_MES( size_now == m_send_que.front().size(), false, "Unexpected queue size");
-        reset_timer(get_default_timeout(), false);
-        using namespace boost::placeholders;
-        boost::asio::async_write(socket(), boost::asio::buffer(m_send_que.front().data(), size_now ) ,
-                                 strand_.wrap(
-                                 boost::bind(&connection<t_protocol_handler>::handle_write, self, _1, _2)
-                                 )
-                                 );
+        start_write_after(throttle_delay, std::move(self));
     }
     
     //do_send_handler_stop( ptr , cb ); // empty function
@@ -548,6 +539,60 @@ PRAGMA_WARNING_DISABLE_VS(4355)
   } // do_send_chunk
   //---------------------------------------------------------------------------------
   template<class t_protocol_handler>
+  void connection<t_protocol_handler>::start_write(std::shared_ptr<connection<t_protocol_handler>> self)
+  {
+    // Gather as much of the queue as we reasonably can into one write: a burst of small
+    // notifications to this peer then goes out as one vectored send instead of a send (and a
+    // completion handler round trip) per message.  The queued buffers are shared (broadcasts to
+    // many peers all reference the same data) and stay alive in the queue until handle_write
+    // pops them, so nothing gets copied here.
+    std::vector<boost::asio::const_buffer> buffers;
+    buffers.reserve(std::min<size_t>(m_send_que.size(), ABSTRACT_SERVER_SEND_BATCH_MAX_COUNT));
+    size_t bytes = 0;
+    for (const auto& msg : m_send_que)
+    {
+      if (buffers.size() >= ABSTRACT_SERVER_SEND_BATCH_MAX_COUNT ||
+          (!buffers.empty() && bytes + msg.size() > ABSTRACT_SERVER_SEND_BATCH_MAX_BYTES))
+        break;
+      buffers.emplace_back(msg.data(), msg.size());
+      bytes += msg.size();
+    }
+    m_send_que_in_flight = buffers.size();
+    add_send_write_stats(buffers.size());
+
+    reset_timer(get_default_timeout(), false);
+    using namespace boost::placeholders;
+    boost::asio::async_write(socket(), buffers,
+                             strand_.wrap(
+                             boost::bind(&connection<t_protocol_handler>::handle_write, std::move(self), _1, _2)
+                             )
+                             );
+  }
+  //---------------------------------------------------------------------------------
+  template<class t_protocol_handler>
+  void connection<t_protocol_handler>::start_write_after(std::chrono::steady_clock::duration delay, std::shared_ptr<connection<t_protocol_handler>> self)
+  {
+    if (delay <= 0s)
+      return start_write(std::move(self));
+
+    // Over the upload limit: leave the queue be until we're back under it.  Unlike sleeping, this
+    // doesn't hold up the I/O thread (and so every other connection it serves) in the meantime.
+    m_send_deferred = true;
+    reset_timer(get_default_timeout() + std::chrono::ceil<std::chrono::milliseconds>(delay), false);
+    m_throttle_write_timer.expires_from_now(delay);
+    m_throttle_write_timer.async_wait(strand_.wrap(
+      [self = std::move(self)](const boost::system::error_code& ec) mutable
+      {
+        std::lock_guard lock{self->m_send_que_lock};
+        self->m_send_deferred = false;
+        if (ec || self->m_was_shutdown || self->m_send_que.empty())
+          return;
+        auto& conn = *self;
+        conn.start_write(std::move(self));
+      }));
+  }
+  //---------------------------------------------------------------------------------
+  template<class t_protocol_handler>
   std::chrono::milliseconds connection<t_protocol_handler>::get_default_timeout()
   {
     unsigned count;
@@ -624,6 +669,8 @@ PRAGMA_WARNING_DISABLE_VS(4355)
     m_was_shutdown = true;
     // Initiate graceful connection closure.
     m_timer.cancel();
+    m_throttle_read_timer.cancel();
+    m_throttle_write_timer.cancel();
     boost::system::error_code ignored_ec;
     socket().shutdown(boost::asio::ip::tcp::socket::shutdown_both, ignored_ec);
     if (!m_host.empty())
@@ -686,10 +733,11 @@ PRAGMA_WARNING_DISABLE_VS(4355)
     }
     logger_handle_net_write(cb);
 
-                // The single sleeping that is needed for correctly handling "out" speed throttling
-		if (speed_limit_is_enabled()) {
-			sleep_before_packet(cb, 1, 1);
-		}
+    // The single place "out" speed throttling is handled: this write counts against the upload
+    // limit, and if that puts us over it the next write waits (on a timer, see start_write_after)
+    std::chrono::steady_clock::duration throttle_delay{};
+    if (speed_limit_is_enabled())
+      throttle_delay = throttle_write(cb);
 
     bool do_shutdown = false;
     std::unique_lock lock{m_send_que_lock};
@@ -698,7 +746,8 @@ PRAGMA_WARNING_DISABLE_VS(4355)
       return;
     }
 
-    m_send_que.pop_front();
+    m_send_que.erase(m_send_que.begin(), m_send_que.begin() + std::min(m_send_que_in_flight, m_send_que.size()));
+    m_send_que_in_flight = 0;
     if(m_send_que.empty())
     {
       if(m_want_close_connection)
@@ -708,17 +757,9 @@ PRAGMA_WARNING_DISABLE_VS(4355)
     }else
     {
       //have more data to send
-		reset_timer(get_default_timeout(), false);
-		auto size_now = m_send_que.front().size();
 		if (speed_limit_is_enabled())
 			do_send_handler_write_from_queue(e, m_send_que.front().size() , m_send_que.size()); // (((H)))
-		CHECK_AND_ASSERT_MES( size_now == m_send_que.front().size(), void(), "Unexpected queue size");
-        using namespace boost::placeholders;
-        boost::asio::async_write(socket(), boost::asio::buffer(m_send_que.front().data(), size_now) , 
-           strand_.wrap(
-            boost::bind(&connection<t_protocol_handler>::handle_write, connection<t_protocol_handler>::shared_from_this(), _1, _2)
-			  )
-          );
+        start_write_after(throttle_delay, connection<t_protocol_handler>::shared_from_this());
     }
     lock.unlock();
 
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace epee::net_utils {
+
+/// Returns the CPU time consumed so far by the calling thread (or, on platforms without a
+/// per-thread CPU clock, a monotonic wall clock).
+std::chrono::nanoseconds thread_cpu_time();
+
+/// Measures the CPU time used by the calling thread from construction until `elapsed()`.
+class cpu_timer {
+  std::chrono::nanoseconds m_start = thread_cpu_time();
+
+public:
+  std::chrono::nanoseconds elapsed() const { return thread_cpu_time() - m_start; }
+};
+
+/// Accumulated cost of handling one kind of message.  `queue_delay` is the time messages waited
+/// between arriving and their handler starting; it stays zero for handlers (such as levin's) that
+/// run directly on the thread that received the message.
+struct command_stats {
+  uint64_t count = 0;
+  uint64_t bytes_in = 0;
+  uint64_t bytes_out = 0;
+  std::chrono::nanoseconds cpu_time{0};
+  std::chrono::nanoseconds max_cpu_time{0};
+  std::chrono::nanoseconds queue_delay{0};
+  std::chrono::nanoseconds max_queue_delay{0};
+};
+
+/// Thread-safe table of command_stats keyed by command (id or name).  Updating it takes a short
+/// uncontended lock and, the first time a command is seen, a map insertion, so it is cheap enough
+/// to update for every message handled.
+template <typename Key>
+class command_stats_table {
+  mutable std::mutex m_mutex;
+  std::map<Key, command_stats, std::less<>> m_stats;
+
+  template <typename K>
+  command_stats& get(const K& key) {
+    auto it = m_stats.find(key);
+    if (it == m_stats.end())
+      it = m_stats.emplace(Key(key), command_stats{}).first;
+    return it->second;
+  }
+
+public:
+  /// Records one handled message: its size, the size of whatever we sent back in reply (if
+  /// anything), the CPU time its handler took, and how long it was queued before that.
+  template <typename K>
+  void record(const K& key, size_t bytes_in, size_t bytes_out, std::chrono::nanoseconds cpu,
+      std::chrono::nanoseconds queued = std::chrono::nanoseconds{0}) {
+    std::lock_guard lock{m_mutex};
+    auto& s = get(key);
+    s.count++;
+    s.bytes_in += bytes_in;
+    s.bytes_out += bytes_out;
+    s.cpu_time += cpu;
+    s.max_cpu_time = std::max(s.max_cpu_time, cpu);
+    s.queue_delay += queued;
+    s.max_queue_delay = std::max(s.max_queue_delay, queued);
+  }
+
+  /// Records bytes sent for `key` that weren't a reply to a handled message, e.g. a notification
+  /// we originated.
+  template <typename K>
+  void record_sent(const K& key, size_t bytes_out) {
+    std::lock_guard lock{m_mutex};
+    get(key).bytes_out += bytes_out;
+  }
+
+  std::map<Key, command_stats, std::less<>> snapshot() const {
+    std::lock_guard lock{m_mutex};
+    return m_stats;
+  }
+
+  void clear() {
+    std::lock_guard lock{m_mutex};
+    m_stats.clear();
+  }
+};
+
+/// Process-wide per-command accounting
+struct command_stats_registry {
+  command_stats_table<uint32_t> levin;  ///< p2p levin commands, by command id
+  command_stats_table<std::string> omq;  ///< service node OxenMQ commands, by "category.command"
+  command_stats_table<std::string> rpc;  ///< RPC endpoints (via HTTP or OxenMQ), by endpoint name
+};
+
+command_stats_registry& command_stats();
+
+}  // namespace epee::net_utils
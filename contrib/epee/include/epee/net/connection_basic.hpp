@@ -42,6 +42,7 @@
 #define INCLUDED_p2p_connection_basic_hpp
 
 
+#include <chrono>
 #include <mutex>
 #include <string>
 #include <atomic>
@@ -130,12 +131,20 @@ class connection_basic { // not-templated base class for rapid developmet of som
 		static uint64_t get_rate_up_limit();
 		static uint64_t get_rate_down_limit();
 
+		// totals, over all connections, of the socket writes started and of the queued messages
+		// (or chunks of larger messages) that those writes carried
+		static void add_send_write_stats(size_t messages);
+		static std::pair<uint64_t, uint64_t> get_send_write_stats(); // {writes, messages}
+
 		// config misc
 		static void set_tos_flag(int tos); // ToS / QoS flag
 		static int get_tos_flag();
 
-		// handlers and sleep
-		void sleep_before_packet(size_t packet_size, int phase, int q_len); // execute a sleep ; phase is not really used now(?)
+		// rate limiting: these never sleep; instead they count the transfer against the global limit
+		// and return how long the caller should defer its next read/write (zero if it needn't)
+		static std::chrono::steady_clock::duration throttle_read(size_t packet_size);
+		static std::chrono::steady_clock::duration throttle_write(size_t packet_size);
+		static std::chrono::steady_clock::duration get_write_wait_time(); // for a write not preceded by throttle_write
 		static double get_sleep_time(size_t cb);
 };
 
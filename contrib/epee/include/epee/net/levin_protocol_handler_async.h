@@ -31,11 +31,14 @@
 #include <unordered_map>
 
 #include <atomic>
+#include <cstring>
 #include <memory>
+#include <optional>
 #include <thread>
 
 #include "levin_base.h"
 #include "buffer.h"
+#include "command_stats.h"
 #include "../scope_leaver.h"
 #include "../int-util.h"
 
@@ -130,9 +133,11 @@ class async_protocol_handler
     data.reserve(sizeof(head) + in_buff.size());
     data.append(reinterpret_cast<const char*>(&head), sizeof(head));
     data.append(reinterpret_cast<const char*>(in_buff.data()), in_buff.size());
+    const size_t size = data.size();
     if(!m_pservice_endpoint->do_send(shared_sv{std::move(data)}))
       return false;
 
+    net_utils::command_stats().levin.record_sent(command, size);
     return true;
   }
 
@@ -455,6 +460,12 @@ public:
 
           bool is_response = (m_oponent_protocol_ver == LEVIN_PROTOCOL_VER_1 && m_current_head.m_flags&LEVIN_PACKET_RESPONSE);
 
+          // Account for what handling this message costs us, per command and per peer
+          const net_utils::cpu_timer handler_timer;
+          const size_t message_size = sizeof(bucket_head2) + buff_to_invoke.size();
+          size_t reply_size = 0;
+          int handler_result = LEVIN_OK;
+
           if(is_response)
           {//response to some invoke 
 
@@ -495,17 +506,27 @@ public:
               const uint32_t return_code = m_config.m_pcommands_handler->invoke(
                 m_current_head.m_command, buff_to_invoke, return_buff, m_connection_context
               );
+              handler_result = return_code;
 
               bucket_head2 head = make_header(m_current_head.m_command, return_buff.size(), LEVIN_PACKET_RESPONSE, false);
               head.m_return_code = SWAP32LE(return_code);
               return_buff.insert(0, reinterpret_cast<const char*>(&head), sizeof(head));
+              reply_size = return_buff.size();
 
               if(!m_pservice_endpoint->do_send(shared_sv{std::move(return_buff)}))
                 return false;
             }
             else
-              m_config.m_pcommands_handler->notify(m_current_head.m_command, buff_to_invoke, m_connection_context);
+              handler_result = m_config.m_pcommands_handler->notify(m_current_head.m_command, buff_to_invoke, m_connection_context);
           }
+
+          const auto handler_cpu = handler_timer.elapsed();
+          // Only commands the handler map knows get their own stats entry; otherwise a peer could
+          // grow the table without bound by sending arbitrary command ids.
+          if (handler_result != LEVIN_ERROR_CONNECTION_HANDLER_NOT_DEFINED)
+            net_utils::command_stats().levin.record(m_current_head.m_command, message_size, reply_size, handler_cpu);
+          m_connection_context.m_handled_cnt++;
+          m_connection_context.m_handler_cpu_time += handler_cpu;
           // reuse small buffer
           if (!temp.empty() && temp.capacity() <= 64 * 1024)
           {
@@ -710,10 +731,22 @@ public:
       return LEVIN_ERROR_CONNECTION_DESTROYED;
 
     const std::size_t length = message.view.size();
+    // Count the message against the command in its header (noise and fragments don't have a
+    // meaningful one, so those go uncounted)
+    std::optional<uint32_t> command;
+    if (length >= sizeof(bucket_head2))
+    {
+      bucket_head2 head;
+      std::memcpy(&head, message.data(), sizeof(head));
+      if (SWAP32LE(head.m_flags) & LEVIN_PACKET_REQUEST)
+        command = SWAP32LE(head.m_command);
+    }
     if (!m_pservice_endpoint->do_send(std::move(message)))
     {
       return -1;
     }
+    if (command)
+      net_utils::command_stats().levin.record_sent(*command, length);
 
     return 1;
   }
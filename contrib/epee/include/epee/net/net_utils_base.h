@@ -358,6 +358,8 @@ namespace net_utils
     std::chrono::steady_clock::time_point m_last_send;
     uint64_t m_recv_cnt;
     uint64_t m_send_cnt;
+    uint64_t m_handled_cnt; // messages from this peer that we've handled
+    std::chrono::nanoseconds m_handler_cpu_time; // CPU time spent handling them
     double m_current_speed_down;
     double m_current_speed_up;
     double m_max_speed_down;
@@ -376,6 +378,8 @@ namespace net_utils
                                             m_last_send(last_send),
                                             m_recv_cnt(recv_cnt),
                                             m_send_cnt(send_cnt),
+                                            m_handled_cnt(0),
+                                            m_handler_cpu_time(0),
                                             m_current_speed_down(0),
                                             m_current_speed_up(0),
                                             m_max_speed_down(0),
@@ -390,6 +394,8 @@ namespace net_utils
                                m_last_send(std::chrono::steady_clock::time_point::min()),
                                m_recv_cnt(0),
                                m_send_cnt(0),
+                               m_handled_cnt(0),
+                               m_handler_cpu_time(0),
                                m_current_speed_down(0),
                                m_current_speed_up(0),
                                m_max_speed_down(0),
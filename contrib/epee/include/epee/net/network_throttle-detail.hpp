@@ -36,7 +36,10 @@
 #ifndef INCLUDED_throttle_detail_hpp
 #define INCLUDED_throttle_detail_hpp
 
+#include <chrono>
 #include <cmath>
+#include <functional>
+#include <mutex>
 #include <boost/circular_buffer.hpp>
 #include "network_throttle.hpp"
 
@@ -120,6 +123,37 @@ struct network_throttle_bw {
 };
 
 
+/***
+ * @brief Token bucket used to enforce a rate limit without sleeping
+ * @details The bucket refills at the target speed (holding at most one second's worth of tokens);
+ * every transfer takes its size in tokens, going into debt if needed, and the caller is told how
+ * long to hold off its next transfer for the debt to be repaid.  Callers defer their next read or
+ * write by that long (e.g. with an asio timer) rather than blocking a thread.  Thread-safe.
+*/
+class token_bucket {
+	public:
+		using clock = std::chrono::steady_clock;
+		using now_function = std::function<clock::time_point()>;
+
+		/// `now` gives the current time; tests can substitute their own clock for clock::now
+		explicit token_bucket(network_speed_kbps target, now_function now = clock::now);
+
+		void set_target_speed(network_speed_kbps target); ///< a target of 0 (or less) disables the limit
+		network_speed_kbps get_target_speed() const;
+
+		clock::duration consume(size_t packet_size); ///< takes packet_size tokens; returns how long to wait before the next transfer (0 if not in debt)
+		clock::duration get_wait_time() const; ///< how long until the bucket is out of debt, without taking anything
+
+	private:
+		void refill(clock::time_point now); ///< m_mutex must be held
+		clock::duration time_to_repay(double tokens) const; ///< how long until a bucket holding `tokens` is out of debt
+
+		const now_function m_now;
+		mutable std::mutex m_mutex;
+		network_speed_bps m_target_speed; // 0 = unlimited
+		double m_tokens; // bytes; negative when in debt
+		clock::time_point m_last_refill;
+};
 
 } // namespace net_utils
 } // namespace epee
@@ -52,6 +52,7 @@ typedef double network_time_seconds;
 typedef double network_MB;
 
 class i_network_throttle;
+class token_bucket;
 
 /***
 @brief All information about given throttle - speed calculations
@@ -88,6 +89,9 @@ class network_throttle_manager {
 		static i_network_throttle & get_global_throttle_in(); ///< singleton ; for friend class ; caller MUST use proper locks! like m_lock_get_global_throttle_in
 		static i_network_throttle & get_global_throttle_inreq(); ///< ditto ; use lock ... use m_lock_get_global_throttle_inreq obviously
 		static i_network_throttle & get_global_throttle_out(); ///< ditto ; use lock ... use m_lock_get_global_throttle_out obviously
+
+		static token_bucket & get_global_bucket_in(); ///< singleton enforcing the download limit ; locks internally
+		static token_bucket & get_global_bucket_out(); ///< singleton enforcing the upload limit ; locks internally
 };
 
 
@@ -29,6 +29,7 @@
 #include "../misc_log_ex.h"
 #include "keyvalue_serialization_overloads.h"
 #include "../storages/portable_storage.h"
+#include "../storages/portable_storage_direct.h"
 namespace epee
 {
   /************************************************************************/
@@ -52,7 +53,19 @@ public: \
   bool store(epee::serialization::portable_storage& st, epee::serialization::section* parent_section = nullptr) const; \
   bool _load(epee::serialization::portable_storage& st, epee::serialization::section* parent_section = nullptr); \
   bool load(epee::serialization::portable_storage& st, epee::serialization::section* parent_section = nullptr); \
-  template <bool is_store> bool _serialize_map(epee::serialization::portable_storage& stg, epee::serialization::section* parent_section) const;
+  template <bool is_store, typename Storage> bool _serialize_map(Storage& stg, typename Storage::hsection parent_section) const;
+
+/// Same as KV_MAP_SERIALIZABLE, but also serializes directly to and from the binary format without
+/// going through a portable_storage (see portable_storage_direct.h).  This is for p2p messages,
+/// where building and walking the storage tree is a large part of the cost of a big message.
+/// The implementation uses KV_SERIALIZE_MAP_CODE_BEGIN_BINARY instead of
+/// KV_SERIALIZE_MAP_CODE_BEGIN, and every serialized member type that isn't a basic value also
+/// has to support the direct storages.
+#define KV_MAP_SERIALIZABLE_BINARY \
+  KV_MAP_SERIALIZABLE \
+  bool store(epee::serialization::binary_writer& st, epee::serialization::binary_writer::hsection parent_section = nullptr) const; \
+  bool _load(epee::serialization::binary_reader& st, epee::serialization::binary_reader::hsection parent_section = nullptr); \
+  bool load(epee::serialization::binary_reader& st, epee::serialization::binary_reader::hsection parent_section = nullptr);
 
 #define KV_SERIALIZE_MAP_CODE_BEGIN(Class) \
   bool Class::store(epee::serialization::portable_storage& st, epee::serialization::section* parent_section) const \
@@ -65,11 +78,24 @@ public: \
     catch (...) {} \
     return false; \
   } \
-  template <bool is_store> \
-  bool Class::_serialize_map(epee::serialization::portable_storage& stg, epee::serialization::section* parent_section) const { \
+  template <bool is_store, typename Storage> \
+  bool Class::_serialize_map(Storage& stg, typename Storage::hsection parent_section) const { \
     /* de-const if we're being called (from the above non-const _load method) to deserialize */ \
     auto& this_ref = const_cast<std::conditional_t<is_store, const Class, Class>&>(*this);
 
+#define KV_SERIALIZE_MAP_CODE_BEGIN_BINARY(Class) \
+  bool Class::store(epee::serialization::binary_writer& st, epee::serialization::binary_writer::hsection parent_section) const \
+  { return _serialize_map<true>(st, parent_section); } \
+  bool Class::_load(epee::serialization::binary_reader& st, epee::serialization::binary_reader::hsection parent_section) \
+  { return _serialize_map<false>(st, parent_section); } \
+  bool Class::load(epee::serialization::binary_reader& st, epee::serialization::binary_reader::hsection parent_section) \
+  { \
+    try { return _load(st, parent_section); } \
+    catch (...) {} \
+    return false; \
+  } \
+  KV_SERIALIZE_MAP_CODE_BEGIN(Class)
+
 #define KV_SERIALIZE_MAP_CODE_END() return true; }
 
 
@@ -83,19 +83,19 @@ namespace epee
 
     //-------------------------------------------------------------------------------------------------------------------
     template<class t_type, class t_storage>
-    bool serialize_t_val(const t_type& d, t_storage& stg, section* parent_section, const char* pname)
+    bool serialize_t_val(const t_type& d, t_storage& stg, typename t_storage::hsection parent_section, const char* pname)
     {
       return stg.set_value(pname, d, parent_section);
     }
     //-------------------------------------------------------------------------------------------------------------------
     template<class t_type, class t_storage>
-    bool unserialize_t_val(t_type& d, t_storage& stg, section* parent_section, const char* pname)
+    bool unserialize_t_val(t_type& d, t_storage& stg, typename t_storage::hsection parent_section, const char* pname)
     {
       return stg.get_value(pname, d, parent_section);
     } 
     //-------------------------------------------------------------------------------------------------------------------
     template<class t_type, class t_storage>
-    bool serialize_t_val_as_blob(const t_type& d, t_storage& stg, section* parent_section, const char* pname)
+    bool serialize_t_val_as_blob(const t_type& d, t_storage& stg, typename t_storage::hsection parent_section, const char* pname)
     {
       assert_blob_serializable<t_type>();
       std::string blob((const char *)&d, sizeof(d));
@@ -103,7 +103,7 @@ namespace epee
     }
     //-------------------------------------------------------------------------------------------------------------------
     template<class t_type, class t_storage>
-    bool unserialize_t_val_as_blob(t_type& d, t_storage& stg, section* parent_section, const char* pname)
+    bool unserialize_t_val_as_blob(t_type& d, t_storage& stg, typename t_storage::hsection parent_section, const char* pname)
     {
       assert_blob_serializable<t_type>();
       std::string blob;
@@ -116,27 +116,27 @@ namespace epee
     } 
     //-------------------------------------------------------------------------------------------------------------------
     template<class serializible_type, class t_storage>
-    bool serialize_t_obj(const serializible_type& obj, t_storage& stg, section* parent_section, const char* pname)
+    bool serialize_t_obj(const serializible_type& obj, t_storage& stg, typename t_storage::hsection parent_section, const char* pname)
     {
-      section* child_section = stg.open_section(pname, parent_section, true);
+      auto* child_section = stg.open_section(pname, parent_section, true);
       CHECK_AND_ASSERT_MES(child_section, false, "serialize_t_obj: failed to open/create section {}", pname);
       return obj.store(stg, child_section);
     }
     //-------------------------------------------------------------------------------------------------------------------
     template<class serializible_type, class t_storage>
-    bool unserialize_t_obj(serializible_type& obj, t_storage& stg, section* parent_section, const char* pname)
+    bool unserialize_t_obj(serializible_type& obj, t_storage& stg, typename t_storage::hsection parent_section, const char* pname)
     {
-      section* child_section = stg.open_section(pname, parent_section, false);
+      auto* child_section = stg.open_section(pname, parent_section, false);
       if(!child_section) return false;
       return obj._load(stg, child_section);
     }
     //-------------------------------------------------------------------------------------------------------------------
     template<class stl_container, class t_storage>
-    bool serialize_stl_container_t_val(const stl_container& container, t_storage& stg, section* parent_section, const char* pname)
+    bool serialize_stl_container_t_val(const stl_container& container, t_storage& stg, typename t_storage::hsection parent_section, const char* pname)
     {
       using T = typename stl_container::value_type;
       if(!container.size()) return true;
-      auto *arr = stg.template make_array_t<T>(pname, parent_section);
+      auto *arr = stg.template make_array_t<T>(pname, parent_section, container.size());
       CHECK_AND_ASSERT_MES(arr, false, "failed to create array in storage");
       for (auto& elem : container)
         arr->push_back(elem);
@@ -144,7 +144,7 @@ namespace epee
     }
     //--------------------------------------------------------------------------------------------------------------------
     template<class stl_container, class t_storage>
-    bool unserialize_stl_container_t_val(stl_container& container, t_storage& stg, section* parent_section, const char* pname)
+    bool unserialize_stl_container_t_val(stl_container& container, t_storage& stg, typename t_storage::hsection parent_section, const char* pname)
     {
       using T = typename stl_container::value_type;
       container.clear();
@@ -159,7 +159,7 @@ namespace epee
     }
     //--------------------------------------------------------------------------------------------------------------------
     template<typename T, size_t Size, class t_storage>
-    bool unserialize_stl_container_t_val(std::array<T, Size>& array, t_storage& stg, section* parent_section, const char* pname)
+    bool unserialize_stl_container_t_val(std::array<T, Size>& array, t_storage& stg, typename t_storage::hsection parent_section, const char* pname)
     {
       static_assert(Size > 0, "cannot deserialize empty std::array");
       size_t next_i = 0;
@@ -174,7 +174,7 @@ namespace epee
     }
     //--------------------------------------------------------------------------------------------------------------------
     template<class stl_container, class t_storage>
-    bool serialize_stl_container_pod_val_as_blob(const stl_container& container, t_storage& stg, section* parent_section, const char* pname)
+    bool serialize_stl_container_pod_val_as_blob(const stl_container& container, t_storage& stg, typename t_storage::hsection parent_section, const char* pname)
     {
       using T = typename stl_container::value_type;
       assert_blob_serializable<T>();
@@ -193,7 +193,7 @@ namespace epee
     }
     //--------------------------------------------------------------------------------------------------------------------
     template<class stl_container, class t_storage>
-    bool unserialize_stl_container_pod_val_as_blob(stl_container& container, t_storage& stg, section* parent_section, const char* pname)
+    bool unserialize_stl_container_pod_val_as_blob(stl_container& container, t_storage& stg, typename t_storage::hsection parent_section, const char* pname)
     {
       using T = typename stl_container::value_type;
       assert_blob_serializable<T>();
@@ -224,10 +224,10 @@ namespace epee
     }
     //--------------------------------------------------------------------------------------------------------------------
     template<class stl_container, class t_storage>
-    bool serialize_stl_container_t_obj(const stl_container& container, t_storage& stg, section* parent_section, const char* pname)
+    bool serialize_stl_container_t_obj(const stl_container& container, t_storage& stg, typename t_storage::hsection parent_section, const char* pname)
     {
       if (container.empty()) return true;
-      auto* sec_array = stg.template make_array_t<section>(pname, parent_section);
+      auto* sec_array = stg.template make_array_t<section>(pname, parent_section, container.size());
       CHECK_AND_ASSERT_MES(sec_array, false, "failed to insert first section with section name {}", pname);
 
       for (auto& elem : container)
@@ -237,7 +237,7 @@ namespace epee
     }
     //--------------------------------------------------------------------------------------------------------------------
     template<class stl_container, class t_storage>
-    bool unserialize_stl_container_t_obj(stl_container& container, t_storage& stg, section* parent_section, const char* pname)
+    bool unserialize_stl_container_t_obj(stl_container& container, t_storage& stg, typename t_storage::hsection parent_section, const char* pname)
     {
       container.clear();
       auto* arr = stg.template get_array<section>(pname, parent_section);
@@ -249,7 +249,7 @@ namespace epee
     }
     //--------------------------------------------------------------------------------------------------------------------
     template<typename T, size_t Size, class t_storage>
-    bool unserialize_stl_container_t_obj(std::array<T, Size>& out, t_storage& stg, section* parent_section, const char* pname)
+    bool unserialize_stl_container_t_obj(std::array<T, Size>& out, t_storage& stg, typename t_storage::hsection parent_section, const char* pname)
     {
       static_assert(Size > 0, "cannot deserialize empty std::array");
       auto* arr = stg.template get_array<section>(pname, parent_section);
@@ -263,7 +263,7 @@ namespace epee
     }
     //--------------------------------------------------------------------------------------------------------------------
     template <bool Serializing, typename T, typename Storage>
-    bool perform_serialize(T& d, Storage& stg, section* parent_section, const char* pname)
+    bool perform_serialize(T& d, Storage& stg, typename Storage::hsection parent_section, const char* pname)
     {
       if constexpr (Serializing)
         return kv_serialize(d, stg, parent_section, pname);
@@ -272,7 +272,7 @@ namespace epee
     }
 
     template <bool Serializing, typename T, typename Storage>
-    bool perform_serialize_blob(T& d, Storage& stg, section* parent_section, const char* pname)
+    bool perform_serialize_blob(T& d, Storage& stg, typename Storage::hsection parent_section, const char* pname)
     {
       if constexpr (Serializing)
         return serialize_t_val_as_blob(d, stg, parent_section, pname);
@@ -281,7 +281,7 @@ namespace epee
     }
 
     template <bool Serializing, typename T, typename Storage>
-    bool perform_serialize_blob_container(T& d, Storage& stg, section* parent_section, const char* pname)
+    bool perform_serialize_blob_container(T& d, Storage& stg, typename Storage::hsection parent_section, const char* pname)
     {
       if constexpr (Serializing)
         return serialize_stl_container_pod_val_as_blob(d, stg, parent_section, pname);
@@ -290,7 +290,7 @@ namespace epee
     }
 
     template<class T, class Storage>
-    bool kv_serialize(const T& d, Storage& stg, section* parent_section, const char* pname)
+    bool kv_serialize(const T& d, Storage& stg, typename Storage::hsection parent_section, const char* pname)
     {
       if constexpr (is_std_optional<T>)
         // Optional: only serialize if non-empty
@@ -312,7 +312,7 @@ namespace epee
         return serialize_stl_container_t_obj(d, stg, parent_section, pname);
     }
     template<class T, class Storage>
-    bool kv_unserialize(T& d, Storage& stg, section* parent_section, const char* pname)
+    bool kv_unserialize(T& d, Storage& stg, typename Storage::hsection parent_section, const char* pname)
     {
       if constexpr (is_std_optional<T>) {
         // Emplace a new value and try to deserialize into it
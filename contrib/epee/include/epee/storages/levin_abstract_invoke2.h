@@ -40,22 +40,15 @@ namespace epee
       if(!transport.is_connected())
         return false;
 
-      serialization::portable_storage stg;
-      out_struct.store(stg);
       std::string buff_to_send, buff_to_recv;
-      stg.store_to_binary(buff_to_send);
+      serialization::store_t_to_binary(out_struct, buff_to_send);
 
       int res = transport.invoke(command, buff_to_send, buff_to_recv);
       if( res <=0 )
       {
         return false;
       }
-      serialization::portable_storage stg_ret;
-      if(!stg_ret.load_from_binary(buff_to_recv))
-      {
-        return false;
-      }
-      return result_struct.load(stg_ret);
+      return serialization::load_t_from_binary(result_struct, buff_to_recv);
     }
 
     template<class t_arg, class t_transport>
@@ -64,10 +57,8 @@ namespace epee
       if(!transport.is_connected())
         return false;
 
-      serialization::portable_storage stg;
-      out_struct.store(&stg);
       std::string buff_to_send;
-      stg.store_to_binary(buff_to_send);
+      serialization::store_t_to_binary(out_struct, buff_to_send);
 
       int res = transport.notify(command, buff_to_send);
       if(res <=0 )
@@ -81,31 +72,22 @@ namespace epee
     bool invoke_remote_command2(boost::uuids::uuid conn_id, int command, const t_arg& out_struct, t_result& result_struct, t_transport& transport)
     {
 
-      typename serialization::portable_storage stg;
-      out_struct.store(stg);
       std::string buff_to_send, buff_to_recv;
-      stg.store_to_binary(buff_to_send);
+      serialization::store_t_to_binary(out_struct, buff_to_send);
 
       int res = transport.invoke(command, buff_to_send, buff_to_recv, conn_id);
       if( res <=0 )
       {
         return false;
       }
-      typename serialization::portable_storage stg_ret;
-      if(!stg_ret.load_from_binary(buff_to_recv))
-      {
-        return false;
-      }
-      return result_struct.load(stg_ret);
+      return serialization::load_t_from_binary(result_struct, buff_to_recv);
     }
 
     template<class t_result, class t_arg, class callback_t, class t_transport>
     bool async_invoke_remote_command2(boost::uuids::uuid conn_id, int command, const t_arg& out_struct, t_transport& transport, const callback_t &cb, std::chrono::nanoseconds inv_timeout = 0ns)
     {
-      typename serialization::portable_storage stg;
-      const_cast<t_arg&>(out_struct).store(stg);//TODO: add true const support to searilzation
       std::string buff_to_send;
-      stg.store_to_binary(buff_to_send);
+      serialization::store_t_to_binary(out_struct, buff_to_send);
       int res = transport.invoke_async(command, epee::strspan<uint8_t>(buff_to_send), conn_id, [cb, command](int code, const epee::span<const uint8_t> buff, typename t_transport::connection_context& context)->bool 
       {
         t_result result_struct{};
@@ -114,13 +96,7 @@ namespace epee
           cb(code, std::move(result_struct), context);
           return false;
         }
-        serialization::portable_storage stg_ret;
-        if(!stg_ret.load_from_binary(buff))
-        {
-          cb(LEVIN_ERROR_FORMAT, std::move(result_struct), context);
-          return false;
-        }
-        if (!result_struct.load(stg_ret))
+        if (!serialization::load_t_from_binary(result_struct, buff))
         {
           cb(LEVIN_ERROR_FORMAT, std::move(result_struct), context);
           return false;
@@ -139,10 +115,8 @@ namespace epee
     bool notify_remote_command2(boost::uuids::uuid conn_id, int command, const t_arg& out_struct, t_transport& transport)
     {
 
-      serialization::portable_storage stg;
-      out_struct.store(stg);
       std::string buff_to_send;
-      stg.store_to_binary(buff_to_send);
+      serialization::store_t_to_binary(out_struct, buff_to_send);
 
       int res = transport.notify(command, epee::strspan<uint8_t>(buff_to_send), conn_id);
       if(res <=0 )
@@ -156,23 +130,16 @@ namespace epee
     template<class t_owner, class t_in_type, class t_out_type, class t_context, class callback_t>
     int buff_to_t_adapter(int command, const epee::span<const uint8_t> in_buff, std::string& buff_out, callback_t cb, t_context& context )
     {
-      serialization::portable_storage strg;
-      if(!strg.load_from_binary(in_buff))
-      {
-        return -1;
-      }
       t_in_type in_struct{};
       t_out_type out_struct{};
 
-      if (!in_struct.load(strg))
+      if (!serialization::load_t_from_binary(in_struct, in_buff))
       {
         return -1;
       }
       int res = cb(command, in_struct, out_struct, context);
-      serialization::portable_storage strg_out;
-      out_struct.store(strg_out);
 
-      if(!strg_out.store_to_binary(buff_out))
+      if (!serialization::store_t_to_binary(out_struct, buff_out))
       {
         return -1;
       }
@@ -183,13 +150,8 @@ namespace epee
     template<class t_owner, class t_in_type, class t_context, class callback_t>
     int buff_to_t_adapter(t_owner* powner, int command, const epee::span<const uint8_t> in_buff, callback_t cb, t_context& context)
     {
-      serialization::portable_storage strg;
-      if(!strg.load_from_binary(in_buff))
-      {
-        return -1;
-      }
       t_in_type in_struct{};
-      if (!in_struct.load(strg))
+      if (!serialization::load_t_from_binary(in_struct, in_buff))
       {
         return -1;
       }
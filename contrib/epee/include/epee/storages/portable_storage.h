@@ -46,6 +46,8 @@ namespace epee
     class portable_storage
     {
     public:
+      using hsection = section*;
+
       portable_storage() = default;
       virtual ~portable_storage() = default;
       section*   open_section(const std::string& section_name,  section* parent_section, bool create_if_notexist = false);
@@ -126,9 +128,10 @@ namespace epee
       template <typename T>
       array_entry* make_array(const std::string& value_name, section* parent_section);
 
-      /// Same as above, but returns the array_t<T>* rather than the array_entry.
+      /// Same as above, but returns the array_t<T>* rather than the array_entry, reserving space
+      /// for `size` elements.
       template <typename T>
-      array_t<T>* make_array_t(const std::string& value_name, section* parent_section);
+      array_t<T>* make_array_t(const std::string& value_name, section* parent_section, size_t size = 0);
 
       //------------------------------------------------------------------------
       //delete entry (section, value or array)
@@ -247,9 +250,13 @@ namespace epee
       CATCH_ENTRY("portable_storage::make_array", nullptr);
     }
     template <typename T>
-    array_t<T>* portable_storage::make_array_t(const std::string& value_name, section* parent_section)
+    array_t<T>* portable_storage::make_array_t(const std::string& value_name, section* parent_section, size_t size)
     {
-      return std::get_if<array_t<T>>(make_array<T>(value_name, parent_section));
+      auto* arr = std::get_if<array_t<T>>(make_array<T>(value_name, parent_section));
+      if constexpr (!std::is_same_v<T, bool>) // bool uses a std::deque, which isn't reserveable
+        if (arr && size)
+          arr->reserve(size);
+      return arr;
     }
   }
 }
@@ -0,0 +1,550 @@
+#pragma once
+
+#include <cstring>
+#include <deque>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <typeinfo>
+#include <variant>
+#include <vector>
+
+#include <oxenc/endian.h>
+
+#include "portable_storage_base.h"
+#include "portable_storage_from_bin.h"
+#include "portable_storage_val_converters.h"
+#include "../span.h"
+
+// Direct (DOM-less) storages for the binary portable storage format.
+//
+// portable_storage builds a tree of std::map sections and std::variant values, and only then walks
+// it to produce (or after parsing a buffer into it, to extract) the serialized values.  For large
+// p2p messages such as block spans that costs an allocation for every name, string and section on
+// each side of the wire.  binary_writer and binary_reader implement the same interface as
+// portable_storage as used by the KV_SERIALIZE overloads, but write straight into the output buffer
+// and read straight out of the input buffer; types opt in with KV_MAP_SERIALIZABLE_BINARY (see
+// keyvalue_serialization.h).
+//
+// The output is wire compatible with portable_storage: the only difference is that entries are
+// written in declaration order rather than sorted by name, which binary readers (which build a
+// name lookup) don't care about.
+
+namespace epee
+{
+  namespace serialization
+  {
+    /// Serializes directly into a binary portable storage buffer.  Entries must be written
+    /// depth-first, which is how the KV_SERIALIZE code generates them: once a child section has
+    /// been opened nothing more may be added to a section that was opened before it until the child
+    /// is complete.
+    class binary_writer
+    {
+    public:
+      struct frame
+      {
+        size_t count_pos; // Where the varint entry count of this section starts in the buffer
+        uint64_t count;   // Number of entries written so far
+      };
+      using hsection = frame*;
+
+      /// Proxy returned by make_array_t; values pushed into it are written immediately, and so
+      /// must be pushed in full before anything else is written to the storage.
+      class array_writer
+      {
+        binary_writer& w;
+      public:
+        explicit array_writer(binary_writer& w) : w{w} {}
+
+        template <typename T>
+        void push_back(const T& v) { w.write_value(v); }
+
+        /// Starts a new section element and returns its frame.
+        frame& emplace_back() { return w.start_section(); }
+      };
+
+      /// Clears `out` and writes the storage header into it; the serialized storage is complete
+      /// once the object's store() returns.
+      explicit binary_writer(std::string& out) : m_out{out}, m_array{*this}
+      {
+        // The signature constants are already little-endian
+        m_out.clear();
+        m_out.append(reinterpret_cast<const char*>(&PORTABLE_STORAGE_SIGNATUREA), 4);
+        m_out.append(reinterpret_cast<const char*>(&PORTABLE_STORAGE_SIGNATUREB), 4);
+        write_int(PORTABLE_STORAGE_FORMAT_VER);
+        m_root = &start_section();
+      }
+
+      binary_writer(const binary_writer&) = delete;
+      binary_writer& operator=(const binary_writer&) = delete;
+
+      template <typename T>
+      bool set_value(std::string_view name, const T& v, hsection parent)
+      {
+        write_entry_header(name, SERIALIZE_TYPE_TAG<T>, parent);
+        write_value(v);
+        return true;
+      }
+
+      hsection open_section(std::string_view name, hsection parent, bool = true)
+      {
+        write_entry_header(name, SERIALIZE_TYPE_TAG<section>, parent);
+        return &start_section();
+      }
+
+      /// Starts an array of `size` T's; exactly `size` values must then be pushed into the
+      /// returned proxy.  Like portable_storage, T = section makes an array of sections.
+      template <typename T>
+      array_writer* make_array_t(std::string_view name, hsection parent, size_t size)
+      {
+        write_entry_header(name, SERIALIZE_FLAG_ARRAY | SERIALIZE_TYPE_TAG<T>, parent);
+        write_varint(size);
+        return &m_array;
+      }
+
+    private:
+      std::string& m_out;
+      std::deque<frame> m_frames;
+      frame* m_root;
+      array_writer m_array;
+
+      static size_t varint_size(uint64_t v)
+      {
+        return v < (1ULL << 6) ? 1 : v < (1ULL << 14) ? 2 : v < (1ULL << 30) ? 4 : 8;
+      }
+
+      template <typename T>
+      void write_int(T v)
+      {
+        static_assert(std::is_integral_v<T>);
+        if constexpr (sizeof(T) > 1)
+          oxenc::host_to_little_inplace(v);
+        m_out.append(reinterpret_cast<const char*>(&v), sizeof(v));
+      }
+
+      // Writes the varint encoding of `v` to `dest`, which must have room for varint_size(v) bytes
+      static void encode_varint(char* dest, uint64_t v)
+      {
+        CHECK_AND_ASSERT_THROW_MES(v < (1ULL << 62), "failed to pack varint -- integer value too large: {} >= 2^62", v);
+        size_t size = varint_size(v);
+        v = (v << 2) | (size == 1 ? PORTABLE_RAW_SIZE_MARK_6BIT : size == 2 ? PORTABLE_RAW_SIZE_MARK_14BIT :
+            size == 4 ? PORTABLE_RAW_SIZE_MARK_30BIT : PORTABLE_RAW_SIZE_MARK_62BIT);
+        oxenc::host_to_little_inplace(v);
+        std::memcpy(dest, &v, size);
+      }
+
+      void write_varint(uint64_t v)
+      {
+        size_t pos = m_out.size();
+        m_out.resize(pos + varint_size(v));
+        encode_varint(m_out.data() + pos, v);
+      }
+
+      template <typename T, std::enable_if_t<std::is_integral_v<T>, int> = 0>
+      void write_value(T v) { write_int(v); }
+
+      void write_value(std::string_view v)
+      {
+        CHECK_AND_ASSERT_THROW_MES(v.size() < MAX_STRING_LEN_POSSIBLE, "string to store is too large: {}", v.size());
+        write_varint(v.size());
+        m_out.append(v);
+      }
+
+      void write_value(const std::string& v) { write_value(std::string_view{v}); }
+
+      void write_value(double v)
+      {
+        static_assert(std::numeric_limits<double>::is_iec559 && sizeof(double) == 8);
+        uint64_t bits;
+        std::memcpy(&bits, &v, 8);
+        write_int(bits);
+      }
+
+      frame& start_section()
+      {
+        auto& f = m_frames.emplace_back(frame{m_out.size(), 0});
+        write_varint(0);
+        return f;
+      }
+
+      // Bumps the parent section's entry count and writes the name and type of a new entry in it.
+      void write_entry_header(std::string_view name, uint8_t type, hsection parent)
+      {
+        CHECK_AND_ASSERT_THROW_MES(name.size() < std::numeric_limits<uint8_t>::max(), "storage_entry_name is too long: {}, val: {}", name.size(), name);
+        frame& f = parent ? *parent : *m_root;
+        size_t old_size = varint_size(f.count++);
+        if (size_t new_size = varint_size(f.count); new_size != old_size)
+          // The count no longer fits in its varint, so widen it.  Because entries are written
+          // depth-first everything after it in the buffer belongs to completed children, so it's
+          // fine to shift it.
+          m_out.insert(f.count_pos, new_size - old_size, '\0');
+        encode_varint(m_out.data() + f.count_pos, f.count);
+
+        write_int(static_cast<uint8_t>(name.size()));
+        m_out.append(name);
+        write_int(type);
+      }
+    };
+
+    /// Reads values directly out of a binary portable storage buffer.  load() validates the whole
+    /// buffer up front (applying the same limits as portable_storage) and indexes its sections;
+    /// values are then decoded, with the same conversions that portable_storage allows, straight
+    /// into the object being loaded.  The buffer must outlive the reader.
+    class binary_reader
+    {
+    public:
+      struct frame
+      {
+        size_t first_entry; // Index of this section's first entry in m_entries
+        size_t entries;     // Number of entries in the section
+      };
+      using hsection = frame*;
+
+      /// Input iterator over an array value converting each element to T when dereferenced.
+      /// Dereferencing throws if the conversion fails.
+      template <typename T>
+      class converting_array_iterator
+      {
+        const uint8_t* ptr = nullptr;
+        size_t remaining = 0;
+        uint8_t type = 0;
+      public:
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T*;
+        using reference = T;
+        using iterator_category = std::input_iterator_tag;
+
+        converting_array_iterator() = default;
+        converting_array_iterator(const uint8_t* ptr, size_t size, uint8_t type) : ptr{ptr}, remaining{size}, type{type} {}
+
+        T operator*() const
+        {
+          if constexpr (std::is_same_v<T, std::string>)
+            if (type == SERIALIZE_TYPE_TAG<std::string>)
+              return std::string{read_string(ptr)};
+          T val;
+          visit_value(type, ptr, [&val](const auto& v) { convert_t(v, val); });
+          return val;
+        }
+        bool operator==(const converting_array_iterator& other) const { return remaining == other.remaining; }
+        bool operator!=(const converting_array_iterator& other) const { return !(*this == other); }
+        converting_array_iterator& operator++()
+        {
+          ptr += value_size(type, ptr);
+          --remaining;
+          return *this;
+        }
+        converting_array_iterator operator++(int)
+        {
+          auto old = *this;
+          ++*this;
+          return old;
+        }
+      };
+
+      binary_reader() = default;
+      binary_reader(const binary_reader&) = delete;
+      binary_reader& operator=(const binary_reader&) = delete;
+
+      /// Parses and validates a serialized storage; returns false if it isn't valid.
+      bool load(std::string_view data)
+      {
+        m_entries.clear();
+        m_frames.clear();
+        if (data.size() < HEADER_SIZE)
+          return false;
+        auto* p = reinterpret_cast<const uint8_t*>(data.data());
+        if (std::memcmp(p, &PORTABLE_STORAGE_SIGNATUREA, 4) ||
+            std::memcmp(p + 4, &PORTABLE_STORAGE_SIGNATUREB, 4) ||
+            p[8] != PORTABLE_STORAGE_FORMAT_VER)
+          return false;
+        TRY_ENTRY();
+        CHECK_AND_ASSERT_THROW_MES(data.size() > HEADER_SIZE, "throwable_buffer_reader: sz==0");
+        cursor c{p + HEADER_SIZE, data.size() - HEADER_SIZE};
+        m_entry_budget = c.remaining / MIN_ENTRY_SIZE;
+        m_frame_budget = c.remaining;
+        m_frames.emplace_back();
+        index_section(c, 0);
+        return true;
+        CATCH_ENTRY("binary_reader::load", false);
+      }
+      bool load(const epee::span<const uint8_t> data) { return load(std::string_view{reinterpret_cast<const char*>(data.data()), data.size()}); }
+
+      hsection open_section(std::string_view name, hsection parent, bool = false)
+      {
+        if (const entry* e = find(name, parent); e && e->type == SERIALIZE_TYPE_TAG<section>)
+          return &m_frames[e->frame];
+        return nullptr;
+      }
+
+      template <typename T>
+      bool get_value(std::string_view name, T& val, hsection parent)
+      {
+        static_assert(variant_contains<T, storage_entry>);
+        const entry* e = find(name, parent);
+        if (!e)
+          return false;
+        if constexpr (std::is_same_v<T, std::string>)
+          if (e->type == SERIALIZE_TYPE_TAG<std::string>)
+          {
+            val = read_string(e->data);
+            return true;
+          }
+        if (e->type & SERIALIZE_FLAG_ARRAY)
+          ASSERT_MES_AND_THROW("WRONG DATA CONVERSION: array to {}", typeid(T).name());
+        if (e->type == SERIALIZE_TYPE_TAG<section>)
+          ASSERT_MES_AND_THROW("WRONG DATA CONVERSION: section to {}", typeid(T).name());
+        visit_value(e->type, e->data, [&val](const auto& v) { convert_t(v, val); });
+        return true;
+      }
+
+      /// Same as portable_storage::converting_array_range: throws std::out_of_range if the member
+      /// doesn't exist or std::bad_variant_access if the member isn't an array.
+      template <typename T>
+      std::pair<converting_array_iterator<T>, converting_array_iterator<T>>
+      converting_array_range(std::string_view name, hsection parent)
+      {
+        const entry* e = find(name, parent);
+        if (!e)
+          throw std::out_of_range{std::string{name} + " does not exist"};
+        if (!(e->type & SERIALIZE_FLAG_ARRAY))
+          throw std::bad_variant_access{};
+        uint8_t type = e->type & ~SERIALIZE_FLAG_ARRAY;
+        return {converting_array_iterator<T>{e->data, e->size, type}, converting_array_iterator<T>{e->data, 0, type}};
+      }
+
+      /// Returns the sections of an array of sections, or nullptr if the given value does not
+      /// exist or is not an array of sections.
+      template <typename T>
+      std::span<frame>* get_array(std::string_view name, hsection parent)
+      {
+        static_assert(std::is_same_v<T, section>, "binary_reader only supports get_array of sections");
+        entry* e = find(name, parent);
+        if (!e || e->type != (SERIALIZE_FLAG_ARRAY | SERIALIZE_TYPE_TAG<section>))
+          return nullptr;
+        e->sections = {m_frames.data() + e->frame, e->size};
+        return &e->sections;
+      }
+
+    private:
+      static constexpr size_t HEADER_SIZE = 9; // 2 signatures and the version
+
+      struct entry
+      {
+        std::string_view name;
+        uint8_t type;
+        const uint8_t* data; // The value, or the first element of an array
+        size_t size;         // Number of array elements
+        size_t frame;        // The section's frame, or the first frame of an array of sections
+        std::span<binary_reader::frame> sections; // Set by get_array
+      };
+
+      std::vector<entry> m_entries;
+      std::vector<frame> m_frames;
+
+      // Entries and sections are indexed into slots allocated up front from the counts in the
+      // input, so we make sure those counts could actually be backed by the input before trusting
+      // them: an entry takes at least MIN_ENTRY_SIZE bytes (name length, type, and at least one byte
+      // of value) and a section at least one (its entry count).  The budgets are for the whole
+      // input rather than per section, because the counts of nested sections all cover the same
+      // bytes; a valid storage never runs out of either.
+      static constexpr size_t MIN_ENTRY_SIZE = 3;
+      size_t m_entry_budget = 0;
+      size_t m_frame_budget = 0;
+
+      struct cursor
+      {
+        const uint8_t* ptr;
+        size_t remaining;
+        size_t depth = 0;
+
+        const uint8_t* advance(size_t n)
+        {
+          CHECK_AND_ASSERT_THROW_MES(remaining >= n, " attempt to read {} bytes from buffer with {} bytes remained", n, remaining);
+          auto* p = ptr;
+          ptr += n;
+          remaining -= n;
+          return p;
+        }
+        uint64_t varint()
+        {
+          CHECK_AND_ASSERT_THROW_MES(remaining >= 1, "empty buff, expected place for varint");
+          size_t size = size_t{1} << (*ptr & PORTABLE_RAW_SIZE_MARK_MASK);
+          return read_varint(advance(size));
+        }
+      };
+
+      struct [[nodiscard]] depth_limiter
+      {
+        size_t& depth;
+        explicit depth_limiter(size_t& d) : depth{d}
+        {
+          CHECK_AND_ASSERT_THROW_MES(++depth < RECURSION_LIMIT, "Wrong blob data in portable storage: recursion limit ({}) exceeded", RECURSION_LIMIT);
+        }
+        ~depth_limiter() { --depth; }
+      };
+
+      template <typename T>
+      static T read_int(const uint8_t* p)
+      {
+        T v;
+        std::memcpy(&v, p, sizeof(T));
+        if constexpr (sizeof(T) > 1)
+          oxenc::little_to_host(v);
+        return v;
+      }
+
+      static uint64_t read_varint(const uint8_t* p)
+      {
+        switch (*p & PORTABLE_RAW_SIZE_MARK_MASK)
+        {
+          case PORTABLE_RAW_SIZE_MARK_6BIT: return read_int<uint8_t>(p) >> 2;
+          case PORTABLE_RAW_SIZE_MARK_14BIT: return read_int<uint16_t>(p) >> 2;
+          case PORTABLE_RAW_SIZE_MARK_30BIT: return read_int<uint32_t>(p) >> 2;
+          default: return read_int<uint64_t>(p) >> 2;
+        }
+      }
+
+      static std::string_view read_string(const uint8_t* p)
+      {
+        uint64_t len = read_varint(p);
+        p += size_t{1} << (*p & PORTABLE_RAW_SIZE_MARK_MASK);
+        return {reinterpret_cast<const char*>(p), len};
+      }
+
+      // Calls `f` with the (already validated) scalar value of the given type at `p`.
+      template <typename F>
+      static void visit_value(uint8_t type, const uint8_t* p, F&& f)
+      {
+        switch (type)
+        {
+          case SERIALIZE_TYPE_TAG<int64_t>:  return f(read_int<int64_t>(p));
+          case SERIALIZE_TYPE_TAG<int32_t>:  return f(read_int<int32_t>(p));
+          case SERIALIZE_TYPE_TAG<int16_t>:  return f(read_int<int16_t>(p));
+          case SERIALIZE_TYPE_TAG<int8_t>:   return f(read_int<int8_t>(p));
+          case SERIALIZE_TYPE_TAG<uint64_t>: return f(read_int<uint64_t>(p));
+          case SERIALIZE_TYPE_TAG<uint32_t>: return f(read_int<uint32_t>(p));
+          case SERIALIZE_TYPE_TAG<uint16_t>: return f(read_int<uint16_t>(p));
+          case SERIALIZE_TYPE_TAG<uint8_t>:  return f(read_int<uint8_t>(p));
+          case SERIALIZE_TYPE_TAG<bool>:     return f(read_int<uint8_t>(p) != 0);
+          case SERIALIZE_TYPE_TAG<std::string>: return f(std::string{read_string(p)});
+          default: ASSERT_MES_AND_THROW("WRONG DATA CONVERSION: cannot convert entry type {}", +type);
+        }
+      }
+
+      // Returns the encoded size of the (already validated) scalar value of the given type at `p`
+      static size_t value_size(uint8_t type, const uint8_t* p)
+      {
+        switch (type)
+        {
+          case SERIALIZE_TYPE_TAG<int64_t>: case SERIALIZE_TYPE_TAG<uint64_t>: return 8;
+          case SERIALIZE_TYPE_TAG<int32_t>: case SERIALIZE_TYPE_TAG<uint32_t>: return 4;
+          case SERIALIZE_TYPE_TAG<int16_t>: case SERIALIZE_TYPE_TAG<uint16_t>: return 2;
+          case SERIALIZE_TYPE_TAG<int8_t>: case SERIALIZE_TYPE_TAG<uint8_t>: case SERIALIZE_TYPE_TAG<bool>: return 1;
+          case SERIALIZE_TYPE_TAG<std::string>:
+          {
+            size_t vsize = size_t{1} << (*p & PORTABLE_RAW_SIZE_MARK_MASK);
+            return vsize + read_varint(p);
+          }
+          default: ASSERT_MES_AND_THROW("binary_reader: cannot iterate over an array of sections");
+        }
+      }
+
+      // Checks and skips a scalar value of the given type, throwing on an unsupported type.
+      static void skip_value(cursor& c, uint8_t type)
+      {
+        switch (type)
+        {
+          case SERIALIZE_TYPE_TAG<int64_t>: case SERIALIZE_TYPE_TAG<int32_t>:
+          case SERIALIZE_TYPE_TAG<int16_t>: case SERIALIZE_TYPE_TAG<int8_t>:
+          case SERIALIZE_TYPE_TAG<uint64_t>: case SERIALIZE_TYPE_TAG<uint32_t>:
+          case SERIALIZE_TYPE_TAG<uint16_t>: case SERIALIZE_TYPE_TAG<uint8_t>:
+          case SERIALIZE_TYPE_TAG<bool>:
+            c.advance(value_size(type, nullptr));
+            return;
+          case SERIALIZE_TYPE_TAG<std::string>:
+          {
+            uint64_t len = c.varint();
+            CHECK_AND_ASSERT_THROW_MES(len < MAX_STRING_LEN_POSSIBLE, "to big string len value in storage: {}", len);
+            CHECK_AND_ASSERT_THROW_MES(c.remaining >= len, "string len count value {} goes out of remain storage len {}", len, c.remaining);
+            c.advance(len);
+            return;
+          }
+          // double is not supported by the binary format, same as portable_storage
+          default: ASSERT_MES_AND_THROW("unknown entry_type code = {}", +type);
+        }
+      }
+
+      // Indexes the section starting at the cursor into the (already allocated) frame `fi`, and
+      // recursively indexes its child sections.
+      void index_section(cursor& c, size_t fi)
+      {
+        uint64_t count = c.varint();
+        CHECK_AND_ASSERT_THROW_MES(count <= c.remaining / MIN_ENTRY_SIZE && count <= m_entry_budget, "Size sanity check failed");
+        m_entry_budget -= count;
+        size_t first = m_entries.size();
+        m_frames[fi] = {first, count};
+        m_entries.resize(first + count);
+        for (size_t i = first; i < first + count; i++)
+        {
+          uint8_t name_len = *c.advance(1);
+          std::string_view name{reinterpret_cast<const char*>(c.advance(name_len)), name_len};
+          index_entry(c, name, i);
+        }
+      }
+
+      void index_entry(cursor& c, std::string_view name, size_t ei)
+      {
+        depth_limiter lim{c.depth};
+        uint8_t type = *c.advance(1);
+        entry e{name, type, c.ptr, 0, 0, {}};
+        if (type == SERIALIZE_TYPE_TAG<section>)
+        {
+          CHECK_AND_ASSERT_THROW_MES(m_frame_budget >= 1, "Size sanity check failed");
+          m_frame_budget--;
+          e.frame = m_frames.size();
+          m_frames.emplace_back();
+          index_section(c, e.frame);
+        }
+        else if (type & SERIALIZE_FLAG_ARRAY)
+        {
+          depth_limiter arr_lim{c.depth};
+          uint8_t elem_type = type & ~SERIALIZE_FLAG_ARRAY;
+          e.size = c.varint();
+          CHECK_AND_ASSERT_THROW_MES(e.size <= c.remaining, "Size sanity check failed");
+          e.data = c.ptr;
+          if (elem_type == SERIALIZE_TYPE_TAG<section>)
+          {
+            CHECK_AND_ASSERT_THROW_MES(e.size <= m_frame_budget, "Size sanity check failed");
+            m_frame_budget -= e.size;
+            e.frame = m_frames.size();
+            m_frames.resize(e.frame + e.size);
+            for (size_t i = 0; i < e.size; i++)
+              index_section(c, e.frame + i);
+          }
+          else
+          {
+            for (size_t i = 0; i < e.size; i++)
+              skip_value(c, elem_type);
+          }
+        }
+        else
+          skip_value(c, type);
+        m_entries[ei] = e;
+      }
+
+      entry* find(std::string_view name, hsection parent)
+      {
+        const frame& f = parent ? *parent : m_frames.front();
+        // Duplicate names keep the first value, as with portable_storage
+        for (size_t i = f.first_entry; i < f.first_entry + f.entries; i++)
+          if (m_entries[i].name == name)
+            return &m_entries[i];
+        return nullptr;
+      }
+    };
+  }
+}
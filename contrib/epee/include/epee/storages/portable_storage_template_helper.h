@@ -31,11 +31,19 @@
 
 #include "parserse_base_utils.h"
 #include "portable_storage.h"
+#include "portable_storage_direct.h"
 
 namespace epee
 {
   namespace serialization
   {
+    /// True for types declared with KV_MAP_SERIALIZABLE_BINARY, which the binary helpers below
+    /// serialize directly rather than through a portable_storage.
+    template <typename T>
+    concept direct_binary_serializable = requires(const T& in, T& out, binary_writer& w, binary_reader& r) {
+      in.store(w);
+      out.load(r);
+    };
     //-----------------------------------------------------------------------------------------------------------
     template <typename T>
     bool load_t_from_json(T& out, std::string_view json_buff)
@@ -68,6 +76,11 @@ namespace epee
     template<class t_struct>
     bool load_t_from_binary(t_struct& out, const epee::span<const uint8_t> binary_buff)
     {
+      if constexpr (direct_binary_serializable<t_struct>)
+      {
+        binary_reader reader;
+        return reader.load(binary_buff) && out.load(reader);
+      }
       portable_storage ps;
       bool rs = ps.load_from_binary(binary_buff);
       if(!rs)
@@ -79,6 +92,11 @@ namespace epee
     template<class t_struct>
     bool load_t_from_binary(t_struct& out, std::string_view binary_buff)
     {
+      if constexpr (direct_binary_serializable<t_struct>)
+      {
+        binary_reader reader;
+        return reader.load(binary_buff) && out.load(reader);
+      }
       portable_storage ps;
       if (!ps.load_from_binary(binary_buff))
         return false;
@@ -89,6 +107,13 @@ namespace epee
     template<class t_struct>
     bool store_t_to_binary(t_struct& str_in, std::string& binary_buff, [[maybe_unused]]size_t indent = 0)
     {
+      if constexpr (direct_binary_serializable<std::remove_const_t<t_struct>>)
+      {
+        TRY_ENTRY();
+        binary_writer writer{binary_buff};
+        return str_in.store(writer);
+        CATCH_ENTRY("store_t_to_binary", false);
+      }
       portable_storage ps;
       str_in.store(ps);
       return ps.store_to_binary(binary_buff);
@@ -0,0 +1,21 @@
+#include "epee/net/command_stats.h"
+
+#include <ctime>
+
+namespace epee::net_utils {
+
+std::chrono::nanoseconds thread_cpu_time() {
+#ifdef CLOCK_THREAD_CPUTIME_ID
+  timespec ts;
+  if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) == 0)
+    return std::chrono::seconds{ts.tv_sec} + std::chrono::nanoseconds{ts.tv_nsec};
+#endif
+  return std::chrono::steady_clock::now().time_since_epoch();
+}
+
+command_stats_registry& command_stats() {
+  static command_stats_registry registry;
+  return registry;
+}
+
+}  // namespace epee::net_utils
@@ -171,6 +171,7 @@ void connection_basic::set_rate_up_limit(uint64_t limit) {
 		std::lock_guard lock{network_throttle_manager::m_lock_get_global_throttle_out};
 		network_throttle_manager::get_global_throttle_out().set_target_speed(limit);
 	}
+	network_throttle_manager::get_global_bucket_out().set_target_speed(limit);
 }
 
 void connection_basic::set_rate_down_limit(uint64_t limit) {
@@ -183,6 +184,7 @@ void connection_basic::set_rate_down_limit(uint64_t limit) {
 	  std::lock_guard lock{network_throttle_manager::m_lock_get_global_throttle_inreq};
 		network_throttle_manager::get_global_throttle_inreq().set_target_speed(limit);
 	}
+	network_throttle_manager::get_global_bucket_in().set_target_speed(limit);
 }
 
 uint64_t connection_basic::get_rate_up_limit() {
@@ -203,6 +205,20 @@ uint64_t connection_basic::get_rate_down_limit() {
     return limit;
 }
 
+namespace {
+	std::atomic<uint64_t> send_writes{0};
+	std::atomic<uint64_t> send_messages{0};
+}
+
+void connection_basic::add_send_write_stats(size_t messages) {
+	send_writes.fetch_add(1, std::memory_order_relaxed);
+	send_messages.fetch_add(messages, std::memory_order_relaxed);
+}
+
+std::pair<uint64_t, uint64_t> connection_basic::get_send_write_stats() {
+	return {send_writes.load(std::memory_order_relaxed), send_messages.load(std::memory_order_relaxed)};
+}
+
 void connection_basic::set_tos_flag(int tos) {
 	connection_basic_pimpl::m_default_tos = tos;
 }
@@ -211,40 +227,29 @@ int connection_basic::get_tos_flag() {
 	return connection_basic_pimpl::m_default_tos;
 }
 
-void connection_basic::sleep_before_packet(size_t packet_size, int phase,  int q_len) {
-	double delay=0; // will be calculated
-	do
-	{ // rate limiting
-		if (m_was_shutdown) { 
-			return;
-		}
-
-		{ 
-			std::lock_guard lock{network_throttle_manager::m_lock_get_global_throttle_out};
-			delay = network_throttle_manager::get_global_throttle_out().get_sleep_time_after_tick( packet_size );
-		}
-
-		delay *= 0.50;
-		if (delay > 0) {
-      long int ms = (long int)(delay * 1000);
-			std::this_thread::sleep_for(std::chrono::milliseconds{ms});
-		}
-	} while(delay > 0);
-
-// XXX LATER XXX
+std::chrono::steady_clock::duration connection_basic::throttle_read(size_t packet_size) {
+	// (the global "in" counter is updated for every connection in connection<>::handle_read)
+	return network_throttle_manager::get_global_bucket_in().consume(packet_size);
+}
+
+std::chrono::steady_clock::duration connection_basic::throttle_write(size_t packet_size) {
 	{
-	  std::lock_guard lock{network_throttle_manager::m_lock_get_global_throttle_out};
-		network_throttle_manager::get_global_throttle_out().handle_trafic_exact( packet_size ); // increase counter - global
+		std::lock_guard lock{network_throttle_manager::m_lock_get_global_throttle_out};
+		network_throttle_manager::get_global_throttle_out().handle_trafic_exact(packet_size); // increase counter - global
 	}
+	return network_throttle_manager::get_global_bucket_out().consume(packet_size);
+}
 
+std::chrono::steady_clock::duration connection_basic::get_write_wait_time() {
+	return network_throttle_manager::get_global_bucket_out().get_wait_time();
 }
 
 void connection_basic::do_send_handler_write(const void* ptr , size_t cb ) {
-  // No sleeping here; sleeping is done once and for all in connection<t_protocol_handler>::handle_write
+  // Nothing to do here; throttling is done once and for all in connection<t_protocol_handler>::handle_write
 }
 
 void connection_basic::do_send_handler_write_from_queue( const boost::system::error_code& e, size_t cb, int q_len ) {
-  // No sleeping here; sleeping is done once and for all in connection<t_protocol_handler>::handle_write
+  // Nothing to do here; throttling is done once and for all in connection<t_protocol_handler>::handle_write
 }
 
 void connection_basic::logger_handle_net_read(size_t size) { // network data read
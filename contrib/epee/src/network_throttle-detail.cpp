@@ -321,6 +321,60 @@ std::pair<uint64_t, uint64_t> network_throttle::get_stats() const {
 }
 
 
+token_bucket::token_bucket(network_speed_kbps target, now_function now)
+	: m_now(std::move(now)), m_last_refill(m_now())
+{
+	set_target_speed(target);
+}
+
+void token_bucket::set_target_speed(network_speed_kbps target)
+{
+	std::lock_guard lock{m_mutex};
+	m_target_speed = std::max(target, 0.0) * 1024;
+	m_tokens = m_target_speed; // start full, i.e. allow a one second burst
+	m_last_refill = m_now();
+}
+
+network_speed_kbps token_bucket::get_target_speed() const
+{
+	std::lock_guard lock{m_mutex};
+	return m_target_speed / 1024;
+}
+
+void token_bucket::refill(clock::time_point now)
+{
+	const double elapsed = std::chrono::duration<double>(now - m_last_refill).count();
+	m_last_refill = now;
+	if (elapsed > 0)
+		m_tokens = std::min(m_tokens + elapsed * m_target_speed, m_target_speed);
+}
+
+token_bucket::clock::duration token_bucket::time_to_repay(double tokens) const
+{
+	if (tokens >= 0 || m_target_speed <= 0)
+		return clock::duration::zero();
+	return std::chrono::duration_cast<clock::duration>(std::chrono::duration<double>(-tokens / m_target_speed));
+}
+
+token_bucket::clock::duration token_bucket::consume(size_t packet_size)
+{
+	std::lock_guard lock{m_mutex};
+	if (m_target_speed <= 0)
+		return clock::duration::zero();
+	refill(m_now());
+	m_tokens -= packet_size;
+	return time_to_repay(m_tokens);
+}
+
+token_bucket::clock::duration token_bucket::get_wait_time() const
+{
+	std::lock_guard lock{m_mutex};
+	// What refill() would give us, without updating the bucket
+	const double elapsed = std::chrono::duration<double>(m_now() - m_last_refill).count();
+	return time_to_repay(m_tokens + std::max(elapsed, 0.0) * m_target_speed);
+}
+
+
 } // namespace
 } // namespace
 
@@ -91,6 +91,17 @@ i_network_throttle & network_throttle_manager::get_global_throttle_out() {
 	return obj_get_global_throttle_out;
 }
 
+// The buckets start at the same 16 kB/s as a fresh network_throttle; the daemon sets the real
+// limits from --limit-rate-up/down at startup.
+token_bucket & network_throttle_manager::get_global_bucket_in() {
+	static token_bucket obj_get_global_bucket_in(16);
+	return obj_get_global_bucket_in;
+}
+
+token_bucket & network_throttle_manager::get_global_bucket_out() {
+	static token_bucket obj_get_global_bucket_out(16);
+	return obj_get_global_bucket_out;
+}
 
 
 
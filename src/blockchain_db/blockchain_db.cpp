@@ -290,6 +290,14 @@ transaction BlockchainDB::get_tx(const crypto::hash& h) const {
     return tx;
 }
 
+std::vector<bool> BlockchainDB::has_key_images(const std::vector<crypto::key_image>& imgs) const {
+    std::vector<bool> result;
+    result.reserve(imgs.size());
+    for (const auto& img : imgs)
+        result.push_back(has_key_image(img));
+    return result;
+}
+
 uint64_t BlockchainDB::get_output_unlock_time(
         const uint64_t amount, const uint64_t amount_index) const {
     output_data_t odata = get_output_key(amount, amount_index);
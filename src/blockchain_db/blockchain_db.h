@@ -1533,6 +1533,19 @@ class BlockchainDB {
      */
     virtual bool has_key_image(const crypto::key_image& img) const = 0;
 
+    /**
+     * @brief check which of a list of key images are stored as spent
+     *
+     * Equivalent to calling has_key_image() for each key image, but implementations may check
+     * large lists much more efficiently.
+     *
+     * @param imgs the key images to check for
+     *
+     * @return a vector the same size as imgs with each element true if the corresponding key
+     * image is present, otherwise false
+     */
+    virtual std::vector<bool> has_key_images(const std::vector<crypto::key_image>& imgs) const;
+
     /**
      * @brief add a txpool transaction
      *
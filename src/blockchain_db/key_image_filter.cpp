@@ -0,0 +1,108 @@
+#include "key_image_filter.h"
+
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+
+namespace cryptonote {
+
+namespace {
+
+    // splitmix64's finalizer
+    uint64_t mix(uint64_t x) {
+        x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+        return x ^ (x >> 31);
+    }
+
+}  // namespace
+
+key_image_filter::layer::layer(size_t capacity) : capacity{capacity} {
+    uint64_t bits = 64;
+    while (bits < capacity * BITS_PER_ELEMENT)
+        bits <<= 1;
+    mask = bits - 1;
+    words = std::make_unique<std::atomic<uint64_t>[]>(bits / 64);
+    for (size_t i = 0; i < bits / 64; i++)
+        words[i].store(0, std::memory_order_relaxed);
+}
+
+key_image_filter::key_image_filter(size_t expected) {
+    // Key images are already uniformly distributed, but seeding the hashes keeps anyone from
+    // picking key images that deliberately collide in the filter.
+    for (auto& s : m_seed)
+        s = crypto::rand<uint64_t>();
+    clear(expected);
+}
+
+void key_image_filter::clear(size_t expected) {
+    std::unique_lock lock{m_mutex};
+    m_layers.clear();
+    // Leave some room for growth before we need a second layer
+    m_layers.emplace_back(std::max(expected + expected / 4, MIN_CAPACITY));
+}
+
+key_image_filter::hashes key_image_filter::hash(const crypto::key_image& ki) const {
+    static_assert(sizeof(ki) == 32);
+    uint64_t w[4];
+    std::memcpy(w, &ki, sizeof(w));
+    // h2 must be odd so that successive probes h1 + i*h2 don't cycle early
+    return {mix(w[0] ^ w[2] ^ m_seed[0]), mix(w[1] ^ w[3] ^ m_seed[1]) | 1};
+}
+
+bool key_image_filter::test(const layer& l, const hashes& h) {
+    for (size_t i = 0; i < HASHES; i++) {
+        const uint64_t bit = (h.h1 + i * h.h2) & l.mask;
+        if (!(l.words[bit / 64].load(std::memory_order_acquire) & (uint64_t{1} << (bit % 64))))
+            return false;
+    }
+    return true;
+}
+
+void key_image_filter::insert(const crypto::key_image& ki) {
+    const auto h = hash(ki);
+    {
+        // Only the inserting thread modifies the layers, so it doesn't need a lock to read them.
+        auto& l = m_layers.back();
+        if (l.count.load(std::memory_order_relaxed) < l.capacity) {
+            for (size_t i = 0; i < HASHES; i++) {
+                const uint64_t bit = (h.h1 + i * h.h2) & l.mask;
+                l.words[bit / 64].fetch_or(uint64_t{1} << (bit % 64), std::memory_order_release);
+            }
+            l.count.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+    }
+
+    std::unique_lock lock{m_mutex};
+    m_layers.emplace_back(m_layers.back().capacity * 2);
+    lock.unlock();
+    insert(ki);
+}
+
+bool key_image_filter::maybe_contains(const crypto::key_image& ki) const {
+    const auto h = hash(ki);
+    std::shared_lock lock{m_mutex};
+    for (const auto& l : m_layers)
+        if (test(l, h))
+            return true;
+    return false;
+}
+
+size_t key_image_filter::size() const {
+    std::shared_lock lock{m_mutex};
+    size_t n = 0;
+    for (const auto& l : m_layers)
+        n += l.count.load(std::memory_order_relaxed);
+    return n;
+}
+
+size_t key_image_filter::memory_usage() const {
+    std::shared_lock lock{m_mutex};
+    size_t bytes = 0;
+    for (const auto& l : m_layers)
+        bytes += (l.mask + 1) / 8;
+    return bytes;
+}
+
+}  // namespace cryptonote
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <shared_mutex>
+
+#include "crypto/crypto.h"
+
+namespace cryptonote {
+
+/// In-memory Bloom filter over the spent key images, used to answer most "is this key image
+/// spent?" queries for unspent key images without touching the database.
+///
+/// A negative answer is definitive; a positive one only means the database has to be checked.
+/// Bloom filters can't remove elements, so key images that become unspent again (when a block is
+/// popped) stay in the filter; that only makes the filter slightly less effective.  When the
+/// filter fills up another, twice as large, layer gets added (a "scalable" Bloom filter), so the
+/// false positive rate stays around 1% however many key images get added.
+///
+/// Only one thread may insert at a time, but lookups can happen concurrently with insertion.
+class key_image_filter {
+  public:
+    /// Bits per expected element, and the number of bits set/checked for each key image; this
+    /// gives a false positive rate of about 1%.
+    static constexpr size_t BITS_PER_ELEMENT = 10, HASHES = 7;
+
+    /// Minimum capacity of the first layer.
+    static constexpr size_t MIN_CAPACITY = 1 << 16;
+
+    explicit key_image_filter(size_t expected = 0);
+
+    /// Removes everything from the filter, sizing it for `expected` key images.
+    void clear(size_t expected = 0);
+
+    void insert(const crypto::key_image& ki);
+
+    /// Returns false if `ki` has definitely not been inserted.
+    bool maybe_contains(const crypto::key_image& ki) const;
+
+    /// Returns the number of insertions so far.
+    size_t size() const;
+
+    /// Returns the memory used by the filter's bit arrays, in bytes.
+    size_t memory_usage() const;
+
+  private:
+    struct layer {
+        std::unique_ptr<std::atomic<uint64_t>[]> words;
+        uint64_t mask;  // Number of bits, minus 1 (the number of bits is a power of 2)
+        size_t capacity;
+        std::atomic<size_t> count = 0;
+
+        explicit layer(size_t capacity);
+    };
+
+    struct hashes {
+        uint64_t h1, h2;
+    };
+    hashes hash(const crypto::key_image& ki) const;
+    static bool test(const layer& l, const hashes& h);
+
+    mutable std::shared_mutex m_mutex;
+    std::deque<layer> m_layers;
+    uint64_t m_seed[2];
+};
+
+}  // namespace cryptonote
@@ -42,6 +42,7 @@
 #include "checkpoints/checkpoints.h"
 #include "common/format.h"
 #include "common/median.h"
+#include "common/profiler.h"
 #include "common/pruning.h"
 #include "common/string_util.h"
 #include "crypto/crypto.h"
@@ -861,6 +862,7 @@ void BlockchainLMDB::add_block(
         uint64_t num_rct_outs,
         const crypto::hash& blk_hash) {
     log::trace(logcat, "BlockchainLMDB::{}", __func__);
+    OXEN_PROFILE_SCOPE("lmdb.add_block");
     check_open();
     mdb_txn_cursors* m_cursors = &m_wcursors;
     uint64_t m_height = height();
@@ -985,6 +987,7 @@ uint64_t BlockchainLMDB::add_transaction_data(
         const crypto::hash& tx_hash,
         const crypto::hash& tx_prunable_hash) {
     log::trace(logcat, "BlockchainLMDB::{}", __func__);
+    OXEN_PROFILE_SCOPE("lmdb.add_transaction_data");
     check_open();
     mdb_txn_cursors* m_cursors = &m_wcursors;
     uint64_t m_height = height();
@@ -1371,6 +1374,9 @@ void BlockchainLMDB::add_spent_key(const crypto::key_image& k_image) {
             throw1(DB_ERROR("Error adding spent key image to db transaction: {}"_format(
                     mdb_strerror(result))));
     }
+    // If the transaction gets aborted this leaves an extra key image in the filter, which is
+    // harmless: it just means lookups of it will go to the db.
+    m_key_image_filter.insert(k_image);
 }
 
 void BlockchainLMDB::remove_spent_key(const crypto::key_image& k_image) {
@@ -1737,6 +1743,7 @@ void BlockchainLMDB::open(
                 txn.commit();
                 m_open = true;
                 migrate(db_version, nettype);
+                load_key_image_filter();
                 return;
             }
         }
@@ -1768,6 +1775,7 @@ void BlockchainLMDB::open(
     // commit the transaction
     txn.commit();
     m_open = true;
+    load_key_image_filter();
     // from here, init should be finished
 }
 
@@ -1783,6 +1791,8 @@ void BlockchainLMDB::close() {
     // FIXME: not yet thread safe!!!  Use with care.
     mdb_env_close(m_env);
     m_open = false;
+    m_key_image_filter_loaded = false;
+    m_key_image_filter.clear();
 }
 
 void BlockchainLMDB::sync() {
@@ -1856,6 +1866,7 @@ void BlockchainLMDB::reset() {
         throw0(DB_ERROR("Failed to write version to database: {}"_format(mdb_strerror(result))));
 
     txn.commit();
+    m_key_image_filter.clear();
     m_cum_size = 0;
     m_cum_count = 0;
 }
@@ -3477,6 +3488,7 @@ uint64_t BlockchainLMDB::get_num_outputs(const uint64_t& amount) const {
 output_data_t BlockchainLMDB::get_output_key(
         const uint64_t& amount, const uint64_t& index, bool include_commitmemt) const {
     log::trace(logcat, "BlockchainLMDB::{}", __func__);
+    OXEN_PROFILE_SCOPE("lmdb.get_output_key");
     check_open();
 
     TXN_PREFIX_RDONLY();
@@ -3586,8 +3598,12 @@ std::vector<std::vector<uint64_t>> BlockchainLMDB::get_tx_amount_output_indices(
 
 bool BlockchainLMDB::has_key_image(const crypto::key_image& img) const {
     log::trace(logcat, "BlockchainLMDB::{}", __func__);
+    OXEN_PROFILE_SCOPE("lmdb.has_key_image");
     check_open();
 
+    if (m_key_image_filter_loaded && !m_key_image_filter.maybe_contains(img))
+        return false;
+
     bool ret;
 
     TXN_PREFIX_RDONLY();
@@ -3599,6 +3615,87 @@ bool BlockchainLMDB::has_key_image(const crypto::key_image& img) const {
     return ret;
 }
 
+std::vector<bool> BlockchainLMDB::has_key_images(
+        const std::vector<crypto::key_image>& imgs) const {
+    log::trace(logcat, "BlockchainLMDB::{}", __func__);
+    OXEN_PROFILE_SCOPE("lmdb.has_key_images");
+    check_open();
+
+    std::vector<bool> result(imgs.size(), false);
+
+    // Most key images that get looked up aren't spent, and the filter rules most of those out
+    // without touching the db.
+    std::vector<size_t> probes;
+    probes.reserve(imgs.size());
+    const bool filtered = m_key_image_filter_loaded;
+    for (size_t i = 0; i < imgs.size(); i++)
+        if (!filtered || m_key_image_filter.maybe_contains(imgs[i]))
+            probes.push_back(i);
+    if (probes.empty())
+        return result;
+
+    // Look up the rest in the db's order so that we can walk through spent_keys with one cursor,
+    // only seeking when the next probe is beyond the cursor's current position.
+    auto compare = [](const crypto::key_image& a, const crypto::key_image& b) {
+        MDB_val va{sizeof(a), (void*)&a}, vb{sizeof(b), (void*)&b};
+        return compare_hash32(&va, &vb);
+    };
+    std::sort(probes.begin(), probes.end(), [&](size_t a, size_t b) {
+        return compare(imgs[a], imgs[b]) < 0;
+    });
+
+    TXN_PREFIX_RDONLY();
+    RCURSOR(spent_keys);
+
+    const crypto::key_image* current = nullptr;  // The key image the cursor is at
+    for (size_t i : probes) {
+        const auto& img = imgs[i];
+        int cmp = current ? compare(*current, img) : -1;
+        if (cmp < 0) {
+            MDB_val k = {sizeof(img), (void*)&img};
+            auto ret = mdb_cursor_get(
+                    m_cur_spent_keys, (MDB_val*)&zerokval, &k, MDB_GET_BOTH_RANGE);
+            if (ret == MDB_NOTFOUND)
+                break;  // img, and everything after it, is beyond the last spent key image
+            if (ret)
+                throw0(DB_ERROR("Failed to look up key image: {}"_format(mdb_strerror(ret))));
+            current = static_cast<const crypto::key_image*>(k.mv_data);
+            cmp = compare(*current, img);
+        }
+        result[i] = cmp == 0;
+    }
+
+    return result;
+}
+
+void BlockchainLMDB::load_key_image_filter() {
+    log::trace(logcat, "BlockchainLMDB::{}", __func__);
+    if (!m_open)
+        return;
+
+    const auto started = std::chrono::steady_clock::now();
+    m_key_image_filter_loaded = false;
+    {
+        TXN_PREFIX_RDONLY();
+        MDB_stat stats;
+        if (auto ret = mdb_stat(m_txn, m_spent_keys, &stats))
+            throw0(DB_ERROR("Failed to query m_spent_keys: {}"_format(mdb_strerror(ret))));
+        m_key_image_filter.clear(stats.ms_entries);
+    }
+    for_all_key_images([this](const crypto::key_image& k_image) {
+        m_key_image_filter.insert(k_image);
+        return true;
+    });
+    m_key_image_filter_loaded = true;
+
+    log::info(
+            logcat,
+            "Loaded {} spent key images into a {:.1f} MiB filter in {:.1f}s",
+            m_key_image_filter.size(),
+            m_key_image_filter.memory_usage() / 1048576.0,
+            std::chrono::duration<double>{std::chrono::steady_clock::now() - started}.count());
+}
+
 bool BlockchainLMDB::for_all_key_images(std::function<bool(const crypto::key_image&)> f) const {
     log::trace(logcat, "BlockchainLMDB::{}", __func__);
     check_open();
@@ -3849,6 +3946,7 @@ bool BlockchainLMDB::batch_start(uint64_t batch_num_blocks, uint64_t batch_bytes
 
 void BlockchainLMDB::batch_commit() {
     log::trace(logcat, "BlockchainLMDB::{}", __func__);
+    OXEN_PROFILE_SCOPE("lmdb.batch_commit");
     if (!m_batch_transactions)
         throw0(DB_ERROR("batch transactions not enabled"));
     if (!m_batch_active)
@@ -4374,7 +4472,7 @@ void BlockchainLMDB::get_output_key(
         throw0(DB_ERROR("Invalid sizes of amounts and offets"));
 
     log::trace(logcat, "BlockchainLMDB::{}", __func__);
-    auto db3 = std::chrono::steady_clock::now();
+    OXEN_PROFILE_SCOPE("lmdb.get_output_keys");
     check_open();
     outputs.clear();
     outputs.reserve(offsets.size());
@@ -4413,7 +4511,6 @@ void BlockchainLMDB::get_output_key(
             data.commitment = rct::zeroCommit(amount);
         }
     }
-    log::trace(logcat, "db3: {}", tools::friendly_duration(std::chrono::steady_clock::now() - db3));
 }
 
 void BlockchainLMDB::get_output_tx_and_index(
@@ -4445,11 +4542,10 @@ void BlockchainLMDB::get_output_tx_and_index(
         tx_indices.push_back(okp->output_id);
     }
 
-    auto db3 = std::chrono::steady_clock::now();
     if (tx_indices.size() > 0) {
+        OXEN_PROFILE_SCOPE("lmdb.get_output_tx_and_index_from_global");
         get_output_tx_and_index_from_global(tx_indices, indices);
     }
-    log::trace(logcat, "db3: {}", tools::friendly_duration(std::chrono::steady_clock::now() - db3));
 }
 
 std::map<uint64_t, std::tuple<uint64_t, uint64_t, uint64_t>> BlockchainLMDB::get_output_histogram(
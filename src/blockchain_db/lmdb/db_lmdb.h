@@ -33,6 +33,7 @@
 #include <boost/thread/tss.hpp>
 
 #include "blockchain_db/blockchain_db.h"
+#include "blockchain_db/key_image_filter.h"
 #include "common/fs.h"
 #include "ringct/rctTypes.h"
 
@@ -281,6 +282,8 @@ class BlockchainLMDB : public BlockchainDB {
 
     bool has_key_image(const crypto::key_image& img) const override;
 
+    std::vector<bool> has_key_images(const std::vector<crypto::key_image>& imgs) const override;
+
     void add_txpool_tx(
             const crypto::hash& txid,
             const std::string& blob,
@@ -469,6 +472,9 @@ class BlockchainLMDB : public BlockchainDB {
     // fix up anything that may be wrong due to past bugs
     void fixup(cryptonote::network_type nettype) override;
 
+    // (re)builds m_key_image_filter from the spent key images in the db
+    void load_key_image_filter();
+
     // migrate from older DB version to current
     void migrate(const uint32_t oldversion, cryptonote::network_type nettype);
 
@@ -522,6 +528,10 @@ class BlockchainLMDB : public BlockchainDB {
     MDB_dbi m_output_blacklist;
 
     MDB_dbi m_spent_keys;
+    // Filters out most lookups of unspent key images; only consulted once loaded (when the db is
+    // opened)
+    key_image_filter m_key_image_filter;
+    std::atomic<bool> m_key_image_filter_loaded{false};
 
     MDB_dbi m_txpool_meta;
     MDB_dbi m_txpool_blob;
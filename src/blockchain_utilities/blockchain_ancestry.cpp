@@ -45,6 +45,7 @@
 
 #include "blockchain_db/blockchain_db.h"
 #include "blockchain_objects.h"
+#include "chain_scan.h"
 #include "cryptonote_basic/cryptonote_boost_serialization.h"
 #include "cryptonote_core/cryptonote_core.h"
 #include "serialization/boost_std_variant.h"
@@ -55,7 +56,7 @@ using namespace cryptonote;
 
 static auto logcat = log::Cat("bcutil");
 
-static bool stop_requested = false;
+static std::atomic<bool> stop_requested = false;
 static uint64_t cached_txes = 0, cached_blocks = 0, cached_outputs = 0, total_txes = 0,
                 total_blocks = 0, total_outputs = 0;
 static bool opt_cache_outputs = false, opt_cache_txes = false, opt_cache_blocks = false;
@@ -216,27 +217,6 @@ static std::unordered_set<ancestor> get_ancestry(
     return i->second;
 }
 
-static bool get_block_from_height(
-        ancestry_state_t& state, BlockchainDB& db, uint64_t height, cryptonote::block& b) {
-    ++total_blocks;
-    if (state.block_cache.size() > height && state.block_cache[height].miner_tx &&
-        !state.block_cache[height].miner_tx->vin.empty()) {
-        ++cached_blocks;
-        b = state.block_cache[height];
-        return true;
-    }
-    std::string bd = db.get_block_blob_from_height(height);
-    if (!cryptonote::parse_and_validate_block_from_blob(bd, b)) {
-        log::warning(logcat, "Bad block from db");
-        return false;
-    }
-    if (opt_cache_blocks) {
-        state.block_cache.resize(height + 1);
-        state.block_cache[height] = b;
-    }
-    return true;
-}
-
 static bool get_transaction(
         ancestry_state_t& state, BlockchainDB& db, const crypto::hash& txid, ::tx_data_t& tx_data) {
     std::unordered_map<crypto::hash, ::tx_data_t>::const_iterator i = state.tx_cache.find(txid);
@@ -278,45 +258,26 @@ static bool get_output_txid(
         return true;
     }
 
-    const output_data_t od = db.get_output_key(amount, offset, false);
-    cryptonote::block b;
-    if (!get_block_from_height(state, db, od.height, b))
-        return false;
-
-    for (size_t out = 0; b.miner_tx && out < b.miner_tx->vout.size(); ++out) {
-        if (const auto* txout =
-                    std::get_if<cryptonote::txout_to_key>(&b.miner_tx->vout[out].target)) {
-            if (txout->key == od.pubkey) {
-                txid = cryptonote::get_transaction_hash(*b.miner_tx);
-                if (opt_cache_outputs)
-                    state.output_cache.insert(std::make_pair(ancestor{amount, offset}, txid));
-                return true;
-            }
-        } else {
-            log::warning(
-                    logcat,
-                    "Bad vout type in txid {}",
-                    cryptonote::get_transaction_hash(*b.miner_tx));
-            return false;
-        }
-    }
-    for (const crypto::hash& block_txid : b.tx_hashes) {
-        ::tx_data_t tx_data3;
-        if (!get_transaction(state, db, block_txid, tx_data3))
-            return false;
-
-        for (size_t out = 0; out < tx_data3.vout.size(); ++out) {
-            if (tx_data3.vout[out] == od.pubkey) {
-                txid = block_txid;
-                if (opt_cache_outputs)
-                    state.output_cache.insert(std::make_pair(ancestor{amount, offset}, txid));
-                return true;
-            }
-        }
-    }
-    return false;
+    txid = db.get_output_tx_and_index(amount, offset).first;
+    if (opt_cache_outputs)
+        state.output_cache.insert(std::make_pair(ancestor{amount, offset}, txid));
+    return true;
 }
 
+// A tx loaded during the --refresh scan, along with the txs that created each of its ring members
+// (in input order)
+struct refresh_tx {
+    crypto::hash txid;
+    ::tx_data_t data;
+    std::vector<crypto::hash> output_txids;
+};
+
+struct refresh_block {
+    uint64_t height;
+    cryptonote::block block;
+    std::vector<refresh_tx> txs;
+};
+
 int main(int argc, char* argv[]) {
     TRY_ENTRY();
 
@@ -358,6 +319,7 @@ int main(int argc, char* argv[]) {
     command_line::add_arg(desc_cmd_sett, arg_cache_blocks);
     command_line::add_arg(desc_cmd_sett, arg_include_coinbase);
     command_line::add_arg(desc_cmd_sett, arg_show_cache_stats);
+    command_line::add_arg(desc_cmd_sett, blockchain_utils::arg_scan_threads);
     command_line::add_arg(desc_cmd_only, command_line::arg_help);
 
     po::options_description desc_options("Allowed options");
@@ -394,6 +356,8 @@ int main(int argc, char* argv[]) {
     opt_cache_blocks = command_line::get_arg(vm, arg_cache_blocks);
     bool opt_include_coinbase = command_line::get_arg(vm, arg_include_coinbase);
     bool opt_show_cache_stats = command_line::get_arg(vm, arg_show_cache_stats);
+    unsigned threads = blockchain_utils::scan_thread_count(
+            command_line::get_arg(vm, blockchain_utils::arg_scan_threads));
 
     if ((!opt_txid_string.empty()) + !!opt_height + !opt_output_string.empty() > 1) {
         std::cerr << "Only one of --txid, --height, --output can be given" << std::endl;
@@ -470,89 +434,96 @@ int main(int argc, char* argv[]) {
     if (opt_refresh) {
         log::info(logcat, "Starting from height {}", state.height);
         state.block_cache.reserve(db_height);
-        for (uint64_t h = state.height; h < db_height; ++h) {
-            size_t block_ancestry_size = 0;
-            const std::string bd = db.get_block_blob_from_height(h);
-            ++total_blocks;
-            cryptonote::block b;
-            if (!cryptonote::parse_and_validate_block_from_blob(bd, b)) {
-                log::warning(logcat, "Bad block from db");
-                return 1;
-            }
-            if (opt_cache_blocks) {
-                state.block_cache.resize(h + 1);
-                state.block_cache[h] = b;
-            }
-            std::vector<crypto::hash> txids;
-            txids.reserve(1 + b.tx_hashes.size());
-            if (opt_include_coinbase && b.miner_tx)
-                txids.push_back(cryptonote::get_transaction_hash(*b.miner_tx));
-            for (const auto& h : b.tx_hashes)
-                txids.push_back(h);
-            for (const crypto::hash& txid : txids) {
-                printf("%lu/%lu               \r", (unsigned long)h, (unsigned long)db_height);
-                fflush(stdout);
-                ::tx_data_t tx_data;
-                std::unordered_map<crypto::hash, ::tx_data_t>::const_iterator i =
-                        state.tx_cache.find(txid);
-                ++total_txes;
-                if (i != state.tx_cache.end()) {
-                    ++cached_txes;
-                    tx_data = i->second;
-                } else {
-                    std::string bd;
-                    if (!db.get_pruned_tx_blob(txid, bd)) {
-                        log::warning(logcat, "Failed to get txid {} from db", txid);
-                        return 1;
-                    }
-                    cryptonote::transaction tx;
-                    if (!cryptonote::parse_and_validate_tx_base_from_blob(bd, tx)) {
-                        log::warning(logcat, "Bad tx: {}", txid);
-                        return 1;
-                    }
-                    tx_data = ::tx_data_t(tx);
-                    if (opt_cache_txes)
-                        state.tx_cache.insert(std::make_pair(txid, tx_data));
+
+        // Loading the txs and finding where their ring members came from happens across the scan
+        // threads; building up the ancestry, which depends on that of earlier txs, happens in
+        // height order in the reduce.
+        blockchain_utils::scan_options opts;
+        opts.start_height = state.height;
+        opts.stop_height = db_height;
+        opts.threads = threads;
+        opts.stop = &stop_requested;
+
+        auto map = [&](std::vector<refresh_block>& blocks,
+                       const blockchain_utils::scanned_block& b) {
+            auto& rb = blocks.emplace_back();
+            rb.height = b.height;
+            auto add_tx = [&](const crypto::hash& txid, const cryptonote::transaction& tx) {
+                auto& rtx = rb.txs.emplace_back();
+                rtx.txid = txid;
+                rtx.data = ::tx_data_t(tx);
+                std::vector<tx_out_index> indices;
+                for (const auto& [amount, absolute_offsets] : rtx.data.vin) {
+                    db.get_output_tx_and_index(amount, absolute_offsets, indices);
+                    if (indices.size() != absolute_offsets.size())
+                        throw oxen::traced<std::runtime_error>(
+                                "Output originating transaction not found");
+                    for (const auto& [output_txid, index] : indices)
+                        rtx.output_txids.push_back(output_txid);
+                }
+            };
+            rb.txs.reserve(1 + b.txs.size());
+            if (opt_include_coinbase && b.block.miner_tx)
+                add_tx(cryptonote::get_transaction_hash(*b.block.miner_tx), *b.block.miner_tx);
+            for (size_t i = 0; i < b.txs.size(); i++)
+                add_tx(b.block.tx_hashes[i], b.txs[i]);
+            if (opt_cache_blocks)
+                rb.block = b.block;
+        };
+
+        auto reduce = [&](std::vector<refresh_block>&& blocks) {
+            for (auto& rb : blocks) {
+                const uint64_t h = rb.height;
+                size_t block_ancestry_size = 0;
+                ++total_blocks;
+                if (opt_cache_blocks) {
+                    state.block_cache.resize(h + 1);
+                    state.block_cache[h] = std::move(rb.block);
                 }
-                if (tx_data.coinbase) {
-                    add_ancestry(state.ancestry, txid, std::unordered_set<ancestor>());
-                } else {
-                    for (size_t ring = 0; ring < tx_data.vin.size(); ++ring) {
-                        const uint64_t amount = tx_data.vin[ring].first;
-                        const std::vector<uint64_t>& absolute_offsets = tx_data.vin[ring].second;
-                        for (uint64_t offset : absolute_offsets) {
-                            add_ancestry(state.ancestry, txid, ancestor{amount, offset});
-                            // find the tx which created this output
-                            crypto::hash output_txid;
-                            if (!get_output_txid(state, db, amount, offset, output_txid)) {
-                                log::warning(logcat, "Output originating transaction not found");
-                                return 1;
+                for (auto& [txid, tx_data, output_txids] : rb.txs) {
+                    printf("%lu/%lu               \r", (unsigned long)h, (unsigned long)db_height);
+                    fflush(stdout);
+                    ++total_txes;
+                    if (tx_data.coinbase) {
+                        add_ancestry(state.ancestry, txid, std::unordered_set<ancestor>());
+                    } else {
+                        size_t n = 0;
+                        for (const auto& [amount, absolute_offsets] : tx_data.vin) {
+                            for (uint64_t offset : absolute_offsets) {
+                                add_ancestry(state.ancestry, txid, ancestor{amount, offset});
+                                const crypto::hash& output_txid = output_txids[n++];
+                                ++total_outputs;
+                                if (opt_cache_outputs)
+                                    state.output_cache.emplace(
+                                            ancestor{amount, offset}, output_txid);
+                                add_ancestry(
+                                        state.ancestry,
+                                        txid,
+                                        get_ancestry(state.ancestry, output_txid));
                             }
-                            add_ancestry(
-                                    state.ancestry,
-                                    txid,
-                                    get_ancestry(state.ancestry, output_txid));
                         }
                     }
+                    if (opt_cache_txes)
+                        state.tx_cache.emplace(txid, std::move(tx_data));
+                    const size_t ancestry_size = get_ancestry(state.ancestry, txid).size();
+                    block_ancestry_size += ancestry_size;
+                    log::info(logcat, "{}: {}", txid, ancestry_size);
                 }
-                const size_t ancestry_size = get_ancestry(state.ancestry, txid).size();
-                block_ancestry_size += ancestry_size;
-                log::info(logcat, "{}: {}", txid, ancestry_size);
-            }
-            if (!txids.empty()) {
-                std::string stats_msg;
-                log::info(
-                        logcat,
-                        "Height {}: {} average over {}{}",
-                        h,
-                        (block_ancestry_size / txids.size()),
-                        txids.size(),
-                        stats_msg);
+                if (!rb.txs.empty()) {
+                    log::info(
+                            logcat,
+                            "Height {}: {} average over {}",
+                            h,
+                            (block_ancestry_size / rb.txs.size()),
+                            rb.txs.size());
+                }
+                state.height = h;
             }
-            state.height = h;
-            if (stop_requested)
-                break;
-        }
+        };
+
+        auto result = blockchain_utils::scan_chain<std::vector<refresh_block>>(
+                db, opts, map, reduce);
+        log::warning(logcat, "Refresh: {}", result);
 
         log::warning(logcat, "Saving state data to {}", state_file_path);
         std::ofstream state_data_out;
@@ -28,21 +28,64 @@
 
 #include "blockchain_db/blockchain_db.h"
 #include "blockchain_objects.h"
+#include "chain_scan.h"
 #include "cryptonote_core/cryptonote_core.h"
 #include "version.h"
 
 #include <common/command_line.h>
 #include <common/guts.h>
 #include <common/median.h>
+#include <common/string_util.h>
 #include <common/exception.h>
 
 #include <fmt/std.h>
 
+#include <unordered_set>
+
 namespace po = boost::program_options;
 using namespace cryptonote;
 
 static auto logcat = log::Cat("bcutil");
 
+// The txs that created the ring members of a tx's inputs
+struct tx_parents {
+    bool coinbase = false;
+    std::vector<crypto::hash> txids;
+};
+
+static tx_parents get_tx_parents(BlockchainDB& db, const crypto::hash& txid) {
+    tx_parents parents;
+    std::string bd;
+    if (!db.get_pruned_tx_blob(txid, bd))
+        throw oxen::traced<std::runtime_error>("Failed to get txid {} from db"_format(txid));
+    cryptonote::transaction tx;
+    if (!cryptonote::parse_and_validate_tx_base_from_blob(bd, tx))
+        throw oxen::traced<std::runtime_error>("Bad tx: {}"_format(txid));
+
+    std::vector<tx_out_index> indices;
+    for (const auto& in : tx.vin) {
+        if (std::holds_alternative<cryptonote::txin_gen>(in)) {
+            log::debug(logcat, "{} is a coinbase transaction", txid);
+            parents.coinbase = true;
+            return parents;
+        }
+        auto* txin = std::get_if<cryptonote::txin_to_key>(&in);
+        if (!txin)
+            throw oxen::traced<std::runtime_error>("Bad vin type in txid {}"_format(txid));
+
+        // find the txs which created the ring members
+        db.get_output_tx_and_index(
+                txin->amount,
+                cryptonote::relative_output_offsets_to_absolute(txin->key_offsets),
+                indices);
+        for (const auto& [output_txid, index] : indices) {
+            log::debug(logcat, "adding txid: {}", output_txid);
+            parents.txids.push_back(output_txid);
+        }
+    }
+    return parents;
+}
+
 int main(int argc, char* argv[]) {
     oxen::set_terminate_handler();
     TRY_ENTRY();
@@ -70,6 +113,7 @@ int main(int argc, char* argv[]) {
     command_line::add_arg(desc_cmd_sett, arg_txid);
     command_line::add_arg(desc_cmd_sett, arg_height);
     command_line::add_arg(desc_cmd_sett, arg_include_coinbase);
+    command_line::add_arg(desc_cmd_sett, blockchain_utils::arg_scan_threads);
     command_line::add_arg(desc_cmd_only, command_line::arg_help);
 
     po::options_description desc_options("Allowed options");
@@ -100,6 +144,8 @@ int main(int argc, char* argv[]) {
     std::string opt_txid_string = command_line::get_arg(vm, arg_txid);
     uint64_t opt_height = command_line::get_arg(vm, arg_height);
     bool opt_include_coinbase = command_line::get_arg(vm, arg_include_coinbase);
+    unsigned threads = blockchain_utils::scan_thread_count(
+            command_line::get_arg(vm, blockchain_utils::arg_scan_threads));
 
     if (!opt_txid_string.empty() && opt_height) {
         std::cerr << "txid and height cannot be given at the same time" << std::endl;
@@ -161,119 +207,41 @@ int main(int argc, char* argv[]) {
         return 1;
     }
 
+    const auto started = std::chrono::steady_clock::now();
     std::vector<uint64_t> depths;
     for (const crypto::hash& start_txid : start_txids) {
         uint64_t depth = 0;
-        bool coinbase = false;
 
         log::warning(logcat, "Checking depth for txid {}", start_txid);
         std::vector<crypto::hash> txids(1, start_txid);
-        while (!coinbase) {
+        while (!txids.empty()) {
             log::warning(logcat, "Considering {} transaction(s) at depth {}", txids.size(), depth);
-            std::vector<crypto::hash> new_txids;
-            for (const crypto::hash& txid : txids) {
-                std::string bd;
-                if (!db.get_pruned_tx_blob(txid, bd)) {
-                    log::warning(logcat, "Failed to get txid {} from db", txid);
-                    return 1;
-                }
-                cryptonote::transaction tx;
-                if (!cryptonote::parse_and_validate_tx_base_from_blob(bd, tx)) {
-                    log::warning(logcat, "Bad tx: {}", txid);
-                    return 1;
-                }
-                for (size_t ring = 0; ring < tx.vin.size(); ++ring) {
-                    if (std::holds_alternative<cryptonote::txin_gen>(tx.vin[ring])) {
-                        log::debug(logcat, "{} is a coinbase transaction", txid);
-                        coinbase = true;
-                        goto done;
-                    }
-                    if (auto* txin = std::get_if<cryptonote::txin_to_key>(&tx.vin[ring])) {
-                        const uint64_t amount = txin->amount;
-                        auto absolute_offsets =
-                                cryptonote::relative_output_offsets_to_absolute(txin->key_offsets);
-                        for (uint64_t offset : absolute_offsets) {
-                            const output_data_t od = db.get_output_key(amount, offset);
-                            const crypto::hash block_hash =
-                                    db.get_block_hash_from_height(od.height);
-                            bd = db.get_block_blob(block_hash);
-                            cryptonote::block b;
-                            if (!cryptonote::parse_and_validate_block_from_blob(bd, b)) {
-                                log::warning(logcat, "Bad block from db");
-                                return 1;
-                            }
-                            // find the tx which created this output
-                            bool found = false;
-                            for (size_t out = 0; out < b.miner_tx.value().vout.size(); ++out) {
-                                if (auto* txout = std::get_if<cryptonote::txout_to_key>(
-                                            &b.miner_tx->vout[out].target)) {
-                                    if (txout->key == od.pubkey) {
-                                        found = true;
-                                        new_txids.push_back(
-                                                cryptonote::get_transaction_hash(*b.miner_tx));
-                                        log::debug(
-                                                logcat,
-                                                "adding txid: {}",
-                                                cryptonote::get_transaction_hash(*b.miner_tx));
-                                        break;
-                                    }
-                                } else {
-                                    log::warning(
-                                            logcat,
-                                            "Bad vout type in txid {}",
-                                            cryptonote::get_transaction_hash(*b.miner_tx));
-                                    return 1;
-                                }
-                            }
-                            for (const crypto::hash& block_txid : b.tx_hashes) {
-                                if (found)
-                                    break;
-                                if (!db.get_pruned_tx_blob(block_txid, bd)) {
-                                    log::warning(
-                                            logcat, "Failed to get txid {} from db", block_txid);
-                                    return 1;
-                                }
-                                cryptonote::transaction tx2;
-                                if (!cryptonote::parse_and_validate_tx_base_from_blob(bd, tx2)) {
-                                    log::warning(logcat, "Bad tx: {}", block_txid);
-                                    return 1;
-                                }
-                                for (size_t out = 0; out < tx2.vout.size(); ++out) {
-                                    if (auto* txout = std::get_if<cryptonote::txout_to_key>(
-                                                &tx2.vout[out].target)) {
-                                        if (txout->key == od.pubkey) {
-                                            found = true;
-                                            new_txids.push_back(block_txid);
-                                            log::debug(logcat, "adding txid: {}", block_txid);
-                                            break;
-                                        }
-                                    } else {
-                                        log::warning(
-                                                logcat, "Bad vout type in txid {}", block_txid);
-                                        return 1;
-                                    }
-                                }
-                            }
-                            if (!found) {
-                                log::warning(logcat, "Output originating transaction not found");
-                                return 1;
-                            }
-                        }
-                    } else {
-                        log::warning(logcat, "Bad vin type in txid {}", txid);
-                        return 1;
-                    }
-                }
-            }
-            if (!coinbase) {
-                std::swap(txids, new_txids);
-                ++depth;
+            auto parents = blockchain_utils::parallel_map(
+                    db, txids, threads, [&](const crypto::hash& txid) {
+                        return get_tx_parents(db, txid);
+                    });
+
+            bool coinbase = false;
+            // The same tx is usually reached through many ring members, but only needs to be
+            // looked at once per depth.
+            std::unordered_set<crypto::hash> new_txids;
+            for (const auto& p : parents) {
+                coinbase |= p.coinbase;
+                new_txids.insert(p.txids.begin(), p.txids.end());
             }
+            if (coinbase)
+                break;
+            txids.assign(new_txids.begin(), new_txids.end());
+            ++depth;
         }
-    done:
         log::warning(logcat, "Min depth for txid {}: {}", start_txid, depth);
         depths.push_back(depth);
     }
+    log::warning(
+            logcat,
+            "Depth search took {} using {} thread(s)",
+            tools::friendly_duration(std::chrono::steady_clock::now() - started),
+            threads);
 
     uint64_t cumulative_depth = 0;
     for (uint64_t depth : depths)
@@ -27,6 +27,7 @@
 // THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "blockchain_objects.h"
+#include "chain_scan.h"
 #include "cryptonote_core/cryptonote_core.h"
 #include "version.h"
 
@@ -43,7 +44,18 @@
 namespace po = boost::program_options;
 using namespace cryptonote;
 
-static bool stop_requested = false;
+static std::atomic<bool> stop_requested = false;
+
+// What the ordered reduce below needs to know about a block, gathered on the scan threads
+struct block_summary {
+    uint64_t height;
+    std::chrono::system_clock::time_point timestamp;
+    uint64_t size;
+    struct tx_counts {
+        uint32_t ins = 0, outs = 0, ringsize = 0;
+    };
+    std::vector<tx_counts> txs;
+};
 
 int main(int argc, char* argv[]) {
     oxen::set_terminate_handler();
@@ -81,6 +93,7 @@ int main(int argc, char* argv[]) {
     command_line::add_arg(desc_cmd_sett, arg_outputs);
     command_line::add_arg(desc_cmd_sett, arg_ringsize);
     command_line::add_arg(desc_cmd_sett, arg_hours);
+    command_line::add_arg(desc_cmd_sett, blockchain_utils::arg_scan_threads);
     command_line::add_arg(desc_cmd_only, command_line::arg_help);
 
     po::options_description desc_options("Allowed options");
@@ -115,6 +128,8 @@ int main(int argc, char* argv[]) {
     bool do_outputs = command_line::get_arg(vm, arg_outputs);
     bool do_ringsize = command_line::get_arg(vm, arg_ringsize);
     bool do_hours = command_line::get_arg(vm, arg_hours);
+    unsigned threads = blockchain_utils::scan_thread_count(
+            command_line::get_arg(vm, blockchain_utils::arg_scan_threads));
 
     log::warning(logcat, "Initializing source blockchain (BlockchainDB)");
     blockchain_objects_t blockchain_objects = {};
@@ -195,116 +210,125 @@ int main(int argc, char* argv[]) {
     uint32_t txhr[24] = {0};
     unsigned int i;
 
-    for (uint64_t h = block_start; h < block_stop; ++h) {
-        std::string bd = db.get_block_blob_from_height(h);
-        cryptonote::block blk;
-        if (!cryptonote::parse_and_validate_block_from_blob(bd, blk)) {
-            log::warning(logcat, "Bad block from db");
-            return 1;
+    blockchain_utils::scan_options opts;
+    opts.start_height = block_start;
+    opts.stop_height = block_stop;
+    opts.threads = threads;
+    opts.stop = &stop_requested;
+
+    auto map = [&](std::vector<block_summary>& summaries,
+                   const blockchain_utils::scanned_block& b) {
+        auto& sum = summaries.emplace_back();
+        sum.height = b.height;
+        sum.timestamp = std::chrono::system_clock::from_time_t(b.block.timestamp);
+        sum.size = b.blob_size;
+        sum.txs.reserve(b.txs.size());
+        for (size_t i = 0; i < b.txs.size(); i++) {
+            const auto& tx = b.txs[i];
+            sum.size += b.tx_blob_sizes[i];
+            auto& counts = sum.txs.emplace_back();
+            counts.ins = tx.vin.size();
+            counts.outs = tx.vout.size();
+            if (do_ringsize)
+                counts.ringsize =
+                        var::get<cryptonote::txin_to_key>(tx.vin[0]).key_offsets.size();
         }
-        auto ts = std::chrono::system_clock::from_time_t(blk.timestamp);
-        using namespace date;
-        year_month_day curr_date{floor<days>(ts)};
-        if (!prev_ts)
-            prev_ts = ts;
-        year_month_day prev_date{floor<days>(*prev_ts)};
-        // catch change of day
-        if (curr_date.day() > prev_date.day() ||
-            (curr_date.day() == day{1} && prev_date.day() > day{27})) {
-            // check for timestamp fudging around month ends
-            if (curr_date.day() == day{1} && prev_date.day() > day{27})
-                goto skip;
-            prev_ts = ts;
-            std::cout << format("%Y-%m-%d", prev_date) << "\t" << currblks << "\t" << h << "\t"
-                      << currtxs << "\t" << prevtxs + currtxs << "\t" << currsz << "\t"
-                      << prevsz + currsz;
-            prevsz += currsz;
-            currsz = 0;
-            currblks = 0;
-            prevtxs += currtxs;
-            currtxs = 0;
-            if (!tottxs)
-                tottxs = 1;
-            if (do_inputs) {
-                std::cout << "\t" << (maxins ? minins : 0) << "\t" << maxins << "\t"
-                          << totins / tottxs;
-                minins = 10;
-                maxins = 0;
-                totins = 0;
-            }
-            if (do_outputs) {
-                std::cout << "\t" << (maxouts ? minouts : 0) << "\t" << maxouts << "\t"
-                          << totouts / tottxs;
-                minouts = 10;
-                maxouts = 0;
-                totouts = 0;
-            }
-            if (do_ringsize) {
-                std::cout << "\t" << (maxrings ? minrings : 0) << "\t" << maxrings << "\t"
-                          << totrings / tottxs;
-                minrings = 50;
-                maxrings = 0;
-                totrings = 0;
-            }
-            tottxs = 0;
-            if (do_hours) {
-                for (i = 0; i < 24; i++) {
-                    std::cout << "\t" << txhr[i];
-                    txhr[i] = 0;
+    };
+
+    auto reduce = [&](std::vector<block_summary>&& summaries) {
+        for (const auto& sum : summaries) {
+            const uint64_t h = sum.height;
+            const auto ts = sum.timestamp;
+            using namespace date;
+            year_month_day curr_date{floor<days>(ts)};
+            if (!prev_ts)
+                prev_ts = ts;
+            year_month_day prev_date{floor<days>(*prev_ts)};
+            // catch change of day
+            if (curr_date.day() > prev_date.day() ||
+                (curr_date.day() == day{1} && prev_date.day() > day{27})) {
+                // check for timestamp fudging around month ends
+                if (curr_date.day() == day{1} && prev_date.day() > day{27})
+                    goto skip;
+                prev_ts = ts;
+                std::cout << format("%Y-%m-%d", prev_date) << "\t" << currblks << "\t" << h
+                          << "\t" << currtxs << "\t" << prevtxs + currtxs << "\t" << currsz
+                          << "\t" << prevsz + currsz;
+                prevsz += currsz;
+                currsz = 0;
+                currblks = 0;
+                prevtxs += currtxs;
+                currtxs = 0;
+                if (!tottxs)
+                    tottxs = 1;
+                if (do_inputs) {
+                    std::cout << "\t" << (maxins ? minins : 0) << "\t" << maxins << "\t"
+                              << totins / tottxs;
+                    minins = 10;
+                    maxins = 0;
+                    totins = 0;
                 }
+                if (do_outputs) {
+                    std::cout << "\t" << (maxouts ? minouts : 0) << "\t" << maxouts << "\t"
+                              << totouts / tottxs;
+                    minouts = 10;
+                    maxouts = 0;
+                    totouts = 0;
+                }
+                if (do_ringsize) {
+                    std::cout << "\t" << (maxrings ? minrings : 0) << "\t" << maxrings << "\t"
+                              << totrings / tottxs;
+                    minrings = 50;
+                    maxrings = 0;
+                    totrings = 0;
+                }
+                tottxs = 0;
+                if (do_hours) {
+                    for (i = 0; i < 24; i++) {
+                        std::cout << "\t" << txhr[i];
+                        txhr[i] = 0;
+                    }
+                }
+                std::cout << "\n";
             }
-            std::cout << "\n";
-        }
-    skip:
-        currsz += bd.size();
-        for (const auto& tx_id : blk.tx_hashes) {
-            if (!tx_id) {
-                throw oxen::traced<std::runtime_error>("Aborting: null txid");
-            }
-            if (!db.get_pruned_tx_blob(tx_id, bd)) {
-                throw oxen::traced<std::runtime_error>("Aborting: tx not found");
-            }
-            transaction tx;
-            if (!parse_and_validate_tx_base_from_blob(bd, tx)) {
-                log::warning(logcat, "Bad txn from db");
-                return 1;
-            }
-            currsz += bd.size();
-            currtxs++;
-            if (do_hours)
-                txhr[hh_mm_ss{ts - floor<days>(ts)}.hours().count()]++;
-            if (do_inputs) {
-                io = tx.vin.size();
-                if (io < minins)
-                    minins = io;
-                else if (io > maxins)
-                    maxins = io;
-                totins += io;
-            }
-            if (do_ringsize) {
-                const auto& tx_in_to_key = var::get<cryptonote::txin_to_key>(tx.vin[0]);
-                io = tx_in_to_key.key_offsets.size();
-                if (io < minrings)
-                    minrings = io;
-                else if (io > maxrings)
-                    maxrings = io;
-                totrings += io;
-            }
-            if (do_outputs) {
-                io = tx.vout.size();
-                if (io < minouts)
-                    minouts = io;
-                else if (io > maxouts)
-                    maxouts = io;
-                totouts += io;
+        skip:
+            currsz += sum.size;
+            for (const auto& counts : sum.txs) {
+                currtxs++;
+                if (do_hours)
+                    txhr[hh_mm_ss{ts - floor<days>(ts)}.hours().count()]++;
+                if (do_inputs) {
+                    io = counts.ins;
+                    if (io < minins)
+                        minins = io;
+                    else if (io > maxins)
+                        maxins = io;
+                    totins += io;
+                }
+                if (do_ringsize) {
+                    io = counts.ringsize;
+                    if (io < minrings)
+                        minrings = io;
+                    else if (io > maxrings)
+                        maxrings = io;
+                    totrings += io;
+                }
+                if (do_outputs) {
+                    io = counts.outs;
+                    if (io < minouts)
+                        minouts = io;
+                    else if (io > maxouts)
+                        maxouts = io;
+                    totouts += io;
+                }
+                tottxs++;
             }
-            tottxs++;
+            currblks++;
         }
-        currblks++;
+    };
 
-        if (stop_requested)
-            break;
-    }
+    auto result = blockchain_utils::scan_chain<std::vector<block_summary>>(db, opts, map, reduce);
+    log::warning(logcat, "Stats: {}", result);
 
     core_storage->deinit();
     return 0;
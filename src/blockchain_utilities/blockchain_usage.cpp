@@ -29,6 +29,7 @@
 
 #include "blockchain_db/blockchain_db.h"
 #include "blockchain_objects.h"
+#include "chain_scan.h"
 #include "cryptonote_core/cryptonote_core.h"
 #include "version.h"
 
@@ -42,38 +43,36 @@ using namespace cryptonote;
 
 static auto logcat = log::Cat("quorum_cop");
 
-struct output_data {
+struct output_ref {
     uint64_t amount;
     uint64_t index;
-    mutable bool coinbase;
-    mutable uint64_t height;
-    output_data(uint64_t a, uint64_t i, bool cb, uint64_t h) :
-            amount(a), index(i), coinbase(cb), height(h) {}
-    bool operator==(const output_data& other) const {
-        return other.amount == amount && other.index == index;
-    }
-    void info(bool c, uint64_t h) const {
-        coinbase = c;
-        height = h;
-    }
+    bool operator==(const output_ref& other) const = default;
 };
 namespace std {
 template <>
-struct hash<output_data> {
-    size_t operator()(const output_data& od) const {
-        const uint64_t data[2] = {od.amount, od.index};
-        crypto::hash h;
-        crypto::cn_fast_hash(data, 2 * sizeof(uint64_t), h);
-        return reinterpret_cast<const std::size_t&>(h);
+struct hash<output_ref> {
+    size_t operator()(const output_ref& o) const {
+        return o.index ^ (o.amount * 0x9e3779b97f4a7c15ULL);
     }
 };
 }  // namespace std
 
-struct reference {
-    uint64_t height;
-    uint64_t ring_size;
-    uint64_t position;
-    reference(uint64_t h, uint64_t rs, uint64_t p) : height(h), ring_size(rs), position(p) {}
+// Usage counts of a chunk of the chain, and then (once merged) of the whole chain
+struct usage_counts {
+    // Number of outputs created, per amount
+    std::unordered_map<uint64_t, uint64_t> created;
+    // Number of times each output was used as a ring member
+    std::unordered_map<output_ref, uint64_t> used;
+
+    void merge(usage_counts&& other) {
+        for (const auto& [amount, n] : other.created)
+            created[amount] += n;
+        if (used.empty())
+            used = std::move(other.used);
+        else
+            for (const auto& [out, n] : other.used)
+                used[out] += n;
+    }
 };
 
 int main(int argc, char* argv[]) {
@@ -96,6 +95,7 @@ int main(int argc, char* argv[]) {
     command_line::add_arg(desc_cmd_sett, arg_log_level);
     command_line::add_arg(desc_cmd_sett, arg_rct_only);
     command_line::add_arg(desc_cmd_sett, arg_input);
+    command_line::add_arg(desc_cmd_sett, blockchain_utils::arg_scan_threads);
     command_line::add_arg(desc_cmd_only, command_line::arg_help);
 
     po::options_description desc_options("Allowed options");
@@ -128,6 +128,8 @@ int main(int argc, char* argv[]) {
     log::warning(logcat, "Starting...");
 
     bool opt_rct_only = command_line::get_arg(vm, arg_rct_only);
+    unsigned threads = blockchain_utils::scan_thread_count(
+            command_line::get_arg(vm, blockchain_utils::arg_scan_threads));
 
     // If we wanted to use the memory pool, we would set up a fake_core.
 
@@ -169,46 +171,56 @@ int main(int argc, char* argv[]) {
 
     log::warning(logcat, "Building usage patterns...");
 
-    std::unordered_map<output_data, std::list<reference>> outputs;
-    std::unordered_map<uint64_t, uint64_t> indices;
-
+    blockchain_utils::scan_options opts;
+    opts.stop_height = core_storage->db().height();
+    opts.threads = threads;
+
+    auto map = [&](usage_counts& counts, const blockchain_utils::scanned_block& b) {
+        auto add_tx = [&](const cryptonote::transaction& tx) {
+            // create new outputs
+            for (const auto& out : tx.vout)
+                if (!opt_rct_only || !out.amount)
+                    counts.created[out.amount]++;
+
+            for (const auto& in : tx.vin) {
+                const auto* txin = std::get_if<txin_to_key>(&in);
+                if (!txin || (opt_rct_only && txin->amount != 0))
+                    continue;
+
+                for (uint64_t index :
+                     cryptonote::relative_output_offsets_to_absolute(txin->key_offsets))
+                    counts.used[{txin->amount, index}]++;
+            }
+        };
+        if (b.block.miner_tx)
+            add_tx(*b.block.miner_tx);
+        for (const auto& tx : b.txs)
+            add_tx(tx);
+    };
+
+    usage_counts usage;
     log::warning(logcat, "Reading blockchain from {}", input);
-    core_storage->for_all_transactions(
-            [&](const crypto::hash& hash, const cryptonote::transaction& tx) -> bool {
-                const bool coinbase = tx.is_miner_tx();
-                const uint64_t height = core_storage->db().get_tx_block_height(hash);
-
-                // create new outputs
-                for (const auto& out : tx.vout) {
-                    if (opt_rct_only && out.amount)
-                        continue;
-                    uint64_t index = ++indices[out.amount];
-                    output_data od(out.amount, index, coinbase, height);
-                    auto itb = outputs.emplace(od, std::list<reference>());
-                    itb.first->first.info(coinbase, height);
-                }
-
-                for (const auto& in : tx.vin) {
-                    const auto* txin = std::get_if<txin_to_key>(&in);
-                    if (!txin || (opt_rct_only && txin->amount != 0))
-                        continue;
-
-                    const std::vector<uint64_t> absolute =
-                            cryptonote::relative_output_offsets_to_absolute(txin->key_offsets);
-                    for (size_t n = 0; n < txin->key_offsets.size(); ++n) {
-                        output_data od(txin->amount, absolute[n], coinbase, height);
-                        outputs[od].push_back(reference(height, txin->key_offsets.size(), n));
-                    }
-                }
-                return true;
-            },
-            true);
+    auto result = blockchain_utils::scan_chain<usage_counts>(
+            core_storage->db(), opts, map, [&](usage_counts&& counts) {
+                usage.merge(std::move(counts));
+            });
+    log::warning(logcat, "Usage: {}", result);
 
+    // use count -> number of outputs used that many times
     std::unordered_map<uint64_t, uint64_t> counts;
-    size_t total = 0;
-    for (const auto& out : outputs) {
-        counts[out.second.size()]++;
+    size_t total = 0, unused = 0;
+    for (const auto& [amount, n] : usage.created)
+        unused += n;
+    for (const auto& [out, n] : usage.used) {
+        counts[n]++;
         total++;
+        if (auto it = usage.created.find(out.amount);
+            it != usage.created.end() && out.index < it->second)
+            unused--;
+    }
+    if (unused) {
+        counts[0] = unused;
+        total += unused;
     }
     if (total > 0) {
         for (const auto& c : counts) {
@@ -0,0 +1,293 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "blockchain_db/blockchain_db.h"
+#include "common/command_line.h"
+#include "common/exception.h"
+#include "common/format.h"
+#include "common/formattable.h"
+#include "common/util.h"
+#include "cryptonote_basic/cryptonote_format_utils.h"
+
+// Parallel chain scanning for the blockchain analytics tools.
+//
+// scan_chain() splits a height range into chunks which worker threads load and parse (each worker
+// holding its own database read txn while it works on a chunk) and feed, block by block, into a
+// per-chunk accumulator via the tool's map function.  Finished chunks are handed to the tool's
+// reduce function on the calling thread, one at a time and in height order, so tools that need
+// to see the chain in order (e.g. to emit per-day rows) can still do so while the expensive
+// loading and parsing happens in parallel.
+
+namespace blockchain_utils {
+
+inline const command_line::arg_descriptor<unsigned> arg_scan_threads = {
+        "threads", "Number of threads to use to scan the chain; 0 uses one per CPU core", 0};
+
+/// Returns the number of scan threads to use for the given `--threads` value.
+inline unsigned scan_thread_count(unsigned requested) {
+    if (requested)
+        return requested;
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+/// A block loaded by scan_chain, as passed to a scan's map function.
+struct scanned_block {
+    uint64_t height;
+    cryptonote::block block;
+    size_t blob_size;
+    /// The block's (pruned) transactions and their blob sizes, matching `block.tx_hashes`.  Left
+    /// empty unless scan_options::load_txs is set.
+    std::vector<cryptonote::transaction> txs;
+    std::vector<size_t> tx_blob_sizes;
+};
+
+struct scan_options {
+    uint64_t start_height = 0;
+    /// One past the last height to scan
+    uint64_t stop_height = 0;
+    unsigned threads = 1;
+    /// Number of blocks per chunk, i.e. per map accumulator
+    uint64_t chunk_blocks = 1000;
+    bool load_txs = true;
+    /// If given, the scan stops handing out new chunks once this becomes true; chunks already
+    /// being scanned still get reduced.
+    const std::atomic<bool>* stop = nullptr;
+};
+
+struct scan_result {
+    uint64_t blocks = 0;
+    uint64_t txs = 0;
+    uint64_t bytes = 0;
+    unsigned threads = 0;
+    std::chrono::steady_clock::duration elapsed{};
+    bool stopped = false;
+
+    std::string to_string() const {
+        double secs = std::chrono::duration<double>(elapsed).count();
+        return "scanned {} blocks, {} txs ({}) in {:.2f}s using {} thread(s): "
+               "{:.0f} blocks/s{}"_format(
+                blocks,
+                txs,
+                tools::get_human_readable_bytes(bytes),
+                secs,
+                threads,
+                secs > 0 ? blocks / secs : 0.0,
+                stopped ? " (stopped early)" : "");
+    }
+};
+
+namespace detail {
+
+    inline void load_block(
+            cryptonote::BlockchainDB& db, uint64_t height, bool load_txs, scanned_block& out) {
+        out.height = height;
+        std::string bd = db.get_block_blob_from_height(height);
+        out.blob_size = bd.size();
+        out.block = {};
+        if (!cryptonote::parse_and_validate_block_from_blob(bd, out.block))
+            throw oxen::traced<std::runtime_error>("Bad block from db at height {}"_format(height));
+
+        out.txs.clear();
+        out.tx_blob_sizes.clear();
+        if (!load_txs)
+            return;
+        out.txs.resize(out.block.tx_hashes.size());
+        out.tx_blob_sizes.reserve(out.block.tx_hashes.size());
+        for (size_t i = 0; i < out.block.tx_hashes.size(); i++) {
+            const auto& txid = out.block.tx_hashes[i];
+            if (!db.get_pruned_tx_blob(txid, bd))
+                throw oxen::traced<std::runtime_error>("Tx {} not found in db"_format(txid));
+            if (!cryptonote::parse_and_validate_tx_base_from_blob(bd, out.txs[i]))
+                throw oxen::traced<std::runtime_error>("Bad tx {} in db"_format(txid));
+            out.tx_blob_sizes.push_back(bd.size());
+        }
+    }
+
+}  // namespace detail
+
+/// Scans the blocks in [opts.start_height, opts.stop_height) across opts.threads threads.
+///
+/// `map(Chunk& acc, const scanned_block& b)` is called on a worker thread for each block, with a
+/// default-constructed `Chunk` for each run of `opts.chunk_blocks` blocks.  `reduce(Chunk&& acc)`
+/// is called on the calling thread for each finished chunk, in height order.  An exception thrown
+/// by either aborts the scan and is rethrown from here.
+template <typename Chunk, typename Map, typename Reduce>
+scan_result scan_chain(
+        cryptonote::BlockchainDB& db, const scan_options& opts, Map&& map, Reduce&& reduce) {
+    const auto started = std::chrono::steady_clock::now();
+    scan_result result;
+    result.threads = std::max(1u, opts.threads);
+    if (opts.stop_height <= opts.start_height)
+        return result;
+
+    const uint64_t chunk_blocks = std::max<uint64_t>(1, opts.chunk_blocks);
+    const uint64_t num_chunks =
+            (opts.stop_height - opts.start_height + chunk_blocks - 1) / chunk_blocks;
+    // How far workers may get ahead of the reduce, which bounds the memory held in finished but
+    // not yet reduced chunks.
+    const uint64_t window = 2 * result.threads;
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::map<uint64_t, Chunk> finished;
+    uint64_t next_chunk = 0, reduced = 0;
+    bool claiming_done = false, aborted = false;
+    std::exception_ptr error;
+    std::atomic<uint64_t> blocks{0}, txs{0}, bytes{0};
+
+    auto stopping = [&] { return opts.stop && opts.stop->load(std::memory_order_relaxed); };
+
+    auto fail = [&](std::exception_ptr e) {
+        std::lock_guard lock{mutex};
+        if (!error)
+            error = std::move(e);
+        aborted = true;
+        cv.notify_all();
+    };
+
+    auto worker = [&] {
+        try {
+            scanned_block b;
+            while (true) {
+                uint64_t chunk;
+                {
+                    std::unique_lock lock{mutex};
+                    cv.wait(lock, [&] {
+                        return aborted || claiming_done || next_chunk < reduced + window;
+                    });
+                    if (aborted || claiming_done)
+                        return;
+                    if (next_chunk >= num_chunks || stopping()) {
+                        claiming_done = true;
+                        cv.notify_all();
+                        return;
+                    }
+                    chunk = next_chunk++;
+                }
+
+                Chunk acc{};
+                {
+                    cryptonote::db_rtxn_guard rtxn{db};
+                    const uint64_t begin = opts.start_height + chunk * chunk_blocks;
+                    const uint64_t end = std::min(begin + chunk_blocks, opts.stop_height);
+                    for (uint64_t h = begin; h < end; h++) {
+                        detail::load_block(db, h, opts.load_txs, b);
+                        map(acc, std::as_const(b));
+                        blocks++;
+                        txs += b.txs.size();
+                        bytes += b.blob_size;
+                        for (auto size : b.tx_blob_sizes)
+                            bytes += size;
+                    }
+                }
+
+                std::lock_guard lock{mutex};
+                finished.emplace(chunk, std::move(acc));
+                cv.notify_all();
+            }
+        } catch (...) {
+            fail(std::current_exception());
+        }
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(result.threads);
+    for (unsigned i = 0; i < result.threads; i++)
+        workers.emplace_back(worker);
+
+    try {
+        while (true) {
+            Chunk acc;
+            {
+                std::unique_lock lock{mutex};
+                cv.wait(lock, [&] {
+                    return error || finished.count(reduced) ||
+                           (claiming_done && reduced == next_chunk);
+                });
+                if (error)
+                    break;
+                auto it = finished.find(reduced);
+                if (it == finished.end())
+                    break;
+                acc = std::move(it->second);
+                finished.erase(it);
+                reduced++;
+                cv.notify_all();
+            }
+            reduce(std::move(acc));
+        }
+    } catch (...) {
+        fail(std::current_exception());
+    }
+
+    {
+        std::lock_guard lock{mutex};
+        aborted = true;
+        cv.notify_all();
+    }
+    for (auto& t : workers)
+        t.join();
+    if (error)
+        std::rethrow_exception(error);
+
+    result.blocks = blocks;
+    result.txs = txs;
+    result.bytes = bytes;
+    result.stopped = reduced < num_chunks;
+    result.elapsed = std::chrono::steady_clock::now() - started;
+    return result;
+}
+
+/// Returns `fn(item)` for each of `items`, in order, computed across up to `threads` threads that
+/// each hold a database read txn while they work.  Used for lookups that don't follow height
+/// order, such as chasing the ring members of a set of transactions.
+template <typename T, typename Fn>
+auto parallel_map(
+        cryptonote::BlockchainDB& db, const std::vector<T>& items, unsigned threads, Fn&& fn) {
+    std::vector<std::invoke_result_t<Fn&, const T&>> results(items.size());
+    std::atomic<size_t> next{0};
+    std::mutex mutex;
+    std::exception_ptr error;
+
+    auto worker = [&] {
+        try {
+            cryptonote::db_rtxn_guard rtxn{db};
+            for (size_t i; (i = next++) < items.size();)
+                results[i] = fn(items[i]);
+        } catch (...) {
+            std::lock_guard lock{mutex};
+            if (!error)
+                error = std::current_exception();
+            next = items.size();
+        }
+    };
+
+    // The calling thread works too, so we only need to start threads - 1 more
+    const size_t extra = std::min<size_t>(std::max(1u, threads) - 1, items.size());
+    std::vector<std::thread> workers;
+    workers.reserve(extra);
+    for (size_t i = 0; i < extra; i++)
+        workers.emplace_back(worker);
+    worker();
+    for (auto& t : workers)
+        t.join();
+    if (error)
+        std::rethrow_exception(error);
+    return results;
+}
+
+}  // namespace blockchain_utils
+
+template <>
+inline constexpr bool formattable::via_to_string<blockchain_utils::scan_result> = true;
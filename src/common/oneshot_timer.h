@@ -0,0 +1,42 @@
+#pragma once
+
+#include <oxenmq/oxenmq.h>
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <optional>
+
+namespace tools {
+
+// Schedules `f` to be invoked once, after `delay`, on the given tagged thread or, if none, on a
+// general OxenMQ worker thread.
+//
+// OxenMQ timers repeat until cancelled and the cancellation is asynchronous, so the timer can tick
+// again before it lands; since OxenMQ copies the callback into each job it queues, the guard
+// against running `f` twice has to be shared between the copies rather than captured by value.
+inline void add_oneshot_timer(
+        oxenmq::OxenMQ& omq,
+        std::function<void()> f,
+        std::chrono::milliseconds delay,
+        std::optional<oxenmq::TaggedThreadID> thread = std::nullopt) {
+    auto timer = std::make_shared<oxenmq::TimerID>();
+    auto& timer_ref = *timer;
+    omq.add_timer(
+            timer_ref,
+            [&omq,
+             timer = std::move(timer),
+             fired = std::make_shared<std::atomic<bool>>(false),
+             f = std::move(f)] {
+                if (fired->exchange(true))
+                    return;
+                omq.cancel_timer(*timer);
+                f();
+            },
+            delay,
+            true /*squelch*/,
+            std::move(thread));
+}
+
+}  // namespace tools
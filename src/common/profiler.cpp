@@ -0,0 +1,218 @@
+#include "profiler.h"
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <unordered_map>
+
+#include "format.h"
+
+namespace tools::profiler {
+
+namespace {
+
+    // Stack ids index `frames`, each of which is a scope name plus the id of the enclosing stack;
+    // id 0 is the (unnamed) root.  Frames are never removed, so an id stays valid forever.
+    struct frame {
+        uint32_t parent;
+        std::string_view name;
+    };
+
+    std::mutex frames_mutex;
+    std::deque<frame> frames{frame{0, ""}};
+    std::map<std::pair<uint32_t, std::string_view>, uint32_t> frame_ids;
+
+    std::mutex interned_mutex;
+    std::set<std::string, std::less<>> interned;
+
+    struct raw_sample {
+        uint32_t stack;
+        std::chrono::steady_clock::time_point start;
+        std::chrono::nanoseconds duration;
+    };
+
+    // A thread's samples.  Only the owning thread writes to it, so the mutex is only ever
+    // contended while collect() is copying samples out.
+    struct thread_buffer {
+        std::mutex mutex;
+        uint32_t thread;
+        std::vector<raw_sample> samples;
+        size_t written = 0;
+    };
+
+    std::mutex buffers_mutex;
+    std::vector<std::shared_ptr<thread_buffer>> buffers;
+    uint32_t next_thread = 0;
+
+    // Registers the calling thread's buffer on first use, and drops it when the thread exits
+    // (losing its samples, but not leaking buffers for short-lived threads).
+    struct thread_state {
+        struct cached_frame {
+            uint32_t id = 0;
+            uint32_t parent;
+            std::string_view name;
+        };
+
+        uint32_t current = 0;  // Stack id of the innermost scope being recorded
+        std::unordered_map<uint64_t, cached_frame> children;
+        std::shared_ptr<thread_buffer> buffer;
+
+        thread_buffer& get_buffer() {
+            if (!buffer) {
+                buffer = std::make_shared<thread_buffer>();
+                buffer->samples.resize(BUFFER_SAMPLES);
+                std::lock_guard lock{buffers_mutex};
+                buffer->thread = next_thread++;
+                buffers.push_back(buffer);
+            }
+            return *buffer;
+        }
+
+        ~thread_state() {
+            if (!buffer)
+                return;
+            std::lock_guard lock{buffers_mutex};
+            buffers.erase(std::remove(buffers.begin(), buffers.end(), buffer), buffers.end());
+        }
+    };
+
+    thread_local thread_state state;
+
+    uint32_t frame_id(uint32_t parent, std::string_view name) {
+        // Scope names are almost always string literals, so the calling thread caches lookups by
+        // pointer to avoid hashing the name or taking the global lock on every scope.
+        const uint64_t key = (uint64_t{parent} << 32) ^ reinterpret_cast<uintptr_t>(name.data()) ^
+                             (name.size() << 20);
+        auto& cached = state.children[key];
+        if (cached.id && cached.parent == parent && cached.name.data() == name.data() &&
+            cached.name.size() == name.size())
+            return cached.id;
+
+        std::lock_guard lock{frames_mutex};
+        auto [it, inserted] = frame_ids.emplace(std::make_pair(parent, name), frames.size());
+        if (inserted)
+            frames.push_back(frame{parent, name});
+        cached = {it->second, parent, name};
+        return cached.id;
+    }
+
+    frame get_frame(uint32_t stack) {
+        std::lock_guard lock{frames_mutex};
+        return stack < frames.size() ? frames[stack] : frame{0, "?"};
+    }
+
+    int64_t to_us(std::chrono::nanoseconds t) {
+        return std::chrono::duration_cast<std::chrono::microseconds>(t).count();
+    }
+
+}  // namespace
+
+void enable(bool on) {
+    detail::enabled.store(on, std::memory_order_relaxed);
+}
+
+std::string_view intern(std::string_view name) {
+    std::lock_guard lock{interned_mutex};
+    auto it = interned.find(name);
+    if (it == interned.end())
+        it = interned.emplace(name).first;
+    return *it;
+}
+
+void scope::begin(std::string_view name) {
+    m_parent = state.current;
+    m_stack = state.current = frame_id(m_parent, name);
+    m_start = std::chrono::steady_clock::now();
+}
+
+void scope::end() {
+    const auto duration = std::chrono::steady_clock::now() - m_start;
+    state.current = m_parent;
+    auto& buf = state.get_buffer();
+    std::lock_guard lock{buf.mutex};
+    buf.samples[buf.written++ % buf.samples.size()] = {m_stack, m_start, duration};
+}
+
+std::vector<sample> collect(std::chrono::nanoseconds window) {
+    const auto cutoff = std::chrono::steady_clock::now() - window;
+    std::vector<std::shared_ptr<thread_buffer>> bufs;
+    {
+        std::lock_guard lock{buffers_mutex};
+        bufs = buffers;
+    }
+
+    std::vector<sample> result;
+    for (auto& buf : bufs) {
+        std::lock_guard lock{buf->mutex};
+        const size_t n = std::min(buf->written, buf->samples.size());
+        for (size_t i = buf->written - n; i < buf->written; i++) {
+            const auto& s = buf->samples[i % buf->samples.size()];
+            if (s.start + s.duration >= cutoff)
+                result.push_back({s.stack, buf->thread, s.start, s.duration});
+        }
+    }
+    std::sort(result.begin(), result.end(), [](const sample& a, const sample& b) {
+        return a.start < b.start;
+    });
+    return result;
+}
+
+std::string_view stack_name(uint32_t stack) {
+    return get_frame(stack).name;
+}
+
+std::string stack_path(uint32_t stack) {
+    std::vector<std::string_view> names;
+    {
+        std::lock_guard lock{frames_mutex};
+        for (; stack != 0 && stack < frames.size(); stack = frames[stack].parent)
+            names.push_back(frames[stack].name);
+    }
+    std::string path;
+    for (auto it = names.rbegin(); it != names.rend(); ++it) {
+        if (!path.empty())
+            path += ';';
+        path += *it;
+    }
+    return path;
+}
+
+std::string to_folded(const std::vector<sample>& samples) {
+    // A stack's own time is its total time less the total time of the stacks directly inside it.
+    // (This can come out negative for a scope that was still running when the samples were
+    // collected, as only its children got recorded; we omit such stacks).
+    std::map<uint32_t, std::chrono::nanoseconds> self;
+    for (const auto& s : samples) {
+        self[s.stack] += s.duration;
+        if (auto parent = get_frame(s.stack).parent)
+            self[parent] -= s.duration;
+    }
+
+    std::string out;
+    for (const auto& [stack, t] : self)
+        if (auto us = to_us(t); us > 0)
+            out += "{} {}\n"_format(stack_path(stack), us);
+    return out;
+}
+
+std::string to_chrome_trace(const std::vector<sample>& samples) {
+    auto events = nlohmann::json::array();
+    for (const auto& s : samples)
+        events.push_back({
+                {"name", stack_name(s.stack)},
+                {"cat", "oxend"},
+                {"ph", "X"},
+                {"ts", to_us(s.start.time_since_epoch())},
+                {"dur", to_us(s.duration)},
+                {"pid", 1},
+                {"tid", s.thread},
+        });
+    return nlohmann::json{{"traceEvents", std::move(events)}, {"displayTimeUnit", "ms"}}.dump();
+}
+
+}  // namespace tools::profiler
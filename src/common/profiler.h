@@ -0,0 +1,99 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "oxen.h"
+
+// Built-in scoped-timer profiling.
+//
+// Interesting scopes are annotated with `OXEN_PROFILE_SCOPE("name")`.  While profiling is
+// disabled (the default) that costs a single relaxed atomic load.  While it is enabled each
+// annotated scope records its start time, duration, and the stack of enclosing annotated scopes
+// into a fixed-size ring buffer owned by the thread that ran it, so recording never contends with
+// other threads.  `collect()` gathers the recent samples from every thread, which can then be
+// rendered as folded stacks (for flamegraph.pl, speedscope, etc.) or as Chrome trace event JSON
+// (for chrome://tracing or Perfetto).
+
+namespace tools::profiler {
+
+/// Number of samples each thread's ring buffer holds; once full the oldest samples are
+/// overwritten.
+inline constexpr size_t BUFFER_SAMPLES = 32768;
+
+namespace detail {
+    inline std::atomic<bool> enabled{false};
+}
+
+/// Returns true if profiling is currently enabled.
+inline bool enabled() {
+    return detail::enabled.load(std::memory_order_relaxed);
+}
+
+/// Enables or disables profiling.  Samples already recorded are kept (until overwritten) when
+/// profiling is disabled.
+void enable(bool on = true);
+
+/// Returns a view of a copy of `name` that remains valid for the life of the program, for use as
+/// a scope name when the name isn't a string literal.
+std::string_view intern(std::string_view name);
+
+/// Records the time spent in the enclosing C++ scope when profiling is enabled.  `name` must
+/// outlive the profiler (i.e. be a string literal or something returned by `intern()`).
+class scope {
+  public:
+    explicit scope(std::string_view name) {
+        if (enabled())
+            begin(name);
+    }
+    ~scope() {
+        if (m_stack)
+            end();
+    }
+    scope(const scope&) = delete;
+    scope& operator=(const scope&) = delete;
+
+  private:
+    void begin(std::string_view name);
+    void end();
+
+    uint32_t m_stack = 0;  // 0 if we aren't recording this scope
+    uint32_t m_parent = 0;
+    std::chrono::steady_clock::time_point m_start;
+};
+
+/// One recorded scope.
+struct sample {
+    uint32_t stack;   // Identifies the scope along with its enclosing scopes; see stack_path().
+    uint32_t thread;  // Small sequential id of the thread that ran the scope
+    std::chrono::steady_clock::time_point start;
+    std::chrono::nanoseconds duration;
+};
+
+/// Returns all retained samples, from all threads, of scopes that finished within the last
+/// `window`.
+std::vector<sample> collect(std::chrono::nanoseconds window);
+
+/// Returns the name of the innermost scope of a sample's stack.
+std::string_view stack_name(uint32_t stack);
+
+/// Returns a sample's full stack, outermost scope first, as scope names separated by `;`.
+std::string stack_path(uint32_t stack);
+
+/// Renders samples in the "folded stacks" format used by flamegraph.pl: one line per distinct
+/// stack giving the time, in microseconds, spent in the stack's innermost scope itself (i.e.
+/// excluding time spent in annotated scopes nested inside it).
+std::string to_folded(const std::vector<sample>& samples);
+
+/// Renders samples as Chrome trace event format JSON.
+std::string to_chrome_trace(const std::vector<sample>& samples);
+
+}  // namespace tools::profiler
+
+/// Profiles the rest of the enclosing scope under the given name.
+#define OXEN_PROFILE_SCOPE(name) \
+    const ::tools::profiler::scope OXEN_TOKEN_COMBINE(oxen_profile_scope_, __LINE__) { name }
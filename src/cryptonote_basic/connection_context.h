@@ -32,6 +32,7 @@
 #include <atomic>
 #include <chrono>
 #include <concepts>
+#include <unordered_map>
 #include <unordered_set>
 
 #include "common/format.h"
@@ -55,6 +56,8 @@ struct cryptonote_connection_context : public epee::net_utils::connection_contex
     state m_state{state_before_handshake};
     std::vector<crypto::hash> m_needed_objects;
     std::unordered_set<crypto::hash> m_requested_objects;
+    std::unordered_map<crypto::hash, std::chrono::steady_clock::time_point>
+            m_requested_txs;  // announced txs we asked this peer for, and when
     std::map<uint64_t, std::pair<crypto::hash, bool>>
             m_blink_state;  // HEIGHT => {CHECKSUM, NEEDED}
     bool m_need_blink_sync{false};
@@ -66,6 +69,7 @@ struct cryptonote_connection_context : public epee::net_utils::connection_contex
             0};  // in debug purpose: problem with double callback rise
     crypto::hash m_last_known_hash{};
     uint32_t m_pruning_seed{0};
+    uint32_t m_support_flags{0};  // cryptonote::p2p::SUPPORT_FLAG_* bits advertised by the peer
     bool m_anchor{false};
     // size_t m_score{0};  TODO: add score calculations
 };
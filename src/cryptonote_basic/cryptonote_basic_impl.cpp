@@ -67,6 +67,14 @@ size_t get_min_block_weight(hf /*version*/) {
     return BLOCK_GRANTED_FULL_REWARD_ZONE_V5;
 }
 //-----------------------------------------------------------------------------------------------
+uint64_t get_transaction_weight_limit(hf version) {
+    // from v10, bulletproofs, limit a tx to 50% of the minimum block weight
+    if (version >= hf::hf10_bulletproofs)
+        return get_min_block_weight(version) / 2 - COINBASE_BLOB_RESERVED_SIZE;
+    else
+        return get_min_block_weight(version) - COINBASE_BLOB_RESERVED_SIZE;
+}
+//-----------------------------------------------------------------------------------------------
 // TODO(oxen): Move into oxen_economy, this will require access to oxen::exp2
 uint64_t block_reward_unpenalized_formula_v7(
         uint64_t already_generated_coins, uint64_t /*height*/) {
@@ -112,6 +112,8 @@ inline std::string return_first_address(
 /* Cryptonote helper functions                                          */
 /************************************************************************/
 size_t get_min_block_weight(hf version);
+/// The maximum weight of a single transaction
+uint64_t get_transaction_weight_limit(hf version);
 uint64_t block_reward_unpenalized_formula_v7(uint64_t already_generated_coins, uint64_t height);
 uint64_t block_reward_unpenalized_formula_v8(uint64_t height);
 bool get_base_block_reward(
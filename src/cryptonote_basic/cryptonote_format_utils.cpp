@@ -1549,6 +1549,52 @@ bool calculate_transaction_hash(const transaction& t, crypto::hash& res, size_t*
     return true;
 }
 //---------------------------------------------------------------
+bool calculate_transaction_hash_from_blob(std::string_view tx_blob, crypto::hash& res) {
+    transaction tx;
+    size_t prefix_size, unprunable_size;
+    serialization::binary_string_unarchiver ba{tx_blob};
+    try {
+        serialization::value(ba, static_cast<transaction_prefix&>(tx));
+        prefix_size = ba.streampos();
+        if (tx.version != txversion::v1 && !tx.vin.empty())
+            tx.rct_signatures.serialize_rctsig_base(ba, tx.vin.size(), tx.vout.size());
+        unprunable_size = ba.streampos();
+    } catch (const std::exception& e) {
+        log::debug(logcat, "Failed to parse transaction base from blob: {}", e.what());
+        return false;
+    }
+
+    // v1 transactions hash the entire blob
+    if (tx.version == txversion::v1) {
+        get_blob_hash(tx_blob, res);
+        return true;
+    }
+
+    // Otherwise this must give exactly the same result as calculate_transaction_hash, which hashes
+    // the same ranges of the re-serialized tx.
+    crypto::hash hashes[3];
+    get_blob_hash(tx_blob.substr(0, prefix_size), hashes[0]);
+    if (tx.is_transfer()) {
+        get_blob_hash(tx_blob.substr(prefix_size, unprunable_size - prefix_size), hashes[1]);
+    } else {
+        serialization::binary_string_archiver ar;
+        try {
+            tx.rct_signatures.serialize_rctsig_base(ar, tx.vin.size(), tx.vout.size());
+        } catch (const std::exception& e) {
+            log::debug(logcat, "Failed to serialize rct signatures base: {}", e.what());
+            return false;
+        }
+        get_blob_hash(ar.str(), hashes[1]);
+    }
+    if (tx.rct_signatures.type == rct::RCTType::Null)
+        hashes[2].zero();
+    else
+        get_blob_hash(tx_blob.substr(unprunable_size), hashes[2]);
+
+    res = cn_fast_hash(hashes, sizeof(hashes));
+    return true;
+}
+//---------------------------------------------------------------
 bool get_transaction_hash(const transaction& t, crypto::hash& res, size_t* blob_size) {
     if (t.is_hash_valid()) {
         res = t.hash;
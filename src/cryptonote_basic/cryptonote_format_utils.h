@@ -261,6 +261,11 @@ bool calculate_transaction_prunable_hash(
         const transaction& t, const std::string* blob, crypto::hash& res);
 crypto::hash get_transaction_prunable_hash(const transaction& t, const std::string* blob = NULL);
 bool calculate_transaction_hash(const transaction& t, crypto::hash& res, size_t* blob_size);
+// Computes the hash of a serialized transaction directly from the blob's byte ranges, without
+// deserializing the (large) prunable signature data or re-serializing the transaction.  Only the
+// prefix and rct base are parsed, to find where each hashed section starts.  Returns false if the
+// blob can't be parsed that far.
+bool calculate_transaction_hash_from_blob(std::string_view tx_blob, crypto::hash& res);
 crypto::hash get_pruned_transaction_hash(
         const transaction& t, const crypto::hash& pruned_data_hash);
 
@@ -209,7 +209,30 @@ namespace p2p {
     inline constexpr size_t IP_FAILS_BEFORE_BLOCK = 10;
     inline constexpr auto IDLE_CONNECTION_KILL_INTERVAL = 5min;
     inline constexpr uint32_t SUPPORT_FLAG_FLUFFY_BLOCKS = 0x01;
-    inline constexpr uint32_t SUPPORT_FLAGS = SUPPORT_FLAG_FLUFFY_BLOCKS;
+    inline constexpr uint32_t SUPPORT_FLAG_COMPACT_BLOCKS = 0x02;
+    inline constexpr uint32_t SUPPORT_FLAG_TX_ANNOUNCE = 0x04;
+    inline constexpr uint32_t SUPPORT_FLAG_PROOF_ANNOUNCE = 0x08;
+    inline constexpr uint32_t SUPPORT_FLAGS =
+            SUPPORT_FLAG_FLUFFY_BLOCKS | SUPPORT_FLAG_COMPACT_BLOCKS | SUPPORT_FLAG_TX_ANNOUNCE |
+            SUPPORT_FLAG_PROOF_ANNOUNCE;
+    // How long we wait for a peer to send us a tx it announced before we will request it from
+    // another peer that announces it.
+    inline constexpr auto TX_ANNOUNCE_REQUEST_TIMEOUT = 10s;
+    // How many other peers that announced a tx we remember, to request it from in turn if the
+    // peer we asked doesn't send it within TX_ANNOUNCE_REQUEST_TIMEOUT.
+    inline constexpr size_t TX_ANNOUNCE_MAX_ANNOUNCERS = 8;
+    // How many announced txs we will have outstanding requests for from a single peer.
+    inline constexpr size_t TX_ANNOUNCE_MAX_REQUESTED_PER_PEER = 5000;
+    // How many (randomly chosen) outgoing peers that support tx announcements still get the full
+    // txs when we flood them; the rest of those peers get announcements.
+    inline constexpr size_t TX_FULL_RELAY_OUTGOING_PEERS = 3;
+    // Likewise for announced uptime proofs.
+    inline constexpr auto PROOF_ANNOUNCE_REQUEST_TIMEOUT = 10s;
+    // How long we keep uptime proofs we have relayed so that peers we announced them to can fetch
+    // them from us.
+    inline constexpr auto PROOF_ANNOUNCE_CACHE_LIFETIME = 10min;
+    // Maximum number of uptime proofs that can be announced or requested in one message.
+    inline constexpr size_t PROOF_ANNOUNCE_MAX_COUNT = 1000;
 
 }  // namespace p2p
 
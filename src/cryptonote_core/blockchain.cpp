@@ -51,6 +51,7 @@
 #include "common/lock.h"
 #include "common/median.h"
 #include "common/pruning.h"
+#include "common/profiler.h"
 #include "common/rules.h"
 #include "common/sha256sum.h"
 #include "common/string_util.h"
@@ -172,6 +173,13 @@ bool Blockchain::have_tx_keyimg_as_spent(const crypto::key_image& key_im) const
     return m_db->has_key_image(key_im);
 }
 //------------------------------------------------------------------
+std::vector<bool> Blockchain::have_key_images_as_spent(
+        const std::vector<crypto::key_image>& key_images) const {
+    log::trace(logcat, "Blockchain::{}", __func__);
+    // Same WARNING as have_tx_keyimg_as_spent applies here.
+    return m_db->has_key_images(key_images);
+}
+//------------------------------------------------------------------
 // This function makes sure that each "input" in an input (mixins) exists
 // and collects the public key for each from the transaction it was included in
 // via the visitor passed to it.
@@ -3704,13 +3712,17 @@ bool Blockchain::check_tx_outputs(const transaction& tx, tx_verification_context
 //------------------------------------------------------------------
 bool Blockchain::have_tx_keyimges_as_spent(const transaction& tx) const {
     log::trace(logcat, "Blockchain::{}", __func__);
-    if (!tx.is_miner_tx()) {
-        for (const txin_v& in : tx.vin) {
-            CHECKED_GET_SPECIFIC_VARIANT(in, txin_to_key, in_to_key, true);
-            if (have_tx_keyimg_as_spent(in_to_key.k_image))
-                return true;
-        }
+    if (tx.is_miner_tx())
+        return false;
+    std::vector<crypto::key_image> key_images;
+    key_images.reserve(tx.vin.size());
+    for (const txin_v& in : tx.vin) {
+        CHECKED_GET_SPECIFIC_VARIANT(in, txin_to_key, in_to_key, true);
+        key_images.push_back(in_to_key.k_image);
     }
+    for (bool spent : have_key_images_as_spent(key_images))
+        if (spent)
+            return true;
     return false;
 }
 bool Blockchain::expand_transaction_2(
@@ -3807,6 +3819,7 @@ bool Blockchain::check_tx_inputs(
         uint64_t* pmax_used_block_height,
         std::unordered_set<crypto::key_image>* key_image_conflicts) {
     log::trace(logcat, "Blockchain::{}", __func__);
+    OXEN_PROFILE_SCOPE("blockchain.check_tx_inputs");
     uint64_t max_used_block_height = 0;
     if (!pmax_used_block_height)
         pmax_used_block_height = &max_used_block_height;
@@ -3984,6 +3997,12 @@ bool Blockchain::check_tx_inputs(
             return false;
         }
 
+        // If we have already verified this tx's signatures against these same ring members (see
+        // m_verified_sigs) then we don't need to verify them again.
+        const auto& txid = get_transaction_hash(tx);
+        const auto rings_hash = verified_sigs_cache::rings_hash(pubkeys);
+        const bool sigs_verified = m_verified_sigs.verified(txid, rings_hash);
+
         // from version 2, check ringct signatures
         // obviously, the original and simple rct APIs use a mixRing that's indexes
         // in opposite orders, because it'd be too simple otherwise...
@@ -4070,7 +4089,7 @@ bool Blockchain::check_tx_inputs(
                     }
                 }
 
-                if (!rct::verRctNonSemanticsSimple(rv)) {
+                if (!sigs_verified && !rct::verRctNonSemanticsSimple(rv)) {
                     log::error(log::Cat("verify"), "Failed to check ringct signatures!");
                     return false;
                 }
@@ -4136,7 +4155,7 @@ bool Blockchain::check_tx_inputs(
                     }
                 }
 
-                if (!rct::verRct(rv, false)) {
+                if (!sigs_verified && !rct::verRct(rv, false)) {
                     log::error(log::Cat("verify"), "Failed to check ringct signatures!");
                     return false;
                 }
@@ -4148,6 +4167,8 @@ bool Blockchain::check_tx_inputs(
                 return false;
         }
 
+        m_verified_sigs.add(txid, rings_hash);
+
         // for bulletproofs, check they're only multi-output after v8
         if (rct::is_rct_bulletproof(rv.type) && hf_version < hf::hf10_bulletproofs) {
             for (const rct::Bulletproof& proof : rv.p.bulletproofs) {
@@ -4328,6 +4349,7 @@ void Blockchain::check_ring_signature(
         const std::vector<rct::ctkey>& pubkeys,
         const std::vector<crypto::signature>& sig,
         uint64_t& result) const {
+    OXEN_PROFILE_SCOPE("blockchain.check_ring_signature");
     std::vector<const crypto::public_key*> p_output_keys;
     p_output_keys.reserve(pubkeys.size());
     for (auto& key : pubkeys) {
@@ -4722,6 +4744,50 @@ void Blockchain::return_tx_to_pool(std::vector<std::pair<transaction, std::strin
     }
 }
 //------------------------------------------------------------------
+bool Blockchain::stage_block_tx(
+        transaction tx, const crypto::hash& txid, std::string blob, tx_verification_context& tvc) {
+    // These mirror the checks tx_memory_pool::add_tx does for kept_by_block txs
+    if (tx.version == txversion::v0) {
+        log::info(logcat, "transaction version 0 is invalid");
+        tvc.m_verifivation_failed = true;
+        return false;
+    }
+
+    if (!check_inputs_types_supported(tx)) {
+        tvc.m_verifivation_failed = true;
+        tvc.m_invalid_input = true;
+        return false;
+    }
+
+    const auto hf_version = get_network_version();
+    uint64_t fee, burned;
+    if (!get_tx_miner_fee(tx, fee, hf_version >= feature::FEE_BURNING, &burned)) {
+        tvc.m_verifivation_failed = true;
+        tvc.m_fee_too_low = true;
+        return false;
+    }
+
+    const size_t weight = get_transaction_weight(tx, blob.size());
+    if (hf_version >= feature::PER_BYTE_FEE && weight > get_transaction_weight_limit(hf_version)) {
+        log::info(logcat, "transaction is too heavy: {} bytes", weight);
+        tvc.m_verifivation_failed = true;
+        tvc.m_too_big = true;
+        return false;
+    }
+
+    if (!check_tx_outputs(tx, tvc)) {
+        log::info(logcat, "Transaction with id= {} has at least one invalid output", txid);
+        tvc.m_verifivation_failed = true;
+        tvc.m_invalid_output = true;
+        return false;
+    }
+
+    std::unique_lock lock{*this};
+    m_staged_block_txs.insert_or_assign(
+            txid, staged_block_tx{std::move(tx), std::move(blob), weight, fee});
+    return true;
+}
+//------------------------------------------------------------------
 bool Blockchain::flush_txes_from_pool(const std::vector<crypto::hash>& txids) {
     std::unique_lock lock{tx_pool};
 
@@ -4997,6 +5063,7 @@ bool Blockchain::handle_block_to_main_chain(
         checkpoint_t const* checkpoint,
         bool notify) {
     log::trace(logcat, "Blockchain::{}", __func__);
+    OXEN_PROFILE_SCOPE("blockchain.handle_block_to_main_chain");
 
     auto block_processing_start = std::chrono::steady_clock::now();
     std::unique_lock lock{*this};
@@ -5085,16 +5152,22 @@ bool Blockchain::handle_block_to_main_chain(
         auto bb = std::chrono::steady_clock::now();
         t_exists += bb - aa;
 
-        // get transaction with hash <tx_id> from tx_pool
-        if (!tx_pool.take_tx(
-                    tx_id,
-                    tx_tmp,
-                    txblob,
-                    tx_weight,
-                    fee,
-                    relayed,
-                    do_not_relay,
-                    double_spend_seen)) {
+        // get transaction with hash <tx_id> from the txs staged by sync, or else from tx_pool
+        if (auto staged = m_staged_block_txs.find(tx_id); staged != m_staged_block_txs.end()) {
+            tx_tmp = std::move(staged->second.tx);
+            txblob = std::move(staged->second.blob);
+            tx_weight = staged->second.weight;
+            fee = staged->second.fee;
+            m_staged_block_txs.erase(staged);
+        } else if (!tx_pool.take_tx(
+                           tx_id,
+                           tx_tmp,
+                           txblob,
+                           tx_weight,
+                           fee,
+                           relayed,
+                           do_not_relay,
+                           double_spend_seen)) {
             log::info(
                     logcat,
                     fg(fmt::terminal_color::red),
@@ -5537,6 +5610,7 @@ bool Blockchain::add_new_block(
         const block& bl, block_verification_context& bvc, checkpoint_t const* checkpoint) {
 
     log::trace(logcat, "Blockchain::{}", __func__);
+    OXEN_PROFILE_SCOPE("blockchain.add_new_block");
     crypto::hash id = get_block_hash(bl);
     auto lock = tools::unique_locks(tx_pool, *this);
     db_rtxn_guard rtxn_guard{*m_db};
@@ -5685,6 +5759,26 @@ bool Blockchain::cleanup_handle_incoming_blocks(bool force_sync) {
     bool success = false;
     log::trace(logcat, "Blockchain::{}", __func__);
 
+    {
+        // Normally both are still held from prepare_handle_incoming_blocks, but we can also get
+        // here without it (and returning txs to the pool needs the pool lock first)
+        std::unique_lock pool_lock{tx_pool, std::defer_lock};
+        std::unique_lock lock{*this, std::defer_lock};
+        std::lock(pool_lock, lock);
+        if (!m_staged_block_txs.empty()) {
+            log::debug(
+                    logcat,
+                    "Returning {} staged txs not used by any added block to the tx pool",
+                    m_staged_block_txs.size());
+            std::vector<std::pair<transaction, std::string>> txs;
+            txs.reserve(m_staged_block_txs.size());
+            for (auto& [txid, staged] : m_staged_block_txs)
+                txs.emplace_back(std::move(staged.tx), std::move(staged.blob));
+            m_staged_block_txs.clear();
+            return_tx_to_pool(txs);
+        }
+    }
+
     try {
         if (m_batch_success)
             m_db->batch_stop();
@@ -5910,6 +6004,7 @@ bool Blockchain::calc_batched_governance_reward(uint64_t height, uint64_t& rewar
 bool Blockchain::prepare_handle_incoming_blocks(
         const std::vector<block_complete_entry>& blocks_entry, std::vector<block>& blocks) {
     log::trace(logcat, "Blockchain::{}", __func__);
+    OXEN_PROFILE_SCOPE("blockchain.prepare_handle_incoming_blocks");
     auto prepare = std::chrono::steady_clock::now();
     uint64_t bytes = 0;
     size_t total_txs = 0;
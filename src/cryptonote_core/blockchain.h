@@ -69,6 +69,7 @@
 #include "pulse.h"
 #include "rpc/core_rpc_server_binary_commands.h"
 #include "rpc/core_rpc_server_commands_defs.h"
+#include "verified_sigs_cache.h"
 
 struct sqlite3;
 namespace service_nodes {
@@ -357,6 +358,19 @@ class Blockchain {
      */
     bool have_tx_keyimg_as_spent(const crypto::key_image& key_im) const;
 
+    /**
+     * @brief check which of a list of key images are already spent on the blockchain
+     *
+     * Like calling have_tx_keyimg_as_spent() for each key image, but much faster for large lists.
+     *
+     * @param key_images the key images to search for
+     *
+     * @return a vector the same size as key_images with each element true if the corresponding
+     * key image is already spent in the blockchain, else false
+     */
+    std::vector<bool> have_key_images_as_spent(
+            const std::vector<crypto::key_image>& key_images) const;
+
     /**
      * @brief get the current height of the blockchain
      *
@@ -1100,6 +1114,30 @@ class Blockchain {
      */
     void on_new_tx_from_block(const cryptonote::transaction& tx);
 
+    /**
+     * @brief hands over a tx of an incoming block that is about to be added
+     *
+     * While syncing, the txs of incoming blocks can be given straight to the blockchain rather
+     * than being added to the mempool only to be taken out again (and deleted from the txpool
+     * tables) when their block gets added: handle_block_to_main_chain uses a tx staged here in
+     * place of taking it from the pool.  Staged txs that no added block used (for instance those
+     * of a block that went to an alt chain) are put into the pool by
+     * cleanup_handle_incoming_blocks, so that they are where they would otherwise have been.
+     *
+     * Does the same checks that the pool does when adding a tx from a block (the inputs are
+     * checked when the block is added).  Must be called between prepare_handle_incoming_blocks and
+     * cleanup_handle_incoming_blocks.
+     *
+     * @param tx the parsed transaction
+     * @param txid the transaction hash
+     * @param blob the transaction blob
+     * @param tvc set with the reason the tx was rejected, if it was
+     *
+     * @return true if the tx was staged, false if it is invalid
+     */
+    bool stage_block_tx(
+            transaction tx, const crypto::hash& txid, std::string blob, tx_verification_context& tvc);
+
     /**
      * @brief add a hook called during new block handling; should throw to abort adding the block.
      */
@@ -1235,6 +1273,20 @@ class Blockchain {
     std::vector<crypto::hash> m_blocks_hash_check;
     std::vector<crypto::hash> m_blocks_txs_check;
 
+    struct staged_block_tx {
+        transaction tx;
+        std::string blob;
+        size_t weight;
+        uint64_t fee;
+    };
+    std::unordered_map<crypto::hash, staged_block_tx> m_staged_block_txs;
+
+    // Transactions whose ring signatures check_tx_inputs has verified, so that checking them
+    // again against the same ring members can skip the signatures.  Protected by the blockchain
+    // lock.
+    static constexpr size_t VERIFIED_SIGS_CACHE_SIZE = 50'000;
+    verified_sigs_cache m_verified_sigs{VERIFIED_SIGS_CACHE_SIZE};
+
     blockchain_db_sync_mode m_db_sync_mode;
     bool m_fast_sync;
     bool m_show_time_stats;
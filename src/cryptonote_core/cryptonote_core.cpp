@@ -38,7 +38,9 @@
 
 #include <boost/algorithm/string.hpp>
 #include <csignal>
+#include <algorithm>
 #include <iomanip>
+#include <span>
 #include <unordered_set>
 
 #include "common/exception.h"
@@ -59,6 +61,7 @@ extern "C" {
 #include "common/file.h"
 #include "common/i18n.h"
 #include "common/notify.h"
+#include "common/profiler.h"
 #include "common/sha256sum.h"
 #include "common/threadpool.h"
 #include "crypto/crypto.h"
@@ -83,6 +86,10 @@ DISABLE_VS_WARNINGS(4355)
 // basically at least how many bytes the block itself serializes to without the miner tx
 #define BLOCK_SIZE_SANITY_LEEWAY 100
 
+// Smallest number of rct signatures worth splitting off into their own verification batch (and
+// thread); below this the lost batching amortization outweighs the extra parallelism.
+#define RCT_VERIFY_MIN_BATCH_SIZE 32
+
 namespace cryptonote {
 
 static auto logcat = log::Cat("cn");
@@ -150,6 +157,21 @@ static const command_line::arg_descriptor<uint16_t> arg_quorumnet_port = {
         "on the `--service-node-public-ip' address and binds to the p2p IP address."
         " Only applies when running as a service node.",
         [](cryptonote::network_type nettype) { return get_config(nettype).QNET_DEFAULT_PORT; }};
+static const command_line::arg_descriptor<uint32_t> arg_dev_pulse_delay = {
+        "dev-pulse-delay",
+        "Delay every incoming Pulse quorumnet message by this many milliseconds (for local testing "
+        "of Pulse timings only)",
+        0};
+static const command_line::arg_descriptor<uint32_t> arg_dev_pulse_jitter = {
+        "dev-pulse-jitter",
+        "Add a further random delay of up to this many milliseconds to incoming Pulse quorumnet "
+        "messages (for local testing of Pulse timings only)",
+        0};
+static const command_line::arg_descriptor<double> arg_dev_pulse_loss = {
+        "dev-pulse-loss",
+        "Drop this percentage of incoming Pulse quorumnet messages (for local testing of Pulse "
+        "timings only)",
+        0.0};
 static const command_line::arg_flag arg_omq_quorumnet_public{
         "lmq-public-quorumnet",
         "Allow the curve-enabled quorumnet address (for a Service Node) to be used for public RPC "
@@ -337,6 +359,9 @@ void core::init_options(boost::program_options::options_description& desc) {
     command_line::add_arg(desc, arg_l2_skip_chainid);
     command_line::add_arg(desc, arg_storage_server_port);
     command_line::add_arg(desc, arg_quorumnet_port);
+    command_line::add_arg(desc, arg_dev_pulse_delay);
+    command_line::add_arg(desc, arg_dev_pulse_jitter);
+    command_line::add_arg(desc, arg_dev_pulse_loss);
 
     command_line::add_arg(desc, arg_pad_transactions);
     command_line::add_arg(desc, arg_block_notify);
@@ -417,6 +442,35 @@ bool core::handle_command_line(const boost::program_options::variables_map& vm)
             args_okay = false;
         }
 
+        m_pulse_link_conditions.delay =
+                std::chrono::milliseconds{command_line::get_arg(vm, arg_dev_pulse_delay)};
+        m_pulse_link_conditions.jitter =
+                std::chrono::milliseconds{command_line::get_arg(vm, arg_dev_pulse_jitter)};
+        m_pulse_link_conditions.loss = command_line::get_arg(vm, arg_dev_pulse_loss) / 100.0;
+        if (m_pulse_link_conditions.loss < 0 || m_pulse_link_conditions.loss > 1) {
+            log::error(
+                    logcat,
+                    "Invalid '--{}' value: must be a percentage between 0 and 100",
+                    arg_dev_pulse_loss.name);
+            args_okay = false;
+        } else if (m_pulse_link_conditions.enabled()) {
+            if (m_nettype == network_type::MAINNET) {
+                log::error(
+                        logcat,
+                        "The --dev-pulse-* options are for local testing only and cannot be used "
+                        "on mainnet");
+                args_okay = false;
+            } else {
+                log::warning(
+                        logcat,
+                        "Simulating Pulse link conditions: {}ms delay, {}ms jitter, {}% loss. This "
+                        "service node WILL NOT PARTICIPATE IN PULSE RELIABLY!",
+                        m_pulse_link_conditions.delay.count(),
+                        m_pulse_link_conditions.jitter.count(),
+                        m_pulse_link_conditions.loss * 100);
+            }
+        }
+
         if (command_line::get_arg(vm, arg_l2_provider).empty()) {
             log::error(
                     logcat,
@@ -647,6 +701,7 @@ bool core::init(
     });
 
     blockchain.hook_block_post_add([this](const auto&) { update_omq_sns(); });
+    blockchain.hook_block_post_add([this](const auto&) { wake_pulse(); });
 
     // Checkpoints
     m_checkpoints_path = m_config_folder / JSON_HASH_FILE_NAME;
@@ -1224,14 +1279,24 @@ void core::start_oxenmq() {
 
     if (m_service_node) {
         m_pulse_thread_id = m_omq->add_tagged_thread("pulse");
+        // Pulse is driven by incoming messages, its own stage deadline timers and new blocks (see
+        // wake_pulse()); this slow timer is only a safety net.
         m_omq->add_timer(
-                [this]() { pulse::main(m_quorumnet_state, *this); },
-                std::chrono::milliseconds(500),
-                false,
-                m_pulse_thread_id);
+                [this]() { pulse::main(m_quorumnet_state, *this); }, 5s, false, m_pulse_thread_id);
         m_omq->add_timer([this]() { this->check_service_node_time(); }, 5s, false);
     }
     m_omq->start();
+    m_pulse_running = m_service_node;
+}
+
+void core::wake_pulse() {
+    if (m_pulse_running && !m_pulse_wake_pending.exchange(true))
+        m_omq->job(
+                [this] {
+                    m_pulse_wake_pending = false;
+                    pulse::main(m_quorumnet_state, *this);
+                },
+                *m_pulse_thread_id);
 }
 
 //-----------------------------------------------------------------------------------------------
@@ -1302,6 +1367,37 @@ void core::parse_incoming_tx_pre(tx_verification_batch_info& tx_info) {
     tx_info.result = true;
 }
 //-----------------------------------------------------------------------------------------------
+bool core::parse_incoming_tx_known(tx_verification_batch_info& tx_info) {
+    if (tx_info.blob->empty() || tx_info.blob->size() > MAX_TX_SIZE)
+        return false;  // parse_incoming_tx_pre will reject it
+
+    crypto::hash hash;
+    if (!calculate_transaction_hash_from_blob(*tx_info.blob, hash))
+        return false;
+
+    {
+        std::lock_guard lock{bad_semantics_txes_lock};
+        for (int idx = 0; idx < 2; ++idx) {
+            if (bad_semantics_txes[idx].count(hash)) {
+                log::info(logcat, "Transaction already seen with bad semantics, rejected");
+                tx_info.tvc.m_verifivation_failed = true;
+                m_incoming_tx_parses_skipped++;
+                return true;
+            }
+        }
+    }
+
+    if (!mempool.have_tx(hash) && !blockchain.have_tx(hash))
+        return false;
+
+    log::debug(logcat, "tx {} is already known, skipping parsing", hash);
+    tx_info.tx_hash = hash;
+    tx_info.already_have = true;
+    tx_info.result = true;
+    m_incoming_tx_parses_skipped++;
+    return true;
+}
+//-----------------------------------------------------------------------------------------------
 void core::set_semantics_failed(const crypto::hash& tx_hash) {
     log::info(logcat, "WRONG TRANSACTION BLOB, Failed to check tx {} semantic, rejected", tx_hash);
     bad_semantics_txes_lock.lock();
@@ -1322,9 +1418,61 @@ static bool is_canonical_bulletproof_layout(const std::vector<rct::Bulletproof>&
     return true;
 }
 //-----------------------------------------------------------------------------------------------
+// Batch verifies the semantics of `rvv`.  If the batch fails it gets split in half and each half
+// re-verified, recursively, until the bad signatures are isolated and appended to `bad`.
+// `known_bad` skips verifying a batch that we already know contains a bad signature (because the
+// other half of its failed parent batch passed).
+static void bisect_rct_semantics(
+        std::span<const rct::rctSig* const> rvv,
+        bool known_bad,
+        std::vector<const rct::rctSig*>& bad) {
+    if (!known_bad && rct::verRctSemanticsSimple(std::vector(rvv.begin(), rvv.end())))
+        return;
+    if (rvv.size() == 1) {
+        bad.push_back(rvv[0]);
+        return;
+    }
+    const size_t half = rvv.size() / 2;
+    const size_t bad_before = bad.size();
+    bisect_rct_semantics(rvv.first(half), false, bad);
+    bisect_rct_semantics(rvv.subspan(half), bad.size() == bad_before, bad);
+}
+//-----------------------------------------------------------------------------------------------
+// Verifies rct semantics for all of `rvv`, split into batches across the threadpool (batch
+// verification amortizes the bulletproof multiexp, so we want batches as large as possible while
+// still using all the threads).  Returns the signatures that failed verification.
+static std::vector<const rct::rctSig*> find_bad_rct_semantics(
+        const std::vector<const rct::rctSig*>& rvv) {
+    tools::threadpool& tpool = tools::threadpool::getInstance();
+    const size_t batches = std::clamp<size_t>(
+            rvv.size() / RCT_VERIFY_MIN_BATCH_SIZE, 1, std::max(tpool.get_max_concurrency(), 1u));
+
+    std::vector<std::vector<const rct::rctSig*>> bad(batches);
+    if (batches == 1) {
+        bisect_rct_semantics(rvv, false, bad[0]);
+    } else {
+        tools::threadpool::waiter waiter;
+        for (size_t b = 0, begin = 0; b < batches; b++) {
+            const size_t end = rvv.size() * (b + 1) / batches;
+            tpool.submit(&waiter, [&rvv, &bad = bad[b], begin, end] {
+                bisect_rct_semantics(std::span{rvv}.subspan(begin, end - begin), false, bad);
+            });
+            begin = end;
+        }
+        waiter.wait(&tpool);
+    }
+
+    for (size_t b = 1; b < batches; b++)
+        bad[0].insert(bad[0].end(), bad[b].begin(), bad[b].end());
+    return std::move(bad[0]);
+}
+//-----------------------------------------------------------------------------------------------
 void core::parse_incoming_tx_accumulated_batch(
-        std::vector<tx_verification_batch_info>& tx_info, bool kept_by_block) {
-    if (kept_by_block && blockchain.is_within_compiled_block_hash_area()) {
+        std::vector<tx_verification_batch_info>& tx_info, bool kept_by_block, size_t block_count) {
+    if (kept_by_block &&
+        blockchain.is_within_compiled_block_hash_area(
+                blockchain.get_current_blockchain_height() + std::max<size_t>(block_count, 1) -
+                1)) {
         log::trace(logcat, "Skipping semantics check for txs kept by block in embedded hash area");
         return;
     }
@@ -1390,22 +1538,27 @@ void core::parse_incoming_tx_accumulated_batch(
                 break;
         }
     }
-    if (!rvv.empty() && !rct::verRctSemanticsSimple(rvv)) {
-        log::info(
-                logcat,
-                "One transaction among this group has bad semantics, verifying one at a time");
-        const bool assumed_bad = rvv.size() == 1;  // if there's only one tx, it must be the bad one
-        for (size_t n = 0; n < tx_info.size(); ++n) {
-            if (!tx_info[n].result || tx_info[n].already_have)
-                continue;
-            if (!rct::is_rct_bulletproof(tx_info[n].tx.rct_signatures.type))
-                continue;
-            if (assumed_bad || !rct::verRctSemanticsSimple(tx_info[n].tx.rct_signatures)) {
-                set_semantics_failed(tx_info[n].tx_hash);
-                tx_info[n].tvc.m_verifivation_failed = true;
-                tx_info[n].result = false;
-            }
-        }
+    if (rvv.empty())
+        return;
+
+    auto verify_start = std::chrono::steady_clock::now();
+    auto bad = find_bad_rct_semantics(rvv);
+    log::debug(
+            logcat,
+            "Batch verified {} rct signatures in {}",
+            rvv.size(),
+            tools::friendly_duration(std::chrono::steady_clock::now() - verify_start));
+    if (bad.empty())
+        return;
+
+    log::info(logcat, "{} transaction(s) among this group have bad semantics", bad.size());
+    std::unordered_set<const rct::rctSig*> bad_set{bad.begin(), bad.end()};
+    for (auto& info : tx_info) {
+        if (!info.result || info.already_have || !bad_set.count(&info.tx.rct_signatures))
+            continue;
+        set_semantics_failed(info.tx_hash);
+        info.tvc.m_verifivation_failed = true;
+        info.result = false;
     }
 }
 //-----------------------------------------------------------------------------------------------
@@ -1414,11 +1567,44 @@ std::vector<cryptonote::tx_verification_batch_info> core::parse_incoming_txs(
     // Caller needs to do this around both this *and* handle_parsed_txs
     // auto lock = incoming_tx_lock();
     std::vector<cryptonote::tx_verification_batch_info> tx_info(tx_blobs.size());
+    for (size_t i = 0; i < tx_blobs.size(); i++)
+        tx_info[i].blob = &tx_blobs[i];
+
+    parse_incoming_tx_batch(tx_info, opts, 1);
+
+    return tx_info;
+}
+//-----------------------------------------------------------------------------------------------
+std::vector<cryptonote::tx_verification_batch_info> core::parse_incoming_block_txs(
+        const std::vector<block_complete_entry>& blocks) {
+    size_t tx_count = 0;
+    for (const auto& entry : blocks)
+        tx_count += entry.txs.size();
+
+    std::vector<cryptonote::tx_verification_batch_info> tx_info(tx_count);
+    size_t i = 0;
+    for (const auto& entry : blocks)
+        for (const auto& blob : entry.txs)
+            tx_info[i++].blob = &blob;
+
+    parse_incoming_tx_batch(tx_info, tx_pool_options::from_block(), blocks.size());
 
+    return tx_info;
+}
+//-----------------------------------------------------------------------------------------------
+void core::parse_incoming_tx_batch(
+        std::vector<tx_verification_batch_info>& tx_info,
+        const tx_pool_options& opts,
+        size_t block_count) {
+    OXEN_PROFILE_SCOPE("core.parse_incoming_tx_batch");
     tools::threadpool& tpool = tools::threadpool::getInstance();
     tools::threadpool::waiter waiter;
-    for (size_t i = 0; i < tx_blobs.size(); i++) {
-        tx_info[i].blob = &tx_blobs[i];
+    for (size_t i = 0; i < tx_info.size(); i++) {
+        // Most relayed txs are ones we already have (every peer forwards them to us), so look them
+        // up by the cheap blob hash first and skip the full parse of the ones we already know.
+        // (Not for block txs, though: handle_parsed_txs needs the parsed tx for those).
+        if (!opts.kept_by_block && parse_incoming_tx_known(tx_info[i]))
+            continue;
         tpool.submit(&waiter, [this, &info = tx_info[i]] {
             try {
                 parse_incoming_tx_pre(info);
@@ -1431,7 +1617,7 @@ std::vector<cryptonote::tx_verification_batch_info> core::parse_incoming_txs(
     waiter.wait(&tpool);
 
     for (auto& info : tx_info) {
-        if (!info.result)
+        if (!info.result || info.already_have)
             continue;
 
         if (mempool.have_tx(info.tx_hash)) {
@@ -1443,17 +1629,16 @@ std::vector<cryptonote::tx_verification_batch_info> core::parse_incoming_txs(
         }
     }
 
-    parse_incoming_tx_accumulated_batch(tx_info, opts.kept_by_block);
-
-    return tx_info;
+    parse_incoming_tx_accumulated_batch(tx_info, opts.kept_by_block, block_count);
 }
 
 bool core::handle_parsed_txs(
-        std::vector<tx_verification_batch_info>& parsed_txs,
+        std::span<tx_verification_batch_info> parsed_txs,
         const tx_pool_options& opts,
         uint64_t* blink_rollback_height) {
     // Caller needs to do this around both this *and* parse_incoming_txs
     // auto lock = incoming_tx_lock();
+    OXEN_PROFILE_SCOPE("core.handle_parsed_txs");
     auto version = blockchain.get_network_version();
     bool ok = true;
     if (blink_rollback_height)
@@ -1508,6 +1693,27 @@ bool core::handle_parsed_txs(
     return ok;
 }
 //-----------------------------------------------------------------------------------------------
+bool core::handle_parsed_block_txs(std::span<tx_verification_batch_info> parsed_txs) {
+    bool ok = true;
+    for (size_t i = 0; i < parsed_txs.size(); i++) {
+        auto& info = parsed_txs[i];
+        if (!info.result || info.already_have || mempool.have_tx_keyimges_as_spent(info.tx)) {
+            if (!handle_parsed_txs(parsed_txs.subspan(i, 1), tx_pool_options::from_block()))
+                ok = false;
+            continue;
+        }
+
+        blockchain.on_new_tx_from_block(info.tx);
+        if (blockchain.stage_block_tx(std::move(info.tx), info.tx_hash, *info.blob, info.tvc)) {
+            m_block_txs_staged++;
+        } else {
+            ok = false;
+            log::error(log::Cat("verify"), "Transaction verification failed: {}", info.tx_hash);
+        }
+    }
+    return ok;
+}
+//-----------------------------------------------------------------------------------------------
 std::vector<cryptonote::tx_verification_batch_info> core::handle_incoming_txs(
         const std::vector<std::string>& tx_blobs, const tx_pool_options& opts) {
     auto lock = incoming_tx_lock();
@@ -1897,10 +2103,7 @@ bool core::is_key_image_spent(const crypto::key_image& key_image) const {
 //-----------------------------------------------------------------------------------------------
 bool core::are_key_images_spent(
         const std::vector<crypto::key_image>& key_im, std::vector<bool>& spent) const {
-    spent.clear();
-    for (auto& ki : key_im) {
-        spent.push_back(blockchain.have_tx_keyimg_as_spent(ki));
-    }
+    spent = blockchain.have_key_images_as_spent(key_im);
     return true;
 }
 //-----------------------------------------------------------------------------------------------
@@ -2169,11 +2372,21 @@ bool core::handle_uptime_proof(
     return result;
 }
 //-----------------------------------------------------------------------------------------------
+bool core::want_uptime_proof(const crypto::public_key& pubkey, uint64_t timestamp) const {
+    if (!service_node_list.is_service_node(pubkey, false /*require_active*/))
+        return false;
+    bool want = true;
+    service_node_list.access_proof(pubkey, [&](const auto& proof) {
+        if (proof.proof && proof.proof->timestamp >= timestamp)
+            want = false;
+    });
+    return want;
+}
+//-----------------------------------------------------------------------------------------------
 crypto::hash core::on_transaction_relayed(const std::string& tx_blob) {
     std::vector<std::pair<crypto::hash, std::string>> txs;
-    cryptonote::transaction tx;
     crypto::hash tx_hash;
-    if (!parse_and_validate_tx_from_blob(tx_blob, tx, tx_hash)) {
+    if (!calculate_transaction_hash_from_blob(tx_blob, tx_hash)) {
         log::error(logcat, "Failed to parse relayed transaction");
         return crypto::null<crypto::hash>;
     }
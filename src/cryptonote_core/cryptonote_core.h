@@ -25,6 +25,7 @@
 #include <ctime>
 #include <future>
 #include <mutex>
+#include <span>
 
 #include "blockchain.h"
 #include "bls/bls_aggregator.h"
@@ -146,6 +147,14 @@ class core final {
             const NOTIFY_BTENCODED_UPTIME_PROOF::request& proof,
             bool& my_uptime_proof_confirmation);
 
+    /**
+     * @brief checks whether an announced uptime proof could be of use to us
+     *
+     * @return true if `pubkey` is a registered service node and we don't already have a proof
+     * from it with a timestamp of at least `timestamp`.
+     */
+    bool want_uptime_proof(const crypto::public_key& pubkey, uint64_t timestamp) const;
+
     /**
      * @brief handles an incoming transaction
      *
@@ -183,10 +192,35 @@ class core final {
     std::vector<cryptonote::tx_verification_batch_info> parse_incoming_txs(
             const std::vector<std::string>& tx_blobs, const tx_pool_options& opts);
 
+    /**
+     * @brief parses the transactions of a span of incoming blocks
+     *
+     * Like parse_incoming_txs (with tx_pool_options::from_block()), but parses the txs of all the
+     * given blocks at once so that their signatures are batch verified together rather than a
+     * block at a time.  The returned vector holds the txs of each block in order; the caller
+     * passes each block's slice to handle_parsed_txs before adding that block.
+     *
+     * Must be called between prepare_handle_incoming_blocks() and
+     * cleanup_handle_incoming_blocks() for the same blocks, with the chain at the height of the
+     * first block.
+     *
+     * @param blocks the incoming blocks.  As with parse_incoming_txs, the returned value refers
+     * to the tx blobs inside `blocks`, which must outlive it.
+     *
+     * @return vector of tx_verification_batch_info structs for all the blocks' txs.
+     */
+    std::vector<cryptonote::tx_verification_batch_info> parse_incoming_block_txs(
+            const std::vector<block_complete_entry>& blocks);
+
+    /// Returns the number of incoming txs that we didn't have to fully parse because they were
+    /// already known (in the mempool or blockchain) or already known to be bad.
+    uint64_t get_incoming_tx_parses_skipped() const { return m_incoming_tx_parses_skipped; }
+
     /**
      * @brief handles parsed incoming transactions
      *
-     * Takes parsed incoming tx info (as returned by parse_incoming_txs) and attempts to insert any
+     * Takes parsed incoming tx info (as returned by parse_incoming_txs, or one block's slice of
+     * the value returned by parse_incoming_block_txs) and attempts to insert any
      * valid, not-already-seen transactions into the mempool.  Returns the indices of any
      * transactions that failed insertion.
      *
@@ -210,10 +244,34 @@ class core final {
      * ones failed check the `tvc` values).
      */
     bool handle_parsed_txs(
-            std::vector<tx_verification_batch_info>& parsed_txs,
+            std::span<tx_verification_batch_info> parsed_txs,
             const tx_pool_options& opts,
             uint64_t* blink_rollback_height = nullptr);
 
+    /**
+     * @brief hands the parsed txs of a syncing block straight to the blockchain
+     *
+     * Used instead of `handle_parsed_txs(parsed_txs, tx_pool_options::from_block())` for the txs
+     * of a block that is about to be added during sync: rather than adding the txs to the mempool
+     * (and its database tables) only to have the block take them right back out, the txs are
+     * staged with Blockchain::stage_block_tx for the block to use.  A tx that conflicts with
+     * something in the mempool goes through the mempool as before, since that is what resolves
+     * such conflicts (e.g. with blink txs).
+     *
+     * Must be called between prepare_handle_incoming_blocks() and
+     * cleanup_handle_incoming_blocks().
+     *
+     * @param parsed_txs one block's slice of the value returned by parse_incoming_block_txs
+     *
+     * @return false if any transactions failed verification, true otherwise (as with
+     * handle_parsed_txs).
+     */
+    bool handle_parsed_block_txs(std::span<tx_verification_batch_info> parsed_txs);
+
+    /// Returns the number of block txs that were handed straight to the blockchain during sync
+    /// rather than going through the mempool.
+    uint64_t get_block_txs_staged() const { return m_block_txs_staged; }
+
     /**
      * Wrapper that does a parse + handle when nothing is needed between the parsing the handling.
      *
@@ -701,6 +759,9 @@ class core final {
     uint16_t storage_omq_port() const { return m_storage_omq_port; }
     uint16_t quorumnet_port() const { return m_quorumnet_port; }
 
+    /// Artificial delay/loss to apply to incoming Pulse quorumnet messages (local testing only).
+    const pulse::link_conditions& pulse_link_conditions() const { return m_pulse_link_conditions; }
+
     /**
      * @brief attempts to relay any transactions in the mempool which need it
      *
@@ -745,9 +806,22 @@ class core final {
     bool check_service_node_time();
     void set_semantics_failed(const crypto::hash& tx_hash);
 
+    // Checks whether an incoming tx blob is one we already have (or already rejected) using the
+    // hash computed directly from the blob; returns true (with `tx_info` updated) if so, in which
+    // case the tx doesn't need to be fully parsed.
+    bool parse_incoming_tx_known(tx_verification_batch_info& tx_info);
     void parse_incoming_tx_pre(tx_verification_batch_info& tx_info);
+    // `block_count` is the number of blocks (starting at the current height) that the txs belong
+    // to when `kept_by_block` is true.
     void parse_incoming_tx_accumulated_batch(
-            std::vector<tx_verification_batch_info>& tx_info, bool kept_by_block);
+            std::vector<tx_verification_batch_info>& tx_info,
+            bool kept_by_block,
+            size_t block_count);
+    // Does the parse_incoming_txs work on `tx_info` (which must already have the blobs set).
+    void parse_incoming_tx_batch(
+            std::vector<tx_verification_batch_info>& tx_info,
+            const tx_pool_options& opts,
+            size_t block_count);
 
     /**
      * @brief act on a set of command line options given
@@ -843,6 +917,13 @@ class core final {
     }
     oxenmq::TaggedThreadID const& pulse_thread_id() const { return *m_pulse_thread_id; }
 
+    /**
+     * @brief Schedules a run of the Pulse state machine on the pulse thread (e.g. because a new
+     * block arrived).  Multiple calls before the run happens are coalesced into one; does nothing
+     * if we're not a service node or OxenMQ hasn't started yet.
+     */
+    void wake_pulse();
+
     /// Service Node's storage server and lokinet version
     std::array<uint16_t, 3> ss_version;
     std::array<uint16_t, 3> lokinet_version;
@@ -929,6 +1010,7 @@ class core final {
     /// Service Node's public IP and qnet ports
     uint32_t m_sn_public_ip;
     uint16_t m_quorumnet_port;
+    pulse::link_conditions m_pulse_link_conditions;
 
     /// OxenMQ main object.  Gets created during init().
     std::shared_ptr<oxenmq::OxenMQ> m_omq;
@@ -947,6 +1029,8 @@ class core final {
 
     std::unordered_set<crypto::hash> bad_semantics_txes[2];
     std::mutex bad_semantics_txes_lock;
+    std::atomic<uint64_t> m_incoming_tx_parses_skipped{0};
+    std::atomic<uint64_t> m_block_txs_staged{0};
 
     bool m_offline;
     bool m_pad_transactions;
@@ -959,6 +1043,8 @@ class core final {
     } m_coinbase_cache;
 
     std::optional<oxenmq::TaggedThreadID> m_pulse_thread_id;
+    std::atomic<bool> m_pulse_running{false};       // Set once OMQ (and so the pulse thread) is up
+    std::atomic<bool> m_pulse_wake_pending{false};  // Coalesces wake_pulse() calls
 };
 }  // namespace cryptonote
 
@@ -82,8 +82,9 @@ struct tx_verification_batch_info {
                                   // blink tx (that replaces conflicting non-blink txes)
     const std::string* blob = nullptr;  // Will be set to a pointer to the incoming std::string
                                         // (i.e. string). caller must keep it alive!
-    crypto::hash tx_hash;               // The transaction hash (only set if `parsed`)
-    transaction tx;                     // The parsed transaction (only set if `parsed`)
+    crypto::hash tx_hash;  // The transaction hash (only set if `parsed` or `already_have`)
+    transaction tx;        // The parsed transaction (only set if `parsed`; relayed txs found to
+                           // be `already_have` are not parsed at all)
 };
 
 struct oxen_miner_tx_context {
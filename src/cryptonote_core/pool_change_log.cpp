@@ -0,0 +1,53 @@
+#include "pool_change_log.h"
+
+#include <algorithm>
+#include <unordered_map>
+
+namespace cryptonote {
+
+pool_change_log::pool_change_log(std::atomic<uint64_t>& cookie, size_t max_changes) :
+        m_cookie{cookie}, m_max_changes{max_changes}, m_changes_since{cookie} {}
+
+void pool_change_log::record(
+        const crypto::hash& txid, pool_change::type change, bool do_not_relay) {
+    std::lock_guard lock{m_mutex};
+    m_changes.push_back({++m_cookie, txid, change, do_not_relay});
+    if (m_changes.size() > m_max_changes) {
+        m_changes_since = m_changes.front().cookie;
+        m_changes.pop_front();
+    }
+}
+
+std::optional<pool_changes> pool_change_log::changes_since(
+        uint64_t since, bool include_unrelayed_txes) const {
+    std::vector<pool_change> changes;
+    pool_changes result;
+    {
+        std::lock_guard lock{m_mutex};
+        result.cookie = m_cookie;
+        if (since < m_changes_since || since > result.cookie)
+            return std::nullopt;
+        auto it = std::upper_bound(
+                m_changes.begin(), m_changes.end(), since, [](uint64_t c, const pool_change& ch) {
+                    return c < ch.cookie;
+                });
+        changes.assign(it, m_changes.end());
+    }
+
+    // Only the last change to each tx matters: whether it is in the pool now or not.
+    using type = pool_change::type;
+    std::unordered_map<crypto::hash, const pool_change*> last;
+    for (const auto& ch : changes)
+        last[ch.txid] = &ch;
+    for (const auto& ch : changes) {
+        if (last[ch.txid] != &ch)
+            continue;
+        if (ch.change != type::removed)
+            result.added.push_back(ch.txid);
+        else if (include_unrelayed_txes || !ch.do_not_relay)
+            result.removed.push_back(ch.txid);
+    }
+    return result;
+}
+
+}  // namespace cryptonote
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include "crypto/hash.h"
+
+namespace cryptonote {
+
+/// Transactions added to and removed from the pool since some earlier pool cookie.
+struct pool_changes {
+    uint64_t cookie;                    ///< the pool cookie as of these changes
+    std::vector<crypto::hash> added;    ///< txs added since, and still in the pool
+    std::vector<crypto::hash> removed;  ///< txs removed since, and not in the pool now
+};
+
+/// A tx being added to or removed from the pool, or becoming visible to non-admins
+struct pool_change {
+    enum class type : uint8_t { added, removed, relayable };
+    uint64_t cookie;  // The cookie right after the change
+    crypto::hash txid;
+    type change;
+    bool do_not_relay;  // Whether the tx was marked do_not_relay (for added/removed)
+};
+
+/// The most recent changes to the pool, each tagged with the pool cookie right after it, so that
+/// someone holding an older cookie can catch up without fetching the whole pool again.
+class pool_change_log {
+  public:
+    /// `cookie` is the pool's change counter, which record() bumps for each change; the log
+    /// covers changes from its value at construction onwards, keeping at most `max_changes`.
+    pool_change_log(std::atomic<uint64_t>& cookie, size_t max_changes);
+
+    /// Records a change, bumping the cookie
+    void record(const crypto::hash& txid, pool_change::type change, bool do_not_relay);
+
+    /**
+     * @brief collapse the changes made since a previous cookie
+     *
+     * Each tx changed since `since` appears in just one of `added` or `removed`, according to
+     * its last change.  Removals of do_not_relay txs are left out unless `include_unrelayed_txes`
+     * is set; `added` is not filtered, since a tx's do_not_relay flag can change after it was
+     * added, so the caller has to check which of them are relayable now.
+     *
+     * @return the changes, or nullopt if `since` predates the log or is newer than the cookie
+     */
+    std::optional<pool_changes> changes_since(uint64_t since, bool include_unrelayed_txes) const;
+
+  private:
+    std::atomic<uint64_t>& m_cookie;
+    const size_t m_max_changes;
+    mutable std::mutex m_mutex;
+    std::deque<pool_change> m_changes;  //!< the most recent m_max_changes changes
+    uint64_t m_changes_since;           //!< m_changes has every change after this cookie
+};
+
+}  // namespace cryptonote
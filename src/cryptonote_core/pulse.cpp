@@ -1,8 +1,11 @@
 #include <array>
 #include <chrono>
 #include <mutex>
+#include <optional>
 #include <variant>
 
+#include "common/oneshot_timer.h"
+#include "common/oxen.h"
 #include "common/random.h"
 #include "cryptonote_basic/hardfork.h"
 #include "cryptonote_core.h"
@@ -78,6 +81,26 @@ namespace {
         return "Invalid2"sv;
     }
 
+    constexpr size_t ROUND_STATE_COUNT =
+            static_cast<size_t>(round_state::send_and_wait_for_signed_blocks) + 1;
+
+    // Short, stable names for the stages a participant goes through in a round, used as the keys
+    // of the round timings log line (which local benchmarking scripts parse).
+    constexpr std::string_view round_state_timing_key(round_state state) {
+        switch (state) {
+            case round_state::send_and_wait_for_handshakes: return "handshakes"sv;
+            case round_state::send_handshake_bitsets: return "send_bitset"sv;
+            case round_state::wait_for_handshake_bitsets: return "bitsets"sv;
+            case round_state::send_block_template: return "send_template"sv;
+            case round_state::wait_for_block_template: return "template"sv;
+            case round_state::send_and_wait_for_random_value_hashes:
+                return "random_value_hashes"sv;
+            case round_state::send_and_wait_for_random_value: return "random_values"sv;
+            case round_state::send_and_wait_for_signed_blocks: return "signed_blocks"sv;
+            default: return ""sv;
+        }
+    }
+
     enum struct sn_type {
         none,
         producer,
@@ -210,6 +233,32 @@ namespace {
             } signed_block;
         } transient;
 
+        cryptonote::core* core;  // Set on the first pulse::main(...) invocation so that arriving
+                                 // messages can drive the state machine.
+        bool running;            // True whilst pulse::main(...) is iterating the state machine
+        pulse::time_point timer_deadline;  // Stage deadline that a wake up timer is scheduled for
+
+        // Timings of the round we are currently participating in, logged when the round ends.
+        struct {
+            bool participating;  // True between entering the first stage of a round and its end
+            uint64_t height;
+            uint8_t round;
+            std::string node_name;
+            pulse::time_point round_start;  // When the round was scheduled to start
+            std::chrono::duration<double, std::milli>
+                    start_lag;              // How late we entered the first stage of the round
+            pulse::time_point stage_start;  // When we entered the current stage
+            std::array<std::chrono::duration<double, std::milli>, ROUND_STATE_COUNT> stage;
+            uint16_t visited;  // Bitset of the stages (by round_state index) we went through
+            std::string_view result;  // Set by the stage that completes our part of the round
+
+            std::array<pulse::time_point, ROUND_STATE_COUNT> deadline;  // Stage end times
+            pulse::time_point last_event;  // When we last accepted a message for a stage
+            std::chrono::duration<double, std::milli>
+                    transition_lag;  // Total delay between stages becoming able to end, i.e. their
+                                     // last message arriving or deadline passing, and us moving on
+        } stats;
+
         round_state state;
     };
 
@@ -773,6 +822,7 @@ void handle_message(void* quorumnet_state, pulse::message const& msg) {
 
     stage->bitset |= validator_bit;
     stage->msgs_received++;
+    context.stats.last_event = pulse::clock::now();
 
     if (quorumnet_state)
         cryptonote::quorumnet_pulse_relay_message_to_quorum(
@@ -780,6 +830,12 @@ void handle_message(void* quorumnet_state, pulse::message const& msg) {
                 msg,
                 context.prepare_for_round.quorum,
                 context.prepare_for_round.participant == sn_type::producer);
+
+    // The message may have completed the stage we're waiting on, advance the state machine right
+    // away instead of waiting for the stage deadline.  (Our own messages and early messages are
+    // handled from within the state machine which keeps iterating on its own).
+    if (!context.running && context.core)
+        pulse::main(quorumnet_state, *context.core);
 }
 
 // TODO(doyle): Update pulse::perpare_for_round with this function after the hard fork and sanity
@@ -833,9 +889,19 @@ namespace {
       Pulse progresses via a state-machine that is iterated through job submissions
       to 1 dedicated Pulse thread, started by OMQ.
 
-      Iterating the state-machine is done by a periodic invocation of
-      pulse::main(...) and messages received via Quorumnet for Pulse, which are
-      queued in the thread's job queue.
+      Iterating the state-machine is event driven, by invocations of
+      pulse::main(...) when:
+
+        - A message received via Quorumnet for Pulse is accepted (the message is
+          queued in the thread's job queue and handled by pulse::handle_message).
+        - The deadline of the stage we are waiting in (or the start of the round
+          we are waiting for) passes, by a one-shot timer scheduled at the end of
+          each pulse::main(...) invocation.
+        - A new block is added to the blockchain.
+        - A slow periodic timer fires, as a safety net.
+
+      so a stage ends as soon as its messages have arrived or its deadline has
+      passed instead of on the next poll.
 
       Using 1 dedicated thread via OMQ avoids any synchronization required in the
       user code when implementing Pulse.
@@ -1643,6 +1709,7 @@ namespace {
                 cryptonote::obj_to_json_str(block));
         cryptonote::quorumnet_pulse_relay_message_to_quorum(
                 quorumnet_state, msg, context.prepare_for_round.quorum, true /*block_producer*/);
+        context.stats.result = "template_sent"sv;
         return goto_preparing_for_next_round(context);
     }
 
@@ -2012,12 +2079,116 @@ namespace {
             if (!core.handle_block_found(final_block, bvc))
                 return goto_preparing_for_next_round(context);
 
+            context.stats.result = "block"sv;
             return goto_wait_for_next_block_and_clear_round_data(context);
         }
 
         return round_state::send_and_wait_for_signed_blocks;
     }
 
+    // The time at which the given waiting state ends (or for wait_for_round, the round starts), if
+    // the state has a deadline.
+    std::optional<pulse::time_point> state_deadline(
+            round_context const& context, round_state state) {
+        switch (state) {
+            case round_state::wait_for_round: return context.prepare_for_round.start_time;
+            case round_state::send_and_wait_for_handshakes:
+                return context.transient.send_and_wait_for_handshakes.stage.end_time;
+            case round_state::wait_for_handshake_bitsets:
+                return context.transient.wait_for_handshake_bitsets.stage.end_time;
+            case round_state::wait_for_block_template:
+                return context.transient.wait_for_block_template.stage.end_time;
+            case round_state::send_and_wait_for_random_value_hashes:
+                return context.transient.random_value_hashes.wait.stage.end_time;
+            case round_state::send_and_wait_for_random_value:
+                return context.transient.random_value.wait.stage.end_time;
+            case round_state::send_and_wait_for_signed_blocks:
+                return context.transient.signed_block.wait.stage.end_time;
+            default: return std::nullopt;
+        }
+    }
+
+    // Schedules a one-shot timer on the Pulse thread to re-run the state machine when the deadline
+    // of the state we are now waiting in passes (unless one is already scheduled for it).
+    void schedule_deadline_wakeup(
+            round_context& context, void* quorumnet_state, cryptonote::core& core) {
+        auto deadline = state_deadline(context, context.state);
+        if (!deadline || *deadline == context.timer_deadline)
+            return;
+        context.timer_deadline = *deadline;
+
+        // +1ms so that the clock has reached the deadline when the timer fires
+        auto delay = std::max(
+                std::chrono::milliseconds{1},
+                std::chrono::ceil<std::chrono::milliseconds>(*deadline - pulse::clock::now()) +
+                        1ms);
+        tools::add_oneshot_timer(
+                core.omq(),
+                [quorumnet_state, &core] { pulse::main(quorumnet_state, core); },
+                delay,
+                core.pulse_thread_id());
+    }
+
+    // Accumulates the time spent in the stage we just left, and when a round we took part in ends,
+    // logs its per stage timings in one line of 'key=value' pairs.
+    void record_state_transition(round_context& context, round_state from) {
+        auto const now = pulse::clock::now();
+        auto& stats = context.stats;
+        if (from == round_state::wait_for_round && context.state > round_state::wait_for_round) {
+            stats = {};
+            stats.participating = true;
+            stats.height = context.wait_for_next_block.height;
+            stats.round = context.prepare_for_round.round;
+            stats.node_name = context.prepare_for_round.node_name;
+            stats.round_start = context.prepare_for_round.start_time;
+            stats.start_lag = now - stats.round_start;
+            stats.stage_start = now;
+            for (size_t i = 0; i < stats.deadline.size(); i++)
+                if (auto deadline = state_deadline(context, static_cast<round_state>(i)))
+                    stats.deadline[i] = *deadline;
+            return;
+        }
+
+        if (!stats.participating)
+            return;
+
+        // The stage could have ended at the latest of entering it, its last accepted message and
+        // (if it has passed) its deadline.  This is a lower bound: a stage that had all its
+        // messages before a deadline we were late for counts from the deadline.
+        auto could_end = std::max(stats.stage_start, stats.last_event);
+        if (auto deadline = stats.deadline[static_cast<size_t>(from)];
+            deadline.time_since_epoch().count() && deadline <= now)
+            could_end = std::max(could_end, deadline);
+        stats.transition_lag += now - could_end;
+
+        stats.stage[static_cast<size_t>(from)] += now - stats.stage_start;
+        stats.visited |= 1 << static_cast<size_t>(from);
+        stats.stage_start = now;
+        if (context.state > round_state::wait_for_round)
+            return;
+
+        std::string stages;
+        for (size_t i = 0; i < stats.stage.size(); i++)
+            if (stats.visited & (1 << i))
+                stages += " {}={:.1f}ms"_format(
+                        round_state_timing_key(static_cast<round_state>(i)), stats.stage[i].count());
+
+        log::info(
+                logcat,
+                "Pulse round timings: height={} round={} node={} result={} start_lag={:.1f}ms{} "
+                "transition_lag={:.1f}ms total={:.1f}ms",
+                stats.height,
+                +stats.round,
+                stats.node_name,
+                stats.result.empty() ? "failed_at_" + std::string{round_state_timing_key(from)}
+                                     : std::string{stats.result},
+                stats.start_lag.count(),
+                stages,
+                stats.transition_lag.count(),
+                std::chrono::duration<double, std::milli>(now - stats.round_start).count());
+        stats.participating = false;
+    }
+
 }  // anonymous namespace
 
 void main(void* quorumnet_state, cryptonote::core& core) {
@@ -2044,6 +2215,11 @@ void main(void* quorumnet_state, cryptonote::core& core) {
         return;
     }
 
+    context.core = &core;
+    context.running = true;
+    OXEN_DEFER {
+        context.running = false;
+    };
     auto& node_list = core.service_node_list;
     for (auto last_state = round_state::null_state;
          last_state != context.state || last_state == round_state::null_state;) {
@@ -2101,7 +2277,12 @@ void main(void* quorumnet_state, cryptonote::core& core) {
                         context, node_list, quorumnet_state, key, core);
                 break;
         }
+
+        if (context.state != last_state)
+            record_state_transition(context, last_state);
     }
+
+    schedule_deadline_wakeup(context, quorumnet_state, core);
 }
 
 }  // namespace pulse
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <cstdint>
 #include <string_view>
@@ -76,6 +77,17 @@ struct message {
     } signed_block;
 };
 
+// Artificial network conditions applied to Pulse messages received over quorumnet, used to measure
+// and tune Pulse round timings on local test networks.  Set via the --dev-pulse-* options and
+// never enabled on mainnet.
+struct link_conditions {
+    std::chrono::milliseconds delay{0};   // Fixed delay added to every incoming message
+    std::chrono::milliseconds jitter{0};  // Extra delay added on top, uniform in [0, jitter]
+    double loss = 0;                      // Probability [0, 1] that an incoming message is dropped
+
+    bool enabled() const { return delay.count() > 0 || jitter.count() > 0 || loss > 0; }
+};
+
 void main(void* quorumnet_state, cryptonote::core& core);
 void handle_message(void* quorumnet_state, pulse::message const& msg);
 
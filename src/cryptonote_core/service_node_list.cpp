@@ -44,6 +44,7 @@
 #include "common/exception.h"
 #include "common/i18n.h"
 #include "common/lock.h"
+#include "common/profiler.h"
 #include "common/random.h"
 #include "common/util.h"
 #include "crypto/crypto.h"
@@ -1022,6 +1023,7 @@ bool service_node_list::state_t::process_state_change_tx(
                         key,
                         fmt::join(reasons, ","));
 
+            swarms.remove(key, info.swarm_id);
             info.active_since_height = -info.active_since_height;
             info.last_decommission_height = block_height;
             info.last_decommission_reason_consensus_all = state_change.reason_consensus_all;
@@ -1073,6 +1075,7 @@ bool service_node_list::state_t::process_state_change_tx(
             int64_t decomm_blocks = block_height - info.last_decommission_height;
 
             info.active_since_height = block_height;
+            update_swarm_index(key, false, info.swarm_id);
             info.recommission_credit = RECOMMISSION_CREDIT(credit_at_decomm, decomm_blocks);
             // Move the SN at the back of the list as if it had just registered (or just won)
             info.last_reward_block_height = block_height;
@@ -2061,6 +2064,7 @@ bool service_node_list::state_t::process_contribution_tx(
             stake.service_node_pubkey);
     if (info.is_fully_funded()) {
         info.active_since_height = block_height;
+        update_swarm_index(iter->first, false, info.swarm_id);
         return true;
     }
     return false;
@@ -2471,6 +2475,7 @@ void service_node_list::block_add(
     if (block.major_version < hf::hf9_service_nodes)
         return;
 
+    OXEN_PROFILE_SCOPE("service_node_list.block_add");
     std::lock_guard lock(m_sn_mutex);
     process_block(block, txs);
     if (!skip_verify)
@@ -3126,22 +3131,22 @@ void service_node_list::state_t::update_from_block(
         uint64_t seed = 0;
         std::memcpy(&seed, block_hash.data(), sizeof(seed));
 
-        /// Gather existing swarms from infos
-        swarm_snode_map_t existing_swarms;
-        for (const auto& key_info : active_snode_list)
-            existing_swarms[key_info.second->swarm_id].push_back(key_info.first);
+        if (swarms.size() != active_snode_list.size()) {
+            // Should never happen: it means some change to a node's state didn't update `swarms`
+            log::error(
+                    logcat,
+                    "Swarm index has {} nodes but there are {} active nodes; rebuilding it",
+                    swarms.size(),
+                    active_snode_list.size());
+            rebuild_swarm_index();
+        }
 
+        swarm_snode_map_t existing_swarms = swarms.swarms();
         calc_swarm_changes(existing_swarms, seed);
 
         /// Apply changes
-        for (const auto& [swarm_id, snodes] : existing_swarms) {
-            for (const auto& snode : snodes) {
-                auto& sn_info_ptr = service_nodes_infos.at(snode);
-                if (sn_info_ptr->swarm_id == swarm_id)
-                    continue;  /// nothing changed for this snode
-                duplicate_info(sn_info_ptr).swarm_id = swarm_id;
-            }
-        }
+        for (const auto& [snode, swarm_id] : swarms.assign(existing_swarms))
+            duplicate_info(service_nodes_infos.at(snode)).swarm_id = swarm_id;
     }
     generate_other_quorums(*this, active_snode_list, nettype, hf_version);
     next_block_leader_cache.reset();
@@ -3185,6 +3190,7 @@ void service_node_list::process_block(
                     // state_t.height (which is all the set order depends on).
                     state_t& state = const_cast<state_t&>(*it);
                     state.service_nodes_infos = {};
+                    state.swarms.clear();
                     state.key_image_blacklist = {};
                     state.only_loaded_quorums = true;
                 }
@@ -4719,6 +4725,7 @@ service_node_list::state_t::state_t(service_node_list* snl, state_serialized&& s
     }
 
     initialize_xpk_map();
+    rebuild_swarm_index();
 
     quorums = quorum_for_serialization_to_quorum_manager(state.quorums);
 }
@@ -4736,7 +4743,12 @@ void service_node_list::state_t::initialize_xpk_map() {
 
 void service_node_list::state_t::insert_info(
         const crypto::public_key& pubkey, std::shared_ptr<service_node_info>&& info_ptr) {
-    service_nodes_infos[pubkey] = std::move(info_ptr);
+    auto& info = service_nodes_infos[pubkey];
+    if (info && info->is_active())
+        swarms.remove(pubkey, info->swarm_id);
+    info = std::move(info_ptr);
+    if (info->is_active())
+        swarms.add(pubkey, info->swarm_id);
 
     if (sn_list && cryptonote::is_hard_fork_at_least(
                            sn_list->blockchain.nettype(), feature::SN_PK_IS_ED25519, height))
@@ -4746,6 +4758,8 @@ void service_node_list::state_t::insert_info(
 service_nodes_infos_t::iterator service_node_list::state_t::erase_info(
         const service_nodes_infos_t::iterator& it) {
     const auto& snpk = it->first;
+    if (it->second->is_active())
+        swarms.remove(snpk, it->second->swarm_id);
     if (sn_list && cryptonote::is_hard_fork_at_least(
                            sn_list->blockchain.nettype(), feature::SN_PK_IS_ED25519, height))
         x25519_map.erase(snpk_to_xpk(snpk));
@@ -4753,6 +4767,22 @@ service_nodes_infos_t::iterator service_node_list::state_t::erase_info(
     return service_nodes_infos.erase(it);
 }
 
+void service_node_list::state_t::update_swarm_index(
+        const crypto::public_key& pubkey, bool was_active, swarm_id_t old_swarm_id) {
+    if (was_active)
+        swarms.remove(pubkey, old_swarm_id);
+    if (auto it = service_nodes_infos.find(pubkey);
+        it != service_nodes_infos.end() && it->second->is_active())
+        swarms.add(pubkey, it->second->swarm_id);
+}
+
+void service_node_list::state_t::rebuild_swarm_index() {
+    swarms.clear();
+    for (const auto& [pubkey, info] : service_nodes_infos)
+        if (info->is_active())
+            swarms.add(pubkey, info->swarm_id);
+}
+
 bool service_node_list::load(const uint64_t current_height) {
     log::info(logcat, "service_node_list::load()");
     reset(false);
@@ -4828,6 +4858,7 @@ bool service_node_list::load(const uint64_t current_height) {
                                 nullptr /*my_keys*/);
 
                         entry.service_nodes_infos = {};
+                        entry.swarms.clear();
                         entry.key_image_blacklist = {};
                         entry.only_loaded_quorums = true;
                         m_transient.state_archive.emplace_hint(
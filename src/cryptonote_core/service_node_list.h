@@ -44,6 +44,7 @@
 #include "cryptonote_core/ethereum_transactions.h"
 #include "cryptonote_core/service_node_quorum_cop.h"
 #include "cryptonote_core/service_node_rules.h"
+#include "cryptonote_core/service_node_swarm.h"
 #include "cryptonote_core/service_node_voting.h"
 #include "l2_tracker/events.h"
 #include "networks.h"
@@ -882,6 +883,9 @@ class service_node_list {
         crypto::hash block_hash{};
         bool only_loaded_quorums{false};
         service_nodes_infos_t service_nodes_infos;
+        // The active nodes of service_nodes_infos by swarm; kept in sync by insert_info(),
+        // erase_info(), and update_swarm_index().
+        swarm_index swarms;
         std::vector<key_image_blacklist_entry> key_image_blacklist;
         std::unordered_map<crypto::x25519_public_key, crypto::public_key> x25519_map;
         block_height height{0};
@@ -912,6 +916,13 @@ class service_node_list {
         void insert_info(
                 const crypto::public_key& pubkey, std::shared_ptr<service_node_info>&& info_ptr);
         service_nodes_infos_t::iterator erase_info(const service_nodes_infos_t::iterator& it);
+        // Updates `swarms` after a change to a node's info that may have changed whether it is
+        // active or which swarm it is in; `was_active` and `old_swarm_id` are from before the
+        // change.
+        void update_swarm_index(
+                const crypto::public_key& pubkey, bool was_active, swarm_id_t old_swarm_id);
+        // Rebuilds `swarms` from scratch from service_nodes_infos.
+        void rebuild_swarm_index();
 
         std::vector<pubkey_and_sninfo> active_service_nodes_infos() const;
         std::vector<pubkey_and_sninfo> decommissioned_service_nodes_infos()
@@ -322,4 +322,84 @@ void calc_swarm_changes(swarm_snode_map_t& swarm_to_snodes, uint64_t seed) {
         log::debug(logcat, "{}: {}", entry.first, entry.second.size());
     }
 }
+
+swarm_index::swarms_t& swarm_index::modify() {
+    if (m_swarms.use_count() > 1)
+        m_swarms = std::make_shared<swarms_t>(*m_swarms);
+    return *m_swarms;
+}
+
+void swarm_index::add(const crypto::public_key& pubkey, swarm_id_t swarm_id) {
+    auto& members = modify()[swarm_id];
+    if (!members)
+        members = std::make_shared<members_t>();
+    else if (members.use_count() > 1)
+        members = std::make_shared<members_t>(*members);
+    auto it = std::lower_bound(members->begin(), members->end(), pubkey);
+    if (it != members->end() && *it == pubkey)
+        return;
+    members->insert(it, pubkey);
+    m_size++;
+}
+
+void swarm_index::remove(const crypto::public_key& pubkey, swarm_id_t swarm_id) {
+    auto found = m_swarms->find(swarm_id);
+    if (found == m_swarms->end() ||
+        !std::binary_search(found->second->begin(), found->second->end(), pubkey))
+        return;
+
+    auto& swarms = modify();
+    auto swarm = swarms.find(swarm_id);
+    auto& members = swarm->second;
+    if (members->size() == 1) {
+        swarms.erase(swarm);
+    } else {
+        if (members.use_count() > 1)
+            members = std::make_shared<members_t>(*members);
+        members->erase(std::lower_bound(members->begin(), members->end(), pubkey));
+    }
+    m_size--;
+}
+
+void swarm_index::clear() {
+    m_swarms = std::make_shared<swarms_t>();
+    m_size = 0;
+}
+
+swarm_snode_map_t swarm_index::swarms() const {
+    swarm_snode_map_t result;
+    for (const auto& [swarm_id, members] : *m_swarms)
+        result.emplace_hint(result.end(), swarm_id, *members);
+    return result;
+}
+
+std::vector<std::pair<crypto::public_key, swarm_id_t>> swarm_index::assign(
+        const swarm_snode_map_t& swarm_to_snodes) {
+    std::vector<std::pair<crypto::public_key, swarm_id_t>> moved;
+    auto swarms = std::make_shared<swarms_t>();
+    size_t size = 0;
+    for (const auto& [swarm_id, snodes] : swarm_to_snodes) {
+        if (snodes.empty())
+            continue;
+        auto sorted = std::make_shared<members_t>(snodes);
+        std::sort(sorted->begin(), sorted->end());
+        size += sorted->size();
+
+        auto old = m_swarms->find(swarm_id);
+        if (old != m_swarms->end() && *old->second == *sorted) {
+            // Unchanged, so keep sharing it with older copies
+            swarms->emplace_hint(swarms->end(), swarm_id, old->second);
+            continue;
+        }
+        for (const auto& pubkey : *sorted)
+            if (old == m_swarms->end() ||
+                !std::binary_search(old->second->begin(), old->second->end(), pubkey))
+                moved.emplace_back(pubkey, swarm_id);
+        swarms->emplace_hint(swarms->end(), swarm_id, std::move(sorted));
+    }
+    m_swarms = std::move(swarms);
+    m_size = size;
+    return moved;
+}
+
 }  // namespace service_nodes
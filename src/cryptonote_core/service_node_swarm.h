@@ -1,7 +1,9 @@
 #pragma once
 
 #include <map>
+#include <memory>
 #include <random>
+#include <utility>
 #include <vector>
 
 #include "service_node_rules.h"
@@ -23,6 +25,43 @@ uint64_t get_new_swarm_id(const swarm_snode_map_t& swarm_to_snodes);
 
 void calc_swarm_changes(swarm_snode_map_t& swarm_to_snodes, uint64_t seed);
 
+/// The active service nodes of each swarm, kept up to date as nodes are added, removed, or change
+/// state so that a block that affects the swarms doesn't have to regroup every service node.  Each
+/// swarm's nodes are kept in pubkey order, which is the order calc_swarm_changes has always been
+/// given them in (and which its results depend on).
+///
+/// Copies share storage until modified, and then only the swarms that change get copied: a copy
+/// of the service node list state (and thus of this) is made for every block.
+class swarm_index {
+  public:
+    /// Adds a node to the given swarm
+    void add(const crypto::public_key& pubkey, swarm_id_t swarm_id);
+    /// Removes a node from the given swarm; does nothing if it isn't in it.
+    void remove(const crypto::public_key& pubkey, swarm_id_t swarm_id);
+    void clear();
+
+    /// The number of nodes in all swarms
+    size_t size() const { return m_size; }
+
+    /// Returns the swarms in the form calc_swarm_changes takes.
+    swarm_snode_map_t swarms() const;
+
+    /// Replaces the swarms with `swarm_to_snodes` (as updated by calc_swarm_changes) and returns
+    /// the nodes whose swarm changed, along with their new swarm.
+    std::vector<std::pair<crypto::public_key, swarm_id_t>> assign(
+            const swarm_snode_map_t& swarm_to_snodes);
+
+  private:
+    using members_t = std::vector<crypto::public_key>;
+    using swarms_t = std::map<swarm_id_t, std::shared_ptr<members_t>>;
+
+    // Returns the swarm map, copying it first if it is shared with another index.
+    swarms_t& modify();
+
+    std::shared_ptr<swarms_t> m_swarms = std::make_shared<swarms_t>();
+    size_t m_size = 0;
+};
+
 #ifdef UNIT_TEST
 size_t calc_excess(const swarm_snode_map_t& swarm_to_snodes);
 size_t calc_threshold(const swarm_snode_map_t& swarm_to_snodes);
@@ -78,19 +78,14 @@ namespace {
             d = MAX_RELAY_TIME;
         return d;
     }
-
-    uint64_t get_transaction_weight_limit(hf version) {
-        // from v10, bulletproofs, limit a tx to 50% of the minimum block weight
-        if (version >= hf::hf10_bulletproofs)
-            return get_min_block_weight(version) / 2 - COINBASE_BLOB_RESERVED_SIZE;
-        else
-            return get_min_block_weight(version) - COINBASE_BLOB_RESERVED_SIZE;
-    }
 }  // namespace
 //---------------------------------------------------------------------------------
 // warning: bchs is passed here uninitialized, so don't do anything but store it
 tx_memory_pool::tx_memory_pool(Blockchain& bchs) :
-        m_cookie(0),
+        m_cookie(std::chrono::duration_cast<std::chrono::microseconds>(
+                         std::chrono::system_clock::now().time_since_epoch())
+                         .count()),
+        m_change_log(m_cookie, MAX_POOL_CHANGES),
         m_blockchain(bchs),
         m_txpool_max_weight(DEFAULT_MEMPOOL_MAX_WEIGHT),
         m_txpool_weight(0) {}
@@ -537,7 +532,7 @@ bool tx_memory_pool::add_tx(
     tvc.m_verifivation_failed = false;
     m_txpool_weight += tx_weight;
 
-    ++m_cookie;
+    m_change_log.record(id, pool_change::type::added, meta.do_not_relay);
 
     log::info(
             logcat,
@@ -784,6 +779,29 @@ bool tx_memory_pool::remove_blink_conflicts(
     return true;
 }
 
+//---------------------------------------------------------------------------------
+std::optional<tx_memory_pool::pool_changes> tx_memory_pool::get_changes_since(
+        uint64_t since, bool include_unrelayed_txes) const {
+    auto result = m_change_log.changes_since(since, include_unrelayed_txes);
+    if (!result)
+        return std::nullopt;
+
+    // Txes can stop being do_not_relay after getting added, so check what they are now
+    if (!include_unrelayed_txes && !result->added.empty()) {
+        auto locks = tools::unique_locks(m_transactions_lock, m_blockchain);
+        result->added.erase(
+                std::remove_if(
+                        result->added.begin(),
+                        result->added.end(),
+                        [this](const crypto::hash& txid) {
+                            txpool_tx_meta_t meta;
+                            return !m_blockchain.db().get_txpool_tx_meta(txid, meta) ||
+                                   meta.do_not_relay;
+                        }),
+                result->added.end());
+    }
+    return result;
+}
 //---------------------------------------------------------------------------------
 size_t tx_memory_pool::get_txpool_weight() const {
     std::unique_lock lock{m_transactions_lock};
@@ -832,6 +850,7 @@ bool tx_memory_pool::remove_tx(
     m_blockchain.db().remove_txpool_tx(txid);
     m_txpool_weight -= meta->weight;
     remove_transaction_keyimages(tx, txid);
+    m_change_log.record(txid, pool_change::type::removed, meta->do_not_relay);
     m_txs_by_priority.erase(it);
 
     return true;
@@ -1024,6 +1043,7 @@ bool tx_memory_pool::take_tx(
         m_blockchain.db().remove_txpool_tx(id);
         m_txpool_weight -= tx_weight;
         remove_transaction_keyimages(tx, id);
+        m_change_log.record(id, pool_change::type::removed, do_not_relay);
         lock.commit();
     } catch (const std::exception& e) {
         log::error(logcat, "Failed to remove tx from txpool: {}", e.what());
@@ -1103,10 +1123,14 @@ bool tx_memory_pool::remove_stuck_transactions() {
                     log::error(logcat, "Failed to parse tx from txpool");
                     // continue
                 } else {
+                    txpool_tx_meta_t meta;
+                    const bool do_not_relay =
+                            m_blockchain.db().get_txpool_tx_meta(txid, meta) && meta.do_not_relay;
                     // remove first, so we only remove key images if the tx removal succeeds
                     m_blockchain.db().remove_txpool_tx(txid);
                     m_txpool_weight -= entry.second;
                     remove_transaction_keyimages(tx, txid);
+                    m_change_log.record(txid, pool_change::type::removed, do_not_relay);
                 }
             } catch (const std::exception& e) {
                 log::warning(logcat, "Failed to remove stuck transaction: {}", txid);
@@ -1194,6 +1218,7 @@ int tx_memory_pool::set_relayable(const std::vector<crypto::hash>& tx_hashes) {
             if (m_blockchain.db().get_txpool_tx_meta(tx, meta) && meta.do_not_relay) {
                 meta.do_not_relay = false;
                 m_blockchain.db().update_txpool_tx(tx, meta);
+                m_change_log.record(tx, pool_change::type::relayable, false);
                 ++updated;
             }
         } catch (const std::exception& e) {
@@ -1433,6 +1458,10 @@ bool tx_memory_pool::get_transaction(const crypto::hash& id, std::string& txblob
 //---------------------------------------------------------------------------------
 bool tx_memory_pool::on_blockchain_inc(block const& blk) {
     std::unique_lock lock{m_transactions_lock};
+    // A new block can spend key images, lock or blacklist them, register ONS names, and so on, so
+    // every pool tx's inputs need rechecking.  That's cheap, though: Blockchain remembers the
+    // signatures it has already verified, so the recheck only repeats the ring member lookups and
+    // the checks that can actually change from one block to the next.
     m_input_cache.clear();
     m_parsed_tx_cache.clear();
 
@@ -2074,10 +2103,14 @@ size_t tx_memory_pool::validate(hf version) {
                     log::error(logcat, "Failed to parse tx from txpool");
                     continue;
                 }
+                txpool_tx_meta_t meta;
+                const bool do_not_relay =
+                        m_blockchain.db().get_txpool_tx_meta(txid, meta) && meta.do_not_relay;
                 // remove tx from db first
                 m_blockchain.db().remove_txpool_tx(txid);
                 m_txpool_weight -= get_transaction_weight(tx, txblob.size());
                 remove_transaction_keyimages(tx, txid);
+                m_change_log.record(txid, pool_change::type::removed, do_not_relay);
                 auto sorted_it = find_tx_in_sorted_container(txid);
                 if (sorted_it == m_txs_by_priority.end()) {
                     log::info(
@@ -2157,8 +2190,6 @@ bool tx_memory_pool::init(size_t max_txpool_weight) {
         lock.commit();
     }
 
-    m_cookie = 0;
-
     // Ignore deserialization error
     return true;
 }
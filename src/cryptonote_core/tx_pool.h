@@ -31,7 +31,10 @@
 #pragma once
 
 #include <boost/serialization/version.hpp>
+#include <deque>
 #include <functional>
+#include <mutex>
+#include <optional>
 #include <set>
 #include <unordered_map>
 #include <unordered_set>
@@ -41,6 +44,7 @@
 #include "crypto/hash.h"
 #include "cryptonote_basic/verification_context.h"
 #include "oxen_economy.h"
+#include "pool_change_log.h"
 #include "tx_blink.h"
 
 namespace cryptonote {
@@ -333,6 +337,22 @@ class tx_memory_pool {
      */
     bool have_tx(const crypto::hash& id) const;
 
+    /**
+     * @brief check if any spent key image in a transaction is in the pool
+     *
+     * Checks if any of the spent key images in a given transaction are present
+     * in any of the transactions in the transaction pool.
+     *
+     * @note see tx_pool::have_tx_keyimg_as_spent
+     *
+     * @param tx the transaction to check spent key images of
+     * @param found if specified, append the hashes of all conflicting mempool txes here
+     *
+     * @return true if any spent key images are present in the pool, otherwise false
+     */
+    bool have_tx_keyimges_as_spent(
+            const transaction& tx, std::vector<crypto::hash>* conflicting = nullptr) const;
+
     /**
      * @brief determines whether the given tx hashes are in the mempool
      *
@@ -621,6 +641,28 @@ class tx_memory_pool {
      */
     uint64_t cookie() const { return m_cookie; }
 
+    /// Maximum number of tx additions/removals that get_changes_since() can look back through
+    static constexpr size_t MAX_POOL_CHANGES = 10'000;
+
+    using pool_changes = cryptonote::pool_changes;
+
+    /**
+     * @brief get the transactions added to and removed from the pool since a previous cookie
+     *
+     * Each tx changed since `since` appears in just one of `added` or `removed`, according to
+     * whether it is in the pool as of the returned cookie.  Applying the changes to a view of
+     * the pool as of `since`, or as of any later cookie up to the returned one, thus brings it up
+     * to date (though `removed` may then include txs the view never had).
+     *
+     * @param since a cookie() value previously obtained from this pool
+     * @param include_unrelayed_txes include transactions marked do_not_relay
+     *
+     * @return the changes, or nullopt if `since` is too old (or didn't come from this pool at all),
+     * in which case the caller needs to fetch the whole pool again instead.
+     */
+    std::optional<pool_changes> get_changes_since(
+            uint64_t since, bool include_unrelayed_txes) const;
+
     /**
      * @brief get the cumulative txpool weight in bytes
      *
@@ -690,22 +732,6 @@ class tx_memory_pool {
      */
     bool have_duplicated_non_standard_tx(transaction const& tx, hf version) const;
 
-    /**
-     * @brief check if any spent key image in a transaction is in the pool
-     *
-     * Checks if any of the spent key images in a given transaction are present
-     * in any of the transactions in the transaction pool.
-     *
-     * @note see tx_pool::have_tx_keyimg_as_spent
-     *
-     * @param tx the transaction to check spent key images of
-     * @param found if specified, append the hashes of all conflicting mempool txes here
-     *
-     * @return true if any spent key images are present in the pool, otherwise false
-     */
-    bool have_tx_keyimges_as_spent(
-            const transaction& tx, std::vector<crypto::hash>* conflicting = nullptr) const;
-
     /**
      * @brief forget a transaction's spent key images
      *
@@ -813,7 +839,12 @@ class tx_memory_pool {
     //!< container for transactions organized by fee per size and receive time
     sorted_tx_container m_txs_by_priority;
 
-    std::atomic<uint64_t> m_cookie;  //!< incremented at each change
+    //! incremented at each change; starts at the current time, in microseconds, so that cookies
+    //! from before a restart are older than any current cookie
+    std::atomic<uint64_t> m_cookie;
+
+    /// Changes for get_changes_since(); recording one bumps m_cookie
+    pool_change_log m_change_log;
 
     /// Callbacks for new tx notifications
     std::vector<std::function<void(
@@ -156,6 +156,22 @@ cryptonote::NOTIFY_BTENCODED_UPTIME_PROOF::request Proof::generate_request(hf ha
     return request;
 }
 
+std::pair<crypto::public_key, uint64_t> peek_pubkey_and_timestamp(
+        std::string_view serialized_proof) {
+    auto proof = oxenc::bt_dict_consumer{serialized_proof};
+    std::pair<crypto::public_key, uint64_t> result;
+    bool found_pk = false;
+    if (proof.skip_until("pk")) {
+        found_pk = true;
+        result.first = tools::make_from_guts<crypto::public_key>(proof.consume_string_view());
+    }
+    auto pke = proof.require<std::string_view>("pke");
+    if (!found_pk)
+        result.first = tools::make_from_guts<crypto::public_key>(pke);
+    result.second = proof.require<uint64_t>("t");
+    return result;
+}
+
 inline constexpr static auto proof_tuple(const Proof& p) {
     return std::tie(
             p.timestamp,
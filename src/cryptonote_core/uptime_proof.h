@@ -78,4 +78,9 @@ class Proof {
     bool operator==(const Proof& other) const;
 };
 
+/// Extracts just the (primary) pubkey and timestamp from a serialized proof, without validating
+/// anything else, so that the proof can be announced to peers.  Throws if either is missing.
+std::pair<crypto::public_key, uint64_t> peek_pubkey_and_timestamp(
+        std::string_view serialized_proof);
+
 }  // namespace uptime_proof
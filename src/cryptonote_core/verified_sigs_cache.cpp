@@ -0,0 +1,39 @@
+#include "verified_sigs_cache.h"
+
+#include "common/guts.h"
+
+namespace cryptonote {
+
+verified_sigs_cache::verified_sigs_cache(size_t max_size) : m_max_size{max_size} {}
+
+crypto::hash verified_sigs_cache::rings_hash(const std::vector<std::vector<rct::ctkey>>& rings) {
+    std::string data;
+    for (const auto& ring : rings) {
+        // Include each ring's size so that the same members split differently hash differently
+        const uint64_t size = ring.size();
+        data += tools::view_guts(size);
+        for (const auto& member : ring) {
+            data += tools::view_guts(member.dest);
+            data += tools::view_guts(member.mask);
+        }
+    }
+    return crypto::cn_fast_hash(data.data(), data.size());
+}
+
+bool verified_sigs_cache::verified(const crypto::hash& txid, const crypto::hash& rings_hash) const {
+    auto it = m_verified.find(txid);
+    return it != m_verified.end() && it->second == rings_hash;
+}
+
+void verified_sigs_cache::add(const crypto::hash& txid, const crypto::hash& rings_hash) {
+    auto [it, inserted] = m_verified.insert_or_assign(txid, rings_hash);
+    if (!inserted)
+        return;
+    m_order.push_back(txid);
+    if (m_order.size() > m_max_size) {
+        m_verified.erase(m_order.front());
+        m_order.pop_front();
+    }
+}
+
+}  // namespace cryptonote
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <unordered_map>
+#include <vector>
+
+#include "crypto/hash.h"
+#include "ringct/rctTypes.h"
+
+namespace cryptonote {
+
+/// Transactions whose ring signatures have been verified, each with a hash of the ring members
+/// (output keys and commitments) they were verified against.  A signature can't become invalid
+/// because blocks were added or popped, so a tx checked again (e.g. a pool tx after a new block,
+/// or a block tx that we already had in the pool) only needs its ring members looked up again --
+/// which, in a reorg, could change -- and can skip verifying its signatures if they hash the same.
+/// Bounded to a maximum number of txs, evicting the oldest first.  Not thread-safe.
+class verified_sigs_cache {
+  public:
+    explicit verified_sigs_cache(size_t max_size);
+
+    /// Hashes the ring members of each of a tx's inputs, as looked up to verify its signatures.
+    static crypto::hash rings_hash(const std::vector<std::vector<rct::ctkey>>& rings);
+
+    /// Returns true if `txid`'s signatures have already been verified against rings with this hash
+    bool verified(const crypto::hash& txid, const crypto::hash& rings_hash) const;
+
+    /// Records that `txid`'s signatures verified against rings with this hash, replacing any
+    /// earlier record for it.
+    void add(const crypto::hash& txid, const crypto::hash& rings_hash);
+
+  private:
+    const size_t m_max_size;
+    std::unordered_map<crypto::hash, crypto::hash> m_verified;
+    std::deque<crypto::hash> m_order;  // Order txs were added in, for eviction
+};
+
+}  // namespace cryptonote
@@ -0,0 +1,84 @@
+#include "compact_block.h"
+
+#include <unordered_map>
+
+extern "C" {
+#include <sodium/crypto_generichash.h>
+#include <sodium/crypto_shorthash.h>
+}
+
+namespace cryptonote::compact_block {
+
+static_assert(std::tuple_size_v<short_id_key> == crypto_shorthash_KEYBYTES);
+static_assert(crypto_shorthash_BYTES >= SHORT_ID_BYTES);
+
+short_id_key make_short_id_key(const crypto::hash& block_hash, uint64_t salt) {
+    unsigned char salt_bytes[8];
+    for (size_t i = 0; i < sizeof(salt_bytes); i++)
+        salt_bytes[i] = static_cast<unsigned char>(salt >> (8 * i));
+
+    short_id_key key;
+    crypto_generichash_state state;
+    crypto_generichash_init(&state, nullptr, 0, key.size());
+    crypto_generichash_update(&state, block_hash.data(), block_hash.size());
+    crypto_generichash_update(&state, salt_bytes, sizeof(salt_bytes));
+    crypto_generichash_final(&state, key.data(), key.size());
+    return key;
+}
+
+uint64_t short_id(const short_id_key& key, const crypto::hash& txid) {
+    unsigned char out[crypto_shorthash_BYTES];
+    crypto_shorthash(out, txid.data(), txid.size(), key.data());
+    uint64_t id = 0;
+    for (size_t i = 0; i < SHORT_ID_BYTES; i++)
+        id |= uint64_t{out[i]} << (8 * i);
+    return id;
+}
+
+void append_short_id(std::string& out, const short_id_key& key, const crypto::hash& txid) {
+    uint64_t id = short_id(key, txid);
+    for (size_t i = 0; i < SHORT_ID_BYTES; i++)
+        out += static_cast<char>(id >> (8 * i));
+}
+
+std::optional<std::vector<uint64_t>> unpack_short_ids(std::string_view packed) {
+    if (packed.size() % SHORT_ID_BYTES != 0)
+        return std::nullopt;
+
+    std::vector<uint64_t> ids;
+    ids.reserve(packed.size() / SHORT_ID_BYTES);
+    for (size_t pos = 0; pos < packed.size(); pos += SHORT_ID_BYTES) {
+        uint64_t id = 0;
+        for (size_t i = 0; i < SHORT_ID_BYTES; i++)
+            id |= uint64_t{static_cast<unsigned char>(packed[pos + i])} << (8 * i);
+        ids.push_back(id);
+    }
+    return ids;
+}
+
+std::vector<std::optional<crypto::hash>> match_short_ids(
+        const short_id_key& key,
+        const std::vector<uint64_t>& short_ids,
+        const std::vector<crypto::hash>& candidates) {
+    // short id -> candidate; a nullopt value marks a short id shared by multiple candidates, which
+    // we can't resolve and so have to treat as missing.
+    std::unordered_map<uint64_t, std::optional<crypto::hash>> index;
+    index.reserve(candidates.size());
+    for (const auto& txid : candidates) {
+        auto [it, inserted] = index.emplace(short_id(key, txid), txid);
+        if (!inserted && it->second != txid)
+            it->second.reset();
+    }
+
+    std::vector<std::optional<crypto::hash>> result;
+    result.reserve(short_ids.size());
+    for (uint64_t id : short_ids) {
+        if (auto it = index.find(id); it != index.end())
+            result.push_back(it->second);
+        else
+            result.emplace_back();
+    }
+    return result;
+}
+
+}  // namespace cryptonote::compact_block
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "crypto/hash.h"
+
+// Helpers for NOTIFY_NEW_COMPACT_BLOCK: computing, packing and matching the salted short tx ids
+// that replace the full 32-byte tx hashes of a relayed block.
+
+namespace cryptonote::compact_block {
+
+/// Number of bytes of each short id on the wire.  48 bits keeps the chance of an accidental
+/// collision between a block tx and some other mempool tx negligible for any realistic pool size,
+/// and a collision only costs an extra round trip (the block hash check fails and the receiver
+/// falls back to requesting the full block).
+inline constexpr size_t SHORT_ID_BYTES = 6;
+
+/// Siphash key used to compute the short ids of one relayed block.  It is derived from the block
+/// hash and a random per-relay salt so that nobody can grind tx hashes that collide with the short
+/// id of another tx ahead of time.
+using short_id_key = std::array<unsigned char, 16>;
+
+short_id_key make_short_id_key(const crypto::hash& block_hash, uint64_t salt);
+
+/// Returns the (48-bit) short id of `txid` under the given key.
+uint64_t short_id(const short_id_key& key, const crypto::hash& txid);
+
+/// Appends the packed short id of `txid` to `out`.
+void append_short_id(std::string& out, const short_id_key& key, const crypto::hash& txid);
+
+/// Unpacks a string of packed short ids.  Returns nullopt if the size isn't a multiple of
+/// SHORT_ID_BYTES.
+std::optional<std::vector<uint64_t>> unpack_short_ids(std::string_view packed);
+
+/// Matches `short_ids` against the short ids of `candidates` (typically every tx hash in the
+/// mempool).  The returned vector has the same size and order as `short_ids`; each element is the
+/// matching candidate hash, or nullopt if no candidate matched or if the short id is ambiguous
+/// (i.e. matches more than one candidate).
+std::vector<std::optional<crypto::hash>> match_short_ids(
+        const short_id_key& key,
+        const std::vector<uint64_t>& short_ids,
+        const std::vector<crypto::hash>& candidates);
+
+}  // namespace cryptonote::compact_block
@@ -2,7 +2,7 @@
 
 namespace cryptonote {
 
-KV_SERIALIZE_MAP_CODE_BEGIN(serializable_blink_metadata)
+KV_SERIALIZE_MAP_CODE_BEGIN_BINARY(serializable_blink_metadata)
 KV_SERIALIZE_VAL_POD_AS_BLOB_N(tx_hash, "#")
 KV_SERIALIZE_N(height, "h")
 KV_SERIALIZE_CONTAINER_POD_AS_BLOB_N(quorum, "q")
@@ -10,31 +10,31 @@ KV_SERIALIZE_CONTAINER_POD_AS_BLOB_N(position, "p")
 KV_SERIALIZE_CONTAINER_POD_AS_BLOB_N(signature, "s")
 KV_SERIALIZE_MAP_CODE_END()
 
-KV_SERIALIZE_MAP_CODE_BEGIN(block_complete_entry)
+KV_SERIALIZE_MAP_CODE_BEGIN_BINARY(block_complete_entry)
 KV_SERIALIZE(block)
 KV_SERIALIZE(txs)
 KV_SERIALIZE(checkpoint)
 KV_SERIALIZE(blinks)
 KV_SERIALIZE_MAP_CODE_END()
 
-KV_SERIALIZE_MAP_CODE_BEGIN(NOTIFY_NEW_TRANSACTIONS::request)
+KV_SERIALIZE_MAP_CODE_BEGIN_BINARY(NOTIFY_NEW_TRANSACTIONS::request)
 KV_SERIALIZE(txs)
 KV_SERIALIZE(blinks)
 KV_SERIALIZE_OPT(requested, false)
 KV_SERIALIZE(_)
 KV_SERIALIZE_MAP_CODE_END()
 
-KV_SERIALIZE_MAP_CODE_BEGIN(NOTIFY_REQUEST_GET_BLOCKS::request)
+KV_SERIALIZE_MAP_CODE_BEGIN_BINARY(NOTIFY_REQUEST_GET_BLOCKS::request)
 KV_SERIALIZE_CONTAINER_POD_AS_BLOB(blocks)
 KV_SERIALIZE_MAP_CODE_END()
 
-KV_SERIALIZE_MAP_CODE_BEGIN(NOTIFY_RESPONSE_GET_BLOCKS::request)
+KV_SERIALIZE_MAP_CODE_BEGIN_BINARY(NOTIFY_RESPONSE_GET_BLOCKS::request)
 KV_SERIALIZE(blocks)
 KV_SERIALIZE_CONTAINER_POD_AS_BLOB(missed_ids)
 KV_SERIALIZE(current_blockchain_height)
 KV_SERIALIZE_MAP_CODE_END()
 
-KV_SERIALIZE_MAP_CODE_BEGIN(CORE_SYNC_DATA)
+KV_SERIALIZE_MAP_CODE_BEGIN_BINARY(CORE_SYNC_DATA)
 KV_SERIALIZE(current_height)
 KV_SERIALIZE(cumulative_difficulty)
 KV_SERIALIZE_VAL_POD_AS_BLOB(top_id)
@@ -42,48 +42,73 @@ KV_SERIALIZE_ENUM(top_version)
 KV_SERIALIZE_OPT(pruning_seed, (uint32_t)0)
 KV_SERIALIZE(blink_blocks)
 KV_SERIALIZE_CONTAINER_POD_AS_BLOB(blink_hash)
+KV_SERIALIZE_OPT(support_flags, (uint32_t)0)
 KV_SERIALIZE_MAP_CODE_END()
 
-KV_SERIALIZE_MAP_CODE_BEGIN(NOTIFY_REQUEST_CHAIN::request)
+KV_SERIALIZE_MAP_CODE_BEGIN_BINARY(NOTIFY_REQUEST_CHAIN::request)
 KV_SERIALIZE_CONTAINER_POD_AS_BLOB(block_ids)
 KV_SERIALIZE_MAP_CODE_END()
 
-KV_SERIALIZE_MAP_CODE_BEGIN(NOTIFY_RESPONSE_CHAIN_ENTRY::request)
+KV_SERIALIZE_MAP_CODE_BEGIN_BINARY(NOTIFY_RESPONSE_CHAIN_ENTRY::request)
 KV_SERIALIZE(start_height)
 KV_SERIALIZE(total_height)
 KV_SERIALIZE(cumulative_difficulty)
 KV_SERIALIZE_CONTAINER_POD_AS_BLOB(m_block_ids)
 KV_SERIALIZE_MAP_CODE_END()
 
-KV_SERIALIZE_MAP_CODE_BEGIN(NOTIFY_NEW_FLUFFY_BLOCK::request)
+KV_SERIALIZE_MAP_CODE_BEGIN_BINARY(NOTIFY_NEW_FLUFFY_BLOCK::request)
 KV_SERIALIZE(b)
 KV_SERIALIZE(current_blockchain_height)
 KV_SERIALIZE_MAP_CODE_END()
 
-KV_SERIALIZE_MAP_CODE_BEGIN(NOTIFY_REQUEST_FLUFFY_MISSING_TX::request)
+KV_SERIALIZE_MAP_CODE_BEGIN_BINARY(NOTIFY_REQUEST_FLUFFY_MISSING_TX::request)
 KV_SERIALIZE_VAL_POD_AS_BLOB(block_hash)
 KV_SERIALIZE(current_blockchain_height)
 KV_SERIALIZE_CONTAINER_POD_AS_BLOB(missing_tx_indices)
 KV_SERIALIZE_MAP_CODE_END()
 
-KV_SERIALIZE_MAP_CODE_BEGIN(NOTIFY_BTENCODED_UPTIME_PROOF::request)
+KV_SERIALIZE_MAP_CODE_BEGIN_BINARY(NOTIFY_NEW_COMPACT_BLOCK::request)
+KV_SERIALIZE(block)
+KV_SERIALIZE_VAL_POD_AS_BLOB(block_hash)
+KV_SERIALIZE(current_blockchain_height)
+KV_SERIALIZE(salt)
+KV_SERIALIZE(short_ids)
+KV_SERIALIZE_CONTAINER_POD_AS_BLOB(prefilled_indices)
+KV_SERIALIZE(prefilled_txs)
+KV_SERIALIZE_MAP_CODE_END()
+
+KV_SERIALIZE_MAP_CODE_BEGIN_BINARY(NOTIFY_TX_ANNOUNCE::request)
+KV_SERIALIZE_CONTAINER_POD_AS_BLOB(txs)
+KV_SERIALIZE_MAP_CODE_END()
+
+KV_SERIALIZE_MAP_CODE_BEGIN_BINARY(NOTIFY_BTENCODED_UPTIME_PROOF::request)
 KV_SERIALIZE(proof)
 KV_SERIALIZE(sig)
 KV_SERIALIZE(ed_sig)
 KV_SERIALIZE_MAP_CODE_END()
 
-KV_SERIALIZE_MAP_CODE_BEGIN(NOTIFY_REQUEST_BLOCK_BLINKS::request)
+KV_SERIALIZE_MAP_CODE_BEGIN_BINARY(NOTIFY_REQUEST_BLOCK_BLINKS::request)
 KV_SERIALIZE(heights)
 KV_SERIALIZE_MAP_CODE_END()
 
-KV_SERIALIZE_MAP_CODE_BEGIN(NOTIFY_RESPONSE_BLOCK_BLINKS::request)
+KV_SERIALIZE_MAP_CODE_BEGIN_BINARY(NOTIFY_RESPONSE_BLOCK_BLINKS::request)
 KV_SERIALIZE_CONTAINER_POD_AS_BLOB(txs)
 KV_SERIALIZE_MAP_CODE_END()
 
-KV_SERIALIZE_MAP_CODE_BEGIN(NOTIFY_REQUEST_GET_TXS::request)
+KV_SERIALIZE_MAP_CODE_BEGIN_BINARY(NOTIFY_REQUEST_GET_TXS::request)
 KV_SERIALIZE_CONTAINER_POD_AS_BLOB(txs)
 KV_SERIALIZE_MAP_CODE_END()
 
+KV_SERIALIZE_MAP_CODE_BEGIN_BINARY(NOTIFY_UPTIME_PROOF_ANNOUNCE::request)
+KV_SERIALIZE_CONTAINER_POD_AS_BLOB(pubkeys)
+KV_SERIALIZE_CONTAINER_POD_AS_BLOB(timestamps)
+KV_SERIALIZE_CONTAINER_POD_AS_BLOB(hashes)
+KV_SERIALIZE_MAP_CODE_END()
+
+KV_SERIALIZE_MAP_CODE_BEGIN_BINARY(NOTIFY_REQUEST_UPTIME_PROOFS::request)
+KV_SERIALIZE_CONTAINER_POD_AS_BLOB(hashes)
+KV_SERIALIZE_MAP_CODE_END()
+
 // NOTIFY_NEW_SERVICE_NODE_VOTE::request implementation is in service_node_voting.cpp
 
 }  // namespace cryptonote
@@ -67,6 +67,9 @@ struct connection_info {
     uint64_t send_count;
     std::chrono::milliseconds send_idle_time;
 
+    uint64_t handled_count;
+    std::chrono::nanoseconds handler_cpu_time;
+
     std::string state;
 
     std::chrono::milliseconds live_time;
@@ -96,7 +99,7 @@ struct serializable_blink_metadata {
     std::vector<uint8_t> quorum;
     std::vector<uint8_t> position;
     std::vector<crypto::signature> signature;
-    KV_MAP_SERIALIZABLE
+    KV_MAP_SERIALIZABLE_BINARY
 };
 
 /************************************************************************/
@@ -108,7 +111,7 @@ struct block_complete_entry {
     std::vector<std::string> txs;
     std::string checkpoint;
     std::vector<serializable_blink_metadata> blinks;
-    KV_MAP_SERIALIZABLE
+    KV_MAP_SERIALIZABLE_BINARY
 };
 
 /************************************************************************/
@@ -123,7 +126,7 @@ struct NOTIFY_NEW_TRANSACTIONS {
         bool requested = false;
         std::string _;  // padding
 
-        KV_MAP_SERIALIZABLE
+        KV_MAP_SERIALIZABLE_BINARY
     };
 };
 /************************************************************************/
@@ -135,7 +138,7 @@ struct NOTIFY_REQUEST_GET_BLOCKS {
     struct request {
         std::vector<crypto::hash> blocks;
 
-        KV_MAP_SERIALIZABLE
+        KV_MAP_SERIALIZABLE_BINARY
     };
 };
 
@@ -147,7 +150,7 @@ struct NOTIFY_RESPONSE_GET_BLOCKS {
         std::vector<crypto::hash> missed_ids;
         uint64_t current_blockchain_height;
 
-        KV_MAP_SERIALIZABLE
+        KV_MAP_SERIALIZABLE_BINARY
     };
 };
 
@@ -159,8 +162,9 @@ struct CORE_SYNC_DATA {
     uint32_t pruning_seed;
     std::vector<uint64_t> blink_blocks;
     std::vector<crypto::hash> blink_hash;
+    uint32_t support_flags = 0;  // cryptonote::p2p::SUPPORT_FLAG_* bits
 
-    KV_MAP_SERIALIZABLE
+    KV_MAP_SERIALIZABLE_BINARY
 };
 
 struct NOTIFY_REQUEST_CHAIN {
@@ -171,7 +175,7 @@ struct NOTIFY_REQUEST_CHAIN {
                 block_ids;  // IDs of blocks at linear then exponential drop off, ending in genesis
                             // block; see blockchain.cpp for details
 
-        KV_MAP_SERIALIZABLE
+        KV_MAP_SERIALIZABLE_BINARY
     };
 };
 
@@ -184,7 +188,7 @@ struct NOTIFY_RESPONSE_CHAIN_ENTRY {
         uint64_t cumulative_difficulty;
         std::vector<crypto::hash> m_block_ids;
 
-        KV_MAP_SERIALIZABLE
+        KV_MAP_SERIALIZABLE_BINARY
     };
 };
 
@@ -198,7 +202,7 @@ struct NOTIFY_NEW_FLUFFY_BLOCK {
         block_complete_entry b;
         uint64_t current_blockchain_height;
 
-        KV_MAP_SERIALIZABLE
+        KV_MAP_SERIALIZABLE_BINARY
     };
 };
 
@@ -213,7 +217,48 @@ struct NOTIFY_REQUEST_FLUFFY_MISSING_TX {
         uint64_t current_blockchain_height;
         std::vector<uint64_t> missing_tx_indices;
 
-        KV_MAP_SERIALIZABLE
+        KV_MAP_SERIALIZABLE_BINARY
+    };
+};
+
+/************************************************************************/
+/*                                                                      */
+/************************************************************************/
+// Block relay for peers that advertise SUPPORT_FLAG_COMPACT_BLOCKS.  Instead of the full list of
+// 32-byte tx hashes the block is sent with its tx hashes stripped and each tx identified by a
+// salted 6-byte short id (see compact_block.h); the receiver rebuilds the tx list from its mempool
+// and verifies the result against `block_hash`.  Txs the sender expects the receiver not to have
+// are included in full as prefilled txs.  Anything that can't be reconstructed is fetched through
+// the regular NOTIFY_REQUEST_FLUFFY_MISSING_TX path.
+struct NOTIFY_NEW_COMPACT_BLOCK {
+    const static int ID = BC_COMMANDS_POOL_BASE + 17;
+
+    struct request {
+        std::string block;  // block blob serialized with an empty tx_hashes list
+        crypto::hash block_hash;
+        uint64_t current_blockchain_height;
+        uint64_t salt;
+        std::string short_ids;  // packed short ids of every non-prefilled tx, in block order
+        std::vector<uint64_t> prefilled_indices;  // strictly increasing block tx indices
+        std::vector<std::string> prefilled_txs;
+
+        KV_MAP_SERIALIZABLE_BINARY
+    };
+};
+
+/************************************************************************/
+/*                                                                      */
+/************************************************************************/
+// Announces tx hashes to a peer that advertises SUPPORT_FLAG_TX_ANNOUNCE; the peer fetches the ones
+// it doesn't have with NOTIFY_REQUEST_GET_TXS.  Received txs are only flooded in full to a few
+// outbound connections (and to peers without announce support); everyone else gets this instead.
+struct NOTIFY_TX_ANNOUNCE {
+    const static int ID = BC_COMMANDS_POOL_BASE + 18;
+
+    struct request {
+        std::vector<crypto::hash> txs;
+
+        KV_MAP_SERIALIZABLE_BINARY
     };
 };
 
@@ -230,7 +275,7 @@ struct NOTIFY_BTENCODED_UPTIME_PROOF {
         std::optional<std::string> sig;  // Not sent in HF21+
         std::string ed_sig;
 
-        KV_MAP_SERIALIZABLE
+        KV_MAP_SERIALIZABLE_BINARY
     };
 };
 
@@ -241,7 +286,7 @@ struct NOTIFY_REQUEST_BLOCK_BLINKS {
     constexpr static int ID = BC_COMMANDS_POOL_BASE + 13;
     struct request {
         std::vector<uint64_t> heights;
-        KV_MAP_SERIALIZABLE
+        KV_MAP_SERIALIZABLE_BINARY
     };
 };
 
@@ -249,7 +294,7 @@ struct NOTIFY_RESPONSE_BLOCK_BLINKS {
     constexpr static int ID = BC_COMMANDS_POOL_BASE + 14;
     struct request {
         std::vector<crypto::hash> txs;
-        KV_MAP_SERIALIZABLE
+        KV_MAP_SERIALIZABLE_BINARY
     };
 };
 
@@ -261,7 +306,36 @@ struct NOTIFY_REQUEST_GET_TXS {
 
     struct request {
         std::vector<crypto::hash> txs;
-        KV_MAP_SERIALIZABLE
+        KV_MAP_SERIALIZABLE_BINARY
+    };
+};
+
+/************************************************************************/
+/*                                                                      */
+/************************************************************************/
+// Announces uptime proofs to a peer that advertises SUPPORT_FLAG_PROOF_ANNOUNCE.  The peer fetches
+// the ones it doesn't have (and doesn't already have a newer proof for) with
+// NOTIFY_REQUEST_UPTIME_PROOFS, and gets each back as a NOTIFY_BTENCODED_UPTIME_PROOF.
+struct NOTIFY_UPTIME_PROOF_ANNOUNCE {
+    const static int ID = BC_COMMANDS_POOL_BASE + 19;
+
+    struct request {
+        // Parallel lists, with one element per announced proof:
+        std::vector<crypto::public_key> pubkeys;
+        std::vector<uint64_t> timestamps;  // The proofs' own timestamps
+        std::vector<crypto::hash> hashes;  // keccak of the serialized proof (i.e. its proof_hash)
+
+        KV_MAP_SERIALIZABLE_BINARY
+    };
+};
+
+struct NOTIFY_REQUEST_UPTIME_PROOFS {
+    const static int ID = BC_COMMANDS_POOL_BASE + 20;
+
+    struct request {
+        std::vector<crypto::hash> hashes;
+
+        KV_MAP_SERIALIZABLE_BINARY
     };
 };
 
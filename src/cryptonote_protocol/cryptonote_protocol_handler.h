@@ -37,8 +37,10 @@
 #include <boost/circular_buffer.hpp>
 #include <boost/program_options/variables_map.hpp>
 #include <chrono>
+#include <deque>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 
 #include "block_queue.h"
 #include "common/meta.h"
@@ -75,7 +77,11 @@ class t_cryptonote_protocol_handler : public i_cryptonote_protocol {
     HANDLE_NOTIFY_T2(NOTIFY_RESPONSE_CHAIN_ENTRY, handle_response_chain_entry)
     HANDLE_NOTIFY_T2(NOTIFY_NEW_FLUFFY_BLOCK, handle_notify_new_fluffy_block)
     HANDLE_NOTIFY_T2(NOTIFY_REQUEST_FLUFFY_MISSING_TX, handle_request_fluffy_missing_tx)
+    HANDLE_NOTIFY_T2(NOTIFY_NEW_COMPACT_BLOCK, handle_notify_new_compact_block)
+    HANDLE_NOTIFY_T2(NOTIFY_TX_ANNOUNCE, handle_notify_tx_announce)
     HANDLE_NOTIFY_T2(NOTIFY_BTENCODED_UPTIME_PROOF, handle_uptime_proof)
+    HANDLE_NOTIFY_T2(NOTIFY_UPTIME_PROOF_ANNOUNCE, handle_notify_uptime_proof_announce)
+    HANDLE_NOTIFY_T2(NOTIFY_REQUEST_UPTIME_PROOFS, handle_request_uptime_proofs)
     HANDLE_NOTIFY_T2(NOTIFY_NEW_SERVICE_NODE_VOTE, handle_notify_new_service_node_vote)
     HANDLE_NOTIFY_T2(NOTIFY_REQUEST_BLOCK_BLINKS, handle_request_block_blinks)
     HANDLE_NOTIFY_T2(NOTIFY_RESPONSE_BLOCK_BLINKS, handle_response_block_blinks)
@@ -123,6 +129,10 @@ class t_cryptonote_protocol_handler : public i_cryptonote_protocol {
             int command,
             NOTIFY_REQUEST_GET_TXS::request& arg,
             cryptonote_connection_context& context);
+    int handle_notify_tx_announce(
+            int command,
+            NOTIFY_TX_ANNOUNCE::request& arg,
+            cryptonote_connection_context& context);
     int handle_request_chain(
             int command,
             NOTIFY_REQUEST_CHAIN::request& arg,
@@ -139,10 +149,22 @@ class t_cryptonote_protocol_handler : public i_cryptonote_protocol {
             int command,
             NOTIFY_REQUEST_FLUFFY_MISSING_TX::request& arg,
             cryptonote_connection_context& context);
+    int handle_notify_new_compact_block(
+            int command,
+            NOTIFY_NEW_COMPACT_BLOCK::request& arg,
+            cryptonote_connection_context& context);
     int handle_uptime_proof(
             int command,
             NOTIFY_BTENCODED_UPTIME_PROOF::request& arg,
             cryptonote_connection_context& context);
+    int handle_notify_uptime_proof_announce(
+            int command,
+            NOTIFY_UPTIME_PROOF_ANNOUNCE::request& arg,
+            cryptonote_connection_context& context);
+    int handle_request_uptime_proofs(
+            int command,
+            NOTIFY_REQUEST_UPTIME_PROOFS::request& arg,
+            cryptonote_connection_context& context);
     int handle_notify_new_service_node_vote(
             int command,
             NOTIFY_NEW_SERVICE_NODE_VOTE::request& arg,
@@ -189,11 +211,37 @@ class t_cryptonote_protocol_handler : public i_cryptonote_protocol {
 
     virtual bool relay_block(
             NOTIFY_NEW_FLUFFY_BLOCK::request& arg, cryptonote_connection_context& exclude_context);
+    // Relays a block; peers that support compact blocks get a NOTIFY_NEW_COMPACT_BLOCK in which
+    // the txs in `prefill` (typically the ones we didn't have ourselves when the block arrived)
+    // are sent in full, everyone else gets the fluffy block.
+    bool relay_block(
+            NOTIFY_NEW_FLUFFY_BLOCK::request& arg,
+            cryptonote_connection_context& exclude_context,
+            const std::unordered_set<crypto::hash>& prefill);
+    bool make_compact_block(
+            const NOTIFY_NEW_FLUFFY_BLOCK::request& arg,
+            const std::unordered_set<crypto::hash>& prefill,
+            NOTIFY_NEW_COMPACT_BLOCK::request& compact);
+    // Adds a fluffy/compact block for which we have all the txs and relays it on success.  The
+    // miner must be paused on entry; it is resumed before returning.
+    int add_complete_fluffy_block(
+            block_complete_entry&& b,
+            uint64_t current_blockchain_height,
+            const std::unordered_set<crypto::hash>& prefill,
+            cryptonote_connection_context& context);
     virtual bool relay_transactions(
             NOTIFY_NEW_TRANSACTIONS::request& arg, cryptonote_connection_context& exclude_context);
     virtual bool relay_uptime_proof(
             NOTIFY_BTENCODED_UPTIME_PROOF::request& arg,
             cryptonote_connection_context& exclude_context);
+    // Relays an uptime proof with the given proof hash: peers that support proof announcements get
+    // a NOTIFY_UPTIME_PROOF_ANNOUNCE, everyone else the full proof.  `handled` should be true if
+    // the proof has been accepted by core::handle_uptime_proof.
+    bool relay_uptime_proof(
+            NOTIFY_BTENCODED_UPTIME_PROOF::request& arg,
+            cryptonote_connection_context& exclude_context,
+            const crypto::hash& proof_hash,
+            bool handled);
     virtual bool relay_service_node_votes(
             NOTIFY_NEW_SERVICE_NODE_VOTE::request& arg,
             cryptonote_connection_context& exclude_context);
@@ -235,6 +283,8 @@ class t_cryptonote_protocol_handler : public i_cryptonote_protocol {
     std::chrono::steady_clock::time_point m_last_add_end_time;
     uint64_t m_sync_spans_downloaded, m_sync_old_spans_downloaded, m_sync_bad_spans_downloaded;
     uint64_t m_sync_download_chain_size, m_sync_download_objects_size;
+    // Time spent adding synced spans, and the part of it spent batch parsing/verifying their txs
+    std::chrono::nanoseconds m_sync_process_time, m_sync_verify_time;
     size_t m_block_download_max_size;
 
     // Values for sync time estimates
@@ -247,6 +297,50 @@ class t_cryptonote_protocol_handler : public i_cryptonote_protocol {
     std::string get_periodic_sync_estimate(
             uint64_t current_blockchain_height, uint64_t target_blockchain_height);
 
+    // Announced txs we have requested from some peer, so that we don't fetch the same tx from
+    // every peer that announces it while the first request is still outstanding.  The other peers
+    // that announced the tx are remembered so that we can ask the next one of them if the request
+    // times out.
+    struct tx_announce_request {
+        std::chrono::steady_clock::time_point requested;
+        boost::uuids::uuid requested_from;
+        std::deque<boost::uuids::uuid> announcers;
+    };
+    std::mutex m_tx_announce_mutex;
+    std::unordered_map<crypto::hash, tx_announce_request> m_tx_announce_requests;
+    tools::periodic_task m_tx_announce_retrier{"tx announce retry", 1s};
+    bool retry_tx_announce_requests();
+    // Records that we are requesting `txs` from the peer, dropping any beyond the number of
+    // outstanding requests we allow per peer.
+    static void add_requested_txs(
+            cryptonote_connection_context& context,
+            std::vector<crypto::hash>& txs,
+            std::chrono::steady_clock::time_point now);
+    static size_t requested_txs_room(
+            cryptonote_connection_context& context, std::chrono::steady_clock::time_point now);
+
+    // Uptime proofs we have relayed recently, keyed by proof hash, so that we can serve them to the
+    // peers we announced them to.  Each announcement is good for one request of the proof, so a
+    // peer can't get proofs out of us that we didn't announce to it, nor the same one repeatedly.
+    // Further copies of a `handled` proof (i.e. one that core has already accepted) get dropped
+    // before being parsed.  Our own proofs start out unhandled so that we still accept the copy our
+    // peers relay back to us as confirmation.
+    struct recent_uptime_proof {
+        NOTIFY_BTENCODED_UPTIME_PROOF::request proof;
+        crypto::public_key pubkey;
+        uint64_t timestamp;
+        bool handled;
+        std::vector<boost::uuids::uuid> announced_to;  // Connections yet to request it
+    };
+    std::mutex m_proof_announce_mutex;
+    std::unordered_map<crypto::hash, recent_uptime_proof> m_recent_proofs;
+    std::deque<std::pair<std::chrono::steady_clock::time_point, crypto::hash>>
+            m_recent_proofs_added;  // insertion order, for expiry
+    // Announced proofs we have requested from some peer, so that we don't fetch the same proof
+    // from every peer that announces it.
+    std::unordered_map<crypto::hash, std::chrono::steady_clock::time_point>
+            m_proof_announce_requests;
+
     std::mutex m_buffer_mutex;
     boost::circular_buffer<size_t> m_avg_buffer = boost::circular_buffer<size_t>(10);
 
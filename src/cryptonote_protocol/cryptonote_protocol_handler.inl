@@ -38,18 +38,22 @@
 
 #include <boost/uuid/uuid_io.hpp>
 #include <boost/uuid/nil_generator.hpp>
+#include <algorithm>
 #include <list>
 #include <ctime>
 #include <chrono>
+#include <span>
 #include <fmt/core.h>
 
 #include "cryptonote_protocol/cryptonote_protocol_handler.h"
+#include "cryptonote_protocol/compact_block.h"
 #include "common/string_util.h"
 #include "cryptonote_basic/cryptonote_format_utils.h"
 #include "cryptonote_basic/hardfork.h"
 #include "cryptonote_basic/verification_context.h"
 #include "cryptonote_core/cryptonote_core.h"
 #include "cryptonote_core/tx_pool.h"
+#include "cryptonote_core/uptime_proof.h"
 #include "epee/net/network_throttle-detail.hpp"
 #include "common/pruning.h"
 #include "common/random.h"
@@ -96,6 +100,7 @@ namespace cryptonote
     m_sync_bad_spans_downloaded = 0;
     m_sync_download_chain_size = 0;
     m_sync_download_objects_size = 0;
+    m_sync_process_time = m_sync_verify_time = 0ns;
 
     m_block_download_max_size = command_line::get_arg(vm, cryptonote::arg_block_download_max_size);
 
@@ -278,6 +283,8 @@ namespace cryptonote
 
       cnx.recv_count = cntxt.m_recv_cnt;
       cnx.send_count = cntxt.m_send_cnt;
+      cnx.handled_count = cntxt.m_handled_cnt;
+      cnx.handler_cpu_time = cntxt.m_handler_cpu_time;
 
       cnx.state = get_protocol_state_string(cntxt.m_state);
 
@@ -349,6 +356,7 @@ namespace cryptonote
 
     context.m_remote_blockchain_height = hshd.current_height;
     context.m_pruning_seed = hshd.pruning_seed;
+    context.m_support_flags = hshd.support_flags;
     if constexpr (PRUNING_DEBUG_SPOOF_SEED) {
       context.m_pruning_seed = tools::make_pruning_seed(1 + (context.m_remote_address.as<epee::net_utils::ipv4_network_address>().ip()) % (1 << PRUNING_LOG_STRIPES), PRUNING_LOG_STRIPES);
       log::info(logcat, "{}New connection posing as pruning seed {:08x}", context, context.m_pruning_seed);
@@ -468,6 +476,7 @@ namespace cryptonote
         m_sync_bad_spans_downloaded = 0;
         m_sync_download_chain_size = 0;
         m_sync_download_objects_size = 0;
+        m_sync_process_time = m_sync_verify_time = 0ns;
       }
       m_core.set_target_blockchain_height((hshd.current_height));
     }
@@ -509,6 +518,7 @@ namespace cryptonote
     hshd.cumulative_difficulty = m_core.blockchain.db().get_block_cumulative_difficulty(hshd.current_height);
     hshd.current_height +=1;
     hshd.pruning_seed = m_core.blockchain.get_blockchain_pruning_seed();
+    hshd.support_flags = cryptonote::p2p::SUPPORT_FLAGS;
     auto our_blink_hashes = m_core.mempool.get_blink_checksums();
     hshd.blink_blocks.reserve(our_blink_hashes.size());
     hshd.blink_hash.reserve(our_blink_hashes.size());
@@ -577,6 +587,10 @@ namespace cryptonote
       // Also, remember to pepper some whitespace changes around to bother
       // moneromooo ... only because I <3 him. 
       std::vector<uint64_t> need_tx_indices;
+
+      // Txs the peer had to send us in full; they are probably missing from other peers' pools too,
+      // so we prefill them when relaying this block on as a compact block.
+      std::unordered_set<crypto::hash> prefill;
         
       transaction tx;
       crypto::hash tx_hash;
@@ -629,6 +643,7 @@ namespace cryptonote
           if(!m_core.mempool.have_tx(tx_hash))
           {
             log::debug(logcat, "Incoming tx {} not in pool, adding", tx_hash);
+            prefill.insert(tx_hash);
             cryptonote::tx_verification_context tvc{};
             if(!m_core.handle_incoming_tx(tx_blob, tvc, tx_pool_options::from_block()) || tvc.m_verifivation_failed)
             {
@@ -726,54 +741,8 @@ namespace cryptonote
 
         block_complete_entry b = {};
         b.block                = arg.b.block;
-        b.txs                  = have_tx;
-
-        std::vector<block_complete_entry> blocks;
-        blocks.push_back(b);
-
-
-        std::vector<block> pblocks;
-        if (!m_core.prepare_handle_incoming_blocks(blocks, pblocks))
-        {
-          log::warning(logcat, "Failure in prepare_handle_incoming_blocks");
-          m_core.miner.resume();
-          return 1;
-        }
-
-        block_verification_context bvc{};
-        m_core.handle_incoming_block(arg.b.block, pblocks.empty() ? NULL : &pblocks[0], bvc, nullptr /*checkpoint*/); // got block from handle_notify_new_block
-        if (!m_core.cleanup_handle_incoming_blocks(true))
-        {
-          log::warning(logcat, "Failure in cleanup_handle_incoming_blocks");
-          m_core.miner.resume();
-          return 1;
-        }
-        m_core.miner.resume();
-
-        if( bvc.m_verifivation_failed )
-        {
-          log::warning(logcat, "Block verification failed, dropping connection");
-          drop_connection(context, true, false);
-          return 1;
-        }
-        if( bvc.m_added_to_main_chain )
-        {
-          //TODO: Add here announce protocol usage
-          NOTIFY_NEW_FLUFFY_BLOCK::request reg_arg{};
-          reg_arg.current_blockchain_height = arg.current_blockchain_height;
-          reg_arg.b = b;
-          relay_block(reg_arg, context);
-        }
-        else if( bvc.m_marked_as_orphaned )
-        {
-          context.m_needed_objects.clear();
-          context.m_state = cryptonote_connection_context::state_synchronizing;
-          NOTIFY_REQUEST_CHAIN::request r{};
-          m_core.blockchain.get_short_chain_history(r.block_ids);
-          log::info(log::Cat("net.p2p.msg"), "-->>NOTIFY_REQUEST_CHAIN: m_block_ids.size()={}", r.block_ids.size());
-          post_notify<NOTIFY_REQUEST_CHAIN>(r, context);
-          log::debug(logcat, "{}[{}] state: {} in state {}", context, epee::string_tools::to_string_hex(context.m_pruning_seed), "requesting chain", cryptonote::get_protocol_state_string(context.m_state));
-        }            
+        b.txs                  = std::move(have_tx);
+        return add_complete_fluffy_block(std::move(b), arg.current_blockchain_height, prefill, context);
       }
     } 
     else
@@ -788,6 +757,57 @@ namespace cryptonote
         
     return 1;
   }  
+  //------------------------------------------------------------------------------------------------------------------------
+  template<class t_core>
+  int t_cryptonote_protocol_handler<t_core>::add_complete_fluffy_block(block_complete_entry&& b, uint64_t current_blockchain_height, const std::unordered_set<crypto::hash>& prefill, cryptonote_connection_context& context)
+  {
+    std::vector<block_complete_entry> blocks;
+    blocks.push_back(b);
+
+    std::vector<block> pblocks;
+    if (!m_core.prepare_handle_incoming_blocks(blocks, pblocks))
+    {
+      log::warning(logcat, "Failure in prepare_handle_incoming_blocks");
+      m_core.miner.resume();
+      return 1;
+    }
+
+    block_verification_context bvc{};
+    m_core.handle_incoming_block(b.block, pblocks.empty() ? NULL : &pblocks[0], bvc, nullptr /*checkpoint*/); // got block from handle_notify_new_block
+    if (!m_core.cleanup_handle_incoming_blocks(true))
+    {
+      log::warning(logcat, "Failure in cleanup_handle_incoming_blocks");
+      m_core.miner.resume();
+      return 1;
+    }
+    m_core.miner.resume();
+
+    if( bvc.m_verifivation_failed )
+    {
+      log::warning(logcat, "Block verification failed, dropping connection");
+      drop_connection(context, true, false);
+      return 1;
+    }
+    if( bvc.m_added_to_main_chain )
+    {
+      //TODO: Add here announce protocol usage
+      NOTIFY_NEW_FLUFFY_BLOCK::request reg_arg{};
+      reg_arg.current_blockchain_height = current_blockchain_height;
+      reg_arg.b = std::move(b);
+      relay_block(reg_arg, context, prefill);
+    }
+    else if( bvc.m_marked_as_orphaned )
+    {
+      context.m_needed_objects.clear();
+      context.m_state = cryptonote_connection_context::state_synchronizing;
+      NOTIFY_REQUEST_CHAIN::request r{};
+      m_core.blockchain.get_short_chain_history(r.block_ids);
+      log::info(log::Cat("net.p2p.msg"), "-->>NOTIFY_REQUEST_CHAIN: m_block_ids.size()={}", r.block_ids.size());
+      post_notify<NOTIFY_REQUEST_CHAIN>(r, context);
+      log::debug(logcat, "{}[{}] state: {} in state {}", context, epee::string_tools::to_string_hex(context.m_pruning_seed), "requesting chain", cryptonote::get_protocol_state_string(context.m_state));
+    }
+    return 1;
+  }
   //------------------------------------------------------------------------------------------------------------------------  
   template<class t_core>
   int t_cryptonote_protocol_handler<t_core>::handle_uptime_proof(int command, NOTIFY_BTENCODED_UPTIME_PROOF::request& arg, cryptonote_connection_context& context)
@@ -804,7 +824,19 @@ namespace cryptonote
     // submitted automatically by the daemon itself instead of
     // using my own proof relayed by other nodes.
 
-    (void)context;
+    // Peers without announcement support flood every proof to us, so drop the copies of proofs
+    // we have already accepted before parsing them (and checking their signatures) again.
+    const auto proof_hash = crypto::keccak(arg.proof);
+    {
+      std::lock_guard lock{m_proof_announce_mutex};
+      m_proof_announce_requests.erase(proof_hash);
+      if (auto it = m_recent_proofs.find(proof_hash); it != m_recent_proofs.end() && it->second.handled)
+      {
+        log::debug(logcat, "{}Ignoring uptime proof {} that we have already handled", context, proof_hash);
+        return 1;
+      }
+    }
+
     bool my_uptime_proof_confirmation = false;
 
     if (m_core.handle_uptime_proof(arg, my_uptime_proof_confirmation))
@@ -816,11 +848,121 @@ namespace cryptonote
         // peer they relayed to received their uptime and confirm it, so send in an
         // empty context so we don't omit the source peer from the relay back.
         cryptonote_connection_context empty_context = {};
-        relay_uptime_proof(arg, empty_context);
+        relay_uptime_proof(arg, empty_context, proof_hash, true);
+      }
+      else
+      {
+        std::lock_guard lock{m_proof_announce_mutex};
+        if (auto it = m_recent_proofs.find(proof_hash); it != m_recent_proofs.end())
+          it->second.handled = true;
       }
     }
     return 1;
   }
+  //------------------------------------------------------------------------------------------------------------------------
+  template<class t_core>
+  int t_cryptonote_protocol_handler<t_core>::handle_notify_uptime_proof_announce(int command, NOTIFY_UPTIME_PROOF_ANNOUNCE::request& arg, cryptonote_connection_context& context)
+  {
+    log::info(log::Cat("net.p2p.msg"), "Received NOTIFY_UPTIME_PROOF_ANNOUNCE ({} proofs)", arg.hashes.size());
+
+    if (context.m_state != cryptonote_connection_context::state_normal)
+      return 1;
+    if (!is_synchronized() || m_no_sync)
+    {
+      log::debug(logcat, "{}Received uptime proof announcement while syncing, ignored", context);
+      return 1;
+    }
+    if (arg.hashes.size() > cryptonote::p2p::PROOF_ANNOUNCE_MAX_COUNT || arg.pubkeys.size() != arg.hashes.size() || arg.timestamps.size() != arg.hashes.size())
+    {
+      log::error(logcat, "{}Invalid uptime proof announcement ({} hashes, {} pubkeys, {} timestamps), dropping connection", context, arg.hashes.size(), arg.pubkeys.size(), arg.timestamps.size());
+      drop_connection(context, false, false);
+      return 1;
+    }
+
+    // Check the service node list first, without holding our own lock, for proofs that could
+    // actually update it.
+    std::vector<crypto::hash> wanted;
+    for (size_t i = 0; i < arg.hashes.size(); i++)
+      if (m_core.want_uptime_proof(arg.pubkeys[i], arg.timestamps[i]))
+        wanted.push_back(arg.hashes[i]);
+    if (wanted.empty())
+      return 1;
+
+    NOTIFY_REQUEST_UPTIME_PROOFS::request req;
+    {
+      const auto now = std::chrono::steady_clock::now();
+      std::lock_guard lock{m_proof_announce_mutex};
+      if (m_proof_announce_requests.size() > cryptonote::p2p::PROOF_ANNOUNCE_MAX_COUNT)
+      {
+        for (auto it = m_proof_announce_requests.begin(); it != m_proof_announce_requests.end(); )
+        {
+          if (now - it->second > cryptonote::p2p::PROOF_ANNOUNCE_REQUEST_TIMEOUT)
+            it = m_proof_announce_requests.erase(it);
+          else
+            ++it;
+        }
+      }
+
+      for (const auto& proof_hash : wanted)
+      {
+        if (auto it = m_recent_proofs.find(proof_hash); it != m_recent_proofs.end() && it->second.handled)
+          continue;
+        auto [it, inserted] = m_proof_announce_requests.emplace(proof_hash, now);
+        if (!inserted)
+        {
+          if (now - it->second <= cryptonote::p2p::PROOF_ANNOUNCE_REQUEST_TIMEOUT)
+            continue; // Already asked someone else for it
+          it->second = now;
+        }
+        req.hashes.push_back(proof_hash);
+      }
+    }
+
+    if (req.hashes.empty())
+      return 1;
+
+    log::info(log::Cat("net.p2p.msg"), "-->>NOTIFY_REQUEST_UPTIME_PROOFS: requesting {} of {} announced proofs", req.hashes.size(), arg.hashes.size());
+    post_notify<NOTIFY_REQUEST_UPTIME_PROOFS>(req, context);
+    return 1;
+  }
+  //------------------------------------------------------------------------------------------------------------------------
+  template<class t_core>
+  int t_cryptonote_protocol_handler<t_core>::handle_request_uptime_proofs(int command, NOTIFY_REQUEST_UPTIME_PROOFS::request& arg, cryptonote_connection_context& context)
+  {
+    log::info(log::Cat("net.p2p.msg"), "Received NOTIFY_REQUEST_UPTIME_PROOFS ({} proofs)", arg.hashes.size());
+
+    if (arg.hashes.size() > cryptonote::p2p::PROOF_ANNOUNCE_MAX_COUNT)
+    {
+      log::error(logcat, "{}Requested uptime proofs count is too big ({}) expected not more than {}", context, arg.hashes.size(), cryptonote::p2p::PROOF_ANNOUNCE_MAX_COUNT);
+      drop_connection(context, false, false);
+      return 1;
+    }
+
+    // We only serve proofs we announced to this peer, once each.  Proofs we no longer have
+    // (because they have expired from m_recent_proofs) are silently skipped: by then the peer will
+    // have got them from elsewhere, or they are stale anyway.
+    std::vector<NOTIFY_BTENCODED_UPTIME_PROOF::request> proofs;
+    {
+      std::lock_guard lock{m_proof_announce_mutex};
+      for (const auto& proof_hash : arg.hashes)
+      {
+        auto it = m_recent_proofs.find(proof_hash);
+        if (it == m_recent_proofs.end())
+          continue;
+        auto& announced_to = it->second.announced_to;
+        if (auto conn = std::find(announced_to.begin(), announced_to.end(), context.m_connection_id); conn != announced_to.end())
+        {
+          announced_to.erase(conn);
+          proofs.push_back(it->second.proof);
+        }
+      }
+    }
+
+    log::info(log::Cat("net.p2p.msg"), "-->>NOTIFY_BTENCODED_UPTIME_PROOF: sending {} of {} requested proofs", proofs.size(), arg.hashes.size());
+    for (auto& proof : proofs)
+      post_notify<NOTIFY_BTENCODED_UPTIME_PROOF>(proof, context);
+    return 1;
+  }
 
   //------------------------------------------------------------------------------------------------------------------------  
   template<class t_core>
@@ -920,9 +1062,10 @@ namespace cryptonote
       }
     }
 
-    std::vector<cryptonote::transaction> txs;
+    // Send the stored blobs as-is rather than parsing and re-serializing every tx
+    std::vector<std::string> txs;
     std::unordered_set<crypto::hash> missed;
-    if (!m_core.blockchain.get_transactions(txids, txs, &missed))
+    if (!m_core.blockchain.get_transactions_blobs(txids, txs, &missed))
     {
       log::error(logcat, "Failed to handle request NOTIFY_REQUEST_FLUFFY_MISSING_TX, failed to get requested transactions");
       drop_connection(context, false, false);
@@ -935,28 +1078,177 @@ namespace cryptonote
       return 1;
     }
 
-    for(auto& tx: txs)
-    {
-      fluffy_response.b.txs.push_back(t_serializable_object_to_blob(tx));
-    }
+    fluffy_response.b.txs = std::move(txs);
 
     log::info(log::Cat("net.p2p.msg"), "-->>NOTIFY_RESPONSE_FLUFFY_MISSING_TX: txs.size()={}, rsp.current_blockchain_height={}", fluffy_response.b.txs.size(), fluffy_response.current_blockchain_height);
            
     post_notify<NOTIFY_NEW_FLUFFY_BLOCK>(fluffy_response, context);    
     return 1;        
   }
+  //------------------------------------------------------------------------------------------------------------------------
+  template<class t_core>
+  int t_cryptonote_protocol_handler<t_core>::handle_notify_new_compact_block(int command, NOTIFY_NEW_COMPACT_BLOCK::request& arg, cryptonote_connection_context& context)
+  {
+    log::info(log::Cat("net.p2p.msg"), "Received NOTIFY_NEW_COMPACT_BLOCK {} (height {}, {} prefilled txes)", arg.block_hash, arg.current_blockchain_height, arg.prefilled_txs.size());
+
+    if(context.m_state != cryptonote_connection_context::state_normal)
+      return 1;
+    if(!is_synchronized() || m_no_sync)
+    {
+      log::debug(logcat, "{}Received new block while syncing, ignored", context);
+      return 1;
+    }
+
+    auto short_ids = compact_block::unpack_short_ids(arg.short_ids);
+    if (!short_ids || arg.prefilled_indices.size() != arg.prefilled_txs.size())
+    {
+      log::error(logcat, "NOTIFY_NEW_COMPACT_BLOCK: invalid short id/prefilled tx data, dropping connection");
+      drop_connection(context, false, false);
+      return 1;
+    }
+
+    block new_block;
+    if (!parse_and_validate_block_from_blob(arg.block, new_block) || !new_block.tx_hashes.empty())
+    {
+      log::error(logcat, "sent wrong compact block: failed to parse and validate block: {}, dropping connection", oxenc::to_hex(arg.block));
+      drop_connection(context, false, false);
+      return 1;
+    }
+
+    // We will usually get the same block from several peers; don't bother reconstructing it again
+    if (m_core.blockchain.have_block(arg.block_hash))
+      return 1;
+
+    const size_t tx_count = short_ids->size() + arg.prefilled_indices.size();
+    for (size_t i = 0; i < arg.prefilled_indices.size(); i++)
+    {
+      if (arg.prefilled_indices[i] >= tx_count || (i > 0 && arg.prefilled_indices[i] <= arg.prefilled_indices[i - 1]))
+      {
+        log::error(logcat, "NOTIFY_NEW_COMPACT_BLOCK: invalid prefilled tx index {}, dropping connection", arg.prefilled_indices[i]);
+        drop_connection(context, false, false);
+        return 1;
+      }
+    }
+
+    m_core.miner.pause();
+
+    std::vector<crypto::hash> pool_hashes;
+    m_core.mempool.get_transaction_hashes(pool_hashes);
+    auto matched = compact_block::match_short_ids(compact_block::make_short_id_key(arg.block_hash, arg.salt), *short_ids, pool_hashes);
+
+    std::vector<std::optional<crypto::hash>> tx_hashes;
+    tx_hashes.reserve(tx_count);
+    std::unordered_set<crypto::hash> prefill;
+    auto matched_it = matched.begin();
+    for (size_t i = 0, p = 0; i < tx_count; i++)
+    {
+      if (p == arg.prefilled_indices.size() || arg.prefilled_indices[p] != i)
+      {
+        tx_hashes.push_back(*matched_it++);
+        continue;
+      }
+
+      const auto& tx_blob = arg.prefilled_txs[p++];
+      transaction tx;
+      crypto::hash tx_hash;
+      if (!parse_and_validate_tx_from_blob(tx_blob, tx, tx_hash))
+      {
+        log::error(logcat, "sent wrong tx: failed to parse and validate transaction: {}, dropping connection", oxenc::to_hex(tx_blob));
+        drop_connection(context, false, false);
+        m_core.miner.resume();
+        return 1;
+      }
+      if (!m_core.mempool.have_tx(tx_hash))
+      {
+        log::debug(logcat, "Incoming prefilled tx {} not in pool, adding", tx_hash);
+        prefill.insert(tx_hash);
+        cryptonote::tx_verification_context tvc{};
+        if (!m_core.handle_incoming_tx(tx_blob, tvc, tx_pool_options::from_block()) || tvc.m_verifivation_failed)
+        {
+          log::info(logcat, "Block verification failed: transaction verification failed, dropping connection");
+          drop_connection(context, false, false);
+          m_core.miner.resume();
+          return 1;
+        }
+      }
+      tx_hashes.push_back(tx_hash);
+    }
+
+    // Only once every short id resolved can we check the reconstruction against the block hash; if
+    // anything is missing we let the peer send us the full block plus whatever we lack via the
+    // regular fluffy path, which redoes the lookups with the real tx hashes.
+    std::vector<std::string> have_tx;
+    have_tx.reserve(tx_count);
+    bool complete = std::all_of(tx_hashes.begin(), tx_hashes.end(), [](const auto& h) { return h.has_value(); });
+    if (complete)
+    {
+      new_block.tx_hashes.reserve(tx_count);
+      for (const auto& h : tx_hashes)
+        new_block.tx_hashes.push_back(*h);
+      new_block.invalidate_hashes();
+      if (get_block_hash(new_block) != arg.block_hash)
+      {
+        log::debug(logcat, "Compact block {} reconstruction mismatch (short id collision?), requesting all non-prefilled txes", arg.block_hash);
+        complete = false;
+        // We can't tell which short id collided, so ask for every tx the peer didn't prefill
+        for (size_t i = 0, p = 0; i < tx_count; i++)
+        {
+          if (p < arg.prefilled_indices.size() && arg.prefilled_indices[p] == i)
+            p++;
+          else
+            tx_hashes[i].reset();
+        }
+      }
+    }
+    if (complete)
+    {
+      for (size_t i = 0; i < tx_count; i++)
+      {
+        std::string txblob;
+        if (m_core.mempool.get_transaction(new_block.tx_hashes[i], txblob))
+          have_tx.push_back(std::move(txblob));
+        else
+        {
+          // Could have just left the pool (e.g. mined into a competing block); make it missing
+          complete = false;
+          tx_hashes[i].reset();
+        }
+      }
+    }
+
+    if (!complete)
+    {
+      NOTIFY_REQUEST_FLUFFY_MISSING_TX::request missing_tx_req;
+      missing_tx_req.block_hash = arg.block_hash;
+      missing_tx_req.current_blockchain_height = arg.current_blockchain_height;
+      for (size_t i = 0; i < tx_hashes.size(); i++)
+        if (!tx_hashes[i])
+          missing_tx_req.missing_tx_indices.push_back(i);
+
+      m_core.miner.resume();
+      log::debug(logcat, "We are missing {} of {} txes for compact block {}", missing_tx_req.missing_tx_indices.size(), tx_count, arg.block_hash);
+      log::info(log::Cat("net.p2p.msg"), "-->>NOTIFY_REQUEST_FLUFFY_MISSING_TX: missing_tx_indices.size()={}", missing_tx_req.missing_tx_indices.size());
+      post_notify<NOTIFY_REQUEST_FLUFFY_MISSING_TX>(missing_tx_req, context);
+      return 1;
+    }
+
+    log::debug(logcat, "Reconstructed compact block {} ({} txes, {} prefilled)", arg.block_hash, tx_count, arg.prefilled_txs.size());
+
+    block_complete_entry b = {};
+    b.block                = block_to_blob(new_block);
+    b.txs                  = std::move(have_tx);
+    return add_complete_fluffy_block(std::move(b), arg.current_blockchain_height, prefill, context);
+  }
   //------------------------------------------------------------------------------------------------------------------------  
   template<class t_core>
   int t_cryptonote_protocol_handler<t_core>::handle_notify_new_transactions(int command, NOTIFY_NEW_TRANSACTIONS::request& arg, cryptonote_connection_context& context)
   {
     log::info(log::Cat("net.p2p.msg"), "Received NOTIFY_NEW_TRANSACTIONS ({} txes w/ {} blinks)", arg.txs.size(), arg.blinks.size());
-    for (const auto &blob: arg.txs)
-      if(logcat->should_log(log::Level::info))
+    if(logcat->should_log(log::Level::info))
+      for (const auto &blob: arg.txs)
       {
-        cryptonote::transaction tx;
         crypto::hash hash;
-        bool ret = cryptonote::parse_and_validate_tx_from_blob(blob, tx, hash);
-        if (ret)
+        if (cryptonote::calculate_transaction_hash_from_blob(blob, hash))
           log::info(log::Cat("net.p2p.msg"), "Including transaction {}", hash);
       }
 
@@ -1003,7 +1295,12 @@ namespace cryptonote
       auto &unknown_txs = parsed_blinks.second;
       for (size_t i = 0; i < arg.txs.size(); ++i)
       {
-        if (parsed_txs[i].tvc.m_should_be_relayed)
+        bool relay = parsed_txs[i].tvc.m_should_be_relayed;
+        // Requested txs are normally ones we missed and don't get relayed, except for the ones we
+        // fetched in response to a tx announcement: those are new and need to propagate.
+        if (arg.requested)
+          relay = context.m_requested_txs.erase(parsed_txs[i].tx_hash) > 0 && relay;
+        if (relay)
           newtxs.push_back(std::move(arg.txs[i]));
 
         if (parsed_txs[i].tvc.m_added_to_pool || parsed_txs[i].already_have)
@@ -1039,9 +1336,9 @@ namespace cryptonote
       }
     }
 
-    // If this is a response to a request for txes that we sent (.requested) then don't relay this
-    // on to our peers because they probably already have it: we just missed it somehow.
-    if(arg.txs.size() && !arg.requested)
+    // If this is a response to a request for txes that we sent (.requested) then we only kept the
+    // announced ones above: the rest we just missed somehow and our peers probably already have.
+    if(arg.txs.size())
     {
       //TODO: add announce usage here
       relay_transactions(arg, context);
@@ -1403,6 +1700,14 @@ namespace cryptonote
             auto block_process_time_full = 0ns;
             auto transactions_process_time_full = 0ns;
             size_t num_txs = 0, blockidx = 0;
+
+            // Parse and check the txs of the whole span up front so that their signatures get
+            // batch verified together; each block's txs then get added just before the block.
+            auto transactions_parse_start = std::chrono::steady_clock::now();
+            auto span_parsed_txs = m_core.parse_incoming_block_txs(blocks);
+            auto transactions_parse_time = std::chrono::steady_clock::now() - transactions_parse_start;
+            transactions_process_time_full += transactions_parse_time;
+
             for(const block_complete_entry& block_entry: blocks)
             {
               if (m_stopping)
@@ -1410,18 +1715,19 @@ namespace cryptonote
 
               // process transactions
               auto transactions_process_start = std::chrono::steady_clock::now();
+              auto parsed_txs = std::span{span_parsed_txs}.subspan(num_txs, block_entry.txs.size());
               num_txs += block_entry.txs.size();
-              auto parsed_txs = m_core.handle_incoming_txs(block_entry.txs, tx_pool_options::from_block());
+              m_core.handle_parsed_block_txs(parsed_txs);
 
               for (size_t i = 0; i < parsed_txs.size(); ++i)
               {
                 if (parsed_txs[i].tvc.m_verifivation_failed)
                 {
                   if (!m_p2p->for_connection(span_connection_id, [&](cryptonote_connection_context& context, nodetool::peerid_type peer_id)->bool{
-                    cryptonote::transaction tx;
-                    parse_and_validate_tx_from_blob(block_entry.txs[i], tx); // must succeed if we got here
-                    log::error(logcat, "transaction verification failed on NOTIFY_RESPONSE_GET_BLOCKS, tx_id = {}, dropping connection",
-                            cryptonote::get_transaction_hash(tx));
+                    if (parsed_txs[i].parsed)
+                      log::error(logcat, "transaction verification failed on NOTIFY_RESPONSE_GET_BLOCKS, tx_id = {}, dropping connection", parsed_txs[i].tx_hash);
+                    else
+                      log::error(logcat, "transaction parsing failed on NOTIFY_RESPONSE_GET_BLOCKS, dropping connection");
                     drop_connection(context, false, true);
                     return 1;
                   }))
@@ -1483,12 +1789,15 @@ namespace cryptonote
             } // each download block
 
             remove_spans = true;
-            log::debug(logcat, "{}Block process time ({} blocks, {} txs): {} ({}/{})",
+            m_sync_process_time += block_process_time_full + transactions_process_time_full;
+            m_sync_verify_time += transactions_parse_time;
+            log::debug(logcat, "{}Block process time ({} blocks, {} txs): {} ({} [{} batch parse/verify]/{})",
                 context,
                 blocks.size(),
                 num_txs,
                 tools::friendly_duration(block_process_time_full + transactions_process_time_full),
                 tools::friendly_duration(transactions_process_time_full),
+                tools::friendly_duration(transactions_parse_time),
                 tools::friendly_duration(block_process_time_full));
           }
 
@@ -1620,9 +1929,164 @@ skip:
   }
   //------------------------------------------------------------------------------------------------------------------------
   template<class t_core>
+  int t_cryptonote_protocol_handler<t_core>::handle_notify_tx_announce(int command, NOTIFY_TX_ANNOUNCE::request& arg, cryptonote_connection_context& context)
+  {
+    log::info(log::Cat("net.p2p.msg"), "Received NOTIFY_TX_ANNOUNCE ({} txs)", arg.txs.size());
+
+    if (context.m_state != cryptonote_connection_context::state_normal)
+      return 1;
+    if (!is_synchronized() || m_no_sync)
+    {
+      log::debug(logcat, "{}Received tx announcement while syncing, ignored", context);
+      return 1;
+    }
+    if (arg.txs.size() > CURRENCY_PROTOCOL_MAX_TXS_REQUEST_COUNT)
+    {
+      log::error(logcat, "Announced txs count is too big ({}) expected not more than {}", arg.txs.size(), CURRENCY_PROTOCOL_MAX_TXS_REQUEST_COUNT);
+      drop_connection(context, false, false);
+      return 1;
+    }
+
+    std::vector<crypto::hash> wanted;
+    for (const auto& tx_hash : arg.txs)
+      if (!m_core.mempool.have_tx(tx_hash) && !m_core.blockchain.have_tx(tx_hash))
+        wanted.push_back(tx_hash);
+    if (wanted.empty())
+      return 1;
+
+    const auto now = std::chrono::steady_clock::now();
+    const size_t room = requested_txs_room(context, now);
+    NOTIFY_REQUEST_GET_TXS::request req;
+    {
+      std::lock_guard lock{m_tx_announce_mutex};
+      for (const auto& tx_hash : wanted)
+      {
+        auto it = m_tx_announce_requests.find(tx_hash);
+        if (it != m_tx_announce_requests.end() && now - it->second.requested <= cryptonote::p2p::TX_ANNOUNCE_REQUEST_TIMEOUT)
+        {
+          auto& request = it->second;
+          // Already asked someone else for it; remember this peer in case that request times out
+          auto& announcers = request.announcers;
+          if (request.requested_from != context.m_connection_id &&
+              announcers.size() < cryptonote::p2p::TX_ANNOUNCE_MAX_ANNOUNCERS &&
+              std::find(announcers.begin(), announcers.end(), context.m_connection_id) == announcers.end())
+            announcers.push_back(context.m_connection_id);
+          continue;
+        }
+        if (req.txs.size() >= room)
+          continue;
+        auto& request = m_tx_announce_requests[tx_hash];
+        request.requested = now;
+        request.requested_from = context.m_connection_id;
+        req.txs.push_back(tx_hash);
+      }
+    }
+
+    if (req.txs.empty())
+      return 1;
+
+    add_requested_txs(context, req.txs, now);
+    log::info(log::Cat("net.p2p.msg"), "-->>NOTIFY_REQUEST_GET_TXS: requesting {} of {} announced txs", req.txs.size(), arg.txs.size());
+    post_notify<NOTIFY_REQUEST_GET_TXS>(req, context);
+    return 1;
+  }
+  //------------------------------------------------------------------------------------------------------------------------
+  template<class t_core>
+  bool t_cryptonote_protocol_handler<t_core>::retry_tx_announce_requests()
+  {
+    // Announced txs that the peer we asked didn't send in time get requested from the next peer
+    // that announced them, or forgotten if we have them by now or nobody else announced them.
+    // The pool and chain lookups are done without holding m_tx_announce_mutex so that they don't
+    // hold up incoming announcements.
+    const auto now = std::chrono::steady_clock::now();
+    std::vector<crypto::hash> expired;
+    {
+      std::lock_guard lock{m_tx_announce_mutex};
+      for (const auto& [tx_hash, request] : m_tx_announce_requests)
+        if (now - request.requested > cryptonote::p2p::TX_ANNOUNCE_REQUEST_TIMEOUT)
+          expired.push_back(tx_hash);
+    }
+    if (expired.empty())
+      return true;
+
+    std::unordered_set<crypto::hash> have;
+    for (const auto& tx_hash : expired)
+      if (m_core.mempool.have_tx(tx_hash) || m_core.blockchain.have_tx(tx_hash))
+        have.insert(tx_hash);
+
+    std::map<boost::uuids::uuid, std::vector<crypto::hash>> retries;
+    {
+      std::lock_guard lock{m_tx_announce_mutex};
+      for (const auto& tx_hash : expired)
+      {
+        auto it = m_tx_announce_requests.find(tx_hash);
+        // Skip it if it was re-requested from a new announcer while we weren't holding the lock
+        if (it == m_tx_announce_requests.end() || now - it->second.requested <= cryptonote::p2p::TX_ANNOUNCE_REQUEST_TIMEOUT)
+          continue;
+        auto& request = it->second;
+        if (request.announcers.empty() || have.count(tx_hash))
+        {
+          m_tx_announce_requests.erase(it);
+          continue;
+        }
+        request.requested = now;
+        request.requested_from = request.announcers.front();
+        request.announcers.pop_front();
+        retries[request.requested_from].push_back(tx_hash);
+      }
+    }
+
+    for (auto& [connection_id, txs] : retries)
+    {
+      NOTIFY_REQUEST_GET_TXS::request req;
+      req.txs = std::move(txs);
+      bool sent = m_p2p->for_connection(connection_id, [&](cryptonote_connection_context& context, nodetool::peerid_type peer_id)->bool{
+        // Any we leave out for lack of room time out again and move on to the next announcer
+        add_requested_txs(context, req.txs, now);
+        if (req.txs.empty())
+          return true;
+        log::info(log::Cat("net.p2p.msg"), "-->>NOTIFY_REQUEST_GET_TXS: re-requesting {} announced txs", req.txs.size());
+        post_notify<NOTIFY_REQUEST_GET_TXS>(req, context);
+        return true;
+      });
+      if (!sent)
+      {
+        // That peer is gone; let the next check move straight on to the next announcer
+        std::lock_guard lock{m_tx_announce_mutex};
+        for (const auto& tx_hash : req.txs)
+          if (auto it = m_tx_announce_requests.find(tx_hash); it != m_tx_announce_requests.end())
+            it->second.requested -= cryptonote::p2p::TX_ANNOUNCE_REQUEST_TIMEOUT;
+      }
+    }
+    return true;
+  }
+  //------------------------------------------------------------------------------------------------------------------------
+  template<class t_core>
+  size_t t_cryptonote_protocol_handler<t_core>::requested_txs_room(cryptonote_connection_context& context, std::chrono::steady_clock::time_point now)
+  {
+    // Requests the peer hasn't answered in time are only kept so that a late reply still gets
+    // relayed; they are the first to go once the peer reaches the limit.
+    auto& requested = context.m_requested_txs;
+    if (requested.size() >= cryptonote::p2p::TX_ANNOUNCE_MAX_REQUESTED_PER_PEER)
+      std::erase_if(requested, [&](const auto& r) { return now - r.second > cryptonote::p2p::TX_ANNOUNCE_REQUEST_TIMEOUT; });
+    return cryptonote::p2p::TX_ANNOUNCE_MAX_REQUESTED_PER_PEER - std::min(requested.size(), cryptonote::p2p::TX_ANNOUNCE_MAX_REQUESTED_PER_PEER);
+  }
+  //------------------------------------------------------------------------------------------------------------------------
+  template<class t_core>
+  void t_cryptonote_protocol_handler<t_core>::add_requested_txs(cryptonote_connection_context& context, std::vector<crypto::hash>& txs, std::chrono::steady_clock::time_point now)
+  {
+    size_t room = requested_txs_room(context, now);
+    if (txs.size() > room)
+      txs.resize(room);
+    for (const auto& tx_hash : txs)
+      context.m_requested_txs.insert_or_assign(tx_hash, now);
+  }
+  //------------------------------------------------------------------------------------------------------------------------
+  template<class t_core>
   bool t_cryptonote_protocol_handler<t_core>::on_idle()
   {
     m_idle_peer_kicker.do_call([this] { return kick_idle_peers(); });
+    m_tx_announce_retrier.do_call([this] { return retry_tx_announce_requests(); });
     m_standby_checker.do_call([this] { return check_standby_peers(); });
     m_sync_search_checker.do_call([this] { return update_sync_search(); });
     return m_core.on_idle();
@@ -2237,6 +2701,7 @@ skip:
             synced_seconds = 1s;
           float blocks_per_second = synced_blocks / (float)synced_seconds.count();
           log::info(globallogcat, fg(fmt::terminal_color::yellow), "Synced {} blocks in {} ({} blocks per second)", synced_blocks, tools::get_human_readable_timespan(synced_seconds), blocks_per_second);
+          log::info(logcat, "{} synced block txs went straight to the blockchain without passing through the tx pool", m_core.get_block_txs_staged());
         }
       }
       log::info(globallogcat, fg(fmt::terminal_color::yellow) | fmt::emphasis::bold, R"(
@@ -2246,8 +2711,12 @@ You are now synchronized with the network.
       if (logcat->should_log(log::Level::info))
       {
         const std::chrono::duration<double> sync_time{std::chrono::steady_clock::now() - m_sync_timer};
-        log::info(logcat, fg(fmt::terminal_color::yellow), "Sync time: {:.1f} min, {:.1f} + {:.1f} MB downloaded, {:.2f}% old spans, {:.2f}% bad spans",
+        const std::chrono::duration<double> process_time{m_sync_process_time}, verify_time{m_sync_verify_time};
+        log::info(logcat, fg(fmt::terminal_color::yellow), "Sync time: {:.1f} min ({:.1f} min adding blocks, of which {:.1f} min batch verifying txs: {:.1f}% of sync time), {:.1f} + {:.1f} MB downloaded, {:.2f}% old spans, {:.2f}% bad spans",
             sync_time.count()/60.0,
+            process_time.count()/60.0,
+            verify_time.count()/60.0,
+            100.0 * verify_time.count() / sync_time.count(),
             m_sync_download_objects_size / 1000.0 / 1000.0,
             m_sync_download_chain_size / 1000.0 / 1000.0,
             100.0 * m_sync_old_spans_downloaded / m_sync_spans_downloaded,
@@ -2389,18 +2858,93 @@ You are now synchronized with the network.
   template<class t_core>
   bool t_cryptonote_protocol_handler<t_core>::relay_block(NOTIFY_NEW_FLUFFY_BLOCK::request& arg, cryptonote_connection_context& exclude_context)
   {
-    // sort peers between fluffy ones and others
-    std::vector<std::pair<epee::net_utils::zone, boost::uuids::uuid>> fluffyConnections;
-    m_p2p->for_each_connection([&exclude_context, &fluffyConnections](connection_context& context, nodetool::peerid_type peer_id)
+    return relay_block(arg, exclude_context, {});
+  }
+  //------------------------------------------------------------------------------------------------------------------------
+  template<class t_core>
+  bool t_cryptonote_protocol_handler<t_core>::make_compact_block(const NOTIFY_NEW_FLUFFY_BLOCK::request& arg, const std::unordered_set<crypto::hash>& prefill, NOTIFY_NEW_COMPACT_BLOCK::request& compact)
+  {
+    block b;
+    if (!parse_and_validate_block_from_blob(arg.b.block, b, compact.block_hash))
+      return false;
+
+    compact.current_blockchain_height = arg.current_blockchain_height;
+    compact.salt = crypto::rand<uint64_t>();
+    const auto key = compact_block::make_short_id_key(compact.block_hash, compact.salt);
+
+    // Callers give us the tx blobs in block order when they have them
+    const bool have_blobs = arg.b.txs.size() == b.tx_hashes.size();
+    compact.short_ids.reserve(b.tx_hashes.size() * compact_block::SHORT_ID_BYTES);
+    for (size_t i = 0; i < b.tx_hashes.size(); i++)
+    {
+      const auto& tx_hash = b.tx_hashes[i];
+      if (prefill.count(tx_hash))
+      {
+        std::string blob;
+        if (have_blobs)
+          blob = arg.b.txs[i];
+        else
+          m_core.mempool.get_transaction(tx_hash, blob);
+        if (!blob.empty())
+        {
+          compact.prefilled_indices.push_back(i);
+          compact.prefilled_txs.push_back(std::move(blob));
+          continue;
+        }
+      }
+      compact_block::append_short_id(compact.short_ids, key, tx_hash);
+    }
+
+    b.tx_hashes.clear();
+    b.invalidate_hashes();
+    compact.block = block_to_blob(b);
+    return true;
+  }
+  //------------------------------------------------------------------------------------------------------------------------
+  template<class t_core>
+  bool t_cryptonote_protocol_handler<t_core>::relay_block(NOTIFY_NEW_FLUFFY_BLOCK::request& arg, cryptonote_connection_context& exclude_context, const std::unordered_set<crypto::hash>& prefill)
+  {
+    // sort peers between compact ones and others
+    std::vector<std::pair<epee::net_utils::zone, boost::uuids::uuid>> fluffyConnections, compactConnections;
+    m_p2p->for_each_connection([&exclude_context, &fluffyConnections, &compactConnections](connection_context& context, nodetool::peerid_type peer_id)
     {
       if (peer_id && exclude_context.m_connection_id != context.m_connection_id && context.m_remote_address.get_zone() == epee::net_utils::zone::public_)
       {
-        log::debug(logcat, "{}PEER FLUFFY BLOCKS - RELAYING THIN/COMPACT WHATEVER BLOCK", context);
-        fluffyConnections.push_back({context.m_remote_address.get_zone(), context.m_connection_id});
+        if (context.m_support_flags & cryptonote::p2p::SUPPORT_FLAG_COMPACT_BLOCKS)
+        {
+          log::debug(logcat, "{}PEER COMPACT BLOCKS - RELAYING COMPACT BLOCK", context);
+          compactConnections.push_back({context.m_remote_address.get_zone(), context.m_connection_id});
+        }
+        else
+        {
+          log::debug(logcat, "{}PEER FLUFFY BLOCKS - RELAYING THIN/COMPACT WHATEVER BLOCK", context);
+          fluffyConnections.push_back({context.m_remote_address.get_zone(), context.m_connection_id});
+        }
       }
       return true;
     });
 
+    if (!compactConnections.empty())
+    {
+      NOTIFY_NEW_COMPACT_BLOCK::request compact{};
+      if (make_compact_block(arg, prefill, compact))
+      {
+        std::string compactBlob;
+        epee::serialization::store_t_to_binary(compact, compactBlob);
+        log::debug(logcat, "Relaying block {} to {} peers as a {} byte compact block ({} short ids, {} prefilled txes)",
+            compact.block_hash, compactConnections.size(), compactBlob.size(), compact.short_ids.size() / compact_block::SHORT_ID_BYTES, compact.prefilled_txs.size());
+        m_p2p->relay_notify_to_list(NOTIFY_NEW_COMPACT_BLOCK::ID, epee::strspan<uint8_t>(compactBlob), std::move(compactConnections));
+      }
+      else
+      {
+        log::warning(logcat, "Failed to build compact block, relaying as a fluffy block instead");
+        fluffyConnections.insert(fluffyConnections.end(), compactConnections.begin(), compactConnections.end());
+      }
+    }
+
+    if (fluffyConnections.empty())
+      return true;
+
     std::string fluffyBlob;
     if (arg.b.txs.size())
     {
@@ -2427,7 +2971,72 @@ You are now synchronized with the network.
   template<class t_core>
   bool t_cryptonote_protocol_handler<t_core>::relay_uptime_proof(NOTIFY_BTENCODED_UPTIME_PROOF::request& arg, cryptonote_connection_context& exclude_context)
   {
-    bool result = relay_to_synchronized_peers<NOTIFY_BTENCODED_UPTIME_PROOF>(arg, exclude_context);
+    return relay_uptime_proof(arg, exclude_context, crypto::keccak(arg.proof), false);
+  }
+  //------------------------------------------------------------------------------------------------------------------------
+  template<class t_core>
+  bool t_cryptonote_protocol_handler<t_core>::relay_uptime_proof(NOTIFY_BTENCODED_UPTIME_PROOF::request& arg, cryptonote_connection_context& exclude_context, const crypto::hash& proof_hash, bool handled)
+  {
+    NOTIFY_UPTIME_PROOF_ANNOUNCE::request announce{};
+    try
+    {
+      auto [pubkey, timestamp] = uptime_proof::peek_pubkey_and_timestamp(arg.proof);
+      announce.pubkeys.push_back(pubkey);
+      announce.timestamps.push_back(timestamp);
+      announce.hashes.push_back(proof_hash);
+    }
+    catch (const std::exception& e)
+    {
+      log::warning(logcat, "Unable to announce uptime proof {} ({}); relaying it in full", proof_hash, e.what());
+      return relay_to_synchronized_peers<NOTIFY_BTENCODED_UPTIME_PROOF>(arg, exclude_context);
+    }
+
+    // sort peers between those that take announcements and the others
+    std::vector<std::pair<epee::net_utils::zone, boost::uuids::uuid>> fullConnections, announceConnections;
+    m_p2p->for_each_connection([&exclude_context, &fullConnections, &announceConnections](connection_context& context, nodetool::peerid_type peer_id)
+    {
+      if (peer_id && context.m_state > cryptonote_connection_context::state_synchronizing && exclude_context.m_connection_id != context.m_connection_id)
+      {
+        auto& connections = context.m_support_flags & cryptonote::p2p::SUPPORT_FLAG_PROOF_ANNOUNCE ? announceConnections : fullConnections;
+        connections.push_back({context.m_remote_address.get_zone(), context.m_connection_id});
+      }
+      return true;
+    });
+
+    {
+      const auto now = std::chrono::steady_clock::now();
+      std::lock_guard lock{m_proof_announce_mutex};
+      while (!m_recent_proofs_added.empty() && now - m_recent_proofs_added.front().first > cryptonote::p2p::PROOF_ANNOUNCE_CACHE_LIFETIME)
+      {
+        m_recent_proofs.erase(m_recent_proofs_added.front().second);
+        m_recent_proofs_added.pop_front();
+      }
+      auto [it, inserted] = m_recent_proofs.emplace(proof_hash, recent_uptime_proof{arg, announce.pubkeys[0], announce.timestamps[0], handled});
+      if (inserted)
+        m_recent_proofs_added.emplace_back(now, proof_hash);
+      else if (handled)
+        it->second.handled = true;
+      // Record who we announce to before announcing, so that their requests find it
+      auto& announced_to = it->second.announced_to;
+      for (const auto& [zone, conn] : announceConnections)
+        if (std::find(announced_to.begin(), announced_to.end(), conn) == announced_to.end())
+          announced_to.push_back(conn);
+    }
+
+    bool result = true;
+    if (!announceConnections.empty())
+    {
+      std::string announceBlob;
+      epee::serialization::store_t_to_binary(announce, announceBlob);
+      log::debug(logcat, "Announcing uptime proof {} from {} to {} peers", proof_hash, announce.pubkeys[0], announceConnections.size());
+      result &= m_p2p->relay_notify_to_list(NOTIFY_UPTIME_PROOF_ANNOUNCE::ID, epee::strspan<uint8_t>(announceBlob), std::move(announceConnections));
+    }
+    if (!fullConnections.empty())
+    {
+      std::string proofBlob;
+      epee::serialization::store_t_to_binary(arg, proofBlob);
+      result &= m_p2p->relay_notify_to_list(NOTIFY_BTENCODED_UPTIME_PROOF::ID, epee::strspan<uint8_t>(proofBlob), std::move(fullConnections));
+    }
     return result;
   }
   //------------------------------------------------------------------------------------------------------------------------
@@ -2472,8 +3081,13 @@ You are now synchronized with the network.
       }
     }
 
+    // Peers that support it get announcements rather than the full txs, which requires that we
+    // have the hash of every tx being sent.
+    if (relayed_txes.size() != arg.txs.size())
+      relayed_txes.clear();
+
     // no check for success, so tell core they're relayed unconditionally
-    m_p2p->send_txs(std::move(arg.txs), exclude_context.m_remote_address.get_zone(), exclude_context.m_connection_id, m_core.pad_transactions());
+    m_p2p->send_txs(std::move(arg.txs), std::move(relayed_txes), exclude_context.m_remote_address.get_zone(), exclude_context.m_connection_id, m_core.pad_transactions());
     return true;
   }
   //------------------------------------------------------------------------------------------------------------------------
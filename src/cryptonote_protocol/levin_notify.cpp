@@ -28,6 +28,7 @@
 
 #include "levin_notify.h"
 
+#include <algorithm>
 #include <boost/asio/steady_timer.hpp>
 #include <boost/system/system_error.hpp>
 #include <chrono>
@@ -118,6 +119,17 @@ namespace {
         return fullBlob;
     }
 
+    std::string make_tx_announce_payload(std::vector<crypto::hash>&& tx_hashes) {
+        NOTIFY_TX_ANNOUNCE::request request{};
+        request.txs = std::move(tx_hashes);
+
+        std::string blob;
+        if (!epee::serialization::store_t_to_binary(request, blob))
+            throw oxen::traced<std::runtime_error>{"Failed to serialize to epee binary format"};
+
+        return blob;
+    }
+
     /* The current design uses `asio::strand`s. The documentation isn't as clear
        as it should be - a `strand` has an internal `mutex` and `bool`. The
        `mutex` synchronizes thread access and the `bool` is set when a thread is
@@ -238,22 +250,31 @@ namespace {
         }
     };
 
-    //! Sends a message to every active connection
+    //! Sends a message to every active connection (or an announcement of it, when available, to
+    //! incoming connections and all but a few outgoing connections that support announcements).
     class flood_notify {
         std::shared_ptr<detail::zone> zone_;
-        epee::shared_sv message_;  // Requires manual copy
+        epee::shared_sv message_;   // Requires manual copy
+        epee::shared_sv announce_;  // Requires manual copy
         boost::uuids::uuid source_;
 
       public:
         explicit flood_notify(
                 std::shared_ptr<detail::zone> zone,
                 epee::shared_sv message,
-                const boost::uuids::uuid& source) :
-                zone_(std::move(zone)), message_(message), source_(source) {}
+                const boost::uuids::uuid& source,
+                epee::shared_sv announce = {}) :
+                zone_(std::move(zone)),
+                message_(message),
+                announce_(std::move(announce)),
+                source_(source) {}
 
         flood_notify(flood_notify&&) = default;
         flood_notify(const flood_notify& source) :
-                zone_(source.zone_), message_(source.message_), source_(source.source_) {}
+                zone_(source.zone_),
+                message_(source.message_),
+                announce_(source.announce_),
+                source_(source.source_) {}
 
         void operator()() const {
             if (!zone_ || !zone_->p2p)
@@ -267,20 +288,48 @@ namespace {
                algorithm changes or the locking strategy within the levin config
                class changes. */
 
-            std::vector<boost::uuids::uuid> connections;
+            std::vector<boost::uuids::uuid> connections, announce_connections, announce_outgoing;
             connections.reserve(connection_id_reserve_size);
-            zone_->p2p->foreach_connection([this, &connections](detail::p2p_context& context) {
+            zone_->p2p->foreach_connection([this,
+                                            &connections,
+                                            &announce_connections,
+                                            &announce_outgoing](detail::p2p_context& context) {
                 /* Only send to outgoing connections when "flooding" over i2p/tor.
                    Otherwise this makes the tx linkable to a hidden service address,
                    making things linkable across connections. */
                 if (this->source_ != context.m_connection_id &&
-                    (this->zone_->is_public || !context.m_is_income))
-                    connections.emplace_back(context.m_connection_id);
+                    (this->zone_->is_public || !context.m_is_income)) {
+                    /* Full txs are only flooded to a few outgoing connections; the
+                       other connections just get the hashes and fetch what they are
+                       missing, which saves re-sending every tx to peers that mostly
+                       have it already. */
+                    if (this->announce_.view.empty() ||
+                        !(context.m_support_flags & cryptonote::p2p::SUPPORT_FLAG_TX_ANNOUNCE))
+                        connections.emplace_back(context.m_connection_id);
+                    else if (context.m_is_income)
+                        announce_connections.emplace_back(context.m_connection_id);
+                    else
+                        announce_outgoing.emplace_back(context.m_connection_id);
+                }
                 return true;
             });
 
+            if (announce_outgoing.size() > cryptonote::p2p::TX_FULL_RELAY_OUTGOING_PEERS) {
+                std::shuffle(
+                        announce_outgoing.begin(), announce_outgoing.end(), crypto::random_device{});
+                announce_connections.insert(
+                        announce_connections.end(),
+                        announce_outgoing.begin() + cryptonote::p2p::TX_FULL_RELAY_OUTGOING_PEERS,
+                        announce_outgoing.end());
+                announce_outgoing.resize(cryptonote::p2p::TX_FULL_RELAY_OUTGOING_PEERS);
+            }
+            connections.insert(
+                    connections.end(), announce_outgoing.begin(), announce_outgoing.end());
+
             for (const boost::uuids::uuid& connection : connections)
                 zone_->p2p->send(message_, connection);
+            for (const boost::uuids::uuid& connection : announce_connections)
+                zone_->p2p->send(announce_, connection);
         }
     };
 
@@ -512,7 +561,10 @@ void notify::run_stems() {
 }
 
 bool notify::send_txs(
-        std::vector<std::string> txs, const boost::uuids::uuid& source, const bool pad_txs) {
+        std::vector<std::string> txs,
+        const boost::uuids::uuid& source,
+        const bool pad_txs,
+        std::vector<crypto::hash> tx_hashes) {
     if (!zone_)
         return false;
 
@@ -544,8 +596,17 @@ bool notify::send_txs(
         epee::shared_sv message{epee::levin::make_notify(
                 NOTIFY_NEW_TRANSACTIONS::ID, epee::strspan<std::uint8_t>(payload))};
 
+        epee::shared_sv announce;
+        if (zone_->is_public && !tx_hashes.empty()) {
+            std::sort(tx_hashes.begin(), tx_hashes.end());
+            const std::string announce_payload = make_tx_announce_payload(std::move(tx_hashes));
+            announce = epee::shared_sv{epee::levin::make_notify(
+                    NOTIFY_TX_ANNOUNCE::ID, epee::strspan<std::uint8_t>(announce_payload))};
+        }
+
         // traditional monero send technique
-        zone_->strand.dispatch(flood_notify{zone_, std::move(message), source});
+        zone_->strand.dispatch(
+                flood_notify{zone_, std::move(message), source, std::move(announce)});
     }
 
     return true;
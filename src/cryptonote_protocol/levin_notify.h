@@ -33,6 +33,7 @@
 #include <memory>
 #include <vector>
 
+#include "crypto/hash.h"
 #include "epee/net/enums.h"
 #include "epee/shared_sv.h"
 #include "epee/span.h"
@@ -116,8 +117,16 @@ class notify {
         \param pad_txs A request to pad txs to help conceal origin via
           statistical analysis. Ignored if noise was enabled during
           construction.
+        \param tx_hashes Hashes of `txs`. When non-empty and flooding over the
+          public zone, connections that support tx announcements are sent a
+          `NOTIFY_TX_ANNOUNCE` of these hashes instead of the full txs, except
+          for `TX_FULL_RELAY_OUTGOING_PEERS` random outgoing connections.
 
       \return True iff the notification is queued for sending. */
-    bool send_txs(std::vector<std::string> txs, const boost::uuids::uuid& source, bool pad_txs);
+    bool send_txs(
+            std::vector<std::string> txs,
+            const boost::uuids::uuid& source,
+            bool pad_txs,
+            std::vector<crypto::hash> tx_hashes = {});
 };
 }  // namespace cryptonote::levin
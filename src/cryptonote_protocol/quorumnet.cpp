@@ -28,15 +28,22 @@
 
 #include "quorumnet.h"
 
+#include <oxenc/bt_producer.h>
 #include <oxenc/hex.h>
 #include <oxenmq/oxenmq.h>
 #include <time.h>
 
+#include <algorithm>
 #include <iterator>
 #include <shared_mutex>
 
 #include "common/exception.h"
+#include "common/oneshot_timer.h"
+#include "common/oxen.h"
+#include "common/profiler.h"
 #include "common/random.h"
+#include "common/string_util.h"
+#include "common/threadpool.h"
 #include "cryptonote_basic/hardfork.h"
 #include "cryptonote_config.h"
 #include "cryptonote_core/cryptonote_core.h"
@@ -46,6 +53,7 @@
 #include "cryptonote_core/tx_blink.h"
 #include "cryptonote_core/tx_pool.h"
 #include "cryptonote_core/uptime_proof.h"
+#include "epee/net/command_stats.h"
 #include "quorumnet_conn_matrix.h"
 
 namespace quorumnet {
@@ -84,6 +92,14 @@ namespace {
 
     using pending_signature_set = std::unordered_set<pending_signature, pending_signature_hash>;
 
+    // How long we hold on to blink signatures relayed to us before verifying them: the members of a
+    // blink quorum all sign and relay at about the same time, so waiting briefly lets us verify
+    // (and then re-relay) a burst of them together rather than one message at a time.
+    constexpr auto BLINK_SIGNATURE_BATCH_WINDOW = 5ms;
+
+    // Smallest number of blink signatures worth splitting off to verify on another thread.
+    constexpr size_t BLINK_VERIFY_MIN_BATCH_SIZE = 4;
+
     struct QnetState {
         cryptonote::core& core;
         oxenmq::OxenMQ& omq{core.omq()};
@@ -102,6 +118,21 @@ namespace {
         // { height => { txhash => {blink_tx,conn,reply}, ... }, ... }
         std::map<uint64_t, std::unordered_map<crypto::hash, blink_metadata>> blinks;
 
+        // Signatures relayed to us for a known blink tx that are waiting out
+        // BLINK_SIGNATURE_BATCH_WINDOW to be verified and applied as one batch.
+        struct blink_signature_batch {
+            std::shared_ptr<blink_tx> btxptr;
+            quorum_array blink_quorums;
+            uint64_t quorum_checksum = 0;
+            pending_signature_set signatures;
+            oxenmq::ConnectionID reply_conn;
+            uint64_t reply_tag = 0;
+            std::unordered_set<crypto::public_key> received_from;
+            std::chrono::steady_clock::time_point started;
+        };
+        std::mutex blink_batch_mutex;
+        std::unordered_map<crypto::hash, blink_signature_batch> blink_batches;
+
         // FIXME:
         // std::chrono::steady_clock::time_point last_blink_cleanup =
         // std::chrono::steady_clock::now();
@@ -370,14 +401,21 @@ E get_enum(const bt_dict &d, const std::string &key) {
             }
         }
 
-        /// Relays a command and any number of serialized data to everyone we're supposed to relay
-        /// to
-        template <typename... T>
-        void relay_to_peers(const std::string_view& cmd, const T&... data) {
-            relay_to_peers_impl(
-                    cmd,
-                    std::array<std::string, sizeof...(T)>{bt_serialize(data)...},
-                    std::make_index_sequence<sizeof...(T)>{});
+        /// Relays a command and its already-encoded data to everyone we're supposed to relay to.
+        /// The same encoded buffer is used for every peer.
+        void relay_to_peers(std::string_view cmd, std::string_view data) {
+            for (auto& peer : peers) {
+                log::trace(
+                        logcat,
+                        "Relaying {} to peer {}{}",
+                        cmd,
+                        to_hex(peer.first),
+                        (peer.second.empty() ? " (if connected)"s : " @ " + peer.second));
+                if (peer.second.empty())
+                    omq.send(peer.first, cmd, data, send_option::optional{});
+                else
+                    omq.send(peer.first, cmd, data, send_option::hint{peer.second});
+            }
         }
 
       private:
@@ -537,45 +575,35 @@ E get_enum(const bt_dict &d, const std::string &key) {
                 }
             }
         }
-
-        /// Relays a command and pre-serialized data to everyone we're supposed to relay to
-        template <size_t N, size_t... I>
-        void relay_to_peers_impl(
-                const std::string_view& cmd,
-                std::array<std::string, N> relay_data,
-                std::index_sequence<I...>) {
-            for (auto& peer : peers) {
-                log::trace(
-                        logcat,
-                        "Relaying {} to peer {}{}",
-                        cmd,
-                        to_hex(peer.first),
-                        (peer.second.empty() ? " (if connected)"s : " @ " + peer.second));
-                if (peer.second.empty())
-                    omq.send(peer.first, cmd, relay_data[I]..., send_option::optional{});
-                else
-                    omq.send(peer.first, cmd, relay_data[I]..., send_option::hint{peer.second});
-            }
-        }
     };
 
-    bt_dict serialize_vote(const quorum_vote_t& vote) {
-        bt_dict result{
-                {"v", vote.version},
-                {"t", static_cast<uint8_t>(vote.type)},
-                {"h", vote.block_height},
-                {"g", static_cast<uint8_t>(vote.group)},
-                {"i", vote.index_in_group},
-                {"s", get_data_as_string(vote.signature)},
-        };
+    // Upper bound on the encoded size of a vote: the 32-byte checkpoint hash or the three state
+    // change integers, a 64-byte signature, and a handful of small integers (a 64-bit integer plus
+    // its key is at most 25 bytes).
+    constexpr size_t SERIALIZED_VOTE_MAX_SIZE = 256;
+    using serialized_vote_buffer = std::array<char, SERIALIZED_VOTE_MAX_SIZE>;
+
+    // Encodes a vote into `buf`, returning a view of the encoded value within it.
+    std::string_view serialize_vote(const quorum_vote_t& vote, serialized_vote_buffer& buf) {
+        // NB: must append in ascii order
+        bt_dict_producer d{buf.data(), buf.data() + buf.size()};
         if (vote.type == quorum_type::checkpointing)
-            result["bh"] = std::string{tools::view_guts(vote.checkpoint.block_hash)};
-        else {
-            result["wi"] = vote.state_change.worker_index;
-            result["sc"] = static_cast<std::underlying_type_t<new_state>>(vote.state_change.state);
-            result["re"] = static_cast<uint16_t>(vote.state_change.reason);
-        }
-        return result;
+            d.append("bh", tools::view_guts(vote.checkpoint.block_hash));
+        d.append("g", static_cast<uint8_t>(vote.group));
+        d.append("h", vote.block_height);
+        d.append("i", vote.index_in_group);
+        if (vote.type != quorum_type::checkpointing)
+            d.append("re", static_cast<uint16_t>(vote.state_change.reason));
+        d.append("s", tools::view_guts(vote.signature));
+        if (vote.type != quorum_type::checkpointing)
+            d.append(
+                    "sc",
+                    static_cast<std::underlying_type_t<new_state>>(vote.state_change.state));
+        d.append("t", static_cast<uint8_t>(vote.type));
+        d.append("v", vote.version);
+        if (vote.type != quorum_type::checkpointing)
+            d.append("wi", vote.state_change.worker_index);
+        return d.view();
     }
 
     quorum_vote_t deserialize_vote(std::string_view v) {
@@ -656,7 +684,8 @@ E get_enum(const bt_dict &d, const std::string &key) {
                 continue;
             }
 
-            pinfo.relay_to_peers("quorum.vote_ob", serialize_vote(vote));
+            serialized_vote_buffer buf;
+            pinfo.relay_to_peers("quorum.vote_ob", serialize_vote(vote, buf));
             relayed_votes.push_back(vote);
         }
         log::debug(logcat, "Relayed {} votes", relayed_votes.size());
@@ -793,12 +822,64 @@ E get_enum(const bt_dict &d, const std::string &key) {
         return os.str();
     }
 
-    /// Processes blink signatures; called immediately upon receiving a signature if we know about
-    /// the tx; otherwise signatures are stored until we learn about the tx and then processed.
+    // Checks each of the given signatures against the blink quorum validator key at its position,
+    // removing any that fail to verify.  Larger sets of signatures get split across the
+    // threadpool.  Lock not required.
+    void verify_blink_signatures(
+            const blink_tx& btx,
+            const quorum_array& blink_quorums,
+            std::list<pending_signature>& signatures) {
+        const std::array<crypto::hash, 2> hashes{btx.hash(false), btx.hash(true)};
+
+        std::vector<const pending_signature*> sigs;
+        sigs.reserve(signatures.size());
+        for (auto& pending : signatures)
+            sigs.push_back(&pending);
+        std::vector<char> valid(sigs.size());
+
+        auto verify = [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                auto& [approval, qi, position, signature] = *sigs[i];
+                valid[i] = crypto::check_signature(
+                        hashes[approval], blink_quorums[qi]->validators[position], signature);
+            }
+        };
+
+        tools::threadpool& tpool = tools::threadpool::getInstance();
+        const size_t batches = std::clamp<size_t>(
+                sigs.size() / BLINK_VERIFY_MIN_BATCH_SIZE,
+                1,
+                std::max(tpool.get_max_concurrency(), 1u));
+        if (batches == 1) {
+            verify(0, sigs.size());
+        } else {
+            tools::threadpool::waiter waiter;
+            for (size_t b = 0, begin = 0; b < batches; b++) {
+                const size_t end = sigs.size() * (b + 1) / batches;
+                tpool.submit(&waiter, [&verify, begin, end] { verify(begin, end); }, true);
+                begin = end;
+            }
+            waiter.wait(&tpool);
+        }
+
+        size_t i = 0;
+        for (auto it = signatures.begin(); it != signatures.end(); i++) {
+            if (valid[i]) {
+                ++it;
+                continue;
+            }
+            log::warning(logcat, "Invalid blink signature: signature verification failed");
+            it = signatures.erase(it);
+        }
+    }
+
+    /// Processes blink signatures; called upon receiving signatures if we know about the tx (for
+    /// relayed signatures, once the BLINK_SIGNATURE_BATCH_WINDOW has passed); otherwise signatures
+    /// are stored until we learn about the tx and then processed.
     ///
     /// reply_tag: > 0 if we are expected to send a status update if it becomes accepted/rejected
     /// reply_conn: who we are supposed to send the status update to
-    /// received_from: x25519 of the peer that sent this, if available (to avoid trying to
+    /// relay_exclude: pubkeys of the peers that sent these signatures to us (to avoid trying to
     /// pointlessly relay back to them)
     void process_blink_signatures(
             QnetState& qnet,
@@ -808,7 +889,7 @@ E get_enum(const bt_dict &d, const std::string &key) {
             std::list<pending_signature>&& signatures,
             uint64_t reply_tag,
             oxenmq::ConnectionID reply_conn,
-            const std::string& received_from = ""s) {
+            peer_info::exclude_set relay_exclude = {}) {
 
         auto& btx = *btxptr;
 
@@ -840,22 +921,7 @@ E get_enum(const bt_dict &d, const std::string &key) {
             return;
 
         // Now check and discard any invalid signatures (we can do this without holding a lock)
-        for (auto it = signatures.begin(); it != signatures.end();) {
-            auto& pending = *it;
-            auto& approval = std::get<bool>(pending);
-            auto& qi = std::get<uint8_t>(pending);
-            auto& position = std::get<int>(pending);
-            auto& signature = std::get<crypto::signature>(pending);
-
-            auto& validators = blink_quorums[qi]->validators;
-
-            if (!crypto::check_signature(btx.hash(approval), validators[position], signature)) {
-                log::warning(logcat, "Invalid blink signature: signature verification failed");
-                it = signatures.erase(it);
-                continue;
-            }
-            ++it;
-        }
+        verify_blink_signatures(btx, blink_quorums, signatures);
 
         if (signatures.empty())
             return;
@@ -929,14 +995,6 @@ E get_enum(const bt_dict &d, const std::string &key) {
         if (signatures.empty())
             return;
 
-        peer_info::exclude_set relay_exclude;
-        if (!received_from.empty()) {
-            auto pubkey = qnet.core.service_node_list.get_pubkey_from_x25519(
-                    x25519_from_string(received_from));
-            if (pubkey)
-                relay_exclude.insert(std::move(pubkey));
-        }
-
         // We added new signatures that we didn't have before, so relay those signatures to blink
         // peers
         peer_info pinfo{
@@ -954,25 +1012,36 @@ E get_enum(const bt_dict &d, const std::string &key) {
                 pinfo.strong_peers,
                 (pinfo.peers.size() - pinfo.strong_peers));
 
-        bt_list i_list, p_list, r_list, s_list;
-        for (auto& s : signatures) {
-            i_list.emplace_back(std::get<uint8_t>(s));
-            p_list.emplace_back(std::get<int>(s));
-            r_list.emplace_back(std::get<bool>(s));
-            s_list.emplace_back(get_data_as_string(std::get<crypto::signature>(s)));
-        }
-
-        bt_dict blink_sign_data{
-                {"h", btx.height},
-                {"#", get_data_as_string(btx.get_txhash())},
-                {"q", quorum_checksum},
-                {"i", std::move(i_list)},
-                {"p", std::move(p_list)},
-                {"r", std::move(r_list)},
-                {"s", std::move(s_list)},
-        };
+        // We hold at most one signature per quorum position by now, which bounds the message: the
+        // tx hash, two 64-bit integers and keys, plus per signature the quorum index, position,
+        // result and 64-byte signature (and its length prefix).
+        std::array<char, 128 + NUM_BLINK_QUORUMS * BLINK_SUBQUORUM_SIZE * 80> buf;
+        bt_dict_producer blink_sign_data{buf.data(), buf.data() + buf.size()};
+        blink_sign_data.append("#", tools::view_guts(btx.get_txhash()));
+        blink_sign_data.append("h", btx.height);
+        {
+            auto i_list = blink_sign_data.append_list("i");
+            for (auto& s : signatures)
+                i_list.append(std::get<uint8_t>(s));
+        }
+        {
+            auto p_list = blink_sign_data.append_list("p");
+            for (auto& s : signatures)
+                p_list.append(std::get<int>(s));
+        }
+        blink_sign_data.append("q", quorum_checksum);
+        {
+            auto r_list = blink_sign_data.append_list("r");
+            for (auto& s : signatures)
+                r_list.append(int{std::get<bool>(s)});
+        }
+        {
+            auto s_list = blink_sign_data.append_list("s");
+            for (auto& s : signatures)
+                s_list.append(tools::view_guts(std::get<crypto::signature>(s)));
+        }
 
-        pinfo.relay_to_peers("quorum.blink_sign", blink_sign_data);
+        pinfo.relay_to_peers("quorum.blink_sign", blink_sign_data.view());
 
         log::trace(logcat, "Done blink signature relay");
 
@@ -999,6 +1068,97 @@ E get_enum(const bt_dict &d, const std::string &key) {
         }
     }
 
+    // Takes the accumulated batch of relayed signatures for the given tx (if it hasn't already been
+    // taken) and verifies, stores and relays them.
+    void flush_blink_signatures(QnetState& qnet, const crypto::hash& tx_hash) {
+        QnetState::blink_signature_batch batch;
+        {
+            std::lock_guard lock{qnet.blink_batch_mutex};
+            auto it = qnet.blink_batches.find(tx_hash);
+            if (it == qnet.blink_batches.end())
+                return;
+            batch = std::move(it->second);
+            qnet.blink_batches.erase(it);
+        }
+
+        log::debug(
+                logcat,
+                "Processing batch of {} blink signatures for tx {} from {} peer(s) after {}",
+                batch.signatures.size(),
+                tx_hash,
+                batch.received_from.size(),
+                tools::friendly_duration(std::chrono::steady_clock::now() - batch.started));
+
+        try {
+            process_blink_signatures(
+                    qnet,
+                    batch.btxptr,
+                    batch.blink_quorums,
+                    batch.quorum_checksum,
+                    {batch.signatures.begin(), batch.signatures.end()},
+                    batch.reply_tag,
+                    batch.reply_conn,
+                    std::move(batch.received_from));
+        } catch (const std::exception& e) {
+            log::warning(
+                    logcat,
+                    "Failed to process blink signatures for tx {}: {}",
+                    tx_hash,
+                    e.what());
+        }
+    }
+
+    // Adds signatures relayed to us for a blink tx we know about to the tx's pending batch.  The
+    // first signatures for a tx start a BLINK_SIGNATURE_BATCH_WINDOW timer to process the batch on
+    // a worker thread; the batch gets processed right away instead once it holds a signature for
+    // every quorum position, since there is nothing left to wait for.
+    void queue_blink_signatures(
+            QnetState& qnet,
+            std::shared_ptr<blink_tx> btxptr,
+            quorum_array&& blink_quorums,
+            uint64_t quorum_checksum,
+            std::list<pending_signature>&& signatures,
+            uint64_t reply_tag,
+            oxenmq::ConnectionID reply_conn,
+            const std::string& received_from) {
+        auto tx_hash = btxptr->get_txhash();
+        auto sender = qnet.core.service_node_list.get_pubkey_from_x25519(
+                x25519_from_string(received_from));
+
+        bool start_timer = false, full = false;
+        {
+            std::lock_guard lock{qnet.blink_batch_mutex};
+            auto [it, inserted] = qnet.blink_batches.try_emplace(tx_hash);
+            auto& batch = it->second;
+            if (inserted) {
+                batch.btxptr = std::move(btxptr);
+                batch.blink_quorums = std::move(blink_quorums);
+                batch.quorum_checksum = quorum_checksum;
+                batch.reply_conn = std::move(reply_conn);
+                batch.reply_tag = reply_tag;
+                batch.started = std::chrono::steady_clock::now();
+                start_timer = true;
+            }
+            for (auto& sig : signatures)
+                batch.signatures.insert(std::move(sig));
+            if (sender)
+                batch.received_from.insert(sender);
+
+            size_t positions = 0;
+            for (auto& q : batch.blink_quorums)
+                positions += q->validators.size();
+            full = batch.signatures.size() >= positions;
+        }
+
+        if (full)
+            qnet.omq.job([&qnet, tx_hash] { flush_blink_signatures(qnet, tx_hash); });
+        else if (start_timer)
+            tools::add_oneshot_timer(
+                    qnet.omq,
+                    [&qnet, tx_hash] { flush_blink_signatures(qnet, tx_hash); },
+                    BLINK_SIGNATURE_BATCH_WINDOW);
+    }
+
     /// A "blink" message is used to submit a blink tx from a node to members of the blink quorum
     /// and also used to relay the blink tx between quorum members.  Fields are:
     ///
@@ -1305,18 +1465,19 @@ E get_enum(const bt_dict &d, const std::string &key) {
         // to induce a node to broadcast a junk TX to other quorum members.
 
         {
-            bt_dict blink_data{
-                    {"h", blink_height},
-                    {"q", checksum},
-                    {"t", tx_data},
-                    {"#", tx_hash_str},
-            };
+            // The tx data plus the hash, two 64-bit integers and their keys
+            std::string buf(tx_data.size() + 128, '\0');
+            bt_dict_producer blink_data{buf.data(), buf.data() + buf.size()};
+            blink_data.append("#", tx_hash_str);
+            blink_data.append("h", blink_height);
+            blink_data.append("q", checksum);
+            blink_data.append("t", tx_data);
             log::debug(
                     logcat,
                     "Relaying blink tx to {} strong and {} opportunistic blink peers",
                     pinfo.strong_peers,
                     (pinfo.peers.size() - pinfo.strong_peers));
-            pinfo.relay_to_peers("blink.submit", blink_data);
+            pinfo.relay_to_peers("blink.submit", blink_data.view());
         }
 
         // Anything past this point always results in a success or failure signature getting sent to
@@ -1551,14 +1712,14 @@ E get_enum(const bt_dict &d, const std::string &key) {
 
         log::info(logcat, "Found blink tx in local blink cache");
 
-        process_blink_signatures(
+        queue_blink_signatures(
                 qnet,
-                btxptr,
-                blink_quorums,
+                std::move(btxptr),
+                std::move(blink_quorums),
                 checksum,
                 std::move(signatures),
                 reply_tag,
-                reply_conn,
+                std::move(reply_conn),
                 m.conn.pubkey());
     }
 
@@ -1894,7 +2055,7 @@ E get_enum(const bt_dict &d, const std::string &key) {
                     true /*opportunistic*/,
                     std::move(relay_exclude),
                     include_block_producer /*include_workers*/};
-            peer_list.relay_to_peers(command, data);
+            peer_list.relay_to_peers(command, bt_serialize(data));
         }
     }
 
@@ -1925,6 +2086,42 @@ E get_enum(const bt_dict &d, const std::string &key) {
         return result;
     }
 
+    // Hands a parsed Pulse message over to the Pulse thread.  If simulated link conditions were
+    // configured (--dev-pulse-*) the message may instead be dropped, or delivered after a delay by
+    // a one-shot timer.
+    void queue_pulse_message(QnetState& qnet, pulse::message msg) {
+        auto const& conditions = qnet.core.pulse_link_conditions();
+        if (!conditions.enabled()) {
+            qnet.omq.job(
+                    [&qnet, data = std::move(msg)]() { pulse::handle_message(&qnet, data); },
+                    qnet.core.pulse_thread_id());
+            return;
+        }
+
+        if (conditions.loss > 0 &&
+            std::uniform_real_distribution<double>{0, 1}(tools::rng) < conditions.loss) {
+            log::trace(logcat, "Simulated loss: dropping incoming pulse '{}' message", msg.type);
+            return;
+        }
+
+        auto delay = conditions.delay;
+        if (conditions.jitter.count() > 0)
+            delay += std::chrono::milliseconds{
+                    tools::uniform_distribution_portable(tools::rng, conditions.jitter.count() + 1)};
+        if (delay.count() == 0) {
+            qnet.omq.job(
+                    [&qnet, data = std::move(msg)]() { pulse::handle_message(&qnet, data); },
+                    qnet.core.pulse_thread_id());
+            return;
+        }
+
+        tools::add_oneshot_timer(
+                qnet.omq,
+                [&qnet, data = std::move(msg)] { pulse::handle_message(&qnet, data); },
+                delay,
+                qnet.core.pulse_thread_id());
+    }
+
     // Invoked when daemon has received a participation handshake message via
     // QuorumNet from another validator, either forwarded or originating from that
     // node. The message is added to the Pulse message queue and validating the
@@ -1950,9 +2147,7 @@ E get_enum(const bt_dict &d, const std::string &key) {
                 throw oxen::traced<std::invalid_argument>{"{}{}'"_format(INVALID_ARG_PREFIX, tag)};
         }
 
-        qnet.omq.job(
-                [&qnet, data = std::move(msg)]() { pulse::handle_message(&qnet, data); },
-                qnet.core.pulse_thread_id());
+        queue_pulse_message(qnet, std::move(msg));
     }
 
     void handle_pulse_block_template(Message& m, QnetState& qnet) {
@@ -1972,9 +2167,7 @@ E get_enum(const bt_dict &d, const std::string &key) {
         else
             throw oxen::traced<std::invalid_argument>{"{}{}'"_format(INVALID_ARG_PREFIX, tag)};
 
-        qnet.omq.job(
-                [&qnet, data = std::move(msg)]() { pulse::handle_message(&qnet, data); },
-                qnet.core.pulse_thread_id());
+        queue_pulse_message(qnet, std::move(msg));
     }
 
     void handle_pulse_random_value_hash(Message& m, QnetState& qnet) {
@@ -2001,9 +2194,7 @@ E get_enum(const bt_dict &d, const std::string &key) {
             throw oxen::traced<std::invalid_argument>{"{}{}'"_format(INVALID_ARG_PREFIX, tag)};
         }
 
-        qnet.omq.job(
-                [&qnet, data = std::move(msg)]() { pulse::handle_message(&qnet, data); },
-                qnet.core.pulse_thread_id());
+        queue_pulse_message(qnet, std::move(msg));
     }
 
     void handle_pulse_random_value(Message& m, QnetState& qnet) {
@@ -2027,9 +2218,7 @@ E get_enum(const bt_dict &d, const std::string &key) {
             throw oxen::traced<std::invalid_argument>{"{}{}'"_format(INVALID_ARG_PREFIX, tag)};
         }
 
-        qnet.omq.job(
-                [&qnet, data = std::move(msg)]() { pulse::handle_message(&qnet, data); },
-                qnet.core.pulse_thread_id());
+        queue_pulse_message(qnet, std::move(msg));
     }
 
     void handle_pulse_signed_block(Message& m, QnetState& qnet) {
@@ -2052,9 +2241,7 @@ E get_enum(const bt_dict &d, const std::string &key) {
             throw oxen::traced<std::invalid_argument>{"{}{}'"_format(INVALID_ARG_PREFIX, tag)};
         }
 
-        qnet.omq.job(
-                [&qnet, data = std::move(msg)]() { pulse::handle_message(&qnet, data); },
-                qnet.core.pulse_thread_id());
+        queue_pulse_message(qnet, std::move(msg));
     }
 
 }  // namespace
@@ -2071,6 +2258,27 @@ void init_core_callbacks() {
 }
 
 namespace {
+    // Wraps an OMQ command handler so that the CPU time it takes and the size of the messages it
+    // handles get accounted in the "category.command" omq command stats, and so that it shows up
+    // in the profiler (when enabled).
+    template <typename F>
+    auto counted(std::string_view category, std::string_view command, F handler) {
+        auto name = "{}.{}"_format(category, command);
+        auto profile_name = tools::profiler::intern("quorumnet." + name);
+        return [name = std::move(name), profile_name, handler = std::move(handler)](
+                       oxenmq::Message& m) {
+            OXEN_PROFILE_SCOPE(profile_name);
+            size_t size = 0;
+            for (const auto& part : m.data)
+                size += part.size();
+            const epee::net_utils::cpu_timer cpu;
+            OXEN_DEFER {
+                epee::net_utils::command_stats().omq.record(name, size, 0, cpu.elapsed());
+            };
+            handler(m);
+        };
+    }
+
     void setup_endpoints(cryptonote::core& core, void* obj) {
         using namespace oxenmq;
 
@@ -2091,43 +2299,65 @@ namespace {
             omq.add_category("quorum", sn_to_sn, 2 /*reserved threads*/)
                     // Receives an obligation vote
                     .add_command(
-                            "vote_ob", [&qnet](Message& m) { handle_obligation_vote(m, qnet); })
+                            "vote_ob",
+                            counted("quorum", "vote_ob", [&qnet](Message& m) {
+                                handle_obligation_vote(m, qnet);
+                            }))
                     // Receives blink tx signatures or rejections between quorum members (either
                     // original or forwarded).  These are propagated by the receiver if new
                     .add_command(
-                            "blink_sign", [&qnet](Message& m) { handle_blink_signature(m, qnet); })
+                            "blink_sign",
+                            counted("quorum", "blink_sign", [&qnet](Message& m) {
+                                handle_blink_signature(m, qnet);
+                            }))
                     // Receives a request for the timestamp
-                    .add_request_command("timestamp", [](Message& m) { handle_timestamp(m); });
+                    .add_request_command(
+                            "timestamp", counted("quorum", "timestamp", handle_timestamp));
 
             // blink.*: commands sent to blink quorum members from anyone (e.g. blink submission)
             omq.add_category("blink", sn_incoming, 1 /*reserved thread*/)
                     // Receives a new blink tx submission from an external node, or forward from
                     // other quorum members who received it from an external node.
-                    .add_command("submit", [&qnet](Message& m) { handle_blink(m, qnet); });
+                    .add_command(
+                            "submit",
+                            counted("blink", "submit", [&qnet](Message& m) {
+                                handle_blink(m, qnet);
+                            }));
 
+            auto pulse_counted = [](const std::string& command, auto handler) {
+                return counted(PULSE_CMD_CATEGORY, command, std::move(handler));
+            };
             omq.add_category(PULSE_CMD_CATEGORY, sn_to_sn, 1 /*reserved thread*/)
                     .add_command(
                             PULSE_CMD_VALIDATOR_BIT,
-                            [&qnet](Message& m) {
+                            pulse_counted(PULSE_CMD_VALIDATOR_BIT, [&qnet](Message& m) {
                                 handle_pulse_participation_bit_or_bitset(m, qnet, false /*bitset*/);
-                            })
+                            }))
                     .add_command(
                             PULSE_CMD_VALIDATOR_BITSET,
-                            [&qnet](Message& m) {
+                            pulse_counted(PULSE_CMD_VALIDATOR_BITSET, [&qnet](Message& m) {
                                 handle_pulse_participation_bit_or_bitset(m, qnet, true /*bitset*/);
-                            })
+                            }))
                     .add_command(
                             PULSE_CMD_BLOCK_TEMPLATE,
-                            [&qnet](Message& m) { handle_pulse_block_template(m, qnet); })
+                            pulse_counted(PULSE_CMD_BLOCK_TEMPLATE, [&qnet](Message& m) {
+                                handle_pulse_block_template(m, qnet);
+                            }))
                     .add_command(
                             PULSE_CMD_RANDOM_VALUE_HASH,
-                            [&qnet](Message& m) { handle_pulse_random_value_hash(m, qnet); })
+                            pulse_counted(PULSE_CMD_RANDOM_VALUE_HASH, [&qnet](Message& m) {
+                                handle_pulse_random_value_hash(m, qnet);
+                            }))
                     .add_command(
                             PULSE_CMD_RANDOM_VALUE,
-                            [&qnet](Message& m) { handle_pulse_random_value(m, qnet); })
-                    .add_command(PULSE_CMD_SIGNED_BLOCK, [&qnet](Message& m) {
-                        handle_pulse_signed_block(m, qnet);
-                    });
+                            pulse_counted(PULSE_CMD_RANDOM_VALUE, [&qnet](Message& m) {
+                                handle_pulse_random_value(m, qnet);
+                            }))
+                    .add_command(
+                            PULSE_CMD_SIGNED_BLOCK,
+                            pulse_counted(PULSE_CMD_SIGNED_BLOCK, [&qnet](Message& m) {
+                                handle_pulse_signed_block(m, qnet);
+                            }));
         }
 
         // bl.*: responses to blinks sent from quorum members back to the node who submitted the
@@ -2138,14 +2368,14 @@ namespace {
                 // only sent by the entry point service nodes into the quorum to let it know the tx
                 // verification has not started from that node.  It does not necessarily indicate a
                 // failure unless all entry point attempts return the same.
-                .add_command("nostart", handle_blink_not_started)
+                .add_command("nostart", counted("bl", "nostart", handle_blink_not_started))
                 // Message send back from the entry SNs back to the initiator that the Blink tx has
                 // been rejected: that is, enough signed rejections have occured that the Blink tx
                 // cannot be accepted.
-                .add_command("bad", handle_blink_failure)
+                .add_command("bad", counted("bl", "bad", handle_blink_failure))
                 // Sends a message from the entry SNs back to the initiator that the Blink tx has
                 // been accepted and validated and is being broadcast to the network.
-                .add_command("good", handle_blink_success);
+                .add_command("good", counted("bl", "good", handle_blink_success));
 
         // Compatibility aliases.  No longer used since 7.1.4, but can still be received from
         // previous 7.1.x nodes. Transition plan: 8.1.0: keep the aliases (so the 7.1.x nodes still
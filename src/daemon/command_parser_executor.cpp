@@ -806,6 +806,33 @@ show_list:
     return true;
 }
 
+bool command_parser_executor::profile(const std::vector<std::string>& args) {
+    if (args.empty() || args.size() > 3) {
+        std::cout << "use: profile on|off|folded|chrome [SECONDS] [FILE]" << std::endl;
+        return false;
+    }
+
+    if (args[0] == "on" || args[0] == "off") {
+        if (args.size() > 1) {
+            std::cout << "use: profile on|off" << std::endl;
+            return false;
+        }
+        return m_executor.profile(args[0] == "on", "", 0, "");
+    }
+    if (args[0] != "folded" && args[0] != "chrome") {
+        std::cout << "Invalid profile command '" << args[0]
+                  << "': expected on, off, folded, or chrome" << std::endl;
+        return false;
+    }
+
+    uint32_t seconds = 10;
+    if (args.size() > 1 && !tools::parse_int(args[1], seconds)) {
+        std::cout << "Invalid number of seconds: " << args[1] << std::endl;
+        return false;
+    }
+    return m_executor.profile(std::nullopt, args[0], seconds, args.size() > 2 ? args[2] : "");
+}
+
 bool command_parser_executor::claim_rewards(const std::vector<std::string>& args) {
     if (args.size() != 1) {
         tools::fail_msg_writer("Invalid arguments.  Expected: claim_rewards <eth_address>\n");
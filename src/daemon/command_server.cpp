@@ -301,6 +301,13 @@ or "default" to return the limit to its default value.)");
             [this](const auto& x) { return m_parser.flush_cache(x); },
             "flush_cache [bad-txs] [bad-blocks]",
             "Flush the specified cache(s).");
+    m_command_lookup.set_handler(
+            "profile",
+            [this](const auto& x) { return m_parser.profile(x); },
+            "profile on|off|folded|chrome [SECONDS] [FILE]",
+            "Enable or disable the built-in profiler, or print (or write to FILE) the samples it "
+            "recorded in the last SECONDS seconds (default 10) as folded stacks (for "
+            "flamegraph.pl) or as Chrome trace JSON (for chrome://tracing or Perfetto).");
     m_command_lookup.set_handler(
             "claim_rewards",
             [this](const auto& x) { return m_parser.claim_rewards(x); },
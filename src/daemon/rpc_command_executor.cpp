@@ -50,6 +50,7 @@
 
 #include "checkpoints/checkpoints.h"
 #include "common/exception.h"
+#include "common/file.h"
 #include "common/median.h"
 #include "common/password.h"
 #include "common/pruning.h"
@@ -780,6 +781,23 @@ bool rpc_command_executor::print_net_stats() {
                 tools::get_human_readable_bytes(lim));
     }
 
+    if (stats.contains("total_writes_out")) {
+        auto writes = stats["total_writes_out"].get<uint64_t>();
+        auto messages = stats["total_messages_out"].get<uint64_t>();
+        auto bytes = stats["total_bytes_out"].get<uint64_t>();
+        tools::success_msg_writer(
+                "Sent {} messages in {} socket writes ({:.2f} messages, {} per write)",
+                messages,
+                writes,
+                writes ? messages / (double)writes : 0.0,
+                tools::get_human_readable_bytes(writes ? bytes / writes : 0));
+    }
+
+    if (stats.contains("incoming_tx_parses_skipped"))
+        tools::success_msg_writer(
+                "Skipped parsing {} already-known incoming transactions",
+                stats["incoming_tx_parses_skipped"].get<uint64_t>());
+
     return true;
 }
 
@@ -2157,6 +2175,44 @@ bool rpc_command_executor::flush_cache(bool bad_txs, bool bad_blocks) {
     return true;
 }
 
+bool rpc_command_executor::profile(
+        std::optional<bool> enable, std::string format, uint32_t seconds, std::string file) {
+    json params{{"seconds", seconds}};
+    if (enable)
+        params["enable"] = *enable;
+    if (!format.empty())
+        params["format"] = format;
+
+    auto maybe_profile = try_running(
+            [&] { return invoke<PROFILE>(std::move(params)); }, "Failed to query profiler");
+    if (!maybe_profile)
+        return false;
+    auto& res = *maybe_profile;
+
+    if (format.empty()) {
+        tools::success_msg_writer(
+                "Profiler {}", res["enabled"].get<bool>() ? "enabled" : "disabled");
+        return true;
+    }
+
+    const auto& profile = res["profile"].get_ref<const std::string&>();
+    if (file.empty())
+        tools::msg_writer("{}", profile);
+    else if (!tools::dump_file(tools::utf8_path(file), profile)) {
+        tools::fail_msg_writer("Failed to write profile to {}", file);
+        return false;
+    }
+    tools::success_msg_writer(
+            "{} samples from the last {}s{}{}",
+            res["samples"].get<uint64_t>(),
+            seconds,
+            file.empty() ? "" : " written to ",
+            file);
+    if (!res["enabled"].get<bool>())
+        tools::msg_writer("Note: the profiler is not enabled; use `profile on` to enable it");
+    return true;
+}
+
 bool rpc_command_executor::claim_rewards(std::string_view address) {
     if (address.starts_with("0x"))
         address.remove_prefix(2);
@@ -266,6 +266,8 @@ class rpc_command_executor final {
 
     bool flush_cache(bool bad_txs, bool invalid_blocks);
 
+    bool profile(std::optional<bool> enable, std::string format, uint32_t seconds, std::string file);
+
     bool claim_rewards(std::string_view address);
 
     bool version();
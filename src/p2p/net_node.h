@@ -340,6 +340,7 @@ class node_server
             std::vector<std::pair<epee::net_utils::zone, boost::uuids::uuid>> connections);
     virtual epee::net_utils::zone send_txs(
             std::vector<std::string> txs,
+            std::vector<crypto::hash> tx_hashes,
             const epee::net_utils::zone origin,
             const boost::uuids::uuid& source,
             const bool pad_txs);
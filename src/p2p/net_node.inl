@@ -1320,7 +1320,7 @@ template <class t_payload_net_handler>
 bool node_server<t_payload_net_handler>::make_new_connection_from_peerlist(
         network_zone& zone, bool use_white_list) {
 
-    std::set<size_t> tried_peers;
+    std::set<epee::net_utils::network_address> tried_peers;
 
     constexpr auto ipv4_type_id = epee::net_utils::ipv4_network_address::get_type_id();
 
@@ -1353,12 +1353,17 @@ bool node_server<t_payload_net_handler>::make_new_connection_from_peerlist(
                         return true;
                     });
 
-        std::deque<std::pair<size_t, bool>> filtered;  // {index, is_duplicate_slash16_network}
-        size_t idx = 0;
+        // Candidates are copied out in one pass under a shared peerlist lock, rather than being
+        // looked up again by index afterwards (which needs the lock again for each lookup and can
+        // return a different peer if the list changed in between).
+        std::deque<std::pair<peerlist_entry, bool>>
+                filtered;  // {peer, is_duplicate_slash16_network}
         zone.m_peerlist.foreach (
                 use_white_list,
-                [this, &seen, &filtered, &idx, next_needed_pruning_stripe](
+                [this, &seen, &filtered, &tried_peers, next_needed_pruning_stripe](
                         const peerlist_entry& pe) {
+                    if (tried_peers.count(pe.adr))
+                        return true;
                     // Skip peers we're already connected to:
                     if (seen.peer.count(pe.id) || seen.addr.count(pe.adr))
                         return true;
@@ -1375,12 +1380,11 @@ bool node_server<t_payload_net_handler>::make_new_connection_from_peerlist(
                                     0x0000ffff);
 
                     if (next_needed_pruning_stripe == 0 || pe.pruning_seed == 0)
-                        filtered.emplace_back(idx, have_net16);
+                        filtered.emplace_back(pe, have_net16);
                     else if (
                             next_needed_pruning_stripe ==
                             tools::get_pruning_stripe(pe.pruning_seed))
-                        filtered.emplace_front(idx, have_net16);
-                    ++idx;
+                        filtered.emplace_front(pe, have_net16);
                     return true;
                 });
 
@@ -1395,8 +1399,8 @@ bool node_server<t_payload_net_handler>::make_new_connection_from_peerlist(
 
         // Partition our filtered list to move all peers with /16s to which we are already to the
         // end of the peer list where they are much less likely to be selected:
-        std::stable_partition(filtered.begin(), filtered.end(), [](const auto& idx_dupenet) {
-            return !idx_dupenet.second;
+        std::stable_partition(filtered.begin(), filtered.end(), [](const auto& pe_dupenet) {
+            return !pe_dupenet.second;
         });
 
         if (use_white_list) {
@@ -1409,13 +1413,12 @@ bool node_server<t_payload_net_handler>::make_new_connection_from_peerlist(
                 const auto na = m_used_stripe_peers[next_needed_pruning_stripe - 1].front();
                 m_used_stripe_peers[next_needed_pruning_stripe - 1].pop_front();
                 for (size_t i = 0; i < filtered.size(); ++i) {
-                    peerlist_entry pe;
-                    if (zone.m_peerlist.get_white_peer_by_index(pe, filtered[i].first) && pe.adr == na) {
+                    if (filtered[i].first.adr == na) {
                         log::debug(
                                 logcat,
                                 "Reusing stripe {} peer {}",
                                 next_needed_pruning_stripe,
-                                pe.adr.str());
+                                na.str());
                         random_index = i;
                         break;
                     }
@@ -1426,22 +1429,8 @@ bool node_server<t_payload_net_handler>::make_new_connection_from_peerlist(
 
         CHECK_AND_ASSERT_MES(
                 random_index < filtered.size(), false, "random_index < filtered.size() failed!!");
-        random_index = filtered[random_index].first;
-        CHECK_AND_ASSERT_MES(
-                random_index < (use_white_list ? zone.m_peerlist.get_white_peers_count()
-                                               : zone.m_peerlist.get_gray_peers_count()),
-                false,
-                "random_index < peers size failed!!");
-
-        if (tried_peers.count(random_index))
-            continue;
-
-        tried_peers.insert(random_index);
-        peerlist_entry pe{};
-        bool r = use_white_list ? zone.m_peerlist.get_white_peer_by_index(pe, random_index)
-                                : zone.m_peerlist.get_gray_peer_by_index(pe, random_index);
-        CHECK_AND_ASSERT_MES(
-                r, false, "Failed to get random peer from peerlist(white:{})", use_white_list);
+        const peerlist_entry pe = std::move(filtered[random_index].first);
+        tried_peers.insert(pe.adr);
 
         log::debug(
                 logcat,
@@ -1937,7 +1926,7 @@ int node_server<t_payload_net_handler>::handle_get_support_flags(
         COMMAND_REQUEST_SUPPORT_FLAGS::request& /*arg*/,
         COMMAND_REQUEST_SUPPORT_FLAGS::response& rsp,
         p2p_connection_context& /*context*/) {
-    rsp.support_flags = 0;
+    rsp.support_flags = cryptonote::p2p::SUPPORT_FLAGS;
     return 1;
 }
 //-----------------------------------------------------------------------------------
@@ -1955,6 +1944,9 @@ bool node_server<t_payload_net_handler>::relay_notify_to_list(
         const epee::span<const uint8_t> data_buff,
         std::vector<std::pair<epee::net_utils::zone, boost::uuids::uuid>> connections) {
     std::sort(connections.begin(), connections.end());
+    // Every connection gets the same bytes, so build the levin message once and queue that shared
+    // buffer on each of them rather than having each connection copy the payload.
+    epee::shared_sv message{epee::levin::make_notify(command, data_buff)};
     auto zone = m_network_zones.begin();
     for (const auto& c_id : connections) {
         for (;;) {
@@ -1968,7 +1960,7 @@ bool node_server<t_payload_net_handler>::relay_notify_to_list(
             ++zone;
         }
         if (zone->first == c_id.first)
-            zone->second.m_net_server.get_config_object().notify(command, data_buff, c_id.second);
+            zone->second.m_net_server.get_config_object().send(message, c_id.second);
     }
     return true;
 }
@@ -1976,14 +1968,19 @@ bool node_server<t_payload_net_handler>::relay_notify_to_list(
 template <class t_payload_net_handler>
 epee::net_utils::zone node_server<t_payload_net_handler>::send_txs(
         std::vector<std::string> txs,
+        std::vector<crypto::hash> tx_hashes,
         const epee::net_utils::zone origin,
         const boost::uuids::uuid& source,
         const bool pad_txs) {
     namespace enet = epee::net_utils;
 
-    const auto send = [&txs, &source, pad_txs](std::pair<const enet::zone, network_zone>& network) {
+    const auto send = [&txs, &tx_hashes, &source, pad_txs](
+                              std::pair<const enet::zone, network_zone>& network) {
         if (network.second.m_notifier.send_txs(
-                    std::move(txs), source, (pad_txs || network.first != enet::zone::public_)))
+                    std::move(txs),
+                    source,
+                    (pad_txs || network.first != enet::zone::public_),
+                    std::move(tx_hashes)))
             return network.first;
         return enet::zone::invalid;
     };
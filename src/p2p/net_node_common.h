@@ -34,6 +34,7 @@
 #include <utility>
 #include <vector>
 
+#include "crypto/hash.h"
 #include "epee/net/enums.h"
 #include "epee/net/net_utils_base.h"
 #include "p2p_protocol_defs.h"
@@ -51,6 +52,7 @@ struct i_p2p_endpoint {
             std::vector<std::pair<epee::net_utils::zone, boost::uuids::uuid>> connections) = 0;
     virtual epee::net_utils::zone send_txs(
             std::vector<std::string> txs,
+            std::vector<crypto::hash> tx_hashes,
             const epee::net_utils::zone origin,
             const boost::uuids::uuid& source,
             const bool pad_txs) = 0;
@@ -91,6 +93,7 @@ struct p2p_endpoint_stub : public i_p2p_endpoint<t_connection_context> {
     }
     virtual epee::net_utils::zone send_txs(
             std::vector<std::string> txs,
+            std::vector<crypto::hash> tx_hashes,
             const epee::net_utils::zone origin,
             const boost::uuids::uuid& source,
             const bool pad_txs) {
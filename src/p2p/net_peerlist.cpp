@@ -241,13 +241,13 @@ bool peerlist_manager::init(peerlist_types&& peers, bool allow_local_ip) {
 
 void peerlist_manager::get_peerlist(
         std::vector<peerlist_entry>& pl_gray, std::vector<peerlist_entry>& pl_white) {
-    std::lock_guard lock{m_peerlist_lock};
+    std::shared_lock lock{m_peerlist_lock};
     copy_peers(pl_gray, m_peers_gray.get<by_addr>());
     copy_peers(pl_white, m_peers_white.get<by_addr>());
 }
 
 void peerlist_manager::get_peerlist(peerlist_types& peers) {
-    std::lock_guard lock{m_peerlist_lock};
+    std::shared_lock lock{m_peerlist_lock};
     peers.white.reserve(peers.white.size() + m_peers_white.size());
     peers.gray.reserve(peers.gray.size() + m_peers_gray.size());
     peers.anchor.reserve(peers.anchor.size() + m_peers_anchor.size());
@@ -277,31 +277,33 @@ bool peerlist_manager::merge_peerlist(
         const std::function<bool(const peerlist_entry&)>& f) {
     std::unique_lock lock{m_peerlist_lock};
     for (const peerlist_entry& be : outer_bs) {
-        if (!f || f(be))
-            append_with_peer_gray(be);
+        if ((!f || f(be)) && is_host_allowed(be.adr))
+            append_with_peer_gray_locked(be);
     }
     // delete extra elements
     trim_gray_peerlist();
     return true;
 }
 //--------------------------------------------------------------------------------------------------
+const peerlist_entry& peerlist_manager::get_peer_by_index(const peers_indexed& peers, size_t i) {
+    return *peers.get<by_time>().nth(peers.size() - 1 - i);
+}
+//--------------------------------------------------------------------------------------------------
 bool peerlist_manager::get_white_peer_by_index(peerlist_entry& p, size_t i) {
-    std::unique_lock lock{m_peerlist_lock};
+    std::shared_lock lock{m_peerlist_lock};
     if (i >= m_peers_white.size())
         return false;
 
-    peers_indexed::index<by_time>::type& by_time_index = m_peers_white.get<by_time>();
-    p = *std::prev(by_time_index.end(), i + 1);
+    p = get_peer_by_index(m_peers_white, i);
     return true;
 }
 //--------------------------------------------------------------------------------------------------
 bool peerlist_manager::get_gray_peer_by_index(peerlist_entry& p, size_t i) {
-    std::unique_lock lock{m_peerlist_lock};
+    std::shared_lock lock{m_peerlist_lock};
     if (i >= m_peers_gray.size())
         return false;
 
-    peers_indexed::index<by_time>::type& by_time_index = m_peers_gray.get<by_time>();
-    p = *std::prev(by_time_index.end(), i + 1);
+    p = get_peer_by_index(m_peers_gray, i);
     return true;
 }
 //--------------------------------------------------------------------------------------------------
@@ -318,7 +320,7 @@ bool peerlist_manager::is_host_allowed(const epee::net_utils::network_address& a
 //--------------------------------------------------------------------------------------------------
 bool peerlist_manager::get_peerlist_head(
         std::vector<peerlist_entry>& bs_head, bool anonymize, uint32_t depth) {
-    std::unique_lock lock{m_peerlist_lock};
+    std::shared_lock lock{m_peerlist_lock};
     auto& by_time_index = m_peers_white.get<by_time>();
     uint32_t cnt = 0;
 
@@ -358,7 +360,6 @@ bool peerlist_manager::get_peerlist_head(
 bool peerlist_manager::set_peer_just_seen(
         peerid_type peer, const epee::net_utils::network_address& addr, uint32_t pruning_seed) {
     TRY_ENTRY();
-    std::lock_guard lock{m_peerlist_lock};
     // find in white list
     peerlist_entry ple;
     ple.adr = addr;
@@ -374,7 +375,13 @@ bool peerlist_manager::append_with_peer_white(const peerlist_entry& ple) {
     if (!is_host_allowed(ple.adr))
         return true;
 
-    std::lock_guard lock{m_peerlist_lock};
+    std::unique_lock lock{m_peerlist_lock};
+    append_with_peer_white_locked(ple);
+    return true;
+    CATCH_ENTRY("peerlist_manager::append_with_peer_white()", false);
+}
+//--------------------------------------------------------------------------------------------------
+void peerlist_manager::append_with_peer_white_locked(const peerlist_entry& ple) {
     // find in white list
     auto by_addr_it_wt = m_peers_white.get<by_addr>().find(ple.adr);
     if (by_addr_it_wt == m_peers_white.get<by_addr>().end()) {
@@ -396,8 +403,6 @@ bool peerlist_manager::append_with_peer_white(const peerlist_entry& ple) {
     if (by_addr_it_gr != m_peers_gray.get<by_addr>().end()) {
         m_peers_gray.erase(by_addr_it_gr);
     }
-    return true;
-    CATCH_ENTRY("peerlist_manager::append_with_peer_white()", false);
 }
 //--------------------------------------------------------------------------------------------------
 bool peerlist_manager::append_with_peer_gray(const peerlist_entry& ple) {
@@ -405,11 +410,17 @@ bool peerlist_manager::append_with_peer_gray(const peerlist_entry& ple) {
     if (!is_host_allowed(ple.adr))
         return true;
 
-    std::lock_guard lock{m_peerlist_lock};
+    std::unique_lock lock{m_peerlist_lock};
+    append_with_peer_gray_locked(ple);
+    return true;
+    CATCH_ENTRY("peerlist_manager::append_with_peer_gray()", false);
+}
+//--------------------------------------------------------------------------------------------------
+void peerlist_manager::append_with_peer_gray_locked(const peerlist_entry& ple) {
     // find in white list
     auto by_addr_it_wt = m_peers_white.get<by_addr>().find(ple.adr);
     if (by_addr_it_wt != m_peers_white.get<by_addr>().end())
-        return true;
+        return;
 
     // update gray list
     auto by_addr_it_gr = m_peers_gray.get<by_addr>().find(ple.adr);
@@ -427,14 +438,12 @@ bool peerlist_manager::append_with_peer_gray(const peerlist_entry& ple) {
                                                        // incoming peer list are untrusted
         m_peers_gray.replace(by_addr_it_gr, new_ple);
     }
-    return true;
-    CATCH_ENTRY("peerlist_manager::append_with_peer_gray()", false);
 }
 //--------------------------------------------------------------------------------------------------
 bool peerlist_manager::append_with_peer_anchor(const anchor_peerlist_entry& ple) {
     TRY_ENTRY();
 
-    std::lock_guard lock{m_peerlist_lock};
+    std::unique_lock lock{m_peerlist_lock};
 
     auto by_addr_it_anchor = m_peers_anchor.get<by_addr>().find(ple.adr);
 
@@ -450,16 +459,13 @@ bool peerlist_manager::append_with_peer_anchor(const anchor_peerlist_entry& ple)
 bool peerlist_manager::get_random_gray_peer(peerlist_entry& pe) {
     TRY_ENTRY();
 
-    std::lock_guard lock{m_peerlist_lock};
+    std::shared_lock lock{m_peerlist_lock};
 
     if (m_peers_gray.empty()) {
         return false;
     }
 
-    size_t random_index = crypto::rand_idx(m_peers_gray.size());
-
-    peers_indexed::index<by_time>::type& by_time_index = m_peers_gray.get<by_time>();
-    pe = *std::prev(by_time_index.end(), random_index + 1);
+    pe = get_peer_by_index(m_peers_gray, crypto::rand_idx(m_peers_gray.size()));
 
     return true;
 
@@ -469,7 +475,7 @@ bool peerlist_manager::get_random_gray_peer(peerlist_entry& pe) {
 bool peerlist_manager::remove_from_peer_white(const peerlist_entry& pe) {
     TRY_ENTRY();
 
-    std::lock_guard lock{m_peerlist_lock};
+    std::unique_lock lock{m_peerlist_lock};
 
     peers_indexed::index_iterator<by_addr>::type iterator =
             m_peers_white.get<by_addr>().find(pe.adr);
@@ -486,7 +492,7 @@ bool peerlist_manager::remove_from_peer_white(const peerlist_entry& pe) {
 bool peerlist_manager::remove_from_peer_gray(const peerlist_entry& pe) {
     TRY_ENTRY();
 
-    std::lock_guard lock{m_peerlist_lock};
+    std::unique_lock lock{m_peerlist_lock};
 
     peers_indexed::index_iterator<by_addr>::type iterator =
             m_peers_gray.get<by_addr>().find(pe.adr);
@@ -503,7 +509,7 @@ bool peerlist_manager::remove_from_peer_gray(const peerlist_entry& pe) {
 bool peerlist_manager::get_and_empty_anchor_peerlist(std::vector<anchor_peerlist_entry>& apl) {
     TRY_ENTRY();
 
-    std::lock_guard lock{m_peerlist_lock};
+    std::unique_lock lock{m_peerlist_lock};
 
     auto begin = m_peers_anchor.get<by_time>().begin();
     auto end = m_peers_anchor.get<by_time>().end();
@@ -520,7 +526,7 @@ bool peerlist_manager::get_and_empty_anchor_peerlist(std::vector<anchor_peerlist
 bool peerlist_manager::remove_from_peer_anchor(const epee::net_utils::network_address& addr) {
     TRY_ENTRY();
 
-    std::lock_guard lock{m_peerlist_lock};
+    std::unique_lock lock{m_peerlist_lock};
 
     anchor_peers_indexed::index_iterator<by_addr>::type iterator =
             m_peers_anchor.get<by_addr>().find(addr);
@@ -33,11 +33,13 @@
 #include <boost/multi_index/identity.hpp>
 #include <boost/multi_index/member.hpp>
 #include <boost/multi_index/ordered_index.hpp>
+#include <boost/multi_index/ranked_index.hpp>
 #include <boost/multi_index_container.hpp>
 #include <iosfwd>
 #include <list>
 #include <mutex>
 #include <optional>
+#include <shared_mutex>
 #include <string>
 #include <vector>
 
@@ -95,11 +97,11 @@ class peerlist_manager {
   public:
     bool init(peerlist_types&& peers, bool allow_local_ip);
     size_t get_white_peers_count() {
-        std::lock_guard lock{m_peerlist_lock};
+        std::shared_lock lock{m_peerlist_lock};
         return m_peers_white.size();
     }
     size_t get_gray_peers_count() {
-        std::lock_guard lock{m_peerlist_lock};
+        std::shared_lock lock{m_peerlist_lock};
         return m_peers_gray.size();
     }
     bool merge_peerlist(
@@ -166,8 +168,9 @@ class peerlist_manager {
                                     peerlist_entry,
                                     epee::net_utils::network_address,
                                     &peerlist_entry::adr>>,
-                    // sort by peerlist_entry::last_seen<
-                    boost::multi_index::ordered_non_unique<
+                    // sort by peerlist_entry::last_seen; ranked so that looking up the i-th most
+                    // recent peer (for random peer selection) is O(log n) rather than O(n)
+                    boost::multi_index::ranked_non_unique<
                             boost::multi_index::tag<by_time>,
                             boost::multi_index::
                                     member<peerlist_entry, int64_t, &peerlist_entry::last_seen>>>>;
@@ -191,11 +194,19 @@ class peerlist_manager {
                                     &anchor_peerlist_entry::first_seen>>>>;
 
   private:
+    // The following require that the caller holds an exclusive lock on m_peerlist_lock
     void trim_white_peerlist();
     void trim_gray_peerlist();
+    void append_with_peer_white_locked(const peerlist_entry& pr);
+    void append_with_peer_gray_locked(const peerlist_entry& pr);
+
+    // Returns the i-th most recently seen peer of `peers`; the caller must hold (at least) a
+    // shared lock on m_peerlist_lock and ensure that i < peers.size().
+    static const peerlist_entry& get_peer_by_index(const peers_indexed& peers, size_t i);
 
     friend class boost::serialization::access;
-    std::recursive_mutex m_peerlist_lock;
+    // Exclusive for modifications; shared for lookups (i.e. the connection maker's peer selection)
+    std::shared_mutex m_peerlist_lock;
     std::string m_config_folder;
     bool m_allow_local_ip;
 
@@ -206,7 +217,7 @@ class peerlist_manager {
 //--------------------------------------------------------------------------------------------------
 template <typename F>
 bool peerlist_manager::foreach (bool white, const F& f) {
-    std::lock_guard lock{m_peerlist_lock};
+    std::shared_lock lock{m_peerlist_lock};
     auto& by_time_index = white ? m_peers_white.get<by_time>() : m_peers_gray.get<by_time>();
     for (auto it = by_time_index.rbegin(); it != by_time_index.rend(); ++it)
         if (!f(*it))
@@ -33,7 +33,7 @@
 #include "epee/misc_log_ex.h"
 #include <logging/oxen_logger.h>
 #include "epee/span.h"
-#include "common/varint.h"
+#include <mutex>
 #include "cryptonote_config.h"
 extern "C"
 {
@@ -42,6 +42,7 @@ extern "C"
 #include "rctOps.h"
 #include "multiexp.h"
 #include "bulletproofs.h"
+#include "bulletproofs_generators.h"
 
 //#define DEBUG_BP
 
@@ -60,8 +61,9 @@ static rct::key inner_product(const rct::keyV &a, const rct::keyV &b);
 
 static constexpr size_t maxN = 64;
 static constexpr size_t maxM = cryptonote::TX_BULLETPROOF_MAX_OUTPUTS;
-static rct::key Hi[maxN*maxM], Gi[maxN*maxM];
-static ge_p3 Hi_p3[maxN*maxM], Gi_p3[maxN*maxM];
+static_assert(maxN*maxM == BULLETPROOF_GENERATORS, "bulletproofs_generators.c needs to be regenerated");
+static const ge_p3 (&Hi_p3)[maxN*maxM] = bulletproof_Hi_p3;
+static const ge_p3 (&Gi_p3)[maxN*maxM] = bulletproof_Gi_p3;
 static std::shared_ptr<straus_cached_data> straus_HiGi_cache;
 static std::shared_ptr<pippenger_cached_data> pippenger_HiGi_cache;
 static const rct::key TWO = { {0x02, 0x00, 0x00,0x00 , 0x00, 0x00, 0x00,0x00 , 0x00, 0x00, 0x00,0x00 , 0x00, 0x00, 0x00,0x00 , 0x00, 0x00, 0x00,0x00 , 0x00, 0x00, 0x00,0x00 , 0x00, 0x00, 0x00,0x00 , 0x00, 0x00, 0x00,0x00  } };
@@ -70,7 +72,7 @@ static const rct::key MINUS_INV_EIGHT = { { 0x74, 0xa4, 0x19, 0x7a, 0xf0, 0x7d,
 static const rct::keyV oneN = vector_dup(rct::identity(), maxN);
 static const rct::keyV twoN = vector_powers(TWO, maxN);
 static const rct::key ip12 = inner_product(oneN, twoN);
-static std::mutex init_mutex;
+static std::once_flag init_once;
 
 static inline rct::key multiexp(const std::vector<MultiexpData> &data, size_t HiGi_size)
 {
@@ -88,48 +90,26 @@ static inline bool is_reduced(const rct::key &scalar)
   return sc_check(scalar.bytes) == 0;
 }
 
-static rct::key get_exponent(const rct::key &base, size_t idx)
-{
-  static const std::string domain_separator(cryptonote::hashkey::BULLETPROOF_EXPONENT);
-  std::string hashed = std::string((const char*)base.bytes, sizeof(base)) + domain_separator + tools::get_varint_data(idx);
-  rct::key e;
-  ge_p3 e_p3;
-  rct::hash_to_p3(e_p3, rct::hash2rct(crypto::cn_fast_hash(hashed.data(), hashed.size())));
-  ge_p3_tobytes(e.bytes, &e_p3);
-  CHECK_AND_ASSERT_THROW_MES(!(e == rct::identity()), "Exponent is point at infinity");
-  return e;
-}
-
+// The Hi/Gi generators themselves are precomputed (see bulletproofs_generators.c); this just builds
+// the multiexp caches from them on first use.
 static void init_exponents()
 {
-  std::lock_guard lock{init_mutex};
-
-  static bool init_done = false;
-  if (init_done)
-    return;
-  std::vector<MultiexpData> data;
-  data.reserve(maxN*maxM*2);
-  for (size_t i = 0; i < maxN*maxM; ++i)
-  {
-    Hi[i] = get_exponent(rct::H, i * 2);
-    CHECK_AND_ASSERT_THROW_MES(ge_frombytes_vartime(&Hi_p3[i], Hi[i].bytes) == 0, "ge_frombytes_vartime failed");
-    Gi[i] = get_exponent(rct::H, i * 2 + 1);
-    CHECK_AND_ASSERT_THROW_MES(ge_frombytes_vartime(&Gi_p3[i], Gi[i].bytes) == 0, "ge_frombytes_vartime failed");
-
-    data.push_back({rct::zero(), Gi_p3[i]});
-    data.push_back({rct::zero(), Hi_p3[i]});
-  }
+  std::call_once(init_once, [] {
+    std::vector<MultiexpData> data;
+    data.reserve(maxN*maxM*2);
+    for (size_t i = 0; i < maxN*maxM; ++i)
+    {
+      data.push_back({rct::zero(), Gi_p3[i]});
+      data.push_back({rct::zero(), Hi_p3[i]});
+    }
 
-  straus_HiGi_cache = straus_init_cache(data, STRAUS_SIZE_LIMIT);
-  pippenger_HiGi_cache = pippenger_init_cache(data, 0, PIPPENGER_SIZE_LIMIT);
+    straus_HiGi_cache = straus_init_cache(data, STRAUS_SIZE_LIMIT);
+    pippenger_HiGi_cache = pippenger_init_cache(data, 0, PIPPENGER_SIZE_LIMIT);
 
-  //MINFO("Hi/Gi cache size: " << (sizeof(Hi)+sizeof(Gi))/1024 << " kB");
-  //MINFO("Hi_p3/Gi_p3 cache size: " << (sizeof(Hi_p3)+sizeof(Gi_p3))/1024 << " kB");
-  //MINFO("Straus cache size: " << straus_get_cache_size(straus_HiGi_cache)/1024 << " kB");
-  //MINFO("Pippenger cache size: " << pippenger_get_cache_size(pippenger_HiGi_cache)/1024 << " kB");
-  size_t cache_size = (sizeof(Hi)+sizeof(Hi_p3))*2 + straus_get_cache_size(straus_HiGi_cache) + pippenger_get_cache_size(pippenger_HiGi_cache);
-  //MINFO("Total cache size: " << cache_size/1024 << "kB");
-  init_done = true;
+    //MINFO("Hi_p3/Gi_p3 size: " << (sizeof(Hi_p3)+sizeof(Gi_p3))/1024 << " kB");
+    //MINFO("Straus cache size: " << straus_get_cache_size(straus_HiGi_cache)/1024 << " kB");
+    //MINFO("Pippenger cache size: " << pippenger_get_cache_size(pippenger_HiGi_cache)/1024 << " kB");
+  });
 }
 
 /* Given two scalar arrays, construct a vector commitment */
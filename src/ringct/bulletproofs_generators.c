@@ -0,0 +1,2065 @@
+// Generated by utils/bulletproof_generators/gen_bulletproof_generators.c; do not edit.
+//
+// The bulletproof generators Hi[i] = get_exponent(H, 2i), Gi[i] = get_exponent(H, 2i+1),
+// precomputed (in extended coordinates) so that they don't have to be hashed to the curve
+// every time a process first creates or verifies a bulletproof.
+
+#include "bulletproofs_generators.h"
+
+#if BULLETPROOF_GENERATORS != 1024
+#error bulletproofs_generators.c needs to be regenerated
+#endif
+
+const ge_p3 bulletproof_Hi_p3[BULLETPROOF_GENERATORS] = {
+        {{-7442036,-93183,-2572024,10379830,23384977,7298225,28983110,-4720168,7919399,-7758642},{-26822078,-2146269,21887394,15747591,14520875,2985764,-6805214,-14073834,-26193959,6228589},{1,0,0,0,0,0,0,0,0,0},{-23585967,5754490,4390339,-11808166,23512771,-10616454,1520130,-5817031,-27298338,14157164}},
+        {{-22551545,-11535891,2942928,-1054178,1474971,7950607,-7738068,7450263,21514784,-2536541},{5120760,3906686,-31314345,14766315,-5735711,-5742430,29827155,-8565835,25450975,-14932511},{1,0,0,0,0,0,0,0,0,0},{-25547042,2371252,-9109694,-7510489,3754407,-2002546,-20657969,-13810991,28850033,-5069557}},
+        {{9560770,15464559,15031253,34356,28831682,-4585616,-12764401,-2816026,18015754,15305562},{4703631,766320,27515922,14623078,16878576,15528070,25564014,-8166946,25410282,11644852},{1,0,0,0,0,0,0,0,0,0},{-15135907,-11739934,-23632649,-6262117,-4987798,-12200045,-26930242,-14638224,21842769,11606237}},
+        {{-13083201,-2391993,11318071,-11696735,16223401,10112224,-8278062,4906256,-19919951,-13944109},{17043871,3576144,-10339213,4000257,1222200,-7622057,1450753,16456818,25815364,7819015},{1,0,0,0,0,0,0,0,0,0},{-23306439,-3563873,16806611,-9504541,-6705018,-7197481,-10194471,-12788286,-29807465,-13105604}},
+        {{-21866426,-2133455,-31725812,-15307459,25474994,-4113769,-7605261,-2717759,12467546,11926271},{3642922,-2531973,22302207,14302816,-18984872,-12268906,-14268623,12669401,17890084,-2252894},{1,0,0,0,0,0,0,0,0,0},{7779203,12621455,-16126089,1800203,26991051,-11266231,29753143,1971612,-3865577,-8139002}},
+        {{-32638078,479833,-9075621,5772290,-14103143,3886279,-32786121,14768265,1244013,12024303},{28122405,-13272028,20638267,11002463,20073551,-9199331,-17951019,-8270910,-27282747,2977356},{1,0,0,0,0,0,0,0,0,0},{19462876,15779490,16035509,-11755034,6407042,-8551987,-23416348,15891628,-10745935,-3602073}},
+        {{-21128146,2312290,-33412803,-8015849,-8548873,-10637106,20234479,-475883,-9652416,8024249},{-25125752,-14025527,-23468547,3567447,5606596,7127240,-16010277,12243438,-30888425,2638425},{1,0,0,0,0,0,0,0,0,0},{-29016754,-13287790,-23600471,3544573,-4443865,-2602816,10920941,-6220265,8846607,4557884}},
+        {{-3840485,4969370,16703254,3853658,8601570,-8918883,27087678,2275095,-24756944,1675030},{410323,-11453121,20721511,13204543,20476765,14659430,20286654,5073709,10537118,2771880},{1,0,0,0,0,0,0,0,0,0},{-15043171,-2605168,2247598,8906446,5208532,13175608,6361202,-5667844,14383455,-6067204}},
+        {{17347547,-5041709,-3756275,-5309866,-26383128,7939305,25175031,13393197,31476130,-11080468},{13789596,-15796239,30501460,-8363674,-28997203,-7494945,17948785,-14470938,31173151,7238160},{1,0,0,0,0,0,0,0,0,0},{-26280176,-5529858,20156711,15204838,-21266578,9176560,-20795763,-9697470,-25309738,-3178120}},
+        {{-20268563,-10752584,6655667,-12866045,-30136020,-12765615,-17618537,11671770,7411277,7774222},{-4438348,-7486653,-20863825,-12797073,3766025,-413442,19529241,-543153,-32012134,14268861},{1,0,0,0,0,0,0,0,0,0},{33197362,1285311,-5772174,11298967,11318771,12170315,-16329955,-2759906,178521,4227357}},
+        {{-7636125,-1922261,18075072,-12941803,-14930768,-16248102,-2235629,-4490861,27470142,5786517},{16393188,14497016,19138906,-3028365,19849666,12510069,31971594,-8855510,17181805,9815641},{1,0,0,0,0,0,0,0,0,0},{29676873,3997258,-80602,11745812,-1376162,-6609468,31924008,-9285471,-1556064,-9599599}},
+        {{-8162424,6757614,3744921,13778766,15646455,7039531,31267970,3012478,-19020207,13097037},{-9202696,12900444,26287704,6621191,5708991,-45201,29833809,-1727085,3420926,-1300},{1,0,0,0,0,0,0,0,0,0},{2062578,-15677091,28131656,-15092078,-24664399,-2114804,-22506973,-11074631,-4943654,-10157141}},
+        {{29610366,8567540,17098065,16144586,12845163,7804381,-24616817,-9583461,30722738,-15088029},{-10555652,11414742,-9101112,-4614535,24845388,-15686305,-27508028,-14097254,10561594,1486023},{1,0,0,0,0,0,0,0,0,0},{-8357853,2730255,-22298410,940673,25100727,-10340598,-3619036,-3644766,-14875939,-9720630}},
+        {{4702885,-7531203,-2697975,-9178214,-14871468,-4805465,4189282,-9881870,-10480964,11929424},{-30619648,5331481,3019847,-7290920,-25849192,-2694477,4470182,1063646,15628704,7551674},{1,0,0,0,0,0,0,0,0,0},{-12550282,-13753242,7023661,12201545,2199750,-795664,17466168,-4066021,30833562,-4721083}},
+        {{19245965,-5767990,-17286005,6168096,-17885104,8707000,25408539,-14345949,16607619,-7095720},{8411014,465675,10404827,2903089,-22403838,-12086057,-10663782,4055835,880112,-2069918},{1,0,0,0,0,0,0,0,0,0},{10634657,-12707525,-3222703,13008379,32123164,10109233,-6442237,5428667,-1463012,-12726686}},
+        {{-30418489,9086384,14586459,11869944,-15639877,12389757,-12083558,15725831,-28971391,2326495},{-1501014,-4459850,29190049,-12387527,26192144,-6893747,-9838404,-14011810,-28608748,-7199971},{1,0,0,0,0,0,0,0,0,0},{17105734,1174937,-32242226,-351797,14225938,16155199,-33264579,6491149,13380545,4886279}},
+        {{-17145359,7797270,13236926,-12671084,-4065655,-11624422,8306095,-9832166,852839,2213924},{4356643,-11944048,25616253,-4984826,19028322,-9832574,20727417,4871725,-22686257,-2241647},{1,0,0,0,0,0,0,0,0,0},{-33038283,-14473207,18593072,7612409,-2856108,5130185,26889108,-6236938,25001408,-4868097}},
+        {{31787640,-4545322,3366367,6818540,-11576985,14634680,-3784737,-5291731,3059517,13762939},{1261617,3238961,-17289297,7267423,4246858,4304697,9898130,3008157,1368225,-7102366},{1,0,0,0,0,0,0,0,0,0},{-11397919,-14059153,-17120649,-8227839,-30044128,5902291,-13462979,-12752816,-26036063,-4229147}},
+        {{7419925,4391744,-22108326,12638891,-745223,-8330992,14331894,-8267201,25298396,-677428},{4807972,3285164,-21329369,-14645489,-8951121,11577790,-13779055,11163621,-28157395,-3578739},{1,0,0,0,0,0,0,0,0,0},{-6024808,8097814,15448932,-1490615,25557102,4257624,-33260828,-15575332,14962334,-3720352}},
+        {{17557655,-7918795,13533432,-8725984,4960245,1902200,17205411,991627,-19119990,7025459},{32062852,7611975,-24976415,7957448,30977965,-7613172,3871288,374301,22108329,10627100},{1,0,0,0,0,0,0,0,0,0},{10498231,15072429,-21226709,6106550,15960756,-6272901,31665384,7483509,-31256867,-15468004}},
+        {{-475048,9373317,-1729615,-6108247,-7347824,-3892153,-21447637,-5965828,15376185,10320104},{-29709797,-59498,1303255,-9978273,6240329,-7933360,-18654448,-10329391,-17346915,-14048504},{1,0,0,0,0,0,0,0,0,0},{-20630225,-15832350,5653168,-2239447,2053709,-12824409,-27735683,-12935235,24115541,-14787263}},
+        {{-1844184,-13075667,-13822393,-5896958,23716805,-10693660,17452134,-2799587,-26810373,2204157},{-24396034,13276323,-17801993,-12659068,-25905625,2587817,2057951,7513880,-26393694,-15585082},{1,0,0,0,0,0,0,0,0,0},{-8379133,15293322,-1130901,16528489,-12604377,-10993255,11072851,14825734,-867982,812992}},
+        {{-32621780,4467146,-7338164,13581997,6864183,-747003,30078277,-3129955,24106860,-9496554},{7163215,9157719,-2641993,15307810,-1020966,556700,-15136258,4624469,-18639052,-9211106},{1,0,0,0,0,0,0,0,0,0},{7039722,13291843,9204070,-14660651,30153125,-12126376,8466727,1118866,14362385,14503177}},
+        {{22619544,-11226187,-21579909,15156237,-12493889,1348533,-31019950,-11606732,-33012714,-14463963},{-12013871,11033664,5948979,7463459,32234847,-16054786,2363713,-9739092,1002637,-724206},{1,0,0,0,0,0,0,0,0,0},{11768822,-7828558,-21083292,3394163,-12220438,15267096,-13725781,4968362,-7930211,-16114158}},
+        {{-14834245,-9814116,-18720965,14226553,31576678,16697500,3039178,-2918081,-33177606,-12931232},{-21843477,-2317718,-10069385,-6617062,12341896,3032459,-21246903,11197928,-16896989,3785360},{1,0,0,0,0,0,0,0,0,0},{4994776,-13575654,-13444975,4881841,3940995,-14237258,-18108093,-14320391,28574510,6486721}},
+        {{18273760,6758405,19830287,-5126289,9680984,-13663854,-12840800,-3045827,31481989,-6611577},{15059295,-6408266,-22351917,-1672174,32660946,-12143312,-33188274,12426518,-5826062,-8970089},{1,0,0,0,0,0,0,0,0,0},{25382757,6961305,29637009,-15391581,-2786471,10077777,15678711,-3374777,2348607,11181219}},
+        {{-9234652,-8542386,15879901,-8192788,17636669,14423586,13384369,-12023722,30189484,12920884},{15028508,8849708,-17772647,9812168,23024399,-2038362,9424858,-9044633,21508236,14378143},{1,0,0,0,0,0,0,0,0,0},{-33226465,6647966,-29189267,-1761244,6124326,-9265603,-10744690,11439569,5578609,15708380}},
+        {{-21209949,-13791248,-16865437,-2471742,32915333,14124107,25689717,3619167,-32475633,-15584987},{18178119,11395627,8795154,-4405521,-26532515,1194475,-10388364,-8664257,-32887787,5220657},{1,0,0,0,0,0,0,0,0,0},{4631284,-8387444,-4765581,-15303011,1261093,5813000,26566561,2649596,10060296,-309466}},
+        {{14519797,-5581948,-31657547,9746084,20376352,16614779,15662228,8119247,7735435,-4171215},{-6402239,6145534,6976034,-291629,-2859884,4324899,-28426404,-1255708,24089610,-646633},{1,0,0,0,0,0,0,0,0,0},{23603761,-13054366,-3546200,-14320624,18642606,2165720,7263102,-4341419,17920674,-16164666}},
+        {{23069182,-8512578,-11175347,1361873,-8932797,7704527,-28041407,12705417,-1491258,-375117},{-23952897,9152799,19222523,4999995,-12792768,-204196,-23253104,10812486,23281329,4759715},{1,0,0,0,0,0,0,0,0,0},{31908530,5579300,-32044823,16250352,16878486,-15211261,11511472,4536657,-14119787,-5064308}},
+        {{-25047029,11171040,-20169534,2647932,12957885,-1594884,-26809293,-5911288,770174,-11075745},{-24728512,-6291700,-14050631,-8952011,-19201694,-11032242,6921076,16323168,22153750,-11013265},{1,0,0,0,0,0,0,0,0,0},{-18797323,-14065211,6505536,13371183,15551545,13538534,12683668,15981739,-12315396,4218193}},
+        {{21538114,-12238148,15560196,-7225983,312697,-6068401,7294793,-5465543,-25582053,-4319},{2607619,16236889,26723753,-10229773,-11865767,-14966937,14991679,-907969,-17816548,16531847},{1,0,0,0,0,0,0,0,0,0},{2003791,-8724970,-19279723,7184986,17620912,-1440797,-10337927,3555090,33449209,-8164578}},
+        {{306196,7687340,-21977318,1869255,7302954,8242214,-31387763,1299690,-16842321,11437617},{-21105381,10478188,19415251,-11956616,5066329,6260350,12889672,-13490043,8758596,13168791},{1,0,0,0,0,0,0,0,0,0},{-3847284,-11211934,32363365,-1559023,12428736,-13703893,-35411,16664036,-7190367,146683}},
+        {{26178358,13230929,-12732572,4379583,-7285949,4605712,-24720786,-15350642,-814767,7230837},{-3401282,9778723,16478105,-2787824,20087883,-16210993,-77904,470708,29183128,4012525},{1,0,0,0,0,0,0,0,0,0},{-14054926,-4925606,33121477,14490867,-32198070,-819690,27330077,-265286,-9448989,5779042}},
+        {{25998803,-11562996,20928645,9929995,14796309,8546101,20737939,8224986,-23629022,15082005},{-9575314,1518525,-30328798,9762536,9484647,4510315,-9613235,-15644490,19651583,-15855643},{1,0,0,0,0,0,0,0,0,0},{-2916244,14663939,7760348,5453739,8085370,2198956,14289541,-9517224,-5668615,15628634}},
+        {{-32726742,-12950434,20561705,4898472,33449553,13271392,-26219613,5045676,-32958417,6109777},{-15579919,-14923378,8028436,14443494,32474158,-8238741,30743345,3191311,-13034557,-1564498},{1,0,0,0,0,0,0,0,0,0},{-22844850,15459661,5502554,-14651189,-2571234,15171329,11841261,1815259,-15438175,14151708}},
+        {{22233776,3113491,1819365,-7810012,-3639464,-9824130,-23594297,9512764,13610579,10527793},{-16566719,14609219,-4242549,-11746076,32035699,-14719598,7397653,-12642846,-4036615,4229138},{1,0,0,0,0,0,0,0,0,0},{26851973,23673,-7174397,-8948010,-14580130,-13590576,11362680,11565572,24983779,-16003729}},
+        {{25967560,-1399137,-1604899,8445043,25838322,-3609681,27294603,8809116,7764262,-9830528},{17479590,11538188,-14319795,11308567,2578652,15502294,32774474,5190345,-4806699,10366307},{1,0,0,0,0,0,0,0,0,0},{24201242,-5955377,15798717,-878534,-28643740,-11002466,-14930089,-1131652,-23846549,5799384}},
+        {{20251534,-8086556,-22512547,2305038,26021589,13028211,8699316,8137782,32566504,15492996},{1356331,1727526,-8306309,-12195490,13534126,15022622,-4749190,16537648,-27432050,13121760},{1,0,0,0,0,0,0,0,0,0},{-16747976,-8376572,3245359,-2634300,-11151401,-13828729,15099854,6837065,4476779,11547545}},
+        {{-9873707,12433802,-23639176,-14453810,-7568771,201583,2941888,1026974,29961471,-11703897},{14863380,-5403224,-30762382,-8271078,-14714292,-3265689,8612191,-6675924,20295255,-8080902},{1,0,0,0,0,0,0,0,0,0},{4761525,12159179,20813660,12759138,21734738,11985542,-5154682,4066255,1474797,-2662321}},
+        {{11409967,-2933451,-16963394,12732111,16560785,-7269741,-28565306,-13402937,24905300,-3279609},{-20743280,10580506,-22113157,15941109,-3470376,-1223450,18766578,-15110116,-7042897,3789671},{1,0,0,0,0,0,0,0,0,0},{20640207,-10039218,-1668046,1661338,-4929806,11412546,9861759,-9099515,31577187,-1226922}},
+        {{4338017,-9810764,3127982,13179264,25248335,13046087,-385639,1896007,20103451,5737609},{15338667,-8699586,11719066,-13329396,-30646440,-3406601,21487290,6404789,26513749,-13476666},{1,0,0,0,0,0,0,0,0,0},{27070220,10067200,-19693017,16399850,1435862,-15438421,-11033455,6483100,28582305,-3232798}},
+        {{-18439083,-5937924,-16395848,11450315,9655359,12188087,12548479,3258645,14171722,-13560521},{19343399,4627272,20503455,-9350089,-24477362,-6802744,-1147535,-9891294,388237,14807387},{1,0,0,0,0,0,0,0,0,0},{18802153,-4792888,4124309,9049136,-15758456,-11978977,-24258844,-3320697,-16435458,-11939461}},
+        {{33461045,-9059249,28123992,1964636,-2360240,-14918133,-28844202,-12180060,-25577566,-13017935},{19373174,-15387239,30663897,3788683,9237445,-16204900,20178908,7703412,-7532384,13832779},{1,0,0,0,0,0,0,0,0,0},{5261670,12027155,4983421,-14347652,-17073345,-16713128,27958465,-3587225,2694371,11831026}},
+        {{24219495,10217241,7631997,-5468706,-25112724,-11921235,-29112586,15172636,-9027825,-15748560},{23340172,-11748014,2504082,4636314,22186663,-4011507,-3709722,6697093,-6467980,-2655817},{1,0,0,0,0,0,0,0,0,0},{17276243,-16641271,-3230579,-1642490,20204339,-16000801,-15998224,-9367219,24919602,-1854940}},
+        {{20804110,-2848283,-33058476,5068284,-18962851,-3632048,29007064,6951092,-24512488,-7989854},{-9372639,8555053,-13899387,15464770,-23110511,-16520614,-6158146,-10631375,12567171,11548761},{1,0,0,0,0,0,0,0,0,0},{19398720,-13731315,-12049037,-7756679,25572621,-14262764,28385291,-16670194,18612629,-14575519}},
+        {{-20598511,-14729751,-24589311,-13168355,-20854046,-16464001,-8747480,12380372,20503231,11781691},{-33005248,2980268,-31298480,5775345,20852672,-12718738,29564607,5610098,-11918123,8112047},{1,0,0,0,0,0,0,0,0,0},{21691974,15360709,19440374,-9614696,4421085,16148378,7417429,-6872390,2602378,16575081}},
+        {{23309956,12716740,-24617810,-11162955,17601682,9888783,12795284,-2315836,-10675562,-10918617},{14440760,-7503916,1361341,1070817,-7131212,-5138188,-17480865,9259363,31813641,-11243266},{1,0,0,0,0,0,0,0,0,0},{25024074,-16532497,-15772610,-8697138,-9923630,-14796220,22452932,159398,-10157965,11703735}},
+        {{-23956268,-4355861,18303804,1321389,-30158448,-1703835,18292545,-11666855,-27285050,834548},{3136639,14888772,24085211,8517952,8624158,2673369,7421827,12427958,20518854,16061153},{1,0,0,0,0,0,0,0,0,0},{-12137703,-14871369,-12550966,6382077,-4779495,8455353,12916931,11308415,7332855,780777}},
+        {{-358363,1000334,-16496748,16264009,-24610493,-12688065,9835976,-8373204,14589288,16228727},{-1906550,-15581992,-9495553,-16353778,-17372515,-3010843,30924639,-2413691,-6281943,-9203745},{1,0,0,0,0,0,0,0,0,0},{11655907,-3441967,15380741,13407668,28689128,-4126741,-6826207,-5285558,-105638,2365417}},
+        {{-27736611,11265725,21266224,-7312409,12253219,-14881912,31334838,-11303501,5320437,-7894664},{27364337,4397189,-15632950,-2320989,-28173719,-639542,-28963930,14629450,33316607,3288340},{1,0,0,0,0,0,0,0,0,0},{27832953,11159782,-16616345,6216513,-25514491,13790110,31509719,6267051,-27461513,-7130181}},
+        {{-31823950,13109903,22625119,-4254723,-2879499,9571178,17454179,4134593,8114656,-13224848},{6350942,-5111127,30021754,13295171,28166002,11783061,-20386399,-2696042,-33033870,15723494},{1,0,0,0,0,0,0,0,0,0},{26256996,3819741,-29694784,14731574,-28898458,9201285,-32685264,9595857,-30821687,484683}},
+        {{29064274,-5740546,-14538753,-11058549,-22112904,10031487,-8087529,2501943,2462348,14350818},{26946815,-4113493,-20432134,-13534353,11565257,3934965,8065256,-3378939,-7679266,8173400},{1,0,0,0,0,0,0,0,0,0},{-15561337,-5788463,-9494741,180394,-29410337,-13213323,26691178,-12016593,-17970061,-4790196}},
+        {{11155184,-10308800,-22072011,14175831,31610010,8606364,25207862,2112774,-266096,13502203},{-28205173,12669137,-20907372,727373,-5309629,-519294,24511362,8676152,12486649,11629247},{1,0,0,0,0,0,0,0,0,0},{25107507,6489124,4065994,9196353,31816822,6988287,29534709,3007813,15635189,-10760639}},
+        {{10691497,4826458,-30273339,-279815,-15670338,-2317498,22259150,502529,21126911,-10925844},{23309848,4743514,-18523981,-8532807,9611211,-7636387,23771465,-1542514,32785971,-14126124},{1,0,0,0,0,0,0,0,0,0},{-5269952,14643669,32783862,-12441612,-27054450,15994339,-28580156,15970673,20450904,-4314274}},
+        {{27017367,-11893448,-11133324,-3394741,-9361435,15730503,-29089426,-13264227,23696960,-10360764},{-15849650,-4548529,31972413,2815775,-14815990,4910937,-33038214,-7713036,19271730,8195687},{1,0,0,0,0,0,0,0,0,0},{30808619,-13111287,31216482,-7882543,-1169508,-14491062,781216,-569354,-2897894,11668622}},
+        {{-21873325,1316577,32996912,-11603548,25811379,-15178239,-20506605,-6661973,19165708,-12551235},{2723485,-15711005,21162186,-15986456,-18334493,-14920705,29491412,9220405,6323340,15073336},{1,0,0,0,0,0,0,0,0,0},{-21089777,4105975,-25223656,-4665342,11338994,-2348740,-2102543,9224294,-21315645,12179485}},
+        {{30173618,9262556,31296659,13159608,2260360,12976,15551274,-3136401,-25392533,-2968913},{-27146991,8541784,22589274,-15070202,10317800,13943793,-28245142,-8138399,-8491497,-16638163},{1,0,0,0,0,0,0,0,0,0},{-23892263,4799725,13600416,-11660710,-14244403,-978413,5484926,-11956085,-32756331,-12095971}},
+        {{6911614,-6867216,5765208,9424928,-14048987,8559370,16539787,-9377538,7661478,-598556},{-13206004,-2444026,18497470,11407519,16396269,-6145543,15367523,942394,32528588,-15446555},{1,0,0,0,0,0,0,0,0,0},{-17912381,-1017734,18164046,-15877122,10030660,9843748,-3915961,3169705,9432323,1481561}},
+        {{30055882,14655294,-5799861,4751180,14223646,1846540,4543538,7450822,-24321274,11082788},{22570025,8726887,-28626037,9803684,4708268,-14427791,1917346,-16280927,27066574,-13483997},{1,0,0,0,0,0,0,0,0,0},{6056632,7495379,-3934928,12320793,15740142,2412809,-22757368,6810885,-11822734,2245574}},
+        {{-3771268,-16504567,-19334742,6323174,-29758843,-7472652,4991584,15696753,-7364450,12923084},{14433897,5278285,-26554172,-8487230,17830870,-6565191,30540534,3551599,13704370,-5323342},{1,0,0,0,0,0,0,0,0,0},{13058626,10992058,-11138518,13939006,14604176,-14488377,-4662361,-16091190,-11135069,7113487}},
+        {{5071542,-4708079,-3555806,-2970998,-1643238,11146667,-17306215,16623015,-15449477,-9486906},{21349412,-5610878,-32813662,-16316591,32137167,16189480,7624654,15355423,-21423143,4759296},{1,0,0,0,0,0,0,0,0,0},{-5539285,15907336,-15362793,3161137,-6285753,-14207774,-19132264,1131894,9293267,4967733}},
+        {{-7315868,15044306,26743159,2484864,12559126,-16713408,-12728353,-5639532,19166671,-6341927},{2918817,16171628,-29855935,-414077,15464717,9597353,-9708300,-6857024,12956703,4862608},{1,0,0,0,0,0,0,0,0,0},{-11441513,-11454500,19449167,-5542401,-12815098,15551872,-30582568,-1827823,-21984340,16012884}},
+        {{21539271,-8036875,20283689,3569562,-30407045,-3988613,-27781516,-12228138,11616212,6874389},{14515233,8994398,17472077,-7926793,-18738793,12103777,14091584,1232668,-9387361,-10567129},{1,0,0,0,0,0,0,0,0,0},{-26192982,14325599,26320418,-14713077,30198478,-4203682,30926665,6992454,-22972542,16652031}},
+        {{2391478,8505034,-6670211,16264979,-5694431,4839585,-22811257,-13587454,9438209,11154761},{8244657,-298175,12444181,-14437643,-32222768,16261051,-16967499,6209366,24901878,-4927420},{1,0,0,0,0,0,0,0,0,0},{9538032,3151849,18014166,3770513,-24008815,13012474,9018522,-3599095,1353739,-7261037}},
+        {{31123507,-7309731,-32496106,16109558,13798913,6446277,-14024439,10322831,984048,4168179},{-28036521,-11172881,-8460521,-6937733,-4909987,1680195,6059988,-10586931,8021574,5937427},{1,0,0,0,0,0,0,0,0,0},{1072951,-4325566,16085275,-1085532,19096382,-13721826,-23525423,998185,26770617,8568831}},
+        {{1335096,-1052470,9747598,-8517523,33091494,14036176,-32032667,2253959,-26447948,1310443},{-27190583,-9742395,4215365,5755568,-23263866,4824396,32927537,9352554,14920865,9656187},{1,0,0,0,0,0,0,0,0,0},{23954615,-7470306,500557,813907,-19100566,8713123,-15094730,9686403,-8594917,11144850}},
+        {{9354664,-8782299,8993071,14043491,19956281,15028095,-21070909,-2499556,-21829678,3321933},{-6653287,-3088581,-14665758,4188599,-4631105,9860300,-26237927,2880567,-16081033,15749333},{1,0,0,0,0,0,0,0,0,0},{19171512,-8411435,-31031182,-2293543,-26032567,3766717,25014328,12345807,12170332,191887}},
+        {{12406706,-8498355,-242030,-14287056,9016617,6289443,-21595901,-12062412,10614608,-9488639},{-18660721,-10716345,-25477736,-13032797,18925048,16195401,8073714,-5917497,-17214101,5847632},{1,0,0,0,0,0,0,0,0,0},{-17055818,16281124,13265318,-914873,19093967,16696763,3807298,-6759924,-5286266,-2539297}},
+        {{19604946,-13272355,29747155,9705873,-27336456,8090857,17145582,965077,-11930052,58921},{2187005,-9203060,-14329727,-4520904,22982150,-8142490,26182594,10669052,-28489574,13280776},{1,0,0,0,0,0,0,0,0,0},{16300260,-9114989,-7283004,-7468515,-2277376,437306,-5653391,8644425,26986653,9972780}},
+        {{15093075,-5187294,-19088633,-13197441,21669579,10064335,16429950,2956603,-2615058,-5343581},{20675636,-1877839,-33037011,3667451,-7980447,3161613,-21252564,-15408279,13918342,-7163131},{1,0,0,0,0,0,0,0,0,0},{13489781,-11200839,-17829819,-14710815,-11633859,-11694037,-19462695,11363225,25136529,-9092141}},
+        {{-12495799,462065,-876294,-2700233,6026431,-4615355,-385434,9732627,-778074,8409782},{-24170909,15557112,-2950886,-15175860,11873782,13511353,-1178007,-4977738,29663579,-10701405},{1,0,0,0,0,0,0,0,0,0},{31689765,13000265,-28696401,9169451,30823963,13862367,29039526,755339,-18962376,-16454245}},
+        {{-5660424,-3386641,13083093,14504703,-25184382,-205033,-16161136,4391957,13465397,4225575},{3346223,-13664849,-16786214,5510241,-13044637,-13139315,-28837123,-15321455,5865329,12853702},{1,0,0,0,0,0,0,0,0,0},{-22364002,8367572,12625998,-1411543,23057615,2706840,-31009203,-6399924,10215315,5700419}},
+        {{4397953,-6061999,-15471098,8076483,-21777785,-13384575,-7304026,7866199,-20234183,9845631},{-24877526,15902145,21995961,4038977,15039829,907937,-22068243,10223828,-30230294,-11649558},{1,0,0,0,0,0,0,0,0,0},{-18544520,-2420509,8449358,13125950,-21658968,-10876829,14000805,3718131,24219569,-13487116}},
+        {{3120961,-11497952,16808324,8968597,22698102,-6503222,-6536825,-12155618,-29832283,2726827},{-18533246,-7730148,-20521604,10124810,-32558563,-1577428,17754711,-12322895,-797433,-13900613},{1,0,0,0,0,0,0,0,0,0},{-24346188,-565421,13325066,-10392117,20501663,-12050192,442094,-13936048,-2236772,13095894}},
+        {{5376106,-12845927,3949159,-4822357,-12895539,1649872,10983842,-9685013,-3867225,-3661995},{31188309,-4151675,17692298,-7338779,-25116531,-2569745,-20570828,8498207,-18167941,9092947},{1,0,0,0,0,0,0,0,0,0},{17771920,14144293,-350675,12609028,26201795,8900671,15654911,-4744796,17784441,-3004537}},
+        {{-2745045,-16608352,27245241,1545281,-28424480,4907263,-30703646,11123498,18038065,7234258},{-29224108,8980584,-12521413,-1951921,28990846,-13230672,-30463017,-5388003,-16096564,-8072345},{1,0,0,0,0,0,0,0,0,0},{-21157210,-14590236,-1057283,9873694,5443121,5632808,-27588872,12729679,-7565553,-10175651}},
+        {{33027935,5675667,32626375,-11560041,24954716,-959747,-22560883,15399861,-25498269,-8821347},{7261703,246771,6853794,11017282,33482552,-6144051,31399557,10272245,-1152579,-13992150},{1,0,0,0,0,0,0,0,0,0},{-15342551,839398,-28423914,1196222,5127963,2606496,23944902,3140680,-29134182,15294570}},
+        {{-1566861,-13319558,-24129263,-1432460,1056465,-12081227,3785730,-9983259,-31072890,12865919},{6565891,15779050,-29897036,6623873,-221930,12606824,10910267,5108636,-9410534,-16570785},{1,0,0,0,0,0,0,0,0,0},{29246395,16055990,-20270822,-11294645,-14058418,-8053996,-6247981,11045130,15114771,2845467}},
+        {{23920559,-1026128,-27695198,-15676070,26477329,-14695893,-11101559,8267897,9304351,-15339366},{12923614,10173924,13251893,1895301,-13592105,-15333692,27183658,-10958359,-23057310,-5801587},{1,0,0,0,0,0,0,0,0,0},{-25710734,7647813,16101848,8868623,-21783070,6676191,-23660939,15778514,25028011,8123769}},
+        {{9997627,3674470,30581050,6297889,-884118,-1196576,14030491,12097419,-3023195,-10384085},{20828762,9996709,-78477,10752416,19289851,-11327727,30366478,-7107276,-1960453,4241816},{1,0,0,0,0,0,0,0,0,0},{4366537,1717877,-23942903,3597957,32882487,79872,-2075982,-11963607,-11507913,14414440}},
+        {{22944729,-11817424,-5443165,4631931,-12097836,-14703106,30605615,4142783,15711220,-1279932},{30461089,272023,-28841896,14989692,3962384,8530656,20094951,-2489223,-27025938,-14035},{1,0,0,0,0,0,0,0,0,0},{-30185139,-3817852,27157842,5971744,22626139,-13711248,26995145,13310336,-25931261,-16053673}},
+        {{-32771642,351027,-9057727,-6127636,-518157,16430100,27733478,-3473694,-33554212,12895685},{-28151633,8293786,1542089,8819575,12037486,-1559962,-27214331,-14086823,-29408456,-14516030},{1,0,0,0,0,0,0,0,0,0},{11575447,8130113,-13684967,-2949212,12147857,15784960,-13617714,-14944753,-976617,13908455}},
+        {{18067029,-3836820,23602865,16071448,26120891,-4144219,22487839,-3169396,9186574,-3311859},{2170987,-12375316,-24535474,-11744293,-498132,-15168050,-28513100,-9191745,20028584,-2933048},{1,0,0,0,0,0,0,0,0,0},{28819882,10844812,-8005394,-12576467,-10510434,-16363384,-27431868,-10002741,3215388,-6561157}},
+        {{-16853230,5097422,32983147,10142202,-30155393,11278037,-14801072,-5691558,-30334330,-2780511},{-21048448,5864234,26762678,-9816336,22494219,-1009831,31474777,-6987683,18872485,-16512248},{1,0,0,0,0,0,0,0,0,0},{-9277429,8085952,31780357,9616756,-31535838,-13330906,-8315527,6198852,4493141,14307328}},
+        {{32746890,13919975,-6742382,-15028473,10754313,-1348067,24430656,4739121,10439166,-12507092},{-16312654,-14464076,33027309,8261899,9880697,2541244,14391973,-12808624,19184960,-3614680},{1,0,0,0,0,0,0,0,0,0},{15715923,10807268,303525,9800768,-15475247,106840,9081460,-15406821,-28714341,2001898}},
+        {{11984852,5642244,-5176242,-4050654,-2773942,2714348,-33526206,11451769,-18880094,-15889583},{7053159,-11163349,-11099119,-7436540,15562555,3307819,-16283428,7698870,-21670325,-5026452},{1,0,0,0,0,0,0,0,0,0},{21261712,-13861639,9874050,12800567,17602956,-3085088,-26482640,-15436372,29497576,2442739}},
+        {{-12723300,1529403,31026248,514976,-16571605,-6535128,12153226,15002912,-21853083,-11803396},{1465735,-5145203,-32196809,-7010658,-16652887,12060725,9991052,-14396516,11382719,14662464},{1,0,0,0,0,0,0,0,0,0},{6816925,-3809600,22723059,-10932711,-2327165,1722933,7020559,-11714583,32752084,-8113108}},
+        {{-29776880,-7232279,6967694,528831,-15618234,7046298,21838224,-15619959,5648535,4524971},{9312664,1813318,-5727085,14087854,3122739,-137047,27735956,6073154,4319067,-8926161},{1,0,0,0,0,0,0,0,0,0},{-6348001,-7708973,24344353,-12666018,-8192257,-14019647,-20697188,10170949,-9339432,-10795638}},
+        {{25711914,-5424627,-17615961,12808288,-13047868,-7653389,17570835,11100071,30815972,-10148315},{30589897,6474973,-21755081,473196,-22162752,1186757,-16370506,4890038,1939818,-2920312},{1,0,0,0,0,0,0,0,0,0},{-24850552,1960867,-22312222,-1844870,-16993028,-7290811,-16868129,1930271,-16102760,3882457}},
+        {{22463146,-9928408,-22326773,-10633806,12256676,-12728397,-10379052,1579315,-28910942,4620838},{25262749,13635576,-28635325,-12401853,-13902618,4614679,21875833,-15620946,-2350451,-2966271},{1,0,0,0,0,0,0,0,0,0},{18394678,-16521069,-12308365,-15382163,-27011098,-11214121,22109975,-4544866,-20745366,7807895}},
+        {{19359897,11308196,33520260,12997290,9900107,-8828906,18264746,-10244771,14409408,-9658328},{28921243,4109521,31953021,-5822186,-5862640,2618028,-5898130,14456996,24533369,2580405},{1,0,0,0,0,0,0,0,0,0},{-22676205,-16746872,-14264312,13024617,-20978710,-10533419,-16557859,-848776,-23902422,-11907401}},
+        {{18224692,-5624756,-33545414,-11312494,-20735844,6199724,-5788528,1907169,32498087,-8693788},{-25290009,-15012874,-3157571,-9669897,12351374,-2682136,8844732,12399819,-14547679,-11313097},{1,0,0,0,0,0,0,0,0,0},{9489328,-3683044,9019720,-8133472,-84596,-7075599,5004561,4539994,-17176100,-4084490}},
+        {{-22972357,2675035,28976690,-10557994,-26161993,15141547,4268747,-5508445,12568949,-12100292},{11510586,13788756,4154535,7596445,11776485,-7359472,27680215,-16361678,10268783,6286181},{1,0,0,0,0,0,0,0,0,0},{-2792613,1899481,4139257,4089323,-25783568,-468872,-12752177,-6354037,30315197,-2091442}},
+        {{-13000681,12545551,-19036400,5679344,22177903,-9084206,-26762387,-1780554,11875034,14307598},{-10233660,15085574,12764608,-13229286,-4510102,-12240715,-25782545,11264839,-21453136,-521787},{1,0,0,0,0,0,0,0,0,0},{27341997,-4025039,-11621105,7603803,-14969643,-12685041,-30198835,-6550572,12956956,-14828820}},
+        {{-24354972,-11717631,-6052499,-12864198,-23188067,9393655,6499789,8128092,-2039215,-8355649},{28282049,-1113847,20617223,14450078,14781388,-5958882,30230994,3997916,7394850,2097828},{1,0,0,0,0,0,0,0,0,0},{-5350913,-4854259,-16848407,-9476477,-22630056,4331542,-5752585,12793885,-16578650,-11852237}},
+        {{31961741,-608747,-14000468,7973828,25186015,7428024,23677454,-1312678,-12989444,16642624},{23718145,6393899,3457592,-11626531,1832673,13684489,-3276603,-12121918,10033059,4086666},{1,0,0,0,0,0,0,0,0,0},{-15349070,5852077,-14639769,-10324528,-9438319,9914425,-3866411,12267520,-18438793,-7972475}},
+        {{-1023380,-11280349,-17277288,1258378,24821734,-15751936,1047616,3042789,-19809512,7007422},{-4779501,-10686012,14525321,31456,7363874,16538895,1125835,125548,28603659,-16013311},{1,0,0,0,0,0,0,0,0,0},{-33424347,-4748813,-23083284,-3324074,15718066,11001676,-28957422,6994342,10827178,4844390}},
+        {{15461778,7201596,15372656,-9404399,-29574065,7600428,2051151,13321205,29971661,-1136068},{15742927,-4715979,-18616636,7948617,-22530019,6165903,-26423273,2790094,32958632,11570261},{1,0,0,0,0,0,0,0,0,0},{12138830,-2281730,1756656,-16188021,1824681,11532962,28055188,-1505579,4562258,-9838506}},
+        {{18160486,-15576499,-2109943,13876987,18794629,-8000601,-12240902,3835452,-14940761,10566895},{-25438130,-7531075,-3325007,-306875,10219149,15053999,12755626,8262534,7811202,-8764328},{1,0,0,0,0,0,0,0,0,0},{11766100,218036,16380574,-2038461,-4129472,6547990,-26622267,10693235,-7032309,7215440}},
+        {{-14862780,1891808,12140493,14890407,15031309,9787346,7035869,-4595295,11023667,2805113},{-26758288,2780845,-4790902,2514689,-22054125,-4602828,-25400255,-3427678,29028570,1339098},{1,0,0,0,0,0,0,0,0,0},{-30916053,1822479,8657653,-650112,-17251475,-8604592,-32648749,13016717,31756779,-15780705}},
+        {{-18537068,-6038352,2641774,-1644362,-31659985,-4428867,-11598826,15510607,27252523,-6553439},{31836103,6962808,24798913,12264898,-6514331,13883207,3717927,2397980,-15226645,-4612731},{1,0,0,0,0,0,0,0,0,0},{-364144,8756874,10886184,-4801169,-30048659,13504618,31485655,10542598,-18373629,-10679039}},
+        {{-27218399,11944789,-15314262,9734604,-26726812,-5629725,-21598021,-8992780,23104669,-3652909},{-948279,-11033261,-7131161,-2714551,-15160340,-9664548,-12608832,13655169,30316003,9348180},{1,0,0,0,0,0,0,0,0,0},{-13349441,-11966640,24388917,-15663736,10974482,11167542,-361284,16131375,3129128,-12300756}},
+        {{-17345221,3255597,-532526,679998,513841,2296274,-12421450,2535357,16363971,-10210756},{-5791320,-3217319,-3751072,3180183,-21816193,-12258163,31088071,-9401390,18611297,-15775492},{1,0,0,0,0,0,0,0,0,0},{8461748,-11866316,-27103828,98799,-18913705,-5155807,-6199106,788953,-2541369,-7352793}},
+        {{10368290,14500264,14119278,6078354,-33078139,2014042,21744140,-1793176,11354474,13641495},{7665853,14230635,25567892,-5418386,-18548988,14254269,18229135,12423573,32774366,966809},{1,0,0,0,0,0,0,0,0,0},{11478098,-16131184,-1041467,-16505584,-164723,10844799,-16569292,-963300,-24591460,-13113696}},
+        {{23645075,-4802005,32461671,-12308323,6619845,-11421089,-15674611,-10590869,-2456012,-4660895},{24402898,-6103192,9652818,8431395,19276535,-7853402,-30870621,9914266,-25411046,-12043710},{1,0,0,0,0,0,0,0,0,0},{7535455,677104,-32554895,7937977,3815045,-13038908,14697155,-6231223,-25180976,5794689}},
+        {{-21255202,-15638884,-13801007,-11437580,7604497,14772634,-23467605,11682545,6139386,16254952},{-30077799,12875426,28239477,2137329,20039089,-16746394,19872039,-4501280,-32058981,4631695},{1,0,0,0,0,0,0,0,0,0},{32363684,9078296,-21257563,9135443,-33437947,4505401,24227101,13964792,-28180152,-4136976}},
+        {{16776220,2774679,-26453883,482411,-11050199,1603547,-6091720,-7308274,13614282,1407678},{30302283,8584530,33291458,-12188411,-26089669,13713549,16238323,4439425,-24226250,-2350772},{1,0,0,0,0,0,0,0,0,0},{-5631513,12460297,-20844264,3744164,30178862,10343891,-22523582,-16479524,-22636600,-15071717}},
+        {{-20870545,12360509,-14516786,12782818,592920,8678302,-23037647,-12447956,8647413,14313451},{-28256984,-1067292,15651939,-4382564,-10934917,-13576038,31861988,11868848,2551449,3971957},{1,0,0,0,0,0,0,0,0,0},{28463857,-8626072,-23596873,-8665919,32643946,-6609429,-9240971,-6200731,32310162,11982297}},
+        {{-19509231,7951003,-4623571,6782372,-28564543,-11071714,7394158,2769601,-2888993,12474322},{-15434722,-1142947,16070193,7735066,-30635528,395108,4829546,7599057,20285877,-5573394},{1,0,0,0,0,0,0,0,0,0},{-8545226,179458,-32989351,12881944,7539986,9436901,2317713,1732110,-4403887,15311701}},
+        {{-25334950,8909005,8258725,7655136,32381397,-2728471,16095214,-16014855,-13497816,11833785},{3181680,6467652,-32778624,3484150,-19997476,10422075,8599966,1348961,-21180126,4580863},{1,0,0,0,0,0,0,0,0,0},{30079308,-11755447,-19674875,16749878,27062126,-11095634,2841421,2161229,9935966,9379422}},
+        {{8962603,-178677,-12642415,8206292,-25517160,4745501,-28328986,-5600568,-21182352,-5658086},{14415402,-3764359,29606094,-1017537,-1111751,11238654,-25189716,-6646660,26465750,-3016854},{1,0,0,0,0,0,0,0,0,0},{-8863741,-10547064,26190841,2894276,-27116809,11943383,-7987266,10573535,-22094578,-14699580}},
+        {{-1364375,15292052,14913387,-373628,2737442,-9397574,-22486227,-7238861,11936053,7389788},{-27937303,14620266,-12833208,-5020916,-13392003,-6849975,3657172,5571934,22731361,6744285},{1,0,0,0,0,0,0,0,0,0},{12061825,-9604877,10352157,1053583,19230044,-9394064,33338467,-10824311,-19287343,-6392530}},
+        {{19292078,-11252565,9011115,15211442,-6149431,-8206936,23059356,-15976702,2044893,9678129},{16987432,8393545,13264508,-15759274,-21877996,-15255549,28442551,11427982,23939747,-12549448},{1,0,0,0,0,0,0,0,0,0},{10580101,8807199,-3987414,-5527403,11161350,16658543,-5796582,-9830703,19536321,-11810215}},
+        {{28148513,9787212,24649499,10477716,33495331,-3174462,-25110347,-13925261,-15427822,3880559},{-594087,10700058,27612092,12194083,-29068837,-15647332,-14346236,84629,-16644769,9763682},{1,0,0,0,0,0,0,0,0,0},{7851401,-4149249,24013886,-12894611,-30689264,9147943,-5038763,10758414,12967302,-10362469}},
+        {{-1591915,8166340,28138315,-9414326,12576856,-15409925,4246186,812890,3125798,4200321},{-20755978,-16048100,-10051400,-16602393,-7585549,6407638,26205138,-2071367,1036353,-1260172},{1,0,0,0,0,0,0,0,0,0},{-28745399,-14594798,-29077820,-2831410,-30535193,10589438,6090139,6293108,3475083,-15230380}},
+        {{-27061206,4401598,30272165,-11917643,13697372,15104342,29836471,14072617,-6615592,2585940},{-24525579,13250982,27766411,-2258156,-18521603,10416944,16937900,471465,-5552486,-9991431},{1,0,0,0,0,0,0,0,0,0},{9575967,-8352021,4636719,1591255,-16855572,8606567,2375680,13574290,-17214824,13382704}},
+        {{-13616210,-5568953,-6669927,-8394445,2461172,-4185808,15056666,14141584,10251322,2002927},{24193070,12971040,17966461,-1423987,-10949177,-13908510,4654104,-6537849,18938318,15112102},{1,0,0,0,0,0,0,0,0,0},{-17170557,12024977,-29690556,6950524,23128050,-7442362,9322498,9380633,-14367868,16111589}},
+        {{14294177,9427661,28602089,10627749,30711523,1060123,-14547013,-9305376,24735982,5093041},{26189925,11360134,2543235,11747670,-4998373,13135843,11068441,-16307664,-29040696,2983311},{1,0,0,0,0,0,0,0,0,0},{21695331,-421681,29354748,-5487759,21376657,-7526395,-31222359,6240046,29621611,-9463312}},
+        {{-6587618,-11961791,21134173,-3695257,19254353,7710680,-31626707,5443344,1861139,-11422179},{-14204435,-5472050,-7372258,11085698,-15676623,9093452,-10875459,-385,9451479,-5656130},{1,0,0,0,0,0,0,0,0,0},{17697119,-12888071,-17149245,7478117,-25214763,-5936197,12140393,4932903,-21942217,7816141}},
+        {{1909902,-11753982,-27825759,3313465,6793815,-14299450,-7877201,948514,21684198,-6812362},{-10776806,1211847,-9925331,8060284,30859474,-9500112,-27463836,-16438017,-16080019,13503475},{1,0,0,0,0,0,0,0,0,0},{448664,-13147327,433269,-7069424,27485370,-13653666,26637356,-10407983,29998071,7103766}},
+        {{-23234047,-9790360,-26707769,-10968576,-10506757,6975930,-17583542,-444033,-11139280,1936374},{-2221276,-11611431,33492755,8017984,-32035746,-14009873,21591613,2813265,-28726355,8127018},{1,0,0,0,0,0,0,0,0,0},{-15457161,-14809,-3267075,11510068,30373800,12094008,-4183572,4559689,-4128252,-6351292}},
+        {{21163546,8555831,24099039,-9271754,21366653,-8521907,-27926824,754791,7019165,16109687},{18987828,1473776,13507885,15007898,10316110,11959222,-6426900,3898464,17621248,-4156866},{1,0,0,0,0,0,0,0,0,0},{-29790523,-14269764,15160723,-13984757,30975798,433929,-13491181,-6740143,3133754,7693947}},
+        {{-14746437,5758510,5330128,3206239,23298744,-2696306,33241887,9672216,12777818,10233967},{-4181730,458999,2650890,9377306,12037069,-13270693,-9879319,809559,-16393930,-2411634},{1,0,0,0,0,0,0,0,0,0},{-28578357,-9346242,-20208054,-14138629,16745970,15729697,-9039166,-6968851,-17989423,-2453599}},
+        {{-28709228,11763110,20211015,-4188064,-18342212,13235406,10865030,14615794,-15879215,1426026},{-11261022,15406852,1188014,-15494041,-30301161,-12833380,10932349,8622751,14964827,5262001},{1,0,0,0,0,0,0,0,0,0},{19110615,-11950924,3076856,-3586012,-7708415,7225554,-32125001,8038408,6709137,13706426}},
+        {{19266056,-16427386,-4575725,6509933,-14899928,594715,-3755216,-6066184,-1013845,15675457},{-16853193,14718370,-30060454,11649242,-25386127,-10554222,14446712,14383779,32165512,-437715},{1,0,0,0,0,0,0,0,0,0},{-31562980,3215525,-29912560,10906481,27250581,15338824,17029884,-13157507,20044610,-10999671}},
+        {{-4660255,-9730611,-14959517,-8200749,7405048,-14680268,-25541580,-9691633,30319595,-9418490},{12566197,-12817618,26367064,-4972315,10653327,-11679696,-24501525,16699023,-31438647,-15778038},{1,0,0,0,0,0,0,0,0,0},{15746205,-1771149,-22995488,-7192407,15823992,2065560,13341821,1410659,2934435,11419204}},
+        {{31563912,14677927,8256746,-9927541,-24947673,6027702,-18981716,2706759,21577864,733422},{15067299,-4981659,17500034,14675921,14297391,1850754,-6795748,-1830006,-1659482,-454110},{1,0,0,0,0,0,0,0,0,0},{-28403727,8617675,33096153,-12143473,12063026,-27997,-6826179,-14336112,-970917,-15184}},
+        {{-33475846,-2221234,6671651,15386899,-10289844,3750941,-16242051,3095274,10633069,-8314748},{14409959,-10456641,94423,8484719,3083878,10442748,-33391219,2348051,-489076,-5737719},{1,0,0,0,0,0,0,0,0,0},{30884480,-14336841,-13585846,7268199,21998309,-2605821,25572387,5278714,-24684878,15228439}},
+        {{-62327,16362543,13029746,13360250,-18109131,1336432,-27634156,15989221,-8557600,2780803},{-7531296,-3766185,7759345,6084043,17701825,-11756286,30447128,3005610,-13943159,-12758570},{1,0,0,0,0,0,0,0,0,0},{9492856,15203795,-5575355,-16391945,1028215,10851669,-6471797,-1892012,-3924667,-13162185}},
+        {{-26822120,269992,8878339,9729727,22192678,5312675,-27998765,-2860167,28173118,-10934253},{-4580423,15871091,-16579829,12622258,28100893,2725606,28273067,12183785,-27103903,2440157},{1,0,0,0,0,0,0,0,0,0},{-12077201,1582294,-719808,-15764573,-23091124,-4565732,-30826832,16555815,-2358343,-2843171}},
+        {{-21714924,-11774789,-6961476,14444320,4683253,7786918,16910287,16021188,-32232452,-3957036},{8448632,-11562952,26879839,-9231803,28611837,-7575934,-8197468,-300125,27803096,9242182},{1,0,0,0,0,0,0,0,0,0},{1616947,-2556598,-13553240,44937,8813593,15893798,-11606237,-2663830,-5834805,-4112778}},
+        {{14700628,-11957734,22147861,-7041393,24843063,10356474,3374779,7715629,16417515,-11664577},{18536963,-6384548,-3291353,11076069,17916517,4255199,16147275,4063131,3503118,-10314846},{1,0,0,0,0,0,0,0,0,0},{10314589,12782756,-23642299,3599553,9387522,10571363,6637582,14726778,14087192,4653155}},
+        {{-11305513,-8712917,2315563,75864,20917626,8494609,-20062662,-13973366,16108058,-3318267},{13207233,-9279051,14311142,-4673466,13824748,7941724,8963085,-6619513,16004565,8203912},{1,0,0,0,0,0,0,0,0,0},{-8595043,-11249237,-31150766,11783324,-19978792,-4767208,-11620132,7223120,18945811,-15102394}},
+        {{-6864156,-6403911,22681258,16084730,27925361,-10477660,-19849254,16357020,-33061134,10732795},{-4680239,11771593,-13939680,1884473,17102294,-2315923,31657323,-14533149,17600339,-13964865},{1,0,0,0,0,0,0,0,0,0},{-18669880,3899847,19591317,-8989733,29893427,13973711,27665514,4555127,8114535,-4198156}},
+        {{-32954884,13909035,-19290414,14295419,-13582005,-5510402,11813516,-9299845,1990545,-10426713},{-11850995,10262194,-6322529,8975964,11452454,14024733,-27018228,-2370045,-6176344,-6759757},{1,0,0,0,0,0,0,0,0,0},{11488945,10310809,-19971741,14542973,3603625,-2172518,9043737,11589533,-29804364,-3717169}},
+        {{22465717,286745,13032274,5823240,-13938866,-11179907,12308426,-2354157,23151245,1020},{-6310529,-15858771,-13394484,-10729818,-21056255,-4929041,-22494287,-8763912,14377086,-10273527},{1,0,0,0,0,0,0,0,0,0},{-10008953,-8378890,21573030,-7826206,31915506,-14113663,-28234010,1084286,30334723,-4219153}},
+        {{14941387,8064308,-12928482,4812669,27403792,7460780,-4205848,-16621616,-28625044,-2343126},{31224841,-12280503,6232864,-12889125,24250010,3228153,-14518191,-13247789,10477278,-15762673},{1,0,0,0,0,0,0,0,0,0},{7293514,-1979140,18196370,-8083595,-30618414,3933232,-32020522,10439737,7922717,-9746211}},
+        {{30814882,805370,-10069205,-4151851,-24569414,-9842368,2456178,-13297397,10603187,-7117798},{-7256468,1083628,-2591205,-5163604,-6002422,-8063235,-6306388,-3965061,22130180,-9058613},{1,0,0,0,0,0,0,0,0,0},{10219644,-13526317,24924718,1143727,2345112,-9850872,435279,1282014,-24402499,5043735}},
+        {{-14795698,8279137,15857757,-14254266,22966954,-14328196,29326116,8020147,-27876673,-6234939},{-18845058,8322533,-16016141,10668398,29464042,6167130,-1014222,-5722021,31081185,-3800778},{1,0,0,0,0,0,0,0,0,0},{24905511,5414403,32948425,-15114243,29647001,8338046,33129514,-3064140,-4655864,2632951}},
+        {{14702860,-11844160,9392110,11502667,12364530,-15665826,-3168901,-4204423,14409223,-9312445},{11574990,11739911,23727326,-14675980,27616669,2229019,-19032294,11322636,9474781,-12763434},{1,0,0,0,0,0,0,0,0,0},{-14345454,-14858221,-12499922,6669035,-19372328,-14848025,-31379795,314368,2237762,-15132437}},
+        {{-7855081,-7374166,-32174761,-12536797,-22325281,9404532,32067312,-657373,-16900499,15667131},{-33046033,-3012297,-5328788,15438169,5995017,273062,16193540,886240,9279618,11263122},{1,0,0,0,0,0,0,0,0,0},{-20113634,-14402440,9160731,9572978,-2776580,12647593,-20469653,8937017,-31608983,11847590}},
+        {{-9491678,11785095,-5793879,-6958844,-14172909,-2635753,-24468523,-10979614,-7458908,12794490},{14294714,12167796,13067889,10520196,31879913,-7559206,-19555910,15571127,28391343,-5630598},{1,0,0,0,0,0,0,0,0,0},{-412898,667904,11803865,6405,-19600957,-3441420,-31970175,-2649108,-6075288,6085339}},
+        {{-5961001,8285504,-33378818,9374580,11270226,-15040689,-11255778,10655637,-17470198,-13247271},{-136779,-11050050,5098439,4558172,11088628,-3525929,24983384,5285692,10921179,-7579639},{1,0,0,0,0,0,0,0,0,0},{-18561189,15586067,8787891,-6032913,26956183,-13536524,4850916,5604265,-7823989,2007405}},
+        {{1968781,12964066,3457340,3340536,-26536060,15469139,-19464520,-8217803,-10368686,-16612238},{-6857153,-15350396,33505960,15895913,20215844,16223839,26310154,-3121961,5205914,833220},{1,0,0,0,0,0,0,0,0,0},{-8660109,16537712,-28344550,14361196,-13713522,6192922,2342397,-15608238,-20316020,-222524}},
+        {{-16692816,-3856041,2478774,-3813364,20132565,-3397655,12893510,-10732943,8387938,15121784},{-31470529,-10432873,21949381,1344620,26843552,384758,-15701874,-14758064,23761359,-7129882},{1,0,0,0,0,0,0,0,0,0},{32606776,-2314276,16215045,4617668,-220316,-16708728,-12788693,7029559,-22322694,-16411309}},
+        {{-13755058,-12406970,-15113959,-708173,-17026382,8126240,-9201144,12610238,9559398,5823705},{3842453,11821681,-19313836,-7984953,699934,13271540,20318504,-6576974,20718449,-12521798},{1,0,0,0,0,0,0,0,0,0},{-26742699,-10810214,-26784697,-806459,-31609614,4599338,-25783696,804856,24995413,1764593}},
+        {{-28121959,-13452800,1983191,11765053,10786631,-12047536,19280257,11701054,-19412340,11609699},{-9282520,-8819713,12195925,5506626,-22791492,-8025780,26381946,-5344790,-30862543,-10052389},{1,0,0,0,0,0,0,0,0,0},{18284794,-365714,-24133738,-3591752,973140,4435772,14599788,-15416184,-8621272,-4238757}},
+        {{10376920,-4454885,28229201,-11631064,-33367601,7191966,3369748,-1673552,8582129,13019105},{-16728293,10876790,9212263,7358886,-1739759,-11508742,-29151240,2074449,-20203135,-10097098},{1,0,0,0,0,0,0,0,0,0},{2975934,6794963,14691424,14775447,15845423,-9077015,-6601842,3210642,-29441925,-7363282}},
+        {{32943412,9880027,17901850,3587978,30988041,-11387658,31540551,16088504,-911753,12012282},{7951178,8801283,-1609798,-9484475,-29993858,1433420,-11353206,10463160,25837399,-14559182},{1,0,0,0,0,0,0,0,0,0},{33218661,-7281829,8511039,-13632026,-5283360,-7034966,14018709,8707768,3383730,533130}},
+        {{10752497,-8973354,-601218,-7979212,-27517064,-15533257,17280362,-12456304,22387881,-2517202},{-24107372,-13120693,-7551945,-14950635,-7080081,6066597,10610920,-6108512,-15817867,12833478},{1,0,0,0,0,0,0,0,0,0},{26375277,14148991,15254789,7489862,15508597,14315289,19038813,7914098,-18056976,3267579}},
+        {{-18682015,9964705,16178445,11183937,-12425595,-6636550,12474541,-14745967,12990121,-1400555},{31086906,10176344,-5216692,7776515,17469944,15359555,23804742,-9273900,-12032075,-3641977},{1,0,0,0,0,0,0,0,0,0},{22009415,-10879000,-32306101,-14721690,-26795374,4180707,29244957,13133938,-29017348,10130611}},
+        {{9702268,-392177,11935568,-7943587,-18102082,-15415035,5730647,767162,-15337525,11052500},{14578002,90670,-2775680,6764463,-24370518,14920451,-28215115,-16479411,10436129,6764154},{1,0,0,0,0,0,0,0,0,0},{-348781,12242037,-20430712,-5554219,7507262,-12051394,-864206,1150074,-29918532,-7275440}},
+        {{-23357539,-8095509,15821778,10395342,5860174,2754359,-32214206,15488632,-22516567,-9437206},{5513081,8119400,-4252525,-4466440,22804633,-736074,17214800,3263912,-7566328,14554387},{1,0,0,0,0,0,0,0,0,0},{-29852670,-8236254,5182889,-2997708,-9723203,-1665748,-15881835,-11300116,27129632,-9461845}},
+        {{-28957598,11275386,-30415291,-7524514,29472227,-11851947,29833204,-8098051,1162269,-8218845},{10610108,7962599,-2610808,-1528195,15134106,-12948305,18019953,11422633,-28596794,11404443},{1,0,0,0,0,0,0,0,0,0},{14474446,3509735,-7010169,-16618120,30131446,-2198846,-24442324,6759096,17970508,6943345}},
+        {{-30890644,-6847739,3773809,4475108,-3503844,16657599,17170248,-10812677,15072427,-9739172},{-33128617,1788832,32964397,12651525,-10427436,-5633967,-20559050,5301480,-14744845,-15064026},{1,0,0,0,0,0,0,0,0,0},{-22946514,10416543,-277680,10368138,25631090,-5435694,14097518,-5058952,-14802549,9031130}},
+        {{-22897313,3262577,8704637,16367179,31864129,-9443331,-21610078,-8367759,5275289,13525396},{-4436517,4299909,-8998510,-11309302,14031284,-5231039,-24100244,6678652,14625832,1357213},{1,0,0,0,0,0,0,0,0,0},{-27587726,-5661125,-4272148,14184253,-9035013,4965569,31343496,1352241,-26725697,-9884913}},
+        {{-24348870,-4701058,29860781,-2967082,26496681,-10037524,25882561,-5457891,-20349727,-6477532},{11268267,-6725150,27682878,16442710,-20633246,16008147,1814442,8992651,-32340967,-8751438},{1,0,0,0,0,0,0,0,0,0},{13357931,-16756411,-33380080,-10062654,-32260233,-4728900,8313302,16647732,-4535683,15983738}},
+        {{28512473,13529323,19097276,-228677,14601142,10215376,-14737833,-16325003,-26374875,-12114907},{1852965,15438645,-10274224,-8682072,-23471829,3669621,-28541362,3266093,-14364019,-15477457},{1,0,0,0,0,0,0,0,0,0},{-19609802,-5809478,-9768399,3159983,16274229,-9030860,-23771474,11682073,13712415,12775527}},
+        {{-20810687,8996657,516957,-5468102,23317496,-10629039,10361354,12019028,-25555663,6514772},{-3670412,-7082031,21321384,-3807739,25597883,-4969590,28501921,-2180423,10495101,-14722839},{1,0,0,0,0,0,0,0,0,0},{-18279194,-4384961,-13725595,237416,14302411,-10758166,7036817,-2911263,257358,-4326626}},
+        {{-16830487,-5030396,-21157796,12509447,3841050,-8017235,-22426220,1745441,-11133826,12121956},{-30210074,16696188,30550469,6739126,-25222853,-6067254,1212604,-10207447,3862694,-16315349},{1,0,0,0,0,0,0,0,0,0},{-16694801,2046865,-27545049,2120534,30470776,5014286,5131096,-5425085,6841891,-11745680}},
+        {{-18599060,11740940,26048024,-13885666,22795870,-785869,-13834814,9425660,-5591514,5368151},{28274865,-3568130,23380587,12717239,23419589,14308609,19337892,8203672,8803307,330030},{1,0,0,0,0,0,0,0,0,0},{-13614830,5817547,22001829,1464760,5768488,2472438,-3331150,285773,13438196,13797731}},
+        {{13900947,-13844514,29208670,-4234224,11613749,3213418,8388834,14862363,22707194,-10257131},{30425259,-5880905,24535673,-4922078,-30613581,-8294109,26485774,14466803,-22486394,-2621787},{1,0,0,0,0,0,0,0,0,0},{-2574422,11930423,25994537,-15796175,26650775,11191700,6389890,-1255737,-30241271,8639985}},
+        {{-19906979,13711373,6561728,-3573975,-27130062,1474322,-31890761,2651955,-1469026,10074175},{-17161456,-16082765,12248657,8692915,-33169622,-8140880,-14096324,2895781,-716869,-14470228},{1,0,0,0,0,0,0,0,0,0},{-28834916,8866620,-7927972,7726420,-26615976,-3512409,-26410105,-3674812,27764756,6655346}},
+        {{22750040,-6045018,-4477569,5885367,-10734989,-3267155,22774321,1462775,29613096,9840203},{13367985,6790829,-6623467,6666418,1579608,-10225840,15656056,-10504809,24759478,4630833},{1,0,0,0,0,0,0,0,0,0},{-7708547,7539468,-23751723,5308903,12424466,-4693775,27304834,16538312,-22217210,-11902077}},
+        {{-20892425,-354618,18083132,-1741203,32888325,-8032723,32101692,4720176,7510766,-2489530},{6777629,-10934356,11885759,-9595179,11117717,10954548,4071494,-4339174,33501545,9321671},{1,0,0,0,0,0,0,0,0,0},{2433110,3932399,-3033473,7555900,24143838,14038251,24464031,11365433,-7189835,9687902}},
+        {{-15228085,10224942,27425637,11105316,-14769889,-7058082,15947621,-11023,12198658,-11650323},{-24091890,10911441,-708335,10018613,16863448,-16702090,29033562,-9916301,23449394,-12546771},{1,0,0,0,0,0,0,0,0,0},{-9195654,12954732,20119148,-9141506,-13745517,2135181,26460254,-15472935,-7411764,5492169}},
+        {{19708040,3181763,21226315,-1271793,7911126,-13424584,17872794,11907613,28198237,-14018808},{-20576545,8879525,2138218,14019366,-13105139,-11633504,-2570336,-11292986,-21659718,6541456},{1,0,0,0,0,0,0,0,0,0},{25745515,-710236,23292175,-8925374,-20972651,1736901,-8566298,7790444,-24450659,-5135604}},
+        {{-19581696,-3985185,-13494845,12142310,21714842,-15814961,-14242116,7029368,26535490,-16565129},{21918975,-16483760,28739651,3421009,30191546,-15898826,-11502054,-15059394,11819647,11408278},{1,0,0,0,0,0,0,0,0,0},{15158838,-15519623,22764151,-8411749,8082363,5438569,-24427647,-12287084,-9111801,12072027}},
+        {{-28263735,-11989961,-29699058,-8367737,14979437,5916262,721267,-4081098,-33515049,11074775},{-10933272,11646774,-14076589,4612668,-21348975,-3194413,-909524,-1705808,6538415,-8046620},{1,0,0,0,0,0,0,0,0,0},{19457624,-5722415,8398979,9422869,-19530720,11142235,-9958797,-13671672,-13432426,880493}},
+        {{-1936348,-5986894,33005670,-5064730,-5127937,-5960285,-17977224,15807292,6623639,10181},{4575658,3085869,6885019,-10964058,-23007116,10873753,-30031908,13662954,-29556611,4801245},{1,0,0,0,0,0,0,0,0,0},{-14767767,1410521,650498,15992649,18301149,11998481,7546306,-15442694,-18191406,-2951292}},
+        {{27706627,13782425,-5543351,6508425,15293171,14738307,32521683,-6637653,14584983,5217244},{5225784,-9519792,16409650,15546583,-1317595,-1246038,-24170764,7116023,-3401391,6316905},{1,0,0,0,0,0,0,0,0,0},{-5533513,14294017,26166234,7537458,32893772,8081945,-3319220,-5020404,18211037,2929781}},
+        {{-10809632,5989944,-28826860,16419946,9261821,-13309611,-31970265,10830623,2066631,-12032106},{-9195494,2354429,-26571306,-1384962,-163383,-2307380,33335272,-13136558,1244216,-15868204},{1,0,0,0,0,0,0,0,0,0},{-103094,-8245870,17483310,-8726725,-20634291,2637239,6577733,-12911790,-22934955,15269221}},
+        {{-23299905,-12851854,-730827,2389192,15954999,4475282,30397620,15279886,16378768,11540042},{-15569271,12769799,-5219385,-11414650,32499286,-6605126,25090910,3631824,25704272,-1965016},{1,0,0,0,0,0,0,0,0,0},{-6965574,-14726673,-16034736,-1053463,-17952581,-8907696,-30344786,-6656579,-24707819,14343359}},
+        {{3097920,-10347039,-17719372,-4755653,-4507692,10730176,-6709826,9053091,11073939,-9217445},{-25919353,8853765,-9713841,-3895080,-22069792,2996770,-9275238,13522064,9460892,15941930},{1,0,0,0,0,0,0,0,0,0},{32091936,-15848426,-19047712,-4589732,-24847422,-6278918,-17785836,16362775,15383840,-9914269}},
+        {{-2585811,-14118120,8268378,-1877904,-28491202,2965931,-14664215,10841242,3296181,-888395},{33477720,7810175,48302,13998616,-6183719,14423006,1349944,8654850,-19918671,3786924},{1,0,0,0,0,0,0,0,0,0},{-26124327,-6413943,22731625,-7416578,2656113,-15579941,24652780,131143,-15223907,3313215}},
+        {{5727781,6501339,18345157,-14939857,-20538370,-12422214,18714826,10665993,14734268,-3686337},{-19719366,16611779,-11158714,14231569,29751994,-13789944,-31079721,11358746,13649419,-10281286},{1,0,0,0,0,0,0,0,0,0},{23391671,-38350,-25039882,-8625583,-8303113,15082356,10704032,-8715293,-10044293,7585234}},
+        {{890857,-15425532,-15731554,-2412783,16353314,11371388,-32478940,-439665,10054666,6849309},{21958220,-14288614,-22240332,7009287,26837789,-2093861,851423,-1031126,16105181,10059796},{1,0,0,0,0,0,0,0,0,0},{23867662,-16075592,25133550,-12140186,9179669,6492663,615597,11316275,32271203,11341840}},
+        {{21028794,-1722614,-15084449,-15835994,-17292621,-5401764,7000245,12889992,-1257353,8370278},{30412815,-10186500,-18060291,-12867020,19630221,3489918,-31714682,6069052,-15098903,2985138},{1,0,0,0,0,0,0,0,0,0},{-7243662,-14645853,12273070,-6994644,10760634,-14168611,-3117626,-3958821,10289684,6444945}},
+        {{-16345455,5109962,-27109221,959327,-2018397,-3288003,-6093823,7999338,-17887873,-14818737},{-6753099,-5940101,24559664,-7750943,1881208,3684096,-20992518,-15279447,-13295710,7934918},{1,0,0,0,0,0,0,0,0,0},{25668527,2969690,32698440,-11373904,21109980,-132587,-1935033,5673197,-17782288,5983885}},
+        {{29109916,5225287,-10892476,-16097054,-6797206,-11959909,7326440,4949037,-28398058,-9699036},{16303,-12999864,-25233982,-16210566,22422634,-12301072,20585597,-15744263,22886499,5436494},{1,0,0,0,0,0,0,0,0,0},{20952007,4105811,-45093,-9017486,18276147,-9741349,-17574249,6959264,-8762558,-6510887}},
+        {{29288492,-5047841,-9313952,-4611768,-25669040,-4409102,-27043251,8324686,-24396518,1557006},{-26214440,12143937,-19844054,-8998527,-3808116,15035109,12398755,-1714427,20908666,14227426},{1,0,0,0,0,0,0,0,0,0},{-13484882,-13473210,10468826,8366183,-9922084,-14604863,26817031,-6653289,-8785793,-2755918}},
+        {{20493095,-13380050,1165418,-1591366,-21559848,-12079237,28726488,-6006319,-18409293,-4015413},{-31627006,1045678,-26461810,-13919633,-16492863,14757973,-7875545,16665168,-26093981,3292519},{1,0,0,0,0,0,0,0,0,0},{-24598349,6918445,30693665,-8632952,-82924,9731915,8952452,-16496513,-13419035,5977875}},
+        {{26066074,-16643359,-3690618,-7370035,-9913086,1506762,3840900,-15163424,-30508685,7154637},{27596932,-611026,-2180342,10985017,24914593,-8197736,19517882,9205646,-1063824,-7532928},{1,0,0,0,0,0,0,0,0,0},{-24830350,16335662,16037691,-15208128,-6033502,5528018,-23255520,4032894,-17256967,2123570}},
+        {{-26055671,-4221399,9220388,13938844,1501586,8772054,19105975,12707981,32649921,11394798},{-8256083,-3532524,24433536,-15244680,-11428598,16354295,-18441295,-5071451,10486017,15168150},{1,0,0,0,0,0,0,0,0,0},{23190786,1598298,22663838,-15535735,-22583239,-4520925,27110817,-13563476,-13280832,12628169}},
+        {{-6964471,13052403,-30204327,-12500243,7832083,227762,26554667,-1757470,-33464780,16074048},{6525261,-10788710,-6745174,-5960959,-9739144,-10953093,9301976,3106473,-12157698,6728713},{1,0,0,0,0,0,0,0,0,0},{1797036,-8759994,14710579,-2271406,-9034706,-1255719,-3244241,12294956,-1808367,6604344}},
+        {{10736928,-9448499,4865555,4918358,-31136104,-3155816,-22835845,-12417123,17400814,1777779},{33331496,-2330584,29916298,-6621731,-76632,14948702,-30882026,-9288475,-14415038,-9489087},{1,0,0,0,0,0,0,0,0,0},{27202805,10375788,-16220572,-16135153,-18921089,-3877084,-12515417,14597133,-20482147,-16338775}},
+        {{-21208405,-4075855,-1706308,2282660,12796171,7380875,21000938,-10425383,-22128179,15322179},{18680091,-13106500,8818584,-5549798,10822975,-16272247,10930826,-11253941,-4515320,7315540},{1,0,0,0,0,0,0,0,0,0},{-31298466,488698,1121333,12828545,32349603,12185190,-1644529,-12922426,-18737227,-11563838}},
+        {{33239536,1873236,-13904063,2576733,4309880,15569793,28832019,-10531507,-21157570,-5304288},{13735623,4003585,19955582,3159106,22150202,-6986480,33013094,13824041,-3722388,10462215},{1,0,0,0,0,0,0,0,0,0},{-5693753,2975481,-16768798,-15173668,-31781327,-6937116,-31852047,5185584,7700654,709248}},
+        {{10295799,-12620978,10298551,10947074,-13260157,11873527,8046621,10085290,9992889,-656761},{-16923,2195955,-32795296,-15929337,-24534157,-12639063,-9545812,-4272961,-25143384,-15817950},{1,0,0,0,0,0,0,0,0,0},{15351150,11513531,-2514787,-7839059,10659846,-1241018,-24579926,-15979661,-26441231,414945}},
+        {{17759889,-9527466,-65185,-13724684,11562079,-5046828,-530888,12327867,-26225146,12019184},{15619667,15569316,-31353461,4964455,31304395,13587386,15646446,11836403,-12800524,14463256},{1,0,0,0,0,0,0,0,0,0},{-13256282,-14738655,8833176,-13566165,-10918442,1659287,-11661253,13045846,-15400567,-9654774}},
+        {{-717947,7546803,32384049,15107861,-14238605,10120607,10836737,11557791,25201779,-15358903},{12301365,-12533413,-30356522,-7168870,19028654,3308098,20793333,5411741,-7225985,-7391897},{1,0,0,0,0,0,0,0,0,0},{26982030,-12106037,-24334934,8721631,-11745066,7789850,26229505,-8572019,31849532,-7210471}},
+        {{-12218511,6551546,9606455,7723588,7371963,14395724,29081883,15704561,27679760,-1327956},{10186714,3553464,-27901063,5587441,-25681594,6348469,16470634,-16074979,10779653,8373785},{1,0,0,0,0,0,0,0,0,0},{3064920,-9364662,15687797,4476150,27899107,7415950,-21866050,16415571,-6511511,-9422899}},
+        {{-7864157,-907938,-32335234,4283039,-29688833,6109065,-20192237,-9467839,25252771,12945242},{-5786182,16549406,-17578139,-6132256,31306250,-5077841,-24271661,16233360,-29074312,-10759476},{1,0,0,0,0,0,0,0,0,0},{12473906,4989914,11367894,-6459330,-20143018,-3252220,-23550083,10784007,12719627,35545}},
+        {{626382,-10729742,29529757,-4188972,11841522,16460602,-5465177,685775,9831923,-5819781},{8934643,10721689,-23589163,-16291231,27107430,9678830,-21071063,1623588,23714263,-11365432},{1,0,0,0,0,0,0,0,0,0},{15288869,9878829,-22313582,-2814810,10764620,8887625,-885087,8547976,29991046,-6689671}},
+        {{21324520,-2507134,-31739124,-4691925,3639350,4242528,28103297,12898956,-31697093,4993765},{1686136,-11199406,-25388125,16551940,-28989269,-8215342,8690484,1774147,16058048,-6066503},{1,0,0,0,0,0,0,0,0,0},{10592942,1687004,-13103836,-5280034,-27785294,12967491,-2593732,13185504,8905912,-8570503}},
+        {{-20439748,1539335,-11026423,15851165,21827572,-13365519,-10762200,8024052,16180253,-4568580},{21388622,13201855,-6973151,7035915,24840904,-13765238,-14727733,-1022369,23807692,14351384},{1,0,0,0,0,0,0,0,0,0},{-16936169,15023430,26972571,14776641,18105893,14115157,-5123470,-6900593,-21467527,448747}},
+        {{-10054973,719455,-17582394,-2033146,677664,-16582295,-11801733,7001533,-29729804,11796776},{96158,-6342977,-28607630,-4691833,-20355174,8645705,7331048,-7835237,8610008,-16768911},{1,0,0,0,0,0,0,0,0,0},{-13840738,-6402025,25128323,14265281,29768059,-12986188,-10181533,16193749,-138385,-2660958}},
+        {{-8206673,14163498,-7605786,-11773789,-32797110,-13461657,7373539,4045155,-20088469,15515326},{-14708063,-15843052,26027573,2237560,-15175390,2681590,-32157940,-2280724,20867338,-9268434},{1,0,0,0,0,0,0,0,0,0},{-32077931,4033729,-21371284,2979751,9962284,9525669,32191370,-6484450,-27594820,-1866228}},
+        {{30107881,-8163350,-26610215,-10831745,-1653796,4471395,-2937584,-2597734,-21945552,-572056},{26288764,8965201,22587366,13932504,26781235,13806684,-8349055,-3590876,3903741,6044402},{1,0,0,0,0,0,0,0,0,0},{-18772682,13180388,-26009140,-15950005,-15073511,14795966,-28732940,6504713,-13854027,13900466}},
+        {{32138169,5222113,-17259413,-2725142,13079939,-11927874,18336866,-1258579,-5243913,-14005301},{-10610890,-10555504,-8821498,-14431703,32645947,3940803,3027620,11196550,-26335319,2713271},{1,0,0,0,0,0,0,0,0,0},{8320889,10796537,-12691257,-8132485,22568314,-3553785,1127888,2078634,13024253,8696538}},
+        {{5756826,-6894352,23981234,14350373,-19715125,6321072,-21169755,4976062,-19833432,-1999288},{879760,-5703120,1440956,16340933,-21297121,-7076862,15718161,-11828021,16667338,1676871},{1,0,0,0,0,0,0,0,0,0},{11282922,-7350390,22715125,9431194,20785229,-14124945,19603822,11656365,32241379,8165103}},
+        {{-3608701,7551649,-16831759,16742427,-11932953,-1263798,-27601013,4945266,-620694,-12799459},{-22771232,-333905,-20668484,15359114,28144659,-12102823,10612084,9354064,-6940200,14711626},{1,0,0,0,0,0,0,0,0,0},{-18493402,10202528,-3380450,8257139,-23796085,2432374,14693863,2265328,15954750,-14037249}},
+        {{4842167,-15186262,-8920909,9340362,-15184751,10529986,-23492421,-9460148,27575816,-13659249},{-5934517,4367381,2772101,2410746,-29627564,-394795,-26855475,843500,20521307,12520479},{1,0,0,0,0,0,0,0,0,0},{11021468,-8987973,5838921,11972017,22098174,8022740,-28629292,-1044258,-32546137,6441334}},
+        {{-23432106,4914455,-1431051,-3320049,5959088,-9128670,-12853487,15203745,-13687339,-10587588},{4777772,-2927052,-6220584,-11335742,-23085319,3805353,32575688,16261512,25427781,14356653},{1,0,0,0,0,0,0,0,0,0},{29856099,-7655894,-11844607,-16367508,-7634818,-15889446,6697262,-2322710,19439957,-8361793}},
+        {{20218790,14902224,8019551,-4668770,-21872134,15267360,7248638,-10854543,30637865,3649797},{4144817,-7928820,9616864,12540053,10755679,-13554909,-33199951,8003454,-30164230,-1792230},{1,0,0,0,0,0,0,0,0,0},{5286551,12006319,-27680876,12386308,-8208670,9712143,-31695106,-9078400,-1708143,946482}},
+        {{-9674260,2415547,31866590,-8964077,21442142,-3577770,29660081,-11106727,-5598117,9163480},{29209633,-6809731,-13243390,-14930038,-10792926,14840305,14592819,7117091,13077025,14928126},{1,0,0,0,0,0,0,0,0,0},{22156416,64227,30260743,9783009,9736264,1484473,-14142167,-14405121,25720880,-5482829}},
+        {{31174543,-5879147,-2528893,9767013,32157323,-10763164,-5133733,12948592,2066267,-7912558},{-24527199,-16101292,20744449,14089771,25995305,-6962775,26940921,11054343,6777351,6347161},{1,0,0,0,0,0,0,0,0,0},{-23805207,-16557642,-29294251,-5094049,-15711333,1932299,10475745,662138,-3773243,15378556}},
+        {{24335436,4945703,-18694566,524063,946035,-5226382,-26582377,8073556,-26217186,3571818},{12048903,10838714,-5863326,-5725645,29329043,12902193,701055,-15092464,-2629335,-6853177},{1,0,0,0,0,0,0,0,0,0},{29222038,16050096,-24351249,15164282,8983678,15878427,-25001332,-2284668,-27495719,10916273}},
+        {{-4466323,-7823912,29618535,-14655672,-31248003,11572514,-29228875,-3310300,-16791536,-4642779},{9933045,4263073,-21685520,-4765533,20036749,7649982,1115834,-11308433,-14571402,6685474},{1,0,0,0,0,0,0,0,0,0},{-21012017,964286,16805316,-1518568,5918863,-10549544,21413467,-13801615,12936350,13082435}},
+        {{13595235,2715504,20122194,-11063295,-13560092,-13387883,30551486,-8085377,-18701157,-9936172},{-29816619,-13396924,28977374,-16498662,-10319480,153680,25515717,-10674251,-32985332,-2624928},{1,0,0,0,0,0,0,0,0,0},{22851088,14413431,27279038,-4589527,-31363119,14105767,24101958,12774337,-28803089,11383170}},
+        {{21451965,4883433,-17711604,1281179,-18221099,4628421,-16954468,-1797763,-12161938,15267556},{-17230058,-15901327,14092628,-14185982,2978761,2647364,-17302269,9668822,19385180,8653390},{1,0,0,0,0,0,0,0,0,0},{-32389383,-6418956,23158717,-8077727,-11378186,-8871152,29715897,14732443,23230709,-3705068}},
+        {{3161642,11939636,-10993226,15223174,-11227044,4545608,-24496839,288020,-25882083,2901445},{-21913117,-10288506,-27110427,-15997740,-18869493,-7445292,3049083,12817395,18845535,-4193129},{1,0,0,0,0,0,0,0,0,0},{22710090,-2463640,9216794,16062297,12975017,-3114146,23715645,-16301320,-22147933,-2273352}},
+        {{22823490,11798756,-32734660,5500752,4188816,-8035641,19123571,538791,-9238969,8514214},{7598659,-12323916,-15814037,-6425553,-26610529,12712254,20351829,14000649,-33434125,2436905},{1,0,0,0,0,0,0,0,0,0},{18832226,-9536305,1662494,8904862,-9007157,6317102,-31864908,-10852135,27998271,1774071}},
+        {{5542212,7529731,-14153457,-13993926,961897,9883921,13962794,9472627,-28748490,14348415},{-1153391,-7946422,-4134084,1404657,11618212,-16546604,-26155138,15469876,-18620015,14253965},{1,0,0,0,0,0,0,0,0,0},{17385108,-8446022,1978539,11224496,27501163,14686897,24605344,774096,-11903731,-7742461}},
+        {{750285,11508840,-18724248,-8104462,26633535,152892,13534763,4004644,25110877,-4496497},{16549249,-12665723,17187140,16636462,3430245,-12760986,29246110,14574790,24819480,-7002840},{1,0,0,0,0,0,0,0,0,0},{-5096927,-7792443,30726030,-8354532,-7068468,11368366,-17387904,5683099,21078497,1371205}},
+        {{-26702705,-5511954,-14195247,1804898,-19289866,12679191,21600896,3581323,-10159885,-6123668},{-13669205,12078173,23624479,14227314,25389148,-8549131,27191629,4279711,12519525,3225112},{1,0,0,0,0,0,0,0,0,0},{-27885160,730265,-8817779,14237532,2212078,2496779,-5526837,15120747,20168847,-12411232}},
+        {{9585827,-11972329,-18283575,-13017440,-16365421,-911054,25914659,991692,-28376133,-3546235},{-17693387,-10023995,25698386,-9019587,2021701,8218282,-4830956,-6735662,-29949602,4961454},{1,0,0,0,0,0,0,0,0,0},{760832,-6602780,-5507482,-7997506,-24950548,12657116,9806904,8854261,11439715,-1299992}},
+        {{14876961,-1020159,-8913315,3288124,-30286391,-4075262,-27571727,6752910,-20003417,-4607144},{27924285,15721847,-3666580,12189406,9918561,2411313,-32690248,-9193363,14902817,-10722371},{1,0,0,0,0,0,0,0,0,0},{-26182510,-12744842,11096474,3840491,10598120,-4828467,3344667,11878722,-23633664,-1539659}},
+        {{-31767636,-11157892,-29740156,4358479,14889008,-14365711,-2794374,12283858,-26216785,-7176309},{-23867392,15485698,-25241512,4233211,-14874621,10161489,4170157,-15633827,14294557,13297175},{1,0,0,0,0,0,0,0,0,0},{-9533381,-2748264,-29794072,8255252,-23476451,6909915,15197014,583343,4671054,-12477140}},
+        {{17371612,-15533924,18349448,-1213577,15699888,-2784118,-29678494,-2224713,-29477618,-4453515},{-28045016,6765002,29262629,-11763358,351314,-9341213,48196,-14124606,-2617208,13982006},{1,0,0,0,0,0,0,0,0,0},{-21986368,-6040592,12206624,228358,28015567,11227935,13628785,-4179525,31592500,13717733}},
+        {{18575905,3337141,-17688851,802659,-4289669,-1552857,7435945,13968974,-27926793,-7546995},{-32353157,10822134,-28564855,7094072,15484212,10252738,8966215,-7388476,33358818,-10693005},{1,0,0,0,0,0,0,0,0,0},{28887993,-885932,13816209,-12146911,6344602,14398324,26208419,-14528940,21211373,12703975}},
+        {{30433758,1119522,20689505,12707122,21444911,6895376,-30091557,5579977,-17547616,9814788},{30457234,16511759,8034892,-11110264,33058710,-6941408,412731,-6624801,-14973282,-10274882},{1,0,0,0,0,0,0,0,0,0},{-25922186,-8083855,32107761,15720774,-28878625,-12322525,-29722618,1751202,1086569,5133978}},
+        {{16842881,-11470454,11296079,4915253,-7542634,4150359,-25781973,-438342,-15508546,3176121},{-31570590,-167654,14235626,4689371,15764298,-5154130,-5300506,-14571050,19522853,-11674144},{1,0,0,0,0,0,0,0,0,0},{32413300,-1734725,29889601,12203747,33378004,-2948568,-19451485,-4800673,-26569261,12212112}},
+        {{-8331904,1299629,-31699248,1348490,-5555864,15810525,-28619971,972254,-8688598,3539283},{-21914550,-11930793,20590026,-5829178,-20673101,13270101,16059849,5847067,-26376275,8014015},{1,0,0,0,0,0,0,0,0,0},{-33318127,-10441837,-3309118,-8421220,11426295,-1384770,4927226,-11408310,26108174,-2526066}},
+        {{16987393,7859710,-25249785,2743415,29428970,-14515403,-33316740,12231345,32245828,-713060},{-25499456,-12624799,5628003,-2785039,17209705,-8890742,-18760009,-5300056,-5764669,7165164},{1,0,0,0,0,0,0,0,0,0},{-22644105,-5542938,-13456686,-15325248,30597359,-13363453,5673799,8264837,14781049,12765440}},
+        {{5135667,12682945,17480111,15500477,12058382,-11023236,-8861984,10714293,-3221633,-126136},{-8152413,14826761,-16683958,11210788,9171265,13692448,18474470,16148729,-2801934,12942626},{1,0,0,0,0,0,0,0,0,0},{-3836262,-9455273,21135802,-3558113,9241108,1391342,31430839,-13435537,-13213445,8537064}},
+        {{32110338,895825,9957537,9798846,24865169,12401612,28561792,1615611,25004406,-8924732},{10294314,-5482054,17473314,-4059950,23150077,14604369,-6979402,12841602,7302479,12117112},{1,0,0,0,0,0,0,0,0,0},{18138636,9811479,24135098,-7006436,24508131,-1979481,-2699167,-9295538,-16955988,-3008073}},
+        {{32789938,-5783983,33002405,-5188324,-28892760,14782115,6362948,1636914,7313188,-12175497},{-2827974,16092387,-20034576,4780316,-9633700,-10458190,17141970,-6218713,-11978129,-2640689},{1,0,0,0,0,0,0,0,0,0},{-14060853,12857741,-17684573,10662292,-4034243,16520154,18913358,-12935406,-31791754,-13822389}},
+        {{26162339,1463662,26033527,16109165,-17243893,11261010,-33405779,-4027470,-4871706,12463662},{21846168,8324092,-4415741,-10306305,-11766588,-13051454,21086885,10889041,27349407,6026777},{1,0,0,0,0,0,0,0,0,0},{-6185713,-14531903,28063060,-10607541,-15595899,-6219725,-29813668,12724225,30974043,-4792218}},
+        {{-19234692,9921699,25418966,8572284,6690630,-2335363,234661,-3057038,-27102864,-5222730},{-24620193,10347324,-19068931,12208605,21746781,5296533,16119583,12705832,32245879,15618510},{1,0,0,0,0,0,0,0,0,0},{19664111,2972511,16189307,-13086621,19685246,11860924,13921933,-6819064,30117379,16495336}},
+        {{-8152728,13563813,-29536584,11075144,16358530,-3512826,-8484196,-4868695,-24701986,9021795},{15536596,10080448,-28119362,-16721656,23002462,-15085382,-24162331,-2668358,27803251,2150794},{1,0,0,0,0,0,0,0,0,0},{-6252564,-16356634,7837251,-14274697,2160850,-14113129,1029717,-7183712,-29093540,6073887}},
+        {{31157915,-2095762,30546081,10382242,34746,-2805058,-31028992,-14194495,4122507,4976434},{9927390,5683765,31397865,1387757,11083519,10581036,-24884433,-11690255,-8108456,11594787},{1,0,0,0,0,0,0,0,0,0},{1588031,-5700138,27214588,-5499795,19479772,1501229,4707388,14000643,-21665771,-2973162}},
+        {{10749813,11581172,-28386334,4435840,2048505,983012,18705373,2608180,-13578302,5398451},{21654810,-7631003,-13931149,-14922255,-26189961,15673036,21499847,4553634,18632088,-15725382},{1,0,0,0,0,0,0,0,0,0},{-25561821,15113419,3624180,16504407,29165557,-14526407,-14438300,-16194693,-5178045,7515601}},
+        {{-20100974,-1997548,-7614318,-15455188,-25883401,-15603074,-29176829,2659600,-28956834,7851350},{-30703463,10220464,12702416,-3453488,-17893,9117651,8560252,9803160,-21964826,-630852},{1,0,0,0,0,0,0,0,0,0},{-5953889,-581670,-9606149,-16561133,-11333260,-5239693,-21654414,-14413767,14820031,14196946}},
+        {{-12632455,13116727,29672916,-16371305,-30926745,-9521218,22251875,-15562202,-22920688,-13176857},{-18222241,12985457,-11281054,-9822769,18578065,13105326,-28092504,-13221835,-22482969,1664704},{1,0,0,0,0,0,0,0,0,0},{2593183,4098394,22465656,2254853,13811346,-15453475,2008108,-7871361,-5269915,9860789}},
+        {{-24011838,-6926966,-26688202,6801933,-25919027,-15406605,1876883,580038,26372658,453413},{16099648,-4628993,7760905,-12788613,-6677982,15697332,26308994,541783,9572925,13172494},{1,0,0,0,0,0,0,0,0,0},{32659797,-410088,-14152923,6007257,-2950856,-9047883,-26374597,-12498318,3333829,-5992856}},
+        {{-3858755,11193647,-3676648,4880839,-17701429,-2031585,29001672,12907822,25525424,-4226643},{-20829656,-5721854,-21059536,-4757023,28551790,1717050,13220415,-6716966,-22425812,-225278},{1,0,0,0,0,0,0,0,0,0},{2029590,-14912787,11293476,12385573,-18209487,-7044073,-452472,-13585896,-27956733,-10552101}},
+        {{7834931,6002528,13913583,-6333751,-23502518,7696191,-5215962,-1294753,-26441380,-9286842},{13993446,10372801,27826799,12206554,-5140995,15995454,17621625,-7188316,1877468,16064591},{1,0,0,0,0,0,0,0,0,0},{-18803886,12550802,26552978,7012525,-23011575,5321324,-1817169,13897231,20138645,-2444161}},
+        {{-28556753,-5158433,-1149123,-10561638,11185467,2511806,-8783457,7419815,-11641222,-14886324},{29755290,8437668,-18288579,-3744223,-2871156,-394813,2134073,7904161,31944900,12233830},{1,0,0,0,0,0,0,0,0,0},{-8333351,-4986814,9748406,15378324,13458895,861627,31500526,-10709475,-32862332,15382577}},
+        {{-12805775,-15769615,26912728,-11347252,20731584,6350040,-12103392,6680794,-18246543,15421139},{24287071,1450065,-20206172,7572841,-8730453,13696779,-6929785,-13764755,22423684,-8637608},{1,0,0,0,0,0,0,0,0,0},{19675164,1487893,26161693,-7465791,10001406,-5479587,1587743,16234452,27962349,-16675989}},
+        {{24156306,1677972,-1880099,-1488458,-2984898,9733234,20398630,-4513184,31009494,1651925},{9726994,-10115043,-27873328,-6436352,12742613,16588166,11651185,1837823,-18935888,1919755},{1,0,0,0,0,0,0,0,0,0},{-19931320,9522274,14713003,-252268,16691202,10080170,15503458,16470610,-33091814,-4351800}},
+        {{29636152,12119250,-13405885,-6042220,683164,-8724928,27260970,1412592,30304436,-14863783},{7991896,-13487361,3895797,2997861,4657272,6570528,-23100383,9291431,-32306307,-14306586},{1,0,0,0,0,0,0,0,0,0},{16928660,-9096175,16926364,13193024,13116128,16698109,14623339,11903445,29241266,-2481328}},
+        {{16927003,1812581,9548345,15796878,-31210905,-6554388,2060521,6792591,-30058800,5591929},{11773992,104741,-27970143,12053356,-3297671,-13945316,30411855,13938601,-258695,-11230321},{1,0,0,0,0,0,0,0,0,0},{-14523620,-15521465,14357662,3530759,-8462359,12551352,-6305598,-5316488,15035852,15908709}},
+        {{15607090,14261824,15360115,2844298,-11640909,-13939856,-10628751,-11983417,14216985,-691890},{20650191,-3008718,-1732350,-11229468,20615598,173179,8256087,6791892,2899838,-16143866},{1,0,0,0,0,0,0,0,0,0},{-8975273,-15404517,-27502501,1406196,-28254044,10453895,-33004649,-14808013,-11346000,10150790}},
+        {{-30421504,-14786700,29679369,-15346829,7331468,11033564,24679351,10094639,-19684382,11392669},{-1084098,-14633614,-32181106,9767598,-27514473,-2539529,13678381,-1655451,-26005284,8015373},{1,0,0,0,0,0,0,0,0,0},{-24702929,-15984226,6608050,3226314,10757362,-13113432,-24214388,-3107825,9380921,3375240}},
+        {{16306698,2606140,23681027,-2847496,-5299689,-3406397,6592130,-999615,-6208382,2405564},{-25496860,-14469529,18942141,12436123,20459209,13892074,-12562024,-13380066,-21249409,-6661489},{1,0,0,0,0,0,0,0,0,0},{-20982196,4873839,-22973994,10714846,-21085194,-9375193,7168106,-12395467,-14039592,10853188}},
+        {{-28361383,6723529,-20747770,-13028766,26170562,-16305119,22899948,-2057648,1767456,5321803},{11962822,11850712,-29755428,12390162,-8599464,-10413837,1003656,13712104,28393693,14881361},{1,0,0,0,0,0,0,0,0,0},{21060937,-324116,23546340,-5414234,32432434,-7763525,-31176146,-6280552,21878016,-11696285}},
+        {{-29683537,13784122,-26424885,8924967,3021158,324193,3042280,-15827143,27390406,-753747},{-4904025,-9165296,11537755,12821282,-13585911,2624298,-5200240,-304869,-26922591,3503432},{1,0,0,0,0,0,0,0,0,0},{30573703,-9339570,21726079,-7700588,30591543,9497849,10406314,-11796194,30211660,3066176}},
+        {{2024889,14180788,-31267205,-9746861,20281426,10942500,-26736146,13322666,-3522591,-9266333},{-29273537,-10832449,32212840,-12551972,15312031,5808836,31141051,-1663104,19927700,-4701476},{1,0,0,0,0,0,0,0,0,0},{10289496,-15065091,23763608,-12269128,-1932013,-4653807,-31497392,4996827,-19264044,10875615}},
+        {{9782420,-695375,-9274226,-8529701,-22760283,-7151030,20064888,15968611,14713178,8101035},{29632899,5995954,-3955362,-1208915,-8830291,-852521,-28371782,13430263,18388561,6319164},{1,0,0,0,0,0,0,0,0,0},{26742247,-7277520,-27881059,13892206,23730341,-4575685,14520265,6824949,21685739,2060680}},
+        {{15557553,8171634,7471792,-15360159,20182101,15705545,8028201,-228532,-14348370,-14458173},{1949110,-11381703,-33540462,-5696869,-28793006,-4492307,17421480,-11265435,-4540591,5458345},{1,0,0,0,0,0,0,0,0,0},{-19395256,8228161,9424591,7937693,-1205962,16772528,26955733,12153304,18613197,-7065294}},
+        {{27986550,15254787,-20945563,12519130,-4154596,-8235708,22744655,-8751662,33315351,-91321},{5919130,-1479056,-22645516,-5280263,32010852,3290660,10676760,-8621380,-23495383,-14533895},{1,0,0,0,0,0,0,0,0,0},{-3685015,-12962366,-6569111,7078050,-17923531,13651442,1732387,-4504098,-31724716,16576854}},
+        {{18061661,1779057,-24094266,-4948552,12376388,7721399,-19501050,5677961,-5192546,-15058584},{12282064,-1496204,-11249743,-2853465,4666434,-15894406,-30514870,-7676412,11132966,9761618},{1,0,0,0,0,0,0,0,0,0},{-868931,12947332,-376683,-10652443,-23772436,10785592,-2470106,-4741037,29222518,-2121407}},
+        {{29726546,-12057086,1658775,-8548070,6806515,14723894,-6615674,11153397,-24080059,16078050},{-3828540,4957509,-4035631,6569334,4620374,-14891798,-10887254,4774531,-22057290,-3257565},{1,0,0,0,0,0,0,0,0,0},{26875467,1213883,5436536,-16054738,-27238189,-14481056,-20591656,-10216855,11027625,-4452622}},
+        {{-9069725,-1123182,-2172315,4012085,-3348634,-8310565,-8912245,-759077,-31196672,15516668},{31891394,2307685,-14849455,-10628892,-1738865,-7220958,27542513,1562664,25115974,-9803751},{1,0,0,0,0,0,0,0,0,0},{-6333558,9117476,-20260371,7233836,-13397598,-4216016,-3462615,-8866268,-17584531,5237581}},
+        {{-14315718,-10819077,-31985180,-12129094,16398527,5006017,25315696,-14504963,-9536007,-14859459},{5003637,-6970232,25322318,-5704113,18640597,13299595,-8281580,14312238,4216222,15903871},{1,0,0,0,0,0,0,0,0,0},{-18472612,14021321,26650366,-4907942,-28454113,-15923935,-18068239,-1495617,32685541,9174697}},
+        {{22762211,-2930820,25757889,-16570462,-19915622,-15911850,4176089,4225946,28378401,-13294374},{23719077,11578209,-9587153,12071240,7369406,-1817513,29097050,-7268486,-18821233,-11416447},{1,0,0,0,0,0,0,0,0,0},{-2080315,5251170,6971922,16626900,-10579004,-4297966,-6598089,1823386,-22397561,-10933619}},
+        {{27844406,-6118002,-14366091,62883,-14900442,7729947,-365631,-16620694,-1602004,-16413542},{12177948,-10768227,1200375,7726115,-9096330,1290967,2793240,3150815,13197969,-1198788},{1,0,0,0,0,0,0,0,0,0},{-775729,12605830,-1581907,15250306,-23034425,-1951539,9202118,-6326457,-32558345,9185992}},
+        {{-27437285,16036464,-7924503,15734128,-7450401,2606154,5578505,16115394,-27396041,11328157},{11287072,-13370303,26256603,-2414925,13466450,-8329800,-386384,15530420,8788299,-2660688},{1,0,0,0,0,0,0,0,0,0},{-16606259,-10265848,31277013,-4297124,1446589,2387417,30738672,-9983304,25876008,-4681675}},
+        {{-19237669,6189169,391644,-706184,-4978729,16221297,1276633,14657402,20979648,-10376074},{4175251,-16496054,29451804,7707074,-27980615,-12469611,-26022337,-5555361,21562701,1403559},{1,0,0,0,0,0,0,0,0,0},{-3073520,10865576,5224570,12617410,-29387506,8670470,9573841,-15069096,25776167,-4479991}},
+        {{-3536364,-16410973,27423831,528786,13055445,11412507,-5985916,4777795,-12359513,-5955413},{20061174,7203359,13627795,6739935,23663520,-14014634,-26905959,-12355103,31736694,-2890833},{1,0,0,0,0,0,0,0,0,0},{-25328701,1239900,-15674217,459195,26602496,7440709,12590884,16482487,12698678,-15066988}},
+        {{5308842,14427006,-12228176,-566800,-32495658,15745963,-15142590,5796483,21536358,-15804089},{-6276852,-4161225,2788470,-2425269,9583971,-4674682,24199268,11930858,-7716669,-15534423},{1,0,0,0,0,0,0,0,0,0},{8675287,-3391575,-22982477,2640851,-24700530,-1805071,13718117,16223986,-3153751,6837545}},
+        {{-33170475,11088263,28652637,-12465377,31701021,13905947,14988340,-7879351,-20569696,-11964912},{-20256266,8360611,18314942,2012183,-16002849,13833957,21749948,14573635,5478374,-16588901},{1,0,0,0,0,0,0,0,0,0},{7215537,3225126,18680419,13105438,11163521,-7393684,-11319469,-12108232,25731013,14906040}},
+        {{1281066,-2301822,20668225,-5560631,-25411031,-6194924,3090694,-6277264,-20690975,-13390823},{3813739,4963136,13833522,-13824149,7726706,-10366808,-12952850,3256805,-2799793,-872439},{1,0,0,0,0,0,0,0,0,0},{31769334,-7268471,-4102406,-8626171,-23993775,3468869,18737352,7561428,7101788,-2349199}},
+        {{9650720,-5630960,-30866191,-5006012,-30441180,5992673,27672918,7232848,21081619,-10529030},{-11333498,9568589,20889528,12792356,-10457058,13982498,-22535264,14863138,-5140193,-11415211},{1,0,0,0,0,0,0,0,0,0},{-9609688,-1600574,-22490592,-3358933,-4761537,-1114747,4586696,16474156,4440567,206272}},
+        {{-10782019,-7797906,-23687922,-13402757,-11197886,-9121516,7036892,-11541453,16299480,-9288393},{-12982341,1740026,21273491,13916531,-19805023,11019871,4575614,-1682735,17922008,-12513292},{1,0,0,0,0,0,0,0,0,0},{18838719,-6168495,-1700553,-2431011,-19974336,4817879,25634492,-8722924,18398658,-842157}},
+        {{-30692484,-2897320,-27726894,-10131901,-10025126,10746281,-21512650,-13652432,-3182425,6335962},{-28180593,-9078027,-2576583,-11080742,26298244,12219641,-4505085,16014966,27710978,-4861100},{1,0,0,0,0,0,0,0,0,0},{3599931,6214595,-29118298,-7710035,13525587,196590,-13325556,2574340,23835769,-1770280}},
+        {{15563317,-16353048,15879035,10122018,-28974495,-9444933,21528655,-5296023,-26248212,11672477},{6724815,-15030060,33529837,-16100904,-4285217,-8591535,14872397,268200,-25320983,14970189},{1,0,0,0,0,0,0,0,0,0},{24483928,621375,-5244959,5911912,16627381,6441437,-21468524,3840789,-6193851,502644}},
+        {{7395842,-5449486,-1943258,-3941724,-15125783,14840949,-32210299,-1051201,-15726520,-8638425},{-32156867,-4657436,-5666546,-7191898,12404615,10958996,17036455,-5881340,24048942,-9897917},{1,0,0,0,0,0,0,0,0,0},{21854550,-12920604,277490,-794563,18147602,-5255715,-14877220,4299629,12803052,2693358}},
+        {{20213990,1831982,-11828251,5339909,19765596,-13073520,3667420,9366733,7684611,3526491},{2838772,-10734196,-14228449,-13435488,-29843714,-14922692,18431991,15844422,-31907261,16470420},{1,0,0,0,0,0,0,0,0,0},{17696373,1087463,-25983195,10027039,29430283,6901155,12438042,1843932,-22645867,15328125}},
+        {{-554995,15865773,11894816,4396339,23078180,14788512,7391745,1220108,33073343,-5197480},{29566866,13838563,17576579,11102551,-4415032,13930792,6518242,2508389,20946691,11982033},{1,0,0,0,0,0,0,0,0,0},{-15339153,-2914499,3373420,-15975620,-8224382,3148703,25365755,-9839270,-15477778,7987425}},
+        {{21398334,14576830,8434694,11843816,31193077,-6572805,-20405114,13873390,-32241354,-2070937},{-24703858,-11824548,-657354,-14116973,12318716,-10812322,21815524,13685039,1708162,9046517},{1,0,0,0,0,0,0,0,0,0},{2570187,-1447832,-31319297,6128496,12608196,-4511472,28561621,10406502,-12073484,-14370869}},
+        {{-18510193,9728468,18202556,4757651,-29889933,5152684,-7557302,9963617,7621689,9714188},{11651704,-10645507,3578165,-16336358,10816556,-14755257,11018587,10260538,-7089313,6174616},{1,0,0,0,0,0,0,0,0,0},{-28332453,4474530,-6305968,-8898808,9202726,-1767315,-6349057,13549022,4334047,13007505}},
+        {{25109651,11398902,16345966,-15782567,-1740039,10587510,25147433,-4591567,31881277,6896292},{-30036180,-6476324,-533926,-15602719,23059789,169097,22623203,-13542958,28462629,10308746},{1,0,0,0,0,0,0,0,0,0},{-24066638,10854464,30385782,4397007,-5928927,555869,-7480765,-4527093,2586546,-7086329}},
+        {{-7344533,-11989763,8959946,6786218,-23989904,-5289887,-29499075,11456087,27741383,-13866237},{24228653,6949917,6689243,-16182804,-11403701,11336377,-33196601,10425241,14916583,4292186},{1,0,0,0,0,0,0,0,0,0},{25001609,15896183,11399192,-5609419,1860276,-4587279,-32792064,-1230759,22938922,16196979}},
+        {{31472617,-6005560,23271154,-14867276,30899944,12169032,-28939797,14548451,10367269,11797692},{9271135,6706165,-32326061,13677928,-29067294,9423071,31780350,5746363,8855138,12074039},{1,0,0,0,0,0,0,0,0,0},{4227981,-1563557,-33534281,-6729452,-12659054,-13883065,-22791584,-3572117,9397567,-3920402}},
+        {{2136743,-12556628,5358956,-3914221,-6868527,11096206,-20349895,-4267340,-15755174,-8784786},{-16223122,-10651896,-29988540,2830327,22304008,-2893135,6479061,13436949,-15042322,7288175},{1,0,0,0,0,0,0,0,0,0},{27217884,9246496,7088835,9613253,-21992520,-4462632,-24185973,7744080,-22135779,-9788069}},
+        {{31592074,8850315,22800024,9394414,-29974861,-10985567,32090226,-7152946,-23822839,10843689},{7463802,2764456,20649747,6126890,-19372842,9900330,-7108486,3125279,-15114883,7128635},{1,0,0,0,0,0,0,0,0,0},{-18341292,12025122,25840681,12870556,14272269,-4745276,668045,6540629,9812398,-6863436}},
+        {{-14619670,12078255,-794253,8930626,-11076304,-16322946,-23429630,-13960971,-26946767,6249809},{23333724,7321874,-24392968,4254752,441119,-1359710,8711129,10133654,-156727,-10302386},{1,0,0,0,0,0,0,0,0,0},{-28777102,12530301,13719338,-2073842,19112519,14086965,-11390507,-3804787,-20715154,-3220817}},
+        {{28077189,9696651,-3166426,-8780856,30830763,-11425835,7308986,-3685541,-1753578,-11338433},{9509819,6831654,-2274596,5398022,-33170493,-4462759,-5434767,-12588749,1915809,-12318760},{1,0,0,0,0,0,0,0,0,0},{-3725925,-11148568,-26539840,-460864,13795250,4832947,20063914,7904762,-21393034,-7346974}},
+        {{13679728,-3844573,7949153,14459526,-23720806,1210395,29578338,-5747059,6336795,-5053879},{27091069,1206967,18414204,15432516,-21680,5280088,12884130,5345920,-20147837,-6097498},{1,0,0,0,0,0,0,0,0,0},{-9242906,-13689576,-16411497,-7020458,22024971,16370393,-20462630,-10302444,-12328674,-3191802}},
+        {{22192259,1568224,20528734,10811076,-17450658,-15392069,-26361839,-10563225,33403956,-11654889},{-33494220,10570923,30372217,-12449195,-16311017,-4565013,15861186,-14546649,20924940,16238374},{1,0,0,0,0,0,0,0,0,0},{-12476441,-7138612,-4308062,-10887410,25130928,-14604644,33359006,1322898,21315221,-4130553}},
+        {{-2477418,11549400,13283590,12243312,-20178304,-4294542,2820273,-8330077,-10654535,9492072},{27083442,-13996935,1148455,-12680993,-4306931,-16563166,-16020900,-11599965,1212624,10549111},{1,0,0,0,0,0,0,0,0,0},{6138310,-930756,31648848,-4492784,29511126,-16291852,-32059214,10048331,-7891391,5849750}},
+        {{24476351,-13750904,-21132516,-2280123,29926401,-14688885,21846330,15652386,-7096905,8972078},{32811289,-5150215,-21069820,-10295302,23964064,-5411256,-7539438,9784947,-20721813,16534325},{1,0,0,0,0,0,0,0,0,0},{-32251768,-5384425,-29362166,11235183,-13754630,-14130530,-17492335,14815641,-4042533,8464916}},
+        {{28304664,-8829287,10932700,-8727124,8792702,9513884,-5741148,3113809,-2007963,-1874168},{-21753866,-14692543,32839800,-2193556,-30921240,-4759172,-9313781,-453364,22048020,1208408},{1,0,0,0,0,0,0,0,0,0},{25588390,-10333320,-16181413,-3192906,16091344,1782482,-33049770,1916449,-27844636,10422510}},
+        {{23999093,-15566479,-28060716,-6363677,25801754,-7580199,4549680,4946713,-18511172,-14752470},{23421080,13671871,641912,11598039,-16863470,-11126965,26151640,-5486919,28100930,13922947},{1,0,0,0,0,0,0,0,0,0},{-30856196,-15107052,-23501513,-12980486,-18960574,-7510096,22728927,16048238,24596618,10344667}},
+        {{32716567,-15588025,9163211,-13128823,-11361237,10789528,-453716,-8717237,-32813189,7567409},{-23205754,2853639,26959924,-14092637,-20776885,12510270,11467429,9576588,15574521,-13669057},{1,0,0,0,0,0,0,0,0,0},{16186738,-3845102,14882863,72452,29353893,2635426,24818195,-10102891,12619475,-706021}},
+        {{-21384326,-4784596,-31999863,-6663220,21056324,1652487,6284735,475716,-31620843,4138888},{-32771667,14398087,-24487401,-5834117,-1819174,-4803719,-14236326,-5555719,-25316479,5652305},{1,0,0,0,0,0,0,0,0,0},{-4827215,-6381417,9808051,-12284727,15415723,11606906,9501874,11755680,-13802774,-15071360}},
+        {{1088799,4591719,8048044,10879302,-15672386,-9181548,-25342570,12992581,-33052032,8091298},{33154608,-4075899,-25465780,-1334347,31944950,4918560,-620989,11245889,-30702164,8499300},{1,0,0,0,0,0,0,0,0,0},{-25830185,-9547533,1922615,7670459,-4703321,-1228088,-6752631,6100965,-10948490,8065717}},
+        {{8297154,15735613,-1928572,14415585,-2247732,-16598001,-1943456,-802312,9358905,-9784407},{-27683207,-7210743,-6488432,11917389,1339575,-8912402,15418569,5897322,-17808273,16040072},{1,0,0,0,0,0,0,0,0,0},{-538651,-7606973,-9559641,-5228056,337559,-6641895,-17403278,13665332,-33378397,14196588}},
+        {{-10993957,-8512443,-23771749,-542355,-5040106,-11786608,-4068192,4072742,25343995,14513236},{-6020659,-7007468,26374048,10440840,6606437,7795400,-10598307,4535309,22726412,12960633},{1,0,0,0,0,0,0,0,0,0},{-18988082,11995386,-1197538,-16191694,2823505,-2892079,12529946,13661897,-18743292,-1950710}},
+        {{-10219314,9478829,13378824,6707372,2961867,5687348,15074841,-11156933,-413510,366779},{-22395525,-8027979,-31417380,16516540,15532565,15017211,-18122714,-15409598,32387690,16729000},{1,0,0,0,0,0,0,0,0,0},{-13766201,5665807,-16420874,7738914,9854762,-13283240,31016054,7654133,-1990802,-508724}},
+        {{-17132054,11761296,3741150,15863896,-5141865,490189,23174058,7879977,9944952,14131007},{-18492314,-4194016,18086683,1197258,-27751767,-13365188,6569189,-11314052,-22491998,-3679769},{1,0,0,0,0,0,0,0,0,0},{-29903448,14045649,-11589445,-788406,-1471936,4255107,21351975,10527202,-500616,-7514501}},
+        {{-9521654,-14343738,-4924340,2680083,20584716,-13050387,32483795,-5787664,-9177230,9506037},{2587421,-15920378,-9563393,-8807627,11041297,3383509,-3683731,-2426977,6898723,16679557},{1,0,0,0,0,0,0,0,0,0},{33506276,9384328,-20791481,4938367,30077501,513563,-19767556,-5651267,2132957,-11012217}},
+        {{16978001,-14487646,-4547100,11203353,-24717712,1581116,6789796,13043032,-5097382,16052155},{-12976017,-1703429,-26790727,-16500956,4508670,-3304807,-8996358,-13461673,-8949134,3387075},{1,0,0,0,0,0,0,0,0,0},{-9526821,6181684,22487783,-9995412,6327816,-15055712,-17209523,6803741,-6871190,-14185288}},
+        {{11804072,-9607255,1530793,14395495,7466838,-16006830,-13054600,-10662761,-6794607,-15062997},{29368700,-13469230,-11175065,-11752919,16193631,-5933121,-25089095,7172096,-30095304,-8013222},{1,0,0,0,0,0,0,0,0,0},{4297224,8284556,-19528579,-3465127,16794843,4503661,31273010,-8312381,-13405099,13546181}},
+        {{-9811905,-10328274,28314363,6430177,-3357324,11475404,-1736433,8195204,3843857,-1425794},{26517832,14607658,-4234964,-5122565,24616276,10514346,-22125960,-219746,-19796422,94607},{1,0,0,0,0,0,0,0,0,0},{17171609,8126607,12552953,-354553,16735577,1191582,24686506,11440876,-17258129,-2640609}},
+        {{-9768031,-5915247,1736187,-5484497,-24471551,-14353070,-26615042,1490586,25442593,3600592},{3157480,14298292,-3536301,2701409,29347167,15939641,20664720,127302,2614659,-577816},{1,0,0,0,0,0,0,0,0,0},{32942596,540118,19778078,-1619903,15482640,7057517,-25909237,4938619,2157930,6003875}},
+        {{-25279960,-11621174,-30940746,4514653,6410393,4614221,27535541,1058141,1589599,-8186928},{-5252074,-14791427,-9564763,-9511659,7327029,354093,-24800902,-12441698,24559424,-9291051},{1,0,0,0,0,0,0,0,0,0},{-29736659,-6079857,9463292,5760571,-9218038,-5102756,-17514520,5579947,3347424,-12121450}},
+        {{-27040849,-9106879,-32445798,837540,-380414,15927528,-9888853,1079138,-19549184,6090644},{3871034,3253099,1627654,13971923,28981052,-7058804,-8039383,7327362,-17324196,4780974},{1,0,0,0,0,0,0,0,0,0},{27061594,-15415640,4436364,7363484,-22746255,12056597,30114635,11335446,-24317025,-16314592}},
+        {{13560002,4876111,16909483,2790379,14070411,-1012224,13393264,-15987440,10493880,3314498},{-10987911,-2982887,-19293346,4737739,-7217818,16405125,4829566,-9410885,-11089991,8373468},{1,0,0,0,0,0,0,0,0,0},{8061948,-12847479,9591816,-3842614,-2348578,3332147,4314561,-5528753,-23117734,2610060}},
+        {{2488651,-14343506,-29415020,-2522407,-8488120,2762508,-7243453,-10500186,-18802846,7033108},{10799268,13447001,21903376,-12120721,3663278,-3591269,10801945,-12667688,29908315,-13838649},{1,0,0,0,0,0,0,0,0,0},{20984602,7077615,-19883074,-3298239,10448848,13797826,9588688,-16623851,-22852058,-16695111}},
+        {{383412,5658870,-10101149,10355023,-28838288,-16636088,22505980,-2787275,-7048538,-7648857},{-1653229,-1073297,-20989341,-1665453,-15377546,7899665,-28643504,-8565030,7999171,-13164842},{1,0,0,0,0,0,0,0,0,0},{-30485330,11395826,27903064,1339328,-3289052,-9793511,-14321427,7474339,-727948,2398821}},
+        {{-21161615,-8640827,-30340607,12185752,-10924017,-5050854,15237971,-5766101,3915362,3647605},{-762686,-4952928,23392385,8604292,2591130,13019267,20796795,-6826800,24975034,-13290068},{1,0,0,0,0,0,0,0,0,0},{26940401,14857989,-1077089,-8767642,-8639072,13955051,-68690,15978892,-4135978,-1090322}},
+        {{-11508237,-9875703,-9124215,3489076,19422378,-9871861,11699272,-4187745,-30321061,-10769297},{7010752,6594911,16116734,16046146,28271563,-16235641,31403667,10789541,8905744,-12092800},{1,0,0,0,0,0,0,0,0,0},{-4515859,-3180059,22907133,-16425092,-10590161,-14677134,-20486827,9626887,-26085216,12793384}},
+        {{30298224,9277576,-3677802,3158773,31020719,13808655,6978350,9893042,-26469510,-5891039},{23301620,3318458,24186940,-6581003,-7934465,14364802,17503492,16099795,8279071,4412906},{1,0,0,0,0,0,0,0,0,0},{28370237,-205531,4747090,1643681,16222834,3324301,-32558152,-4186128,-31161900,261381}},
+        {{18060637,-2967972,25844812,-10765618,-5691802,-6252985,-25949913,-9904543,-23950905,-13300074},{20752539,10727829,-21776274,-4620883,14484337,-7142163,21274479,8744030,18382112,116325},{1,0,0,0,0,0,0,0,0,0},{3954053,7205215,-19055512,13272416,-20554030,9729796,-19154155,15291990,4758303,-6148802}},
+        {{16155074,10379601,6813432,2046127,-32827852,-13690644,-30348338,-16211426,-9178219,1394013},{-7602274,2195253,9218402,-8058356,-22190234,4816000,-21139040,-5394293,14893225,3872842},{1,0,0,0,0,0,0,0,0,0},{-28980108,-12418253,3050632,5452423,16144452,4975235,10452230,9146997,6534580,-6364394}},
+        {{-2776329,16387023,-15321716,16401088,13176273,-3338034,25295049,3533675,2602016,-7018318},{-4396103,4143292,-9899611,-3181766,-12364347,16515970,-15867070,11296823,-30803440,-6561075},{1,0,0,0,0,0,0,0,0,0},{5662575,-15801342,-15736234,-15897418,18170487,-758061,26066111,-5377269,2276252,12485568}},
+        {{-4262845,9759213,27975671,1136241,-29373243,158110,20947189,-8974219,-14905345,-9142935},{26747869,7896428,-30852037,-6593284,-4669949,-10294392,19705524,-1768513,-3347664,10024863},{1,0,0,0,0,0,0,0,0,0},{28786095,-5564031,30637316,6923459,-20783260,-16531819,-10455608,-7474393,9490668,8592011}},
+        {{20467922,-1278422,-27236160,-9098193,-24736306,-1375608,29530122,2632360,24810464,-16480831},{-19935759,-1035638,23019337,3047154,5274388,290376,32279523,6292617,-10639569,4627817},{1,0,0,0,0,0,0,0,0,0},{4054196,-449991,-4183316,-14947868,21013930,3905975,25814853,-2779910,-27996269,-11580124}},
+        {{-27979529,8915291,24907184,-7656489,7865757,-3722435,-14301732,10574672,-18148536,727153},{-30447625,-15290393,-27933442,-7707091,-14881991,843020,-1944889,-6685093,-6930107,-9406611},{1,0,0,0,0,0,0,0,0,0},{-31451533,-3445220,29412885,-14432001,-495111,-6300489,13363987,14017190,21338018,-16543206}},
+        {{15670333,-7411592,-13377736,1253994,22316703,15255652,22720465,-9641914,23725544,15522779},{11479453,-5466603,18678289,-10067144,-1471575,-540585,-5670923,4152589,4959558,7551318},{1,0,0,0,0,0,0,0,0,0},{24121528,-7290857,-5958100,-9979580,14429554,-11370500,27594308,-9065775,-22848536,-9913331}},
+        {{-23452847,-9793899,8363056,13686485,-23222529,-7069592,14949858,1927320,24254905,-15583690},{17693383,1749722,16797438,-11849696,11977086,-14178601,-12196172,4113692,-4405540,-15611153},{1,0,0,0,0,0,0,0,0,0},{25085853,9640205,-24019785,-14103559,-20744276,5945161,8834108,12181770,-28289191,-6196449}},
+        {{7105129,12402274,31928314,-12875686,29954019,-2252602,13122408,6759840,-10519771,12913302},{-1707998,519664,32613965,3103224,-24538215,-1700428,-11642472,-7901296,-26558351,-3955708},{1,0,0,0,0,0,0,0,0,0},{24827786,-14559391,15365237,13000323,15358490,13891535,-9539214,-8095074,-21559942,6874032}},
+        {{-12330304,11787543,29235268,733910,-25570190,-3718611,30129051,-5899391,-4386081,-7463628},{-27530705,4946337,-31707421,-8435964,-25861444,-8948216,9324540,-1526598,-28914400,-4856708},{1,0,0,0,0,0,0,0,0,0},{5249410,-9570602,15499312,7728647,31068309,3953143,25682901,5606922,7453897,-9253472}},
+        {{-10745632,-12277377,-15255732,-14704410,19477328,2841275,14551853,16496532,-23390763,-13146565},{-12986048,14026243,-9329418,-16326019,17255811,13214071,-3817256,10932325,20920446,10820737},{1,0,0,0,0,0,0,0,0,0},{7926081,-10294989,19139502,9792850,-8888744,-2925535,-30187279,-11660052,-23850424,13790090}},
+        {{-26373921,3226032,-13694120,5219098,28670936,5456534,-24541489,14643621,30097597,2419783},{-2309900,8134510,9265684,-7157627,-5874074,12791827,29941541,-8773118,4928351,8970203},{1,0,0,0,0,0,0,0,0,0},{164411,3305530,-19762289,3503182,28253437,10710759,8693184,9856826,-25951035,6538109}},
+        {{-7010477,-3096881,20054807,1840970,6436166,-1793306,24376466,1371045,28622689,11389569},{29504922,2153810,-20312251,-11141906,-7188156,-13727050,3571158,10567615,-21826658,11951789},{1,0,0,0,0,0,0,0,0,0},{23294915,-1825972,-30694310,-10176729,28658684,8754695,-24157476,8858072,31421909,-200606}},
+        {{6126456,-12526820,7766958,6379669,13616496,-9106822,-29673318,-13892612,-25534597,3471096},{20362212,-13442799,3566312,-14653377,6224107,4871746,-18673542,4433718,-2821467,13870557},{1,0,0,0,0,0,0,0,0,0},{-18142292,-8504929,-12650202,13678765,30930008,2779742,-22191972,-12261047,-12827958,-4680575}},
+        {{4843155,-4541643,7872718,-13213432,24009106,-7271797,-33072255,5341861,-21321274,-14191149},{-18123614,15237534,10130887,-15179242,12304713,-7990540,6885532,-12863155,5868773,-123892},{1,0,0,0,0,0,0,0,0,0},{11116262,-6760123,-32904629,-5372919,-33436218,-5756478,23021695,-3195504,-31173523,-12703537}},
+        {{2633863,-6432033,26450112,6279711,19459413,10071120,6124401,-14027603,-9071846,-5994905},{11712880,-13048661,9364768,-8595733,-20991614,-152928,28170425,-890842,-3292752,-5698015},{1,0,0,0,0,0,0,0,0,0},{21604222,-8815907,-23253137,-14094355,15026944,-13806306,9592585,12579372,-26561705,11701575}},
+        {{19929141,11533440,1121626,-4864610,11398652,-1814263,31141074,-10889203,29781192,-6037717},{5887746,-1680528,25607409,-3503682,-31371662,12590476,-24383170,-2202238,-16090697,-14631309},{1,0,0,0,0,0,0,0,0,0},{5252764,-13276929,-1295525,13575354,21721519,-13082846,-893361,7177524,2118955,7517291}},
+        {{25865537,13392454,5011378,10449753,15391734,12095088,-721072,14204000,-14575321,13114949},{-21569179,-3411460,6661185,4343476,12326102,-10577156,-19496632,4776514,-30464423,-5084772},{1,0,0,0,0,0,0,0,0,0},{11490137,4315187,-2185190,-11432229,4350695,6381780,23926853,-10746865,-32509810,-3863221}},
+        {{32173206,14534633,-27254292,1359198,7819332,-7114106,31592061,4702626,4294720,9918495},{22892091,9273360,-2936737,472022,-23507931,-13753013,-22522879,-5040681,11566333,2921618},{1,0,0,0,0,0,0,0,0,0},{6558405,-3952635,-22517914,6030475,30270032,-10380191,25919047,14119251,32297311,2438451}},
+        {{29382723,-9954427,-18210796,-9399519,-18479432,1673044,10727846,-9999270,28522357,12810130},{30343669,-12830713,-22382194,-10117712,604103,8877298,-31431553,11134470,16767606,-15602040},{1,0,0,0,0,0,0,0,0,0},{22913969,-1711544,-14235406,13304730,8239937,12689593,9071,-5089824,24873863,15245965}},
+        {{30528785,-8373305,-10630405,-1146223,-9437866,-13859413,28786261,-15734793,-28435977,12794591},{-3399540,-15398473,20782714,9144121,1388056,3816713,-12771775,-14168157,18252852,-4222155},{1,0,0,0,0,0,0,0,0,0},{-19679965,2838961,32649519,-15804369,1751285,-11943259,-27876829,-7725201,4887385,-16286204}},
+        {{-30035246,-6350822,-18716139,3152985,-8139972,-13530657,-6883419,15990533,-3131324,-16073144},{7262409,15750024,-8069483,10674537,-20023071,6680738,25540492,-926409,32822162,-7494115},{1,0,0,0,0,0,0,0,0,0},{30464963,-11139392,-28663252,4929578,8412630,11975661,8754208,-3670320,15699182,10022944}},
+        {{6648568,-16700658,-25225493,11042793,-29739464,1677954,-26616109,-15758126,17378765,10182596},{21890105,6278371,-19067548,12921798,29311314,10516528,4668294,-15568284,32123185,-11237637},{1,0,0,0,0,0,0,0,0,0},{-6006863,-7638103,26721948,489540,15085436,4379926,-17116724,7428939,-558760,-2509835}},
+        {{-16495977,14657583,20957234,-6681783,28130590,-6656134,28961051,-11537422,-31995245,-187565},{-21372158,-3573792,-3158109,16347426,-11233970,-8749381,-1112501,9560131,-22905500,1734366},{1,0,0,0,0,0,0,0,0,0},{-20143115,-2275004,-18749692,-8063428,-30931882,-12122147,-19490216,10440799,18852033,7407090}},
+        {{-4284265,-3508777,7245933,-7167969,18425893,-423104,11704339,-9646348,3276460,11940374},{20758854,-3292031,-26619184,15552262,1744900,4307366,-26606178,12418102,-23679084,16173386},{1,0,0,0,0,0,0,0,0,0},{371692,3876852,24265032,1544179,21087872,10272306,21296092,-15923835,-2992477,16650834}},
+        {{-29058869,-7059476,10194615,-873984,8937880,3644738,27722881,11061113,19579762,-244340},{-28571529,14954230,22259886,1739944,2723697,-12594893,22885927,3421163,-24864568,9156361},{1,0,0,0,0,0,0,0,0,0},{-28625264,-6928865,-673450,-5951174,-19697595,-15145290,6467133,9615436,2858169,7225274}},
+        {{23641764,-2045367,-2226118,3203818,-14000281,-1231165,16658691,3997925,-7787325,5889954},{7198785,-7419451,16200228,11551350,32844889,-10947704,17668118,1096876,29092894,-12156771},{1,0,0,0,0,0,0,0,0,0},{-24788252,12522221,-20897724,-9732430,-2652999,711916,-32583413,7046449,-16380236,15180696}},
+        {{16477671,-5536597,-30829192,-10746284,1275061,5162454,-6610123,10988999,-28650346,10776604},{-13017295,14670330,-28218085,-47137,2560318,-7142947,-30406712,11358797,3578758,13503651},{1,0,0,0,0,0,0,0,0,0},{2988050,-11617062,-21675682,4586919,-26642208,-12054274,-7243871,3256876,-24235974,-3447680}},
+        {{-21588024,11791816,3516095,-11285910,10954102,1155966,6286051,-4440976,20335086,3315056},{284596,1686752,23146913,15083019,4754556,-2114160,26916106,-7136080,10397047,-13905292},{1,0,0,0,0,0,0,0,0,0},{-609717,-13684596,26599137,-10268035,31648137,8824421,-25432589,-1353410,3772540,14439575}},
+        {{-27141703,7229696,14580561,-6550724,5902039,2165241,-5622899,-10365347,-13225573,4191018},{-334481,-891493,26437902,15834701,-10347597,3791929,29656520,-6622047,-13548351,-10503387},{1,0,0,0,0,0,0,0,0,0},{-28643524,-16399455,26094893,-10761129,20869342,13223268,1173809,11608262,-21727883,-14817422}},
+        {{32121822,14717244,28437621,-12948612,31975562,10762025,25660186,-11539805,32309230,-6839660},{32521823,15290820,-7523698,-11693316,-17424712,10490691,2141751,14118195,-23641598,2885904},{1,0,0,0,0,0,0,0,0,0},{-8445473,14279414,20516881,-15774359,26068462,-3099595,10787066,4290308,-10960423,12640589}},
+        {{11817076,7690510,-1656670,9039927,20368043,-4334438,-27529469,644204,29798327,9928897},{-12883556,10301398,-17290198,-4549989,-24107967,16319282,-8288557,4873887,-215742,15365863},{1,0,0,0,0,0,0,0,0,0},{21574601,-4781962,102798,-8510867,-3400251,3037328,21087878,-6364523,-13583669,-9816704}},
+        {{-33120265,9279181,4997216,1841262,-16728594,-1357494,-15543316,-1087595,-26947224,13498818},{-25437707,604604,9944599,-2209623,-16651246,15463398,5369183,-7134235,6285103,-13751860},{1,0,0,0,0,0,0,0,0,0},{23080130,5186092,-9646945,-4411116,-33310581,-9821191,30238723,4693687,30919896,13213859}},
+        {{1263013,-12966592,-26657222,15070101,-23671262,-3469126,25928634,11812014,-33021629,-12343611},{-3419768,13061982,32212818,4542906,9184703,-13474376,5956192,14101867,-32115628,-15447964},{1,0,0,0,0,0,0,0,0,0},{27010306,318706,-28325320,16491728,32667031,-3607935,-7674565,-4469351,-22257538,1445151}},
+        {{6147079,-7698738,28017320,10272182,17011243,15378829,-29571678,-11972367,30223541,4468111},{9121995,5668606,18558547,-8952346,19680970,8047629,2189699,2959782,5051961,10028847},{1,0,0,0,0,0,0,0,0,0},{6247162,-4329360,-19407217,-12745415,31604500,13165844,-33523330,4361985,-5124675,6063923}},
+        {{14867033,-6290193,-21506256,-13995560,-26366104,6754524,22347467,-4633323,-32961663,-12749706},{11411818,51766,7534104,11119942,13726702,-15591013,3960663,-14842129,-21039412,-6609320},{1,0,0,0,0,0,0,0,0,0},{-1073306,16690243,5025754,1133924,-20977331,3850863,-25039390,7187067,21882187,7391808}},
+        {{-3932634,-825819,6420204,-8652582,28530193,-1826408,14051352,13178379,26495123,9806118},{-7350488,-13871910,9423839,1559373,29632490,4805184,22253612,11167799,21194616,15347937},{1,0,0,0,0,0,0,0,0,0},{15075662,-11749955,-20451360,13887905,-26457778,13165554,-8305903,-11569974,-7381545,8666833}},
+        {{-3564054,7460020,-1728104,2225788,4306353,-2771910,-4248934,12061323,23566012,13921295},{2072641,-4316946,-23831014,8478979,-22036183,-2759688,-23333055,6035462,-4119332,-8257369},{1,0,0,0,0,0,0,0,0,0},{-13526542,13164985,6280628,-12056680,32852568,3653862,1779899,7308455,-23570118,4620120}},
+        {{-14108452,-5917255,-22206643,10026558,-29648108,-8910632,12238416,-9823558,7045355,-6829908},{27774950,7556616,14560000,16625527,29178053,-6509487,-20469162,-7223534,13072332,-6502118},{1,0,0,0,0,0,0,0,0,0},{249524,14783831,-23265362,12740771,25617242,-4522421,-30632741,-10081020,-21897233,1804688}},
+        {{-10154923,-103443,12840239,-11299317,30868163,7671689,-27348112,-5354506,27084336,-13581046},{30924757,-4898139,5663775,-10846228,19198622,14521461,7342704,-13195235,-26802554,10683030},{1,0,0,0,0,0,0,0,0,0},{31624809,3933151,32132765,-14075517,6611004,11402096,-17030232,14505730,-13428992,-7284193}},
+        {{-28720654,1993318,27964673,-12550420,-13851625,9259910,-32964292,7354284,32499616,-15723874},{-14381303,10141402,-3535979,742675,33163691,7174433,14410309,-5530401,23787292,-13418686},{1,0,0,0,0,0,0,0,0,0},{32764335,6992219,-16352636,13521180,-14656219,8465438,2908344,10758894,-28099412,-16743249}},
+        {{-18727390,10883412,-5073519,-3264755,-17697844,-12998710,10216359,2318230,15356804,9667150},{-31876464,-12601731,-10405002,13033103,-27521781,-12069496,22417189,5759486,-21189404,2725325},{1,0,0,0,0,0,0,0,0,0},{-23647077,-3339239,18340996,16437569,-8030230,2967372,20782662,2500404,-20505791,-10592861}},
+        {{9751772,9448126,-6053651,-2487839,585491,15846925,-32612468,-4438683,3149461,10992278},{-32375656,-11159260,30190868,1348717,-33051574,-14869367,-1965680,4126113,-23590970,-8056914},{1,0,0,0,0,0,0,0,0,0},{27976512,10607475,-8088521,-13145851,24485501,199073,32251689,12090247,-7491319,-3332542}},
+        {{-27545382,-13933581,17690605,-913972,16697834,10057671,-12765472,11742738,32834238,-1302931},{-4518572,-13634416,-28723565,-11042815,-24545935,-12891059,755322,12471675,28563830,4102038},{1,0,0,0,0,0,0,0,0,0},{-23452531,-13044725,-22121002,-907379,25645796,-6941302,-2770531,-10388620,972434,-3588359}},
+        {{26346061,8255018,26713926,15969985,-16107900,7285544,-18616826,7691684,18487118,-5231493},{-9546893,-16316201,-31949555,14628087,-12167675,-1285240,23905224,9243773,-19134547,1253123},{1,0,0,0,0,0,0,0,0,0},{5982163,-12517399,-15960089,-14331614,-14878920,14251830,-2974848,749162,-15331796,-5591520}},
+        {{-17879659,1628972,-2270743,11808707,15510769,-3597407,-1200894,6700483,32818683,14504514},{5342321,-11741892,-2863066,-11899544,8598779,-10211157,6134229,-5045641,-9718881,8838317},{1,0,0,0,0,0,0,0,0,0},{-26608355,8496046,-12083630,4634418,-16830539,14779475,-12337333,-4938758,-8115645,-11008113}},
+        {{17229391,-11501782,3910239,3059939,-26260256,7405610,-10611138,-2980836,-18677148,4988010},{-6205258,-6598116,3249301,-10277196,3201210,-2865641,-5800664,-14558197,-7610452,11576991},{1,0,0,0,0,0,0,0,0,0},{20873635,8185324,-9973892,-8706787,7201666,-14255400,26828512,-7593753,30553915,6408167}},
+        {{-10409307,-4525494,-13120231,2605901,20181014,-11148325,-14986557,2213171,16674342,9675065},{25836471,-3827977,21323515,13054861,20833495,-6590871,-21880999,7480335,10214378,3491554},{1,0,0,0,0,0,0,0,0,0},{4877029,4498881,2690271,-15554547,22497864,-1694722,8865340,8836321,21179714,5484291}},
+        {{-6772673,-10239583,15420424,6824198,9146116,-15493420,24002662,-2565031,-11954700,-2999310},{3366471,-4051551,-19266058,11324286,18980777,-11884125,-24956886,9246037,-8370809,-1209561},{1,0,0,0,0,0,0,0,0,0},{18592954,-5409936,-1443270,-12359560,19046449,-12465665,10623421,6623758,-17907068,-15769119}},
+        {{-32099554,6127884,30275267,-3281792,19506145,5938224,-20066623,14855120,-30428526,-810988},{-18603503,-13421526,-32202271,12691884,-997734,-10401119,-10202085,12466951,3658379,-11566917},{1,0,0,0,0,0,0,0,0,0},{-26465572,-11929782,18689610,1585749,5168310,14281282,16775350,-1504371,-8411934,-14833838}},
+        {{-23626785,9270900,29159222,11860072,-8437683,7341226,-10359975,-1168676,7566111,4236673},{-31589224,-15617160,-21622831,7229144,26235295,9375008,-2858853,-4565617,-1791318,8379745},{1,0,0,0,0,0,0,0,0,0},{-21512012,3967821,6165551,8182374,-17307081,7901160,24486727,5221575,11375014,-8479624}},
+        {{-25671685,8224853,-692804,-12746524,-29763502,-13974316,25742853,-12831189,27115708,1003285},{29762792,12696705,-31615549,3668883,31205403,14724458,704662,-5291474,-7373728,-13444750},{1,0,0,0,0,0,0,0,0,0},{-13057529,8559480,921306,-6212417,27740910,-13735149,28804188,344979,28817650,-14346418}},
+        {{-17987822,-15281218,-21330287,-3123154,-31975871,-14128449,23874588,9197959,-3403024,5624823},{-659806,4027213,6998662,-5291315,9121146,1526221,33306052,1373336,-29173317,266035},{1,0,0,0,0,0,0,0,0,0},{22995298,12315944,2311901,16363903,-2003439,-16515109,25230246,-10979686,4599962,-8225692}},
+        {{-29695353,-9186677,-150682,-7131470,8158107,-3738806,32815587,1767069,19339221,16393609},{6020641,-14305445,-30351896,-4817465,-26482425,224899,5250981,13428675,21217456,16044342},{1,0,0,0,0,0,0,0,0,0},{17282003,4510542,-20756329,-8749177,29815702,5165456,-25844656,6625101,-25736335,-10037935}},
+        {{27377199,12112044,-25947664,-2492429,-24980112,-10946031,-30406761,-5694991,-5484,-9007203},{21948658,4200441,-29249080,2606744,-18489479,16086712,-7816701,4386139,31813241,8215788},{1,0,0,0,0,0,0,0,0,0},{-23497474,10964497,1899752,-13574199,-22417217,-10714081,16420027,10372423,-10412608,13274377}},
+        {{4290465,11496280,30046931,13707743,-20588240,-7883067,2532513,-1889600,-15417053,-13678830},{7050928,10507511,29666565,5935294,8115896,10919768,13949009,7100947,-28141017,840037},{1,0,0,0,0,0,0,0,0,0},{19887476,12376184,18591078,10880760,28586122,7844429,20873774,9177453,27601945,-15299992}},
+        {{-4266973,-1408458,-26940141,-3540769,-3167996,11071473,-9293816,2549402,28416070,-2294127},{-12751200,4877129,-1936900,-11780797,12579512,8556830,23630001,-11790261,-16928176,11647517},{1,0,0,0,0,0,0,0,0,0},{-11064881,1925212,723694,8735089,15428161,15934358,-1431732,15240569,4819289,15447613}},
+        {{-30366706,-181961,4660611,-5782316,-19996916,-10605089,9136389,14296173,-1095315,-1026288},{-25533131,-2435771,-16327270,15894422,1472865,-10479900,-27648354,9644473,19190740,-12504538},{1,0,0,0,0,0,0,0,0,0},{-13436030,9192503,23551211,-9003634,-12036658,-11885193,-11511766,15177643,10176416,-1573518}},
+        {{-29947049,235958,226868,-14845409,-26443755,-6223771,-5282712,-7500038,-1212344,-3917671},{8765090,8007894,-22598464,14747018,-3454221,13491503,27823052,5798072,-5138992,-12608393},{1,0,0,0,0,0,0,0,0,0},{25849847,-8564879,4427747,12927947,-29123903,-11064734,-26507878,-13813282,22371173,-10088448}},
+        {{-24200388,-1362411,-21721056,-3058990,13708417,-16574642,3911440,-9417646,12080288,9518830},{-11526353,-15643608,-23796775,-3980805,-32493861,-14104967,31584847,6784783,-26658650,5062641},{1,0,0,0,0,0,0,0,0,0},{-22693810,-3530683,32426721,-645397,12278940,9132139,31875308,-11305185,-20996629,-6918047}},
+        {{-25592561,14599458,-23022427,-13956594,6601214,-11248553,-21632506,12078470,25011604,6308979},{517645,-16212534,-32833903,-11561632,662089,10363191,-25142083,-16156032,-4022751,5240081},{1,0,0,0,0,0,0,0,0,0},{-23693599,8799091,5098678,-9214805,-9036271,-1435824,7807159,6920177,13534619,10342671}},
+        {{-21952867,-7518283,17277193,-10184467,-7596681,9319701,31105113,-6499266,27893614,-11295187},{103510,3988,9064291,-5901376,-18004290,-8239876,-830890,-10203819,-25773600,-11151833},{1,0,0,0,0,0,0,0,0,0},{-5115392,-11272603,-11334759,7144162,-6797272,-12422969,27941595,16528901,-20449100,6891297}},
+        {{-27598528,16711464,3976309,3975268,-20044093,-15944063,22940353,-3517107,-26630302,11197050},{-1452311,13402847,-11992579,13675609,-30365527,-10492477,-10542072,9459844,-4316167,-6154576},{1,0,0,0,0,0,0,0,0,0},{-15776254,8008048,6073798,15604691,-15218729,-3600000,33349603,2986810,7497449,-8252348}},
+        {{25350681,9265284,6082511,-11999928,1325699,8360755,27566542,10724797,14254884,-11101802},{-23572784,-422777,-29766284,-15150,-17123464,1791494,13387337,2272246,6647178,-213395},{1,0,0,0,0,0,0,0,0,0},{-24598439,13213989,31383278,611094,-551124,505897,-13670919,-14475464,25545974,-4510308}},
+        {{-14991233,-6110271,-22062273,-3804104,-15547650,6974608,8541722,6507961,3976024,-11799323},{31366393,14902656,1580121,1009221,-31167897,5486486,6779498,-9754965,22808942,-16290595},{1,0,0,0,0,0,0,0,0,0},{-6214467,6406245,11856352,-9358512,4378329,-14799562,21192231,-130889,-32457711,-12571515}},
+        {{6437701,7904648,-26935901,16138151,29867792,5455193,-6058176,1298596,-4804489,-4664590},{-14226940,-6900073,-31062106,-13878783,11956200,-1517028,-26352106,-9154842,-7695213,9415410},{1,0,0,0,0,0,0,0,0,0},{22729255,-6179482,-23080035,-5212093,-32394773,-10283802,-1005278,-13321620,22101266,16407041}},
+        {{32193196,-10008800,7389063,-4298566,23581124,-11840785,8792081,16523904,3662614,-298562},{-31807485,-12959377,-17445647,6596445,-18359795,2296655,-17588086,641090,-1660576,-7609999},{1,0,0,0,0,0,0,0,0,0},{-5857658,16002283,28274523,6546055,-29822566,6656755,-27682790,13691652,-19576492,10834194}},
+        {{1067020,-16313095,25350486,-7934369,31014903,15630793,-30483576,9002228,-26031298,14705573},{20479057,-6857375,19687450,-13312685,4518940,-6311615,23282014,14980031,-3619285,-14884664},{1,0,0,0,0,0,0,0,0,0},{19354616,3121564,20004847,-14096971,-28097397,-8251858,-1193230,751894,-20387154,14566470}},
+        {{4051483,-3628798,31301959,8111820,-8442409,-1723074,-21207145,14934981,11382514,-15818318},{10985150,-14488987,31005667,-6244190,11904716,2271063,22324907,12453899,17378265,2870506},{1,0,0,0,0,0,0,0,0,0},{17425927,3333344,28244827,-11141126,-23033004,-8001968,9919646,-5854292,-29693964,-13700380}},
+        {{32499333,3938419,25528912,-10074354,21602348,-6427753,17096328,-3751422,-17759089,15764874},{-7340444,-4760586,-15767351,2008158,-22069152,14820069,-28167362,-4394098,-25783775,9967654},{1,0,0,0,0,0,0,0,0,0},{-9860826,14641706,17386851,4471231,116545,2430572,-10431872,-6495580,938799,315432}},
+        {{-12178039,2228325,724120,11599203,-9672470,7344568,-15285650,4112254,-9124948,-2665598},{-6703433,-9826494,4273873,-4791507,-4136939,-13845852,-33149796,-12722928,-21444137,16202226},{1,0,0,0,0,0,0,0,0,0},{15888788,13675274,15725141,15536138,-13702021,-10358634,-9224137,13288930,8441806,8924081}},
+        {{-9438723,7425846,21352134,12285006,-32353530,-16726791,17155791,204528,-4437854,8919283},{-2781638,11215364,-22732104,8117345,25043788,-253988,-10070524,9431007,5111746,-14764091},{1,0,0,0,0,0,0,0,0,0},{-32218306,-6425725,17146565,-10380542,-10290270,4832984,709704,-2083976,-17188173,-10692200}},
+        {{12497333,7765010,-25283814,16461887,15001325,-10016560,10448633,8787764,-10978601,15826473},{19768780,-2065542,3219499,-294138,6439024,15464707,-8693337,3581629,30128943,10471909},{1,0,0,0,0,0,0,0,0,0},{-12390992,12850475,28655970,-9280718,32186647,2956091,-16366367,-1454950,-29115544,-8022216}},
+        {{27637374,-11126688,12108242,-4006812,8771222,-12734879,-21369505,-5817958,1782957,5380278},{4629025,-1944166,14739683,13663084,-10012176,5823157,-10081115,11674292,22043541,6270070},{1,0,0,0,0,0,0,0,0,0},{26864653,-61519,31176697,3868642,33397103,-2457577,-26823751,5860714,19906067,-5083565}},
+        {{24891071,13085593,-5202298,-3109291,15805695,11920916,6004532,-6812068,-32678520,-3160102},{24521630,-13919061,-26696347,-12272215,23765818,10354204,-7239523,-9503063,19545409,-7647356},{1,0,0,0,0,0,0,0,0,0},{28522492,-6146941,-25874731,-12133383,-9000823,-14541169,-26686919,10301144,13146925,7688886}},
+        {{-33078745,-7063945,-5724860,-477921,-16983004,-7639733,1991415,-5920382,-13439536,-11074763},{-12851144,-3430647,-4175425,-4768600,24586587,-1758098,-28173235,-5097500,27706785,15678923},{1,0,0,0,0,0,0,0,0,0},{-10761836,2901032,-6520624,5781074,-28754068,-5528058,-26972273,-9577061,-25750287,-1046151}},
+        {{4871204,2215960,-13242560,13202599,15032280,11987858,21061623,10699614,-29761471,-1132858},{-17435852,-8376498,-17188317,10062806,-14716233,16347987,-24422800,8899458,-19404612,3496655},{1,0,0,0,0,0,0,0,0,0},{-22369621,-6663653,-31513064,4343199,24455829,10564645,-20511874,-12520695,-4559054,12762917}},
+        {{21427740,-13042798,9802028,-9202952,29956889,-16585377,-9035997,-6036679,8765556,-5621551},{13957891,9730044,-4784132,-9503387,6723926,-14630143,-29945433,11823667,800954,-15448015},{1,0,0,0,0,0,0,0,0,0},{-15059511,9686114,13695424,3958669,-17598123,6279626,-29292059,6474079,-2590166,-8183348}},
+        {{425281,8080995,111708,-6152521,5950443,13051042,-33031363,-10312740,19692011,-9121961},{-16026336,-7633040,-12167552,15730062,6089517,-13252910,-17086817,10285731,21827013,2656589},{1,0,0,0,0,0,0,0,0,0},{-19985004,13517701,-5187285,-1932802,24953274,7064089,-15577584,14781657,21785692,3960868}},
+        {{-2702947,8968933,22679142,4823281,-15097990,-978650,-27894375,7371151,-9923195,-1739277},{-30961354,14319444,5648803,10217440,31596446,-8895788,4016689,912777,-33501943,-4088806},{1,0,0,0,0,0,0,0,0,0},{-29043173,-5984695,-20534100,-4872563,-27119749,6393370,28870287,14392130,-12073820,-10194373}},
+        {{-17445289,7520161,-33271558,-1457466,22156607,-8412340,7048187,-4611689,-894672,5231815},{-14031201,13801547,-12051173,911603,20757963,-12545464,29208816,779057,21868957,11529662},{1,0,0,0,0,0,0,0,0,0},{-27167118,-14045220,-22019944,13598896,23610574,-4636983,-29514005,-1339386,25722437,7676397}},
+        {{32915116,-15820129,-15341325,9950882,-3583067,-1058924,-5196312,2824085,-16912943,16080823},{-3859946,-14851969,26024695,-6482914,13976690,4900167,18884869,11174281,5795743,4377511},{1,0,0,0,0,0,0,0,0,0},{-26167669,6317495,14637545,-11586002,-7512240,8442892,-13591578,-847356,-31726506,-13189932}},
+        {{24487653,15215099,-10392635,13152000,-3439404,-712706,23369731,7281230,-754605,-13164447},{-9584607,-2565116,22966407,11030438,-30528851,6097441,-23092507,16010361,9446906,7950508},{1,0,0,0,0,0,0,0,0,0},{10113479,15972540,25919692,14116141,59904,-15158277,-13810188,8618719,33162317,-5315300}},
+        {{33367329,-2764696,10665641,-7371696,9609610,-14284169,-11917246,-16071898,-32036445,3764487},{-7263864,-815213,-10772908,13430653,-12832414,-8281261,-20367209,-6616869,-27865409,13000773},{1,0,0,0,0,0,0,0,0,0},{-16970104,9809817,16834440,-9105022,-8273099,5235102,-14601380,3425946,-17859705,9196055}},
+        {{7544899,-11689754,-14767484,-2888178,30677363,-16596525,21061797,-2938027,30129598,-16246654},{9615551,5601390,-8009408,1708336,15013032,4906325,-27272845,-7556766,19842670,-14396306},{1,0,0,0,0,0,0,0,0,0},{-18312084,8409700,-22767923,-4566633,-16372583,3754564,-1098427,-11266265,28525387,-5395802}},
+        {{15489834,-10287886,-6167921,-7665205,30649045,-9486146,-22970084,8260416,30057002,2305192},{13574987,13401312,-26626442,12798482,-23536671,-9007782,15059927,5677222,-29168009,13681508},{1,0,0,0,0,0,0,0,0,0},{26174520,7461404,-32419408,521457,28194383,-11023289,28791069,-525976,2363341,1360821}},
+        {{-13076694,-7230667,-23438806,9082507,20326367,6387484,-18257480,13081184,-29265046,13122759},{-20937429,16585429,-1295646,13738923,-5166910,-16081495,-16124446,14758966,-21312129,10578423},{1,0,0,0,0,0,0,0,0,0},{-33356853,13876534,17047153,-13155057,593072,3307582,6649162,-6908600,16482,-12791741}},
+        {{2220365,-8279855,30213260,10800896,-6541728,12939767,-24511502,-3496398,22320120,-15545678},{-12304531,-13837376,24419322,-9460642,-4810790,-4238256,-8984089,1135646,14911820,-15621410},{1,0,0,0,0,0,0,0,0,0},{-23418433,-1591192,2047492,12063144,27737216,-9280361,-11741981,13259367,18707528,-4042882}},
+        {{17478558,-7337207,-33176868,-6868989,-22240476,-6960884,24613721,-5176019,2430367,14198611},{-32853090,-4147764,-24427585,14785751,-18963670,15384695,19477015,-4449810,-15112846,1985839},{1,0,0,0,0,0,0,0,0,0},{18285508,-13193284,12688486,-4099653,26509301,8466209,-22398586,-12651499,13237683,-4131436}},
+        {{-25288229,-12239230,21618321,-12603617,-22631122,-9639180,-22159767,-2254880,8830788,-11141940},{17851291,-1415807,-19522300,13210580,-88579,-5753036,33126658,-10626194,-13389106,-9893146},{1,0,0,0,0,0,0,0,0,0},{23104453,-9846731,-5867259,-6801064,29121631,4856791,18681598,6486957,-24199100,-5452005}},
+        {{-14123475,-6011669,28932507,14418462,-24978299,-5109284,-11052595,7497421,30820397,5161432},{12643430,7918673,1511290,9096643,-24318417,14436829,-2065699,-8997138,-7029609,-6544973},{1,0,0,0,0,0,0,0,0,0},{22090363,-13640218,-27678349,-6206053,22402312,12487023,23784707,6730093,9572614,-14848010}},
+        {{-30382052,1475510,22567268,-11595457,-1210256,5480455,16250731,7700926,13776530,-8695691},{30515134,-12328575,26075406,-5188526,-19138848,-14605293,-17529985,-3148008,-16755745,14757270},{1,0,0,0,0,0,0,0,0,0},{-18717448,-13552345,-5657448,-7927724,-27397146,-641620,29581584,-11668357,-15081419,16459025}},
+        {{27526599,-7942180,16152342,-7733572,-27359680,4454950,21732272,-12995424,27070571,16338111},{-2848187,5013235,3388537,11484570,-24490550,-16773256,24649971,-4125518,26137517,-9002988},{1,0,0,0,0,0,0,0,0,0},{11390413,-1409595,3148479,12734541,1482534,-780624,12135052,14375864,-10094636,3992379}},
+        {{27260239,4674218,24670388,-360102,21119264,-14675524,-11395108,9337141,15736132,-15969055},{16535809,-5813455,30154416,2292681,3961517,-3938536,9909555,-2886854,-21024764,14419006},{1,0,0,0,0,0,0,0,0,0},{-25721776,14827866,-3437856,-14640699,1475135,2288805,-6703185,7455971,10514046,-5703271}},
+        {{29921687,-2794038,-27480103,5127554,5584701,-14516820,10718514,13359555,-5784,-5501031},{9633696,-2672107,10957367,-11647926,3435927,5197985,19321077,9988162,25195259,-14811815},{1,0,0,0,0,0,0,0,0,0},{7838932,-11528667,-32459781,-3244631,18831034,-12866526,-32508575,9939810,19730996,14848349}},
+        {{-22292834,-13936091,-3618609,-5777780,24118340,-14310666,-14938014,-15455146,-19848922,6094320},{-26068210,6456565,12888273,-3826122,-5865378,-10553875,30900841,-7041841,-24427515,-7841850},{1,0,0,0,0,0,0,0,0,0},{3021822,-1853249,-27493295,-8054490,15280273,6189611,-17725491,15769539,21698909,11728257}},
+        {{22932268,2704976,-30691329,-1010643,-9129197,9203134,12379764,11180287,-31422598,-6120116},{31610410,-1993116,-31886282,-3902671,-16290231,-2458828,-8061258,9866670,-3345741,-10917414},{1,0,0,0,0,0,0,0,0,0},{-15491440,-12895224,-25928605,-15065095,17804127,5936255,-15075565,-4219137,-17527759,-11435507}},
+        {{13276028,-3442181,-30534262,-12683051,10503482,-12532652,-28637525,-2068655,-3641898,8248868},{14645450,-53132,-9942535,7277019,-7733723,-1685765,-26153751,540216,9524840,-5577392},{1,0,0,0,0,0,0,0,0,0},{31293411,-15926831,-32900237,8275794,-8994659,15368433,31822149,8788629,-2414470,14900332}},
+        {{-6443054,-825266,778391,4207567,31767598,-947245,-27600255,16682074,24763901,-16211340},{-18779548,16274553,31672601,-9774018,14248543,8798602,869931,-12032368,30591104,1788542},{1,0,0,0,0,0,0,0,0,0},{20512412,-8074051,26857662,-14830092,12863743,10094891,-25490797,10392284,14160987,2160194}},
+        {{-12608289,-10656991,24853930,-12183435,-13814469,9513529,12799931,16653443,25464718,-16374577},{-221566,7806855,10982844,-7763058,-32900776,-12582894,29923507,1281306,-13142151,-3509243},{1,0,0,0,0,0,0,0,0,0},{30202015,-2536007,13672966,4044443,-21356919,6828382,16274486,14384126,-18249612,-9758950}},
+        {{-1251820,-15493387,-32249336,-1608308,838919,16482372,-8110058,-14036958,-5404549,-1834961},{24222616,-7520346,12664567,-12875728,-2922337,11282220,12968788,-13271838,456733,11398911},{1,0,0,0,0,0,0,0,0,0},{-29648348,16668779,-13533390,5752851,-29318975,1370859,-24143831,-8394364,-28183261,-2672578}},
+        {{14574317,-1333286,1929782,7916960,-24488916,-2371435,11287002,2494855,2843686,-10477914},{-4053618,-767757,-16068651,-4729358,321212,-2185674,17757687,13250264,22094178,-6062779},{1,0,0,0,0,0,0,0,0,0},{22949802,-5036528,960375,13567523,25598879,3594329,-32610227,-16356376,6946538,-10696884}},
+        {{-29769513,2993013,-7673207,-607232,-1757860,-10060242,-22005228,10941210,6379521,-7606243},{-10053113,-13823818,7032581,-2000936,-15287053,3436672,-16647959,10707884,8332851,-15239501},{1,0,0,0,0,0,0,0,0,0},{29116494,-3853401,-628816,-2601792,7989612,-15467811,26321445,619341,-21070474,12310194}},
+        {{31029000,-10215156,31577402,-4014061,-8849684,3414448,-13375196,6440654,4570156,12587085},{-20563897,-9227232,30103445,-1272855,-7048965,6414223,-10745832,-5453988,-27410637,-9719062},{1,0,0,0,0,0,0,0,0,0},{-1981268,-14676806,-22255492,-4357049,18933317,-4848532,17753372,9633618,-2261152,-10867722}},
+        {{29477264,-1496421,12397136,12461119,32099177,64383,19190552,14565993,-207994,14575957},{23712368,-15222377,-23280354,-1103311,24809913,-3296044,22754103,-7688319,-1770266,-14606129},{1,0,0,0,0,0,0,0,0,0},{-28021267,7610002,13041664,-11700981,-30036790,1233776,-18138545,590905,1309408,14439629}},
+        {{-19446420,2066453,-7535269,9292165,-21201999,-1458468,-6487861,14169410,10666691,-10264353},{22713364,2714875,23988481,1472736,6459019,10152251,18302958,-15866369,32921184,12031468},{1,0,0,0,0,0,0,0,0,0},{-21701858,1199180,1880928,12399533,-4339593,2860849,26724049,-59150,-2025435,-8362582}},
+        {{-31089437,-8447377,16231679,4051648,-2432501,-5235440,-15642945,-3215502,-31126210,-14270777},{18033027,15944317,-6407743,7289622,-15597753,-8183541,2055039,-9962342,-15009449,3223264},{1,0,0,0,0,0,0,0,0,0},{-32018490,-14154937,-6072898,7464647,7569313,-2359185,-19798792,2976813,-24439598,3779017}},
+        {{-20294370,-1530714,6646759,-1549980,-4623882,-15674779,21983581,-12078394,-111194,-5620656},{-21061607,12039077,29552769,16243183,16042679,10805543,-4878745,5775291,4963019,-11638107},{1,0,0,0,0,0,0,0,0,0},{-32779921,5506309,-5536945,4021169,19007732,483770,-4577941,10325980,-26476167,5798919}},
+        {{28585952,-14499542,11925030,9702588,-19837203,-15578380,-5285728,-11977227,-23688392,8706855},{6429677,-4372070,4682730,-8430536,-1593034,-11041168,1232574,4067562,25971366,13867030},{1,0,0,0,0,0,0,0,0,0},{-8653966,-851190,-13781799,4048786,-15612718,-6437044,-27705837,6076835,14643071,346280}},
+        {{-26779615,4909025,10718781,-13929736,-17812502,5594582,5665695,8136545,31892960,4571060},{-26155820,-8291424,-625046,5648517,-3269044,-3410175,15904869,14227016,-493456,-4092272},{1,0,0,0,0,0,0,0,0,0},{25672946,13749342,26217417,10064065,-29645399,-15508467,15451354,-5138384,10721546,-13531144}},
+        {{4372221,-4996925,-13328587,-2843669,-20094080,6581961,-20327448,9196680,32331902,-14314544},{6909229,1874175,-19323838,-4375172,31874775,-8774689,24385086,-9313765,-14389241,13294757},{1,0,0,0,0,0,0,0,0,0},{-18962028,9138872,31048774,-12751592,-3723301,9959272,92541,-15974712,-32563385,-12709342}},
+        {{7130000,-11479515,10491645,-14162926,-23553591,13233057,-22892357,322809,33223568,4477235},{27712203,14133631,-514716,6485543,28668155,16424799,25898607,9876340,-5894317,9424712},{1,0,0,0,0,0,0,0,0,0},{-30627017,-10217119,-26235535,15155808,-1939802,8280221,33245932,-11721756,17115329,3804563}},
+        {{16257095,-8214988,-31447369,-1845580,-19693318,16643075,-5429728,9283242,-8458980,3189306},{-6439581,3884590,17718400,9784299,-24290111,5906401,-20802508,14089321,-10889988,-5365007},{1,0,0,0,0,0,0,0,0,0},{6513943,12430980,29944468,-15802720,14238399,-4459681,-25485490,3207888,-30300855,-2733933}},
+        {{9081634,-3731325,11440109,8431628,29181669,-1352406,23167495,8260532,10228340,-763084},{11014094,-5638962,-23957074,-16301115,-33485855,13093082,-21568383,1572986,24510889,-2675680},{1,0,0,0,0,0,0,0,0,0},{23098430,-5565617,-23210381,-4126970,8741613,1447949,-17189903,-14875566,-28500470,10189377}},
+        {{-17713876,-6060252,-29848631,9499358,-30296104,13789895,26989030,-9681996,-20545337,-10229562},{352452,-4806865,11883379,-11653103,-29868575,8493310,18042609,2726973,14840938,-3673466},{1,0,0,0,0,0,0,0,0,0},{-27570039,-2077271,713619,10324133,1394461,12062105,-649828,-5371359,-15551268,-8506844}},
+        {{28428582,-11896216,8340447,10783375,1674605,-13728494,-373134,9658019,23908733,12372926},{-31884163,323688,11436168,11790821,16153282,-13338566,-8379465,-4736229,26370947,2624199},{1,0,0,0,0,0,0,0,0,0},{13033387,13900965,-3681082,-1953087,3988837,2134921,-26129533,1363308,11147212,7104452}},
+        {{-18924979,-13201679,-5443947,12437585,-18352270,14119028,22114067,11487695,-8717147,-10786039},{7078957,-12070568,23733554,-15119474,10218175,8118938,-21115058,6932314,7843164,10159139},{1,0,0,0,0,0,0,0,0,0},{-3653094,14499638,-17240853,-2516253,8244442,12833229,-9343111,-7979252,-4629588,11831998}},
+        {{6458674,-9284092,-6186651,14882668,-3890507,7859239,23732448,2049867,-6912147,13081911},{-5893852,-5042628,-33098800,2494773,8569755,-15740356,-15998636,9356008,3286484,-9331857},{1,0,0,0,0,0,0,0,0,0},{14329555,6290465,19647779,-13666989,31241558,1877717,-18362446,1903791,21183902,2872956}},
+        {{2120377,-12586736,-9532804,7495751,-4154505,8745905,-23631695,865985,-27108701,905879},{-2057336,4379368,-19412960,-7994824,-700675,12184743,33162867,16540212,-25883802,-11745138},{1,0,0,0,0,0,0,0,0,0},{14303777,-9912011,-14018050,3598854,4311199,-771247,-23917811,4687239,9783883,15446955}},
+        {{-7440255,-8553026,-21048702,-9717269,-25556624,-3878650,22569623,2371421,19790687,-7451422},{-7495619,906310,19577455,-675976,32230970,8208528,-15773468,-16312793,1539928,7756156},{1,0,0,0,0,0,0,0,0,0},{12244333,8198067,-22875966,10538297,32177661,-13346141,8648447,6823058,-1162908,2444147}},
+        {{14314340,-4445432,27448836,-16370701,-18216493,-10701973,24776465,-15916326,7522320,-9107413},{-3486603,-16005116,-10568776,8915542,-28592680,2704290,-32288691,5767568,23139279,-8945288},{1,0,0,0,0,0,0,0,0,0},{-9482588,-14866594,31114011,-296847,7804223,-8874160,-15026068,8533866,3630120,-15369208}},
+        {{-10941969,-15276606,-7670119,11826352,12617443,3904579,4086377,-10468320,18557929,-2625811},{14916353,-15306618,8344387,-1124589,-5685949,3647310,5631618,-1224681,24388058,-1875508},{1,0,0,0,0,0,0,0,0,0},{-16972615,691081,32652800,-9397302,9964842,646156,29846435,-5021695,20261131,15519505}},
+        {{29747878,-15817363,-22276453,1682788,21541605,7533213,10909879,-8394252,-31332200,14501404},{23191765,-2041493,-32326459,-16309701,-30275026,-12995903,-23697086,-13847533,-12311279,-2316096},{1,0,0,0,0,0,0,0,0,0},{-22048280,11953025,937088,13783068,-19144193,-4820365,-16985718,-14191995,-18202931,-10646296}},
+        {{16954433,10886483,-25115641,11629511,32776532,-641337,-1969315,-10231021,31330415,15645805},{-22389950,2675577,-16839063,-12329677,21454224,2487801,-2703070,-151393,13632917,3299558},{1,0,0,0,0,0,0,0,0,0},{850404,-10528199,32347250,-11011800,-27177111,-15681261,22250242,6294873,-1262204,-11802959}},
+        {{-11275502,15259349,30613159,-9455240,-18378900,-11016106,33124676,-8217883,32494031,744153},{-7388627,14873899,15913937,5404396,-27190076,-1947606,16154026,-3858838,16395345,6452182},{1,0,0,0,0,0,0,0,0,0},{-29031741,-9859038,16939991,-4627404,-1372007,-13883281,-16429336,-15079923,25488107,5506627}},
+        {{-16988744,-7783876,-15965322,6534595,24817270,-6042993,-12282703,-11042110,14246936,7824881},{10464373,-3087384,-729688,-7755450,-19519649,-11903596,1219024,4365215,30854473,9416374},{1,0,0,0,0,0,0,0,0,0},{-10296733,-271946,19767304,-11033020,-7368701,154849,22615328,-13045816,8767633,-6717404}},
+        {{-5779923,-2431132,-32585941,-13050405,8622404,993055,769106,13956421,27124158,-13429535},{17249581,-14409098,-16886944,15173988,-27272542,10106274,-540309,7936551,-1069256,5807903},{1,0,0,0,0,0,0,0,0,0},{-3646167,6106648,17826998,2963823,6401713,-9052234,15636983,-14638397,-24719709,-14218991}},
+        {{-3064057,-7850743,16279710,-3161285,-2080837,434346,31751527,8363672,25442436,-12800460},{-27828864,10636585,-19692207,-6635573,-28970142,-14720669,27563515,-8886443,13484254,4540127},{1,0,0,0,0,0,0,0,0,0},{26657577,-14765728,-5630307,-8113713,-7578097,12603336,-2335919,-12487912,-8794089,-16235653}},
+        {{-1665549,-6206593,-9619987,15185128,-11956984,-9713845,31579178,-15067180,-21873880,-8373171},{2308253,14000975,12192491,16421362,-23616296,-3020317,33026058,-13683767,18890889,-8563331},{1,0,0,0,0,0,0,0,0,0},{-12398086,-424167,-11002695,-4692439,-26237368,724167,-12979232,13805904,-25794040,-15530548}},
+        {{31024655,-8657146,-14794562,-4757932,29938691,8583276,14374138,-13371591,10982127,-16089414},{-30252249,9965566,2056369,-10544003,13222208,-10443992,-7105959,-5821107,22980911,4504011},{1,0,0,0,0,0,0,0,0,0},{-18493891,4236665,-3450043,-94264,9116040,9504628,27919556,10994269,-12864247,4264023}},
+        {{14827093,-13791185,-22439245,-7229769,-1599582,10466053,-7897060,7530328,-12988375,-2285317},{-11165250,2710393,3292070,-3092917,9535849,10408125,2798208,-8534121,28819614,995253},{1,0,0,0,0,0,0,0,0,0},{-29665871,3928276,1929553,-4491587,26116040,7869195,5580449,3679943,-6807115,-16399354}},
+        {{28324049,12702956,22969583,1693550,6160669,-12933206,11283767,-3774578,28004849,15919727},{-2752069,10463317,-25810483,-13083646,-10519881,14781478,533380,10345006,29288324,-493059},{1,0,0,0,0,0,0,0,0,0},{-201290,15340394,-30392221,14948607,-28622789,-4976417,4617495,-15081021,32845310,11064099}},
+        {{2969679,-1695466,-11839726,-15328226,26915793,3045301,14950425,1964102,-18532472,-11616403},{-26918316,5293911,-32249722,7594846,-7314584,16584285,30071013,-3695070,25565639,6805161},{1,0,0,0,0,0,0,0,0,0},{18394250,163513,9506434,5116876,-9239148,14872865,10029368,-6523212,2401089,9837741}},
+        {{-31425150,8551361,24147165,13057353,-11435886,-12123924,28204864,-3577839,-27894354,-16361004},{3117352,4211671,15970043,-6281903,2678178,-16520940,-23205205,11454401,22784592,11918789},{1,0,0,0,0,0,0,0,0,0},{14268916,8621155,-17466195,1286671,-19155747,-13853231,19185511,-11513708,29670769,-11037055}},
+        {{-7034350,1843363,8763344,-14291154,-13825186,1996301,21176033,-7023022,9619329,-14016935},{15912252,-8370759,-23884054,-13317042,-18971931,-6139818,-10179083,7108042,5660035,6792420},{1,0,0,0,0,0,0,0,0,0},{-5817439,-8630702,32762945,-7257301,8721773,-2676918,-29190858,-6560004,-3964841,11259452}},
+        {{7220657,-8168713,6821625,-5683714,-32273074,2816802,2798,4337697,11504200,-13353815},{-16331662,-5902030,-23313926,2282331,-6152177,5436829,-31993699,-3799637,-29757811,-111787},{1,0,0,0,0,0,0,0,0,0},{-10920791,4402240,-21834043,-809145,-11524233,8659180,26833554,5491210,4758988,14589425}},
+        {{15385418,-4917619,-19011942,-9387939,4529652,8976350,-5558106,-15985998,1291944,-4062426},{-30856121,-10915697,-13314514,8008911,-28985848,11656049,-12913436,-12820915,-11036762,-10005733},{1,0,0,0,0,0,0,0,0,0},{-11832071,-9485156,1116514,5496484,27036660,537425,25059615,8495859,13438000,-1739457}},
+        {{15895571,16099062,2599539,-8019,-16541503,-15215900,-5634996,-690122,-14722002,1852105},{-16426683,10004720,18594857,-5247493,31800762,113848,31212383,-1136924,-27456411,4372872},{1,0,0,0,0,0,0,0,0,0},{-28239167,8681783,6530496,-13908604,-15913231,-13405787,-6411330,-16673875,28978799,15218582}},
+        {{-25279103,9935620,-5550767,9584189,12499682,-11928536,-23316843,5023884,-21359939,-12868474},{-360634,15818236,-15906884,-886348,-33240571,1590533,12994336,2251786,31220846,9601142},{1,0,0,0,0,0,0,0,0,0},{22726442,-5860902,23012598,-15019195,-29087340,5292028,-12942970,11165322,-32373680,-8069983}},
+        {{-8241255,5709468,-8869950,-11656725,-14692781,-9721200,13455123,16118617,6966530,-2435421},{20110230,-10274151,24757703,-6892614,-9138403,2185463,25514768,12633060,14791403,-11062612},{1,0,0,0,0,0,0,0,0,0},{-9082258,-16241620,-28061201,-8424661,-18827930,-7948303,-592248,-11567784,1289673,8558741}},
+        {{29834265,-16491053,-27746961,14288626,-7487895,-3546329,-21467391,-6107451,-4898799,15206501},{2918477,-15967136,-2228484,16725537,10767062,-2371800,-24119034,11374026,29052094,8709403},{1,0,0,0,0,0,0,0,0,0},{10534269,-12333109,4168254,933033,-3114967,-10858717,24327874,-8772140,6766811,-9041478}},
+        {{-26383326,-5724290,5254205,-10175076,9643668,2045878,5122396,-10375118,508541,-5573584},{1262467,-15594709,-25736403,1187629,-29561707,7207541,15599410,9160143,-2114493,1888526},{1,0,0,0,0,0,0,0,0,0},{-31542105,-15918910,8987451,6793097,-18613011,3150812,-26344736,-12120383,1379791,-16631779}},
+        {{-11406080,15571935,-12429704,-15480086,-10548154,-3799629,27762149,-4291292,-4653923,-9072174},{6694225,-2024370,24442498,11569307,-3707774,8751952,-23452783,-9623960,-30467881,12799477},{1,0,0,0,0,0,0,0,0,0},{-21296294,-2133898,-29214141,-7200972,12451200,-9282133,-5809785,-5756672,18981342,1625344}},
+        {{19435217,13626680,-31468572,-13836739,-26777322,2766991,30939130,5551121,21184781,-15451135},{24220163,-8244422,25140168,-13626600,-32755903,-14696480,-15378044,-6013648,28894279,-14149907},{1,0,0,0,0,0,0,0,0,0},{-14624554,-14597716,2134113,-10837528,19927044,-11211383,-18274230,64151,19693395,8257436}},
+        {{13545752,-14134144,9220701,-13554150,18866881,-856027,18938408,-16246132,-12997652,-5151285},{15210815,15129701,25018173,-2422556,6826161,13894916,-11220283,-7498577,-1908636,-11366081},{1,0,0,0,0,0,0,0,0,0},{-23117639,-10584660,-3589597,3001917,10235722,-3758376,835189,-8960367,21054653,-11036195}},
+        {{24338264,-11234010,28151879,12205594,27846430,12213990,-26400012,15067928,-13611821,2336475},{25724460,-4374107,23637665,-9680430,-16622503,4625290,4904495,11789815,14994906,13530113},{1,0,0,0,0,0,0,0,0,0},{-20461502,-10275325,-27585972,-8371566,21502021,-9264469,-3377138,-9295912,22795916,1562679}},
+        {{12823342,-12167232,-7983471,5051131,31316643,1475923,-18739179,15098088,27220856,-9023842},{7323711,14936385,22793275,-4502482,-7845845,2203879,6107212,-7540545,28443215,4897403},{1,0,0,0,0,0,0,0,0,0},{3852236,12775934,17354312,7649416,19865286,-11132948,-26088070,4072446,16161897,10932060}},
+        {{29625329,1324852,-17140027,9151619,21079532,5726771,301715,7118076,3313120,12443889},{-22812251,4208129,20173401,-12660832,-20989598,-9256574,16922423,14823053,7985983,-12258048},{1,0,0,0,0,0,0,0,0,0},{31135901,-6968877,33261872,-15183141,31829674,-7586288,-9723619,-9050357,15554679,14030373}},
+        {{3571155,15758132,28076605,-7845492,29025392,-59295,-22829886,-12657324,-6211771,8397117},{-3233807,-2250598,33466316,-9348984,-1333283,-16470189,-5015488,-2959639,-11360343,7274016},{1,0,0,0,0,0,0,0,0,0},{11966229,-8392405,-30292904,9766830,-22765626,-4732910,24930216,1590471,-27234916,-10485145}},
+        {{-8243152,10414338,12617223,12314957,4392584,-8847835,-29463645,-7782660,-16557662,-2426938},{-5603850,-15642062,16667320,-2120666,17628309,672434,9810990,5204142,-13414550,-16372623},{1,0,0,0,0,0,0,0,0,0},{24159813,8300372,-25692181,-1183600,-7105069,8375997,-27870797,-13636186,-22910965,1154415}},
+        {{-24884812,-10038781,15490266,-9798267,22873652,939673,33164782,7249035,31399445,-10761517},{-23709328,-11454541,-31051326,-16286317,-2840639,13687092,-25432553,-16761128,14595774,6354671},{1,0,0,0,0,0,0,0,0,0},{-17563731,-6418072,-1019297,1148025,9519498,-5790191,19091438,-12704203,-18711311,-13594039}},
+        {{26297574,-12909014,-10134750,-9371486,16455938,652691,-5878769,372837,-22490748,-9966242},{4433749,1191225,30404237,-14384419,-30096614,-8561412,-12142096,5557602,24364365,-12592144},{1,0,0,0,0,0,0,0,0,0},{2947444,-15067318,31761594,6782680,25487108,-2569280,9997409,14490852,-29582380,-4081992}},
+        {{-16131034,-2742655,-433349,-8661438,16333374,15894753,-12147601,4394390,2188337,-13304245},{31284989,-1731442,-11417371,9809067,-21402307,13526059,28160436,3776937,-13322083,-1187630},{1,0,0,0,0,0,0,0,0,0},{9979265,4037958,-550055,7713203,-24074228,4518840,-13342856,-7579005,27789154,16690521}},
+        {{-7194591,9329724,7653017,-4039916,31512553,-1024194,-22038237,-13913717,-23821945,3345644},{-30551498,-11591111,-16628314,-2823022,-726751,14473621,3897907,15592781,32154983,10824577},{1,0,0,0,0,0,0,0,0,0},{23450892,-5772088,-6725375,-13498501,24113794,16412021,-26320726,-13188323,-98132,9370098}},
+        {{-4609673,-13466013,-13137502,-10344560,4612155,-590334,-5477427,11973612,7744234,10507516},{31291064,-16613733,31878734,-15131935,13168801,16276040,23610699,8033866,-24418973,6012318},{1,0,0,0,0,0,0,0,0,0},{-17062458,-15723106,-10847031,-13652225,16581206,-12543299,15439044,-9027546,14181775,-14080231}},
+        {{-28085845,-14593768,-20753905,4088455,33473353,-14532426,283351,-2817533,18546904,-10379551},{-28371118,-2114078,28165399,-2791122,-12228763,11883626,14965317,13931845,-17396372,-8571125},{1,0,0,0,0,0,0,0,0,0},{-22200197,-13025983,-5855840,6125256,-33496632,-13427007,18463397,11447858,1451682,11363804}},
+        {{-4709959,-10163245,-16570542,-7331085,6496033,584559,-31061360,-5987551,20006936,4258860},{-11837052,5575264,11999170,1316934,-27286010,-15396613,26636853,2269635,1307522,11655272},{1,0,0,0,0,0,0,0,0,0},{-4878592,-14314155,-11427615,10295542,722916,13190457,18911274,15455222,23262968,-9469129}},
+        {{-15733707,10200762,32151703,5497416,3351614,-3078769,-16243489,-8140862,-21429024,8348617},{-26723064,-13201784,6060216,-11167978,-10130655,-4054934,-14988631,10473559,13464251,6203945},{1,0,0,0,0,0,0,0,0,0},{855955,10791977,-4710789,7400742,27910850,12563161,-13368051,-7806498,23302076,2524710}},
+        {{10600623,-16548722,-27556536,3400748,6247472,-3554769,-651142,-2560428,33533621,-12443420},{25635728,-7847130,645742,2519800,26330124,6897325,-27004431,3456382,-11959441,7661297},{1,0,0,0,0,0,0,0,0,0},{-27470631,-12085196,-33403266,-3065134,33345591,1349738,-21341366,-15054927,-6849531,-11051102}},
+        {{-26332019,-6485127,4705623,9241299,-5162458,1346623,8238819,-16020439,-27151953,-8124833},{-17767934,-7403813,-3504947,-6125464,-1264922,4857344,20595839,-13707158,22200937,10365474},{1,0,0,0,0,0,0,0,0,0},{-19673782,14790025,-29851180,12868840,8070175,-14846637,12497502,14871640,-33437552,-5830458}},
+        {{-26518380,-2894555,-27279413,-11130217,21609566,-10817871,-23186228,14922602,-19473619,4491286},{15114252,15573994,24496687,-15256437,7599498,11485184,-19002087,-10530411,-20187517,10110292},{1,0,0,0,0,0,0,0,0,0},{-10283015,-2226323,10404689,1832613,-21528275,9341324,-10285937,119333,-10621134,-14377918}},
+        {{-5086043,-3810514,10970297,4075084,5575773,9408097,-23277373,-15461552,-1815384,-7996353},{-24999022,13035351,-33233720,14462700,-24914631,5120365,-5010934,-10008056,9571043,2312879},{1,0,0,0,0,0,0,0,0,0},{30911984,4592339,-680243,-14795251,19142291,5149985,161157,-13945278,26842727,-8357903}},
+        {{19241022,-3383062,12200730,-4214267,-12164775,6350929,-22428127,5171170,16934122,-11584683},{-25496205,5166711,-15115057,-15713189,-8364500,-2245623,-12583832,6818062,-6922605,-5932234},{1,0,0,0,0,0,0,0,0,0},{-21878159,-2519659,-18146119,2147749,-13495842,-1294881,-8032119,13951730,26879901,9637528}},
+        {{-33341473,10880929,-24017958,274199,14125807,6618719,11924992,4440085,-15360278,-13896476},{-16471306,7259478,11014664,9460086,23139397,-10286827,-18040174,8151845,-250920,2117048},{1,0,0,0,0,0,0,0,0,0},{30156502,-13194988,15590547,5674735,-30955906,-7312078,-5304820,-11730425,-8391741,7559851}},
+        {{-18079092,3932401,-19180487,8948318,-15495654,3845847,18984488,1322010,20359071,131206},{19241250,-11584012,-7169198,11191481,-32682361,-5241141,2265841,-8712378,21816056,-17503},{1,0,0,0,0,0,0,0,0,0},{25056305,-795179,-1849183,13821096,-13076047,-1824858,-33156058,12224268,25314033,4223742}},
+        {{-14021003,13433798,11016870,-11665941,-32048809,8661720,-18628608,-14160475,-19528013,-1273955},{-15519879,15175793,27552993,6268743,18986754,-9499278,-7553695,7452116,12843395,16384527},{1,0,0,0,0,0,0,0,0,0},{-25369606,-3733781,4856433,12849917,-28116234,8295600,33121402,6375234,-3745757,15015349}},
+        {{13699228,16659909,33393605,-15832093,8938857,10787015,14946338,-12824201,-4216575,-13328055},{-28867895,3077087,-15911467,9403397,-28771939,1867039,-2498164,11225960,21631947,-12130199},{1,0,0,0,0,0,0,0,0,0},{-10963728,-9785856,-3566786,-9158719,28222058,-16720813,30794789,-12778552,-17432083,-8437445}},
+        {{-28793314,-2753333,15898484,1961077,15382233,-12876301,-13076107,12757411,-8642871,-15588393},{32398122,6210014,-21343417,-4732219,16677909,-1580439,13921949,9918379,-28934046,-5380817},{1,0,0,0,0,0,0,0,0,0},{32483336,15384270,-22822420,13846262,8333553,-12472350,-22344672,-7674961,22719662,16152359}},
+        {{-26564249,-3716982,-29565847,15578742,7976571,-16266722,-16696585,13011255,31122810,-2355503},{-16460091,-12512543,-3304382,-1909631,-31308239,-5737742,-22511722,1743362,1850091,5785034},{1,0,0,0,0,0,0,0,0,0},{25679391,12409168,7650698,8602807,-25899105,5482421,-9504753,5238660,-23006171,-1801155}},
+        {{-10372696,-11639845,-31436372,-11982939,4070579,3517730,4522302,-1530638,14789427,7806538},{-6696056,-3205658,-9652899,-7799358,-8904102,-6830856,-23715973,12837259,9834752,10120287},{1,0,0,0,0,0,0,0,0,0},{21757901,-3299661,3873333,209059,11704445,-14140006,23514935,7761224,-18857299,-13127674}},
+        {{609997,15299112,20941197,10937368,-8513119,15807962,-23877284,3178558,23546762,-12643473},{16897597,-13428083,3165534,-13854431,-29116135,4505516,15392489,-8116528,-9544676,3497096},{1,0,0,0,0,0,0,0,0,0},{17311404,8019980,-28874340,-14057409,2138237,13389268,9607834,-3831057,24294576,-8339687}},
+        {{20797065,-689890,310655,-10689069,1940452,-3364406,-22577344,-6273331,7590934,9817198},{-3972537,-2225612,7439530,-8588895,-9797015,42833,-791887,1162465,12161649,9723282},{1,0,0,0,0,0,0,0,0,0},{20803376,2970911,17887191,-13672827,-4147249,12380050,-8051149,741947,3640190,-11399895}},
+        {{28260198,3775531,4868059,8615202,14161169,-15799374,5008000,2660535,14294666,-5550152},{19076415,-8369402,-13713942,996904,24075074,-4904562,6650013,-15385689,-21035591,-10634306},{1,0,0,0,0,0,0,0,0,0},{13873258,-3088436,9353513,7781347,6618649,8418050,20039791,-5322494,12494229,10041616}},
+        {{-21636036,-16098412,-20553779,2757649,-7502845,8091772,-683025,11379086,-24309641,3733774},{-7097481,14661150,27663914,-5478807,-4940088,7138209,-6794642,-5819872,-16417468,12823610},{1,0,0,0,0,0,0,0,0,0},{-21510248,6960972,31089157,-13302457,33263464,-13300305,-5635462,10888121,-27318354,8080491}},
+        {{6352332,-4884145,27728713,-2765815,14380053,14224936,-17881109,13857175,-29485478,-4879163},{12897007,-6339047,22653188,-15031253,-25090724,5065413,33074195,11572980,14146841,-2333916},{1,0,0,0,0,0,0,0,0,0},{10513944,-4157893,6237581,-4527927,12707485,-7144833,-11997879,-94798,-30237039,-1617492}},
+        {{28827522,12273183,-24760129,15068738,-9011901,-14091852,25844063,-12451500,-19195931,-604585},{-7561809,6452475,-4922135,11758329,1601044,-7008525,-18554656,3094349,-26418917,14790691},{1,0,0,0,0,0,0,0,0,0},{32197510,-7898193,2238286,-16720805,33004828,-359609,847231,5954482,-4287928,16155957}},
+        {{19055094,12699081,-6779415,-5835797,-14105794,-16286804,-22561545,-16055198,-23307479,-12038451},{18170563,-5959181,-15334812,-6888108,14398219,-11978270,11162516,-6835600,-31136625,5620889},{1,0,0,0,0,0,0,0,0,0},{-16512657,14629109,-25345157,15046477,-20695301,2851560,9810341,-7231624,29647827,-15621519}},
+        {{5304317,10311396,-26137653,-5536294,12623507,-16518558,-3305923,2045155,17290696,-14277821},{16489303,-11887774,-5962356,-13494912,-12721618,-15701707,-23468710,-10175806,31007589,-1791493},{1,0,0,0,0,0,0,0,0,0},{-3538984,2008393,18914938,-8535210,-9048760,-16768413,-14837445,-105066,21537260,-4949872}},
+        {{1630422,-15015025,79538,5687107,-15225160,-5683119,-11720406,-7389755,18378774,-11364680},{-23946136,13842523,18513957,-826013,-15274425,799342,-3655712,16256080,29501200,4588762},{1,0,0,0,0,0,0,0,0,0},{27380984,-4897936,-17671662,13432079,24989561,2454888,26682063,-9602178,-17200690,16498192}},
+        {{24101035,9865272,-12355995,14780984,-10437790,9798230,2593797,6082451,-23781496,-14366462},{-29007544,3231006,-20195340,4586540,24356228,1349423,-27845284,501155,-17143870,9987480},{1,0,0,0,0,0,0,0,0,0},{-26204555,-15702499,-6896197,-7447779,-12497634,571501,10871674,-3625813,16090984,-4135924}},
+        {{-26890629,-13991252,-15969758,4945114,425972,-10903374,-24319816,5322658,-30340760,7623068},{3446561,-9862203,-13624696,-14793973,-25318038,4689866,28186280,8520773,27756878,-1607268},{1,0,0,0,0,0,0,0,0,0},{2453166,-1223526,-27652710,-13838772,28031453,7786714,17643593,-10265758,-31095364,7710756}},
+        {{31994508,-10969142,26194409,-6322176,24039947,-8216172,-27504017,-4695363,-27351307,-777749},{18372076,16607148,3136485,14005839,10859987,3667370,-3923515,11197093,4088445,8246858},{1,0,0,0,0,0,0,0,0,0},{-10062737,4562748,-22442204,-11951760,28861212,4731664,5799893,7557070,-25467516,-10743565}},
+        {{-25471543,-1824426,5075873,5933365,-6779194,-14593785,-20158978,9799785,-5252568,-14448027},{-16003998,-13537948,16114438,13001663,22967231,9090140,19703834,12708637,-15299822,-14444487},{1,0,0,0,0,0,0,0,0,0},{8110684,-1393248,-22248751,15373116,7344462,-6229150,28607348,8181058,15213793,9885751}},
+        {{26918820,-6738823,24738528,-6250187,18410105,-2313570,-10869476,-6663071,-12588687,-1356951},{-24865912,-12702638,-26983564,6022874,24085646,13464714,14378868,-7028735,20956425,-114864},{1,0,0,0,0,0,0,0,0,0},{-27999252,-1219469,7902662,13574593,3761403,-16542058,-5390141,-2211303,20413928,8720994}},
+        {{-28689762,7763801,21633724,5278044,-5294796,-11420381,-5192750,14450469,-4777986,-7425075},{-24996602,-6284261,-16624028,-2203133,-25911695,-2442367,1204857,5690956,-4678848,8978790},{1,0,0,0,0,0,0,0,0,0},{-31381451,-14140941,-4371965,-15291979,-9986603,3161998,-28840777,-1259983,-3617004,-14666115}},
+        {{19289216,128874,16085947,7992061,-12290712,14302641,28842327,8068882,2990211,-11273913},{31368544,9593407,12742411,10888957,-13212295,11271307,14510185,3266713,-22582895,-1439049},{1,0,0,0,0,0,0,0,0,0},{-14309263,-15426728,-22304180,13162157,11919538,-7425294,32023486,5592301,-17685239,-1854198}},
+        {{9716539,9414768,-30519344,-11646053,-17487112,-613723,21829064,9626066,1853102,-16532486},{-20748806,-14526733,-17007007,14804075,27504176,1003971,19823996,14111749,-1939077,-9065314},{1,0,0,0,0,0,0,0,0,0},{19444925,-8483844,-1359780,-7095894,-20571902,-2108662,9211448,-10187033,19964162,-11088688}},
+        {{-23568777,-9165615,29710389,-7644095,-2735959,11815885,18769038,-1442065,14725474,6022630},{19737449,7319068,346120,-1226057,29122836,-9723635,8340551,-12808,-24140325,-8973314},{1,0,0,0,0,0,0,0,0,0},{-25290550,-10069327,-13630770,-2347390,31942108,11220816,-29828000,-11953860,-25261792,6186664}},
+        {{-19920724,-8852013,16051954,-1084546,-4574170,8522924,-24405962,12792964,15146000,-5508067},{-30979499,13002460,6574820,4447864,-19991285,241103,17107512,10088283,15554901,2406780},{1,0,0,0,0,0,0,0,0,0},{24842256,-3344115,-22055701,7153860,-25002873,-11537581,32596007,459023,-32905240,3096178}},
+        {{15593556,7714572,33288048,-14191573,-28889236,-10727674,26578990,16643686,29291535,-5394208},{-19285125,-333671,26205622,8627481,31081136,-13122625,-27620888,1197137,-13783165,-13258628},{1,0,0,0,0,0,0,0,0,0},{6198252,13579435,-29644909,-13914253,-6934060,10741464,21801012,-8390319,4093421,10841841}},
+        {{7568338,-13387219,19602391,-2392252,21483050,1576588,28973952,15559401,-2030745,-14180264},{-7420772,14509064,11132723,3449540,-7580703,15196117,-12840910,5238356,-5895944,6071703},{1,0,0,0,0,0,0,0,0,0},{-7807400,8344334,20814811,-5102783,27277217,-15511154,15694491,-15398407,-11944185,10648251}},
+        {{-419915,-6726512,-590618,7125658,7540785,-7968822,4039697,-15822618,24295299,-7637453},{-1086179,15191139,-4950626,-2158197,20712830,-15937458,-10075552,9302843,29261005,16149433},{1,0,0,0,0,0,0,0,0,0},{-28003216,-13212908,-31987033,-4551573,32055157,-1286966,-21396268,3186904,17709121,-12189378}},
+        {{8900904,-14729133,-14491702,-11878489,-32432633,-16397710,-18118518,14348282,-2745629,-4307598},{-887841,16209460,18006328,4586141,5506449,-10720550,6625985,15063602,-13209207,-16758471},{1,0,0,0,0,0,0,0,0,0},{12468475,-7847019,29322228,5590590,17034514,-5003327,8605657,5397954,11283619,16578934}},
+        {{25852709,12498832,-21786497,9057093,-17750354,-3268401,-9285539,-9825267,-491152,-15566529},{-26021738,2421603,24385438,11506852,-15058048,14508095,22767709,-15105773,31164710,-11401500},{1,0,0,0,0,0,0,0,0,0},{19914465,-1680281,29272132,2313520,19324781,9705129,-13690640,-681177,-21716602,6909516}},
+        {{11802859,11619541,-3798283,-14596248,6619643,-335950,19919910,15191998,28726553,14024517},{23020784,-14774678,-31992689,-16001187,16764838,-8295381,-23391967,-14710187,28848601,-3042102},{1,0,0,0,0,0,0,0,0,0},{1770274,-12440465,-31627966,6869480,-26812702,12385625,-14935171,-16561440,-7796109,14652660}},
+        {{11214971,14112352,-23070075,-11781488,32776333,-3797734,33352910,-5605879,-18704376,-4340414},{30584842,-7033832,-27647054,5925129,25987,16690996,692394,-1526524,-18051053,-3538758},{1,0,0,0,0,0,0,0,0,0},{-11022259,-4410011,5943220,-1098373,-14877658,-9888487,-4904098,-10547526,-32523034,-14377299}},
+        {{-7502365,-13105650,-5526064,8355638,8133005,-1110801,25275487,8636814,14446366,-3660604},{27490190,-5565857,4535714,1589576,-244205,2258801,27759746,-14348598,20291817,13386622},{1,0,0,0,0,0,0,0,0,0},{7057093,14210103,-2503875,7424236,-410813,5518116,19290509,4419805,16864998,-6036471}},
+        {{32635280,-1707794,1974022,11879038,-7097640,-4306574,22275906,-10885578,30657558,-15624169},{-18848377,-9293751,919516,2719119,11337497,-7123148,23297827,-10605254,11101230,-5425968},{1,0,0,0,0,0,0,0,0,0},{3109538,-12139020,-18297380,-6432272,-17951366,9418698,-1665044,-7877272,-9589058,1947752}},
+        {{30317172,-15931310,951536,14869044,3248859,-4651381,20094794,-2843966,-23768923,5805264},{-8269873,-9276128,-15600954,-12614911,21062429,10270095,-2492347,1641453,9241992,15468322},{1,0,0,0,0,0,0,0,0,0},{-9150426,-3125713,12141759,-16731875,-26659429,10547736,-12960528,13254603,2843863,13148201}},
+        {{-12652876,5434143,-17530734,-369125,18644154,10158936,-15764957,2799914,24414175,-9609970},{31147054,2610819,-8198440,15694048,2948736,15329545,-27613537,238083,-14167152,-11159987},{1,0,0,0,0,0,0,0,0,0},{-20036288,-14957384,-28589898,-13830785,-13226618,-9465760,-14022282,-16549033,-16589071,-7418507}},
+        {{-30157951,-15297646,-32027233,-5239009,-22396615,3170269,-13934757,5232597,-17678371,-5746833},{-531465,13423308,-16853129,15155181,-16327630,4562378,-14646577,-6729267,-9035359,8083842},{1,0,0,0,0,0,0,0,0,0},{-4968525,5278,-24749658,14017306,10554435,-1171055,-17102477,-8954795,3361885,-14735644}},
+        {{-16149998,-10975231,4961147,-1626399,33384744,475652,15922816,6507682,-18462703,-2080157},{-30316790,6572842,29440066,10974701,-26849148,13134000,16188693,-4863568,12599508,-726525},{1,0,0,0,0,0,0,0,0,0},{22076191,2351983,18630299,-7552194,16735234,-12101145,28744015,-3823167,15289400,-5918056}},
+        {{22626169,-770531,3729243,5445409,-4503494,-9474818,-33510756,14100359,33495668,11145260},{8006566,2116705,5018873,-9796981,18107244,1866042,-11936381,-12266146,31702814,3079397},{1,0,0,0,0,0,0,0,0,0},{-28475909,-2744124,9268550,12152884,-11808430,82041,-6607486,-13066128,14815912,-5304176}},
+        {{32618124,3655732,-3680100,11890838,12771626,-5152169,-10705217,6182103,-5680873,2798506},{-26438748,-5202874,20442508,6618118,-1788704,-13504526,-24632779,-270422,-5257306,-14874170},{1,0,0,0,0,0,0,0,0,0},{17954847,13982981,23961480,12920904,-12488100,4648272,-24961612,4786296,21577326,-8623056}},
+        {{-24836719,-1251465,17878859,888730,-8210545,-10766891,24010160,13141269,-12798613,11616646},{-27601358,15596776,12000688,12490327,31432422,13652396,-7365440,-4561187,25938585,6502178},{1,0,0,0,0,0,0,0,0,0},{25099026,12348843,-8373742,15063951,19144600,14242489,-22593270,1038196,20278306,13816122}},
+        {{-21638681,10519930,24964950,-7780235,-14553936,-12227566,14401040,-10106344,12364389,6178197},{-31777011,-324945,8639283,13979149,-19897407,-5557716,-22416606,13392127,25041878,-10018964},{1,0,0,0,0,0,0,0,0,0},{29261143,14969220,22832719,14457519,8930535,3222598,-1354476,3036158,-28024284,5419489}},
+        {{-15715595,-4326990,32642016,-9439934,32041155,16648284,14883271,13271293,12888896,-16305572},{86227,-12123799,-26196342,7294690,-4114510,-2892866,-21852083,8310285,2375470,-13899397},{1,0,0,0,0,0,0,0,0,0},{19745984,962630,-13815461,3886703,11011674,1482891,-28347711,2738715,-222065,13013153}},
+        {{-10055943,5104241,-15744791,7853767,1607299,-5250473,-1207585,4018095,28658706,-10526362},{2528969,934969,-22195725,-7343777,-2341019,10990012,-1451970,5691991,-10339534,14117984},{1,0,0,0,0,0,0,0,0,0},{18265293,10366308,3379813,-8343483,-19081449,6723655,16287625,16108853,25306495,81686}},
+        {{-23703500,-10138081,-382230,608287,7565198,-15742310,-21121797,7322018,-26905631,14182687},{1209973,13371418,12303569,-7228415,9057194,-14174601,18732220,8328053,-6662104,-13121674},{1,0,0,0,0,0,0,0,0,0},{-10086092,14194949,-33411786,-15740885,-32749933,5754622,24483582,-11993545,12872154,-1368631}},
+        {{16288843,7460961,7107821,16684488,-11145424,3312031,-6787135,-3518685,28785610,-5482191},{9895172,-15001672,-21045394,5334713,-19602766,10018518,-30562507,-7551578,13481195,-181084},{1,0,0,0,0,0,0,0,0,0},{9318958,-12004258,-33036143,13727954,-26923845,13940928,7501924,16520749,-16489821,-7527149}},
+        {{26643085,-4842924,9552116,-10404305,5364469,3139632,-4313060,9809874,-30289181,6527497},{-33170992,2648515,-15239092,-16300310,-30924909,-10287958,-7357058,7717160,10665260,-9170041},{1,0,0,0,0,0,0,0,0,0},{6001404,11073453,-12501582,-10223959,-27265456,16714762,11943186,-14852469,-19827652,-16581941}},
+        {{-19639683,5291395,16689213,8753450,-4209386,-8468819,-2354746,9887137,24214699,12687583},{17827353,13422097,32207623,11429686,17138718,16381068,-5574938,4199612,-28092281,15210547},{1,0,0,0,0,0,0,0,0,0},{24831407,13761013,5199375,1451019,30200586,13032571,-22142505,3091357,33331287,-12265534}},
+        {{33193165,-8858879,27790324,-5356860,32731984,8452712,3816030,2757883,-22993801,16133587},{-26625349,8519513,-3026061,6511586,-26688191,-732045,19071096,-3113467,31742027,-9058513},{1,0,0,0,0,0,0,0,0,0},{-29088994,1107486,-22559648,13564286,-31286920,-3724629,-19839074,-4522177,32916925,-12957723}},
+        {{-29907616,-14463294,-30858975,-14251097,19237743,13594027,-16187601,11474903,-30157347,7182737},{-17535822,-7005734,-7050907,15426752,-7411618,-15012068,-6857601,11508599,16055967,-2690632},{1,0,0,0,0,0,0,0,0,0},{21945364,-16509360,13412672,-16311088,-33129706,-6978970,-26646475,-12516771,30855163,-2323510}},
+        {{30579759,-3437374,15273979,-14119963,30858968,-5254420,23340019,10377593,26445072,-13763501},{878170,9687260,-17750834,-11655693,-26674880,-4802108,11578376,-778030,14541723,9535439},{1,0,0,0,0,0,0,0,0,0},{16244909,8210379,-15702347,-15120804,27176618,-10078298,17799309,-3283253,11084040,13359018}},
+        {{16119743,-3884927,-31647670,-15338852,988957,11896866,-19281461,14786609,6920715,15765205},{13751247,-2399046,-8176593,-2165827,-11326803,-15977788,-24950004,14696788,12633238,4458182},{1,0,0,0,0,0,0,0,0,0},{-22080716,-15572884,4596648,13509310,16860144,4377956,22417404,-13375249,-28797945,-8896146}},
+        {{-475640,-14829304,26749591,10193767,29876701,-8186706,14524805,1454926,14052382,1320962},{25420870,-8035078,14892281,4922642,21076017,-10370170,-16541814,7247030,9782876,-2913029},{1,0,0,0,0,0,0,0,0,0},{4664089,-1598178,-12891690,-13404345,13817036,12952535,-6994993,-13534579,4196534,5662122}},
+        {{15243316,-4969641,26070583,-4615525,16506107,2481336,21680188,3857301,-33375418,9194997},{31999319,-8821556,-8521075,-2908163,2347682,13772041,-15645107,-7713467,-13801456,-646235},{1,0,0,0,0,0,0,0,0,0},{-27877040,-14113985,19776387,-5743145,7106381,3004936,11783091,18176,9519460,5633748}},
+        {{-26290898,13747276,-17109037,4801979,29431363,-13373163,-4967276,-2837858,25337341,-2820092},{-23164034,-16457833,6237520,7061503,-4490404,14692150,23094477,-4690847,-22409207,-12987304},{1,0,0,0,0,0,0,0,0,0},{1094374,-13921244,-507973,481098,-11387770,13488530,32704393,-11488310,-682664,9293315}},
+        {{31577625,11829727,21415142,-8173741,19156973,16112366,-27323250,1734094,16773246,7313596},{11468686,-12815545,-22384910,4432105,32531222,-33857,-21444013,10944241,11741927,6121039},{1,0,0,0,0,0,0,0,0,0},{18075342,-13793625,-30928201,-2063418,-2541075,2954889,-3167209,7010266,-26008773,11109939}},
+        {{-21347475,8820575,-24582498,12916296,26545849,6845729,13878045,-12048577,-30816672,-5391623},{17856264,-16671816,-22627596,-16352430,21807519,6399239,30650057,-1444614,-20145836,4114490},{1,0,0,0,0,0,0,0,0,0},{-25663375,13130337,-24993147,14555963,-22077055,-1608077,27583927,14607240,-20583741,9858391}},
+        {{33158048,-511477,-3936362,13371492,-25084109,11750463,-7741499,-13314674,-29692631,-7822482},{-25122527,-7711709,-26769115,5527103,6723169,9867546,-25081489,-14293283,14761045,-15033482},{1,0,0,0,0,0,0,0,0,0},{8567881,13179127,3107626,-15460310,13006505,-12519967,16997129,1858212,-31838378,-6118179}},
+        {{20043785,-2348979,1598812,4402823,-19371788,11358948,-27768426,1473551,26205454,1007229},{-19419680,4244308,31928353,-1812788,20643519,205643,-31787183,-5317536,33406087,-14075701},{1,0,0,0,0,0,0,0,0,0},{29689645,1897937,16057545,616771,-2781465,-8214942,-4627604,-2652611,-29243588,11600880}},
+        {{-4555490,3931404,-14684,-11550596,-29745747,10458632,-16302507,-10954868,-23318925,2721910},{28691410,-4012034,1958241,-10930253,15343899,-229004,13461114,-7661915,28858771,-4892886},{1,0,0,0,0,0,0,0,0,0},{-15433877,16198073,-24569041,-13140851,27238085,-7588010,11510617,7714126,-15265362,9098525}},
+        {{-27509500,-7943790,-2436180,-13370323,27347209,10696559,269349,15255140,23769701,-13646476},{-10464100,8764308,11402627,13507379,11052182,-8434037,26458171,-11945542,21664868,14589762},{1,0,0,0,0,0,0,0,0,0},{19931927,6156818,-23353220,12816920,31155520,-13680965,-33029481,-42649,15279580,11497296}},
+        {{286919,3982154,1702874,-7511031,23485504,-15660031,-29257082,3768752,7808241,-9556246},{31329051,-558033,16350158,2261683,-32995714,9253093,-32438480,12609755,6127059,-7137635},{1,0,0,0,0,0,0,0,0,0},{21062740,3759137,-11942202,-14549354,8429135,13633950,-19302408,14563970,26917094,3896688}},
+        {{-10773198,5936440,-6820740,-7350616,30431398,-6646122,25740905,-3456471,31500187,-5322336},{-27653323,15611604,19515062,12332004,-6336780,10532218,-24339703,9185754,8749663,7887378},{1,0,0,0,0,0,0,0,0,0},{-10449834,3779893,-8691520,-2283883,-6362969,-9041251,-8681188,12582961,30263344,10858908}},
+        {{-13549345,-15353762,-13812088,7480851,-20481179,-4274858,-32921231,8109836,-28269046,-9153571},{2020369,-6628020,4703774,-11563345,25457212,-6862418,20071716,4513902,-28613178,-7960436},{1,0,0,0,0,0,0,0,0,0},{699280,-12266468,24660812,10638388,-27431414,-3974971,-12436681,8315794,-23496480,-1769444}},
+        {{26773215,-13876767,5820155,4379528,-1570489,49208,-32601586,9919927,-14604278,-3468039},{21816318,9412964,13000796,16184257,-13932153,14184014,31514145,4918998,-32514825,14713664},{1,0,0,0,0,0,0,0,0,0},{-26013905,6929884,19364071,-10196462,7543198,-6134104,-19540882,-2362409,24631620,10135374}},
+        {{-17192587,-3481026,-5182056,-16272403,-11157793,-9911819,14927014,-15874055,23144927,-829879},{-9930119,-14670099,-3126939,9684816,-22734704,1684074,28288725,-14541120,18931630,-8041288},{1,0,0,0,0,0,0,0,0,0},{24995198,6940878,18759275,663967,33289886,2042378,-10254323,-10191310,785210,2268855}},
+        {{8673684,2785292,-11834594,6306682,10270836,5208978,-1187964,1201367,-15787070,15264205},{26783387,-9500367,25772063,5501781,11584399,-2527076,4510820,-7859578,-13781775,2501754},{1,0,0,0,0,0,0,0,0,0},{-17413888,16313818,32511341,1967560,11877598,-9012491,-4902090,3152664,-29420879,1423496}},
+        {{-29300708,2153062,9748379,15392972,-30570650,6528783,25670234,15067241,23125547,8013292},{6557569,5312224,-21458295,-21383,-31848836,2304736,14551754,6724427,15700940,15011957},{1,0,0,0,0,0,0,0,0,0},{-32245199,-15672407,5138966,-8668327,-31304584,-11724884,1752874,-9537911,-134441,-8329641}},
+        {{11178861,-10295615,-25988328,10878444,-17470889,-10570367,-16623194,-4761439,27243337,10047411},{-8744185,13532084,20613228,12736591,18291502,9988108,-30101689,5683282,20421461,-5153698},{1,0,0,0,0,0,0,0,0,0},{13896408,-3106541,5320187,10457071,10473319,2511048,-32701231,-5732371,3612280,-13509568}},
+        {{30727207,4714280,-12043462,15193246,24072876,-10843719,-28250520,4072095,12625941,-6801766},{1527425,-722995,-83304,-15663400,27670958,6255916,8027579,11626418,-24584710,2226841},{1,0,0,0,0,0,0,0,0,0},{-25790369,2729500,8380314,9925503,4249458,15063844,-19260274,9397374,-21805133,6610401}},
+        {{14056165,-4941257,-5421057,13858908,24509417,-3741458,17552714,-7652149,-29342715,8001429},{10137799,-8366536,-23263900,-10705646,-21528718,399914,-5992373,3798341,23156869,-12283175},{1,0,0,0,0,0,0,0,0,0},{-9457841,-4465137,-23469248,7025436,26307203,-4559577,5838276,-15719148,-28108873,4118787}},
+        {{-33157717,6675220,-17239749,6305145,29585901,-3567985,20853951,14260753,6345404,14736632},{25926680,16406825,138783,5232417,-760688,14866573,12268714,-3465230,6150869,-11752809},{1,0,0,0,0,0,0,0,0,0},{21486487,-3381876,27147455,-2190099,24718638,-13247736,33152055,-15322522,758636,-3747584}},
+        {{4956910,10133558,79724,3797244,1867801,-2810060,30340568,-6617310,21924783,-16306784},{-15332406,4771884,-8473026,2884466,-32688693,-2657850,6868877,4739990,-23959626,-12527254},{1,0,0,0,0,0,0,0,0,0},{2850171,5360981,-5473816,10113296,32082542,-7961019,-2329100,-13482810,8461019,-11600659}},
+        {{8264661,-14528358,22594323,4013468,27963183,6785213,14127464,-112311,15187516,-11866499},{16435597,-6204133,-71880,-1347189,26757124,-8511218,-6767610,11970551,-17511246,8098247},{1,0,0,0,0,0,0,0,0,0},{15638057,-7304263,5574535,9492233,24755665,-1800967,-7347736,10931351,18485652,14486453}},
+        {{-21601984,-13343260,25529242,16737081,29010767,-2493674,-12714281,10054760,12399543,7411824},{-32955321,5211547,-29755698,8397282,25840616,12434741,3586876,-15390713,-6936795,15700052},{1,0,0,0,0,0,0,0,0,0},{9003334,-3920641,16958795,2382671,18468715,8325556,14107613,-8562871,-12576732,9284209}},
+        {{31264012,-2483668,-27489154,-15034216,12315398,374160,30582514,-4993411,11720554,-9594525},{-9302011,1195598,10387318,-639475,18331705,11002748,32200963,-12774982,20260719,-10826803},{1,0,0,0,0,0,0,0,0,0},{-24796359,-14041066,-27595762,-952928,-16399125,-12369627,12624817,15489354,-30278877,-12361208}},
+        {{-4769173,-93635,-11350660,-15389946,-14516069,-9284279,-12883463,13336181,-32659010,-14237041},{28052202,-8813034,11512659,-1166356,9658867,4047166,-6646847,-15321239,6512092,-16023362},{1,0,0,0,0,0,0,0,0,0},{7656505,10760257,-2443049,-15601485,-28398312,13495216,-30127202,2971891,-8498691,-9433456}},
+        {{18809598,-13151356,-10633216,-1860483,27565785,-8337105,7303901,-7871182,-7292520,13307518},{-15556536,10466177,12676144,-9042740,29042173,-4985191,-25183725,-14148585,13662307,-11322552},{1,0,0,0,0,0,0,0,0,0},{-3779041,14089114,-24762236,15070761,-32620835,1060712,5202060,-9857538,-4981277,2438044}},
+        {{23466367,8154885,-2230646,-8012042,13582583,13472808,23521780,-15243471,12348903,-14398756},{31048869,-1742757,17552669,3712270,564264,-5018669,-5456896,-4878127,-20391778,-3620146},{1,0,0,0,0,0,0,0,0,0},{19384523,1400881,22947185,-9057435,24871006,-13336180,-2530425,7016553,-9056714,-10669302}},
+        {{-21744080,-5055713,-9210116,12435823,-33286643,-521290,21309554,15793213,-487306,-6671563},{-22633131,-3209110,-20272108,-13922996,3139829,6541751,-10659046,-3784478,19793091,11952084},{1,0,0,0,0,0,0,0,0,0},{25717149,-7787538,24365216,14659584,5885789,8900306,14860519,8128012,15295428,7855705}},
+        {{-33183280,10432815,-24111741,-6198484,-5653229,-9867149,-7209586,-2335241,29896626,-12642345},{-19604334,1391113,-29741523,11767023,5473421,-4210790,-26978497,13557531,20740257,4521644},{1,0,0,0,0,0,0,0,0,0},{-834712,-11863215,22744189,5639251,16868260,2628060,25534422,14621485,-20750176,-5714291}},
+        {{-14649,-13161595,5813167,-9211389,-14909742,-3397503,-31518658,-14528363,8143450,5411227},{26552217,3312896,-18591890,4215736,30570902,-11530087,-28855227,-9887877,-18376989,-11656008},{1,0,0,0,0,0,0,0,0,0},{-4413685,-14194120,15971529,-8322189,24368247,10195779,-31978622,-7211784,5396466,15253426}},
+        {{24705384,9475303,7107478,-10437236,28404924,-5924560,22585282,4397357,27779029,-3165910},{10304754,5804114,16226619,-639243,-934718,3148828,9642405,8707397,-29527184,8380217},{1,0,0,0,0,0,0,0,0,0},{16447475,-6638146,-1500166,-12221784,26197525,-16373792,-300385,-9270581,22535406,335066}},
+        {{32588351,13096200,11893331,16222563,-29928055,15099283,-23904624,4518513,3859328,-15346981},{2917243,9644284,-27420490,-4321391,-33042624,11428732,24340064,6692397,32878968,-2385782},{1,0,0,0,0,0,0,0,0,0},{-5718493,9229717,-13427516,-2156759,27529001,10287031,-5429379,15724781,-14692649,5936350}},
+        {{32910443,-12362228,3472637,10842874,-9389063,-7539084,-15850159,15430658,-2737114,14212376},{13176716,5749168,6764499,-1353285,8571323,538514,11697404,11668217,23130516,-15894441},{1,0,0,0,0,0,0,0,0,0},{14104910,-6770165,17110910,-14392355,2641371,9627125,15030813,8009234,-27838148,13318741}},
+        {{15793577,-14688667,-20079620,-10731609,-11198759,13893077,2552098,-11678657,-16496971,6809489},{-18652061,-6013772,24865309,12244567,26756225,-4250960,10037137,5019777,24642352,-9641863},{1,0,0,0,0,0,0,0,0,0},{31572300,-1372492,8503731,-13996238,-33182557,-14311233,29822621,7627000,1433823,6813639}},
+        {{24226879,-13397192,16582400,1695887,-5100507,14638234,14866106,-9345635,16224382,-6057314},{33307529,6072071,-21750820,14307939,15344652,16165010,884059,7969254,-15317599,-6150203},{1,0,0,0,0,0,0,0,0,0},{-10579632,2820551,-4033073,-7770917,-18014452,12993479,-14234103,-6810634,13815680,5733321}},
+        {{-7346836,7870065,-14859476,-10692995,-15374097,-8244284,-2485815,15810507,-33495603,-1763173},{16470056,-14775623,-5004308,-16080372,3988023,2033596,18475027,-6029064,-2359556,2727841},{1,0,0,0,0,0,0,0,0,0},{-10998848,5924892,31647525,-5429667,8340261,6071475,24276452,9017880,-15022154,-16094382}},
+        {{7128928,-16417393,-6268712,-3429957,1095097,-15881209,-17274080,-13508616,-27891276,-2006118},{5703431,-7621578,-24947877,-4779484,-27073227,-9763471,-7903355,-5775799,1293993,-12570385},{1,0,0,0,0,0,0,0,0,0},{-33156385,-6989857,-18537562,-14629769,-6821645,-14816108,-3937889,-11480776,-3913878,-14151576}},
+        {{-20298093,16003785,-2476330,-10383920,4194098,16165728,-7879969,9801380,11658098,-1278799},{-850575,2297041,-13714374,7292850,-29562367,-3677084,11568203,12823950,-8744117,-15526181},{1,0,0,0,0,0,0,0,0,0},{-30665115,-2439721,-21394010,3408175,9474210,-8153152,-33150054,-15879373,9938452,9860406}},
+        {{-25316241,-11747471,10391582,9819496,-30150764,5941506,-26379920,-3307889,10531370,407386},{7144960,-10068092,-16765872,7077504,-11432251,-9537569,30079383,-16688899,-19986203,3969410},{1,0,0,0,0,0,0,0,0,0},{10251955,-5021862,8460501,-1091923,-25075953,-14240677,-11117105,-7405578,19412597,6010323}},
+        {{7326339,-7115984,-19674185,389367,26334642,8349782,3479543,7423822,-22249701,5082284},{17605965,311490,14305973,2832561,31663578,-9222662,7607758,7989812,15062023,3081701},{1,0,0,0,0,0,0,0,0,0},{22620476,-13578218,-130224,725545,11821785,11587207,-26322883,-15513778,14637628,-4980654}},
+        {{-17061626,255401,-9065213,-16251973,32898049,9053552,-22092255,-2303502,27840029,7706805},{28280271,-13541162,-13903791,-10813282,-31522474,-13445243,-31712846,2841246,14554894,-5058979},{1,0,0,0,0,0,0,0,0,0},{-23823892,6584696,17060836,-11182341,25171464,-1256993,-19854118,9977798,-26223061,5883187}},
+        {{12772336,14735192,11553979,-1197323,-7668546,16632605,-29064871,14195709,-12886153,6306242},{3870007,-11383225,-29484733,-4470837,13548989,7173924,1640465,-15311856,10113502,-9192289},{1,0,0,0,0,0,0,0,0,0},{-33295677,9899184,-19862097,5803416,2059889,-13497783,-5295695,14243957,-21572479,-14359984}},
+        {{18377863,-12982021,-3307338,16099486,4967802,7999865,5595167,13390259,9679488,-1808954},{15200502,12903191,9435694,16536815,-29567982,10187572,23326018,694457,13989103,-75585},{1,0,0,0,0,0,0,0,0,0},{-10951451,-4667903,-9276571,5496273,-215572,-11167524,22465307,8527647,29255559,15428681}},
+        {{13991231,-12339247,-6027034,15030574,18850123,12129130,1601240,-10102664,-928566,8017324},{29080537,-7223400,-30010823,-6391954,17191355,-9813067,10447129,-9084044,23729942,-10046617},{1,0,0,0,0,0,0,0,0,0},{1979230,3015727,13061826,-13480627,5815467,1279572,-18081796,-15123972,4153754,-2101486}},
+        {{-30779383,7275830,23065739,2616880,21635594,14150542,-1758308,-9193038,-23501919,-7434881},{28508979,-5030109,-32133621,-16498202,-3773903,-7781708,24459439,-13902122,-3721206,14243587},{1,0,0,0,0,0,0,0,0,0},{-13902611,-2493276,-3773726,-1134053,-17549675,-16018774,18245566,-9689533,-11726594,6378758}},
+        {{12959743,-10135545,5782159,-8697533,-9947940,462690,-5236580,-5044500,29451452,-7479689},{2718054,13474076,20371342,2344319,-31570499,-16305219,19574625,-8743456,19470941,-15885761},{1,0,0,0,0,0,0,0,0,0},{12957017,-740149,28205522,-16321997,6329864,-11323635,9821173,16471397,33284391,-7141943}},
+        {{-32717902,5185563,-10393,2631022,30749064,1587056,-33131920,-7991723,-32408033,-1416108},{-22263004,4125127,-11061944,2052649,12769702,12442324,6373205,-14776698,10833705,8732063},{1,0,0,0,0,0,0,0,0,0},{20930063,12156931,-32466370,5573692,21072641,8397272,-8155437,-16425859,25244800,-7220250}},
+        {{-6177046,877544,-3471668,-1239233,-10137926,-143525,29751320,-3282227,-10375371,8474921},{7415996,16262907,-6113758,13621074,-15398895,-16066000,30423103,-5768858,-674519,14983381},{1,0,0,0,0,0,0,0,0,0},{-15399928,12870654,27115283,-4949226,-14044567,-5136673,-16616003,-16136588,-18847464,-8253640}},
+        {{24451187,6295843,6180160,3100216,15466201,3537601,33021825,-6022966,-10162422,-11593571},{5167601,9666731,31596347,-6890150,-12789302,16210391,-16127404,-14796120,-18774788,-4821720},{1,0,0,0,0,0,0,0,0,0},{11087042,6669585,-7024332,11302877,-30532915,9996200,22787533,-4828275,-20654758,9956341}},
+        {{-17642805,2834424,10383962,-13958437,-29066622,-14709836,18459677,5694917,4646581,-7611075},{2561145,14260307,-16541698,-491974,-29047567,-14765329,4992235,-8988315,-22025476,-6936920},{1,0,0,0,0,0,0,0,0,0},{-32966468,10525268,21479648,11487415,2309258,11222888,-22680495,-12334225,-16739053,9870409}},
+        {{-14599232,8647553,27426285,-1690744,-12064580,-6144429,-874480,-12895873,-31173031,1338229},{17521435,-8161470,-31799330,8378431,-10409602,-9430355,6180110,-14577203,17504453,12481689},{1,0,0,0,0,0,0,0,0,0},{-14003701,-896792,9854754,10828394,18226282,-12079431,19855151,-8668432,30345348,-16571102}},
+        {{17860528,-3921739,31153207,10981579,25550158,9477609,30764497,16173744,-9893128,-10890199},{2700225,6624286,32150415,-1193028,-30173655,-519090,-14511848,8524470,4880336,-9545668},{1,0,0,0,0,0,0,0,0,0},{-20150587,-539693,-1239747,-3081190,16295517,-9804354,32880379,3143045,26932123,16763448}},
+        {{-1569819,3734402,-27161106,6969011,-7717987,4109545,24670677,11037537,-10932996,6211138},{-29105229,4309296,15635209,-13284893,-9903870,1582838,-13450757,1954547,7632905,-8760331},{1,0,0,0,0,0,0,0,0,0},{-5614070,-16373273,-9069871,-5692023,-11508355,1532902,-14177249,2534809,29693170,4365869}},
+        {{-3777821,-8726545,1745676,-5720264,-26962776,2992145,-14325236,-9479501,14791560,-15944860},{-18411121,12284282,-7608889,-1510832,29241107,-1010455,17634094,-13817573,-20853680,1216328},{1,0,0,0,0,0,0,0,0,0},{13139000,-9166399,-25299134,-15654145,4491386,6491570,-22827504,16207641,11636472,8352406}},
+        {{-30286032,1913900,27552772,16527444,-4131357,-33216,22663875,12801387,-30359484,6689048},{17292883,-10225078,20450569,9673265,30809208,2012434,-33519928,-11877664,27554830,9651335},{1,0,0,0,0,0,0,0,0,0},{-370219,14917120,-24147675,-11320244,13864175,-1493521,-19679822,-6078363,-3994813,-10411486}},
+        {{12125037,6832186,10171960,-12271881,15604930,-1748714,4870521,10112399,10252953,-653726},{27817777,-12564998,-3294211,-12447854,30860997,6159219,10217175,-8185210,-14543407,15459774},{1,0,0,0,0,0,0,0,0,0},{13705107,-9139515,27778698,4326700,13284931,5838750,5452327,-9715942,-31998271,-12208509}},
+        {{27143506,14429261,12518710,11019783,-11754642,4374415,-7006335,-2211918,-19396781,12840250},{-24871180,-15077807,-15511483,-5041185,19725307,-15517283,5163836,9668270,-1023006,13449457},{1,0,0,0,0,0,0,0,0,0},{11937361,14575818,-17122625,-12842663,792136,-999210,-18528692,-8936847,-25948717,-8488370}},
+        {{18219907,16021183,-25300403,-7873681,16956963,14945695,-13055300,-16656404,13736955,4393399},{9091258,14916060,-10034046,-11259332,9271441,-11082293,29044087,-10982442,-8630651,-4652832},{1,0,0,0,0,0,0,0,0,0},{-4015428,5672662,-15478853,-9475474,15605688,15615949,8788137,13833292,18956891,12182147}},
+        {{-16233019,-12165416,4902848,-4854725,-1080407,-9302880,16885219,11133396,19206848,10139109},{-25970288,631380,-25858310,-5980437,25337641,16717253,22812718,-8766702,1381,-1455686},{1,0,0,0,0,0,0,0,0,0},{-16496545,9695669,-31622206,-8400505,32741118,-459343,9610941,218587,6462003,6825358}},
+        {{20367825,-4693714,20324589,12470694,4454206,12570272,-19802325,13345165,-26105381,6697102},{-26730608,-15542001,12669149,12526540,-14601457,-6860441,18548764,487964,3992454,10239537},{1,0,0,0,0,0,0,0,0,0},{-26949956,10443815,-30623562,2174274,-23550279,-6403235,-637135,9491662,-23013521,-12147332}},
+        {{-12544265,-10037364,-411754,-13568560,-5374279,14402617,31137286,-3801240,-31384381,-15398302},{14521125,7067079,-15132129,13902165,-23648310,11615517,27207689,-8111317,-10492797,2178615},{1,0,0,0,0,0,0,0,0,0},{-9665292,-539491,-22287975,-3921539,26190092,11286397,-16692211,-13072793,-13029154,14530246}},
+        {{28417015,-10294520,-25436464,-15667810,23032403,6472004,-10892791,-10856660,-31724982,7632097},{-8861312,832511,28828965,-11527208,-13372898,6304160,-175909,8456512,-15524967,-4240139},{1,0,0,0,0,0,0,0,0,0},{8312884,-7986788,15484246,773998,30215233,1209380,-28106905,-9618203,2033524,11892875}},
+        {{-13197333,-9465050,-4936829,-7641814,-24856347,-2656202,-8977821,15999433,-17938061,5562452},{-4301209,-11569734,6610040,-4756357,-16899844,-13163295,-9156891,-4503770,10231838,4851550},{1,0,0,0,0,0,0,0,0,0},{-18143870,16710688,-27875251,10911381,20480458,15662038,-12494476,6029193,-13377086,2831902}},
+        {{3065945,4784507,12543332,5471799,28275147,15478262,18150267,-205329,-22377960,12269721},{27367622,-6330036,-14930105,13030153,10734867,-16104872,33312262,-5071265,-18580823,-3668577},{1,0,0,0,0,0,0,0,0,0},{7530773,12479733,234485,9589172,15120327,-3212455,26732547,1176773,-23127991,-144}},
+        {{32727807,16428686,-9062196,-6432555,19486095,16736630,20812935,-16726426,-33370587,9789208},{5095607,-15849531,31021337,-14020036,-20309407,11457142,9028400,-5277308,-13143481,-12379544},{1,0,0,0,0,0,0,0,0,0},{16325610,-4610260,-1753326,2935233,-2512324,-2438668,-19711409,-12683160,11885710,-6357005}},
+        {{29899359,-5586063,-20227530,6106564,8158219,3637174,-19089249,-11586604,-15626398,13231862},{-11610844,-4904880,-11202632,16665805,20207287,-5864488,-28986763,-11166284,-3391126,12282012},{1,0,0,0,0,0,0,0,0,0},{-31861295,-7976044,7770503,-9208619,21901828,-14841435,2321402,-15562231,-19828565,-13598145}},
+        {{-20947347,5596318,-17609779,-4428877,15837923,13886575,32421346,8743996,32535982,-7367488},{-32957064,-15155729,-10940434,-2896585,-5210047,-7205692,-31068855,-9082253,30043635,-5184614},{1,0,0,0,0,0,0,0,0,0},{-26122026,-1481065,-31056170,-11327216,9237718,-12210058,-29142706,-2707008,-12703204,-16152728}},
+        {{33342046,2894425,30347102,-4333917,-19723341,-10402814,28492606,6223659,-9822074,3148792},{-30633143,-4557297,-3218656,16432664,17548391,2874855,-24496611,3323295,31144358,-13538437},{1,0,0,0,0,0,0,0,0,0},{-1959654,-11813617,-28729179,-8616787,30245466,-2223691,-8924309,-16488478,28110479,15077232}},
+        {{22191383,-8299907,-13390197,-12963138,-22666914,8581094,16048197,-10022834,22728966,5743160},{-25906043,-10622224,-29214704,-16302741,32388758,883200,16113644,-8798614,-164975,-15957925},{1,0,0,0,0,0,0,0,0,0},{-29415925,16060445,20142006,187379,21474396,-11592265,234225,14591730,-12644387,12336574}},
+        {{-16182451,-8162105,29711100,8783047,19383247,-12574860,5894987,1159627,5951931,3410292},{20564081,-5679533,-25667956,-1048606,24595700,2519945,-18894851,-911020,-28460161,-15952664},{1,0,0,0,0,0,0,0,0,0},{-29534809,8843027,-17959636,-109657,14023751,-5881912,31152334,-3263390,2485919,559524}},
+        {{-15615471,14912071,18326018,2874523,13624911,-11472996,-15326031,-10351723,-17598559,-2402925},{22114922,-13843727,14917430,-16391547,7627731,12529135,24076125,16646987,-3969306,15655707},{1,0,0,0,0,0,0,0,0,0},{-7766748,943474,14726986,6076713,-20207246,7899218,-11243691,-2653455,-7997689,-14901681}},
+        {{-3025361,7162047,15656913,-14316744,9388989,-14021559,-12258428,5684208,13784350,13972911},{28998671,1096823,-27012294,-8270720,-7633648,13803191,8754505,15844020,23748780,-15237771},{1,0,0,0,0,0,0,0,0,0},{-8079201,15628874,-5188907,3474069,-10195357,11935239,-20182708,-5839952,-23055398,-10551102}},
+        {{33190572,-3230618,7681511,-5126275,-28622754,237851,14901144,6513448,-8565006,-12871147},{-19960719,5334517,24428114,-932392,-3254436,-6216376,-10905204,14251632,12304168,-504230},{1,0,0,0,0,0,0,0,0,0},{12307896,-9758713,15445733,-6699516,17007644,-1406338,-26695788,-8172073,-32729394,-11628386}},
+        {{-30240094,6401562,-27717664,9309043,22058100,-6927077,-23075650,4852436,24102956,14119509},{-14382229,-16233794,-8201524,1150216,-29851620,-11557244,21149472,-6780366,-17924795,-9181143},{1,0,0,0,0,0,0,0,0,0},{21981758,-588034,-4659526,6893481,-20421324,-11373367,-17268602,-559753,-17095946,-8089112}},
+        {{8159457,2996886,20434933,-7067158,26050745,13272619,-30199559,-10038972,24728971,13707388},{2347630,-8051638,-22942165,7156790,18950490,-11443488,4862561,-12406244,4153336,-16564274},{1,0,0,0,0,0,0,0,0,0},{-3155238,-16040222,1242669,11594994,22427470,11717677,-18073498,2811058,-10470066,-11096946}},
+        {{-7972349,1590092,-7640532,-2830014,26962123,-6091245,818041,-13782251,-24813535,5921070},{-21295503,-2434135,8071441,-5534030,19767919,9635234,-23826558,12155800,21603918,-12201395},{1,0,0,0,0,0,0,0,0,0},{-20996881,-8028823,-17009221,11601584,-27246885,11988120,-18491934,-8382948,-23530643,6318351}},
+        {{-27369989,-11439368,1914565,-14675589,-32260073,-11531498,-13759392,15179102,-30692373,-14922964},{10620689,12885295,31364526,-1425288,-12367278,10030843,-15702342,9546604,12260293,-253704},{1,0,0,0,0,0,0,0,0,0},{2369090,-15368406,10224094,4700902,-5491600,-13494886,-3243523,5775468,28468512,2345969}},
+        {{17325905,-4974005,4914896,-13047786,-24917871,-13862220,14665214,-6753222,3242423,10496988},{-22655486,-3820237,21810274,-15197441,-31593038,12574431,-6396919,11447800,8988081,-2441237},{1,0,0,0,0,0,0,0,0,0},{-1290582,-10699693,-14962691,-2739069,19405514,2440826,-14652575,12587486,-13390557,15608124}},
+        {{6912329,-3253116,-22802929,-1669495,10366780,14007479,-10037056,7910050,-28413085,-8547618},{21709861,14116138,-22320186,-5930544,-8479728,10595366,-15563994,-9107285,-31577769,6353305},{1,0,0,0,0,0,0,0,0,0},{-3110869,7750052,21968458,-15792498,15649312,14612271,18051989,-1129271,-15625990,6570388}},
+        {{29540787,-12606178,24112233,-3225372,-16794517,1040617,-8933451,-9929502,17486312,15395613},{-7863551,14862451,6221808,7980923,-16312626,13707089,-17246747,-5084204,-4208834,-1837186},{1,0,0,0,0,0,0,0,0,0},{-12056958,6909463,25904554,-7502825,20463762,14237758,13105548,4045553,20111865,15350257}},
+        {{30088326,7446034,8921698,12468167,-28974226,-9224629,17478693,16326162,-12475788,-12230514},{-13901155,-968257,-30807086,-8490078,22774483,14541783,24185183,-3155999,-77029,6450976},{1,0,0,0,0,0,0,0,0,0},{19571648,-8423235,23508453,6420333,-12977711,-6805305,-16559596,-6329354,5642082,16301241}},
+        {{23580121,-5946807,23742241,-3593830,-15313289,7352797,6461173,-13560882,-14663302,497841},{-26929149,3692270,22104545,-397206,-24268898,12060395,121150,16512979,9110263,-11272320},{1,0,0,0,0,0,0,0,0,0},{21015900,-6207046,-11901988,-12656836,-9836054,-348250,2028156,8319914,31718355,-13986772}},
+        {{29090132,-11226476,-12204246,7924352,-19425920,-9744843,20549296,-5732630,-3432058,-9521822},{-23986402,3023603,-23957182,-296509,8044065,1182070,-24532240,-5567003,22395676,12036796},{1,0,0,0,0,0,0,0,0,0},{4697063,-4424298,11392959,-1245196,-28183590,9735594,30827744,8822039,-9645076,4790443}},
+        {{-5544738,-4975237,-18189161,16315284,-26582594,-13225515,-31078535,10575139,10854806,-7749851},{25601739,10347772,9837805,-9010104,31970595,-1972238,17968509,8688399,19163802,-9101129},{1,0,0,0,0,0,0,0,0,0},{-19708487,2999414,-21635414,-2508969,4221594,5710471,9719130,8986569,31549151,-7151853}},
+        {{-21049216,3257187,-10531180,-2965956,32198184,15401614,28669652,8479032,-3614317,-7041960},{-31041023,10513657,-7193085,-5257720,1798670,6933966,32692532,193849,17428741,-5388042},{1,0,0,0,0,0,0,0,0,0},{24573461,15444460,-23945971,16421088,-18493379,-1306126,-31823789,12003466,-8508194,-2682250}},
+        {{-11394312,9285634,-18717993,-12750151,-21600775,4527562,-28265339,-16630152,4933856,-9269017},{-28581953,-6451379,-20887385,3628303,15936320,6451865,-24248076,8940733,30014027,2121526},{1,0,0,0,0,0,0,0,0,0},{-24782947,7954094,8932211,9979656,31650566,1460464,-30789448,5320934,-20898197,2619172}},
+        {{-1625758,-660216,22272713,-45195,-2930041,-13968330,-22387613,7926914,-17069313,3414448},{22610207,-13045694,22689603,-5971551,16683201,-4672780,-26260837,46824,5123206,13737655},{1,0,0,0,0,0,0,0,0,0},{9400744,-14949710,-14015923,4170620,21222658,9892152,20776742,6293269,33396184,-1742658}},
+        {{-9196298,-6483866,17820685,16044175,-8640978,-15469744,-22444944,15243633,13668639,-5212117},{-9097106,-6245446,25429589,9776706,-21198877,7968979,5574039,-13661129,-26318670,3916285},{1,0,0,0,0,0,0,0,0,0},{4113498,-1992647,-15499794,-10954572,-20878023,5880130,-14029545,14395094,-15933992,-12587059}},
+        {{-22481091,-6572259,24874950,-14256465,-2888697,5853640,29913241,-4386211,-28146890,995208},{9832550,3098909,28541121,1398925,-31153216,1921490,-28270986,228144,21510074,5004136},{1,0,0,0,0,0,0,0,0,0},{22898171,6663070,-12416101,15552802,-19716096,-11988312,-9558902,-11397190,31206727,-697414}},
+        {{-442354,6329694,-19820109,-830066,21392969,-1283846,29163635,14764197,25273955,-3150380},{24519031,1526380,23360672,13134090,-3521693,-16207255,11552730,2960704,-18253163,11420755},{1,0,0,0,0,0,0,0,0,0},{4707163,15239464,17661447,16774282,-30925173,10026776,-30055856,-9318552,4465878,6567363}},
+        {{15201789,13617208,-11397939,-12664937,20563338,6825246,-8177911,202519,26242646,15119751},{16316414,8770644,-10937725,7951679,29942655,8349221,10329893,11276573,-5222609,15486538},{1,0,0,0,0,0,0,0,0,0},{-20039859,-16343137,-31648601,6885929,27785806,-14528004,16183480,-5006208,-9169720,-13046563}},
+        {{27057415,-7766030,-19856712,-8002001,-14002755,-3389748,-4584944,-837011,-15290736,-6173926},{26413727,-3463424,23376033,-10557136,32998712,-14425858,25392588,-7705614,-937247,5879285},{1,0,0,0,0,0,0,0,0,0},{31130357,10302616,29443939,-9003457,-17552314,11779606,6034335,2876477,33365389,1030446}},
+        {{-32046779,-2332100,-26444782,-12027429,15874919,16530059,-10201773,16574586,-21826829,1594206},{18166915,-15762620,9918800,-2662848,378150,-513053,-14628990,-14921837,-4038701,16037835},{1,0,0,0,0,0,0,0,0,0},{-26660064,-8542691,3145044,516532,1211574,6745175,-33480129,15243509,22447594,10611501}},
+        {{12441928,9613860,-6438307,10268619,29723922,-7594876,-20915052,-9438185,3110206,15041951},{-27845131,-301565,13098838,-12412381,-17057069,-2305438,15915238,-15497809,26473456,-5931581},{1,0,0,0,0,0,0,0,0,0},{-32839270,-15520818,14763527,11252212,-28002453,-6886415,7826890,11169197,12823622,-15966164}},
+        {{19568924,917105,26184416,-1441948,5807890,4631002,5995927,88360,-4724440,571167},{-26987895,7311430,-6599971,5851809,19164590,-7228050,-31289350,-5590061,31107560,-2873018},{1,0,0,0,0,0,0,0,0,0},{-12384493,-2449396,25887647,-228463,25849439,-10946323,4647831,2194922,29122092,6879608}},
+        {{10864591,12329956,32874286,-9818437,15158773,8282459,-27849210,12181024,-22337097,5791593},{11467519,817258,-7337572,-9494293,9969222,-4527916,723109,2221511,-9447797,-12695240},{1,0,0,0,0,0,0,0,0,0},{-9050020,-14854751,20399223,-8008370,-1636823,-180620,-31464211,1431946,27606473,-12839354}},
+        {{-14247067,3346823,31704086,-8860273,32720832,8692653,11254258,7163329,-20348085,-15809447},{773675,-12284300,26811496,9810454,-17823448,-3729061,-20809415,5232970,-21001393,10786406},{1,0,0,0,0,0,0,0,0,0},{-27845340,-7601619,-16815528,11152155,-6579599,8521906,-26480386,-5438132,26639301,-15672841}},
+        {{-26343029,13162398,-18036646,-13417729,-17731882,4921945,25764440,-1253763,-25713273,-2387108},{-12518650,-11847073,8515687,-1145319,-21030144,2728705,-3996607,-11165101,23074414,-4305271},{1,0,0,0,0,0,0,0,0,0},{3185276,6650240,-6636614,16090936,-10151595,10379029,-25061957,-2588792,6909390,4260682}},
+        {{19540807,15597342,22270617,8770408,-29596163,-6672262,17025476,-14604301,30837679,7057294},{22898374,-6164667,-30437184,10638783,29364608,-9807291,-33097565,-1444752,15640795,-9795929},{1,0,0,0,0,0,0,0,0,0},{31533690,-4704836,-28138047,-6759060,-28442306,7159218,-4990328,-1405305,-3427751,11932160}},
+        {{18135818,-1132059,-23489130,-12545159,-28107306,5042725,15897763,-4347747,6118853,7084165},{25757926,-5277193,25074855,-1998322,-8784454,-3209742,-7837632,14388431,-27317280,2851513},{1,0,0,0,0,0,0,0,0,0},{12187781,6548686,-27665006,16130373,-8819905,-13441754,-22233718,12803774,-17700511,13013050}},
+        {{-17951567,-3818784,-24794353,-13969294,19576516,12100487,25053833,8390039,1883228,-5344263},{971353,850177,29461559,7372596,-14428653,8782652,-3947425,12714422,-29755457,15562280},{1,0,0,0,0,0,0,0,0,0},{23883029,9148453,-28705417,-2541472,26157779,-8851703,25141477,-6237712,-12304914,7701715}},
+        {{18362382,5308786,-23184636,-13864804,-4945031,1980412,-15929057,4313255,1413276,-12021099},{21221171,10527915,29252755,-5026780,-19751428,-14240018,33197519,-3389085,11479921,1183028},{1,0,0,0,0,0,0,0,0,0},{-7235784,14579300,-30194556,-16757262,24809421,-14762308,11245006,7075882,9077502,-488134}},
+        {{-24110928,3578346,-6624929,-2062688,6124227,-4571043,4111474,-8805050,-18845947,-8727533},{-8362863,3588248,-33064055,3177678,-20354251,9575115,-14740088,16212558,31392549,-8779849},{1,0,0,0,0,0,0,0,0,0},{16901037,-3787404,30829462,6520123,6716271,-11402892,27743570,1830994,-26854160,-10492468}},
+        {{21228734,15919493,4364683,-1846906,-14637575,-2225922,-8501970,-10624022,-6085532,3425140},{6729321,-4914590,-4869516,15992326,-9568016,4840552,-32973245,11454150,-29091434,-1830335},{1,0,0,0,0,0,0,0,0,0},{9706229,15661380,13159628,12601128,-26904798,-2898974,11314134,53078,-24945733,-9609201}},
+        {{24985385,4566630,-2770645,-2721330,-7415993,2713996,-1296838,-4902981,-23932808,-11602113},{15033187,-9737515,11889192,12978881,22200445,3489794,17241893,-9767158,-19640336,2903890},{1,0,0,0,0,0,0,0,0,0},{5092177,9432791,-30885451,-464810,8717385,16773437,-10064077,-15061151,15123304,-743393}},
+        {{16856934,12701393,-10258724,9516079,-7625429,-14222571,32553133,-12157058,-21755150,12961885},{25945014,7752472,-23702945,9694914,15165262,8464533,10059177,-3216470,32632122,4759341},{1,0,0,0,0,0,0,0,0,0},{7666055,-6424020,14077952,-12908778,-6180861,-11827694,6837225,-9473686,2348228,-13575876}},
+        {{-4392482,4052115,12223429,-14839107,21218555,6675177,26565391,-1811726,8645795,-4413376},{20118815,2066136,10903967,-10877866,-1977315,-8525136,-7290087,1054740,-28806870,2991133},{1,0,0,0,0,0,0,0,0,0},{-8896879,-13737880,-30752423,4125075,1018712,3787370,143171,7176704,-33067895,8757838}},
+        {{-6150890,-171091,32744392,13578840,-31470738,6152966,4519436,-6060670,-26115005,-13570247},{-21723205,9144324,-29770986,-981385,-29992375,-3752711,22978467,-3849650,6497504,10620016},{1,0,0,0,0,0,0,0,0,0},{17348108,1936104,-16591493,2450363,29729697,12571500,4806917,-1608740,24323414,-13761756}},
+        {{-18214664,-14048918,13784377,11611856,17803598,-4642400,-17796040,11343145,-122349,-13809883},{-28148058,-14865575,-28595910,-14988942,20648588,6761487,-5454459,2496094,-22031171,-14695177},{1,0,0,0,0,0,0,0,0,0},{27676073,-3471827,30297725,-882576,8599965,10379340,-26592541,-2645357,20666098,10515444}},
+        {{16750457,258734,-27440362,-1607064,-9310246,-16263803,-11835571,13241211,-25562696,-11971028},{-21001703,-12135943,1290878,-12093695,-13288798,13025667,19844738,-15250981,-17187418,8399913},{1,0,0,0,0,0,0,0,0,0},{19920233,10623018,750469,4940632,-12031761,-8899342,8721752,13511895,-6758099,6100662}},
+        {{-29370632,-14687254,-17911048,-13433372,-7711652,10225513,-19860066,-8820862,-22613860,6236686},{-17860947,15903222,19056265,-8571304,11565296,3784055,-25248068,422753,-17517149,2363991},{1,0,0,0,0,0,0,0,0,0},{6307108,14641373,-1670717,-10288233,11343245,-3928548,-30823413,14873480,-30998774,4194075}},
+        {{7915579,-3340712,-12872210,16765405,11025910,-11616986,-2207712,5927311,9825045,15895182},{24448289,8137460,28415385,7738577,3420939,1608844,16785262,10089389,15754640,7109309},{1,0,0,0,0,0,0,0,0,0},{9304430,7627413,-17226337,1892304,33127361,12026895,17206479,9406461,-30112187,-1531447}},
+        {{-7508607,-13457242,7659251,-14962879,9167563,9622292,-25768483,-8706950,31100931,15015134},{25870967,-15571482,-28400968,16027265,7446505,-15384173,-30989853,-11481423,26917692,-8272213},{1,0,0,0,0,0,0,0,0,0},{18111703,-5589895,-27395584,-8851187,815024,15326108,7773714,11849352,14134275,5828282}},
+        {{-26185773,1691629,-20217109,-10095842,30199303,12181289,7341872,2603580,10482439,13566953},{29641496,1060618,-29345447,15493313,21334810,-12956732,-20175546,-9635930,-23927113,11236666},{1,0,0,0,0,0,0,0,0,0},{29112523,9416735,26069720,-8848861,-12656468,-6887966,-9573981,-14338412,14591016,-7496497}},
+        {{6492477,-4074131,-17461588,-11117999,-1631891,850574,-23024390,7192508,13794326,-16222966},{-14989776,-743707,22326110,-15883207,-8759987,3665026,2213611,-6050584,28594530,14064839},{1,0,0,0,0,0,0,0,0,0},{-9404141,13065141,17182832,-11027750,18368713,6037675,19162698,-5445878,6401791,12982470}},
+        {{26943424,-8763438,7192860,7053517,5568284,340604,-19223270,16480272,13637763,-8622187},{-25363259,-8352006,6561695,16393119,-7598040,11266408,-3256320,-11370593,4795663,13766620},{1,0,0,0,0,0,0,0,0,0},{-13588431,-3461295,-26841020,14566396,-4763344,1203003,6474410,8700267,22711646,-16010490}},
+        {{30288305,14650400,7136919,1420767,33195601,-5800396,31328917,7004306,-8132520,8047239},{18304388,-6399484,1452080,-7762565,22124860,-16704466,-26405507,-1972619,-21508515,-1760909},{1,0,0,0,0,0,0,0,0,0},{-14449234,-4649378,15654634,4486417,26964551,8141474,-25198798,-10041899,18213521,6029541}},
+        {{5654542,10645294,4904999,1632255,-16935163,-10410978,-14171111,16588470,9086288,1625697},{31393462,1785834,1353657,13129189,-21091081,-10264743,10568615,-10646735,-27203207,-15271139},{1,0,0,0,0,0,0,0,0,0},{31089402,-9522712,-15795516,5897090,-7422021,14043833,15035433,2112504,9749857,13100268}},
+        {{-2209236,5332222,-5695555,4337317,6344088,1448556,18338904,-2873398,24937608,6494846},{22901720,-11002166,-33005559,8357013,-12696925,16741510,1188926,-1661621,24862371,-8967725},{1,0,0,0,0,0,0,0,0,0},{-2486343,-2027114,8409944,7899281,-28704395,-9461907,17501234,9802647,26285880,4206495}},
+        {{33155173,-13550868,-14744907,-13750202,-26739312,-3318991,4586370,-6842495,32715429,12767829},{28005490,-4373375,11493314,11792383,-9594695,5417547,-28742429,-5603142,-12955368,2596087},{1,0,0,0,0,0,0,0,0,0},{-26723977,7181990,-1533148,16263592,793974,5870921,-10269990,-650351,-28647062,-2533318}},
+        {{-4080267,8240356,-12458489,-8335813,21396087,1785547,26883952,-12735320,2522270,3480536},{25030628,305485,-14701688,-15707624,-11520477,-8866157,32853234,6063598,7140172,7656591},{1,0,0,0,0,0,0,0,0,0},{22462858,-8349753,-20565450,4623374,-19512860,-7674384,-12781995,14862887,20867441,4952930}},
+        {{-18901949,-9636547,-18555639,-15371064,-6997767,-7718745,19540091,10796622,-2227209,-13447134},{15265592,4552375,9490098,-8031782,8051010,5645440,-28888611,-267448,5257548,5652976},{1,0,0,0,0,0,0,0,0,0},{20682721,1593471,-22000790,-16574250,13895416,12356801,-20722123,7503487,3503227,4309687}},
+        {{5230557,-4415289,-999624,-11707041,-22718205,7691076,13491746,12777735,13836226,-9920985},{-28133561,-4734474,31882360,-7620687,-25078823,-13158466,-16160284,-15437594,17880591,1162755},{1,0,0,0,0,0,0,0,0,0},{5452510,-3655955,18504705,1910701,10931309,4218298,3308769,8347345,-26719232,14305949}},
+        {{-1152135,-8957590,-32574624,1865148,-17889868,7938861,-291740,-208741,6847204,14393973},{-5773909,4163872,-15383215,1823441,24702443,6602414,1768633,11913945,-15111882,-5377928},{1,0,0,0,0,0,0,0,0,0},{7136660,-8224329,11758320,-5341556,-5816580,10611258,5574331,-14523255,5002167,-11934788}},
+        {{13736589,-8279276,-6349151,12487141,-14887104,-5281474,-25588518,-3512026,-11563377,-10901956},{-20719860,11534191,6139400,-662749,1116565,414396,32827961,6299207,-11339220,-8261107},{1,0,0,0,0,0,0,0,0,0},{14869825,1714206,30964467,-15971600,-23396732,6801836,5643228,7035101,-18505071,-15747554}},
+        {{31344297,7811102,-31772601,4151792,2279474,-4437776,10185452,5138663,-29742559,-16697092},{7865203,8781026,21594231,16524223,-27689253,-6562278,-477083,4239978,32879261,-2274430},{1,0,0,0,0,0,0,0,0,0},{-32656035,-16335392,729091,-1275939,-13587174,6441350,-23766348,-12800874,11628638,5574127}},
+        {{3733867,-8557408,22955291,1653604,-21818752,1481793,-30394083,-7993656,16938570,13796864},{27496530,-1897930,30397752,-5445682,30495273,10157884,-6471061,-15359762,30726123,-12690300},{1,0,0,0,0,0,0,0,0,0},{8762027,15079031,-5233441,5542851,9091711,8984936,26576213,-14831995,14156987,9505670}},
+        {{-17562402,-7721758,25212550,-12824223,-33163755,8285054,-28919125,4758992,-4500499,-2417303},{33355057,-9811477,17594245,-12693779,-1370750,13244647,3407683,681797,12957644,-1483991},{1,0,0,0,0,0,0,0,0,0},{-22968477,-4723064,-25456469,-12850296,-32834260,15455225,-31119100,2190322,15327955,2551011}},
+        {{-5225797,8773122,19594449,-5629790,32109487,6941179,-14266077,1546503,-28674233,-14696644},{19111693,-12368223,3821189,-16697729,-10879641,442295,5317783,3696452,-15880752,-9732954},{1,0,0,0,0,0,0,0,0,0},{-25993176,13772554,18954132,-1858487,-15127960,-16035910,31634973,-14330222,-20086733,-14088609}},
+        {{-7112462,-13520094,-11318179,9614937,10480627,10984197,3494711,-1353633,22694890,-8351742},{-14476338,-14887855,-23299682,4681121,-19694112,-6846792,21647054,6301428,19425389,-6142565},{1,0,0,0,0,0,0,0,0,0},{30497296,-13102070,-32407458,14625696,-8026835,-7012438,-12604603,1099840,-29715004,-12531484}},
+        {{-3176061,-6940493,29360176,15956337,-13766088,-7325983,4007329,-2389815,-25914711,3403865},{16429088,8947326,18611663,11210617,-10686108,10143026,31537677,13147065,-21142666,11998024},{1,0,0,0,0,0,0,0,0,0},{-621755,-4436260,-21677294,-5722860,13562925,-16503932,-16717153,6869361,-29128728,-4766265}},
+        {{8324275,3462112,-29425231,544543,-23633155,-1325541,1230584,-9698727,-16672171,-2541474},{10898295,-15054957,-729853,133730,27444893,-10361069,-26334452,13803157,-2688712,1839102},{1,0,0,0,0,0,0,0,0,0},{18622810,-2723079,14312807,-13563632,-30159639,-5150066,28468283,7662799,29454756,-1285082}},
+        {{-30585816,11614932,8333191,-16055379,-13040540,3077096,-17112533,-7582006,6329018,9338752},{14600844,-10253654,-14892858,-4730794,-442005,-4021921,-1762328,14969894,21125654,564237},{1,0,0,0,0,0,0,0,0,0},{22186279,9997340,-6510675,-16067788,-12185940,3838743,7896740,-4544475,-16406043,16127662}},
+        {{-18352876,13717480,-13953285,-5307475,-4794847,2082809,-28794342,-755924,-26649567,-7131514},{531673,11607248,21073745,-12868354,20646600,-106317,-22770473,11200609,-8951192,4550208},{1,0,0,0,0,0,0,0,0,0},{19542061,8912082,-9523241,13227800,7157221,11269021,-10158032,16618634,-27163167,10886351}},
+        {{-975868,-15505714,22343655,16042695,4085908,-11945702,32782794,6801709,-477587,12785012},{15014723,6600213,-32147454,-7175435,30969035,7523060,11167608,-12440776,-24074723,-206019},{1,0,0,0,0,0,0,0,0,0},{-16238554,-16217624,-16782816,12779005,-15008369,-2374574,26313468,13998581,-10350790,13540687}},
+        {{912606,-15484190,-5494231,1276841,-24139663,-278785,-4500541,3536508,9943476,5116167},{32144035,-365117,-2582878,-8900324,32524008,14849507,-9188343,-762711,-5723840,4684262},{1,0,0,0,0,0,0,0,0,0},{-12984328,2298746,21449525,-10413515,20591742,-9308677,19464984,4870294,-27028674,9520637}},
+        {{-13573209,9335264,31925927,6494182,-29437770,-10920110,-5103185,-11347933,4400357,-14873075},{-2279451,-16765955,3838606,-8906399,15118411,9511360,-24523346,4820719,-17979944,-8464596},{1,0,0,0,0,0,0,0,0,0},{16967463,-11813347,-13986090,13694921,6531657,-8587781,-29198129,7607498,-6406464,-8790597}},
+        {{-25779446,-7763356,-954537,13944724,8212448,-14149833,6465428,-12891859,16564879,712148},{-9498227,-15470892,-11296710,-6011507,2687397,15949643,2393283,13784815,22274780,8944190},{1,0,0,0,0,0,0,0,0,0},{25968790,10299373,-19955345,-308046,-19438895,7614041,3806735,226059,-23138074,16340193}},
+        {{-17262776,-16599399,-17135356,-9635845,18754910,-15474591,17884121,-10477115,-2429844,2741725},{-13505226,-9930721,-17694982,-12197309,-20941704,16774880,-15241293,4857457,12297950,-13889223},{1,0,0,0,0,0,0,0,0,0},{27023100,-2922932,-29194386,2525504,920963,14358206,-33066342,16184949,5115889,-13485807}},
+        {{27178131,15374499,-7126575,-7001171,-17597637,9164963,32007087,9554906,-10524718,-12965307},{-16441660,-16611420,-3757846,1202222,-21655837,-16344674,29354889,1015459,4646163,-3027917},{1,0,0,0,0,0,0,0,0,0},{-13151075,-6640402,27194904,15027658,-9622481,-4985224,-10008720,-8031902,16190560,1583216}},
+        {{-6193272,1650289,26809309,-3746141,-28995197,-11382160,20789518,-14495488,-24990247,5602279},{-16029527,14245887,26587112,3639939,32246846,-9762059,21939273,-2743616,31064304,-13968927},{1,0,0,0,0,0,0,0,0,0},{-5651119,5495317,3179181,-9450688,-25553466,-4110634,-25861973,-6916434,-7639714,-11399902}},
+        {{-2486478,9876043,13592109,12229454,27915448,15688100,-10330283,-13986268,14956912,-13722929},{14614070,-10856754,-27260281,6851559,5677466,15436863,-12278291,730854,25693319,15720968},{1,0,0,0,0,0,0,0,0,0},{24159713,834068,4505837,-7212389,25199648,-9291575,-29598733,-3667553,32246685,11756311}},
+        {{18378696,7065281,18050166,-1525359,12155815,-8791786,17309217,554914,29077740,-16402958},{-26254752,-13953525,24021274,12310082,19460222,-1936073,28266611,8592696,26120164,-11147781},{1,0,0,0,0,0,0,0,0,0},{26852429,-7791000,-19544780,-3938934,5734704,-14571912,-13603776,-11119181,-25285561,9736534}},
+        {{18481179,-544014,-14479808,16068522,18498238,-246294,-5480260,-9370198,-22310786,1384315},{-9799341,-8421852,-30019907,12722631,5627094,-8021465,-9030110,5463147,-33542641,14671674},{1,0,0,0,0,0,0,0,0,0},{27737707,9315641,-31227416,-13697650,-15463686,2387818,31850180,13000984,-26390783,-14689553}},
+        {{27157122,-1859892,13684292,-10988408,-10026604,10466586,-33232368,8600784,-2561194,-13791734},{-16225401,-9045192,11226094,6394153,27568666,-10631263,31962617,-8311014,14114290,-10984870},{1,0,0,0,0,0,0,0,0,0},{-11223529,-14828938,-8662167,-2430056,29196407,-10592434,-10692719,3584177,-21114016,13868181}},
+        {{32583213,12178870,29805421,-16414297,-1394411,12552902,7681284,9815731,-8744686,8638027},{-12524471,16207447,15488551,2917059,-21185517,9814216,2090734,-15036051,14924034,-15810442},{1,0,0,0,0,0,0,0,0,0},{-16419056,-6006420,-667950,-12643994,-31127689,9170146,29748791,-4243359,-30292411,1031521}},
+        {{-1648758,424550,-30962408,16428362,-26347933,15467898,10864922,14087507,23046619,7568288},{452357,11667285,-958283,-16337484,-22977301,7555376,17754515,-7605564,-31043092,-2406754},{1,0,0,0,0,0,0,0,0,0},{8135148,-13636192,-20221529,-5642814,-6611709,-16626105,-29042213,597981,-8952788,-2764995}},
+        {{9638071,15816359,16163678,1310986,-26960583,945026,-1448779,12738241,2934385,14806783},{-32022589,-9673831,-184642,-8724135,24246160,-9920444,-8406745,-339441,-17598754,7440946},{1,0,0,0,0,0,0,0,0,0},{23799368,-11191549,-12681613,12743805,4550469,7607484,18423605,-2117753,-14726841,-6005152}},
+        {{-12964658,-6507760,29853557,853998,23780738,12180639,-15549116,-11295112,22665021,12019383},{-8187986,16141706,6091195,-5953395,6213486,7707029,-20440323,405127,-14057803,11011498},{1,0,0,0,0,0,0,0,0,0},{-15645781,-4269593,32613711,-12436829,-32364394,11025428,-19816493,-803545,-9723935,593775}},
+        {{-14889789,14684662,-3636632,-7464417,14933581,12988633,20986691,3700890,-5005015,-2956703},{28609260,-15015431,-27382191,-3358847,-19841413,-1467386,-7904969,-8413311,25547029,-2083593},{1,0,0,0,0,0,0,0,0,0},{-28604910,-9461383,19846881,6483301,16159881,-3859634,23390482,7676626,-25901055,-13361100}},
+        {{-26176526,-11407204,-6230783,-14013015,-11927169,11383434,-19818495,8131656,27086425,2725078},{-16262453,2555421,-27477746,-3858998,11361833,-5087379,-23955466,760443,12159033,-6313772},{1,0,0,0,0,0,0,0,0,0},{-15662051,8610567,23987689,-2091329,27184335,3333766,18504248,12090015,-25758335,-2748622}},
+        {{-19608395,-12035954,5733783,701329,-15676002,-11462324,2679735,9001714,-2491296,-440376},{-30020686,-1144379,33082983,2690050,-26739409,15843385,19728948,14406455,-20640485,-6698511},{1,0,0,0,0,0,0,0,0,0},{10930118,-2427376,10482899,11601058,32261320,-952305,17372819,-6186938,23978106,9172458}},
+        {{24434014,11800284,12918930,3145552,-162962,7640413,30138505,12206255,-28822646,-3397938},{27505031,-2305165,16376735,3227713,-9193920,-4100735,-11643694,-15579698,-16975645,4605977},{1,0,0,0,0,0,0,0,0,0},{-10500943,-9432075,22423820,9425798,16602751,-13957002,8308892,-1251200,12532517,9454528}},
+        {{-30895937,4360259,10601912,-5731777,-30155134,-4404983,-24442919,14922778,-2231067,15339028},{-9165329,16644220,26565428,-13198872,-12002290,3458021,29138890,-1276407,-25386425,-8605139},{1,0,0,0,0,0,0,0,0,0},{14305754,-15103262,-20053115,-6510275,18621080,3921060,8957056,10890470,-15417797,-7005734}},
+        {{-10804320,-3260258,-23611438,-14733886,29874564,-9426146,31535207,12548332,-16864663,-9986948},{745603,6536319,23108093,1790605,-14031000,12251984,-24352979,16248102,-5356437,4952080},{1,0,0,0,0,0,0,0,0,0},{13466886,5852750,-29951252,-11075241,18230063,15274678,32067389,-11868652,-33138709,2545587}},
+        {{20277534,-9384878,9780933,14222625,-25711062,11303819,-18609108,6619742,-4817224,-8387864},{-15888795,-16080082,-12474340,-7164584,-7687699,15110033,21047039,-7299675,-22286958,-1428621},{1,0,0,0,0,0,0,0,0,0},{14009261,-5020757,-8491535,-4517579,-12542250,9667843,-13053010,-5611449,4905375,13663701}},
+        {{8650275,-3532525,-1967149,4704816,29059108,-10041034,18414648,10512073,-30398983,4812407},{-8157515,5154128,25538927,3468879,8381351,6057174,-23596978,11510433,-17000709,15017568},{1,0,0,0,0,0,0,0,0,0},{-17424340,15509553,-32242534,786481,8892064,5711259,-12897330,14855511,9210058,-13907294}},
+        {{-24117162,-3644645,26889184,6437570,12634344,-13293625,-6292413,-14278473,-8731562,8766391},{-27865590,13203078,23518076,9528982,26655630,-191867,3595201,5365675,19569164,1810017},{1,0,0,0,0,0,0,0,0,0},{24322110,-907244,-15853941,-11517090,24820624,-1317255,18877567,-12683645,-16712689,-11749376}},
+        {{2468138,14638451,-26962312,14156798,30177913,-15763862,7123994,-13371514,33182055,-11976130},{26633280,1089432,-14112422,-3666335,-7002161,11231813,-17799899,-15568010,21314169,1986580},{1,0,0,0,0,0,0,0,0,0},{16506740,753820,-10967137,16330431,-12300545,2000035,-3592644,-7429964,23955194,-15403553}},
+        {{-26373893,10542538,28276348,1090834,-29589611,-801848,-30853260,-8489242,-1994303,-14320915},{-20847412,-13710079,11572323,-8665325,-25962477,-1849956,11301911,-271614,16472310,729005},{1,0,0,0,0,0,0,0,0,0},{-24812198,-14381439,-7901048,11113188,-32508212,-2659381,13214077,-15386511,12117287,-10453589}},
+        {{-1032193,-16753891,21244808,8276105,24521651,4822241,-30641189,-7307669,-21449356,11635732},{-24709188,-16172373,-24910766,-6375403,19130707,4109468,-5564045,16685665,17144323,-4424552},{1,0,0,0,0,0,0,0,0,0},{-5462659,13937,-18027917,4929116,-12524249,-9308961,20160864,-13634865,23977173,-8500126}},
+        {{238448,-16743382,16657994,-10175087,-31264799,-2380005,29646978,7925806,5651618,-10828248},{2203257,-5808976,3303094,6801081,25433721,3820421,-12995717,2919380,-25331931,-597976},{1,0,0,0,0,0,0,0,0,0},{-16802539,-13982203,-20700566,8723068,24775452,14863856,6363733,-13417777,15680828,13358306}},
+        {{22183096,8554200,-21467590,-12557962,-8678490,7400914,23256847,-6303200,9507167,-11152910},{2352257,-16132765,-29709432,3461638,7927082,-14072708,4003694,-3792267,-12937641,15820809},{1,0,0,0,0,0,0,0,0,0},{27593427,-4973144,5024328,15658910,32507894,13125230,5205206,-1132061,1179026,4181782}},
+        {{9365815,5524165,-605431,3181476,7853256,-8661300,30635448,5308090,-10350612,12219917},{33266498,-1086773,14872036,-12438537,25724784,10112385,-8244633,2163368,27952689,12023863},{1,0,0,0,0,0,0,0,0,0},{-25786687,11562372,12092279,-16244787,-3763310,-12415758,-22856665,15926319,26425720,7491500}},
+        {{-20693597,-15595644,8997904,9224303,6502008,9528034,-23309039,4269352,22873788,-9381829},{3541892,-1987023,13577452,8839607,-29749791,8562932,-8144857,-10326270,-5076575,15668423},{1,0,0,0,0,0,0,0,0,0},{8914310,5080097,-8808418,-1173491,9999375,2065989,3067295,2435798,-11082604,10936444}},
+        {{-21344527,14542472,-25368339,-1977053,4713017,13784245,7861977,-13590218,-20559809,10542300},{325289,8475974,17145190,-1563573,27853863,-6500994,18048449,-3082084,-19903101,-5528097},{1,0,0,0,0,0,0,0,0,0},{-17636184,-6959271,-29226582,-5600734,-19252292,11090813,30481025,-11862535,-7804090,15461509}},
+        {{-25692844,-4161602,5592295,16077258,16741823,2745860,25329095,1844377,-20890602,-14926674},{-26512619,-2109231,16181457,712337,-5623832,-8561755,-28511847,-9446959,32026113,6166062},{1,0,0,0,0,0,0,0,0,0},{-26377426,-540655,-25601014,-746252,24462430,2736411,23189639,4887863,3487687,-2880990}},
+        {{-17179876,13778695,-22995097,-10133768,29302059,-1444778,-8499936,1993928,-20129966,-10268395},{13430905,-16747229,-21070918,-7276250,-15792935,16181081,-79364,57890,-30764768,-4578593},{1,0,0,0,0,0,0,0,0,0},{-25400198,-10726739,-9296278,14877340,-117044,6047172,-9796913,-7291408,29671066,-1311715}},
+        {{8896905,-14894317,5135719,12494862,-30414029,10834111,-12948745,15542856,27382687,3522375},{8895598,-12426454,12805058,12233755,7847640,-5056172,4464973,7104504,-32815787,13329141},{1,0,0,0,0,0,0,0,0,0},{-30175729,12355167,28640155,-11778766,-19535155,4193804,-19392476,11321522,-18988263,-9330724}},
+        {{13216183,2792571,-3368052,-5244512,4776787,11335322,27952880,-7838369,-6214204,5193638},{15293895,-59076,-4698989,-5831122,4288233,-3023738,20028932,-5612954,-28265772,-12133104},{1,0,0,0,0,0,0,0,0,0},{-30336045,-11615135,33389176,-5500723,15832309,9727243,-4859065,5347932,29547862,9967320}},
+        {{-11667849,-8484823,-21840895,7986996,-13792600,-8200138,18915084,-2334099,-24091001,-15907024},{2396999,11727214,23354863,14822313,-7875975,6150039,-22261061,-3210541,-9745572,-14925268},{1,0,0,0,0,0,0,0,0,0},{32163353,4423290,25108160,-16417252,14201685,13418075,23621826,-6076391,1101423,10649518}},
+        {{32983300,-13765724,-20555183,-8373295,18110173,-14477299,32546208,1837961,17089744,1248298},{-20809571,1950809,3646583,-6264868,-9690427,6935133,28669782,-7832517,28701753,9509665},{1,0,0,0,0,0,0,0,0,0},{-25273713,-537696,-1615826,8711059,23555500,5297791,21467482,-4787178,-11008580,-14280585}},
+        {{21141164,4298197,-14641979,8461339,-10502194,-12667710,-25301449,-9980207,-27164288,-3870640},{21715761,-15951610,-16517568,-3063428,18399882,10545833,-4641823,-6938397,5206255,-12820769},{1,0,0,0,0,0,0,0,0,0},{-2700204,-5650223,10569057,-9289693,-8776007,6649930,12477297,2776319,-32707523,-5521199}},
+        {{24416180,-4178610,-6213887,3556901,26524096,5199824,-32599391,8833668,17435227,5030326},{4031692,-10823810,-3984788,-5925155,7192318,4325988,-20515881,-8042393,10248782,-2777443},{1,0,0,0,0,0,0,0,0,0},{29232798,14981871,-33213287,16377893,6856857,3238746,22413610,13090894,26879718,12469095}},
+        {{-20221430,-6490313,-31273822,-13525013,-16230958,12904728,30452980,-13631220,5319684,13525607},{18092944,2031601,-16825142,12921218,-2868713,-14278774,-7244279,-7847066,19210028,3440413},{1,0,0,0,0,0,0,0,0,0},{-31250753,12565329,10642918,-10458441,10366628,-13035472,-400826,8268678,-11518700,-8601855}},
+        {{-15834815,12328123,16772356,-34021,7395073,12127914,-5260131,-16641243,7730511,3671563},{24139150,11531675,29958918,-4001814,-18178562,11730839,9940816,12339718,26038495,9276844},{1,0,0,0,0,0,0,0,0,0},{20543333,14405852,26495370,9626831,17957730,-6023851,-27951702,9197607,24769913,-2907607}},
+        {{-13239198,7913473,27203218,9219676,16998824,-3309666,8518504,1355131,29922591,2053812},{23281321,-7551101,-21904584,950080,8181324,3496961,2354825,-7710288,25661981,8973634},{1,0,0,0,0,0,0,0,0,0},{-7764817,694409,16914663,16192381,30896104,8902170,-18796473,-3043147,-20417907,10699038}},
+        {{-25443896,2356837,-23741666,7766739,-29709364,3642051,-21264986,-11844070,4042331,10402083},{-28058660,11197757,-32039294,12373450,-29564193,6029885,22083483,-1475877,18004866,916587},{1,0,0,0,0,0,0,0,0,0},{-9322111,-2266411,-9652571,-186979,6348056,-1654122,-24146403,-2622652,-14880709,14769615}},
+        {{23136911,-13960740,25338499,2747471,-20150090,-15643824,16496408,12939823,7325111,-3884796},{-908051,9359105,-9926313,-1874230,-5747354,6615289,30155013,-9618214,-20629460,7477826},{1,0,0,0,0,0,0,0,0,0},{-13225101,6374083,-20811974,-12079589,-31410098,13878467,-28369182,-6949714,22346716,5897433}},
+        {{-25295909,-10727764,15059215,-3277501,9966510,7660638,28181221,-4308248,-22080376,12795556},{-30921493,-10767383,9067282,-4787861,15063662,-2643239,27280300,-2858316,27628983,10950302},{1,0,0,0,0,0,0,0,0,0},{3632980,16588274,-21738470,-3292371,31698340,12916457,-17604797,-8524172,-32614962,11605736}},
+        {{-22651751,6123178,-33168077,10078630,3939562,14031873,22838893,-5826103,-25164706,-2220821},{1706193,-16217644,-13494441,2951309,23755302,-13266145,4107274,14684417,-16427999,-1897370},{1,0,0,0,0,0,0,0,0,0},{-4135991,-3850649,7027014,-9273420,-8976537,-12495075,12049978,-8958794,16427518,-8427338}},
+        {{20194537,2752704,-8701585,-14678530,-20839479,-6467401,-7484423,-5318683,-23497760,-6872704},{-1128029,-6539600,8276502,633937,-24409415,-2979823,-14851088,-9989765,18964209,-16557120},{1,0,0,0,0,0,0,0,0,0},{16398281,-15315914,-10474836,5578720,-6071302,-2866446,13003452,4727983,3724453,15921985}},
+        {{-26540553,4194070,26992884,-9721898,-5919690,-5679013,31382531,1469821,-17442929,7390047},{-23187818,-6950527,28767011,-12100336,-23576161,-3074748,-18101398,64999,-32440069,3617767},{1,0,0,0,0,0,0,0,0,0},{15532326,-16690693,12197052,12276612,-648000,4596974,33396697,14423465,29917143,941634}},
+        {{5851539,11664781,-8613369,-8822984,8812083,-7055115,-8418268,-2180789,-8886807,-5323616},{5576375,-1055560,25593207,7003689,16338758,-16597145,5253070,6450811,-12908685,872197},{1,0,0,0,0,0,0,0,0,0},{22031519,-5478415,8162945,-951007,648246,2035814,1125611,-10525677,5420952,14911518}},
+        {{-6939057,9937334,14359855,5292116,-1382947,15488915,-24840945,14391875,12532571,-4408670},{-7605695,15685506,3603683,-14571819,18038409,-2185818,23012105,-254335,28197091,16207108},{1,0,0,0,0,0,0,0,0,0},{-4145044,-11109372,-19776232,-5588584,-7619593,14574455,27307689,15968377,33457122,10204326}},
+        {{15048662,1979571,-32461284,-8653885,7113956,10714395,-26804437,-4097944,-14155995,672838},{13549490,-8510727,-16539721,-10065441,-1968975,13240706,-25016637,9256311,13121774,13311354},{1,0,0,0,0,0,0,0,0,0},{2331080,-520461,-5126481,9125595,26597425,-12438629,-20377368,-174082,10447271,-3978208}},
+        {{30921723,16170785,-31818568,12967832,-6904485,-13913883,-8936223,2152014,14374896,-2034386},{-25151053,13437495,-4016818,-6625719,5872623,1149579,17752458,12261046,33077696,13086605},{1,0,0,0,0,0,0,0,0,0},{30997859,12302496,-3531343,-5569198,20120382,-7401580,-28297004,-16642814,-10546766,10497377}},
+        {{3361629,14150311,-32009713,2794864,22325444,3854231,3210652,3489208,22429456,12034246},{-32391141,-5166263,14459840,2876830,-14134971,-13839860,-8561196,-3026692,25080350,-14397939},{1,0,0,0,0,0,0,0,0,0},{29774109,9667579,-4978638,-1336860,2736091,11921024,27242521,-15691607,25641795,-13808661}},
+        {{-31835379,5451940,14373019,-9057743,5632146,-12988302,-11621794,311535,-147012,-5048370},{-2963082,11378323,-26740417,-943118,-28347604,5005714,21196932,420765,7207798,-3874893},{1,0,0,0,0,0,0,0,0,0},{738548,12455163,-18542544,-13759510,13464139,-9524086,12403070,571532,12870252,-1924543}},
+        {{30265693,-2501435,9044672,-15552472,-12635375,-10019472,1818465,-3363112,28246449,-11884575},{-11323965,12837814,20190879,-6330859,-20842976,323835,-32353082,13864965,-6658846,-11747215},{1,0,0,0,0,0,0,0,0,0},{-16799197,14076251,4912017,-13096246,2866707,5290445,-3604158,-8608475,-30858087,416787}},
+        {{-29892205,3715826,-7528630,-4892227,-28183607,13943005,22408428,14388743,-30178269,912820},{-13296740,-4921253,-23892960,3571942,-14945652,-16084617,14232580,7127834,-23300883,15711512},{1,0,0,0,0,0,0,0,0,0},{-20820152,12854613,1861019,-9251348,-26877109,13031278,-13681448,13702394,-11839160,-6059034}},
+        {{6440633,6743784,2757935,5814605,-32281431,9453141,-32631696,-9613870,-9570437,920720},{7379477,16557938,-30332116,3541993,-13807527,7205906,420205,-483643,-6776965,8971071},{1,0,0,0,0,0,0,0,0,0},{33527929,-1249040,-6649597,9922361,1256462,7766308,-20457220,14249710,30878861,-8939762}},
+        {{23500708,6930801,-15403310,11823165,30545427,-11999386,31035771,-11394851,20470220,7944114},{-8484666,-4309058,-17319884,14840334,9732395,-7419603,21968621,8979335,10265618,-14192353},{1,0,0,0,0,0,0,0,0,0},{30606749,-7861091,22197602,-7849479,22237212,-13429967,10682904,-7053691,29171335,14872950}},
+        {{2350957,12041824,-25149933,10745315,2763486,14468830,-29242174,-1886167,-33241797,5088371},{-31481797,14679895,-3264516,-10573394,17344726,-15879957,33203833,9853759,32942976,-6425900},{1,0,0,0,0,0,0,0,0,0},{29141312,-1617067,118628,11422272,14628771,14564233,4088561,377643,-15090545,15488030}},
+        {{-2213973,10346266,-161291,-16033429,-25873795,-9083166,-2894997,6368803,-31094095,5467033},{-11153803,-5164958,775362,-10694642,7680290,11697494,5700693,1121371,-18227302,8891539},{1,0,0,0,0,0,0,0,0,0},{24784298,-4751023,24129234,-14070853,2751112,8399080,16137412,10853637,-18625973,15521715}},
+        {{-18908030,-14019052,21404820,-6108954,-12830331,14613707,-5625508,11511714,3195224,9821736},{7850227,-9610612,-23462825,249912,21969394,-16362923,-18910868,9548629,-19850618,13566926},{1,0,0,0,0,0,0,0,0,0},{-29155472,-570210,-19249440,-12004727,-22467228,-7733561,31443851,3884075,-4775978,13312038}},
+        {{-20322161,-15333238,-2178032,12806308,-5804305,-4434082,-9646714,2917888,-8477139,-6131527},{15572917,693695,-22358002,16637753,-17594199,-15151570,12914766,-12200945,23023132,-8512209},{1,0,0,0,0,0,0,0,0,0},{3099044,-8292996,12775274,6030977,2601184,3816142,25810064,231966,23723897,-10168888}},
+        {{28337120,8877497,-10774345,995173,356190,6006550,13186306,5520365,9083262,8202364},{4548624,10358013,33461291,7244580,5947968,12352766,-2760314,2951730,-8895247,-12285545},{1,0,0,0,0,0,0,0,0,0},{-25868550,4736261,31512529,-5892489,22284912,13718952,-7404036,11265501,17809013,-10343439}},
+        {{21205078,-15625494,-18206228,-7857410,-27297727,-3327612,-21813778,10885203,-7041181,9869066},{15233968,-14521074,-30551218,13998007,-25256396,4838719,-33300864,11917909,-33322871,-13615657},{1,0,0,0,0,0,0,0,0,0},{20647919,4177565,33541240,11242752,-14621403,11698376,515299,-8954587,-20215129,-9144866}},
+        {{4606485,9764358,18879431,-4977899,32116191,12857372,13797236,9469330,31962943,-14557352},{-14578878,3383905,5766368,10775411,-21865062,954960,-14183172,5262808,-27518624,16037082},{1,0,0,0,0,0,0,0,0,0},{27399271,-5486484,331718,-4963096,-25943964,11851420,-875467,13532449,5343099,781724}},
+        {{-23439377,10541124,-24855197,-16295692,-33062025,5465317,-24573347,-10144923,24398560,-15609412},{22207585,15283906,-10243632,11787053,-10977179,6675454,-18259478,14714754,20087226,-1279657},{1,0,0,0,0,0,0,0,0,0},{-11486018,11205545,29041799,-16697491,1904805,14886337,20928160,-13372194,256781,3699698}},
+        {{12998435,6043817,3459917,5124467,-24203788,-9789035,12981468,223890,3828348,13883397},{14346280,4468201,-22452797,1997381,-17520679,-13179673,-503865,-9311383,988446,-1178322},{1,0,0,0,0,0,0,0,0,0},{22814557,-6228431,18678747,-6687340,-8724822,-7506457,-22920291,3362660,-11232771,-10642985}},
+        {{20032313,-1117370,2250469,-12981864,33309124,12145968,-24083242,-15338562,5878523,9228471},{-14174500,8928632,9487034,-14150695,-1440626,-1099748,-13558168,1300063,-2827853,14893944},{1,0,0,0,0,0,0,0,0,0},{33051016,14826282,26455405,-11315886,29080889,15560730,24598238,4835931,2387324,10102643}},
+        {{-10047057,16667364,26438493,7774578,-15128330,10760955,9560579,-6703224,-20478382,8066219},{-18254565,-5178696,24367986,15586129,-1991598,5451353,5321120,6720180,-9297557,13675384},{1,0,0,0,0,0,0,0,0,0},{32335164,14841276,9563658,-8596174,19003621,-2475391,-29847077,-1090234,-15610350,9139224}},
+        {{-25740960,-10005299,14099275,-12429032,13842123,9064048,-6377444,4771657,-26266466,2584008},{22805506,7533268,17234149,-7262405,26926078,-16656787,-22700577,-11915412,-1567858,-1562795},{1,0,0,0,0,0,0,0,0,0},{31695298,7613486,-14900135,6406816,-30779961,16488076,18901351,354851,11606157,11530947}},
+        {{25329691,2497087,-21567738,-10022363,-694216,-10024062,-20898312,-2146042,26217762,13610847},{-8147816,1209339,19822714,-12927118,-15270219,-16273919,-14949314,-16005145,17764846,713282},{1,0,0,0,0,0,0,0,0,0},{-30774143,16626003,-15964835,-5133247,-15708868,-3180987,-4943755,4642171,-17084128,-16469877}},
+        {{-683857,15185106,-28902111,-13614286,-1494592,2010844,-16254884,8366770,-3280140,-11372448},{3542924,-930727,32608841,5322544,-2269193,12834395,30490427,6911657,202843,2660824},{1,0,0,0,0,0,0,0,0,0},{11194109,-6091564,8683201,-4453008,8409804,-15639079,2750559,14127048,2354718,-5275457}},
+        {{-28501433,11953246,10789111,15048133,13281824,-11475502,-31784494,-7459816,-14990113,-6064736},{-24628178,-16144815,-16643961,4060167,-10794797,-7204234,18154515,-2451005,-4001135,-12264263},{1,0,0,0,0,0,0,0,0,0},{31658113,-4983960,21846278,6941291,-31640754,-1283110,2091428,-11159328,8798016,-7351475}},
+        {{-8585123,2849029,10693332,9547093,29573097,13948000,3940003,-11971980,30504231,-4404297},{9069765,-9987184,5923468,3745407,8561389,7272570,20349466,3211730,3427379,-1059487},{1,0,0,0,0,0,0,0,0,0},{5970718,441328,-27377630,-5764859,-25222338,-8233660,8965124,8263808,2965374,182198}},
+        {{13238575,-2950752,29185408,3272536,19307902,-5356166,-27279535,-8560381,27530718,14449509},{981725,-7712179,-22607731,14353596,11976865,-9099893,15947115,11165365,7639094,-12191864},{1,0,0,0,0,0,0,0,0,0},{-8243846,-13167374,-24805367,13394169,-31249826,7763022,-27593216,-7532949,-20476180,11245131}},
+        {{-5100442,13479499,9122259,1547653,-5846267,-7484366,-1228472,15952760,27114417,8579053},{-24293645,12490813,12565003,8263593,-13299071,-2454852,19003095,-11289545,-7623927,2290359},{1,0,0,0,0,0,0,0,0,0},{18543968,-10001746,-19061594,-3736392,27455329,-11322460,17051844,5835103,32663919,16768571}},
+        {{-569086,6662892,-28343785,1600517,17254645,5548219,-11081132,-9986778,19017110,54036},{23458388,13804694,-21774952,-331439,27317685,15094622,1045351,-7577200,-21352359,12672969},{1,0,0,0,0,0,0,0,0,0},{-2048020,-5888492,17446915,14478091,-28422391,-2153118,21553878,14414540,7887674,-10374944}},
+        {{11195769,2669418,492105,-1583454,31189553,8976569,-3255553,-16705075,16859072,4044198},{20580064,-2078321,-23030190,7595992,-9084757,-1763040,-25969216,12788869,-25385329,-267456},{1,0,0,0,0,0,0,0,0,0},{-4430412,-5727972,-18774784,8980705,-29548178,-12674239,19911466,-2552651,32570582,-11606726}},
+        {{-33469767,15884507,-2561557,8354151,-19980090,-14984804,21992255,3272341,22087643,8311711},{-16704859,6687777,-13925479,10408276,15134408,-7915501,-31021040,4523775,24196922,12743099},{1,0,0,0,0,0,0,0,0,0},{14718435,-837124,-16651595,2459524,17403255,1859593,24153602,-13624973,-4265710,625307}},
+        {{-23498887,1001887,11885182,6875608,-23401452,16029168,8961664,-14551603,-23220046,-3345923},{89628,4940527,14739241,-4234961,-11659736,-13644051,-26861289,-13895546,-9940785,12124932},{1,0,0,0,0,0,0,0,0,0},{6363488,-9903272,7824655,-16473723,-6142942,623606,-13426697,4995998,2192021,15512257}},
+        {{-14750292,14551468,-17760129,1218179,-8386015,-13483806,6313225,14363257,-4677830,9587867},{23893101,-16251960,14793004,4828186,32571809,6504843,-19463910,-3749832,-13171221,476457},{1,0,0,0,0,0,0,0,0,0},{19474004,11631324,-20592082,821540,10354700,5379249,8695498,-6815932,-8351164,13767232}},
+        {{-22775104,-1971883,21373217,14752377,12816416,760470,-4503989,16351451,-21532453,4631332},{-18728572,9748621,-14017756,4963273,18847196,-5954984,16322591,-9832763,17179123,-13509288},{1,0,0,0,0,0,0,0,0,0},{30483770,684791,-12933151,-9217485,-10662514,13775063,103314,718671,-21719696,589121}},
+        {{4348852,10097692,-25717311,-521362,25031140,-9309440,3515454,-7831988,28526875,8577400},{-22534264,-6577514,-30768001,2604770,-22102965,-7544279,-23486596,15074377,27431372,14744545},{1,0,0,0,0,0,0,0,0,0},{-11147261,6591703,-9626748,8802340,436033,13323701,24717905,-11568618,22615102,-15752820}},
+        {{-9945233,1973055,3961656,-13280619,-24825656,16018006,27323970,-13000762,-13377682,8159338},{4799257,-2820165,-14075758,-6714848,-2011214,-2029027,-1305720,-14463553,-625803,-12127877},{1,0,0,0,0,0,0,0,0,0},{7026869,-14588461,28589984,4123477,25077880,16488260,-20018199,-7939928,-14831106,15022271}},
+        {{-17308628,1073143,919292,-10165708,16907826,-5459018,4763302,7533478,-20694758,-6805128},{7328722,-6833060,1152743,-9400432,-25903515,-15367131,10864536,4144578,-18914956,15728975},{1,0,0,0,0,0,0,0,0,0},{-30424621,-7850781,-4202400,-5641809,-24035336,7993477,28681195,-577022,-12176024,-9443283}},
+        {{-14334909,9828981,4334398,3420377,18068268,1870182,-7056968,6935444,19957979,-5029342},{12202919,4224159,28370480,8168785,-29247967,15877466,-5904652,10263668,5831825,-5782392},{1,0,0,0,0,0,0,0,0,0},{-18485683,10610641,15471068,-15402028,-3637344,-14579708,5728049,2758433,-18449485,-13293424}},
+        {{17669786,15009157,12375425,4605265,16087636,13797051,3810216,2044735,-23598180,14365246},{18541175,-9834562,-2791248,-12018587,29457149,6185892,-10269907,12872615,-15222816,15888965},{1,0,0,0,0,0,0,0,0,0},{-15431630,1175297,-31884079,-10541470,21354651,15813707,22463733,2773492,-18545654,14249671}},
+        {{3491653,14268461,-4483089,3337612,21313336,6431637,14253704,-1933933,-32047849,13210108},{29698217,-803218,-6040506,-62853,-8106224,9911519,19327435,4496571,30383105,-802662},{1,0,0,0,0,0,0,0,0,0},{32747777,3434524,-27673190,-3905718,5511004,1654040,-26674587,7215512,-3016579,-5266858}},
+        {{32780327,-14262619,14965000,-6924474,-3932386,-7501408,-15096980,4937825,-31740881,15361989},{-21802914,-15345333,-18452584,13343411,26215101,1637500,20806766,-14532561,14353289,449857},{1,0,0,0,0,0,0,0,0,0},{-31591727,-2104866,-4875077,-7638704,-873277,-16595233,-16399811,14538992,19365021,8373981}},
+        {{1288600,12537511,5311410,-8598774,-25411357,-14439905,25585905,-9239906,-21248513,10826120},{11065495,11077439,-29372625,-14901302,21560569,-11754851,-3768788,-3590853,30709083,-8786059},{1,0,0,0,0,0,0,0,0,0},{9964493,-13516343,24262954,12023835,-1806203,3995371,27394973,-7578601,-20394941,10698164}},
+        {{-29403629,-10480250,-14699408,15085621,-23593581,-15699166,13701317,-14633737,7245380,16709477},{-715728,13515296,7803733,15005842,-26795127,1519360,-9105,4669280,10430350,-1840763},{1,0,0,0,0,0,0,0,0,0},{-33418719,13014840,-15207333,11446818,-16486847,-4061734,30516756,-8077284,19256574,6625711}},
+        {{9254771,-4849150,13524115,-2077215,1400736,-5366353,9288591,5177010,-3243874,11973124},{-32414669,-13390128,-2524769,-12985003,-17650496,9136175,32519322,9623956,16010673,-5241411},{1,0,0,0,0,0,0,0,0,0},{32609089,-14612225,-17040368,-1804997,20520611,7663526,28304787,-7209780,-14026373,389490}},
+        {{884876,-10514625,30593739,9509570,5198917,-1436320,-5665189,-5483008,13271386,1924409},{11626370,1181889,21749249,-14104546,-23424282,477514,-5215043,-11930472,16278174,1761208},{1,0,0,0,0,0,0,0,0,0},{-16344193,-8996438,-21472945,-10420543,14703162,15962422,-33043403,-13204473,30019410,3267394}},
+        {{-8970751,-3072998,-6627071,-1480479,15442434,14229478,13091263,12300921,9827676,-13586850},{-24310832,8192183,-22759014,-15337280,-19477253,-11124889,10392568,9274851,24742046,-10519012},{1,0,0,0,0,0,0,0,0,0},{-24665716,-15983399,-933820,-9705885,27390349,-16511203,31286955,-2625959,-14897211,7643684}},
+        {{-15148736,8928051,-24136601,-14629791,-32934618,10229751,12759943,-4684457,-23822458,3146966},{-32529430,11999933,14379918,14731015,-11856096,6023791,-15952585,15421958,-18644445,-11169643},{1,0,0,0,0,0,0,0,0,0},{-24772934,2783019,24402628,3885583,-15480045,-10485155,-6922325,6262457,-9629353,6547075}},
+        {{20832698,13317361,-21326902,2220979,2170089,-6798876,25205737,414073,-12808456,-4887453},{11664078,6467666,31444556,4348858,30931666,-5680180,16794756,8899912,-19326593,4559884},{1,0,0,0,0,0,0,0,0,0},{-22305033,-14855170,-25587933,-10669683,4225369,14419806,-11465164,4581045,24813936,7223400}},
+        {{-16639949,12761067,-10984984,-12874097,-3636664,-3497508,-6391048,-4566983,-31229957,-16108220},{21605676,5873864,17690889,-4890178,-15003645,12168204,-21218666,13008459,24683631,3101223},{1,0,0,0,0,0,0,0,0,0},{18532360,16327356,20017594,-13054205,31985611,5117607,-13997476,-12300021,-24468037,6014260}},
+        {{2476618,-10825857,21996200,8481658,-23882656,-14045608,7846831,391191,-22259636,367291},{-11924235,-12318173,141935,1089748,-13933720,1101881,-26461393,-9401788,-6159629,-8466283},{1,0,0,0,0,0,0,0,0,0},{6338836,7420436,-30912909,3946911,-10004805,-6547817,19918585,-14536184,-4318003,-6007491}},
+        {{-4473292,14346157,1378169,-785574,2618275,-3389794,18215149,8463938,22393369,1250836},{-7949587,10423376,-13710,-10940460,-22126350,8445320,-23005776,-121480,25616586,-11540470},{1,0,0,0,0,0,0,0,0,0},{1768146,16443045,31088603,-4672178,13624053,12008817,23560535,3312284,-6499491,-6062781}},
+        {{4340369,-8610936,20769057,4901035,-4805135,-14966845,-8345228,8725024,-6650035,1507529},{243915,-1939237,28434717,-3761175,-5302845,6626372,17527185,-13842510,27446099,769343},{1,0,0,0,0,0,0,0,0,0},{-4028474,1548487,-8165550,-13772413,3037365,-15010867,-11580632,8228762,-7789173,11774993}},
+        {{15849202,14518055,17398631,12695868,19586614,-8167499,30369513,6881347,6076499,5451319},{9409824,15660131,9693605,9749737,-32805120,-8221214,-13265557,-8992370,-4738851,6774674},{1,0,0,0,0,0,0,0,0,0},{-31376030,9755799,33113053,-7783100,23781171,4731805,22989923,14175797,21665618,9676721}},
+        {{-23627308,15077593,-30396542,-14403342,-3906693,15243670,-13241680,-8133673,-29855023,-4543628},{-1424576,-8853718,8738542,5667092,9214166,11515184,-19327638,9804199,-10881296,-2767023},{1,0,0,0,0,0,0,0,0,0},{29172077,7394770,-3324471,4759451,25886583,-12171010,-14748647,-16243952,8632897,2841827}},
+        {{-1987864,9770232,27403748,6767238,8528081,6568852,1659484,-1165816,8131571,10046099},{20413577,7116681,-20388878,-4289198,19452193,8399795,-27589424,13691910,7869955,-8291993},{1,0,0,0,0,0,0,0,0,0},{7408611,4692293,-14051465,-9167892,-503600,-2895761,22607939,9956488,-11976355,-15417116}},
+        {{-21603160,-16236949,29265063,-11743756,-4200261,10503405,4372227,6003459,-28624795,-6068395},{-14078390,-8931258,-22198220,-4073624,18611754,-14787318,-907624,15418341,-28942871,5320938},{1,0,0,0,0,0,0,0,0,0},{10781135,-12943540,-19031821,14873864,-12350667,-11753434,28835359,16514517,-19266237,13169619}},
+        {{-29705034,-13678315,-24770937,-9119835,-7481529,10400508,12652852,-13989405,3905663,-2098616},{22350323,7689210,28817443,8413768,19853474,5035364,10055898,11882713,10852499,-14156168},{1,0,0,0,0,0,0,0,0,0},{13180827,-6360093,6316763,-12291197,23665642,11533760,27349815,-9717753,-2828528,11171227}},
+        {{12358432,8231329,27949304,-8269832,-19355284,-6137279,2539857,8223450,-14808016,-607596},{-8615503,-14586860,-16519793,7151370,29745816,14698740,2257300,3174658,22472877,-5581920},{1,0,0,0,0,0,0,0,0,0},{-10716510,12051665,-2830922,-2560831,23789745,-7665067,-22460872,-705083,4156794,-9393861}},
+        {{20054836,-8260862,-1691807,-6518887,-13491735,9438906,30870118,14611799,-361132,-9341933},{25419633,4597796,25323813,-15634610,25136824,-4944835,-12692587,1510289,-30723526,-14845670},{1,0,0,0,0,0,0,0,0,0},{-18824152,8774555,19938711,13342075,-31158691,5409329,-24416093,-3479840,-23815139,12944177}},
+        {{-3491712,734025,11777255,6604804,-25182231,-10502087,-8060990,5412431,-27989693,-14544750},{26369233,8090598,-32434802,10798446,13368920,14303709,-21531097,1985892,9063560,-2799246},{1,0,0,0,0,0,0,0,0,0},{3832153,6514695,-20459840,-852280,-24126472,2118214,-30642405,15106233,17309838,10563392}},
+        {{4520260,2528354,-14902593,-1853308,22859528,-2296593,-5471111,1548029,-21836792,-2669667},{-4504337,5868828,-4105480,-7506211,4458157,-4316978,31593482,5339658,-28926505,7524910},{1,0,0,0,0,0,0,0,0,0},{21891038,6597211,19016035,-8271939,-31307400,-16228458,-1916953,-8648272,13346696,1329196}},
+        {{23600388,4468190,19362596,-13992495,14204308,-13198520,5069963,-14975146,-10308589,-4707036},{15803949,10189212,29874495,-3364510,8241892,5065597,-19607615,5720261,-11543321,14157087},{1,0,0,0,0,0,0,0,0,0},{31369479,-13483185,7497453,-6985484,-27163691,-12079094,-19301562,2397733,-25078603,15448269}},
+        {{10234435,-10984615,15295829,-16443950,-9747032,4418254,19674738,-7142537,18939757,6755465},{-32083317,-3406694,3387237,13501852,-7777560,8828185,13102542,13094123,16884548,2567770},{1,0,0,0,0,0,0,0,0,0},{-21636712,-9867712,18426756,-16577535,32278671,14102997,-8035629,-14496061,29983440,2517011}},
+        {{11224369,-7310173,-13391257,-15719789,20452087,-4088745,5002806,10103488,-27926316,11293015},{-18946920,5863589,7616394,15231395,28036794,12343366,31444428,-455896,19281142,6468886},{1,0,0,0,0,0,0,0,0,0},{-20019298,3949100,-17271049,7578048,-30131170,4607465,-6181461,6768776,10911396,14948472}},
+        {{-18974673,-8533466,-20205804,-10393175,-5283746,10216376,-14852207,-2659083,-15119623,14005851},{-18736677,12808192,17042110,1170295,20826129,-9129775,-12695153,-14899492,7849328,-5066911},{1,0,0,0,0,0,0,0,0,0},{-24369332,12375029,-10357757,-5359038,-2769383,-12675751,-11618090,1727904,-28328151,2879820}},
+        {{-27154810,14851551,-3379992,-15548442,1468686,-14589632,-18510651,9333912,9085813,7984743},{24221885,-3775920,5610661,13900873,-29494949,-14190623,-25210748,-11826920,26898042,-9625629},{1,0,0,0,0,0,0,0,0,0},{2342041,-14164973,5594,-364483,29850569,-5609317,-25734856,705737,29447515,-10589151}},
+        {{-1598745,-1390898,-14735210,1120706,-32330315,-14505535,-1426047,-15999901,-23847237,4160015},{26372766,-3172408,1472920,-8928799,-25515418,-10174904,-31497806,-16295274,-31131690,-13285156},{1,0,0,0,0,0,0,0,0,0},{-18394943,9637549,-4315897,13521954,28464603,-6766895,24534418,-10711722,19913924,16534224}},
+        {{-13060631,8685677,26429859,-2160229,-6182236,1013500,1762057,1644590,20262011,15145371},{5522892,-314424,-23999856,-8723179,911510,10740617,7855944,6169213,-1910825,405990},{1,0,0,0,0,0,0,0,0,0},{31874656,6898650,-15484024,-13690874,9563988,-15705989,-9027619,-7358447,-21003324,3960927}},
+        {{2436794,8099141,-28641108,-12043805,-32245841,16138346,32513219,-3858353,-18294905,-14099763},{-17832624,11733841,12489190,-12913402,-20841778,-14915811,-30223506,-147374,-16729076,-7239008},{1,0,0,0,0,0,0,0,0,0},{23554704,2079425,27713460,12717196,-30660983,3082747,23122576,11852460,-5642288,11334418}},
+        {{1973784,-3492231,-6567512,11862917,-831469,10256641,21248667,-14854664,-4055787,-12542153},{9024371,5538970,-21998881,7154632,-6447068,9827430,21612857,4004700,-14041370,14235146},{1,0,0,0,0,0,0,0,0,0},{9199687,7127684,25111579,6110155,9182889,523782,-29366959,-15478585,9876154,6398833}},
+        {{-29125213,9044322,-31466322,6733766,29229682,-3582093,5366581,16125066,20378669,-15962713},{-3527768,5079446,-21145636,10906935,-17270107,-4463911,-25192466,-15057125,13179753,-1755484},{1,0,0,0,0,0,0,0,0,0},{27032456,10665542,10623655,16241883,9219028,6841109,26044590,6914660,12890546,13634803}},
+        {{-16175260,12437987,-23809332,16179913,-9830802,14864693,29957487,8822455,-26491215,559360},{2726713,8560485,-14304230,-15170142,24048938,10160999,-6267557,11019996,19935900,-3883642},{1,0,0,0,0,0,0,0,0,0},{21287770,9810473,20843964,-8002535,-28469345,4122213,-5880581,6354879,5764199,-15895470}},
+        {{32489071,13089233,31129062,-16651016,-9472424,9309240,12274610,3764760,10973306,-14609},{4744970,13423571,12280008,-9031898,28414740,14423911,-20003076,-3147243,31501972,-16649171},{1,0,0,0,0,0,0,0,0,0},{18939887,15406095,-33293512,-12162324,13735659,6724625,-25390338,13227994,-19774655,-14216081}},
+        {{-28713472,-591979,-32204962,-12456697,2870839,-5727395,23154039,-4291728,-7886009,8360436},{-30610730,-5250537,-31912052,14762225,-12436867,3894829,-16831586,-873662,23748842,-13221332},{1,0,0,0,0,0,0,0,0,0},{1086016,11285738,15468236,4402646,-23648936,-5950309,23015575,6252501,-825293,3836282}},
+        {{21598914,-12558696,15935975,16374007,-21616898,5694778,-2967684,-601012,-7064408,2905096},{11759069,2942276,14310403,800291,23241689,11123416,-885129,13609432,14392737,-4954972},{1,0,0,0,0,0,0,0,0,0},{-33537590,-4594307,28806362,-8477793,3618754,13747702,5805361,-351103,-12013600,6777559}},
+        {{-3451491,3732240,18044003,8768834,-6240293,-14480190,30434902,-3304070,3567261,6131587},{-31551334,11901912,-30085038,11583522,-25259309,-1163422,3966719,-11478794,26163566,3910502},{1,0,0,0,0,0,0,0,0,0},{-3506378,275870,21823069,-8156268,-31722739,-9094528,10169666,-5041319,-23257917,15768721}},
+        {{22167849,13768495,22335781,13277473,-29483871,15925407,-31324480,1028435,-7219214,16382337},{9651934,9379950,-26921066,-16693593,16121528,-15912521,15192627,-6938791,20551689,-3004479},{1,0,0,0,0,0,0,0,0,0},{24155731,4117997,-2489503,4662262,-8164563,-9535507,844052,-6271333,-10594565,-267271}},
+        {{-18449196,-252835,-30302778,-3652737,9643620,6161942,-25852523,-3613942,31244813,5749805},{12786192,-3133790,-11490364,12898744,8407471,104327,9858309,12434023,-23267712,297962},{1,0,0,0,0,0,0,0,0,0},{6535218,7559248,-10043421,2774859,28031232,-14104356,11703553,-16130215,5499852,-3693324}},
+        {{19094079,-8237478,8596459,-11391550,30408477,2920172,5990224,10649650,32770616,-10668561},{-16601135,-10634758,16717472,-13524190,31955193,-9274994,-2970384,-15717236,-30809253,14576644},{1,0,0,0,0,0,0,0,0,0},{-28978488,-3783256,31287090,6337317,30291375,-1425704,-23409750,8522063,32753638,11851604}},
+        {{17553956,-6692528,25247535,-7150961,27192340,-11033183,19069619,-3233296,5193902,-4905161},{23906710,10762776,30978104,-15733557,-22321399,9844649,4204661,1890857,-23544683,10481101},{1,0,0,0,0,0,0,0,0,0},{11126269,-3280768,-19385951,2814905,12496483,3802311,-27097248,-8348943,17827174,-6281214}},
+        {{-24209242,-4037174,-16744330,13954153,-31000335,13894483,12387463,-2275381,-2993782,-12661323},{32497943,15331170,20393505,980470,23064972,16393564,-13732055,14085369,31683116,-506858},{1,0,0,0,0,0,0,0,0,0},{-10787041,-11623891,3446146,383220,20028878,-3011279,32705185,15175601,-8040461,-5781958}},
+        {{-17548057,-3125870,15283449,-7382969,17455540,6728466,-28954035,-12208393,-28546526,7678729},{6998171,2674039,16244979,14087576,-31332427,16468842,20733951,16547710,-9845817,-15847722},{1,0,0,0,0,0,0,0,0,0},{27355558,-14873287,-18672161,-6143873,-31074176,2361220,12013708,8420758,-11459896,-12615017}},
+        {{-18739809,4935282,23376496,-4706266,-16411188,-3074791,11511952,2701905,5232565,4944353},{-8470926,4573073,-26468042,-12712006,-24453978,-6886348,-6020350,-1538270,17647173,15928172},{1,0,0,0,0,0,0,0,0,0},{13659530,896952,28467915,-11312168,-17213895,512037,21675597,-8361775,-11031354,2650594}},
+        {{-23439146,14831892,32849639,13277753,28908525,-3777883,-6372517,15677051,26634038,9191816},{-21386814,9807732,-4614992,14601915,-27117398,15743809,31481218,-12315589,11584590,-7310134},{1,0,0,0,0,0,0,0,0,0},{-32911224,-11622316,16698674,-7125190,-318868,-9887445,33193349,-9540566,5725647,-12768561}},
+        {{-466902,13050883,-25066383,-14591980,28439369,16739594,7775659,4950324,3475205,-8110241},{26292996,-8499554,-4006605,-2229591,-30613825,-12019931,-4507278,-8781208,-19509707,-6996421},{1,0,0,0,0,0,0,0,0,0},{-173851,4953879,7034940,-12745033,-15398265,-14326584,-26339851,11699147,-1100577,-5015666}},
+        {{2974768,-13003526,21441920,5567185,18030603,10888317,497952,-12399810,-30249244,6035808},{6912360,2170498,-22356880,9200737,31196299,-5879689,27978817,-227173,-3998311,-14076590},{1,0,0,0,0,0,0,0,0,0},{5175129,4999836,-621388,2236715,19535977,6249309,-1583119,-5364498,24453472,-2661217}},
+        {{25147908,-442034,5620659,6166450,13389824,6986858,29197577,-12816868,32992345,-16663699},{-4251563,12389601,-32163139,6760938,-25044093,-7696251,-20597779,-5559128,18002587,-14009128},{1,0,0,0,0,0,0,0,0,0},{-24727878,13164758,6295381,4433205,-7970359,2089650,32734522,2133694,11346562,2177646}},
+        {{-8265626,4967850,-6133291,5260156,-24666352,-680607,-26203691,9556389,7049842,14202020},{-26950868,2501059,20123082,-11850758,-30161643,-16574707,-7347213,-409336,-11660802,4518481},{1,0,0,0,0,0,0,0,0,0},{-21149747,-11629233,-1035213,2489350,-4601249,4777365,-13696787,-16114321,-21317927,-12871690}},
+        {{-9142551,-11931273,3854497,13146317,16150510,12224642,3308185,-9595697,-507838,-13401521},{10501196,-10339152,22570758,-14426033,24760308,-2592388,19619078,-3272843,23560063,-4330314},{1,0,0,0,0,0,0,0,0,0},{14213922,-2796257,10923646,10111304,-13711379,10508737,-19306761,-3836739,-1071647,6488786}},
+        {{-19861547,-2254237,4211545,-15428855,-9706272,-4138876,-3272711,8874960,10655513,10002303},{-3577996,-16291987,-25765937,7054071,-10782003,8261465,20697752,3662582,2408650,-5941633},{1,0,0,0,0,0,0,0,0,0},{-31651000,15618159,20301407,-8269645,-11829444,-5752312,31033900,6293464,11134177,4992186}},
+        {{30353733,14783400,23712890,-12813392,-26591484,4774068,-26927454,11444565,-20115640,12649797},{8752621,1634205,-12885906,8496103,32241917,-2824961,4666813,9949737,12419770,8483877},{1,0,0,0,0,0,0,0,0,0},{9455105,9766402,-15689532,16662736,-21495105,11828462,23048948,1973110,-29366574,10575982}},
+        {{3459465,-6371795,16559272,15944316,12364716,12634196,17995543,-8996874,-15208088,8705583},{-26598292,-12569530,30611144,16609301,17809389,768711,17430656,-6880766,-3783605,-8564186},{1,0,0,0,0,0,0,0,0,0},{23777717,-7036448,19900221,-16481600,15769966,8020419,-3444476,7292462,21542588,-3542952}},
+        {{-29215839,8846814,-9330868,-2314086,18263915,-11061730,28232195,-8957004,-5819225,4928202},{-78937,-16179350,18821876,6233132,27480560,-797856,-27244255,-2628380,20088393,-7221600},{1,0,0,0,0,0,0,0,0,0},{-10379577,-15103036,-14606598,-3156566,6434048,-13684432,-21542660,-4963926,-12687307,-2956156}},
+        {{4933637,-11157109,-26065428,-15595286,-32374220,11405233,4777438,-3824541,22565996,-10918850},{13895733,-2029328,-11971172,13176398,20027922,-5461390,29954430,2695101,30129798,1208684},{1,0,0,0,0,0,0,0,0,0},{10247275,240881,-31549234,10937583,-110404,-1742919,-32052577,-1200616,33387757,5976147}},
+        {{-28358907,15090391,20125111,4047379,26754127,-9734387,-813776,9824374,-32804206,-2184504},{1783355,13993119,-27527490,-11247028,-9170420,3025620,-25943517,11894433,18316783,-360152},{1,0,0,0,0,0,0,0,0,0},{-9863305,2193870,24611404,-6980300,-7958209,-1503683,2414327,-15551298,7417153,16071321}},
+        {{-5163951,-8487959,8077153,2606673,-29709742,-11246701,-24439052,-14253738,-13641630,9624712},{-9848080,7108452,1838653,-7224592,-7720544,-11389794,3660281,-13321939,20580403,-6481482},{1,0,0,0,0,0,0,0,0,0},{16252905,-7469649,-304314,-9805473,-14846695,1229873,-26237588,-7254243,-32476546,4746981}},
+        {{4998716,1570348,5789794,-13552859,-32664476,12762982,-5667088,15108317,-16087740,4874036},{-20204209,-2803320,-32832590,-12666465,19111904,-11159628,-15425282,-14561541,25055297,3011443},{1,0,0,0,0,0,0,0,0,0},{484600,-9290167,-11459399,-9928774,-2830962,313574,31583337,-16327021,-10370980,-13452293}},
+        {{3995527,2505025,-22250704,14131475,-12504644,-14926903,31459182,14748454,21116002,-16483255},{13949609,5774059,-19371302,8879758,-26303562,1939785,-23531272,8628632,-22586642,-6127181},{1,0,0,0,0,0,0,0,0,0},{820205,-10772299,8117263,-129075,-26316029,-13871208,4418349,16293447,11928895,9026369}},
+        {{4225805,-5833736,12732425,9531005,5831395,-15527758,-17698430,-12768090,-275132,5397153},{-7731350,16249877,4916733,-5635820,1701848,2412173,-127339,1045189,-28179030,3914409},{1,0,0,0,0,0,0,0,0,0},{-29367000,-663473,1508554,8061727,32554522,10530275,-26032068,-8519348,-29696755,3611293}},
+        {{-13371510,-12210214,26576137,1970367,-17031692,-4878173,17661065,1398832,-16278960,-12614556},{1150114,-9453258,-21111110,36734,-5722448,-1317209,18188523,-11279047,4276963,6922561},{1,0,0,0,0,0,0,0,0,0},{22086617,9582763,5680921,4806959,14929447,7654289,-8053758,7130743,-30421377,-5504866}},
+        {{-4823923,10350555,-23618793,-4245433,1625165,-1462169,-23233109,12270202,933713,-15509483},{-7277503,6190822,16572620,11500914,-8569050,-13585229,-11359565,-11009399,20780041,-4378759},{1,0,0,0,0,0,0,0,0,0},{-33124047,-13730785,8940745,-15641298,32185832,16476122,-17517854,9993092,32683116,7837848}},
+        {{-9378577,11794831,18532931,-2442662,-32310826,-10544568,-15093414,4138439,-11439746,-7469984},{29686300,-1392335,-6993640,-6662458,-15055343,2286222,3387381,11514713,33520121,7702270},{1,0,0,0,0,0,0,0,0,0},{-564986,11868933,1167215,8053197,-25650075,1736315,-13023721,-1808747,-18668633,-13842001}},
+        {{6902306,3882298,-26056377,14367932,24452616,146510,28388228,15872480,8285691,1390119},{10333943,-15574547,5702622,-3601376,-11118340,11792534,-21911420,6283914,14092221,-1167687},{1,0,0,0,0,0,0,0,0,0},{-7051559,-11933570,3779782,6305762,-23855626,-1778566,-28159138,-15973216,-7281362,-15804779}},
+        {{-24872986,-333002,-5322468,-9155688,-18140202,-7568284,-17418694,8019001,27086603,-7988784},{22617756,2894980,-24094447,-4464251,-14315948,-999932,-17534803,-15021875,3288269,-16318319},{1,0,0,0,0,0,0,0,0,0},{5142264,6310217,6674185,-16017007,19148916,-10603068,16862383,-12686278,-3919222,16355214}},
+        {{28102508,-7125814,13604323,-5471297,9223122,-11145654,8766693,-3544420,-5370212,1417271},{-7721040,7161359,26886876,4802244,-24158663,-13669116,-2529353,-3928701,-7543507,-14835371},{1,0,0,0,0,0,0,0,0,0},{-19206243,2452969,16177583,-7153313,31103541,8921849,-17736392,3093250,-7766325,-6364052}},
+        {{27473104,10298823,-14568535,-8713543,15363827,14026416,-9788618,584915,7280607,-15445983},{-22285696,12498302,25202092,-8088446,11210223,4032479,7554670,15479579,-16702913,5618626},{1,0,0,0,0,0,0,0,0,0},{30821354,-8597777,8422233,-15170363,27072555,4800101,-13528480,11633043,-4176593,14470314}},
+        {{-11909292,10070722,12761654,10785391,-25811242,2691901,-4300453,15244362,-26128288,362776},{21533798,5736611,-21775069,-13977144,14994271,4314821,26413382,-15857030,10634837,539387},{1,0,0,0,0,0,0,0,0,0},{-11045287,-7437726,-3537209,13691740,-7516210,4495179,7384145,-11692125,25638616,-8232215}},
+        {{-19775641,-10094680,-7846719,1912132,-27514774,-2777094,-13076162,-4045767,-25060961,852171},{-21727452,-16766854,30276162,-11951595,18563582,-5162681,2168168,-14780340,-22766900,1547989},{1,0,0,0,0,0,0,0,0,0},{10046624,-8747068,16994262,13750495,28397592,16524991,-7457327,-7597052,32096297,-13080005}},
+        {{-29692576,-14951397,-20867351,-15242524,-15990743,-13540678,-1169884,134913,16020802,13885506},{6054152,-10426285,-13416810,-5103935,18330632,-8315477,-9249205,-8643267,31003176,257481},{1,0,0,0,0,0,0,0,0,0},{-29946741,-3619318,2173704,-5866982,14319544,-16182060,28198198,-12082011,12409982,7147509}},
+        {{32211647,16433847,3101739,12982657,9792959,-12059693,-29946848,3778321,-25571776,-12544615},{26583560,-15916405,-17040940,2948426,-32213950,380919,-28140654,-469031,-20675651,-12488807},{1,0,0,0,0,0,0,0,0,0},{-7306190,-12374425,-4091359,4184157,16610235,-13148415,-2372931,1277542,22878386,-5789924}},
+        {{-24167505,3189775,153172,-3940899,3928984,9120878,-29145528,-13684256,14933497,15313649},{31315304,-9450273,33007306,-14305406,23946002,-13884177,23741844,8318541,-12487210,-6140521},{1,0,0,0,0,0,0,0,0,0},{29499485,3547884,-20347526,-11351109,8874735,2012815,-10003620,1621507,-3846646,-12401853}},
+        {{-21963540,-8123133,32805444,9982908,17155961,16351535,28423440,-14363904,23043844,6446321},{32939545,5619645,9012467,6644718,21450719,11783376,10069330,8474963,32112425,4407290},{1,0,0,0,0,0,0,0,0,0},{-32024014,-4853596,-31067920,-1807568,15289061,-8390386,-4263563,-5904595,25294150,9304303}},
+        {{26455692,891112,24234273,4020501,14346210,-10135344,-10555824,2041543,3092398,-613699},{7631159,7947077,-25697989,-3039133,19976418,-16322403,-33506455,-7610746,-29070861,7363851},{1,0,0,0,0,0,0,0,0,0},{4975514,-13233013,-15555129,8339611,10172360,-896577,-33387951,14664801,716566,8376597}},
+        {{-32954752,7558504,-20281130,-12168031,-14026330,2127320,-18852948,15019925,-2264991,-6446602},{14423243,-5888279,15630232,-14242255,-21688186,1871274,-13439136,-10304513,-6627031,9149758},{1,0,0,0,0,0,0,0,0,0},{6231205,-7535585,-18220714,-2006907,20014937,-14175349,-3548727,-10164288,-31395476,-8058490}},
+        {{-4429568,-11493151,-11742269,5819653,-8427601,2062320,3166601,12337081,9193411,-472925},{-8788688,10614108,-11175275,-11174329,-15690124,16726736,-14038325,-13127712,22810587,-12453425},{1,0,0,0,0,0,0,0,0,0},{-11737939,-12552903,27765095,7938397,-13854718,4179665,-27059648,5961054,-29988604,10735436}},
+        {{28204783,6769245,25165598,10907646,-19721851,5899969,7289647,-9872868,29060310,-2869978},{-19010284,4937107,29950375,-11924663,843397,-16279248,-4111038,4957494,14002675,-3616537},{1,0,0,0,0,0,0,0,0,0},{-31966061,10756883,6546901,16249162,8422264,3729843,11489152,7263316,-10539729,-5754616}},
+        {{6272992,10367647,25923764,8035575,-2218930,-3682909,11102284,14321771,23424182,15710099},{23180771,7714455,22217985,11427874,-33222304,-8742308,-13443830,2150738,-16614467,16744228},{1,0,0,0,0,0,0,0,0,0},{4970861,-7676741,-22419095,-14468727,17003367,-5911800,-28936445,-5682183,-1086470,-4192798}},
+        {{-26546782,-2471001,-16554829,7761982,-7488905,-3164315,-24507030,-11466902,31096107,-8325632},{-5445388,-8812539,33186955,-5959311,-6825251,-8477024,-13284640,11033804,2470752,-4940716},{1,0,0,0,0,0,0,0,0,0},{-11352897,-10262913,-23105597,-873621,-552581,9753370,5066663,-11715346,22267330,-11100101}},
+        {{4127927,-9165405,11026275,14267426,-4026060,225029,12126661,5093901,-10084639,15120746},{-11624301,-10928432,15148445,-16766441,-12938105,-12181805,31440657,-15009611,-21805185,-9681831},{1,0,0,0,0,0,0,0,0,0},{24678711,-2078076,-28770315,-4573906,-16011388,-7029493,15649104,-8699636,10413395,-14070165}},
+        {{7864629,-15959791,-15843092,8185119,-31064781,1273514,24419118,9473314,-14992003,10946673},{16922598,1472603,-28007770,1400036,28521114,4099592,15202529,12720123,14743776,-14527320},{1,0,0,0,0,0,0,0,0,0},{-28962309,-10318489,21759618,-3023867,6244077,-14989267,30487478,2261017,23308861,-16649898}},
+        {{17586616,-12362565,-27950448,-8781638,6450240,-9258760,15291111,-3881367,17546347,2033580},{-13327030,-10452678,10211055,8240116,20474076,-13751739,-7883482,14822094,3491367,-8319983},{1,0,0,0,0,0,0,0,0,0},{57887,2910923,13820647,-15668332,29160484,7570312,10994101,1251442,6108346,12142131}},
+        {{1481474,3554421,30895078,11653441,18243345,-13171875,-32680391,8575972,8706381,-12543258},{-16795290,13335446,-12056696,-5839002,-25273478,14099384,-19143507,-3360742,4853575,2087855},{1,0,0,0,0,0,0,0,0,0},{8128536,3062269,-252058,-6846859,17571255,-7795845,-12405949,3759454,-13123070,-1118932}},
+        {{13220061,2754116,-23585765,-14910087,-892419,14643993,-4365425,-6401701,1244231,3892850},{-29139996,-2534691,26734730,14375429,-13044873,-6882398,13391593,1896154,-31692682,-8763404},{1,0,0,0,0,0,0,0,0,0},{-22576397,-2175051,-10635950,-8321865,4252116,14799244,-30907729,-11173410,-23971802,-14415111}},
+        {{-2306629,14247912,-7583884,10744105,-29613083,10814088,-1346176,-3706377,-1107631,1304654},{-7528043,13808126,26118119,848240,-30164000,645152,10822241,5820648,-10503628,15645376},{1,0,0,0,0,0,0,0,0,0},{-14606054,10370171,17636941,926303,-1514789,-8615815,26134434,-7995936,10358714,-10729456}},
+        {{-31856115,-2427441,33224866,3056929,-31770856,-15900945,11190356,3464036,12930708,14174072},{3709476,5374618,-5067115,15391627,-10674490,14802231,-21078163,-3208096,25803112,-9404105},{1,0,0,0,0,0,0,0,0,0},{-29077048,-3869030,17337357,-1834057,4838068,11313862,-31531403,9345153,-30154969,11525284}},
+        {{-14230685,-5630366,-24865890,-6268027,-29240765,-11455943,6576388,-15721683,22806343,-6317504},{13399527,-14051523,-20007584,3538748,20957550,-11173123,14894841,-8705835,30974455,-13529655},{1,0,0,0,0,0,0,0,0,0},{-14913837,-3430465,-13514297,3532879,-5755222,9144564,4833307,5431073,-26755160,16221455}},
+        {{-26344558,-13143284,-20157121,5308314,-6017254,15994020,-23346649,14147242,16476057,-13941268},{8820803,-2656425,13813408,2762300,-30868199,-11518825,24263614,-6286980,14563980,-14683643},{1,0,0,0,0,0,0,0,0,0},{-7174506,-15357099,-12541579,15586755,19236506,-4362765,-5916068,-8290479,-28952125,-13834502}},
+        {{-2091164,-8986810,-27808811,8025164,-28458433,-16603934,4311099,3568287,1584749,11860077},{-20869720,-1083265,22561642,7296974,-16002857,-8846474,18994201,-1876316,5988517,15090932},{1,0,0,0,0,0,0,0,0,0},{-9710641,-11140343,29236213,-10682847,28915140,1438472,-21103876,11331253,22229107,-6517100}},
+        {{-20136452,13838044,26305945,-9652820,11603744,9978350,21416905,1878890,17975235,8000289},{21860185,11965559,9959252,-8174903,-15130410,-1277590,4264810,13774771,-17420800,2630561},{1,0,0,0,0,0,0,0,0,0},{-18749970,1908857,21704927,-12853852,23976440,3245208,14590117,-3224823,22358534,-9777901}},
+        {{-32800249,-9675144,17372654,-11747637,20102494,14558921,-26526867,-12539562,14612102,-5061184},{-26622312,-9859360,31101313,-4325346,27049757,-10101082,15205513,-7887478,-160406,9943194},{1,0,0,0,0,0,0,0,0,0},{-33241115,-13593509,33208005,-13847789,-16251541,-3498190,-1922759,-8429255,-873662,-6823935}},
+        {{-32639989,-8900158,22949168,-5939444,18171240,-344785,-30069453,-5640138,22127298,-6328177},{-21709525,8443524,21272641,12628139,-1162811,-15457551,-25304231,8784116,28794934,-13464412},{1,0,0,0,0,0,0,0,0,0},{33517927,-6002816,6469650,-11241741,2154769,-6482168,-23268547,-10631763,-21835848,-13372759}},
+        {{-30533746,-1498451,-22820470,-11157558,22730435,-13868138,8610383,1750346,-8387688,-3837828},{-14252051,2990313,-6903505,-11562044,-11656872,8877589,-10915054,12877397,-22626851,9993502},{1,0,0,0,0,0,0,0,0,0},{-28914229,13110973,-13125714,-13489513,16811839,-8844639,-16168537,-11114472,-18085985,12890439}},
+        {{-24631001,-7333416,25455898,4990340,-8045880,4247464,26332361,-13427273,-558997,-2651108},{-9203990,-4399046,11427072,-10914729,-16730188,4247021,-24334774,5636619,-21031502,-5825126},{1,0,0,0,0,0,0,0,0,0},{-6406040,-13665317,-9228815,7787902,-3223036,16496837,1684748,9059249,-26587597,7066973}},
+        {{32605520,-2140918,29811271,-9702962,19060022,-7732851,10693941,-14995230,-11676091,-12240865},{26755605,-9678299,-3155007,7658204,23465725,2381922,17445297,-11062199,541693,-13278790},{1,0,0,0,0,0,0,0,0,0},{14988199,14116437,26822822,11129846,16739754,15730868,14886947,-14520727,-1568856,566995}},
+        {{-4924420,1478193,12637757,3673852,-1219173,1505933,-10572634,7630283,-6555388,-1418553},{11530913,-12848099,18903220,11541320,30425311,9498022,10697247,4539528,362049,13500721},{1,0,0,0,0,0,0,0,0,0},{5455518,-13482587,25521350,-9740913,-20563241,4454527,10033693,-1340368,26693007,-4456699}},
+        {{-4652820,-1277808,30991260,-4121490,28498258,-16215918,-12270356,-13866856,-26571312,-15237269},{4556584,3196348,13424693,-2927649,22967178,13259935,10488679,2139944,2384143,-14451021},{1,0,0,0,0,0,0,0,0,0},{-3196643,-1714930,-27228288,-13979966,-20157138,-5577592,24661277,-7958139,20408672,9396138}},
+        {{3615777,-10763926,-29261760,-11811856,-1489696,-9233620,13897804,-3800946,-19742015,-9242003},{-19290627,-243195,773940,950641,27246641,-9084800,6342454,2430872,18241553,-10435583},{1,0,0,0,0,0,0,0,0,0},{-11718174,-11469934,-4123328,9723213,-26189364,-13181987,-19151931,16745868,29045695,12789727}},
+        {{12172861,858395,22630900,5847279,14538324,-16171509,29787927,-9236668,-10907890,-15778201},{-24801920,14811491,10618446,5027801,8640200,-1586109,30033379,-10143940,-21252350,4972410},{1,0,0,0,0,0,0,0,0,0},{-7376284,10940828,13976712,5446499,-29954026,-12374624,-23403932,-14483790,18599183,-13205317}},
+        {{30771838,15927386,-2509410,-6687010,14613124,-4018105,14821250,-14990364,26217190,-7918833},{20835051,8357372,-23936657,-2159568,1448541,13015284,-18773231,3826188,-7666166,-9134425},{1,0,0,0,0,0,0,0,0,0},{-7555242,-11342588,-25235688,3213724,3805119,5134822,-10797486,14974236,9619727,12495774}},
+        {{1168150,-3911421,26819532,-7146538,-21301011,-12573286,-16349378,656319,-13487777,4322510},{-17996605,3646978,-27985730,12502765,-30664757,-3189362,-11548660,10393956,-726069,-7457220},{1,0,0,0,0,0,0,0,0,0},{10831124,-1279419,15078893,8984453,12510715,-6115101,29494587,2453112,-4301480,12807146}},
+        {{4241413,-5604592,-3974587,-984324,-20896598,993915,-3512399,2688724,-33016439,-2784961},{6487247,-7122643,27189619,9753635,18326021,11009925,-26261380,-2129327,-6764949,-12685932},{1,0,0,0,0,0,0,0,0,0},{13489753,-4662489,-7639282,-15776077,-21537496,-10846118,-16701034,-9804576,25712867,-15923253}},
+        {{-18048018,-14316210,-4461513,-2695716,-17183824,-3129971,-27723049,10862546,-19841370,-13752396},{-5255180,4487706,24412250,-747003,-32233878,-10348673,32966667,16509802,31349772,14884400},{1,0,0,0,0,0,0,0,0,0},{-18745211,-9618210,1653641,-13782468,31959686,-2563217,-17752196,-13103621,-2067024,-12793173}},
+        {{-7649372,-10869985,30522116,-5783815,-21957182,-15105058,-10721983,-12963400,18800989,6237268},{15675962,12725178,-18147215,-10669940,-32352596,-12967175,-31552734,972632,24418426,-14546372},{1,0,0,0,0,0,0,0,0,0},{-19477062,-4910875,-9640677,-5590561,-13491593,15540968,-4821639,-469534,13376256,-12512227}},
+        {{28247766,13922709,7816040,-10272944,17649423,225776,-20910148,15423129,13708858,-450888},{25720395,-13661718,-24056723,220998,624632,860400,-19812777,-4403181,-13452048,4497854},{1,0,0,0,0,0,0,0,0,0},{3597064,-7032626,18186628,-15446879,12574250,6519178,3891665,4713612,14424829,-16681520}},
+        {{-16283168,1642478,-14848377,12681185,-15731306,-4732751,-4925769,-7703754,-19636903,-13102534},{-18707811,-16560228,-28663457,-1329222,-13869464,8084329,6448903,7064336,30230202,11910749},{1,0,0,0,0,0,0,0,0,0},{396034,5346244,-2692227,-7927912,9442841,-5494490,14328986,3769614,7951178,5884546}},
+        {{-18069585,15413254,-22690378,-14847865,-12370053,6116193,-7160567,15299045,-31763158,5985482},{-13615595,-2634625,-19974749,7581268,10448084,-2692404,5369042,-5027045,1777220,2649171},{1,0,0,0,0,0,0,0,0,0},{18620918,-3558985,2707987,-11200844,-15079064,-13846270,6947443,10319592,-21343162,12274033}},
+        {{30098291,15032175,26585768,-16641840,11242985,9605173,-7486689,15823338,-12666825,-10835272},{-33164287,-6339244,19443055,5785445,-2217204,16562249,19529913,-12881303,26735274,-1977930},{1,0,0,0,0,0,0,0,0,0},{-21572858,-16222732,14320920,-3540344,18984207,-1588265,-32821488,-13189699,-26429551,-1683101}},
+        {{28212607,-5161062,-18684249,5543476,-28339262,11942095,-27682346,6111610,-16025015,-1334290},{-8215346,-9008401,-1092024,12038803,19085966,-15463795,-5809724,10280919,-25279520,14473989},{1,0,0,0,0,0,0,0,0,0},{-14026845,13385780,-31694099,15569886,409597,-13608504,23795084,-2377393,22931513,-12201328}},
+        {{14168769,7011253,-30970597,2180709,-1555765,-8357119,-31254082,-6946668,-30168719,10616765},{-2716800,-10667538,26892564,-38967,-11966834,-12690859,-14530670,13376274,19530961,-7379552},{1,0,0,0,0,0,0,0,0,0},{-11895033,1228061,-19286593,-9887456,25395306,3381512,29966796,-9660285,23052152,5659270}},
+        {{-30655624,-6610137,-1193641,959693,-13156438,-5141481,8516170,-15792416,12412873,-7083803},{-26368197,-4333883,-7274937,-11077379,5135543,11896582,16360313,11063824,-4758696,-9722270},{1,0,0,0,0,0,0,0,0,0},{-1128160,-10268078,-19270745,-14617708,21119794,-6727886,-2791595,15093740,-28252712,15995008}},
+        {{-26524353,-15100559,21254661,3218795,-14962530,13651479,-6471830,3711236,12177868,14768955},{28144858,11451097,15095606,-14184060,22264936,9724472,-19754181,-14167429,-2367489,-11144032},{1,0,0,0,0,0,0,0,0,0},{15287136,8868623,-3478802,-15337688,31418633,1794534,31752256,-345862,-24565804,15475663}},
+        {{-30727478,-9219991,-3451029,9519427,3940392,-10065186,23046851,13234674,12630352,16263550},{15150444,-490017,-9487063,12508349,11300502,54378,7041672,1444526,-2610719,7095262},{1,0,0,0,0,0,0,0,0,0},{-806193,-12601102,14378335,-8091536,-31167080,-9002575,-3785163,13299746,-22950457,-12031281}},
+        {{-6438573,-10511370,-4037628,5088665,22500917,13463631,-1283100,12384503,5997107,-1543749},{-11135161,-2599803,-25849670,-11768054,-4568180,-11274786,-5676652,-5938537,4460070,6462996},{1,0,0,0,0,0,0,0,0,0},{22103258,-11325290,-21546186,-2940054,6464012,14664541,-10972813,-6712538,-16149420,11068877}},
+        {{-17655499,-6001021,-16284621,-10593600,29230835,-4098960,-12349360,-14818376,-27766845,-6192931},{14646080,-14923445,-7229639,-14123528,3450672,-6992655,18530625,-15685716,6343834,5223052},{1,0,0,0,0,0,0,0,0,0},{-11356062,2910999,7250279,12331080,-23900205,6564221,-9086238,-5010295,20994054,-12957644}},
+        {{-12428857,-5143748,26277356,15484827,-25546430,11060660,-2925748,13873687,462135,10002805},{19611239,4093254,-26292708,10655860,16585836,15025178,-11638111,-13061800,-6741153,-884354},{1,0,0,0,0,0,0,0,0,0},{5819696,-5363971,24041089,2825895,10726088,6201597,33488207,9305113,18588479,-6102020}},
+        {{-8885725,-6910291,13682932,1223530,24642213,15883103,134124,10691188,31357258,-8425679},{31639173,-1092906,21919103,-13341351,-9833717,2173055,16374971,-1637708,-3160800,-1904059},{1,0,0,0,0,0,0,0,0,0},{-20288020,-15341200,17308554,-6065554,-11794484,10115124,-32317757,-3699141,-25536271,-11951649}},
+        {{-31266080,14502406,26846331,-10695986,-18019440,-7962377,22347962,3717504,-18468756,11424220},{-9840446,6489356,-19649682,3506062,6326652,1429760,23983623,-2279339,-2817288,-10409246},{1,0,0,0,0,0,0,0,0,0},{13202813,-6951534,32516097,13429639,12512765,1493389,-21204498,7789149,-1355019,3395509}},
+        {{32331850,4869752,-6296778,-16321097,-5837290,4145641,-20485329,-8388104,-3743928,-3677977},{-15522501,-16640877,640817,-11655108,-22604475,-811691,-9900202,-4321039,2835830,15442015},{1,0,0,0,0,0,0,0,0,0},{-1921845,9586334,29348425,5010098,17557388,6995073,-25441185,1616750,16394146,15552564}},
+        {{-24638902,-6206885,27770992,-4284852,23160749,-4547405,32547250,-12148766,-22075694,15052962},{16726450,-11820030,-19309335,-16576007,13386764,4459879,27724173,658726,-30243612,2935051},{1,0,0,0,0,0,0,0,0,0},{-9101081,-9605225,-15971255,-12747311,26764152,15914309,-8761348,-5957307,4595740,15508533}},
+        {{31699212,-2239537,-23727517,-8599103,10378279,-7246694,-27724269,-12457227,26406747,15802041},{-5170199,-8048790,-24437351,-3052670,-1824816,9534909,9896589,-4885938,24386734,-6617259},{1,0,0,0,0,0,0,0,0,0},{11176074,-4742677,2419281,323966,-28005681,-1246048,-2700403,-10144525,-20835548,13787374}},
+        {{23022081,8122873,-28244154,2833551,11894622,-12397147,4430842,9868146,-25980740,-10048024},{11589759,-16742188,14824676,11204928,-4964794,16480647,27995495,-4170683,-23486433,15644156},{1,0,0,0,0,0,0,0,0,0},{-13801828,-1101408,-15036079,-9155173,-23980376,-6464171,33079002,-15040696,-24136197,-7396881}},
+        {{-24580151,-10316315,-17220258,-6176041,32832958,15097560,-1902477,15899682,9815089,8699658},{29140634,9704323,-16330662,7542195,-29206530,7651712,-12379195,7586917,14290659,16416319},{1,0,0,0,0,0,0,0,0,0},{-11216188,12831544,4228729,-16047328,13789267,13045362,67223,8124546,7444527,-7970143}},
+        {{-3787339,-16605069,25845327,-6068836,22035050,-8163005,-7483740,-6970351,-9110289,-15788132},{-13704316,1327939,19835572,-4482862,-29082327,-14194504,-1436605,1996146,-8803686,-6397880},{1,0,0,0,0,0,0,0,0,0},{-2880259,15792464,22268660,13244218,31187037,-14885246,357736,10576192,-10250979,-587488}},
+        {{-18286131,-548679,-10849258,-9799859,16052630,-6512792,12027079,-11860826,2342740,13285676},{3775513,-14785120,-12533276,2527718,2379205,-12222686,5184447,2693942,6023501,14294284},{1,0,0,0,0,0,0,0,0,0},{19079035,-486430,23487631,16764754,19606686,5925699,-22991769,14739328,-17684194,-15830165}},
+        {{26830607,3583958,4758367,-5698847,1404968,3854179,25401090,1674968,-16240250,-15058527},{33482149,-3786454,-24681151,-12400091,-3350126,-11658743,-30085258,6557770,-385796,1509500},{1,0,0,0,0,0,0,0,0,0},{-20149065,-9231566,-7376125,-13333681,-24430489,50779,-6319803,3335755,-10166619,5166916}},
+        {{16200304,15630100,-14166540,3930047,19171240,-9818928,-26824950,16023305,-18140301,5189582},{9458789,12354047,10498947,-1366669,-16626155,-15957511,-24638302,8981438,-7601499,-10450304},{1,0,0,0,0,0,0,0,0,0},{-3777331,-6275921,-31083137,3574228,-11018702,-2445892,-25189394,15423195,22096520,14584445}},
+        {{26696310,756607,12107280,-6289665,31584468,-7939757,-26011414,-16441716,30953463,-10204864},{-32665940,-303365,-25014687,566451,7937815,2396336,-26249166,2826763,-26051193,-11023850},{1,0,0,0,0,0,0,0,0,0},{3916354,12607994,13811383,-11995468,1674393,-4741606,-23826101,1818893,-27728510,4089728}},
+        {{-26220624,-7832442,30183401,-15260325,18670550,3447945,7159088,-9739208,12198828,-3861731},{-18832442,16041510,-21922725,6458764,-11197747,791922,-29589055,2171665,13191211,-4898792},{1,0,0,0,0,0,0,0,0,0},{-15668095,5528137,30227606,15808224,-19113062,-13105606,24141617,-14438097,-22907405,-21552}},
+        {{11529746,-844003,5184002,9615503,-179545,-6181482,18861678,1730021,17965529,10459897},{-26555081,11903682,-17360441,16658942,-28424001,15839086,17311544,-15708002,-31207820,-15474594},{1,0,0,0,0,0,0,0,0,0},{6819,9373004,-15313656,-13076772,12135935,-3518204,-20832213,-7265048,-23533371,-10737539}},
+        {{28643937,12513275,26349756,15292240,12794632,735461,-28197699,1963345,20661066,-2966743},{-2151619,15458187,32395424,-15495235,-23392231,8486189,2150630,2268678,447100,4243484},{1,0,0,0,0,0,0,0,0,0},{6134556,-8969850,29440556,-6915304,30294344,-15592218,-29216085,-10380122,-11137058,-12408874}},
+        {{31075837,-12050222,-9668410,-15099852,24087167,8416809,20961121,-5137632,20052834,15284804},{-2737604,-930247,28304193,10546262,-22059461,6023727,-2470001,-2737346,-5111832,52890},{1,0,0,0,0,0,0,0,0,0},{-4626628,-4254437,-14571521,2156574,15868327,4971707,-9565821,14364717,31585198,-1450625}},
+        {{-13063201,445349,7422593,9164533,-7515494,-12345282,-26086166,13395570,19441252,-2641582},{-28792147,-4133646,-22930807,5163751,33253730,8505868,-6726564,3344385,8494443,-12392159},{1,0,0,0,0,0,0,0,0,0},{-27765895,-11106073,-6596502,3908112,15131096,-5853298,6594408,11266075,4777533,-8971984}},
+        {{-22223577,12239838,24530024,11839429,-11362748,-14968772,26250522,13881830,-8292350,-12561497},{11963976,-15667420,677142,6537030,33000799,-11093534,-17670203,621088,31494814,15125120},{1,0,0,0,0,0,0,0,0,0},{26804301,3018713,-13817749,-6045760,17497757,-9937507,-833368,-8478120,-6101022,-4382948}},
+        {{-16547172,-13801381,18506941,-10659556,7644749,-9988304,1389322,-824402,-30366561,9613173},{1989338,-660419,19002072,-10307522,-13464565,-12010105,-12748779,-9487571,13899945,-10071288},{1,0,0,0,0,0,0,0,0,0},{23253078,-209688,861486,14738994,-20984875,-6783260,-23233664,16359515,-29297027,166582}},
+        {{8520042,11411818,7914281,12779587,-5697148,9388598,17874188,-12670813,16590277,7437699},{-4109757,1463303,30910707,14828031,20428872,-14712947,7390762,-15138096,23465184,-5719924},{1,0,0,0,0,0,0,0,0,0},{-15892265,2601553,17075814,14601191,27761897,11712145,9804203,-12601033,10288559,4385582}},
+        {{6301878,2814851,-12595933,5151753,9815196,10869545,7286078,4411500,-8840951,10060916},{24401373,-14345471,2984102,-14458087,-13556319,7606213,24287832,10229428,9877512,-7882831},{1,0,0,0,0,0,0,0,0,0},{21618144,4063821,28545436,1594844,10413797,-5231219,-24922965,-4875822,13260511,15203777}},
+        {{14998635,-8139879,-15825456,10526125,3106937,8388303,15033732,-16470002,9168635,16571641},{14565253,-2472486,-30576761,-1330259,9135890,13256952,-11303139,-4327819,2814694,1613712},{1,0,0,0,0,0,0,0,0,0},{-6435780,14870983,2156343,-11512511,-32817352,14902873,-11609229,-6788109,9756808,-16492702}},
+        {{27574072,9052223,-25182802,-2685242,-2237211,10134003,-10623033,-2357514,-23827545,-1156831},{17656888,16676794,1387358,3194414,-14416586,-9867458,-22362693,-820657,-1316268,-14943753},{1,0,0,0,0,0,0,0,0,0},{-21933286,2669669,9395664,-166633,-19849764,-16560180,-1896712,-15501082,-14628448,11211867}},
+        {{-28368640,-7430888,21814618,5467018,-13655355,15907983,-24069541,-14114443,10790831,-12171663},{23871556,-12155950,-27749597,-13119153,-22309419,7775795,18720993,13375415,-11628043,-7646493},{1,0,0,0,0,0,0,0,0,0},{-1510680,11292191,-4030353,10145791,-14741913,-11645142,16190728,10179748,29220142,-1705780}},
+        {{-9971466,-11130466,23214195,-6126201,5385237,-9193774,-19271547,11947932,4379758,15461762},{8237822,-7460541,-14047361,-10452430,16051679,4163440,-812561,15221951,22069325,10885683},{1,0,0,0,0,0,0,0,0,0},{29245867,13753436,10003357,-6412756,24407086,7687105,29586268,-6530761,19629216,-14408442}},
+        {{-16191603,12211652,-26925971,-7428177,18860034,-1622929,-27460195,-6817070,-33454661,5611958},{-15402315,-5769666,3325134,15441012,-23016351,947879,-13126521,13796477,24968452,-12950885},{1,0,0,0,0,0,0,0,0,0},{-8549901,7399155,28729666,-8038292,29909681,-3344786,-29337475,4432328,1753794,-2939943}},
+        {{5717601,14308223,7790785,6663569,6337296,-6766054,6926104,11661279,30848867,-2558460},{-20557615,10876851,32990561,6835022,28834630,-10977083,17811819,-11343891,-17421599,-3198955},{1,0,0,0,0,0,0,0,0,0},{-23126922,-10661321,-29218118,2907483,21846935,-11557162,-12606116,13124694,13349425,-12379702}},
+        {{-23041301,-13782660,-26140163,-2063610,21070036,-14991044,24986489,8530180,28559124,16450260},{9878177,6743395,19826423,1015564,14665311,6020586,-17376596,8661962,27175016,3672358},{1,0,0,0,0,0,0,0,0,0},{19029882,-10421022,-1788800,12943252,21820542,11223492,-14942695,-15664652,28521575,865777}},
+        {{23329147,15603411,21804201,15282424,16566523,-609387,-21198138,-15916903,-6936365,-12149067},{11287760,2315585,17021973,-2915214,-21142388,-8318618,-19421207,3610325,-31439635,15845091},{1,0,0,0,0,0,0,0,0,0},{-32308544,-14821225,-20604146,15692142,-4843146,-520300,-31508064,14707953,17761079,13608209}},
+        {{757781,-5479893,365299,-4652861,30306036,-15376532,-9038714,8425948,-27608789,11449238},{20632433,-6312219,-5784841,-5024093,-3981468,1699107,-25633944,-4145695,-15222461,9109235},{1,0,0,0,0,0,0,0,0,0},{17624593,16456208,30334385,-2168629,16623820,5016662,-12331680,-13867924,-29863235,810689}},
+        {{-29254083,2428842,11058121,-1495083,13397003,-14189404,-1251815,-11480491,12425600,-3773782},{22551480,-2174153,-25581778,9704992,11474750,8219009,3018719,-15231494,17877714,6397245},{1,0,0,0,0,0,0,0,0,0},{-25720746,7016261,-29113895,-5053666,-9049923,7755345,-22491898,-2968562,-10625670,-12446782}},
+        {{30113489,-10525839,-8266062,7845333,-21075044,-4773034,-579275,12894955,-4975992,6080419},{5718955,-12681443,1568752,-7891483,18237962,8631421,-13775740,6031804,-1698305,6091295},{1,0,0,0,0,0,0,0,0,0},{27168853,14759238,-7689641,-2005369,-32506928,-9604245,5510384,4974288,6530279,9282064}},
+        {{-16227744,-3382260,2330234,9602737,20266112,-5613043,-29107736,-16715114,11197122,1680931},{18076906,666090,-11750010,8466969,18152064,-13157588,4210983,-13790552,33237661,15607790},{1,0,0,0,0,0,0,0,0,0},{25901304,-2471044,3352402,-1867909,5908911,-7522390,-15503707,14667672,14210733,1956208}},
+        {{-29823390,11692922,-966550,-3767880,-9865994,-5409738,31118914,5249922,-21348230,-14050950},{14244674,11045018,3263083,-2463013,4644824,11582761,-147100,10186068,8465434,-16699872},{1,0,0,0,0,0,0,0,0,0},{23258321,-9309434,9944866,-5473788,-12051451,10377009,13928754,7995045,31140536,847530}},
+        {{-32326423,-6169352,6809165,-7542888,-8429599,12532670,-14965000,-8310441,23032924,-10584057},{772715,10572235,26464126,6218559,24496571,7482257,27186866,9372871,28518038,13598970},{1,0,0,0,0,0,0,0,0,0},{23898,8245105,19879061,12787089,-1956244,-6362205,-18084526,-13471669,26567220,-14418149}},
+        {{-29340272,-13561818,23712988,8079432,31809492,-4514549,21280171,-13355418,4105394,-10273151},{-13659800,2638608,7406027,-8763264,-3002791,12961898,21149029,15114479,12619663,15784733},{1,0,0,0,0,0,0,0,0,0},{-22405035,-6140691,19986086,-16452820,10748134,10107911,21366802,-2956137,8328577,15698629}},
+        {{6908191,7552394,-18676608,-8631794,4781432,-4330869,21100409,15643837,-30616520,-15117447},{4888575,-13787250,-17340611,15444677,-28217932,-10250575,298436,-7138685,-19926922,-4647786},{1,0,0,0,0,0,0,0,0,0},{-7145950,15056185,18318860,-14085033,19511142,9336697,-31404684,-3490503,-5438319,-11774126}},
+        {{-19869911,13747135,-10780149,15657656,-28232373,13303760,-22971884,16268883,1151011,7667506},{9915246,-4987607,1900085,13613696,-4764114,-15066427,23411944,-6392065,-25695482,-6214375},{1,0,0,0,0,0,0,0,0,0},{12281905,-4132848,15269715,7625578,19225231,-9645303,-24914776,15310487,19461816,10012419}},
+        {{19640346,8248348,-11826078,-3425741,27636836,5969287,3782448,11948824,7458551,-13496043},{25810728,10223627,2433600,-7569444,15043734,-14547251,11579,-9195633,-8376675,7734510},{1,0,0,0,0,0,0,0,0,0},{-20703189,11832143,-15368932,523246,29624157,1622430,-25400940,-5090720,10069828,11160486}},
+        {{-30388172,14669340,-9767125,-4311815,30432357,15005713,-3666925,-1892644,27840846,4077920},{-28573462,-3233594,-4403980,15016745,28229944,-13570511,-27662357,-9156337,21940761,5940930},{1,0,0,0,0,0,0,0,0,0},{10603762,10895592,-19941853,-2099122,-17498059,11132929,-8002390,-3682403,13653875,200746}},
+        {{-22791066,10482030,17076744,-11928161,1913576,-5479534,15815170,-11078148,-7363352,-12285952},{-19648391,-4335697,9860633,2298898,8853997,-8702184,1565307,2627290,7730887,13713537},{1,0,0,0,0,0,0,0,0,0},{-22173823,-4032111,-17647118,-4502794,26255782,-733710,-12678330,15193923,-32201713,7006848}},
+        {{25935053,-2112586,-7730908,-749921,-26817098,9404955,28246414,1476944,-11409337,2835098},{1312782,-14392324,21944241,14870312,-24151687,-11348139,-13448417,-15170218,31752437,-2005435},{1,0,0,0,0,0,0,0,0,0},{-23586273,-11973627,17461188,-7765519,33459025,-14118321,28925677,-1042647,-13482006,5924285}},
+        {{9477355,8628077,-2248915,-646496,-4358037,-1974822,9780607,-4192777,26818355,4905448},{-21593314,-6150887,-9664585,-7439646,-19647152,-1193483,18727145,2026640,27684619,4679256},{1,0,0,0,0,0,0,0,0,0},{8987846,-14822345,-20118347,16362884,2082389,4251025,-30102686,10877270,-2973984,5158172}},
+        {{18752873,-6698091,-3818499,-902347,16908487,-1697862,23719866,-9040040,9448403,1439869},{-9008792,14443976,-14774777,999948,-19851161,16503970,-11678285,15296064,-27131142,10516235},{1,0,0,0,0,0,0,0,0,0},{-6499064,11624104,-17297853,1036217,8575720,-4019511,19505306,3241815,30654078,10123241}},
+        {{30944437,9686007,-2975241,7152293,-12498395,26845,6101830,6254713,-22363707,8365289},{27866046,11561152,13723739,13027374,15146708,-256808,-20134564,-11006844,8134710,-7116288},{1,0,0,0,0,0,0,0,0,0},{-1074897,2903573,-12023264,890465,-32976185,2838553,10129471,10755779,-30161205,-796286}},
+        {{-805922,-2294803,5126351,12255945,27000338,-5308062,25230322,13826396,-33194830,6505500},{-18993649,-10596287,23188107,8907988,32821709,-3156764,-25813894,-9277350,29766719,-16176331},{1,0,0,0,0,0,0,0,0,0},{-18657628,632769,29272365,6434318,24167839,8305779,-16878784,12840071,15063660,-16464955}},
+        {{-18197163,-4218511,-3422730,13371120,-10000852,-13269200,-1652605,2895531,1365180,-14599478},{-11309457,7475544,-4523044,-4283664,3420456,-7965916,-20115394,-6086391,-13692709,7126361},{1,0,0,0,0,0,0,0,0,0},{-740459,2304672,23856012,-5523736,-3522691,-5315889,-30726537,-5309677,16468329,4039831}},
+        {{590679,12316308,8545032,12227513,5031002,-6556013,-9750623,12670774,3025635,-11127977},{4528949,10169512,-8722738,-2170730,26284116,-9952914,-13746196,-10348684,20666499,-3061412},{1,0,0,0,0,0,0,0,0,0},{967296,13636320,-3123676,7588064,-29271852,459903,26457052,2140780,27941700,8858284}},
+        {{-8929229,-6431031,-17525284,11502849,-2720564,15738472,-13779073,-2723661,24956847,9795570},{-4778517,6276834,-31608773,2087949,-25557483,-11088251,26047153,14720974,12708528,13775492},{1,0,0,0,0,0,0,0,0,0},{4082273,-2456798,1857286,10956296,-15710227,7483007,23254075,-5537077,18361839,-13836546}},
+        {{-32983094,15329474,14739772,1383401,25222108,8811328,-683039,-9484802,12290206,-591178},{-24868883,-14401440,12159185,5688336,-17139939,10790518,-12476903,-11365744,26324196,13434911},{1,0,0,0,0,0,0,0,0,0},{3175443,-10220939,28858821,15271329,-9544657,-12841150,20397211,-13222236,-18482751,12517796}},
+        {{-5965889,-10808994,-6108441,16103372,31702819,-214369,-8903004,-8343559,-23042528,-13254472},{5698518,862910,-31256436,-6758801,-33281955,3649923,12333510,12187533,5679099,16342056},{1,0,0,0,0,0,0,0,0,0},{726885,14508435,9334580,-12460528,-1393415,-7040730,980478,1704186,-20714192,-16638053}},
+        {{-18916380,-3294198,-33119377,8697714,15486203,-14208316,-16063574,-10992602,-29841688,-5958630},{-15317815,-4246541,23126141,4761242,9524251,-5543953,17452508,-9903435,-11758819,-4928422},{1,0,0,0,0,0,0,0,0,0},{13690958,1040165,14861471,-12185386,-20521241,-14242534,-27501131,-12630631,-8275496,-13346083}},
+        {{14843662,8212143,11069911,13774640,3502154,-8274356,5134668,12960096,21093242,10340241},{33278946,-691854,-16343686,6744621,-19190228,6367320,-6878695,7826894,-10745923,-7581307},{1,0,0,0,0,0,0,0,0,0},{-13388550,-7587809,26810842,-4113420,-29211221,-5105095,-3888775,-1838919,24828883,-2033496}},
+        {{-25857225,-14107318,7804170,-9480423,-33492262,-9826383,10836606,-15981261,-17473031,16637363},{1406544,-11038877,16159918,1083179,-9636137,16691104,9204381,8213253,-7321155,6293709},{1,0,0,0,0,0,0,0,0,0},{-2576024,-14639715,-21999912,183069,13031920,14468581,17293984,-5065416,-27167537,571829}},
+        {{-3492893,-1727028,5877552,-7445499,6040312,-7886658,5316537,-14158874,-17184886,3604638},{15070645,5874661,15414729,2009757,26644838,-2317416,-28028980,15747683,12479115,-15468901},{1,0,0,0,0,0,0,0,0,0},{20303763,4510428,29049351,-15187130,28358750,-11931185,22371212,10430473,-16183799,-14368670}},
+        {{-3561217,-4944281,13808433,-11422104,15987832,7431283,10191826,-1345547,-29011277,3562213},{-12788572,-16498797,1493282,4486962,-10491152,-14513649,7398996,-14441448,33502273,16099066},{1,0,0,0,0,0,0,0,0,0},{10647232,-11468187,-765315,11277375,-5183280,3076657,30970190,-4301807,9164931,5365283}},
+        {{33264426,-4744336,30433638,-3491973,14732426,-13636592,32444068,772836,-26125590,5894720},{-10572765,7648534,25079186,-9580108,33276952,-6710379,-4037923,-12249315,23697686,13442150},{1,0,0,0,0,0,0,0,0,0},{10703032,6644691,-21486537,-3958793,32351393,15623304,-11640525,-6195900,-30711576,9104652}},
+        {{-24546083,-6188215,3749442,-13330769,-20311302,-4266259,14724120,2201707,32442407,-4003002},{-32730087,-6721384,273391,4262844,18316828,16471078,16512241,-6214214,2693320,11814617},{1,0,0,0,0,0,0,0,0,0},{-16206488,-11063690,7236450,-5650058,11294962,-15789688,4997547,-5020957,16657060,1494230}},
+        {{-8350736,9428617,3468669,10804449,-14545702,7487039,4612651,-417057,5188906,-33728},{4299218,-752350,33113578,-15983816,30029134,12397469,6985936,-1497273,-26725665,1706321},{1,0,0,0,0,0,0,0,0,0},{-4981862,-7550465,-29462216,9743514,-27190084,6825402,26947062,-16359390,-25222484,-3029923}},
+        {{-19859473,-4199013,-11979843,-16112601,-3455522,-3834060,17913409,-10919239,27042376,-16348091},{2379916,12654321,-7957231,5058202,-32614366,-9019501,-5152324,11646766,30701853,-15444548},{1,0,0,0,0,0,0,0,0,0},{8043182,14595992,-4314187,-4365672,17684219,8036978,29315718,-14489378,9800887,-16211223}},
+        {{-31154815,-1276164,-31176849,-5588415,-31630796,8208421,-13687793,-8048348,10887430,6163543},{-27780150,-11001370,-19032305,1418460,29358117,-9834354,805802,-12592518,-2142405,12019426},{1,0,0,0,0,0,0,0,0,0},{12690493,-13164803,33330260,-776609,-4397102,-16415158,10729336,15538943,-6361041,-14987605}},
+        {{-12254144,7028229,32541421,-7705531,-10493507,10894214,1916513,11323887,-3973730,9830456},{-20407712,137652,-4477205,-13310694,-21044024,3744097,5320251,10240255,-17097813,14102004},{1,0,0,0,0,0,0,0,0,0},{10170312,5499724,17298995,-16543727,-21890800,-12211637,-18011379,-600973,-13394747,-16004823}},
+        {{-20300730,4628065,12208725,1472750,-30487890,-15847299,-30572161,-12995886,-27300121,-8156006},{1323250,-12657899,10958737,-9421870,26467407,-3367282,-25150548,310943,-15115171,15504432},{1,0,0,0,0,0,0,0,0,0},{3482675,4331403,-12925093,11901308,-6722934,-8942323,20835523,-13855231,-4265431,-8407187}},
+        {{-9798329,-12312619,-9224490,9726519,-18512626,8769715,-2536745,4884509,9662317,1898612},{-10663993,205779,32402438,-2233167,14133936,-8348063,-3538827,117825,26242988,-15173647},{1,0,0,0,0,0,0,0,0,0},{10026593,-7764478,4584330,1790415,-11827734,-3626584,-12532085,13586874,-14981271,-4264230}},
+        {{-20639683,-13888003,-17129366,14863687,32553503,-7914306,23299890,8837114,26131228,14772304},{12133041,-5719215,-3983403,-1782253,14272756,13033060,-9527920,12667838,-9720547,-12005421},{1,0,0,0,0,0,0,0,0,0},{19818008,-11182261,-6547442,-4079241,-20367025,-12581760,-24797913,6825158,31105863,-9971136}},
+        {{18364022,12610291,14819868,-2736161,20281902,4794448,-12660650,-10390854,8115154,-5927248},{19082774,16571368,9905338,1010308,-10713554,15692622,17187540,6195721,-23020402,10388014},{1,0,0,0,0,0,0,0,0,0},{28472179,-302889,26036539,-11459999,15199595,-13121081,-2816499,1004672,8330284,-6343548}},
+        {{-9152300,-6525938,-22437353,-16252241,32860780,-11388760,2662930,2812341,-2484562,14782590},{-11919508,-7510276,-7031575,-12534721,12613156,-7756607,-29845721,-10396671,-20844755,4606323},{1,0,0,0,0,0,0,0,0,0},{-8287052,3486647,9494307,-10008109,20859436,-13628823,-12654681,-7545079,18849226,-15865331}},
+        {{-32370824,1660173,-12751033,14941559,-27121696,-6279786,-33156631,1317035,25050521,14018349},{31884139,13250156,-4078317,699209,6922881,15690863,26896043,-7233959,-6657726,5326558},{1,0,0,0,0,0,0,0,0,0},{-17936583,-12953805,25360007,4030624,-28242056,5300073,-29212326,13698027,1612554,-5594995}},
+        {{-26518897,-3554895,-30702466,-11510541,-15443554,5106693,-12221273,-13684737,-20356564,13735782},{10722000,9148022,-19855530,-11124417,8236841,-11574285,-17611073,4531993,-21408461,83437},{1,0,0,0,0,0,0,0,0,0},{-14532025,3125431,-10807510,14507094,3073504,-5334609,26417225,13580289,-25711889,13411751}},
+        {{-16111111,1284087,-13801993,14017461,19311629,8767148,32954975,363272,-30384256,10788295},{-22437410,-6390042,23432685,-767143,-823276,1210217,14490175,-7597124,7571005,8147232},{1,0,0,0,0,0,0,0,0,0},{13108034,15045496,27672318,12725075,-1162176,9299201,27676469,6043373,-18844898,-5075519}},
+        {{-927478,3031349,3690271,-11133401,-14880591,16234402,14483189,11278735,8877035,1626904},{10691111,-5394522,1000232,-5154117,30928235,-8278912,-32204550,9163565,-27729915,-8061018},{1,0,0,0,0,0,0,0,0,0},{27166711,-16766467,-17268550,-4258477,16996540,-3501410,23241425,-9650093,-23244191,-2823237}},
+        {{11626482,-10814395,-28767806,7616021,-27312184,4277308,-1653759,11327396,-10149267,-13413909},{-14893874,-13357221,32518531,6439249,-25072370,-7150960,5272884,-16495632,16246167,322315},{1,0,0,0,0,0,0,0,0,0},{-3609850,-8335096,21177118,-11376876,-2222755,885533,5552902,-15502924,21499625,9515706}},
+        {{30795927,-16617327,19057520,15700643,25182454,-11478036,-12151683,10997310,31908113,-12188785},{30161218,10977757,-7765661,-3369668,16195896,-5243718,-25960135,15615752,-458653,984899},{1,0,0,0,0,0,0,0,0,0},{-29790116,-5556941,5644204,14087630,-11905147,-7330700,-32753430,-4642266,28812195,-6844728}},
+        {{-1154222,-2225306,29299079,13949818,-19222633,2858419,-380870,-1850822,5717868,2047872},{-33481906,5037703,25911702,7121246,29441794,12921293,-850923,7960837,26522574,11659632},{1,0,0,0,0,0,0,0,0,0},{-23194780,16395753,1715561,-9984889,28344778,-1790880,23271887,-9802040,-27021838,-944255}},
+        {{26692004,14406343,-7208105,-11539956,-25560075,11194562,-18851629,-8624231,15227808,-4736822},{33516935,-2196800,-26233479,8868463,29893174,11405469,-7096085,-11931367,-26991166,-11437696},{1,0,0,0,0,0,0,0,0,0},{27901644,11131542,-23164224,5746507,-25201978,-14316257,15023964,-7029843,-16469537,-11821975}},
+        {{-5960617,3184260,2778052,10476366,23244915,8771439,-892443,2647689,29212423,-2011322},{10923518,-207476,-5987414,14532110,8961459,4886616,-32863831,-8964969,-22868847,4954776},{1,0,0,0,0,0,0,0,0,0},{-11678751,-11557022,29930631,3681966,26126703,-8105393,24432511,-13503610,-28071613,-1548590}},
+        {{18170954,6369661,-25841830,-112717,-1740565,-13359705,14853660,-16546265,30568211,-12409142},{9281968,-11603305,24121806,12265140,29282798,-15788518,-19205617,-4333523,26185071,14210168},{1,0,0,0,0,0,0,0,0,0},{4722925,11575305,-18201371,-8695104,-17601546,11466156,19554156,-10829484,-21249350,6761014}},
+        {{24723926,-4161428,6796818,-16459626,-5696117,-14462238,-4087376,9152921,-4014547,-2798500},{30828624,-7293198,-835244,11770664,20593940,13058751,27421758,7030640,21700253,8917893},{1,0,0,0,0,0,0,0,0,0},{16364641,-7904607,18021059,-10894566,-4291957,-15379321,-10177975,11532243,26748802,15226117}},
+        {{26829218,7443962,31189976,-11206155,-7567925,14298915,15308101,9574292,32116301,10030156},{-6571322,11823277,-15379097,1566822,-25235226,-7721324,1060735,11241905,3173693,-12279322},{1,0,0,0,0,0,0,0,0,0},{13356803,-15064979,-18258338,-8909293,-19249228,3926224,27986509,6553771,-23353471,9724714}},
+        {{-16120001,-15323769,5212647,6775325,-26501669,-15501116,15938540,12502746,-2299562,9668458},{13491237,3747327,-4710411,11016706,28042741,12874639,-7664812,10278628,18374166,11691125},{1,0,0,0,0,0,0,0,0,0},{-32077049,6888746,-21263926,-2411088,-6589614,-267901,-13166948,-10607077,-15146227,2510876}},
+        {{-15570790,-3731623,18777779,15476830,24538689,-4567691,16499639,-4252821,-33095242,-5568266},{20176618,6334170,-13571250,14079779,-13119890,-14812620,23265267,12733017,-17198257,-3825015},{1,0,0,0,0,0,0,0,0,0},{-28230549,-10167807,-15386207,13236321,25678160,-14258468,27255636,-4211866,-18144729,-3272771}},
+        {{31588666,-1736271,-17204812,-1215914,12723484,12307993,8886190,-7664238,-2281356,-8063219},{-25419358,16338329,586217,3208787,683841,8698945,4965664,-1732283,-19302366,13996677},{1,0,0,0,0,0,0,0,0,0},{21222274,-11351895,-15538921,-9712272,-23566099,-357503,29344895,-3204923,-7223178,-11136550}},
+        {{25044154,-13589803,12316103,6155166,13609891,2310667,-10545466,-6693543,23419861,-1805675},{-16601750,12163694,7170033,12113887,-23436666,8188356,22947467,9921293,-972005,-13460943},{1,0,0,0,0,0,0,0,0,0},{-14358096,16420429,19299258,-13470561,-23436447,15586779,-32118263,-5188399,-27435435,-10034061}},
+        {{31671613,6272065,-22904648,-1101166,10551366,3838579,27329082,-149346,6425761,7088866},{-7081007,-2084869,-18266549,-5352605,462215,12369548,10943869,14441376,15493368,294165},{1,0,0,0,0,0,0,0,0,0},{-28505185,15818485,-6400881,7405803,33134435,13147381,28267364,12592969,-12727589,5542770}},
+        {{12141367,-5256257,21262596,-15596381,19873284,-2727999,-11477671,16693518,-20407829,16675871},{-6167462,-16572583,-21742567,-6209297,26219235,10989982,1657251,-5963342,26378932,15431690},{1,0,0,0,0,0,0,0,0,0},{-14672339,-5028045,-28616557,-243189,-14785738,10386435,18634769,3539401,20969875,-15586157}},
+        {{-473959,8781010,26468635,8493052,-24038195,2938567,-15120603,5943924,-23993854,3802212},{30078462,93602,31617509,3295233,17978407,13205857,21804034,14115005,26751737,10627593},{1,0,0,0,0,0,0,0,0,0},{10245868,3067397,24449890,7825218,320186,15709201,838174,2080444,-6506976,-3877079}},
+        {{31696540,-215984,10712616,-2665910,25379762,14753833,6374448,10469870,-14063743,15792760},{4541478,-3590894,-12529529,-11834506,-27385380,13661607,25475579,10227263,-14935423,5039925},{1,0,0,0,0,0,0,0,0,0},{-1176099,-6193294,27782176,12674874,-25099429,-1912775,14301806,7547519,-19428986,-434374}},
+        {{-7360082,874311,-26157313,-8711969,30905166,-15778186,1556644,-11519154,847239,-5281469},{-21099013,5662674,179845,-3480170,20139288,-1998222,16402233,-12063480,-2371589,-15031845},{1,0,0,0,0,0,0,0,0,0},{10976544,12903395,10143700,-12309069,-15306193,-12137259,30826453,-890218,12471997,-4327069}},
+        {{-21527141,12282855,22175219,4973351,11249734,-14855304,23120581,4854092,33146306,6224014},{-6911040,-13652094,-5222454,14790890,-9563891,16061070,-27608872,-3719384,-7212437,-10131904},{1,0,0,0,0,0,0,0,0,0},{-18069243,7736271,2337472,-14072692,4808957,-11869891,3481170,5329032,-31701767,11169664}},
+        {{10679902,11664330,-580658,-1006225,-538546,2687644,28029984,1522922,-32767378,-8431182},{-24419143,9428191,18631694,6501878,21790639,-2805236,28524347,13879203,24807078,-15942133},{1,0,0,0,0,0,0,0,0,0},{-27936140,-13405721,28987703,2845120,14874033,16462850,276171,-14691700,-24053652,-10601056}},
+        {{-20201985,11820684,-13326469,-14837773,23560824,7701921,-15354756,-10394489,30552264,3789134},{-4060632,-14851174,-32989481,9798977,28859153,7798856,11488593,10407424,29540564,-14643957},{1,0,0,0,0,0,0,0,0,0},{-10402850,-1080827,16552578,5674371,-18819475,16276599,1985633,4449220,25228043,771220}},
+        {{27386100,-15725002,16762823,16306423,-8014763,-8860639,17972597,9287779,26971719,13274501},{-30908919,-7031307,13474256,-11398162,-32754212,10443719,20939538,-11463536,15252137,12955288},{1,0,0,0,0,0,0,0,0,0},{32393754,-8793524,-3819704,-1020633,26749512,9895442,20002887,-11875697,-6322532,10563578}},
+        {{-24837886,-5474514,16173513,-2260198,-16371030,-4697189,18024716,1099656,18525658,-13311119},{-21240084,9779775,-23154146,-1717412,2010062,11966435,2158687,-3041272,14968607,-829424},{1,0,0,0,0,0,0,0,0,0},{27013376,5364466,26519446,15416378,21974188,710268,19509662,5194629,-27543401,-14729842}},
+        {{-32812971,11966226,2994199,-14164086,22409387,-6075102,-9498605,16726256,6509778,-4774410},{-2757787,-20272,-17349196,4960629,9312614,8534389,-29542043,-2843212,-27744254,13312258},{1,0,0,0,0,0,0,0,0,0},{-21698217,10233679,-12145328,-12992863,-13155932,1906791,-3594516,-2719062,-17888413,11147233}},
+        {{22904553,-7637582,20344509,5916517,-2045850,7913359,-2194930,-4733023,-15426796,-5551949},{-33398610,-11306310,-11530310,16080212,-17465596,13112439,-17295699,3902823,18993749,5476335},{1,0,0,0,0,0,0,0,0,0},{-10803950,9895372,-8208941,-8867264,-9533106,-14791697,22832604,-8318576,-30032081,2720454}},
+        {{-7461249,8147749,26981542,-9635194,-12152602,-23994,28607953,14827851,-12745994,9815793},{18130156,7442021,-19592381,-12438948,15359641,-8055907,1106565,2707275,-15100778,-2328198},{1,0,0,0,0,0,0,0,0,0},{22467426,1066502,-15679318,2380320,-15259850,-1453841,15523943,11773575,11335366,-6487612}},
+        {{-9046981,13657064,18005947,16648077,-488107,3082116,-192377,2996122,-13288748,12187600},{-27197860,5122339,1784980,-7570897,425628,14126930,-15697855,-11512044,12554215,-11093874},{1,0,0,0,0,0,0,0,0,0},{18160619,8555782,-5261964,-11147069,-27349284,-15667716,-25609439,1198228,13940442,7409517}},
+        {{7194285,13920744,-14069256,-1536338,-22922943,-11268757,10695289,-4537045,-20560317,569111},{-9248264,-11472173,-23339232,13367405,-28497745,7921924,-27287685,4102450,26399561,10810914},{1,0,0,0,0,0,0,0,0,0},{14435887,-7045972,3933096,7873061,-1797474,15109327,14636701,-14658538,7073879,9041159}},
+        {{20593499,15182193,775455,11120380,10648545,-6448684,30056059,1082461,32339241,-11645385},{-9180673,-2716506,-288998,-11858693,12231203,1948473,32610094,7085233,-22686231,10638742},{1,0,0,0,0,0,0,0,0,0},{26741299,-2558582,-5375362,15311060,-9670788,979770,-15979804,6211672,-12263986,9529267}},
+        {{26965483,-2556868,10714593,8649665,-14547369,5740926,-26179251,-12779769,-28816203,-8353480},{3013781,-12393775,-30442728,3944000,13620117,296484,-30775069,-16551258,-27272569,-8561996},{1,0,0,0,0,0,0,0,0,0},{-2071299,-6354918,-13177469,-13074316,20366530,2897210,-17781769,44697,-817635,6126254}},
+        {{-20376118,1092296,9970074,-7436006,5535728,3712867,10313368,9864232,10519522,-10675971},{-19168700,-1649311,-15499658,11259297,-14966732,-6092829,-26112041,-12025900,-13951367,-3107950},{1,0,0,0,0,0,0,0,0,0},{-10156193,-4624492,31300147,-1262709,-18791803,11379977,19348048,9065010,24304693,-16152650}},
+        {{-16805704,16139814,23944455,3231744,24498430,-445580,27024239,-15710889,-6670431,6112057},{-5897109,-8077149,22681883,-15510905,14590795,1033722,-19099815,-14905634,-20006032,15994054},{1,0,0,0,0,0,0,0,0,0},{-13871101,-15138890,4594443,3200242,-10645368,478807,23722994,-15863770,23558275,-9551620}},
+        {{-25346129,-3549328,-17585058,13859840,-8793705,6461466,6603923,-10579051,2362995,-14710220},{-33235570,1915496,14738667,-2989665,18035381,6474780,-26888126,-15719614,21508981,1423026},{1,0,0,0,0,0,0,0,0,0},{-21905491,-11400708,-26021798,-2611969,10359443,2818615,-766743,7216305,-1292730,-1106108}},
+        {{9547488,-6771711,-33202078,-6772986,-11955115,15174243,-4551324,-7721275,25295858,-249885},{-26710923,7868512,6135665,-9376701,12428015,-14070950,-4626193,6486028,-1641608,14415234},{1,0,0,0,0,0,0,0,0,0},{23542757,-9142958,-11974903,2528831,9357773,-5644877,-20582375,10113242,-17165158,6975080}},
+        {{33328416,5195326,21106037,11235467,-4262698,8806007,-23425353,1051455,2096778,-1274108},{20782842,10987845,-1352592,-12605586,33194226,2863334,-15074052,-8376042,19057267,13218675},{1,0,0,0,0,0,0,0,0,0},{10626885,-6105358,-12750930,-14770997,21967168,15409112,2572871,12639257,-2292944,16745762}},
+        {{16559384,11237782,3032465,-16095242,-32324295,1608552,10093712,3300706,6175051,-10125524},{-18241496,-4839860,-14159254,1386850,-18560181,8868139,-5227025,1259234,24896807,-8051411},{1,0,0,0,0,0,0,0,0,0},{32410557,15534875,26210313,4203397,-29698284,-5817834,14765441,-8749775,3510281,-6563058}},
+        {{-21670140,-6741296,5288659,-613038,21597271,-5529984,9102657,-8661436,8942477,-14502809},{15077133,3624752,-1169784,-11456054,-11113705,-7370175,-4131636,2308934,-9035329,-10471901},{1,0,0,0,0,0,0,0,0,0},{-13472325,13272152,-25213289,-1235951,-26241788,167854,-10683409,9685040,21861618,-15481166}},
+        {{-33307008,-7294397,13626684,8449183,16629526,1133342,-8344018,-15642505,28717019,15841585},{-23952687,5079534,6623169,-1919028,19706576,2596926,-21599406,2090569,2985796,4067167},{1,0,0,0,0,0,0,0,0,0},{25722731,-16354438,22086039,3483486,-22885696,12829566,19428151,9478285,-33231123,13797255}},
+        {{-11366587,4314413,9547031,2481240,-3117077,12166431,21815129,10385360,29185633,9001465},{-21543280,-7455819,23254566,-16158023,-21180997,2630991,11428638,-6218727,252221,-2820305},{1,0,0,0,0,0,0,0,0,0},{-6875773,-7905645,25254928,-13515109,-23940807,-1034872,-24990360,15253254,-16299363,-1820827}},
+        {{-10443963,16496911,-16493459,-10105551,23497557,-13282786,-15706786,-3436835,8555785,4636171},{28569038,4504195,-22011999,15019883,8403614,-5860397,-27770762,11363025,-16221654,-6831733},{1,0,0,0,0,0,0,0,0,0},{-31235860,10033149,-5211027,-14913664,8792613,7712313,-24927668,-13022441,9126234,-12343130}},
+        {{1381724,-6181151,-1359162,-4062693,24051531,-12530348,-33251087,-8836028,17368420,13459986},{-26008461,1718243,-28425332,-16633187,-18186122,-14471892,23724399,-1393793,14444589,-14915242},{1,0,0,0,0,0,0,0,0,0},{15251024,15518625,14410144,-16336228,-3778538,4859078,-31872021,-1692560,13044047,-1045478}},
+        {{-17713711,7173747,22952947,-12586809,29587215,9806607,4101083,565483,-561353,-5453765},{28838025,13067258,-10205315,-10807814,-31646747,-16091553,-23096384,7955388,-23394689,-6806175},{1,0,0,0,0,0,0,0,0,0},{24379205,-2941584,-4584205,-3426403,1205958,-2804685,-19882799,12406546,-20318355,4682863}},
+        {{-31704540,-2028822,29046064,11567296,22789864,8811417,16575164,4924802,11510912,4846285},{-28608239,-15893119,-32717932,-6987113,-26462138,7201281,15945908,604826,-23841616,-3089347},{1,0,0,0,0,0,0,0,0,0},{-3285594,12460249,10091414,-7849249,-25994067,-635280,-24546967,-6281830,25031893,-13981961}},
+        {{6018281,-12755299,-18922737,10620368,-15957436,-2896964,21273005,11588418,25996456,10030475},{-18287972,-14416680,4194063,-1251831,16980150,13866509,-10084096,14957457,-21981166,-2868243},{1,0,0,0,0,0,0,0,0,0},{-4707996,-8889331,-7389283,76989,-20055732,6840250,5650914,570043,-26847742,7796168}},
+        {{27510521,-8060337,30181677,-8740197,-21968523,6593981,23946196,15522185,-6156385,11561780},{1767707,-4660142,-23336239,-11492598,23845726,-10682265,-6287622,13864347,-24231129,9719979},{1,0,0,0,0,0,0,0,0,0},{25884902,-3709463,-29790362,10798449,29293469,12906985,-18389840,5516575,-768880,-16539347}},
+        {{-14587016,3246695,25441711,-3204585,17723670,1538808,20847115,4339492,6479761,-10692362},{16947756,2077066,18054259,-13242385,30158131,-10476383,-6824590,886346,25295726,1937107},{1,0,0,0,0,0,0,0,0,0},{18456370,-9215246,-25367562,-5444395,-25544904,3164404,31244969,-10888004,16113477,10124501}},
+        {{15055793,-7168799,-27187182,-5342815,-19480119,2537076,32238181,-4415298,-22827376,6999937},{-25292961,-8248317,-22512760,7279358,31175988,-15281071,10455559,-14862610,30339207,5504170},{1,0,0,0,0,0,0,0,0,0},{1925607,-731387,-14731160,-16123479,12938664,15921153,-27021189,-12769981,-27263926,-5663008}},
+        {{24929934,12476384,16969310,-11415601,-4565400,-16236388,14007361,-8388012,-10875585,16104505},{12765252,-3590819,13400808,-13156841,-26883566,-7479168,-30449719,3239652,-16650943,-11512390},{1,0,0,0,0,0,0,0,0,0},{7217267,-4341534,-28348166,-2464876,-5779059,1157824,-8930080,-4438574,-3646708,-11642142}},
+        {{-7014419,2306116,-33479024,-7115100,-7988325,12319629,-30242553,-13653483,-33283473,-5777566},{12418705,-7812318,-7691124,12544252,-12364617,10298561,1647295,-8612546,-28940591,-14370048},{1,0,0,0,0,0,0,0,0,0},{-9154307,1106279,-9097298,2701419,10691631,-6874393,-5785014,-2943099,15020056,7049406}},
+        {{-23711176,-12128120,-3911553,10104574,18918788,16234897,9488543,-9776310,-8319737,13542592},{-5694754,-9035248,-6900666,-1827388,7721634,13586734,29242208,6607617,16192141,15134488},{1,0,0,0,0,0,0,0,0,0},{6086631,15261816,-29145654,-2328904,-21388701,5621991,-24824709,-9404709,11480876,8025171}},
+        {{-19556902,-3482142,-31125254,6734040,8152845,-12860976,-31393324,4397412,-27993038,10067479},{13111658,11549005,-19698604,-9855761,-18783328,-13905856,-30992498,-13660758,13554855,2137456},{1,0,0,0,0,0,0,0,0,0},{-17239527,-12239726,16318828,-10719033,-15792167,-7343945,24110643,8803616,24968395,-7484508}},
+        {{-15646905,15477807,-5940119,-8674252,-13646799,1289010,-28864476,8382910,-20183464,-13011967},{-19747946,-12446283,25254147,8640329,33097233,-8156514,10039951,368479,-13562259,6754305},{1,0,0,0,0,0,0,0,0,0},{10063261,-8290254,-8078632,-1099843,-6608795,6241288,3680608,4146126,-3582405,1892109}},
+        {{32695410,-15134125,-10291909,-11074154,-32064932,-7385015,-19917388,10671897,33519602,4855336},{19872567,-9309857,-396708,14304115,8866538,6386929,27638713,2622698,24039976,4240223},{1,0,0,0,0,0,0,0,0,0},{18865742,10151576,-1439061,-4950215,30423932,12976002,-13064601,16100109,-6087469,-397504}},
+        {{16985268,-7836567,10811225,11038925,28083679,-15459737,20818023,10125019,-12408480,6563614},{-19151103,-4968935,-10711867,15285120,-7367143,4143894,4283318,7813954,6997140,15951529},{1,0,0,0,0,0,0,0,0,0},{29666724,-3311210,-28570622,-13452533,-8359483,1517488,9805540,-4189743,7243687,-5364752}},
+        {{1199111,-561198,6851374,3967708,10165859,-5994622,29782468,12360166,4021139,-1160033},{-20747808,16447976,-32546910,1167314,2022354,7544649,-20794163,10802655,13273689,-10444021},{1,0,0,0,0,0,0,0,0,0},{28993392,-3805683,-30951784,-7692418,29761409,12587336,-13176252,-3269101,19680373,4805792}},
+        {{9214545,-14068819,-2627529,8904102,29706567,11658412,29486879,5374815,29540191,-11824041},{-14342787,-10813081,-1529341,-11671106,10119096,-9550582,-569181,-13384269,-9091848,-696861},{1,0,0,0,0,0,0,0,0,0},{-21879558,14301539,-151202,10976357,4338679,6816581,32882949,-13825824,25911041,-11494030}},
+        {{-17961351,-7916484,7568670,-13025583,-8475198,-13112336,-11773592,-10853528,-22555686,1148754},{-31635406,-1433680,1712296,12350283,5455830,2626412,-204830,-6303804,26521940,-2783748},{1,0,0,0,0,0,0,0,0,0},{-21358012,-6835471,13971993,2011475,-1548858,-3479564,8236277,10162234,-16513187,8906265}},
+        {{-32857398,-5065330,-7746284,15040305,-30690879,-5289529,-5055084,4806052,-19309996,11542633},{7849748,-8059136,13622633,1834805,12573733,8530371,-28683309,10659333,-16751617,-10465703},{1,0,0,0,0,0,0,0,0,0},{19762125,5350228,-1607013,-4431714,-20520812,6323096,26490543,2566353,4942035,1431862}},
+        {{-25020542,-1839628,23853109,-14841235,16362928,-8774812,24457250,8489084,-19485259,-815306},{10497232,14531935,-32175961,9323539,-935261,-4004984,2229772,-10879247,-29519224,-15457135},{1,0,0,0,0,0,0,0,0,0},{25747773,10167910,8536219,9881539,-12519883,-6749764,-13551037,6088065,14795643,1067113}},
+        {{8555315,-6349297,7783013,-5914817,1152698,7473937,20453184,2705251,-28582242,8917080},{-16394826,5956654,-4980738,16525310,-19431052,3610197,-17037502,8859027,18973138,4374986},{1,0,0,0,0,0,0,0,0,0},{4682451,8856335,19740211,9756766,25412207,-5198805,-15302149,-3137458,4931306,5548586}},
+        {{15953385,-15437018,21778641,1489930,30846684,-14654992,25869597,-1146880,-19564413,-6869206},{16754996,14112710,3410612,7523721,-33017047,-6942014,7204006,2609155,9980036,-9704781},{1,0,0,0,0,0,0,0,0,0},{5515563,11900392,20107463,-5352123,18731444,14092395,7586708,4047170,-1328109,9112097}},
+        {{-14911030,-4797730,33114613,3003445,-16817779,-3915271,32882950,6157066,-30823463,5054114},{18762180,15767139,-15467559,-9943414,19386679,-13720803,335775,8416019,3992118,-8214305},{1,0,0,0,0,0,0,0,0,0},{-9470856,-14416356,-20081006,7212308,20038666,-8127399,27172882,-2389590,29884371,-7583211}},
+        {{23853128,-15179849,1559011,-9129387,-6670403,14674693,-18872536,814668,-9457759,-5690118},{-17350784,-9244276,-4799404,14295630,-26130072,-15152892,4705745,9313208,-31902167,-9737329},{1,0,0,0,0,0,0,0,0,0},{24149911,6819600,-31160081,-6969531,-30606713,-8034568,30352120,16138082,11753319,15504617}},
+        {{-29110855,7301589,-16719896,1389325,14793931,3264169,3392069,14302249,26298193,-10260143},{-16026451,-12622713,20460465,-15116910,18537629,15632645,5812982,-14208862,31005447,-15357253},{1,0,0,0,0,0,0,0,0,0},{30274764,14142829,24580193,-5311154,22831893,-13673079,1093754,-7638186,28013971,-6512682}},
+        {{-11610703,11514552,-25445017,3336436,-9689163,-7783910,8563688,855240,7539238,10266798},{4245165,10759343,15034900,-7773638,23155709,4420339,-20285364,-5407592,22031003,12467940},{1,0,0,0,0,0,0,0,0,0},{25020058,-4426509,-32273411,-10272750,7524319,13935854,19681011,-16013505,-21523982,-15136057}},
+        {{-22035458,-3996195,-29591612,14816663,-1756126,7337768,2991072,-8124942,-25361211,-10962800},{-9868559,5362253,-23313567,2508587,7978141,14750955,26127974,7377906,-31974609,-1967256},{1,0,0,0,0,0,0,0,0,0},{-19593379,-13472952,7166828,5528871,-13195472,8623507,16307706,14468622,6306107,16076394}},
+        {{30051532,-5178892,24738453,-9333869,-26401125,-14245621,9501522,130568,-15299324,-4694454},{-13881016,4146503,-4767909,4339914,22840544,7574634,-8445889,-3162623,5992326,-1090424},{1,0,0,0,0,0,0,0,0,0},{-25326739,15996399,24636660,16243355,15635598,-7375936,-23147501,-7981434,16581008,7997717}},
+        {{-25020760,621313,1720795,58030,5236212,-13715827,10031938,7801852,2664400,15852462},{-32971645,-14827796,-16218868,-885635,24417428,-10724075,-18341471,8144332,11645593,-8037877},{1,0,0,0,0,0,0,0,0,0},{29023286,-2566919,11322680,-2056925,26275247,5716319,25527110,-7631644,-27143882,4374793}},
+        {{20824339,14166765,-25534843,6317096,27066060,4125724,-22920347,3133332,26534827,12701233},{-4937730,6432697,-28680378,-2378466,-21470994,-16725348,5286187,6346450,-4821628,-3311479},{1,0,0,0,0,0,0,0,0,0},{19235883,-236371,24218342,-5422164,17847391,-1538893,-7954353,-3916282,-4069457,-12637376}},
+        {{-25250675,-5613957,3268909,4544814,-14200438,-12994791,-21736301,9850512,-23760904,11089324},{5546086,15463109,-6975380,13265465,4923093,10310282,-20786165,-1767746,-28554527,241557},{1,0,0,0,0,0,0,0,0,0},{7098730,11828147,-30849615,-239805,-27604586,-8923444,16579888,11113981,-28411238,-13313874}},
+        {{9446554,-12230700,-15583491,-15567460,-11997921,8146820,19285702,-5737965,-26480435,-4285551},{4923809,-10494897,12730594,-3828053,-11759383,-15383684,26906586,12248616,20197643,2464339},{1,0,0,0,0,0,0,0,0,0},{-7214089,-1542108,7296576,2754621,29029923,-9043163,22785809,10569919,31107921,-11024828}},
+        {{26297736,-7923565,-6143126,12644902,27411309,-12229736,15851160,13366,-21127378,-3423513},{-33231772,-7647831,-19855347,-8254532,11220115,279982,13440064,5120830,5622339,-13539802},{1,0,0,0,0,0,0,0,0,0},{-33140136,9150085,28125366,-609188,-4801954,15261700,5963682,11641843,-20540900,-10207250}},
+        {{22389316,9272920,-29472844,-16723149,-23018719,15316586,-23063966,13255842,31722905,488502},{16775043,-7943077,-13777633,-15263056,18050732,-13644104,19951976,12723159,-27188313,-10019372},{1,0,0,0,0,0,0,0,0,0},{9222916,-9080415,33109208,-3170384,18270203,2830637,12860313,-4055040,-22445591,8458299}},
+        {{4608730,-9853760,2474607,2803237,18962410,3966449,-22919480,-4228273,-32537373,-16525093},{-20160849,9688629,-16295765,-14478416,10307346,14027493,5266893,14109091,-27849702,-11388999},{1,0,0,0,0,0,0,0,0,0},{31725281,-11560212,-5179111,-8942343,-23580211,-5706385,23027257,-5793929,-9155016,12539059}},
+        {{-13431256,-2173056,-15364038,11028238,-29887666,-3430605,28123812,11953983,13961003,-6670554},{-3821614,-11891800,-12320047,-9048387,-12792198,-7570822,19959386,8865483,-7695093,-12856988},{1,0,0,0,0,0,0,0,0,0},{-25843247,6673661,24380056,-6399036,-4150488,-8605960,-23099894,-14868064,-16835095,3106423}},
+        {{-21917611,-467164,-20016506,10457351,-26053806,10968386,-22516933,8917400,-22706336,-12120129},{8255906,13983430,-22526496,11592173,-21402073,-12072358,-21048287,4153856,-33060920,6663154},{1,0,0,0,0,0,0,0,0,0},{-15667351,-8578711,-11736109,6199184,-13886739,1881443,-30881586,-3346756,-28929497,13095878}},
+        {{-8213437,-10540506,11961761,12891865,24962421,2777985,30000378,15220225,-28511961,-16212278},{17037355,-1826840,20232622,2380891,-30503574,8014620,30017924,5383211,9277184,-16446113},{1,0,0,0,0,0,0,0,0,0},{-3329432,-10039276,-5430463,5506955,9310903,10166391,-25082526,-1837191,-33188612,-4801252}},
+        {{13200592,10456822,-2984819,4968824,33283832,-7806962,2545360,-6030693,-21486510,-16542838},{14839173,8239822,13202640,13965210,31219390,-6877350,-7829147,-15426316,2252418,5975924},{1,0,0,0,0,0,0,0,0,0},{9837264,16286539,-1411925,-10601000,18290279,-9761414,31218876,-2479654,-9061808,-6300231}},
+        {{-5082612,-2735270,-3388107,9801932,-28541813,-6575626,-13961570,16298818,-32014468,-14309158},{12533743,-1245416,20615405,12107542,33255657,10038159,-28605247,-13248746,9569614,15603229},{1,0,0,0,0,0,0,0,0,0},{-25435966,13029151,-4562122,3493030,8129286,-13142822,-1642414,9074665,-9671885,14486595}},
+        {{22809900,-7330060,-1847327,10172408,-26571736,1565125,-11744460,-15784210,28381574,-11207432},{8464575,4988366,67762,-6152802,9842783,-11819113,26191302,3372301,2815181,-13604006},{1,0,0,0,0,0,0,0,0,0},{-3742195,-6755025,-26371097,-408889,25234072,2614323,30974416,16117845,23864969,4533260}},
+        {{20190429,-2514351,-16454282,-12945720,-27980866,-6919620,-9890445,15400035,14920415,-3717699},{-11602017,14713978,-8973762,-10562108,-25897101,-5585119,-23465901,825540,-7508964,-2721251},{1,0,0,0,0,0,0,0,0,0},{12758640,-8459158,31291622,10310588,-751523,13295460,10681814,13702126,-28172069,-13329091}},
+        {{15044750,12196006,891821,3350906,28203389,-594116,24396627,3592181,32677024,1507486},{22146501,6540500,12174913,-6024314,4051274,10519309,3930994,14703897,27287827,9677379},{1,0,0,0,0,0,0,0,0,0},{-18560911,16676847,5746289,-14920362,-30340014,-14915626,19989798,13416921,-13161943,3989177}},
+        {{9136195,-10748714,-12868149,16542840,-11918916,-2017660,17062030,12282513,-30299785,12076697},{-13007016,13575252,-11996595,6418155,-2971018,-16283301,-6933766,14993300,14657151,2241790},{1,0,0,0,0,0,0,0,0,0},{-13083490,-6125555,13575298,-1393874,26137573,-10461075,20246638,4935425,11867350,3624240}},
+        {{-3005642,10435987,-12217237,-8998689,9779360,14863237,-25567260,-471599,32118491,10152463},{5967214,-12293919,27604168,-8663177,-12712135,-5753761,-31503661,817375,6349504,-12025817},{1,0,0,0,0,0,0,0,0,0},{-29390181,8995256,188487,-6525818,-7194343,935411,-7451966,4298277,18617004,-5691060}},
+        {{23203951,1161687,31002627,-2944834,-10009334,-2067831,-11771421,16685021,-32547586,-11682585},{-669343,7560943,-18828762,-1543846,-29054331,12131285,-9615304,-15937814,8280358,-7398564},{1,0,0,0,0,0,0,0,0,0},{-31143024,-5264973,31705782,838762,-28068089,-16109177,-25564017,9676100,32315499,-14334971}},
+        {{15052233,-7903476,14989980,1896115,26308515,9575408,-17109396,5073674,18667302,-2263117},{31653885,-11710200,7836394,14512324,22818942,13730035,-24286210,-6734374,-8235196,13629920},{1,0,0,0,0,0,0,0,0,0},{-29213934,-10208351,26645953,-793430,-16752446,-3466655,-5285419,8947544,6897916,-1720080}},
+        {{-7151954,12015866,5400227,9515490,31324052,10038703,19341177,-11968130,-20878552,-12320061},{-13057365,-6199307,16995938,-8294270,-25713296,-14553775,30729047,-5300338,-13249426,15023773},{1,0,0,0,0,0,0,0,0,0},{32661234,-11753665,-8495733,12835103,-27744769,1595590,13781521,-10286261,-24606770,-10058992}},
+        {{1126493,-8051109,-7333335,8024372,-28890311,-6736339,19430176,-4486480,32650302,-3248578},{15448557,1105737,-15543810,1346205,9476427,-3963777,1509589,-6556074,-30349790,13905500},{1,0,0,0,0,0,0,0,0,0},{1505699,10662329,-909946,15400245,2097253,16243190,21260470,-6356431,-6480383,-16207372}},
+        {{-1586126,568467,21932815,12221394,11987423,-15276506,-5619757,-13532107,-4168810,5402778},{20231963,8175744,-25924302,-12479035,-2047464,-2615928,29340745,13155002,8833026,-7720640},{1,0,0,0,0,0,0,0,0,0},{-26446559,1127329,-24501037,-12075443,-8849621,-8370066,13887730,11519248,-23590637,3786193}},
+        {{-32440693,4946868,3431432,16229236,23667915,3692612,-32383848,12556600,24572918,-15267412},{32436055,-12174231,18895731,-7005236,17947726,8326304,13401281,9363102,-4091068,-7593700},{1,0,0,0,0,0,0,0,0,0},{-3395790,-14998162,4139740,-9842468,-20789930,-2403894,-17519624,-2914617,29279464,-10838702}},
+        {{8541994,1593614,-17988225,-364724,29680023,-6223155,-24624459,-16715588,-2119309,-16482344},{11190176,-4680918,-17539375,-10892923,-20991127,-15876716,1021132,1160400,-15422268,-11504128},{1,0,0,0,0,0,0,0,0,0},{-16768577,8381351,-30304491,-965488,4800358,-2043604,7863124,-15448137,-32719984,13194364}},
+        {{33314422,-9672850,12430835,-1030609,27456405,-13389657,2092263,15160998,9742707,7430772},{21564537,-5556279,22663994,197660,4947413,-6065349,-17094523,-10883030,-20111217,-8050154},{1,0,0,0,0,0,0,0,0,0},{27351890,-11041166,17112511,-1583198,-8588952,7226687,22823484,-7284854,14535045,10020529}},
+        {{-28198446,3192516,20743543,7515206,-27477545,14042174,8372332,-15097053,26370870,11679408},{-6204080,8052308,23229276,10057214,18603724,1553994,4188966,-10806318,17672459,9135396},{1,0,0,0,0,0,0,0,0,0},{-4561896,-15473171,-21404622,3790129,-28243343,-13184587,4580253,-15106505,-15629680,15533359}},
+};
+
+const ge_p3 bulletproof_Gi_p3[BULLETPROOF_GENERATORS] = {
+        {{-32411572,16498223,18842421,3439697,9844813,5364299,-27496331,-15811675,12991590,4540145},{12470283,-10012396,-2137482,-362486,-30451043,-3627091,-29259691,7025564,-21321829,5651591},{1,0,0,0,0,0,0,0,0,0},{-15199492,-7942429,15733328,-7031570,12314950,-9819665,-13982120,-12309386,26415736,-9831026}},
+        {{-13463563,8123226,12699497,-5107781,23087087,-3323011,29708472,-11749059,3517125,-7276399},{-22740513,9408246,21432071,-1654823,13729187,9593149,32934765,10741929,-14831663,12028355},{1,0,0,0,0,0,0,0,0,0},{-27201121,2023129,-7624438,4446981,-17329139,15263778,24009035,-10041561,-8337782,-12040948}},
+        {{-20966596,-12346063,17299563,4694484,14307591,-4940317,-4937649,8009328,5360033,-12320757},{29911411,9529845,12896168,-4388584,8305024,1833137,18960011,-15681115,-11706730,16064662},{1,0,0,0,0,0,0,0,0,0},{-16696438,16247853,9082729,-15868299,-2262592,-5455771,-29516235,7940983,10098809,-774076}},
+        {{13435727,12186222,20831343,16098565,-27573937,-1594512,23172533,7518598,-20798209,5817894},{-8535916,-6425077,9942660,-4003668,12851037,2844414,23230524,-10661047,23929583,-7884861},{1,0,0,0,0,0,0,0,0,0},{10291065,14295754,23391612,11380480,-21914532,982183,27363296,12384104,-16934957,6836322}},
+        {{-238316,6442782,-33121462,-780071,-3605135,-10292643,9560706,-9083230,18599943,9398960},{-20605413,3057,-21095058,15156987,1493107,-14028990,-3142389,-3472433,-7346558,-16008094},{1,0,0,0,0,0,0,0,0,0},{32786791,-13236223,29757029,-8581227,18781310,-16293800,-3912397,-14594708,-22543176,-3760417}},
+        {{22088382,11359453,15400007,-2430804,-25388156,-8953486,-12610031,15592335,19442736,-2838910},{-18888651,-5534585,25034170,9137918,-28798122,165020,-18508976,8130193,-20755906,15746953},{1,0,0,0,0,0,0,0,0,0},{-1727935,6348730,-5283402,846589,-33479429,12967526,29522130,-13626911,-308173,-15689948}},
+        {{-3084783,9224050,21748442,-13051376,-8362855,-10079640,-8080975,-5719377,18335498,15795895},{12347372,11205061,4386203,-4106346,-16117651,7894346,21951657,13367436,22581473,-11499600},{1,0,0,0,0,0,0,0,0,0},{-30205785,-5504444,8825591,763998,-1596706,-15052133,2682088,-1570388,21224249,4083120}},
+        {{-30316339,-2523546,-15654804,-15547645,-22966518,11958724,-2618195,-7790966,19433280,14836392},{25404379,-15999225,19122949,10126990,-19451012,10331884,5261563,-4825008,-16583436,-3496525},{1,0,0,0,0,0,0,0,0,0},{24889225,7120373,14721458,8990268,21076284,14761578,-32043546,5853262,8305619,16556476}},
+        {{12430433,-15206745,25176330,-12219896,-25524629,166702,-9100650,12983343,-31806033,14459727},{29883292,-16192509,-22498859,8134570,33458554,-15886224,-18024951,11474567,15902946,13375553},{1,0,0,0,0,0,0,0,0,0},{-17983071,10968945,-10055513,-4477777,-5718447,-13867178,14481654,6528858,19448952,-11600681}},
+        {{-26471432,12970825,22390985,-2027456,2529908,-866882,-27744581,-15130607,-8884008,15907992},{-29841856,-7773027,22383924,-6491120,-27155168,9204375,-26910714,-3297636,-14699413,-10147303},{1,0,0,0,0,0,0,0,0,0},{-11009882,13600705,3270207,11260205,-22945609,-5895055,18234750,-14023187,-14565521,-6342719}},
+        {{30611608,-8076682,-32870114,2318643,32999414,5164895,-10468219,-9173273,-30310437,15263067},{10598840,-14817515,-15640067,-15028842,-1394045,-3028315,-32708333,-2010221,23871247,-10304471},{1,0,0,0,0,0,0,0,0,0},{-5421524,15501773,-13980203,-16102054,2417542,12657865,2078905,8856964,15339402,-4657797}},
+        {{-32632673,10474400,22753639,-9938021,-20870537,-11578584,-18502486,-4486925,-8574149,-14956632},{1533952,-6461358,20170795,-10548714,-18057662,14665264,-6737845,-2508438,-10542073,-2527395},{1,0,0,0,0,0,0,0,0,0},{752344,-1900013,21970920,7599766,14450894,-10482658,-2384989,-6143378,21141408,-10640350}},
+        {{-25171120,-7132673,-11663959,-7958417,20815173,-8633660,-3660017,-7932818,-33136139,-2388342},{16166754,8472135,16115044,2682540,-33204275,-8599495,-31250829,-14149430,-5343908,-2080560},{1,0,0,0,0,0,0,0,0,0},{10240605,2911698,5288631,12841184,29799776,-7466503,-28658409,12143331,-25678194,4232026}},
+        {{-21006351,-4412966,-16636658,10953251,21789376,11354580,15376962,-11529294,26317680,3714931},{-2288818,6080799,13081635,-1791793,-8095265,-13178898,-504677,-10880846,-25106274,-5013489},{1,0,0,0,0,0,0,0,0,0},{24791544,6503209,28445298,-12722740,13591563,-5705912,1350544,-16246784,-24643683,4559725}},
+        {{20225060,4415270,14737170,7486799,24737418,-7366119,23452863,-3465312,-25524172,15978003},{9898682,-6021220,1353003,-11484305,13188698,-4522193,1537748,-1465425,-11661612,-13643386},{1,0,0,0,0,0,0,0,0,0},{14691676,8992383,18770628,15172980,-2253900,-13057280,374327,13240852,-32707873,-1601230}},
+        {{-15626533,12565482,3327868,13079840,-32363863,1639665,-3865730,6944882,20952801,-16595143},{14391341,2786099,29526692,7841947,19257148,13872413,-27432651,-15234346,6481249,4425139},{1,0,0,0,0,0,0,0,0,0},{-14787189,-12582929,-17765859,-12389941,-20834689,-6921469,-25357859,-3197792,-1889478,7992668}},
+        {{28922018,-2799728,11907306,-13812783,-9128358,9891010,16641202,9048941,-18254297,-13758179},{25380021,-7524537,-22390695,2264077,20041323,6185582,4599841,-3200064,10935736,13423140},{1,0,0,0,0,0,0,0,0,0},{-2813770,1367538,5980419,6788903,23169897,-8503221,-5988932,1484465,-22539358,12815769}},
+        {{19520806,11022900,33019061,-1953419,14849431,-7285391,26434065,-16323094,-30746293,-4173967},{-1793993,7243573,-32478496,-2725645,-18204180,-4217116,20354922,2262723,8925467,-11403225},{1,0,0,0,0,0,0,0,0,0},{-3094284,3109050,-23993733,14078578,-31752174,1755314,20734899,-15214495,4345686,7264939}},
+        {{-364188,-7423365,-13916851,16164906,-8124319,8930182,-12611309,832401,-22434938,-16018029},{-20747161,15538044,11730895,-15422128,-3627156,-16571607,-21018454,4400492,-17526813,-10487055},{1,0,0,0,0,0,0,0,0,0},{-18760748,-14541778,-21763233,14268274,-29244414,-8799370,26370248,-12901653,24868706,-11385193}},
+        {{11662633,-14553989,32539833,-15066615,16407767,528743,10253353,-8873289,-25732680,431041},{22367526,-7748837,-26379873,3334160,9722244,8953203,21277646,-15307073,11965341,-8468957},{1,0,0,0,0,0,0,0,0,0},{317331,-4015110,2356775,-14179737,-1602916,3124287,-32016882,596708,16480634,4560094}},
+        {{-30873649,-14708175,26843719,-12395124,-21305995,-11039946,10030977,-16663402,27375197,-14696794},{11321364,-8545239,5127533,-1861884,-15044957,15073130,20419800,-16227716,8551483,-2816349},{1,0,0,0,0,0,0,0,0,0},{3585749,13347319,-17759521,-11117852,17452778,10593588,-28160178,2298305,-30762996,-678600}},
+        {{-29585933,10745556,25132121,5690659,12403741,8537366,20584010,4083126,13090354,6373636},{22709506,15594249,22136299,14585391,19665047,-2954742,-16696344,-14025948,31461176,7748076},{1,0,0,0,0,0,0,0,0,0},{9217168,-8856261,2653548,11617877,22181117,5454149,10579049,-14354271,116063,11048896}},
+        {{-23795845,-11603958,33392279,-16716431,1871149,9868695,-32612372,-1278720,-14639178,-5471508},{-31641142,5333805,3146169,-6901987,-2028049,-14581532,1455399,10029256,13967613,-11662051},{1,0,0,0,0,0,0,0,0,0},{5623872,-15962175,27532923,-12141446,-25930594,-10957588,29383136,-4526031,9180279,14429193}},
+        {{24550306,2912407,-24017005,-7624421,-6788980,-12692922,6880457,-3075271,-20948654,-4674893},{16862496,-2891992,32609847,604737,27225408,12169428,4408295,1222556,-4948907,7866468},{1,0,0,0,0,0,0,0,0,0},{-8205103,14799376,-1611916,-424952,-4878669,4758638,28871885,-6170881,-12599349,4703717}},
+        {{19850416,-2021159,24150976,8958482,11016712,-8725889,-16573036,6050140,20982977,9801412},{22441732,-5735862,22818073,4602829,-2796082,-15983626,-24899618,-11936761,-20628280,-10580649},{1,0,0,0,0,0,0,0,0,0},{18917388,6389007,25473007,-10166699,29453375,5362292,-28831338,2109825,22029989,1862078}},
+        {{32686704,-11534995,6095843,5920714,10252916,-2595947,-25569425,-12209263,23723473,3718604},{11900737,-9791853,9947382,9299673,16447236,4612843,18323114,-12673877,-25343788,810371},{1,0,0,0,0,0,0,0,0,0},{184747,-3903188,-26512395,-1412650,-21295723,700714,20904161,5655734,-25112081,10357697}},
+        {{-25669993,-4520536,-13354012,9612987,-26063737,2569332,22469267,-410906,-4977228,3737866},{-2768930,12020583,8179591,13581231,-7782397,-12603022,-8644982,-4045940,-26221236,-2488454},{1,0,0,0,0,0,0,0,0,0},{17471665,2816730,-19103762,-2839132,-11364615,-14413601,-13346269,6117740,-1172371,11400295}},
+        {{-2852845,3504138,24926472,-4061148,9179629,-10013813,-11088478,15651368,-21212212,16584837},{26156189,-3171366,32491407,10314431,718372,5821824,3226741,-3374210,15576162,-4460552},{1,0,0,0,0,0,0,0,0,0},{-14024116,1013053,4086865,-13091492,-767558,-4782988,-3794493,-2180133,-30430347,-10222842}},
+        {{32835262,-2579942,-13859132,-11804070,-18855607,-11984348,24471952,8766660,11953344,-14086557},{-6532912,-6085995,-5438777,-14101583,-11802852,14147243,-26392564,176837,-32472010,1552905},{1,0,0,0,0,0,0,0,0,0},{-1689106,2795696,18549667,6182663,-7849663,8674086,-1704895,-3178500,-25251525,8979328}},
+        {{-5280036,12686137,-5679324,4416874,17978822,12576736,-30105599,9386013,33444606,-5723200},{-18597201,16671970,12191842,-2136187,-26234377,-902248,-20630646,-6183059,-28242086,-16741206},{1,0,0,0,0,0,0,0,0,0},{3135745,5245776,-7454365,12410877,19794065,7679155,4593020,-7031684,-25810604,-6252044}},
+        {{5078634,11313982,8701446,2391491,27665834,14225956,30044819,-9901392,30280941,-12570268},{-11336008,-15555430,991114,-13237837,14851882,-943052,-7941145,-3435240,33164109,7081494},{1,0,0,0,0,0,0,0,0,0},{-12078108,-12836174,17326713,587141,27266732,-8350719,15365836,13284352,-5023872,-12678784}},
+        {{-8215521,-16659458,-28984300,-2435574,-26560475,-12490690,16478609,-13368279,7879461,1815419},{-14190718,7907732,20440751,-3031692,-9869075,-4381607,24515878,16606532,-28409875,-16275957},{1,0,0,0,0,0,0,0,0,0},{22670907,-10608133,-9617460,-3242451,18805782,-11253557,-29794790,7195146,7931529,12363929}},
+        {{-13874674,-4057978,6997708,-215472,-5664614,1841773,-32954826,-1493804,-17889925,15318689},{-18196410,10819565,-23173436,-8430152,-4518009,-7079953,-12569790,9228173,21771849,-650621},{1,0,0,0,0,0,0,0,0,0},{-6073948,13724577,-21495114,14653717,-24473581,16355401,-29165464,-4464844,-16868055,-14364573}},
+        {{22008312,5528371,30642456,-1816059,-3343481,9873014,6822602,1223476,32235512,14230286},{21693190,-16074763,-14043819,-9793751,-12519512,9828214,-858851,-11288088,9757577,-12498511},{1,0,0,0,0,0,0,0,0,0},{-5146294,-7050609,-23491466,-14888575,-23124697,-8099197,15210178,-12247450,19670932,-11505551}},
+        {{-7434552,-16150946,21678966,-14210290,-15334703,16477507,18804073,-9192168,32646303,6505358},{-9011536,2603526,-32866523,-11574089,-10244579,-11671564,3251402,7234807,-8710227,7701135},{1,0,0,0,0,0,0,0,0,0},{27037132,4088651,-15844179,-11207659,25559680,-9178318,24560707,12377705,28237715,-13674414}},
+        {{-14255968,14557124,15384513,15158594,-21848094,-9040259,-23274160,-12007236,30288118,-9425529},{1284040,5726349,26204890,-7255486,32145994,-6921664,7625147,-14708273,-16230601,12190737},{1,0,0,0,0,0,0,0,0,0},{1545128,8518098,-13332261,-4630869,-15769729,-6529015,-22901343,5643253,-8756851,4883127}},
+        {{-18685998,-13990436,-519192,-6016661,-9359883,4674542,-30146011,5816473,2566722,8345582},{-33131415,-4320331,3381234,15295677,31592776,-5403003,-32031677,-6462949,-29109764,2007599},{1,0,0,0,0,0,0,0,0,0},{-24477816,5289134,8328024,-2714327,7573628,-15156940,-16660859,3772046,31365377,-4262209}},
+        {{27538887,-10107095,-10903838,-7884546,-29851576,-3102388,26792775,9413239,28545161,14075159},{-29990250,2764843,19534174,12249225,6537117,13379531,-2037388,12490027,12965407,-5625645},{1,0,0,0,0,0,0,0,0,0},{17626252,12324764,28977387,-6975569,-14808578,-14750996,12225614,4336672,-12880706,-12183046}},
+        {{-9040107,-3312032,-20409726,12613642,9712854,-6800141,-22272557,3214054,32851021,13758629},{986587,9238474,-20498473,13496168,-21063024,-5614679,27119655,13966061,-19279328,-15250980},{1,0,0,0,0,0,0,0,0,0},{-33213621,12696250,-13441985,11830450,11040942,5920280,1545746,-8396544,-12349963,-11351387}},
+        {{31070083,-14506786,-16756577,-6641249,-10453110,-6304104,10462334,7136975,32385204,-759900},{-32383303,-3771042,15897205,896147,32947705,-14266067,-30687668,-6160511,-17712915,7761249},{1,0,0,0,0,0,0,0,0,0},{15078129,11841817,22754858,2323950,-28563593,-15225209,18578490,13044761,18527398,11224480}},
+        {{31104435,16018667,32035599,13849923,10269119,-14020416,-18358409,8485410,14131479,1553114},{18451796,8243767,2763165,-7246907,-13890375,8747173,27562554,-1644209,-6226460,-10013805},{1,0,0,0,0,0,0,0,0,0},{14553465,-11191622,19875621,15857243,-2203572,-5594812,10690093,218407,10418406,-10135675}},
+        {{-33062993,-1963462,-17426728,16119078,-18763835,11441697,26136111,11045692,20675502,8002487},{12569419,15433000,-16919836,1798079,-20784329,6698603,29000582,16339514,1258004,-5937191},{1,0,0,0,0,0,0,0,0,0},{-6289877,482599,-18294437,-2721817,-24823288,-2566812,-27651868,-10111854,11402471,1446755}},
+        {{1909759,4618980,17736544,4335670,1029616,-14864871,-1874737,-5766505,26145342,-1619380},{7360276,-8481910,9797461,-3400227,1051450,14462709,21402388,-9344912,32635014,-13911881},{1,0,0,0,0,0,0,0,0,0},{-12951043,14391512,16289444,14629817,-15132518,-105129,8124434,8402282,24735074,7822620}},
+        {{20713765,-16459207,-744628,-136113,-13356238,-2324156,-87584,2204310,-3437153,11001021},{17749207,-1355916,-19769013,-2805595,15464449,3928952,-74984,8161068,29583108,1980343},{1,0,0,0,0,0,0,0,0,0},{20842044,-9401678,8723600,10576878,2773709,3432791,-10581925,1236950,-13267076,-16375915}},
+        {{-7064020,-2965979,-9148699,-8981910,-10229151,14178417,12324973,5403444,32491947,-2588288},{-14138449,-12676916,26604899,-2053085,7059480,-2592303,-22850288,1883120,10183406,2185594},{1,0,0,0,0,0,0,0,0,0},{-17762256,1462964,-2614469,1474903,-2167857,-1679138,11759007,-1211715,-23607928,-1364852}},
+        {{-19680164,4676626,8734732,11581918,-10699203,10755201,18068097,-11997,-32763374,-8205777},{-28786447,8624574,-4520473,-11335834,-29206571,-9548563,2507222,5839832,17519078,-2188308},{1,0,0,0,0,0,0,0,0,0},{29067596,-5997337,25340205,-3058714,8891077,-5190074,-19184278,-7414665,-11300182,-11791843}},
+        {{19512683,13116359,-31009736,62103,-3971135,-1826825,18125758,-14441783,752905,-7145650},{-8981312,-36699,1067435,7814417,27440588,3326948,-2341084,2082365,32628950,-9290322},{1,0,0,0,0,0,0,0,0,0},{27073672,5085571,24047361,754006,-2242284,-13842985,-15885734,8762022,12726849,5921852}},
+        {{7875822,12126066,12774161,-10153828,-21842527,10509580,24368949,-4853505,141910,-10390449},{10250687,-10816506,32960122,-8935818,32161185,15368166,-14453597,-11784868,20105808,12317041},{1,0,0,0,0,0,0,0,0,0},{-16995814,-13417846,6082257,179595,23711012,-16592811,-5170342,-1361648,1803861,-2774943}},
+        {{15636876,15999148,-4709205,-40660,23104215,-4259848,-6151276,8676455,5649941,-7872698},{-13380182,11169876,-2835817,15108794,-839256,-1518864,23437910,12967778,33338614,13240691},{1,0,0,0,0,0,0,0,0,0},{-21611999,-11218254,-4366257,3107012,-8119378,14175208,27773710,-7488574,14926816,15279887}},
+        {{-10589263,6448019,-9902401,377838,31174541,13819104,-31898299,10373434,10658617,-350136},{-27096814,2650267,-10762904,-3345356,1958839,13864243,-4104871,-13913977,13047420,2228835},{1,0,0,0,0,0,0,0,0,0},{-23409132,-2126608,25046015,3386113,-1103920,12717267,22309972,9199001,28436277,14770762}},
+        {{-8116236,13361084,20055738,-13544895,-3902726,13770600,-19082674,11792980,22743404,9147786},{17157933,-13277489,-25157596,-13475611,-23745575,-12603940,-22009302,12529393,-11542098,-12356374},{1,0,0,0,0,0,0,0,0,0},{-1553865,-1882291,-6814445,14101755,19640246,-6431119,1098154,11474291,-10031539,-2815111}},
+        {{-30644009,924644,22402239,4851966,30284316,-9333563,-1540274,-5471956,-13582048,-3696059},{-7293436,14613127,1895261,-11573836,24107488,-7445860,8742671,15670298,-12835732,-247240},{1,0,0,0,0,0,0,0,0,0},{-26449282,15623861,-23651254,-10595735,-28932344,-5697884,-20495969,-10753540,27342942,7686615}},
+        {{-2701200,4458670,-18549170,-9315558,-21394432,13202584,18176645,-1813798,-29971157,9390606},{8957977,-12950884,6480438,13356319,23813894,13232482,-16741392,-9354990,13860799,-1936502},{1,0,0,0,0,0,0,0,0,0},{17518239,-10601075,-13027271,2168885,29262177,-12135355,-5709116,-15608270,-27626182,228733}},
+        {{-4897771,8620830,7308881,-10453745,-4885575,175845,-11434987,3689846,16889701,-10223145},{32615571,14028930,4923049,-5673339,-3354502,-5208843,-32706175,8665477,31393976,16023231},{1,0,0,0,0,0,0,0,0,0},{12959622,-4009382,-26543672,-2315698,20851799,6214769,-6022528,-7148468,-21300704,5798608}},
+        {{-8315401,2214859,-21256715,-8205966,-20659365,11038823,14263599,14950863,20393429,16073468},{16789898,-2368302,19480095,13390441,-23285379,-13223385,-33144310,8902243,11327551,2813295},{1,0,0,0,0,0,0,0,0,0},{-24789958,11265106,-21112307,1035591,18664554,-3417459,-28715463,-15604385,25122507,4138855}},
+        {{26198038,-11100980,-17335278,12805824,11049210,-7000572,-24450610,-4223897,11299103,-8811422},{290892,8236595,-3880242,-12386532,10142773,-7414203,21599531,-13960222,-27063801,112339},{1,0,0,0,0,0,0,0,0,0},{-23883529,-5313845,16945987,-7695428,-10269922,11603779,33259597,-13796098,-2416986,-6722888}},
+        {{-32664609,-16114892,33274978,-4038344,23989251,4257077,-23215831,2199994,23370869,-15263362},{-26464549,-13505342,5981006,-11937350,8218241,-9992903,24113061,13642966,-17660255,2607826},{1,0,0,0,0,0,0,0,0,0},{-2304133,9318129,25236650,1248222,-32288153,8079896,-28317297,-14198609,19019301,6545236}},
+        {{18428475,-785469,22658027,-14345033,-5360775,-3606546,-21876322,-1887108,-12575443,2055998},{-9487475,-13174044,15165501,-12401237,32553586,6581533,3504644,-8850804,-25685467,-9992612},{1,0,0,0,0,0,0,0,0,0},{3598746,-14560712,-14926634,-5436441,27052551,-9090726,1618084,-15921217,7986188,-3503992}},
+        {{16486425,13032165,-26003829,-13399634,4688887,-11667708,-20963773,5428268,-32284705,-3437792},{-8139776,15257045,21629539,2499918,-2243815,-9533808,20412290,3766648,1669020,15124757},{1,0,0,0,0,0,0,0,0,0},{-3686848,-12718112,-31180195,7852978,-20807608,-5749138,2603823,-15955551,-11269841,13922673}},
+        {{13390000,9803555,-10345200,14445234,33148429,-3861194,-25930278,-11281783,-9428978,-14704301},{-15595079,-8504401,-9253153,-11541775,32013714,-9416335,-27575612,-5458992,-10774081,14544548},{1,0,0,0,0,0,0,0,0,0},{-9284633,12662875,28389420,8440800,11878576,4973210,20793079,14950254,10357755,-7434981}},
+        {{4457694,14490847,-4257605,7602303,30854244,11368051,-7881281,695359,-14506688,15617732},{18930320,11507149,-22541062,-10668221,-15656741,4565218,15477237,1870156,-17444759,5626328},{1,0,0,0,0,0,0,0,0,0},{-10344067,8589194,13066005,13471701,11526653,-1391135,14572986,-8884655,25223746,14893509}},
+        {{2252770,-13284795,1569593,2478077,15395748,-96660,-9383215,14983712,-28786570,3729904},{-891467,927275,7718192,6663550,26909327,11938219,-8298391,-11766893,-8121417,-15865329},{1,0,0,0,0,0,0,0,0,0},{21008339,12412909,4333530,-7610058,31071953,-3453267,21458670,-4357937,24039651,-8044362}},
+        {{-8714442,15948415,9106036,4009183,4774512,-12625142,13062997,-16575078,1997420,4347028},{-2719446,3396983,-16519832,-12221933,28310047,9361451,29824163,16285082,-8813368,13441485},{1,0,0,0,0,0,0,0,0,0},{-14940938,3174993,21832948,13394176,30611076,-10320980,28447300,-14113690,-18410153,-12527391}},
+        {{-4658678,2026596,12634997,-7103134,-12575931,-11196450,-3740077,9566343,-4779140,13396861},{-8724942,-12812852,-5544767,-6286994,-14889214,5322841,31886976,-10798122,-9397823,-4726010},{1,0,0,0,0,0,0,0,0,0},{-20575889,-14796669,-15111762,-4869998,-20773551,-4509407,26302413,-5169601,31569845,6010961}},
+        {{33535655,12166215,26445328,-12040355,8169340,1968703,25465666,-5984699,-30507274,-4792098},{21448299,-7594795,-27173702,-10965541,-30054225,6237067,8310745,4889652,-27888069,-6524180},{1,0,0,0,0,0,0,0,0,0},{29727438,7191576,29499883,6972512,18657963,10674874,-5747280,14207730,26639668,7658617}},
+        {{-29198800,1886601,7973970,15640029,12107406,7290379,3199338,-56071,-5050565,3485005},{-2262597,3479671,28757217,7806894,-9491394,6263451,12490289,-15440227,-25624015,-7059606},{1,0,0,0,0,0,0,0,0,0},{24699075,3545136,-12514720,-15606247,-27675839,-14390050,14545522,-4177420,29181234,-11878509}},
+        {{-21516181,6084591,19055105,-6998310,-28699469,-2627759,-30351841,10637084,13728587,-553506},{27827164,13270884,-805961,3289448,15094847,14302477,-11577431,-4273665,-30444844,15523989},{1,0,0,0,0,0,0,0,0,0},{29901316,5876697,16102699,-9218925,-25952769,5936271,12045193,-9026262,22849781,-3311296}},
+        {{-5140420,-14473096,-19644357,-7426505,-18564142,15337743,-889956,13271213,-23536179,-3952864},{1818277,385769,-28374328,-14046937,-31890706,11715740,6700252,-12954823,-7593104,-11436953},{1,0,0,0,0,0,0,0,0,0},{-30808439,-14933864,8336437,-12729963,26310296,4999212,17045342,11788323,9343440,1770128}},
+        {{-28450546,-11883829,-11352350,3948396,-28701335,-5622648,10386770,8959829,20541941,15226898},{-2620025,-3031332,-27858253,-2248924,-24407136,-2378348,8650809,-9592807,-21324437,-8159309},{1,0,0,0,0,0,0,0,0,0},{28999696,-12254768,-27401591,9209284,10207998,3573507,-6415684,-4568928,32198900,8938706}},
+        {{-5378980,11730965,-359009,1421001,25005056,-6740853,-483780,-14178389,-25063201,-15523307},{-25674579,12104679,-23738754,16029961,13733848,4158718,-18891868,2910042,-7454793,-10916582},{1,0,0,0,0,0,0,0,0,0},{6050155,-533466,-26992253,8636034,-3498789,4079073,19906191,-11627978,30782896,9058032}},
+        {{-3668319,-14907304,19648105,-14479367,-28002869,12802483,13655044,-10644520,28672515,-12232047},{-19204805,8578236,8547459,-11842715,-931586,-24696,775409,-16146169,22799472,10626318},{1,0,0,0,0,0,0,0,0,0},{13721683,-1058644,12430766,9984793,-31032135,-2764761,-9509819,7063460,26803310,-10818774}},
+        {{-25210940,-4853410,-29962077,897529,26977104,15592605,-21970407,-7551150,21134154,-16154653},{8623526,26641,27026379,-12240631,1054625,3904873,-12461075,14202334,-21341659,-12333965},{1,0,0,0,0,0,0,0,0,0},{-15302427,9016161,8240970,10307753,18210689,13857811,-13161896,3984445,28874976,-15016290}},
+        {{-25798676,11471174,531967,6854151,-15826069,-13785864,-7648637,12667222,4954498,-10520610},{-7197793,-12780211,-19291283,-7086012,25259608,1971374,-26253974,-10564693,22652433,-11942527},{1,0,0,0,0,0,0,0,0,0},{-33248564,-10939912,31936144,9681685,2078540,7622792,32228698,-12845531,-762902,-7360081}},
+        {{-17065049,-314673,6095268,-1105142,326263,4458673,-6338822,-392086,5808546,-12191959},{32128495,-13633086,11144203,7984895,-2616450,16127588,7197293,5921143,-18436860,7634735},{1,0,0,0,0,0,0,0,0,0},{-25483283,-4251133,22328228,3293086,19452467,-1054088,-21398199,9692747,32783363,-8125961}},
+        {{1062011,-14787079,-13300566,8672145,-13985495,15019990,10071331,6584231,6347897,-12285376},{-22131269,-15323055,5269076,5149624,3431160,-7642449,21564590,1619518,-31662417,146319},{1,0,0,0,0,0,0,0,0,0},{28950321,-6870225,-2671800,4642863,-21063830,-5370405,16364372,-8493440,-24632755,2387570}},
+        {{-16635783,7816780,24948884,14572683,-15360023,-3815521,-23137433,15221344,-29526018,5704313},{30062490,2419427,17302186,8293074,-22173726,-7648432,27441025,-13305656,-10497173,-13462403},{1,0,0,0,0,0,0,0,0,0},{15120112,-4116654,-18245042,11719462,-15061336,-10489696,28440519,-12518741,6555661,6780091}},
+        {{-30850499,-7864562,-13501117,-1477350,30058901,7526287,-16065842,-16279368,16263350,-900553},{-14385822,798459,5473051,2896578,-14547,-3543416,322524,-5469224,1460666,15363748},{1,0,0,0,0,0,0,0,0,0},{980355,-2037180,-11621172,6119875,-30843508,5888334,19436713,-4006387,26909367,6304026}},
+        {{18489209,-5766815,-31541608,5819472,26892069,-1860579,29232447,4509009,-27823895,16291271},{28293341,-10030672,-656047,-12892262,20990842,-3175719,14246679,6527740,8323821,-13367213},{1,0,0,0,0,0,0,0,0,0},{-6246137,-3522277,-27856818,3071153,27787853,-14980473,10380045,-9950974,-2962181,-2947594}},
+        {{33190949,-10144026,-10501339,-7933309,10964794,-9727500,-18913335,4269821,-21672764,-7685693},{16998246,4755265,1161397,-10083313,-21399316,15409291,11207796,11915011,6567316,832851},{1,0,0,0,0,0,0,0,0,0},{24356234,-3237130,-18264918,347248,19053912,-274644,-25882676,6649524,-14952492,-8697813}},
+        {{-21515464,15256159,-27894544,7806238,-32070422,-15364732,-7186798,13172236,-3693130,-9234575},{-11762132,-15475330,10261325,-832693,24928663,15096247,-22703156,-9532055,-9102935,-11288584},{1,0,0,0,0,0,0,0,0,0},{-18277046,14990309,864118,-10522931,22970490,-9122847,23451533,12418081,-25695247,7482005}},
+        {{-29247678,13849537,1963963,-2875649,-13889299,14984541,8648758,6452606,20955469,-4105179},{6310093,1650599,-20761492,-14353772,26473180,-178889,-30283369,13545956,19401671,4246261},{1,0,0,0,0,0,0,0,0,0},{5470247,-3404753,3593256,16251704,-17824156,8549942,-32834685,-6574697,1980217,-9661600}},
+        {{-28341505,-15301786,-29572625,-7858098,-22899621,-13337184,-10440083,-12609791,-14530850,-6662017},{21151090,-2202343,29085496,6232537,-11301785,8595665,-995934,9292135,8037282,-2207662},{1,0,0,0,0,0,0,0,0,0},{-9106371,-13279890,32666199,12119499,25542374,-11269698,-4243831,4652368,-1728067,9238445}},
+        {{-32251245,6230509,16839155,-16078461,-11120179,-6902346,22409919,16035190,-7706777,-10710696},{-17408062,11680097,-31432599,4294808,22882744,-13896305,-33553614,-198784,3251058,5956623},{1,0,0,0,0,0,0,0,0,0},{-6049000,14632427,-19628340,312047,-27045733,-5443093,26968364,-13092002,-11143658,-14797209}},
+        {{-26157942,6844442,16249819,6696696,23716565,1648178,22711344,6508492,-23444360,-13975694},{-8321743,-12809299,20877628,-4695440,15474733,-11918893,-31285368,5668737,11197751,15997833},{1,0,0,0,0,0,0,0,0,0},{-27617862,-1520577,177789,-14400034,-17407308,-563899,5410974,13571254,10214593,9260773}},
+        {{17179230,-589493,18335864,-15776993,32110191,4652191,-29590938,-11940255,-26496335,7259062},{-19843935,11764729,1406222,7755274,13965589,-1589266,-20941545,14627520,-17943236,-5372039},{1,0,0,0,0,0,0,0,0,0},{-32808250,-5141033,29003785,-948421,-3069770,-10689068,25518971,7514896,1866247,-12344733}},
+        {{-5663940,9951591,-13814235,3530217,-31316014,-2829810,24664590,-15747998,32557132,11827685},{-22795434,7310884,-22967575,-1025360,-942582,6559024,-5102114,5471710,-6808738,-4529092},{1,0,0,0,0,0,0,0,0,0},{2952364,7627842,-24070443,13744141,-24002220,9166918,32686019,16149536,-25484994,-15318974}},
+        {{28863689,-1484109,26287536,-1915395,-7065031,8253846,-8951552,7585031,13291047,10625671},{6233552,9484493,15304236,4724660,7556807,2914254,-31588083,-15556538,-17244941,13534842},{1,0,0,0,0,0,0,0,0,0},{457693,-7438586,-15350211,13512360,20427858,-6992096,-32996101,4623416,-17604829,15569287}},
+        {{12508751,6294602,-31857158,9186099,-24026410,16262665,-7146953,15670699,33167180,-13606811},{2515259,-1005007,31919697,-3059260,-8037858,13303011,-25145942,6050225,-22513160,2337923},{1,0,0,0,0,0,0,0,0,0},{-24784457,-13990647,15898500,-13814949,33075004,5857222,-1392387,2823770,17310170,-16440479}},
+        {{-19970480,3351899,-3044349,7752099,-22074598,2511310,23357914,-11495828,10124873,408653},{17080387,-8789329,-19106181,12407178,6299453,928806,28393531,15992541,-21033085,-1627661},{1,0,0,0,0,0,0,0,0,0},{-20251081,1403734,-28634526,9898588,28261069,-4568821,19675978,-3197460,24291095,13227955}},
+        {{-22802719,2767618,-3814915,-3320538,13672749,6310688,-26766026,-11138048,16350385,-12717567},{-7342295,-3804607,-26623259,3675955,30341349,13237796,33171546,12202069,11774896,10276263},{1,0,0,0,0,0,0,0,0,0},{16627986,-25412,-428976,14126042,21892420,-7203035,30129006,-8045280,31640393,-5640458}},
+        {{28713495,2414727,16385141,6799633,-19476804,2040722,-20775021,8344279,23468687,7262453},{-25129131,11870822,30711082,14105067,-31490069,1515411,-1633667,4704689,17132127,2109480},{1,0,0,0,0,0,0,0,0,0},{-7355067,13679578,14942906,-8664143,10754090,12030517,-4343418,1149749,-33502086,5823790}},
+        {{8420955,-4803300,5138297,-14875208,-7279000,-14726044,-2415747,8925375,30294391,14893983},{4228175,-10106926,-17572502,-2675663,6574652,-8818917,-16359873,16001105,24896335,13224759},{1,0,0,0,0,0,0,0,0,0},{9869423,-11272237,15444481,13315228,2456531,16482220,7915769,8376957,18868695,11280294}},
+        {{26023965,-12563740,-23476190,-11046640,23808422,-15730796,9932900,12919741,-6521607,8924176},{28495912,10612333,8119834,-2008157,6045999,-15361686,-22748184,-4822766,24408848,-2718007},{1,0,0,0,0,0,0,0,0,0},{8942042,7815389,31603811,5204232,6364934,-4489519,-21677816,8143459,-1119369,11970672}},
+        {{-27687659,4894040,21491932,10737015,-15463482,4743946,20414609,13400121,-8970703,10059323},{9898142,-13384158,-7485631,-569627,-11000129,14561302,-18116733,-4548298,19821112,4932129},{1,0,0,0,0,0,0,0,0,0},{-10526604,-12382301,1372753,5990129,12466601,12694227,3762924,-13956407,-16672153,-16767071}},
+        {{-18763732,7299452,-30624482,9567168,-10839784,-5755963,18311738,-11121158,-18631287,-3990274},{-33438044,-9833169,-27527922,-14861544,31392025,1385966,-225615,-4745919,26299344,-525295},{1,0,0,0,0,0,0,0,0,0},{-29522044,-1887686,-22153285,6194123,29641141,-7675497,-24428867,-10781232,-4071854,-3095714}},
+        {{-2857975,6636706,-6699658,14768041,25660322,-5768292,-10421730,12504646,-12044275,-3115655},{-33256526,1659385,-23715980,10312102,-11134241,-1381279,-25264933,-7297699,6193247,-5301370},{1,0,0,0,0,0,0,0,0,0},{-21048626,10884772,-11761702,4772210,-15153198,-3751861,19309192,-14440338,2922218,-16657310}},
+        {{30768001,-16364324,-629431,-3266128,-5236071,-2072584,-15840311,-16440841,-15051544,16391658},{-32514622,12037596,-30886361,3886801,-5179957,-4484477,-8324832,12696800,-28549585,-10721227},{1,0,0,0,0,0,0,0,0,0},{2317508,13705056,4884151,-4741325,-31773719,5147066,20763797,13918303,-17512434,1335065}},
+        {{25390980,1699465,-20175209,3200222,-14325074,-8448296,10514843,-10659315,1895929,-14102933},{-11465524,-5458135,-33294849,-2797798,12570566,-15934928,16102975,-13423055,14144365,10706613},{1,0,0,0,0,0,0,0,0,0},{-3844675,-11172389,-22813755,-13845980,10363805,2908742,-22492424,-12428828,-3193266,-5670767}},
+        {{-12865133,4852108,-19451579,-16217032,-22810190,-4173274,-32920455,10987891,22140236,-16315047},{19909955,-15882129,8744227,-6431595,-7886349,-9448110,26716609,-15644931,16557762,14403360},{1,0,0,0,0,0,0,0,0,0},{-32159045,13592647,15894589,-3237400,3686573,15919608,-19886863,-8021270,5554653,-10116183}},
+        {{15107369,-6007697,-28661066,1044155,22946386,3555503,705955,-8305094,-7898297,12028242},{-33436042,6228768,15651620,-746658,21507860,5878386,-7709383,5203405,32526343,-2350089},{1,0,0,0,0,0,0,0,0,0},{-13259690,-11654941,-3271553,-11362107,22933187,-11338882,17712566,-14794026,2720139,16527524}},
+        {{29186527,-11567146,30289452,1107799,-30790386,-11096007,-31184262,8997923,-3943169,4632597},{25958549,9296816,-15480989,9239293,19264065,10753968,25838932,13428092,32441571,-4961813},{1,0,0,0,0,0,0,0,0,0},{1480333,4639466,26449935,-503408,33071015,5480861,-32619654,-1821288,29377558,-1113934}},
+        {{21063070,-3242222,27629863,9995573,-29920287,-11992846,33270804,12289924,21852516,-3473402},{-13399963,11532243,-12755812,-13902601,-28522756,7725109,-4043479,12884199,5685743,13323355},{1,0,0,0,0,0,0,0,0,0},{28870423,-5657248,19957125,-2757857,6438861,-12653628,-17972342,-365034,-903509,16384401}},
+        {{10436292,16381813,-19845907,-4035953,2581028,-12042513,-21083696,6157707,-16220344,8933411},{28620458,-3322498,-17498076,-13263486,-28659396,10598639,13490083,4992733,7312064,15622575},{1,0,0,0,0,0,0,0,0,0},{3947953,7104900,16735610,-15556235,-30347309,9310248,25191921,-10018374,-27482500,-6606757}},
+        {{601690,6133294,-13150891,-13690543,-13792154,-7247962,4081254,8689659,31981097,5407485},{-25406031,-13650351,19300955,-7644001,-10382823,402636,23974516,3230962,16335614,15633648},{1,0,0,0,0,0,0,0,0,0},{-32059585,-10240198,32147779,-11609241,-20426579,3958780,3293702,-12278409,6029118,11785943}},
+        {{16408674,-9309960,24518253,-4825498,32137101,-13195084,33137956,-11121520,-13213067,13069702},{20413429,-10925481,-30426527,2875294,18321917,14324330,3351852,15316922,13661925,-12554961},{1,0,0,0,0,0,0,0,0,0},{15229143,7947422,-8099422,-14345694,23088949,-3599344,30288885,-1008537,-16005001,16203450}},
+        {{32048860,-1767017,-10404086,1754618,13532529,6772260,25025036,-15926340,28172960,15592206},{16905367,-5578184,17979267,1401118,17218504,11874274,-22321302,15380357,19434754,13433126},{1,0,0,0,0,0,0,0,0,0},{904890,10666954,30076743,6742176,-15800652,9760383,4156546,-2677245,-27249998,172645}},
+        {{19444996,-7936829,25669689,-1160666,-20179192,-6416639,23166984,-2651413,25582865,-3949215},{-20798981,13984871,13337584,832708,-32606502,-5162792,-10274130,-3389676,12295645,-2204072},{1,0,0,0,0,0,0,0,0,0},{-32691265,-6257079,18976911,13683328,-33144520,294324,11821135,2991807,-8793738,13411328}},
+        {{-30027953,9334867,-6452785,6799433,-15848334,-13688769,24545231,-4425770,-24426874,-2888637},{13295655,1700362,27654279,7192946,15788937,-3657124,21392951,2190844,31300778,13679314},{1,0,0,0,0,0,0,0,0,0},{-16639357,-8077382,6396205,3348299,4931506,14445298,23075033,11596718,-19916740,-15702960}},
+        {{-21869714,-4867103,1366295,-3674728,17358267,-10328684,-3828052,7634846,-30015829,-7294020},{28229994,13125846,8861480,-7432711,17306984,4241411,-31215524,9453349,-6050279,13638922},{1,0,0,0,0,0,0,0,0,0},{25155643,-15590542,15002835,-16133513,665514,4217920,21682771,129925,12802737,4911369}},
+        {{26350890,1212288,26433237,13732856,-24925647,-12870437,28922103,9438082,-25313057,1358832},{-2083045,-13287763,-14064508,16652089,20306057,6065288,-17780538,-11687197,-14031969,12439180},{1,0,0,0,0,0,0,0,0,0},{7018275,-11733601,10993186,-10898780,-14112345,-1525707,-17110954,-10314595,-8151067,-9620912}},
+        {{-4265912,15939825,4967598,-11705179,21926949,-854499,28517438,-8517760,28572180,1825561},{-28523797,8645298,-29586450,-15043739,20072761,-16189516,-25651545,7839956,-19373492,-14061834},{1,0,0,0,0,0,0,0,0,0},{-13066264,2493915,29619633,-2570741,-5085103,-16339624,-31654914,-9644249,-20251766,-4195133}},
+        {{19229018,10351612,13413984,1355340,-18277649,-444860,6461964,-6859830,3088686,-7425368},{19485737,4958168,31858195,-8315497,22617201,11094106,14862289,-1026009,4246685,-858087},{1,0,0,0,0,0,0,0,0,0},{-24304424,3645204,-27132423,14570122,17683760,3685918,23485932,4111633,3279105,-4663616}},
+        {{-21538362,-13930525,-19123792,-10475421,-14617802,-5300523,12084624,-2963139,-20867378,1351089},{14962618,14764182,-8138956,-11141646,-9492375,-5866007,15164587,-210499,-32289511,-9142334},{1,0,0,0,0,0,0,0,0,0},{18748792,1364551,14748778,4363467,-18477423,8655386,11201720,8234015,16580801,-14381966}},
+        {{-28445629,11263577,-20697539,-3816309,-30971677,-4382227,-32796919,2665589,9159245,1231285},{-16359883,-4099128,-3882429,14490119,6210378,14590078,1796439,-2320990,-30282014,-7111529},{1,0,0,0,0,0,0,0,0,0},{-21577806,-5967438,-8407910,1796168,5105529,7897372,3118910,-10465977,28389760,-4060724}},
+        {{-16096449,1862577,18084314,11574849,30340234,-2850119,-14870309,377356,-18171745,5137201},{2673231,-9714880,-28471494,7937126,-25495705,16476812,-31879463,-11347865,-10338339,-13147656},{1,0,0,0,0,0,0,0,0,0},{-2741918,-1492156,-20477549,15880312,26495003,-14948581,-23665016,-8910962,-27355690,9285802}},
+        {{-3028445,1601573,-29616242,-11031083,24079205,15780055,30691828,-4461340,-7735224,999030},{23484640,8146366,3567109,12214237,-5130013,16756560,-21823566,-12615022,33034975,-8673716},{1,0,0,0,0,0,0,0,0,0},{26284738,-16060958,-6259419,13520140,2512898,12967932,30416698,-14498726,-7922361,3116310}},
+        {{5080090,-6163252,-23136016,-13772887,-13282172,14882739,33305941,-15692384,-31786813,-6304356},{2359680,13050183,-27795970,-999972,25837062,-8455099,-5514168,8978916,-17526768,-4966331},{1,0,0,0,0,0,0,0,0,0},{19482403,9388821,-24108183,10813677,16800338,10140190,-16286384,12076113,-25600353,-3678133}},
+        {{-25144260,-15751848,26173776,-15478839,9277187,-14474360,21528234,-10354853,-12336780,-14657880},{-27374085,-16155335,21260998,8048763,-821682,-12573965,-26039440,14466866,-23611830,-2669062},{1,0,0,0,0,0,0,0,0,0},{-5402575,-14832024,-4739001,-7603371,-5691909,-9953135,17837544,-3764887,6663335,-7874902}},
+        {{-14587442,-7107676,12015398,-13686300,20053873,-1673809,11336935,-2103442,-15075054,-4750429},{-27977318,-4997399,14238260,15848969,-17848301,6905192,2058106,14463884,3649328,-6933924},{1,0,0,0,0,0,0,0,0,0},{-8912247,-11692810,23178542,-12532550,-3183147,-14638652,-7712861,-11685005,9305542,6797623}},
+        {{-32103819,1722768,25967753,-12687415,14106862,-8937283,-18451873,-13280925,-15835939,8799921},{-21364442,3078739,-18131451,10122646,28048102,11229473,-19215060,-3572609,-17019222,6157146},{1,0,0,0,0,0,0,0,0,0},{2978296,-4439619,16569237,-13809320,-19337869,-3327127,5690015,-13127056,-2443984,-5944566}},
+        {{32100285,7562561,-25018436,-7390838,-32945442,-11085577,-108733,9604978,-2437683,-2877865},{564664,7811700,11612145,74922,8751596,16387952,-33988,947772,-28353476,-431036},{1,0,0,0,0,0,0,0,0,0},{5935687,-8245487,-16122928,5422101,9126530,-2102717,28756987,-10612141,-27300130,-6152178}},
+        {{18752314,9844541,1637855,3861978,-15321041,620768,23875039,-129330,-12771882,10335097},{6289957,-6713495,22744541,-503704,17262255,-10952430,13190297,-13443607,-32375300,15644123},{1,0,0,0,0,0,0,0,0,0},{18077100,-6488970,11987286,3654846,-8349323,-5521142,15217903,-5033977,-19304037,-6103688}},
+        {{-24485487,829129,30748698,-16557870,22060598,-2076870,-14291334,5629648,28207669,-7989187},{7349060,-5025821,-28189942,14575405,-11346522,4435818,24118153,-14556703,11241994,4911699},{1,0,0,0,0,0,0,0,0,0},{-16388108,-12444418,18495579,6064133,-13712986,434858,-9825302,10348081,33400015,12918222}},
+        {{-24246187,-6878898,-27418965,12766152,-24683500,13655863,-22016466,-13626454,33101988,8263408},{-16222026,-13501255,11106396,-3773419,-23015633,-14477835,19200036,11746489,-6279820,16030898},{1,0,0,0,0,0,0,0,0,0},{24645182,9012790,-27952942,10952948,-23011004,3597002,6313235,4827972,7361191,7612375}},
+        {{-20915549,761989,-15130469,10652857,16879526,13100968,-1322894,8917261,-33513920,10634194},{-21017957,12894348,-25348639,-114790,25540360,-3110154,-12746569,-12569031,-12930778,-2804024},{1,0,0,0,0,0,0,0,0,0},{16627764,4202431,-11663277,9266754,-21595254,11729411,17232116,-11743566,-12504339,-1571986}},
+        {{-7768047,3508179,1984648,5973457,26174765,-7021592,9319159,-2140435,-19288163,15187299},{2089655,10289357,17662124,-13842913,-29415946,-10306527,-20863021,7137632,22367335,6060962},{1,0,0,0,0,0,0,0,0,0},{15356826,-8948195,4489241,-10011210,17968499,-1245616,-2614041,700708,26336055,-12611801}},
+        {{14147232,-9719169,-30196383,-10971781,21861427,-3500242,-9277886,2207469,-1854591,-16055386},{290477,-10701744,11128613,-13913096,6644214,10120383,26821537,-229310,19643139,-774318},{1,0,0,0,0,0,0,0,0,0},{20512527,-5810781,-11155433,13353467,24032082,7945576,-12304462,-11014514,-13747368,6562104}},
+        {{13744505,10689667,-28338471,-2130970,-21525244,-12929462,-2634659,-3880967,-26647903,-7059433},{-27378238,-5603034,27143835,16688476,23060967,-619574,28505191,-14221901,32744845,324717},{1,0,0,0,0,0,0,0,0,0},{28426514,4603647,-2033695,-3983256,16617024,-11575109,26308590,8565789,-33516702,16537087}},
+        {{2169752,-676216,-26802935,5937468,12485386,13095931,-30766818,6472787,26609471,-14485056},{-9389874,1497063,-29323790,12591142,-9440574,-13515966,-12878484,-13979127,21008564,-16202558},{1,0,0,0,0,0,0,0,0,0},{25711318,11293518,-29335633,-1186567,-29913875,13833648,11323395,-13303341,-27334852,8546085}},
+        {{31016684,-16590060,-500758,2334583,-1908607,3060231,-24319225,-7018082,-22783649,-15523309},{-32814041,11076374,-14839786,10312730,-2449715,-15381382,7846162,-114766,-23225422,-4909349},{1,0,0,0,0,0,0,0,0,0},{28013059,-6328026,20560869,670859,-29608278,3411112,-10038101,-634408,-2340764,8824319}},
+        {{-33372368,5940731,12261525,-1094535,1086679,-12983274,33020350,6214743,16140363,11611592},{-8415580,13647685,-6328328,16550510,3251940,-11709726,-33368982,-15684757,6910494,-2225562},{1,0,0,0,0,0,0,0,0,0},{-20700054,8258631,15788823,-3845579,-814714,-14750805,-22164674,-15347567,-27107226,3863233}},
+        {{18571710,-396764,-28355840,-6445944,-19321079,8658206,-3019572,5238574,-14582942,-256879},{15338489,-6181367,-17961466,11479955,24180901,16691067,-18852563,15869635,-1834908,3530207},{1,0,0,0,0,0,0,0,0,0},{3683062,7060792,20463962,11417752,25263519,825692,-727700,-6768904,22033375,15159772}},
+        {{-2185489,13922323,28114517,-4838338,25529609,698481,16488739,-12258846,7217262,9752597},{26782976,-945795,-15537575,1229602,-19011037,-5210759,-24327935,340609,11559697,5178978},{1,0,0,0,0,0,0,0,0,0},{2161256,8604370,16521896,4790372,6574279,-3392094,22296886,13134085,-13655121,-10940913}},
+        {{31191496,-11861063,-28107018,3354213,10178541,-15242740,-18714784,14234776,30707307,-16398360},{-14982584,5599628,-19113817,7839536,-16650068,5489642,19348066,-2355160,12219923,198917},{1,0,0,0,0,0,0,0,0,0},{6918062,12770480,14202712,-2493887,6505824,-10966036,-4280150,-4400163,19997655,-624583}},
+        {{-3136370,-7303158,19361430,951640,-10738042,-5888175,-22173671,-3671453,3097980,-9706782},{-15943065,1695913,-13064575,-2864143,26982520,-10955595,32809083,-8514360,-5903416,-9339592},{1,0,0,0,0,0,0,0,0,0},{14412495,9505659,5412485,15365361,-16748643,-6862951,15997158,-11927584,25802138,-11340973}},
+        {{12866109,-14947029,24316929,5453928,-31555492,9555983,26488508,-10469988,27512726,-7938785},{-24407057,-14420158,-2985051,10261525,33081784,9928461,6622846,-4580471,28790354,-11689367},{1,0,0,0,0,0,0,0,0,0},{20046044,16033233,-26607469,11732023,-25175656,-6629538,-28452836,-6098871,-26569044,8407339}},
+        {{25525195,-8215614,15999086,15947,-31246718,16374731,-15339335,3873166,24802082,-15767417},{25293280,13616545,-7152577,-2215932,-11101828,-10748000,16505451,15022937,-29804294,2275808},{1,0,0,0,0,0,0,0,0,0},{-20707710,-1973498,1290785,-6811537,12803034,-14319533,5975061,3012897,-11542520,-2234470}},
+        {{30781966,7688039,3977796,10952185,16806329,-6002286,-12454421,13561587,12103520,16629458},{-5606089,15561736,29295211,9292487,25666430,-2623824,-1688368,482194,3649645,-2826253},{1,0,0,0,0,0,0,0,0,0},{-5891374,-3414315,10191851,4130818,20508190,-14832157,5101669,-15597121,-6895529,-15110634}},
+        {{26953140,-3268840,8189148,7264530,22613311,-14403473,-17305680,-14739303,30268092,-6160330},{14549993,-4906091,31349714,-7943549,21777049,3694350,29487790,-9156964,31480568,4674503},{1,0,0,0,0,0,0,0,0,0},{6508701,-13558468,11339025,1194600,10147192,-9787330,30411478,-13375799,32664571,16146573}},
+        {{27986762,-818554,-30088291,4667585,19142948,-10529053,-31947139,-1369854,-11262326,-9400224},{586278,-13736608,-19421168,-9510840,-5799417,6488113,28978915,-12311931,29125775,-8710701},{1,0,0,0,0,0,0,0,0,0},{5781119,-9328978,1546507,12421037,27550105,4456807,-28227225,6540323,-18708435,-2628783}},
+        {{20872410,14690594,-23654355,-4214193,-27426152,16288491,24418418,16059499,15838120,-4508810},{-26458151,-13277946,-17051976,-5014338,-33430961,277129,-7208333,5213440,-4527781,150881},{1,0,0,0,0,0,0,0,0,0},{-19440436,-14606266,-16443481,8458067,-13006062,-4952619,25395250,-13246383,28963812,2080926}},
+        {{-14121570,9775430,-4377290,-14433703,-23287761,15464166,-394681,9217488,1167321,-5710476},{30350439,-3333736,-32462268,8295914,12425642,2550716,-20413335,-4614843,-28476495,730147},{1,0,0,0,0,0,0,0,0,0},{-22320253,5482067,9411001,-240331,-4667207,10360210,-7125589,-1155117,-10443581,13273970}},
+        {{16460715,5406969,13594726,10379750,-2392551,11747327,-6408024,3228083,3443588,3160767},{-16238340,-14685229,8683086,-10667624,-23206610,13462529,-78767,2876288,33472525,-15419736},{1,0,0,0,0,0,0,0,0,0},{-16651464,-5159952,-26435983,-4216128,6646580,12308866,-13388772,-13148360,-285867,-6273778}},
+        {{20542637,-1200745,-5641882,-7222051,18695909,-16541025,18950504,-3604897,246302,1519791},{31740444,7096973,1926550,12143333,-3409440,1510017,-6775726,9133383,-5946921,-16221420},{1,0,0,0,0,0,0,0,0,0},{22053765,-6100475,-2370611,7034031,7842768,2995199,15255072,-12829772,21915082,-1885943}},
+        {{-7982473,11754571,4704561,1898698,18879621,-12802103,-28896708,-7679390,7893308,-7450261},{-7346087,-6797927,-20122074,-12466137,6781672,11660805,29656155,-4098027,-14406042,-7463794},{1,0,0,0,0,0,0,0,0,0},{-22584657,-15285861,-1897871,-13897235,12780034,10378538,2141205,-5589823,4920469,12408092}},
+        {{11619132,4689043,8790037,-304279,32578984,2980386,-29678332,8918861,-4753724,-8257968},{19501508,-4766338,27025215,8388450,-13865777,-9918001,-2080859,1796786,-27610822,16690063},{1,0,0,0,0,0,0,0,0,0},{173261,9112410,96643,11824326,20058228,-12952878,5016403,-14854001,-1695282,-13878238}},
+        {{19190421,4477260,920295,-6798872,-10744522,-930528,3057432,-1792019,-8305624,-2661715},{-8520791,11377505,1933941,3059076,24001560,6656525,30146759,3968770,-17140137,-7069325},{1,0,0,0,0,0,0,0,0,0},{-32124860,3147248,-23540639,13446588,7177926,-8692413,13958249,-12869191,-14296580,-16244626}},
+        {{19731434,-3057844,17268850,-12905867,-17880847,-2482478,14154388,-14559946,31260979,14496209},{-32249708,7739953,13354826,-1266923,40000,8810058,-32398933,15530776,-5713791,-411970},{1,0,0,0,0,0,0,0,0,0},{-17944269,13415469,-22802887,16567930,33517297,-8713542,-9800862,5104168,30618136,9917507}},
+        {{-26260987,-3063356,31328867,5798677,32774234,-291443,-2513195,10691977,-5746081,2418003},{-30911210,-4280589,-25777321,-11210913,10890826,-1514679,-1401621,-11816774,31438390,-4506291},{1,0,0,0,0,0,0,0,0,0},{30731059,-9952808,31550208,2703412,3794390,-10319690,-8446526,7631096,5274296,-6377517}},
+        {{20678714,-13072305,-22075654,-11599313,-13693714,-7842674,30991962,2722175,6781820,12146070},{-29744674,368387,-7838853,-8260249,23674574,-12251904,-18160613,-369643,-1033444,-5220285},{1,0,0,0,0,0,0,0,0,0},{23407189,-7825270,-7156808,-5729664,-30059476,9952498,5916772,6274716,-2822044,9354494}},
+        {{-18596869,7452738,-9877282,-15773490,-25700321,13854534,13552158,-5262521,-16839483,-3782448},{-21386327,194704,8900330,-1127403,-7884117,5734288,11640668,-16698269,8348367,10308271},{1,0,0,0,0,0,0,0,0,0},{-33036245,6217908,-18775397,9652353,-20905461,-1467803,31823265,16498013,10581872,-13306876}},
+        {{-12248836,5461521,-33548313,-14090480,18714304,-12019452,-19319888,14457065,-29636845,14989964},{9982419,-1894723,9698039,-11796316,-22805142,-15488571,6507411,-446040,-33127126,-15614420},{1,0,0,0,0,0,0,0,0,0},{23888905,8609482,-19996964,3818557,26823035,13135360,-7919194,15092473,17417406,-4734515}},
+        {{17605439,1687017,18025126,-2819965,9053526,13021223,-12255867,-9692897,11298,3214131},{20106920,-14520650,27535353,3950762,22626639,-7560278,1198628,-11388743,4009530,-12076209},{1,0,0,0,0,0,0,0,0,0},{-27456918,6151298,5907969,-1088979,27323293,7356414,-4257416,-8834555,-22913327,6164699}},
+        {{31248017,6899734,18271269,-5355431,-9816828,15805998,-18048967,-5943152,23137561,-14989491},{-9649726,3057062,-24815287,-1675116,16640010,1537382,-28365942,-16326322,22716001,-7135124},{1,0,0,0,0,0,0,0,0,0},{23143170,-16529761,14852511,-13059369,-26904528,10970382,-4837449,8769913,-14561681,11091105}},
+        {{-23765248,-8421567,11598514,12793222,12607627,12374814,-16501399,-3036798,-29499613,13696214},{-30331854,-13350046,16509037,-5889467,4911857,5195658,-6685095,-12837733,-11884848,-13817178},{1,0,0,0,0,0,0,0,0,0},{9691815,2481887,14789637,-9459514,23712603,-2673645,-26334444,12769399,27515249,-3565744}},
+        {{-32945149,-4716883,-368993,3236478,-6544865,3148440,24902713,-3934847,-2689613,-10897611},{-25573390,-5604748,-24328972,3610249,-9965693,14755952,31473864,-4362229,-6371734,3666709},{1,0,0,0,0,0,0,0,0,0},{-12942731,13279754,31800231,-1687013,-2773409,15461835,-29564131,10168407,-3821424,16601294}},
+        {{23907923,-11465148,10155814,9374428,-7729364,-8167900,9529951,-4395057,-16938256,-11199915},{16785037,-5754113,5148303,-8513869,10528277,1514700,24943144,-7226594,6499276,-12973673},{1,0,0,0,0,0,0,0,0,0},{-30498982,2029693,1184835,5420913,-24504908,-9043873,30515579,-96278,-63013,13620868}},
+        {{21269088,546359,2147034,15684677,13003507,-8869648,28341902,12545397,26571201,-8205674},{1418868,-6513027,-22231263,7645029,25718199,1644697,1235981,-3678371,-25138282,-12248315},{1,0,0,0,0,0,0,0,0,0},{10630789,-1858975,-22610096,-14532954,-23680133,6459434,-30410873,-15644295,-24627723,10684333}},
+        {{4963181,16529364,31949075,-936512,-26035522,-15606659,27123620,-8368104,26342940,-8520202},{-16805838,15085680,12799282,-15457023,14663971,11048710,10701835,-3959066,8727553,6051328},{1,0,0,0,0,0,0,0,0,0},{-9970795,14254193,2661235,16441615,24027798,-9755891,33106382,5756638,16982198,-4734382}},
+        {{2596838,-7032859,-26028401,-7704119,-12100045,6945939,-25769801,-2530451,31315327,-3588263},{19514941,14210698,-11519924,10007242,21475215,572091,-2961323,-14479149,30684820,14475350},{1,0,0,0,0,0,0,0,0,0},{-21221477,15189866,30021493,8834435,-15781791,324524,-28795843,-13496633,-11335371,3225760}},
+        {{-13178432,-16717763,-22380305,6237774,17977986,11979639,8894870,5057280,23805371,12773526},{-12715990,-3729937,-806894,-1656914,29917567,7345989,-12653333,-11244180,-21549498,-11131147},{1,0,0,0,0,0,0,0,0,0},{-20194287,15873907,25875334,-15903968,-26633943,-8324938,13335918,-13852422,-12316864,-9246901}},
+        {{-22400266,12769944,-25244016,4006487,20015644,-11036160,-4362853,898097,9679213,-12988886},{-22144044,-15092438,4063900,16702271,-23088654,3731094,656931,8825278,21819779,9452807},{1,0,0,0,0,0,0,0,0,0},{13570110,-12248088,25502205,-10571402,29361796,-4474615,23985218,-14927431,5347754,-13998501}},
+        {{28997556,-9277422,-4941891,5475528,29331891,-13426386,7874508,-4598116,-31176933,-6864159},{-29712681,2819805,-19839873,-9701026,24571836,-1849621,-12555528,-12248111,-13713961,78328},{1,0,0,0,0,0,0,0,0,0},{-14641680,11002424,-14352670,-695009,-6326946,11807712,-27168705,5274412,-16715829,13549973}},
+        {{5085712,16722543,-6065061,-3754119,13680062,9286847,-30797958,-15692397,6223374,-8084619},{9870200,15973733,32835441,13109104,-4847718,13026165,-7838875,13345672,-4082664,10058180},{1,0,0,0,0,0,0,0,0,0},{18539200,-15466104,-23734027,16627525,-22181204,12872288,18592459,-12718980,7710815,-10457168}},
+        {{-26564121,-6848135,6781321,5864677,-26153907,9372667,18036973,-4801371,15794348,2304329},{-26379796,-6782928,22181115,-15453947,-33253129,-9725468,7960643,183383,-3060377,-9261829},{1,0,0,0,0,0,0,0,0,0},{27555046,3741996,18874326,12457464,14971971,15427690,11894863,7132977,27948479,10537335}},
+        {{-12378274,-15485647,-4893557,-1703885,20694985,-10280380,-12114188,1039080,-8548291,-2039418},{-32784813,-2412668,-18921622,-2928277,7639298,-6328867,22025342,9303926,25120282,6572811},{1,0,0,0,0,0,0,0,0,0},{8970964,5479677,-2360502,5317261,17324353,-14147736,4351373,-8917901,12047927,-12286165}},
+        {{-10130299,-6242219,6694364,-7598661,31211130,-2662172,-6328464,12934708,21624291,10280986},{-17221638,-8817123,17249191,-2100462,-7951405,9005150,31496849,15084030,-22344595,-9839621},{1,0,0,0,0,0,0,0,0,0},{21272685,3748562,-32580365,-16040327,29718558,11383084,-6498269,14344261,6986233,-9185392}},
+        {{29686943,13510177,7197008,-16052946,25509401,5760721,-30947971,9783998,31340391,16332461},{-25607184,11364210,772773,-4404873,3093897,-7951758,14792365,-9135646,7538247,11606968},{1,0,0,0,0,0,0,0,0,0},{-19417333,9993902,-23532975,8632837,-32867154,-8744877,8349737,14801219,6071440,-1073316}},
+        {{30086675,-16537090,11578766,-16586525,-15483077,5646264,9237919,3536336,-20342118,15195622},{-26777442,278285,-1634440,6023453,30948748,-610190,25997727,-1516365,-15161579,-10626806},{1,0,0,0,0,0,0,0,0,0},{-16646304,14738524,23963505,5646469,-19080543,3644245,-12580241,10931016,18022241,2873392}},
+        {{-7372640,4257538,-12246127,-2542500,17645213,-8543083,10282264,9161119,30514872,-13010894},{1853448,9247336,-16288277,3280586,-8832293,6734026,30293225,9939497,15945808,-11194866},{1,0,0,0,0,0,0,0,0,0},{-21553979,11355706,12994811,15856189,12674099,-6631866,-26942998,7906652,-11675464,-3976844}},
+        {{-32101003,-4281483,-221500,3194044,-9633074,7006423,-32260031,10150598,-12252753,-10849620},{24677547,11410584,13435646,-13911104,-28051077,10298642,3539346,6068894,1190548,-3934297},{1,0,0,0,0,0,0,0,0,0},{-25080028,583498,142745,4398153,14848868,876540,-26636635,10823108,1895360,-168276}},
+        {{17114935,-7676977,28621357,-2924359,21937363,8904435,-18707066,14859367,15671371,-2150495},{-33243096,-5949584,25705761,11066608,-23364979,-6942340,-33126897,-11063314,-8686048,-9731837},{1,0,0,0,0,0,0,0,0,0},{3898920,-7581645,5136128,-13407733,-29088973,4475998,22470613,-7714053,21890531,11708317}},
+        {{-12043445,-226647,-5593539,3808448,-29717086,-14932007,17650034,-14295132,-33438010,10152146},{20273003,-2201497,-22465568,-12226886,4114620,16550704,9031409,11547037,23208904,-9284326},{1,0,0,0,0,0,0,0,0,0},{19273168,7537928,20906500,8594387,-23726681,1432652,-28121105,5430506,21640523,-1457831}},
+        {{-11336752,226750,30593074,-1635768,-2266249,-12120154,9323928,9765020,-21217022,12181979},{-18248917,-8389900,32159186,1825532,8924012,-4640450,5269335,-1686336,15227782,-4701430},{1,0,0,0,0,0,0,0,0,0},{2235730,-603883,-20358404,5265178,-21023582,-2407557,-6516028,11802911,17327559,-13004578}},
+        {{-12842845,-10104529,-22458862,5982150,-17392677,-12284528,23417765,-1687408,-7648819,7504581},{-8576989,8893740,4545455,-15688166,14921720,6709001,-31256150,10379053,-794544,-9534586},{1,0,0,0,0,0,0,0,0,0},{-14708410,-8616764,18390390,-14693186,6231538,7499661,22424160,12015298,26005933,7138771}},
+        {{9169230,-11101040,32921250,11745658,-24136763,3666765,-21595313,-1628217,2367563,13510149},{-14855406,-14683312,12373890,11557574,14114015,6626688,25126792,-16557042,-9706295,15443646},{1,0,0,0,0,0,0,0,0,0},{2359710,-7118529,-11451152,-12616527,30078300,5333780,28555176,7420911,-29997655,-14901023}},
+        {{18173200,16089292,-22354578,14070710,9558756,7245803,-16115987,-1153748,-18965573,-10812881},{19120747,-8802210,5197706,-9531656,10024586,14386373,-10662538,156342,9968188,-2546245},{1,0,0,0,0,0,0,0,0,0},{9339131,-7794774,-31489877,-4159931,9029970,-3758322,-14901965,-14147552,15132256,-15090317}},
+        {{12448005,-2630803,29326047,11352073,-20033794,-8982784,-16024000,16268764,23052341,2117775},{-33291204,13209756,28604922,-5454119,-26955462,-5637996,30596160,3011954,-24376837,2699079},{1,0,0,0,0,0,0,0,0,0},{27173342,-11688950,32235930,10509591,26074961,10836767,23553888,-6579452,8961162,10042213}},
+        {{5199055,-13289906,29427377,7065427,-5575447,10028760,3384394,6799118,-13759995,9636390},{31027698,8502217,11716463,-13249229,-19303438,1374857,-4136637,-16549116,10396302,-3918539},{1,0,0,0,0,0,0,0,0,0},{-25810727,7767634,11302152,12164008,-11515029,4920048,33257215,-11420888,27804603,-12776471}},
+        {{-31970592,1829547,-24876987,-15884629,-9308674,-5346753,-28870458,11157856,15623872,-7986086},{-7433876,13502336,-16798847,-521253,-14156558,12586252,-31587910,-188750,-5439502,-15978441},{1,0,0,0,0,0,0,0,0,0},{-2833278,-8667114,-14524484,-616224,15788210,-16728246,19436219,-8503929,-21252002,-7542707}},
+        {{17520180,6649133,-18179332,-4497079,-5664940,5680262,13998664,7315410,6377967,2432637},{-13230319,-12383548,6166920,-1563098,-16024599,15843062,-12865740,-16548329,-3450626,-14943696},{1,0,0,0,0,0,0,0,0,0},{13271046,12394671,7114145,-3609246,-5106237,13857952,-6172579,-185784,536292,3719459}},
+        {{-3885969,9536121,3592691,9251127,-20308630,-7156643,8541110,-12025597,-11443512,-543090},{-31628227,7985970,23695448,-6364567,-7394354,-4796356,24861749,-3211544,10587190,-13525316},{1,0,0,0,0,0,0,0,0,0},{3946312,-7879879,22796249,6719097,-32418596,16016117,-10669382,5090641,4133851,-5198773}},
+        {{-1397265,-14417330,-1175284,14898596,-25125001,9017290,-29701003,9552184,15237386,14310255},{19530939,-15721077,-4030373,-16047907,-24198167,3148974,-28466063,-16295506,-31196838,-955690},{1,0,0,0,0,0,0,0,0,0},{12484636,-2147247,21985363,8370998,20126875,4415278,-29656657,-7874627,20752730,-3425693}},
+        {{-18030739,10259336,-26151877,2060043,-28919219,-3136465,-16482701,-16462486,-23050927,-13636661},{28769850,14652481,-4607301,-6976164,28328349,-2487312,-6472131,-9434965,-545775,12043462},{1,0,0,0,0,0,0,0,0,0},{-24286418,-5261801,-29244533,-848679,-22006504,11085690,25963646,-13085521,16034854,-279856}},
+        {{-16028344,14082300,1672114,2517599,8127242,-15804097,-218478,127594,16670775,11495727},{26562548,-6907284,15120284,-16358067,-6747807,4009988,-20741773,10298272,-7745326,11971030},{1,0,0,0,0,0,0,0,0,0},{-4259625,9252948,-4364663,-9164373,-7204174,8857055,-7977962,8361024,7525156,10047607}},
+        {{-16757105,-2158588,19077468,-360005,-13618717,-13335232,20909494,5250043,-22875203,14450451},{1857951,5853559,27463580,-7056870,785024,3426754,8704134,16213539,-30840759,3524197},{1,0,0,0,0,0,0,0,0,0},{-1334151,5039997,-207736,2412805,-13260880,4406713,18285109,2133808,17442235,14584124}},
+        {{15884779,-3253807,25846939,-6008639,-6939525,-12832399,11764185,1037033,303199,-9716755},{-23226690,-9045576,-18242108,-15808365,-2441017,-7308548,10479169,14066797,-27433181,-11308180},{1,0,0,0,0,0,0,0,0,0},{29785457,-12208434,-25419288,8897199,10091895,-6707554,16152747,-6633263,26989067,-3385151}},
+        {{-9384748,-595108,-3041932,-12961959,21548604,-1027209,-1462971,13781983,20250171,-6464998},{-21989007,10524837,17462742,-11314926,11909201,-11091130,-24417858,156772,-20016541,-14069914},{1,0,0,0,0,0,0,0,0,0},{-24939591,582029,-7784196,-16566850,-25373877,-6301002,1138308,363023,-21046926,-11226202}},
+        {{-8587375,-15008348,19696573,-13975689,8093366,-8859928,-19422469,5833998,-31932129,9676434},{25949609,-16054590,-28762820,-1825266,-704756,-15419202,32715071,14711734,11232689,-6983766},{1,0,0,0,0,0,0,0,0,0},{16152200,-3456776,-3299558,10105388,-33423659,13791263,-25277091,-14931205,-4714656,-9692332}},
+        {{24888108,4215666,-5944038,11299240,7038126,-9748090,-17050480,15130448,-28038920,6454984},{16327457,4188018,19201342,14674348,-20831089,14191614,-26273803,-710672,-26421039,-3889741},{1,0,0,0,0,0,0,0,0,0},{4317718,-11522379,28561054,-11988817,-15613822,3076190,6506675,-129329,-27358779,11708311}},
+        {{12751009,13261954,-26574172,5978585,-27736660,6721643,18447441,-16627974,-27801404,15603143},{32321975,-14553951,26806916,-10822456,1989839,1518187,-5453827,5303147,-9449553,-12819361},{1,0,0,0,0,0,0,0,0,0},{-17192537,-7383090,21033652,-3796112,-13687112,-8851003,32976826,4473189,25768603,-1004765}},
+        {{12518021,2750954,-32079983,-466520,12042518,-9231550,26292360,-8541714,28287148,12102257},{-18431113,-15420267,24494742,-13929120,-18040881,15623491,17591107,-11903328,-16164991,8759088},{1,0,0,0,0,0,0,0,0,0},{16362932,3261263,2171823,-16612276,2883489,-14532693,5215357,-7861189,-5505201,-7397743}},
+        {{12778960,12903730,-3019999,-6442777,-2047582,-1060810,-30408511,9475719,32464194,14643865},{16447218,10679869,18183000,5255618,26558533,-1533095,30192544,-9728162,-20031754,4383929},{1,0,0,0,0,0,0,0,0,0},{-29816732,-10419402,29808562,-3508036,3561059,5034688,13889095,-10186318,-28048517,-16092935}},
+        {{-21267037,13181191,5466331,-12968752,-14648325,-6938393,8334533,-2076321,-114668,15126349},{-32118772,-14316348,1312826,15245218,-12848461,-1946315,-825122,5688142,10692438,-12121609},{1,0,0,0,0,0,0,0,0,0},{26151768,16581572,-11561198,-14571335,12271800,6771734,30008224,-7841729,23977226,-13600138}},
+        {{-7275245,14702758,-21846866,9035006,-31206669,-3886404,-20429411,12749222,21515741,1517483},{-25877840,4530015,-4179628,-10030223,15675654,15282360,-21560022,-13335473,-4991189,-8645069},{1,0,0,0,0,0,0,0,0,0},{-19101980,7242110,20731950,375276,-14993978,12893449,-27349535,-7822688,-20694906,2372372}},
+        {{-30578699,10919826,-427497,-13201357,-17405547,13846870,-24229150,4726904,-21251024,9455749},{-16891697,-12456881,-2889247,-15514045,28704605,-11632980,24904972,-12269475,30158399,-1280268},{1,0,0,0,0,0,0,0,0,0},{-16038122,-197437,3863182,12414863,-27646724,5807934,-18146739,6971240,22799227,12793482}},
+        {{23129795,895797,2763254,-5531232,-27028925,12879726,-2018261,-2772391,3179514,14357379},{-14496620,5884687,-30806463,12045980,6046562,-6545247,-27498937,-4317397,26919079,8020841},{1,0,0,0,0,0,0,0,0,0},{10503891,12987744,29880725,-12162402,9983632,8804223,-14382328,-5064666,5167033,-16145102}},
+        {{4744991,2122988,4788794,11482530,-22741809,6847041,-22882856,-8336387,29616343,-14319845},{13456452,-13360056,-23310044,10056958,-2925589,-5039819,27802140,-10981244,14880808,-15632840},{1,0,0,0,0,0,0,0,0,0},{27402946,8912946,-24498957,11874814,30578439,-1975316,-17090578,174803,-16788583,13192979}},
+        {{11489182,5836120,-13715394,13814670,-32396269,4543366,-11487431,3193317,-12812399,-15364757},{-3372769,6780263,2354401,13938570,-30455114,13976682,-8107890,11339277,14525394,9198376},{1,0,0,0,0,0,0,0,0,0},{4638923,-6804674,16057643,-11377482,29996826,-1866631,-7553205,3993103,-8749441,7570204}},
+        {{13515396,-5494701,-7631981,11554552,-27385424,-5012106,28054845,-3399936,20615782,11493453},{-5533878,15088809,24906753,16201868,10753514,-12287445,12969833,-896694,-13770755,-2800630},{1,0,0,0,0,0,0,0,0,0},{2935474,-11441801,-14242103,9789589,12629676,7542696,-28165420,14950577,2259593,5057430}},
+        {{-7018245,-4907358,28353131,13284574,17502383,11646521,-3218890,12887973,-25176774,-1172731},{7735041,-15095218,-24538864,16457439,-33167597,12040004,29179356,396929,27213421,8033600},{1,0,0,0,0,0,0,0,0,0},{-455039,5485951,17997046,10837264,-22631520,7218575,8898375,10778624,25981282,-13587030}},
+        {{-22318749,-7934130,-329251,-15925524,26691847,8276864,27372070,-11239446,21120719,-10280755},{-9270581,-140469,20281146,4459151,-1863835,-3940227,27085591,8138839,-6765501,-16043244},{1,0,0,0,0,0,0,0,0,0},{21204047,15654916,-32115143,12486338,26134724,-7184347,-22908434,9166134,-9616368,-4556236}},
+        {{-8408948,-12967308,11078900,5700013,-19311526,-7160385,-8233421,5803340,25488774,-15592621},{3978992,9191711,-213672,-3585345,24479757,-3975932,-15857927,677455,18200642,7438150},{1,0,0,0,0,0,0,0,0,0},{-22737019,12248155,-29946387,10899490,-3769996,-13021994,4394616,-5222284,-7280356,-8222312}},
+        {{22292037,203059,19121566,-226312,-31770273,6961507,8561371,2000885,-1161942,-2346830},{-13839955,-13046274,-13468433,6389336,-5031981,-11573457,-4482280,-10297505,18246502,-3144917},{1,0,0,0,0,0,0,0,0,0},{31442666,-2977036,24098506,12665946,29198387,15518642,3219785,-3398678,18047020,7170928}},
+        {{-9899727,9664448,-13614050,-1379354,21038295,-6025446,-13262375,9696799,-21680964,-2167562},{-24883013,5839019,-28998858,2446861,-8934845,-3181055,-27731043,-960774,-19875235,-13304779},{1,0,0,0,0,0,0,0,0,0},{-6208290,14473127,1153270,1916793,14790920,1573528,-33190037,-2182728,-19846580,10142070}},
+        {{19773443,-14981005,4209106,16388525,-2677870,14925279,-28952205,9122591,29680851,-12391075},{-8398251,16765841,28732009,-11118110,3712929,1642840,23183354,11479623,8419409,-8614148},{1,0,0,0,0,0,0,0,0,0},{20013290,1664557,15744033,-1391756,12444072,14625868,-15873599,-12924049,13504424,2997964}},
+        {{19004300,2099329,-11343327,-9595116,-17199882,3401725,-13598053,-14517728,-17839805,6356469},{-898613,1962822,15908590,5988581,-27250193,-11584130,-30869349,-10750897,13458215,-45836},{1,0,0,0,0,0,0,0,0,0},{21703715,-6035884,-9174954,-413896,-12465906,192712,-22854239,15766333,10639907,9175909}},
+        {{-15618786,-10053965,20066245,5093614,-12404336,13719462,-15636647,-12722324,-21922721,-6391050},{-22905078,13925967,8560586,12490935,4510976,5613095,7722621,-3248634,693633,14884597},{1,0,0,0,0,0,0,0,0,0},{-8785907,8680186,-18955059,-6488396,-18683102,-15772987,-19633964,3372247,-4439756,-13943079}},
+        {{25687721,8791314,19516457,13533744,-1699568,-2287014,29057891,-2382108,-31778405,-15721834},{-15303683,-16117388,-20658037,-11983183,-10087950,-9901621,5246285,3894407,18079083,3636748},{1,0,0,0,0,0,0,0,0,0},{-27801222,-14766578,3605025,-6501696,-30157817,14858172,-32351923,-15999436,20043573,-4711773}},
+        {{23350318,-9207356,-23265786,-14570297,14944481,-11665488,-10357154,7328600,2417412,-1665225},{23125207,4452498,-20692927,3414604,-3166283,-1492473,-6600603,-15440976,-32930082,3496543},{1,0,0,0,0,0,0,0,0,0},{8181672,-10788676,-22948069,4113563,20434823,-13126994,-8016247,-8677466,25888937,7898928}},
+        {{-16251996,-6147938,2314787,16462212,6987908,-4790562,-6062276,10928283,-33320389,-8403806},{-11972953,-10565016,19577873,-15187137,23985790,9775512,25181161,-16505431,12037444,2505391},{1,0,0,0,0,0,0,0,0,0},{-159925,1454897,25517653,10337393,-32092614,-13216247,-31252101,4583910,-3753453,12993492}},
+        {{-22993031,13057932,-27526076,-9208570,14329948,-5884245,-28851830,12296779,-25936675,-10106255},{-24012024,-7725921,19720383,-281706,-24539354,9816477,-25473571,-10841285,-31317652,2240279},{1,0,0,0,0,0,0,0,0,0},{-23285891,875666,-30788337,16368437,19492682,-7911990,-32107105,-6107384,-5461870,6305506}},
+        {{-18332713,-1347847,332798,3871925,2164930,-9609061,24349806,-1577457,-7495125,5590151},{24684469,-10136740,-20493602,-14530974,31063487,-8366154,23899672,10575688,-12562054,-15955619},{1,0,0,0,0,0,0,0,0,0},{-3639420,2288192,-17831937,9120689,-5517770,152829,32127435,-6826920,-8657731,7633255}},
+        {{-16309792,-1925467,26510122,8934331,-12826211,2093,-33376338,10856834,11682129,-11933787},{-28662492,6820932,-29284518,-15260224,-30983085,-1355396,4343311,313070,16882230,12117305},{1,0,0,0,0,0,0,0,0,0},{17426791,4402559,-20415548,-15226337,26541503,1235588,17612366,10192798,20911337,8128835}},
+        {{-27722501,-1741195,-608151,7676206,-22451128,3565899,-29428508,-5522020,-3108258,-16505810},{-20894902,15574245,28152032,2613850,6920820,-5807266,-2002058,-12823537,-32701860,4134600},{1,0,0,0,0,0,0,0,0,0},{31524836,-12207966,16941219,3446492,17961026,2737031,-12304497,6498606,-2209242,-12801043}},
+        {{-18149502,-15817292,32754799,13326028,-32503289,3806039,-20624669,-6574788,24236383,13516406},{27962996,9471813,14566628,190668,2504547,-11409339,24037216,-9570326,24064484,3562801},{1,0,0,0,0,0,0,0,0,0},{8733751,15256271,10918423,-3342500,9372108,194128,25169832,2470296,-33330827,-13764924}},
+        {{-24303943,7461472,992619,13156140,28589220,-7807617,-26945119,-13441958,-8978717,5240758},{9477655,-2203768,-5509452,-14766106,10792845,-13254453,-25026575,-1039583,6156649,-16423565},{1,0,0,0,0,0,0,0,0,0},{16975601,-1189151,-22189720,-13395921,26132842,5369797,-17546526,6058071,-23264500,-7319777}},
+        {{22023709,1600063,5135752,9938775,26739888,6843996,-6007059,-11733832,-12249955,-7263238},{25981581,-4787102,29846542,2606141,939089,-741693,13374832,-9123695,-17080104,7456268},{1,0,0,0,0,0,0,0,0,0},{-1020183,2146368,-2233270,-14374357,13088667,-5384440,-31776163,15779202,408959,386456}},
+        {{-31397234,-8026135,-31110726,-15788599,7151890,6168514,19137486,16194380,-29130685,13390925},{-10088497,-8182703,17435530,10533585,-30938976,-2341865,-9271525,14598672,31262402,2834970},{1,0,0,0,0,0,0,0,0,0},{4923463,13422167,-30894339,-16032714,-15728219,8656447,-23802261,8402409,1130732,668735}},
+        {{25478223,-12304973,8020352,-1605791,-22127170,-2428472,17539972,-6061260,23611183,15373369},{16771021,-5791932,-24956352,-14625368,-29321676,7941281,3493393,-11344984,18234966,-9878109},{1,0,0,0,0,0,0,0,0,0},{12310655,-15802553,7640246,5056357,-7023173,-7888862,16456101,492543,-24762317,-11807694}},
+        {{8418439,-4891223,-21104049,-12885143,15684641,-5459522,-9627915,12406919,-33393215,-4575160},{-18545117,-3130726,11237195,3209480,-3678761,6455190,-26984783,16608127,16349324,1592685},{1,0,0,0,0,0,0,0,0,0},{-8218363,6365060,8067368,13569517,-14982306,-5415454,31225155,-2429783,1690995,14071396}},
+        {{-13977753,-4420739,250591,-5500771,803413,14857458,18319804,-11219218,29041147,2830991},{32851084,4767850,-4228557,-14946636,31629375,15154719,-12691180,15122609,17759900,-9587802},{1,0,0,0,0,0,0,0,0,0},{-2822464,14850213,24126379,8248458,6173331,7947603,-8317147,7393066,32047098,-504824}},
+        {{-18693588,-16706121,17941929,2644047,22466852,10927576,33529472,8023720,28482680,319906},{-12278017,8565133,-5041261,7708792,13805413,-11240175,16965106,1596871,15590313,-11787962},{1,0,0,0,0,0,0,0,0,0},{-25365164,-1993102,5549012,-13621405,-2888220,-13305898,-757821,9820919,28899900,-10192933}},
+        {{-19751400,-3937881,987324,-4233163,26094235,-11559696,20414183,-14482257,14094660,-12035002},{24065933,-75592,25617239,-14834176,3101285,-8610533,22419308,12643203,16979613,2533807},{1,0,0,0,0,0,0,0,0,0},{-26784133,-886524,-28704451,-16158325,-25660840,-3609254,15183201,2326446,20709410,9969256}},
+        {{18538413,-15187228,31688681,-4461695,11629286,-10301299,-4588964,-14575520,-11143051,-5701626},{25881088,4268091,-26148117,7449449,2469887,3500462,-30653975,-598215,2626511,6020043},{1,0,0,0,0,0,0,0,0,0},{-26814037,8363521,24446307,4050376,7018388,-7223894,-15730767,-5362685,-8934990,-16114688}},
+        {{8851078,933823,23252651,10609731,-16773814,13002956,-2981423,-12197349,21749809,-12488840},{30168289,-16182009,-9534911,-12587638,7534648,14297846,22141305,-11582763,10158297,-3601488},{1,0,0,0,0,0,0,0,0,0},{-30803618,7913281,-7225201,2665571,21421542,9171565,28839928,-7279837,12790303,15235860}},
+        {{-1677190,-3507599,32695540,-2665591,-25661849,9881608,30017436,1385763,9859732,-5544224},{-18218925,-8934197,-25993701,-2735384,-18846999,-531927,-16336891,8639076,-19490311,-7400223},{1,0,0,0,0,0,0,0,0,0},{693747,9295833,-1964590,982781,-14285965,-10378630,21120002,15632846,-4114195,-9350383}},
+        {{231298,11634737,89303,-5584651,-2304154,13332637,-26078746,9427587,-19611415,7234615},{26103942,2189549,-10284902,10704095,-21335088,-1348449,-24558467,9565880,11712377,-963826},{1,0,0,0,0,0,0,0,0,0},{-4203003,8523202,-20303533,12113039,19108895,2980862,16783661,-2563566,-766794,11652953}},
+        {{16271902,4021596,1156797,-7790988,-32857816,-10403795,9295195,-13867493,28001637,-6846850},{-6916720,-10905449,-4804253,-7511236,-29687083,4858507,16827240,-21637,33399174,9997650},{1,0,0,0,0,0,0,0,0,0},{31758459,-11389102,-29856581,-8390336,-18272515,3462320,9517690,-15250410,2181044,5920744}},
+        {{-33458298,3110274,-22546095,10865044,7547801,-12956785,-27043731,-12973771,-16011117,-6417886},{-31259332,4129018,6977980,-782758,32886479,13847461,-13065093,-13848258,-26226600,9869850},{1,0,0,0,0,0,0,0,0,0},{15764712,-5107748,4169456,-190263,-28889207,15327990,6474514,-3776394,-16290529,-8406519}},
+        {{21886956,2352855,-7872710,931195,-4547453,-3739028,20141058,14282693,13723759,10742316},{5976838,11206087,23004231,-13378577,-16358710,2087619,-12483709,838077,8178847,-15049985},{1,0,0,0,0,0,0,0,0,0},{10488787,3779114,1487966,11803314,-14315923,-6896117,-16403812,-9261819,6175394,-201403}},
+        {{-9490946,13602270,20736552,7225835,21807838,8266002,29433145,-9106818,19524576,519406},{22686759,-930494,4437859,14198790,-30691610,-1209342,2842891,-12870071,3459419,-206173},{1,0,0,0,0,0,0,0,0,0},{28487997,-15178593,-14746050,-6004547,22947792,-11767084,26506380,-13534485,-20437206,-9285403}},
+        {{32389313,8417348,-14067436,15784719,32813114,-13081692,-13108024,14475392,-10276342,-16078228},{17073565,-4510346,-806264,12895359,-15750197,-268060,13328023,-8118065,24755923,4296026},{1,0,0,0,0,0,0,0,0,0},{-30008925,5382448,5164991,15400955,13074986,11582848,467904,-13385050,-20333629,412728}},
+        {{-33379437,11124251,-12790527,5491417,-11156834,-14342072,-20887218,-16007750,-27125360,-14044586},{28948098,10107189,21113046,-10606685,-12858544,5704581,-1465337,-9402855,-33519523,509024},{1,0,0,0,0,0,0,0,0,0},{-21076365,-4189676,32488842,-9518895,31022204,-1281326,-24894360,7850131,-26395312,1705134}},
+        {{-8431589,15014824,26527857,10883801,-24922308,-5043591,-12317288,-4716679,3022468,-4849710},{17163567,-5373457,24944946,10422468,-19187302,-5451188,-2339374,-2914988,23369115,8615485},{1,0,0,0,0,0,0,0,0,0},{-18084597,14422474,4725890,-13725962,-3544662,-11498064,15126226,-9907063,33243364,12127210}},
+        {{-21764460,985907,-15882927,-15219273,-4903774,13948344,5735347,3574154,-30173071,-15424493},{-30385108,-15158202,-6450882,-2781265,672273,-300594,-8229701,9562429,-19800425,4826795},{1,0,0,0,0,0,0,0,0,0},{-2422564,-6139481,15076401,-66931,14810953,11357907,7584257,1390443,-18384434,-9828407}},
+        {{-1143764,15105248,16755313,-1128372,19673442,-4474241,-8228781,12005263,21208279,4922761},{100846,-243934,-15945399,4321888,29588010,-6310205,17389560,8712584,-33244042,-2173452},{1,0,0,0,0,0,0,0,0,0},{-31053186,16396274,22985196,3925417,-30159917,-7664145,-19467039,3688649,-3516213,-11547222}},
+        {{21877373,-9509000,-30038992,-6927306,-28010191,15174883,22661026,1685767,32945477,-8238423},{-32654271,12472424,-12427481,-4107993,-20587722,-9964480,15501729,-2175985,33410062,-744277},{1,0,0,0,0,0,0,0,0,0},{27781261,1958922,-1346030,-11452115,-17557198,-14492259,-33481172,3401759,-19744952,-8907882}},
+        {{-23884715,12468904,-450068,9122064,25536496,-11280590,5953230,9645184,-21404653,12063707},{9105604,15552729,-32176649,10262182,-14369077,3217264,-16433504,-10336826,8333589,-2932292},{1,0,0,0,0,0,0,0,0,0},{-26476552,-9223165,22522704,11260855,-7970990,-15501897,-1130240,1847435,16750138,14419465}},
+        {{-23534140,-907714,20117933,-14034495,27002314,-5163288,-23681394,16021699,32725919,-12026473},{-10722874,-4588877,-2430534,-4223701,18619037,10199689,23631748,-8337112,27303458,5985551},{1,0,0,0,0,0,0,0,0,0},{-20873064,-16510573,22008977,-3563029,-27233988,2291479,7548376,-14168465,26694882,-3959819}},
+        {{22735528,-4805123,15692981,-15698382,-5990288,15843773,-25845027,-11059616,21346723,51677},{20821902,5023136,26457228,-7267477,-28864995,-5205364,11565571,10229330,-10531319,-5585588},{1,0,0,0,0,0,0,0,0,0},{-22705224,10873532,19006509,-15133504,-6112521,10092512,21728408,8305423,-29743874,7652220}},
+        {{-4899087,8918971,19542400,-7957313,25173802,5002213,-12187789,14178504,7707189,13098105},{19352765,-10702248,22343627,13860499,1232843,-11883694,26084269,-8375170,-28589184,7896327},{1,0,0,0,0,0,0,0,0,0},{5819026,-14295711,-14692258,-7887771,-5406738,-942145,11605029,16668220,5819535,-13035346}},
+        {{-14369473,943682,19832698,-4055445,-14891357,12621187,-30791963,-13088950,12242736,-561665},{7248915,6346547,-19456996,-5061394,929896,16188893,9099980,5887451,23631844,-1959767},{1,0,0,0,0,0,0,0,0,0},{-11243245,11242062,-15012557,-4672813,18553295,-11594775,12727610,8041563,-8469730,14355911}},
+        {{11962065,-12555272,-19577955,9722244,1762803,-5289730,31940370,-16714622,17976780,11850504},{15231832,-14435376,-26566420,-2401516,1404057,9277929,-3860450,-4533076,25390139,-3365393},{1,0,0,0,0,0,0,0,0,0},{27505043,12249114,-20867690,14353710,-31681700,5879180,-4578569,-11282680,6120253,41335}},
+        {{7258532,-15785187,-17056423,-3031413,21410755,-16548179,7142464,8815812,3145428,-497966},{-2440249,-4462426,-20805689,-4912260,-26298322,-9196569,-17063294,3061990,-21550915,12387457},{1,0,0,0,0,0,0,0,0,0},{26604378,-6897422,25954861,6522621,-11501607,3405302,-23710449,3449689,-9316479,-1950291}},
+        {{8549172,10990928,27909957,9681260,-30629007,10691259,31194293,-4183778,-13695635,-9086382},{-18133974,4092513,27377641,7533465,-9196527,9880017,-2087113,-14907922,-26662270,-9682042},{1,0,0,0,0,0,0,0,0,0},{30937872,-15802841,-2709444,-13147902,24938514,7487500,6225704,2044395,7408422,6643099}},
+        {{26716198,4497972,-17466076,240787,8184916,7056523,-20523621,9280404,-1622578,-9042675},{-23630436,-14840226,-7388950,14932074,-7078036,-7604690,-12119454,2061380,30651716,5135274},{1,0,0,0,0,0,0,0,0,0},{23351395,-15817064,8816111,-6759028,-7645256,5593409,-2317148,-6185809,-8794170,11323068}},
+        {{-5150063,15685098,23820947,4489916,137925,565830,15018371,9564850,13915176,13833383},{-24867085,6147706,-24018132,-5854761,-27723554,-12474753,-26808466,-1518502,28643737,-748614},{1,0,0,0,0,0,0,0,0,0},{-24364194,15096600,-23139370,-5745068,19438275,14099439,-27827426,4341088,-25857151,2062372}},
+        {{-24932725,15196911,24084140,-6939270,8443309,1865703,16863716,-7643932,29771905,4807659},{4610727,-2462290,24565775,-4913830,16007158,-7458397,-23221355,8178673,6501375,-10706346},{1,0,0,0,0,0,0,0,0,0},{12730101,5644348,-8592868,6568462,-10351107,-9276976,-26987752,3143274,26306808,-1985500}},
+        {{21549544,-3571633,-24989609,7678720,-2086678,10222000,4205560,10480821,-27454461,5527064},{9675737,13027740,-17594205,-7938905,-3363272,14930472,3662103,-906129,20468381,9288319},{1,0,0,0,0,0,0,0,0,0},{2864896,10828032,-8898910,-715957,23942425,-10244210,-16917097,-4616723,-2743585,-3194349}},
+        {{854380,8747574,-22321059,-14243383,8361185,5061681,5389086,2520194,-13163409,5698721},{-3147970,8195935,-23542895,5054393,-19915653,12010706,-2824644,-4147042,-27293820,10563221},{1,0,0,0,0,0,0,0,0,0},{16707459,16015689,2435508,8281540,-5452657,-16772472,2954093,-14585758,4120897,10339022}},
+        {{32031074,11069904,24479676,14916065,-26892879,12824298,-25325517,7388628,-29205008,2550809},{-32589363,-7499052,16779018,10694062,-6554288,78461,-24273692,5707784,15995363,11247651},{1,0,0,0,0,0,0,0,0,0},{-5564792,-10702305,19537875,13313019,16043093,-3891151,10073158,3363091,-28846591,-13644091}},
+        {{-15968352,707530,-1979867,-1680091,-25574849,1916425,30871185,-3334708,6160831,-11011254},{28234670,16688672,13806551,-16261420,-27763901,4029022,14945278,15748196,-22069475,14293021},{1,0,0,0,0,0,0,0,0,0},{-154872,3407310,-5644466,15077807,-25577392,-6309378,-19584040,8100299,32380384,-6199163}},
+        {{-12874615,1961195,12446756,15539439,-4878759,-6969002,19317042,11576472,12296018,10159778},{27155082,-2061694,31826081,8275047,27270586,-10969811,30136485,-3274932,22112396,-11255726},{1,0,0,0,0,0,0,0,0,0},{-432837,13051539,4053083,-3765281,22943704,-10483864,7443766,-14061821,16723963,-1528751}},
+        {{-5279542,12453763,4498113,1395533,-28312670,5256916,-9104193,14423128,16172170,-4416545},{22233700,-4268522,-5284820,1017984,19960028,-797577,7813034,-12238315,14734359,4948148},{1,0,0,0,0,0,0,0,0,0},{29083200,-7577046,-631240,-555988,-30457505,-3815056,17054157,-4389999,18851986,7000892}},
+        {{-21675922,7031434,-8955589,-2779004,-19337982,12393860,-18962408,213989,12855358,11023949},{30086702,-6493178,30051432,-751632,-7777896,9403968,-22400881,-13555158,1174989,-7039757},{1,0,0,0,0,0,0,0,0,0},{-1582330,977302,23130503,2652246,33317991,15459728,30257183,9404588,13317618,-9483455}},
+        {{-26545248,-824590,7668861,-10525531,-30773310,6547664,-4972382,-13481905,-25020566,7662813},{-29560616,16135002,-5154740,-13653726,29625055,16275003,12838715,11954878,8598123,14520198},{1,0,0,0,0,0,0,0,0,0},{-11853677,-1085399,-3135920,14016751,-15884006,-15514323,-16142657,2261361,-19823885,-3340274}},
+        {{-31752407,-9236732,-21874902,-5066025,9252505,-4170854,-23088916,4640986,24239668,-8404133},{-17140137,2763312,14729767,-7286102,-30466392,-6203787,9322780,-14277100,-33256579,4502479},{1,0,0,0,0,0,0,0,0,0},{-15714655,-16645501,28531781,-5256917,-28185822,1634284,-29943527,14371263,-20190068,-590619}},
+        {{-32398530,4375653,-5795614,-14662428,-10429503,-817312,-6542784,3925767,29843786,3994653},{11134922,3650555,-32904658,-3627819,3764616,6910211,-32066096,12627148,-233607,13945897},{1,0,0,0,0,0,0,0,0,0},{-30346202,-7682763,-30083569,-3343077,22737243,8470542,-11249793,6318830,12970175,-5996570}},
+        {{-16867132,-16685543,18233195,-2854901,-10168715,15606105,-7753852,9520246,-23893833,-3479703},{-9404135,-16051730,20856275,-12842764,12034372,-737283,-9745086,2189054,30487605,12054656},{1,0,0,0,0,0,0,0,0,0},{28979909,-6588246,-3735240,13917982,24472479,-10328694,-26556096,-9159029,-14941427,-11491448}},
+        {{-28206397,-5273171,6569075,9670371,21103100,16137662,13865157,2924445,26196537,-3239215},{-1346504,1560813,-22000154,9533115,-11328915,9986864,9938654,-15970919,29637188,11725431},{1,0,0,0,0,0,0,0,0,0},{-29815705,14609979,-9044266,-8134976,24084621,-1381409,11674305,6061254,13943958,-4590813}},
+        {{-21655439,1429067,-22187797,5308855,31452687,-10052490,-27422490,-7975640,-1170522,7596339},{19302601,10249473,5862790,-4722056,-15480410,-9504978,27165033,-2068680,13944909,-15753735},{1,0,0,0,0,0,0,0,0,0},{-18388416,-10893743,10871084,-16259007,-32865409,8417672,-925845,3025946,27164858,7547644}},
+        {{33500770,-12851567,-20340613,-16261049,1009625,5932468,-20140111,6446720,25197253,7271551},{-25417625,-7249538,12968156,13909159,20927162,-3440326,32491445,-10767774,11964486,1971991},{1,0,0,0,0,0,0,0,0,0},{4075366,-6659671,-13773027,-8236723,-20877910,-1761200,-25145521,3153789,-4076360,13288374}},
+        {{1845865,11184126,-9357490,-15416847,21954720,12282707,28412042,-2975961,4427204,8717185},{27015715,-10906088,25551117,3790788,-31383683,-14046461,-17320464,8777540,5826247,1145679},{1,0,0,0,0,0,0,0,0,0},{8242284,356477,26307968,-3333773,-15971806,-1235285,-23760106,1274296,5437254,-16065994}},
+        {{15075039,-15131841,2059678,-16182092,-32785986,4292465,-19748037,8602803,-23961373,-13484522},{25306228,9296253,4171658,2697760,-32675370,12000776,-18700794,736136,2785708,-11915885},{1,0,0,0,0,0,0,0,0,0},{2712480,11576219,-15934260,9687524,30699140,-2931486,-24695927,-296556,11188728,994407}},
+        {{1056667,5512823,-25501570,-2509591,11692636,6720409,-20771587,-590919,7662140,1086113},{-2698265,13354830,-13891887,-13994803,-1382095,3075098,31329773,-12015700,4962242,16555055},{1,0,0,0,0,0,0,0,0,0},{2862442,10275710,31197161,-12785092,-20086724,-6473372,20491453,-15832189,32457653,1073014}},
+        {{26935662,2151517,32822853,-2655553,-26103087,8939942,8943274,502418,-5231761,6389176},{257548,12405101,3103305,-15199883,-29267240,-11263079,-22590742,-5791333,-14769093,-14371332},{1,0,0,0,0,0,0,0,0,0},{-7692277,-15452602,-29830851,5208900,18688643,15325270,-31865191,-10392168,2710591,-15503552}},
+        {{-6040688,10585060,-28694211,13678247,5449231,3910614,3028553,-2552138,828413,13517493},{-25564435,-283962,26163830,-13072786,-15062383,-12069232,-9318626,756782,19770725,579179},{1,0,0,0,0,0,0,0,0,0},{29503061,-12617697,-2607914,-15702540,-2387374,2497910,16816729,6029501,19845667,1611075}},
+        {{16929475,-6947557,-25214972,-9644745,27417660,10384509,-21512589,6045454,26145189,-10468492},{-9445376,-8527975,13213318,10360834,26441309,8959887,-29810896,-8637991,9794021,-13433935},{1,0,0,0,0,0,0,0,0,0},{-33140225,14722541,-26267872,-4320884,-11841130,9786292,-20265654,14735089,-9805163,-14243809}},
+        {{13646303,11022616,-23266444,1043895,-5370614,-8136620,-13886135,3110835,21073708,-11435572},{9692396,13621674,-22352935,-13307123,32973057,2835498,-27745233,-9061686,-21032666,10730404},{1,0,0,0,0,0,0,0,0,0},{20392763,-6298806,30561369,8771235,23431188,4436669,30046644,-6501576,20788381,-9919341}},
+        {{-7958430,-3562503,-23924509,-5370850,15479029,-13671350,-14316796,14284738,9585588,-4810778},{12014664,-7854,19104654,-8757755,-29900326,14447607,-23353752,8398595,-9412344,5779899},{1,0,0,0,0,0,0,0,0,0},{3410337,1845979,-2318974,-16552876,-31039607,3556718,19953563,7579889,21466560,-13827026}},
+        {{-1061044,-11042404,8369555,-4314498,-17620252,-5004239,18024397,-10260736,-18349967,-8048483},{-30408015,11967579,6444164,558861,-26603901,476668,23878715,16184853,-4052803,12282979},{1,0,0,0,0,0,0,0,0,0},{-15565028,52398,-28768958,-16055944,17610331,4422959,-28520216,5468878,24388585,-1742761}},
+        {{-13814553,-12275048,29330974,-2200723,-5958910,-12362586,-14915138,1938092,27295387,11017407},{-5571979,-1153855,13321328,11391638,7429695,-10706266,-19956310,2691919,14852648,7816329},{1,0,0,0,0,0,0,0,0,0},{30535314,-13154736,18584238,-12102349,-33374894,6890861,-32226431,-3073049,-27296961,15610637}},
+        {{-30757809,-15805233,11043163,-16501741,26285565,-14516425,-2449726,-16423015,21473946,9651018},{-23037201,11946550,-1388935,15278753,-13426353,7936285,-6450968,-5528984,29631088,14235601},{1,0,0,0,0,0,0,0,0,0},{8098942,-14851207,-21281864,2899750,-21591188,5927469,-5280557,-813734,-14135401,-1581189}},
+        {{-7475157,1347225,-27814085,-9123919,14704466,11084251,-12565027,12329694,-16350181,-12734523},{14823677,9277934,7821632,-8005461,-30141632,12057709,-14355786,-1623296,3469571,5677167},{1,0,0,0,0,0,0,0,0,0},{-19640600,-6969371,-21592918,-10027459,-18123209,3109911,9990474,10184846,321296,6230409}},
+        {{15035759,5250401,24185471,5126873,-27765036,-1913670,-3242545,13929088,10973398,-11608717},{-21254231,-3131950,19819627,9148779,-9315355,6456387,-3529023,12955545,-24004374,4405177},{1,0,0,0,0,0,0,0,0,0},{-7208055,-12897712,-4948232,13099883,-29757036,-14719564,9191112,15313181,-29311566,-14765786}},
+        {{8569959,8123456,30319091,-11757956,-1838113,-12376258,3375460,3670826,18540150,777176},{-3624201,5981918,-5618761,6303401,3083338,-14523683,2640730,-557842,21193559,9456124},{1,0,0,0,0,0,0,0,0,0},{3341784,16163075,-28327921,-1107848,34443,-1678562,18933618,2444884,11842872,-12884807}},
+        {{27137403,4857350,4018576,16287276,-33401579,1287534,-14775276,4259421,31715648,10966225},{-9553825,-13658439,-17843987,13638379,13746981,5456779,-6573886,15810867,13303668,-5504152},{1,0,0,0,0,0,0,0,0,0},{15891960,3325144,-33392433,8395258,-7842359,-5370720,-28577448,-13205091,8261478,11792497}},
+        {{-19566363,8981251,-25057868,11994262,-30813407,2311665,4484949,-11965632,7537420,6251848},{-7846087,10737157,10686723,-16466708,3440681,13396821,1562565,3805536,11970459,2291291},{1,0,0,0,0,0,0,0,0,0},{30366930,10250810,-4894956,1860708,-28492504,-12850638,-29754073,-10976855,14885802,12452601}},
+        {{2632212,-2844844,-16935412,-559103,-19058321,12295429,27555814,9460028,30947480,4551037},{-19735323,7986503,-5562736,-15093345,-22902721,3701732,-8693528,5230815,17757954,2659639},{1,0,0,0,0,0,0,0,0,0},{-5768438,-16072735,-180591,-9196792,-6988833,-5033537,-14771851,-13657591,-19546228,16197678}},
+        {{15122462,-10323006,-9424438,-12861833,27241692,9364889,9588247,-10287429,-1979717,-4552416},{-33156595,-555928,-17474018,-5836423,-29396363,15014686,-30902852,-13701349,-31497123,12281057},{1,0,0,0,0,0,0,0,0,0},{19957603,-12474454,335768,-13208195,-26337550,7684943,-5478608,3243057,4974693,-6829149}},
+        {{-24730322,14628643,6175405,-16572899,-6149914,-5315994,-24444808,-9116886,8144091,-7157606},{-31746302,-10831725,-21898475,-13435468,3052682,-9538225,-23656709,-10126462,-25235768,11067463},{1,0,0,0,0,0,0,0,0,0},{-13345501,-13855275,6449074,12148272,23114762,13519054,12869112,-7104813,-20897347,10039232}},
+        {{26234970,-16527253,30623549,2519360,-27223691,-80251,-27463051,16157750,9442995,13302159},{24067258,-1071418,726678,541451,-32292422,-6937785,-27674103,6965482,822608,1562313},{1,0,0,0,0,0,0,0,0,0},{-6254004,3513285,-6396966,-3534631,-14264095,-591184,-27763865,-4617647,-4084750,7117813}},
+        {{11567039,12290738,-10570926,4328039,29285567,5300872,29590139,3363041,13201142,306468},{28892223,-14591499,-4743888,-14856628,2383614,6023169,-18578269,10713524,31536825,-5293780},{1,0,0,0,0,0,0,0,0,0},{11427969,13621028,-4866497,1597052,24391712,1753120,32916228,15600593,-14256908,-394400}},
+        {{-29180535,-8104187,-30429026,-6246859,-18992493,14769601,-20115162,-9988333,-32243491,6650907},{-10318676,-4429343,11363303,10694490,24862090,13025787,-20844396,-4265615,-6478991,-1869313},{1,0,0,0,0,0,0,0,0,0},{30167655,-2025510,-28923001,-2531672,25474721,6818556,-28121614,1921021,-2217887,-13837212}},
+        {{-17361934,1448335,8031611,2398478,-7394093,8827439,-14381009,-2033788,5099842,-12740738},{27039513,7175287,-17285815,5431290,16386195,-12341245,26810482,-10140409,-34109,-3091998},{1,0,0,0,0,0,0,0,0,0},{26593631,388242,-16443943,2419629,-27108752,-756294,16908903,-3877537,2671150,15572567}},
+        {{-16598963,10580737,-16561301,-2530062,8149974,6274803,-5116650,4075572,28396444,-961307},{19970221,11109440,17462444,15267556,-8054252,-4729951,-15442801,-14329781,-14320257,8528780},{1,0,0,0,0,0,0,0,0,0},{27702512,-1436965,-29317894,11703214,20622129,8139977,-19086795,10147896,17733293,15144167}},
+        {{-12316559,6054618,17412295,15677834,32064753,2570546,-21940244,5201745,11496147,10509374},{29929181,-12561865,4306322,-7978399,-23138860,-12081233,28361608,4694274,16495177,-3712261},{1,0,0,0,0,0,0,0,0,0},{18016909,-8101928,5149751,10964647,13853412,15662927,-28999056,6562978,-11083840,9870314}},
+        {{6349853,-10611370,-30313327,-12775777,5748320,-12435099,18041715,1302508,2192281,-16684757},{17430402,5730505,-4834829,6813104,20277692,-12164372,-32660386,-940862,-7049147,5908810},{1,0,0,0,0,0,0,0,0,0},{9403813,14707771,24858978,15163485,-11764695,15835683,-33375592,-5053029,168771,8186757}},
+        {{-1890185,-14514803,26863854,-10017096,-9920522,13695730,1249374,-8493139,-20636904,2506048},{-28837459,6379532,-5779235,-5048939,29810119,-8844505,-15956769,9817842,-4165044,14562997},{1,0,0,0,0,0,0,0,0,0},{-31103182,-3453681,-30574619,2574618,-26603103,-12044757,-5393994,-5427138,-32631905,-27579}},
+        {{30556966,-14788706,18436762,15670228,-17851470,7175234,-2779981,11411591,13623790,-16616508},{17445174,-11596250,-8870038,8178418,-9788596,14550376,31231336,-3803373,10339149,1133175},{1,0,0,0,0,0,0,0,0,0},{-1724784,-16581759,25027634,3427082,-11839969,-409777,-2198596,745965,-10226526,5202225}},
+        {{15975878,12082040,5750352,7939149,-18958188,3737185,2525294,9491101,-3851153,-7170457},{-1662319,-9321820,-6736879,-13427947,-2915063,-15558466,6345100,13792911,18427334,10281718},{1,0,0,0,0,0,0,0,0,0},{-4226394,-10769149,29867582,3445587,-25545289,-5467509,-8167655,12324098,4439690,14082754}},
+        {{-8027817,-3549590,17571880,15595347,24506397,-16304253,15755549,1608265,12219334,12445021},{-27741557,-1650926,6269119,9548758,-22693010,-10660993,-19130210,7425253,2595946,-799028},{1,0,0,0,0,0,0,0,0,0},{32048384,8202385,-7864731,-4883856,-33381653,927456,-4614227,8672660,-29086396,-15695957}},
+        {{15480397,-9466223,8594028,16695745,28078151,-4260712,27636482,-15526164,10461451,-16718100},{-24894605,-2945114,9701046,15321740,19911097,10431101,8244166,5033079,-9288478,-3693880},{1,0,0,0,0,0,0,0,0,0},{25751951,-13164600,-25672864,7740512,21046804,6507873,2532719,14399403,3897216,8876748}},
+        {{27459294,1462762,-33085676,-11327046,8157033,8098913,22541003,12160165,12106420,15357636},{-15166787,-7261860,-5701137,-638021,-27081224,16634508,4899765,-1576363,-6027799,8298550},{1,0,0,0,0,0,0,0,0,0},{26687904,-7426689,-21075060,831374,-23702508,14264227,17700073,-8345723,-27800272,13931014}},
+        {{7307829,1491535,23184215,-9472734,-20606617,3887989,28760306,-5876131,-28417527,13331729},{-477446,4640613,-21498535,-12340002,30913864,-7433364,31331421,-7525357,11681050,-11149445},{1,0,0,0,0,0,0,0,0,0},{-31310843,3165545,27295234,531855,13862784,-4570263,-26542470,16357008,12098858,3940708}},
+        {{-29112513,1449035,33461906,-10308109,20285276,-12819467,-6177104,14669625,-21632514,8410318},{-25654322,-2895344,3778186,1419858,-21049561,-14537860,1808525,-3089134,-21727900,1541212},{1,0,0,0,0,0,0,0,0,0},{25215590,12143593,-10098197,12605683,-24019449,3177207,-29251996,8689243,21145654,16239342}},
+        {{29886524,16049808,-23652892,4696788,-28961725,6411682,7330713,11020860,2925607,1482493},{-3299567,-14001171,11078916,5151606,31265346,4772967,31833009,7260246,-23198933,-11369578},{1,0,0,0,0,0,0,0,0,0},{20245715,15298468,18932595,6714611,15659591,7156541,-22635339,15740455,-14254749,15363965}},
+        {{-21571619,-16431772,-117299,-5113471,-3545875,7386770,-20754433,-2456866,3777777,7983324},{-4009495,-13116515,22260697,-2672190,-28352170,-1535606,2480097,-11741620,-14180485,16222333},{1,0,0,0,0,0,0,0,0,0},{26403740,712789,33395937,-2156530,20465866,12128466,32297579,-6761252,-18828292,-656366}},
+        {{5784937,13150925,18021450,3402345,-30551433,-14381562,31280277,-13787557,-11992204,11068946},{9474034,15024819,-27243316,6437729,18924628,-13357438,-8736314,15229297,-17085258,-12865133},{1,0,0,0,0,0,0,0,0,0},{-24509817,-14303954,21268765,-5300010,7476763,16043589,-32739125,11740441,-18491368,11095531}},
+        {{-24673234,-13665351,-9855165,1852341,-10270746,3831939,3810456,5601833,3059831,-10521890},{-9616382,12225238,-29949318,6036681,-17067086,2451162,27247091,-3831123,13642202,-332281},{1,0,0,0,0,0,0,0,0,0},{17180462,-12150829,-9926852,-4179417,-7648406,13175837,-9096556,-8306836,-13458715,-1146063}},
+        {{10282888,12047922,-20575739,-3465103,13986703,-8154416,-23786925,1545804,-19366175,15914071},{7982377,8522663,-24777370,-1907188,-7465274,7533651,1206097,-14698416,25984401,2681044},{1,0,0,0,0,0,0,0,0,0},{-10042470,7555760,32676752,2371339,-10956610,-7680310,5035670,-12600568,21737999,-10635262}},
+        {{1581672,448390,22105270,-15008133,-8917583,15988455,-23793406,14566562,1450890,-16583118},{-31563669,7070653,23211649,-15601046,24190485,-3007699,29241361,7318497,4915352,2655380},{1,0,0,0,0,0,0,0,0,0},{-25956979,-7152679,-33236551,-443109,-22742286,-7376354,-13978970,-11919334,26873113,-15695494}},
+        {{29995377,-5187445,-20235989,6495876,3367310,881940,-21954400,-3585464,-11513082,12112565},{16896410,-4356212,-27783175,16477522,13115261,-9236405,7980826,15145345,7108825,-10381102},{1,0,0,0,0,0,0,0,0,0},{-15985738,-3058069,-9020901,-16345695,28919347,6109980,-4155768,-6602914,-27763814,-4224870}},
+        {{-13591793,-16361788,15396935,-13799624,15570112,10249980,-6252246,6243732,-33330108,-1350998},{-5063921,5601618,17027421,-2339837,4620841,6949119,-19163757,-13104029,-11813436,-11095857},{1,0,0,0,0,0,0,0,0,0},{5210797,11977176,3124737,-13058889,840555,8235742,3851427,-4968800,20138401,15969129}},
+        {{26069955,8312947,25314779,848684,-225333,6986455,-14800166,-3857092,14178208,-1801534},{-11125825,-15387347,23808413,-3193563,-483232,8110756,-33491481,-16051667,-5054908,9111430},{1,0,0,0,0,0,0,0,0,0},{10579646,-10108605,-21035114,-15759621,-8292672,-11697352,-10263580,-12954022,-31780710,-2799965}},
+        {{-15457370,-16601257,-16377570,-12321620,32218277,-8493159,29462379,-15569598,-28336707,-7048652},{-10436700,-13798954,-14487912,-14214080,17939595,-78990,-15901019,3750947,-25028574,1755572},{1,0,0,0,0,0,0,0,0,0},{-10934727,4592200,505955,10249855,-24534369,1372440,7656483,14943484,11922264,-11000182}},
+        {{32667223,10974925,-9077235,5577893,-4398374,12506700,-5109245,8443148,31231324,5515528},{8609254,-16734153,-10265981,15760831,-883259,5590766,31137828,-12968217,24251518,10903879},{1,0,0,0,0,0,0,0,0,0},{-13247512,-7237162,-32305953,-13155892,5069296,5218720,8085896,-1780237,-16528838,-3442329}},
+        {{-13938268,12816215,29766097,-11354590,11801616,-14807981,-26019992,15891098,-15802567,-13372839},{21271312,-6117565,22436574,-11756610,25372763,6887846,32754951,6466705,-18000910,2590136},{1,0,0,0,0,0,0,0,0,0},{-889717,-3176327,-17893011,-4262225,19151202,1206047,18386837,14450785,-7643110,-7278414}},
+        {{-22329980,3530476,-19776712,-4429609,11388551,1142330,-5660372,-4314290,-29019579,-15013021},{-4136299,15467480,-30109296,-5391082,25026350,9197125,24310631,15906077,32087934,1711256},{1,0,0,0,0,0,0,0,0,0},{15429431,7734920,-9034824,-2743006,-22599683,11913878,-19322370,-9753364,11404788,-9911381}},
+        {{-30736408,13965003,10704876,-779624,-4942586,9499440,-10263522,-8817245,-32967948,-914818},{2812734,2797312,11826453,5004379,-730415,-10920632,30994546,16561923,-23273806,527417},{1,0,0,0,0,0,0,0,0,0},{14475273,-7092862,-28714353,-5249151,18560095,10665792,30648560,7518922,17257542,-10331375}},
+        {{-1147150,-720617,-10936753,6515450,-29707615,10795564,-15987087,-11184603,29971367,-14248009},{24459219,-702932,-30806692,8921425,12086436,-13782627,13310457,-5430451,14352597,-11750257},{1,0,0,0,0,0,0,0,0,0},{-20024348,-7286574,-9592108,16060315,-14258742,-2318387,17261027,-8269593,27173913,-3747038}},
+        {{-9253719,694658,15455262,-15805728,23324959,11287958,26584277,6052537,-7805652,12337492},{-22869168,-14918660,-22172792,14490772,13061934,-2098266,-13042583,-6637048,-29519578,2137228},{1,0,0,0,0,0,0,0,0,0},{-29426919,9553407,6537200,10143756,23123741,-2849113,-3114850,3943202,-17272875,8750499}},
+        {{-14132450,-14843371,27759741,11564325,1455121,2386516,-3514784,-3547881,-22484059,-16595998},{19543988,464452,30286444,11405713,-6248018,4765703,-21535147,403809,-1016081,-7488254},{1,0,0,0,0,0,0,0,0,0},{-11405363,11039405,26371970,5705455,13605166,7349121,13923476,13568847,18746890,13829388}},
+        {{-8097728,-4500431,-33475939,-15630646,-12225507,-3021874,-15712078,-12068652,11524468,7139340},{24588679,12894148,15955855,-13338623,-7111387,-15029435,-20776620,-1338743,8351496,16380161},{1,0,0,0,0,0,0,0,0,0},{-14253898,-3972852,23332514,2707383,-17483359,7957281,25503705,6765052,22400406,2636723}},
+        {{19721585,-16078013,1518176,10318656,-15215307,-13395463,-22642867,11348347,-19207727,-12594309},{-14941375,16030639,-27721284,-7096317,1420242,901264,-29294193,-1938291,3809274,13372796},{1,0,0,0,0,0,0,0,0,0},{-20789666,1983927,-6622384,3351216,-24547440,-7605789,20677783,-1135091,-22642464,-2400280}},
+        {{-18532838,5973879,-31627605,3186852,24886301,16416999,-14705340,-707848,-345752,-10235315},{30223235,6192024,2898890,694719,27538576,10513124,20694325,-9196940,-21782999,-9261769},{1,0,0,0,0,0,0,0,0,0},{33362885,11528558,1149394,-2444497,-23443800,-8218919,-25597300,13653616,26642528,7318037}},
+        {{-12422202,-3378774,16356911,-9771789,-11679759,1102388,17634136,-7798153,-24392891,-4007017},{-19593526,-15950721,-32458122,-5889793,33378251,14485257,9989255,-14983326,31929575,-11333476},{1,0,0,0,0,0,0,0,0,0},{535129,-4671794,-25629780,-12832581,13443425,-8185125,-23487928,5867797,-23441708,-16212456}},
+        {{-3437662,-5080560,-12948670,-1364894,6769400,14974409,-7126686,-7750060,12151678,-4918418},{-20914143,-6787928,-23704499,-5143658,22715039,8675752,-22180615,-13770608,27565567,-5149602},{1,0,0,0,0,0,0,0,0,0},{-24563128,3228643,-9754046,-4588638,-10881302,1262026,19316575,13039482,-22931546,14715891}},
+        {{-27932601,-6861719,20479061,3679549,21502002,-6406609,-29475164,7117283,17174178,1129036},{6824799,4903858,7698295,13434877,2151227,-4270420,17341370,-16682755,-20816447,-7429393},{1,0,0,0,0,0,0,0,0,0},{22664302,-11338563,-593348,-7424944,21882893,1193750,31095330,12523362,-14016593,-16018863}},
+        {{18130067,-501287,-13507603,-10264267,-28400655,3841660,-14189113,3673841,7946359,6557606},{5572154,-14341543,-23895943,6565687,4798444,950463,18994999,12635156,-19758047,-854806},{1,0,0,0,0,0,0,0,0,0},{-19923136,5782604,-18667529,15142850,-4648984,-4471932,16573511,789722,23005387,11675164}},
+        {{26592431,-7198009,17161050,4997783,13977381,-9188808,-24599746,7623530,-28622865,-12678088},{-22616612,-1551035,12337493,12094237,10473238,-13604781,14464990,1427739,-8892376,-8143245},{1,0,0,0,0,0,0,0,0,0},{-29772471,1501657,-27100450,-6460679,-13409997,8039869,19239412,-9918215,14665869,12514513}},
+        {{-26421081,-15119394,-8480165,12467816,7101400,-8712385,-14023542,-210026,22402502,5110834},{-29010261,-9146353,17504980,-7390832,-21522395,-12498391,-4795868,775021,-21294481,1885550},{1,0,0,0,0,0,0,0,0,0},{810340,1887015,-24825119,2551931,26428867,-2540164,31167137,12989015,-2243,4669934}},
+        {{-266493,163075,32275212,8401017,32886883,14030314,21113605,-14493957,-29404736,14388151},{-12151547,10407259,-24515029,-1786903,-25271542,14198713,7995180,7739016,4087650,7665046},{1,0,0,0,0,0,0,0,0,0},{24720851,13037379,-7102515,-8544769,-26253731,-16749014,5460905,-1392033,-16948825,6403406}},
+        {{-6604572,13093236,438576,-3011829,20219696,11962341,31468725,-6167240,-12683085,-5319838},{25638887,-3343877,-20914768,-13175359,-12813502,-13985933,8942890,-8291078,12795707,-9361933},{1,0,0,0,0,0,0,0,0,0},{10579513,-14090646,-14190848,-14757925,-26435713,-16721851,-18664748,3871930,-7224068,12664977}},
+        {{10393414,13792439,13487242,2331620,20422886,-14741376,-362010,-12249154,-3159904,2337374},{24287521,-14901275,-9448717,-15552792,5974640,-6893948,3317429,5231306,7576156,-1713449},{1,0,0,0,0,0,0,0,0,0},{11088712,16355594,20996661,-12495146,28453618,9300379,-7119101,14353159,-10954352,-5287995}},
+        {{25006573,14465766,-5963756,-6179023,20516945,11988999,22128729,-11587257,12344787,11647},{21839058,9574992,-16530865,-490181,-302435,-1650170,-28021322,-8164323,27240777,6284556},{1,0,0,0,0,0,0,0,0,0},{-17730534,-6643884,-14043386,-2364921,7526827,16528122,3388182,6441603,9949833,-14997713}},
+        {{31543666,-9216659,8976377,-12133873,-10790267,8189058,3235277,3323264,11746577,-8698121},{-18744421,8528957,15488735,6231543,32259330,-4492637,9026812,-9575392,6830944,12917295},{1,0,0,0,0,0,0,0,0,0},{-1304817,-12984649,27295611,-4186640,22191263,-9133187,19844310,13792938,-11508930,4011519}},
+        {{18442750,-7348307,-30086742,-8841009,-15659472,-662913,29906019,-10497906,22468603,3567685},{-11953007,-1898287,-23047783,15163483,22818396,4180985,4514832,-15082111,-26013338,-7633738},{1,0,0,0,0,0,0,0,0,0},{15747944,7838891,15033737,7219744,16359127,13452995,29376427,-15839426,20387034,-10768097}},
+        {{-28449308,10972886,-23170648,9653500,9670344,-15310315,-18266466,13895926,31073145,16649838},{-21719815,-452318,27961699,7308626,-21076871,12177064,-32871131,-8844351,20788296,3685493},{1,0,0,0,0,0,0,0,0,0},{-26735194,5440147,-20536170,-15687331,17734663,12957819,-3116271,7513574,8956464,-12193480}},
+        {{-31939831,906158,-31759915,14347948,-18614464,13417822,11110310,3713337,14376213,15493487},{-26386855,3881208,-15757156,11667537,20220670,-8686447,20032419,10311535,25631511,-4934023},{1,0,0,0,0,0,0,0,0,0},{13007597,826690,-11170552,14186417,-20135777,-44615,29702727,-6166260,-1805022,9301883}},
+        {{-28085115,4193434,-23486982,-6401610,24818079,11828444,-8945055,-9910112,20843302,-983068},{24811448,-7170876,-15787731,-12470831,28651141,15719156,-13330273,10230054,1849354,1141612},{1,0,0,0,0,0,0,0,0,0},{30175235,-16359314,22050579,-5426937,-32777512,-1936709,2483967,-15899302,-2453072,-8589367}},
+        {{-24073173,-2982038,32621894,8295399,-2110766,4853295,-27687659,-6064426,-7754106,4302015},{3053309,-10231576,16626862,5701076,12543836,13174512,10758690,12768225,-19090774,9950335},{1,0,0,0,0,0,0,0,0,0},{21929939,-5545751,13271940,7592530,-30100096,-4870079,-7997252,9164977,-7296825,1614326}},
+        {{-33243580,14112164,480423,2830348,13418500,2539973,592092,8355233,27759449,-6243240},{3606884,-15200112,3129186,-7065540,-14570675,15652016,-7446322,13631334,15613650,-15269869},{1,0,0,0,0,0,0,0,0,0},{-7064450,-6887690,3616983,-6050119,-19166839,-5583119,1391699,16373612,-5476909,359580}},
+        {{7382311,-3427614,-21919589,-8820617,-3695197,12132560,20799905,-12851548,-13275254,6290094},{25584399,5191960,-15380878,-2977849,18741157,14963928,18825761,-15006350,30964874,-4063276},{1,0,0,0,0,0,0,0,0,0},{2670097,-12098372,-16465587,-11467742,24892742,-10139617,-14358377,-7131889,-14133639,-15747779}},
+        {{-19174624,16234193,29476522,1713969,-26106089,-4376588,-16805534,11397974,1497304,-3598390},{25007542,-12041337,-28911226,-5721058,-17828089,-5380704,20188488,-7386512,-7909594,2859694},{1,0,0,0,0,0,0,0,0,0},{-604366,-4842976,-23588886,-351151,-13911534,-15396532,4348829,-5334701,-23898613,7441728}},
+        {{-3333563,3890264,-24697819,7633541,883492,-9711940,922384,-15248277,22654541,-8872887},{-22332284,-2909025,4927043,4295893,27656702,12306599,-12113895,10476802,-11741861,-5121491},{1,0,0,0,0,0,0,0,0,0},{20775515,12491795,12490488,-3821417,32758889,-12297953,-6830262,-14022989,31319670,-15763068}},
+        {{-21189099,-11218717,22240551,-9940650,-26465961,-6642977,-150522,-4555069,9852012,-8517609},{22734798,-15953914,-19754717,-15782521,6867444,-9342349,21628590,-16469602,3838085,9417644},{1,0,0,0,0,0,0,0,0,0},{-4619631,1807946,-12322750,15110790,828925,-7564092,-20577294,-15958008,-5517827,397855}},
+        {{-1350888,10495334,-100776,-4243702,14652467,10020894,-18568594,-5292747,-26915737,10554412},{-3698255,-15077400,2899217,-16501941,-13335357,-12764017,-26970274,4820502,-16830160,-2614153},{1,0,0,0,0,0,0,0,0,0},{16827133,12697380,21238407,6927542,-26185763,4397196,-15767311,-5771900,10689941,16474543}},
+        {{16529378,-3814350,11359059,7164278,-8721821,1088875,1319027,10907138,30762863,6909055},{31338611,15369384,-16378112,-6859775,31394592,-1619000,-11742452,5210229,-17013350,8548981},{1,0,0,0,0,0,0,0,0,0},{16077731,-11485205,8346081,-2963671,10084295,-693102,27940513,-12757344,14054511,-14016726}},
+        {{-33232309,16511789,24772956,-14028921,6584375,-11011287,-24656199,-15878771,26650004,-7828650},{1114869,13435828,11927491,-6900910,10686287,13700028,-24462499,11328807,30669729,10671085},{1,0,0,0,0,0,0,0,0,0},{-9528338,14958737,-22368026,7314033,3820719,-9077145,-13184534,12615351,15685832,-9354388}},
+        {{-12120935,9574913,-5235674,9413347,-32694068,-2438087,-24870100,-747178,31049203,7626874},{17503517,10583117,23530556,16471208,-778057,-1976413,-19004282,-12451421,-20995447,-5820746},{1,0,0,0,0,0,0,0,0,0},{20309974,13024927,10600103,-4962228,-26808014,7376691,25467009,-6436778,-17773520,5605947}},
+        {{20230500,5274816,-13652892,2084252,8145958,8132765,23904226,-9005365,4964732,15928810},{-30956743,4312418,-3264721,12228407,5664465,15964398,-32227766,-16455843,1942569,15251265},{1,0,0,0,0,0,0,0,0,0},{-32208834,-4318978,-8298609,9325807,-22887087,-4945402,-22031643,-13880469,4224989,8941708}},
+        {{31738552,5586909,6937991,-4811208,-8758590,-7501857,21423866,-2136292,-29165046,10728788},{-18966304,10194091,-28112278,-16007111,-19525954,3730857,-9554305,-6659644,-21917838,10557984},{1,0,0,0,0,0,0,0,0,0},{-213692,-6983216,-3163622,14889646,2994547,10944022,-20284888,-4830327,17622788,15408313}},
+        {{-22467540,16526043,-8788661,-8297450,-28182527,6857443,-30354798,10285017,-522339,-13399010},{-18474250,9776135,-25931072,4621030,18284105,1520803,2884154,2172568,26959544,4136462},{1,0,0,0,0,0,0,0,0,0},{-17119568,5876462,2771885,-1052638,23369657,-13326311,-2196027,-9718355,9457804,-12343029}},
+        {{10607519,-12125111,8632852,-10587088,-8750240,8670874,19859203,4231847,-12968532,5589535},{-11492285,-672406,10673110,-2213428,7669152,14740042,6088113,-14694956,-23911765,-5446038},{1,0,0,0,0,0,0,0,0,0},{6612996,-9826354,28151591,6154897,-31962467,-16510664,-20668346,11721152,-15010825,-2315316}},
+        {{-8995756,15990429,-498481,13305411,18834119,9750680,21114429,3392737,-27820825,4000372},{28746777,14961057,13347562,14641756,-28067785,-16032153,22070775,-9375886,-31541387,16529578},{1,0,0,0,0,0,0,0,0,0},{-2644906,7501859,-5406194,6784154,27841896,-7896931,-18107430,-320047,4835498,12461431}},
+        {{-18692390,14254156,1859414,-15859254,-30985090,-1251625,25958480,13823539,4784124,-10247188},{-10683272,11556725,4966482,7496175,-27219815,972564,7969201,3543723,24048129,-3580536},{1,0,0,0,0,0,0,0,0,0},{6848138,-13330696,21478052,10911728,14149307,-11761237,-10603173,2257304,-16910783,2409062}},
+        {{31230267,-15013749,-3575089,8514819,-22445129,-4562017,-30234056,14865763,25263282,-6332040},{28456295,15513748,18589606,-11571629,-30089020,-16243828,-28844273,-15198412,-21838717,10516560},{1,0,0,0,0,0,0,0,0,0},{9889525,7226745,-209992,1111787,-26328999,13417006,5393506,13013168,-14482532,4397284}},
+        {{31882729,4288925,-20042697,12760974,455637,-6828782,10571910,6385255,24441432,-13022582},{6374531,3476841,-20669795,-3927724,4303620,525030,-31521088,12084911,18112259,-9052903},{1,0,0,0,0,0,0,0,0,0},{-6686413,-7898155,-996063,2366538,22462619,141243,10440667,7243142,-32651175,-13012988}},
+        {{15738736,-16677367,31159699,13301414,-20601758,-9720546,-9348796,-6079740,30020882,-9373811},{-28375494,1794685,8121407,3617777,-18038862,6894198,14004587,-14586430,645051,8807450},{1,0,0,0,0,0,0,0,0,0},{22933822,-11095002,26925442,-1952074,-2440944,15538574,-7438659,-6602787,5714050,-15406223}},
+        {{-19846531,-470429,30125394,-5684811,-428573,-16650113,26770266,12539938,-31381650,7482585},{-31498522,-11519144,-29232179,-16684265,-5544066,-14485610,10387528,-8293049,3353652,6326067},{1,0,0,0,0,0,0,0,0,0},{-19794002,4624169,-18886014,-9188131,-8610817,13063979,10927149,14436055,-25616579,14606143}},
+        {{29972188,-10490811,-23770880,7496696,30065070,-2211242,18329100,4124920,-27004465,5267036},{29649149,15943844,8194668,-6392394,1623409,-6733780,1093992,9656110,-25464409,469607},{1,0,0,0,0,0,0,0,0,0},{-20104721,-11836697,-18178671,-1652026,-30493257,-2214052,-25161781,-1948718,20088865,-3681002}},
+        {{-19693068,-2493703,-32207293,1293937,-10537746,-4151973,-33385361,-14996991,-18002603,-9679763},{-11019266,15865220,10750832,-9137517,-27017735,1276792,-7349977,-11067197,-4888700,-1026224},{1,0,0,0,0,0,0,0,0,0},{-23419444,9472054,-2294548,5523369,-4227338,2769218,3605387,8474859,22413248,7846225}},
+        {{-8268510,-2344174,2186357,-3041725,29518871,2039589,-17859314,4497411,9830141,10557658},{-9352541,9701574,-19161076,5860369,20618845,876053,33217204,4125329,9830371,9206393},{1,0,0,0,0,0,0,0,0,0},{32291681,-11731080,29953876,-13152092,1964967,9341119,-22715577,-14909277,26227463,-1786424}},
+        {{20283338,658718,-6080410,922418,5943123,13326371,-5752360,-14525539,4606050,6392855},{3956668,-13914849,-3106463,11015761,24490707,-4816227,-33467771,-9324159,-24664046,11876946},{1,0,0,0,0,0,0,0,0,0},{28079199,-2741907,-10650208,-432374,-6569873,-6068476,-13002558,-4890595,172191,8493670}},
+        {{33346617,14202057,4189515,-9030498,30970162,8835984,-18144995,-1447789,-22759815,-15828041},{26774058,12683443,-6302917,8689978,4345224,3275561,-29350506,-4791031,-21684279,9696907},{1,0,0,0,0,0,0,0,0,0},{-3796968,9891851,-26078733,-15259674,-20858078,-7649243,-30289106,11540677,-31378758,15827180}},
+        {{30498887,-644742,-28144422,-6543969,-835683,-6572824,-15244802,10837126,23074774,-8550719},{-19777121,-15761141,30581011,-9065358,309200,13343345,29448622,14119691,-23502704,-9831985},{1,0,0,0,0,0,0,0,0,0},{-14379020,11382625,19613895,15483882,-13525394,9569409,-9643995,1615642,-3818624,9098954}},
+        {{-32025687,-1744089,17909938,-7515321,2008729,-5251531,13152457,14000087,32807561,-1841419},{-7261408,-2745052,12272090,-7208697,-12157026,11969410,-28133270,7732033,-18570016,11445138},{1,0,0,0,0,0,0,0,0,0},{27379451,-3885330,-27854701,961546,-25071363,-11951403,7376925,-14007582,20809637,6259010}},
+        {{13661927,-5976432,-32155948,-3195207,-18683983,9035879,689655,-5929407,-12654747,2880520},{7204312,-11692833,11209666,-5399713,-26645786,7576435,28413379,-7450653,-32408317,-16098068},{1,0,0,0,0,0,0,0,0,0},{15597581,-15746896,25751255,-10828063,-13458469,-2728203,-9360965,-12692879,19472254,4440521}},
+        {{33088430,-257366,-26985053,-14660461,6732264,-14653764,26898979,-3674912,-690845,2169044},{-17231325,13204716,21314316,11758953,-22336122,14518957,22878219,-14574481,-993076,-5063795},{1,0,0,0,0,0,0,0,0,0},{13882210,3337233,-17723078,-4986278,673867,15139447,20166294,742599,-32367090,11205708}},
+        {{28003021,-3636519,16375561,-3144462,-13971659,1677233,17061510,-920877,33540211,-11758216},{-19643296,-15758564,-9747768,15021590,8372544,-3762607,22491949,-7568659,-30989698,9409869},{1,0,0,0,0,0,0,0,0,0},{5291773,13631868,28515035,-5160589,-33118854,915117,4378122,-6420929,-6011542,4943676}},
+        {{-19311495,-12291957,16275512,15079362,8359524,572746,11717358,16680044,-26773591,11155341},{-8987851,13733087,-1310804,16244120,-28595623,-2765720,10636618,7233734,-31245287,121635},{1,0,0,0,0,0,0,0,0,0},{-26675659,3145281,-18653209,3654754,14504389,14719996,26876200,8060404,-32492027,-11666026}},
+        {{24886752,-15500927,9465036,12782290,-11460317,-16050696,12253123,1122457,14116712,13929340},{9924514,2294558,19387986,16551865,-20494467,14129946,26364629,6153184,-21958006,8801289},{1,0,0,0,0,0,0,0,0,0},{15225969,10618106,-7377139,10547268,-27918796,4047783,20365178,-1788532,14215212,8932307}},
+        {{1904772,-10783080,-26040140,2959406,-11221266,-124503,29974681,-7733568,2360531,11824671},{-16415086,-8321249,-26426038,-2266740,-2946902,11056540,9839364,-5257500,-4144935,-16478291},{1,0,0,0,0,0,0,0,0,0},{6718275,-12443892,17925707,-6716751,2024393,-12878781,-32814324,13299484,-20975971,-16578197}},
+        {{-24211869,2216199,-20080896,8567268,-7145931,-16094565,14678571,8490972,-23595559,7298165},{-26681348,15458261,-28866620,7418126,-19060325,7263092,-26925274,-11329042,-24487456,14108130},{1,0,0,0,0,0,0,0,0,0},{-21445378,6501265,-19168926,10647945,20486013,-1967734,-12683684,2780905,-23288768,-4912640}},
+        {{29655749,-10959438,-11418731,10160480,20896562,9857582,28093279,-4882986,-20417959,-15958823},{-27825702,16521489,-22821880,4225614,12839791,-12297520,16364143,2925618,-6462032,-9480192},{1,0,0,0,0,0,0,0,0,0},{-3446546,-6854963,3156228,6999998,33332365,16517153,7496491,6977938,-11806258,4426291}},
+        {{16353159,-9159000,6781139,562418,-28228008,-14544070,8635803,14174134,24254744,7472510},{25279500,-15421165,12650982,-738409,30008909,-14937318,17946461,-2889874,-15907213,6188948},{1,0,0,0,0,0,0,0,0,0},{15642628,11631496,-17296491,-983434,-31340329,-10109980,-30055762,7199631,-29027865,-4750950}},
+        {{9775514,10917208,-3470875,14028179,-7612630,-14693143,-12900662,7017611,-21174460,-3990339},{12263908,-12992369,19120643,4964595,-28246947,12205527,-9933041,5475881,-9545953,-12326090},{1,0,0,0,0,0,0,0,0,0},{-22677215,-2056191,7081906,4285309,13759263,-7693365,-32780455,-7257907,21082020,-4089922}},
+        {{-10443506,-10648141,22836784,-10928524,5603330,11063130,314581,10818781,25953651,10836724},{-16946917,-13352522,32914584,4877322,-10096570,14951565,7842788,6793668,-17527230,-11440111},{1,0,0,0,0,0,0,0,0,0},{17826754,6475798,11115164,-6331554,15260280,-750905,-9529992,-14693984,-2242262,-2222320}},
+        {{15265227,-8018864,21807508,-8657189,32459222,8343437,-31836597,-907092,-5782876,2665951},{-22435686,16739039,-8685399,-12878443,-26773649,3299139,30166777,15260596,-18439940,4897114},{1,0,0,0,0,0,0,0,0,0},{22475398,10517802,-17932151,8595301,22328150,8593759,-13348407,4975687,16438642,6681801}},
+        {{7310082,-599744,-16211328,279062,8222931,-9092852,3530713,-3750557,27478698,-5022712},{-14085321,-13768153,18956483,11998717,30072397,-13294818,2438033,6378836,-23471997,11266477},{1,0,0,0,0,0,0,0,0,0},{-23311443,-727923,-7056011,-5553070,9793553,874763,1325979,8695807,27305341,-3031073}},
+        {{6214702,11991948,-26977768,-5718561,-11245304,-15899168,21829693,12153818,-25276123,-7146112},{7807143,10129824,31675372,-12359587,-7033872,13708294,4585924,-9110481,-33381534,14440866},{1,0,0,0,0,0,0,0,0,0},{-5820998,9144412,29859980,-11524608,-5311519,3939556,-32815178,-14682691,-28456071,1403416}},
+        {{-25018712,13471298,29229186,5881697,15513058,-15626376,15503430,-13744898,-28547864,-6389669},{14682309,-6425292,-9864043,6781742,-26688711,2524536,20150626,9414081,-87103,3162109},{1,0,0,0,0,0,0,0,0,0},{14531638,16647714,9582909,2172639,-2118075,15307251,7882901,-6263938,31059922,-15675205}},
+        {{-2788459,13368975,-30619128,10267042,-6328504,1025064,29862367,-12927737,28989127,-8005586},{-3559709,3876725,-13079999,-16605602,2820654,8500625,-28349397,14989521,-7881593,-4081545},{1,0,0,0,0,0,0,0,0,0},{-19087446,-5241474,-8440665,12728360,30556779,-3111731,-14537776,-7746208,-31980775,-716320}},
+        {{-27652665,570899,13558004,13478323,-9954315,3878401,17202187,2044328,3837206,-7199420},{15078678,-1282453,20621678,15414863,2902260,476534,10692148,16490063,29882180,13050978},{1,0,0,0,0,0,0,0,0,0},{-7391182,-1446099,-1984894,-6947923,-18495778,6284947,15754790,1762003,-28825218,-4338914}},
+        {{-13333462,11092533,19998674,-4244287,33208185,-7752558,-17444958,-6998909,-15260480,10795287},{7253985,-2425834,17621432,12361353,28023520,-5555679,-812615,-3792749,19649302,4891908},{1,0,0,0,0,0,0,0,0,0},{11287416,7337799,-12835325,-4994065,-12261959,13658052,863075,14196115,-575954,-2181505}},
+        {{-2583705,-1458471,-33388588,-11495941,-462597,4324126,16088337,781836,-10730022,11772056},{-15400459,-15268879,-25610304,3540555,-20361858,14423106,-27805353,-897672,-24590451,8675607},{1,0,0,0,0,0,0,0,0,0},{16476911,1886213,-18500480,13204771,-26730975,-16239227,24751474,-3781503,-17109268,-1790000}},
+        {{-7686554,1216392,20645859,14862009,-32544101,-1286902,-23540569,11855,9338481,1765890},{-14360741,-8869954,3687258,6844885,2268771,7884152,-20441986,9737199,-29505524,1862847},{1,0,0,0,0,0,0,0,0,0},{-18331144,15380754,5192700,4894715,-15020874,12588968,20950769,-7716091,-4526492,-13322399}},
+        {{22639919,-8677228,-10601425,-3026647,33505137,-8738298,-1744913,-11558471,2621899,8067487},{8924661,-14088238,-29587418,16369241,13982100,3218470,30303110,10690556,25990069,-1843091},{1,0,0,0,0,0,0,0,0,0},{26906909,-12691027,-6386277,12157537,7426479,16613742,-24785651,-6828559,-30312021,2131999}},
+        {{-26002536,-13090246,24897067,13831578,-705272,9960738,-28737649,-686745,21283923,9474145},{-32528872,-15102029,-13279458,3704561,20650981,12468932,26490402,7064637,10625146,-13148310},{1,0,0,0,0,0,0,0,0,0},{16621727,15979147,1495599,-16773615,-14435147,-14700401,18415978,10138265,-24302805,11253636}},
+        {{15380081,-3216480,-25997129,11728703,-31819567,-6913320,-27687042,-12571899,-14776242,2048030},{26077100,-7577990,23611216,-10368368,10426676,13219413,31774835,6804920,28405631,3875536},{1,0,0,0,0,0,0,0,0,0},{-4759082,-14014302,26296192,-8731589,-12589885,2467369,-19524608,-13708078,-24685131,5109883}},
+        {{4292883,-1398553,-28422970,1058879,-31240117,-347154,5827760,-14025150,-19193439,9107503},{26678129,291434,-18875498,-1773852,-33316659,-1689635,-9285805,-5585628,186960,12110420},{1,0,0,0,0,0,0,0,0,0},{31457745,6586408,12946428,3783846,13482405,1977028,-14201239,7436062,17331500,13439729}},
+        {{3174629,15112990,-423989,5409265,20739961,7753970,-30122026,-15840536,-32004692,5612295},{31613190,-6117805,-11252660,-10778205,31831784,5027765,1154660,-8089797,32620476,-11539177},{1,0,0,0,0,0,0,0,0,0},{20748600,9044104,21636570,14529240,9134830,6356302,-2938163,7694183,16349833,9394800}},
+        {{18683967,11464837,23464288,-13038869,16125262,13546457,-19206020,10689635,-3638198,6056798},{-28687260,776581,-19866731,2918335,-18676451,-8980911,16043331,-12578831,-6805809,5482471},{1,0,0,0,0,0,0,0,0,0},{11492206,-8312394,-3759538,15882069,-27787964,-11510203,-8421503,16002517,-27933004,16562661}},
+        {{20010316,-10657849,18968205,1494376,8667895,7753587,-24742155,13773247,2310064,10671717},{5560039,-4483235,10588346,-11509126,-22009512,-6141656,23864595,-13921839,-3772485,-2756929},{1,0,0,0,0,0,0,0,0,0},{-15429091,-5591245,14953660,11173222,448187,1341574,18003425,5802393,1680525,-16723548}},
+        {{-4487059,-2850708,-13871913,684113,-14568470,8898292,33407925,1620569,-23747789,12764899},{-30717665,8726984,2844862,-5436695,-1238058,13635530,-684613,-10799368,-21068913,-10316385},{1,0,0,0,0,0,0,0,0,0},{-3649462,8765618,2656625,-12173068,16868987,-13405603,-19515966,12154353,-10535036,-10136649}},
+        {{13173334,9811439,18550756,8783899,29209346,12190694,32558433,-9476039,-2899891,8353507},{-4797560,-13267247,-25289502,9941936,-15735477,8861451,-509968,14991441,-26497020,-11063191},{1,0,0,0,0,0,0,0,0,0},{-28401591,7946875,-4032360,-9524685,-9048297,-6618167,15360504,5763035,28466860,15912420}},
+        {{-8492496,-8962069,-5725638,-13043147,8024372,-5260841,3091801,2435842,-33440317,10143583},{-8795693,-11736860,-27410043,2934643,-2218964,8007904,10880131,16540168,24815494,-11516287},{1,0,0,0,0,0,0,0,0,0},{1237899,8772067,-20830349,10537983,-14443430,-9496120,-20252448,7635821,-28308007,12634380}},
+        {{-22760663,6448987,-4054605,-6849798,19614703,4952995,13053432,-7711069,18910156,-3784758},{-9947176,-13381881,-24630249,-14772163,-21272436,-3146322,8942102,9865266,-5317378,-5942537},{1,0,0,0,0,0,0,0,0,0},{18221982,3086040,-15349748,7961960,6335764,16166797,-5553365,-9134644,-2804428,-306297}},
+        {{18672712,13270279,19874933,-4965287,-4355990,-8154291,-5836870,4998510,-31582821,7837754},{2880555,7578322,-29602567,-14701394,-3183893,1513864,-3562241,-14018419,398311,-11413288},{1,0,0,0,0,0,0,0,0,0},{-18063898,-6154096,2244331,12574817,-19516353,-8101891,-20780839,2841531,-10260299,-8840978}},
+        {{20361873,-7152869,-25995138,8821803,27887226,-13648851,-812686,-7554028,-3689282,3908079},{-20403717,952432,-30819157,2800407,-17872741,6437746,15297342,10182506,-33141662,-15765159},{1,0,0,0,0,0,0,0,0,0},{-14359283,-8498407,-19678814,-1578594,-30910972,-12887584,22026867,3927221,2603088,8981289}},
+        {{-7448341,-14877222,26253255,-13536992,19059960,15022935,28953996,-7468607,23990493,4350743},{-2523908,-8673713,-1824308,15872047,-12331851,-878769,-8281434,3941189,8880759,-6173562},{1,0,0,0,0,0,0,0,0,0},{-13223311,-12832350,21112556,-7511797,-17458460,-9271501,27960270,207223,10666111,-329783}},
+        {{24327097,13474065,-16252834,-13841592,-6815699,4394484,15700427,3260345,11414073,603979},{-5256998,3662417,15936491,4145873,-19426964,14009153,19274676,-4493597,-11290659,934373},{1,0,0,0,0,0,0,0,0,0},{9732261,-14214186,-11902664,-10351555,-19762276,9359953,-1455239,-15793934,-14453203,8029922}},
+        {{16024146,12973175,-23545193,-9872786,-30536946,-4453438,-25152969,-8267313,28692376,-13250226},{24024999,-15158065,-26245671,-840115,1562164,-3159290,-6178737,14711729,12592101,-14041295},{1,0,0,0,0,0,0,0,0,0},{-3421439,15285896,6069220,-2824165,-4437828,-12481412,-27924167,9041864,-17828380,-16116148}},
+        {{-27320368,4108814,-16698987,12942051,-11784795,-2151008,-19420500,-10337112,-5029489,2587518},{12775329,14395348,18024258,2002418,-24830584,10523906,-6372886,3703085,-2816944,-10704057},{1,0,0,0,0,0,0,0,0,0},{33492624,12492033,-31120366,16705758,-31748440,3314736,15837833,2167567,-10296468,-7154580}},
+        {{21908551,-6142708,9512731,-6999150,-15885493,1270786,-10622336,-10515038,29902680,-15938787},{-33115478,-4733161,-8564998,-7170813,-29327586,-15972427,25100922,401240,-5480503,13499},{1,0,0,0,0,0,0,0,0,0},{-15384016,9683306,-11526640,-10983409,-3316872,1364638,26840830,-5078870,31953554,-8904756}},
+        {{-25855144,-12534820,29816210,-9126667,11784028,-203812,28691901,-13014018,-3211559,-14676090},{-23442411,8666994,-8414793,-14564775,-9097699,16205287,-19300101,-473677,8917367,-10450095},{1,0,0,0,0,0,0,0,0,0},{5122796,9037542,-23435122,-2223435,7469119,552379,-22283081,-2885772,19795110,4175543}},
+        {{21559578,-8495241,-316490,-10986207,5878438,12441586,-13930875,-15710854,-30393749,10430919},{8933669,4628246,21885065,9169396,-25519329,-1237212,18875407,5572086,5890844,-465689},{1,0,0,0,0,0,0,0,0,0},{-18069504,1746290,-15685707,11491513,27394356,-10156004,15683081,12084611,-26599816,13473750}},
+        {{19191370,9513232,-986721,12039856,-26186577,5721210,8609234,13566045,7075411,-5562829},{-15176209,8680443,31792081,-6033087,14703010,-1091515,19090900,-12407692,32464800,6522726},{1,0,0,0,0,0,0,0,0,0},{-21730949,10087535,-3302780,5279540,-12280500,-7758380,17293414,3852008,27707340,-2917602}},
+        {{-26268285,14787847,-11487653,10008130,96541,10394467,13436338,-7608292,-18651180,-8717167},{9202098,2773362,-30719814,-7482560,28289262,-12022696,32946428,9212496,-17170839,-6306014},{1,0,0,0,0,0,0,0,0,0},{-10650023,4413017,-14089127,-3976824,12200868,5519551,9942292,16333229,-27336812,-12333088}},
+        {{7437010,12155546,29487205,-2770422,-26292363,5968899,-27841595,-14993724,3280830,5404626},{29544372,-113331,-26396214,-13646466,9200777,1776058,-20770553,14215941,-8345016,10054588},{1,0,0,0,0,0,0,0,0,0},{-16650147,3491714,20234650,-8760091,-27669367,-14840542,11783222,-6680631,27543795,-13679340}},
+        {{-27683903,3558135,-8337382,-5142392,25588017,3352935,12047279,1537914,32743270,2416627},{-20122810,-2496264,-12270708,12376226,1403473,9824068,20658889,-7084587,22088058,3467534},{1,0,0,0,0,0,0,0,0,0},{20292212,16545994,16729742,-2301183,32468191,16764413,-27857675,-1711761,-11938949,-1756218}},
+        {{-18041304,-461496,-21761671,-7377985,-24446809,-1809387,30301933,-9127146,9471054,-15092617},{973333,14227565,13814314,-14347507,6923264,-12344754,-1359367,-10833222,-18383807,-4532399},{1,0,0,0,0,0,0,0,0,0},{21761993,11978900,7631812,7144170,22706436,-9987629,7457610,-8307816,-6097117,3657782}},
+        {{-1405203,11666904,-33413792,7071507,-2084800,-14990254,10480968,5327871,-31842595,-2854309},{30359232,1097259,29683717,3730738,-17947702,-14077835,-9422199,-7384881,-3061306,6049908},{1,0,0,0,0,0,0,0,0,0},{-8977621,15114512,-17837635,13379601,-11175640,16514428,11613289,10569956,-25665530,-11833489}},
+        {{30348547,468560,21701887,16646054,33403320,-15989813,9163604,2801036,26331295,8786298},{16689321,7843980,15561540,12075246,-255426,1417399,-27731412,8408762,-18480991,16619834},{1,0,0,0,0,0,0,0,0,0},{5539284,9335185,3709654,14169435,4431867,-2729861,9263019,-4095502,24225277,-11935300}},
+        {{7921155,1530501,-32674561,-3787580,-6878286,5520244,8053671,-5693110,-16566670,8044174},{-23745044,-15783688,5556893,936430,-26862386,13580868,-8246995,-2509411,-2947123,1008460},{1,0,0,0,0,0,0,0,0,0},{30676854,11358869,10134744,-3515602,13464001,-6923080,-21538984,5144774,-4505067,-4195816}},
+        {{-26108484,-10158280,-18401720,8484083,26603309,12555133,1089480,-10273222,-7112073,3857179},{-15674258,4034474,28064538,-5891849,5118531,12300983,4066876,-7454568,-22523324,234971},{1,0,0,0,0,0,0,0,0,0},{19404398,-14528100,12912810,-6645314,31558882,-5404780,3900070,-13945670,-21328168,-7820448}},
+        {{17771317,-8346871,3056566,-7092691,-379620,6710534,-30514495,10829266,21793541,13295641},{11943206,-7987729,7584754,14056218,15144517,10681940,20281265,3201884,-19854530,13880720},{1,0,0,0,0,0,0,0,0,0},{-4910754,-5668937,32529873,-15768086,12754097,-2021656,-3834654,10472723,-25515958,3398373}},
+        {{16325510,-14539189,23473811,3731824,18370139,12739404,-19126562,7136501,31133036,8336106},{-15689955,12424302,-32665199,1735478,-1770715,1271732,-17286925,10918762,22838951,-10246676},{1,0,0,0,0,0,0,0,0,0},{-10432101,5223436,3181777,-15096937,-1217867,-9013619,-14372514,-3866693,-28994330,3991773}},
+        {{27765586,7678179,130623,-7694612,-28965140,3334039,-17612623,2502386,-11410512,-1427652},{19079488,-1176022,-12073740,5928331,3749064,-12224648,16837462,-1819265,-23465794,384216},{1,0,0,0,0,0,0,0,0,0},{11158571,-13446822,24804964,-5232075,-16321357,-13992091,28197956,-8138802,-21341260,11034866}},
+        {{22581483,15573266,12057650,-75399,-29055948,6278315,31478626,8048252,27271957,2251019},{-31292908,3911157,-32595498,-4837202,-2580052,-1365628,25021055,4570031,30474026,-6132609},{1,0,0,0,0,0,0,0,0,0},{5797771,-1716076,-31059708,-5246107,11726514,-3581244,7060006,3617013,-3243411,-10283872}},
+        {{-23233816,9781014,-31796722,9834415,-30168199,-8843634,17006033,7115234,-4915009,557091},{26406733,-4477588,5851072,3116639,-28837071,10546844,-19232159,-9167626,-9638341,-3215483},{1,0,0,0,0,0,0,0,0,0},{24418988,10062997,24302513,14106633,23773282,-15479843,-30005199,12619575,-30944170,-14340301}},
+        {{-18636926,585842,9373605,8024773,-9785733,-7762322,-10439718,-3070205,1463958,-6365126},{11618082,-14051817,-24684104,12707687,-3756542,4487218,423964,-16132080,6194075,2280310},{1,0,0,0,0,0,0,0,0,0},{-3444820,6382554,4152355,-7001548,-15099625,-2604411,-28976906,-8520416,1552977,808100}},
+        {{-31519359,-9374710,-2985972,9687611,-20417866,1207212,24462806,8419609,6571725,-6820984},{20886571,-14194445,-22818438,2619546,-17391044,8059595,-20363731,618438,-13072168,-10183466},{1,0,0,0,0,0,0,0,0,0},{29016254,-9201987,30808704,13901766,15645111,9839884,14595144,-2956851,30712334,6594129}},
+        {{-22371574,-2381416,17395142,2241779,14723243,7415752,-17819123,-7739822,29757861,-164827},{-3715444,5120786,-15358813,-15534869,16682323,-9959510,22156440,8169219,-20430984,6782904},{1,0,0,0,0,0,0,0,0,0},{-8773062,-1221174,29862630,-4223289,-7028364,-10083892,18320721,-3579654,14248321,-96282}},
+        {{15427256,-5293388,22846113,13551359,-30029449,-6806016,872464,-9410595,21803731,14772584},{5524626,-2774297,-26538140,-200773,19858273,4371175,-33214539,16299752,-8920391,1487919},{1,0,0,0,0,0,0,0,0,0},{13627590,13812075,4444200,15137875,-21159214,15782820,-25100949,10647884,-9978346,-1911980}},
+        {{6133858,-11908801,18685793,-5197750,-9395023,-6704053,-23138443,-5363358,28796149,-8817984},{7874471,2569844,25399400,88615,3368557,5019824,-7061516,14271606,-31873425,-13572125},{1,0,0,0,0,0,0,0,0,0},{-21873118,10689477,-31249613,10657976,-15395738,-3865287,-20071623,3101061,-7967644,7589872}},
+        {{-20062204,-13762555,-25527211,513524,-15711541,-9036785,29549701,-9536891,12377670,-11199804},{209634,-4492693,-25822960,-11327684,27720399,-11252169,-20924399,-11145668,-31552927,15187898},{1,0,0,0,0,0,0,0,0,0},{24984132,3993239,25489511,16612273,6808772,792266,-18754699,-5591562,-28593082,3241142}},
+        {{-26589277,3257702,-14612932,8204905,8844743,4440709,22795888,-13832912,-30945716,-5721014},{-31978249,9169451,25609817,3046952,-28441523,12638342,28427849,-2372906,-9409874,4154680},{1,0,0,0,0,0,0,0,0,0},{28066624,6852309,23718925,-3084542,-22003829,-16537690,33387327,-5215146,-14630348,9848367}},
+        {{-30968350,-6644950,14958909,11352671,30759164,-5434622,-476849,-700004,-1654342,-12206114},{9207703,-6181289,-31569306,8532958,-22298155,7389494,-27564819,-8132323,13116152,-7129908},{1,0,0,0,0,0,0,0,0,0},{-11330231,4458613,22060611,1673860,-8825754,-9597848,-12908981,11797211,-7839319,-5509856}},
+        {{-14269427,-2958634,-8198022,7782482,-25002204,-14938969,25734225,15898359,1370873,-8909003},{18540147,5677329,12263539,-14030860,21623470,10299243,-24477022,-5109580,-23049046,-12840780},{1,0,0,0,0,0,0,0,0,0},{32711007,-9146059,1207098,-3109966,-28151657,-12987655,-1338703,8785943,5680544,6358508}},
+        {{13474736,-13181086,-18522685,4806139,-17015295,-531931,-4749365,3017183,6383912,-14044586},{554556,712320,-9638081,-3437521,5086169,-198149,-24061863,-796568,-3236461,16495347},{1,0,0,0,0,0,0,0,0,0},{-17848740,804495,25318804,-207728,32739856,-6298573,-26747527,-2111490,22836533,-13516119}},
+        {{-17089208,12777394,11018023,-15449155,12324520,-5012175,-14160743,5966926,-8118291,-5264698},{17958481,-15858233,-15410001,-11080137,16979139,-1818332,22794390,6314629,-32568633,-4978835},{1,0,0,0,0,0,0,0,0,0},{3219494,-1754398,10799046,-13735654,-1267034,-16518795,-19480648,-6161963,-8847940,1455788}},
+        {{33278431,-8057904,5395955,14339924,18929178,16089399,-9940242,-16712894,-6456887,-14360013},{-15687791,-9544977,-27448134,1087736,-28562720,1463539,-11495951,685726,5192614,-6309705},{1,0,0,0,0,0,0,0,0,0},{7387949,7509265,-25782411,-4019831,-1998620,9053351,8947766,1390972,32271141,-3697262}},
+        {{23160185,-2600432,-28664080,-3962875,-206243,-12629465,-2173363,-11099826,27383077,-1430772},{-1557132,5373817,4315234,-13862310,-2975348,-6893818,109154,6305782,-27240427,6919941},{1,0,0,0,0,0,0,0,0,0},{855374,13392901,15674889,4153772,-13522574,-12951996,-23390259,14398072,-19907345,1642908}},
+        {{-5578352,-9738470,33199105,-12535221,203249,7443383,-7662827,1823320,-11074582,3916890},{15892485,13445925,-20241628,-15526358,2931534,-15743838,19135802,-7691640,-27257288,-16622159},{1,0,0,0,0,0,0,0,0,0},{-14331308,11487964,-9547166,-13926534,-13174510,2209433,-4681344,-11231505,-24561161,-1980593}},
+        {{-9860279,-3835767,19575994,11609232,11713635,-10179473,18820367,-596470,7636531,4664286},{-10049225,5239963,19680317,16717256,12145473,15542995,-26056202,8570501,11450209,-6334313},{1,0,0,0,0,0,0,0,0,0},{9018901,-12980235,11702120,13538851,24169776,8535416,-24865321,16376297,4464899,7250736}},
+        {{12141040,14827152,18934596,13178661,19097850,-4016986,-9656488,-3937110,14864706,-7892909},{21895187,6052703,-15250073,-2643611,-4618818,16176182,-20293895,-2122814,-10341675,-14375862},{1,0,0,0,0,0,0,0,0,0},{-14453835,3739615,-27931266,13673252,15058557,6145728,-667614,15312504,-9822831,-296719}},
+        {{32428279,2705502,27841865,8517654,26197965,-1888440,12974196,-16652048,-10535662,6031387},{-32058160,-8154886,-11637690,16056869,-162945,-10506623,-29371967,10301842,13997340,-2456118},{1,0,0,0,0,0,0,0,0,0},{9775769,14478193,-21169566,-1508234,18317604,4235741,-25181252,10898446,20042376,-13113310}},
+        {{8783279,8858504,-11420437,-8917923,18561189,3803322,-3698499,-11577864,-560849,14992151},{28175041,-1672757,7061149,14730304,-29028772,11092477,29872870,798603,21599175,-3310154},{1,0,0,0,0,0,0,0,0,0},{-16483995,9843764,-28679415,14644549,19835880,8157233,16038358,16281957,14515267,14154012}},
+        {{-4683477,-13612948,26183304,-7787202,-16677860,-3768995,-25864357,9024520,21333373,13942771},{-19785107,5520417,-7282914,-1807456,-23820820,16070008,-19632321,14264684,32461280,8802072},{1,0,0,0,0,0,0,0,0,0},{-7227525,584593,-11580612,-8176826,844191,12585282,28386921,4113067,-29638237,8263980}},
+        {{21026734,-12676052,33141934,-6028495,-21091801,12185954,16985557,-13016050,553090,-11383926},{24975984,13305266,3636318,-9524313,27560858,-15742442,26975449,-10036398,-30170252,-313065},{1,0,0,0,0,0,0,0,0,0},{2982004,-15299861,5342648,-15331747,-16072806,-12435893,1747453,-2754959,10681048,12925120}},
+        {{20607903,14047704,-9239060,-11078350,533791,-3553122,-19980062,6368460,-8064460,-14509254},{-13755653,-5404475,19492534,-55645,-14877355,-28888,14713730,9337962,-13722394,4147420},{1,0,0,0,0,0,0,0,0,0},{26943645,6062082,-14620366,-2317507,-6108802,2682699,-21409201,-1912372,-13921678,-2149238}},
+        {{17427296,2715216,7432065,11401785,-18428950,7948321,-10769833,7290476,27515092,10557214},{-32317100,-11328111,-13976664,766775,805462,10220784,26189189,-16618405,1145736,10184472},{1,0,0,0,0,0,0,0,0,0},{29430389,-7694367,-8693693,14574682,-33388907,-13469337,18787787,-5517787,-10005326,-9128681}},
+        {{3584320,10732794,-24228525,-6893002,32693727,-2732830,-16687534,6723201,14223364,16690510},{2903393,-14764803,25190262,6020001,22156827,8074074,-32848997,-9766897,-1835076,9375840},{1,0,0,0,0,0,0,0,0,0},{-19011360,-7800454,-32563371,-2794622,-9082216,4455574,1399264,382218,-31876796,12418443}},
+        {{19655680,1183186,-32476103,-10577522,-8260349,2080383,-22906752,-10536879,19887165,-11849418},{21871999,9181582,20283673,16155169,-22885507,-13140344,19905796,10222586,23054369,-6560698},{1,0,0,0,0,0,0,0,0,0},{32414034,-6701566,-16898406,-10869297,-19213265,8845881,-8459706,-7382792,8712560,-14424894}},
+        {{701682,11986775,-15282958,-10883645,-32724930,6544409,33067889,1577471,-30283735,-4448750},{-14490678,13988465,10347774,11817697,-32768885,10047457,14460997,7169598,22192984,11085016},{1,0,0,0,0,0,0,0,0,0},{17655650,958805,1922904,-4902099,-33231518,-13587203,28016892,11620405,5433594,13381641}},
+        {{-11158454,-13832085,-30284349,3105670,10686116,-7669625,33458762,326533,-15208646,1288615},{-9805139,-15699603,31377029,-10300393,32806121,-7111,1158105,5728380,14057260,6492291},{1,0,0,0,0,0,0,0,0,0},{1493088,186233,-109389,10113556,24743509,10350558,-13288483,-3016334,16651657,-16572226}},
+        {{-17563043,-15615994,5965725,13845094,23793378,1523774,26097157,1441907,-13938022,-2489901},{-19511916,-11217431,11382354,-13511565,2364880,11444526,-25806133,-3420073,-19046459,-16496914},{1,0,0,0,0,0,0,0,0,0},{-20963676,-15666594,31265030,-5378393,21800880,-7092320,-23347778,-1073874,2404661,-54272}},
+        {{-5134938,12064753,-5602583,-1509382,-10065137,-2558932,32833532,2243588,4809069,-2984185},{-30587112,9164176,-28387291,-854879,-18272510,-4487271,-23830182,-6063993,18125044,12563310},{1,0,0,0,0,0,0,0,0,0},{8599388,8428440,-29426038,9164120,24828873,3697587,-17568602,11308749,440319,-8758619}},
+        {{31575378,15522718,-10474997,1041535,24542017,7494906,15420347,7058258,-9945357,5592336},{22900908,-10822764,-21290726,-11120329,-17505862,-8551716,13762263,5150413,26086395,9019038},{1,0,0,0,0,0,0,0,0,0},{30326801,9091164,-1596016,-12700712,-5213540,9789871,-7172569,4575979,9155877,-4773448}},
+        {{13086419,10453468,-18127674,-6528365,-722799,14142739,-19110300,16632874,-839347,5591855},{4548450,4928304,24709251,-3440729,32452523,7846441,24391497,16691320,15760160,16773513},{1,0,0,0,0,0,0,0,0,0},{-7058633,-3342737,-13212425,-13323933,-6687968,-3762672,-29233602,-1882332,31596723,-1825248}},
+        {{-20276350,-3862940,13180110,-12492598,-21357576,-10661317,-27496912,-1746244,24081271,-14526407},{-5384967,-11478551,-1988910,-9729543,537333,10145123,-29171095,-11374325,5701071,14935113},{1,0,0,0,0,0,0,0,0,0},{25777083,5881116,-7501489,15981846,17214466,-2261490,-23700082,-4399973,2962272,-16558605}},
+        {{-12190976,-1360567,1561655,5257281,-32336789,-16727408,16790936,8125693,9797876,11171106},{-4037395,-11852921,28319972,4778060,-18923632,-6960076,18917244,12456479,4176470,-5752109},{1,0,0,0,0,0,0,0,0,0},{24109936,15856177,26809651,6561439,-11220522,7697870,24557184,-997510,-2373455,-9672132}},
+        {{-20533347,-9262763,17625517,11106447,-12994005,-12697463,-11585004,8527454,-28968180,12502459},{-31474446,-12461037,-16253318,13240225,-29742731,-14545454,-30950740,-2935611,-17930417,13689106},{1,0,0,0,0,0,0,0,0,0},{9254653,-5187446,23523919,-13033370,-29469005,3839827,32337101,-8182827,17372700,15774004}},
+        {{-4777026,-3181762,-1332303,12945827,2267790,-12232580,-25750413,5915697,-18734742,-11783342},{-27170137,16102336,-4228556,11986899,-23722879,8131996,28034130,9828389,11537782,10363996},{1,0,0,0,0,0,0,0,0,0},{-17935099,-14764999,32577186,14321061,-22293385,-8710114,-26152815,-740727,-6584377,-15775578}},
+        {{-23353166,16591944,-6884586,7961249,23305873,-4132838,17862518,5463821,-25213008,10791540},{28810476,-5236021,5503333,5195695,-15726020,-9482828,-27706758,13496314,-18292669,5061345},{1,0,0,0,0,0,0,0,0,0},{22661446,-2023767,13152178,8333466,-25479359,-144165,110447,4294375,-17691471,14215897}},
+        {{18884382,-9124379,-22402957,-3492462,-25206714,-11759393,13572932,-16322886,1817965,-3259375},{254122,-6688050,17075365,-3185899,-7438610,-16642642,26556854,-1515765,-32332493,-14914461},{1,0,0,0,0,0,0,0,0,0},{8852000,-15199376,31500604,343108,30938061,10895385,6411236,-12546640,-18982841,-5888144}},
+        {{2709851,13100645,-26052267,13340712,31699993,-9088596,-20131686,7141007,15830402,11983903},{21262836,13612442,32543594,8126292,-23281627,-4230292,10855339,-3752453,27503296,13472788},{1,0,0,0,0,0,0,0,0,0},{3277634,-13955310,6152364,13060883,23323414,-11346402,-23494493,1407330,7478937,-3110139}},
+        {{-25341430,2919311,3075198,11115979,23529796,6615906,27467921,-15369241,33022855,-3652510},{33448770,9194687,14099401,-3068913,-22432499,10536647,-2643180,-6212769,-19872452,1525714},{1,0,0,0,0,0,0,0,0,0},{1702742,-2438034,24020933,10580954,-22722467,-13503973,-24729758,3307160,-27754010,-16362182}},
+        {{4527120,5189326,-6272797,8500570,-10323552,13935335,33082942,7073569,-9934995,8624762},{16298071,-13804770,25386680,1574693,30974259,7462923,-16927912,-10382186,-3921440,-16304015},{1,0,0,0,0,0,0,0,0,0},{-27182193,280642,-23766433,2444710,19206857,1069828,2200049,-8631634,20387272,-4934630}},
+        {{-3436463,-9573751,-25220393,-16281452,-22637205,-6855445,-9643023,-11257763,13168510,6501592},{12399280,3028255,1393059,3660479,12958338,2854021,13554405,-11323729,21626144,-5414723},{1,0,0,0,0,0,0,0,0,0},{30579862,10452061,-15609131,8720512,-25414146,12075892,-4318885,4713053,-10489954,-2202252}},
+        {{6454421,1137641,18102528,-12095940,-7833997,8964513,-28122133,9611153,27043931,-6159948},{2864338,-5965841,-26685725,-11747569,20284194,15903129,30250754,-2254615,-12061071,3723203},{1,0,0,0,0,0,0,0,0,0},{26513644,3716402,21703768,14830248,-22437193,-7616001,-9728810,-12948623,-12697409,-11016669}},
+        {{-348351,-2811432,-21374530,-11512374,29914438,8566262,27250153,-9274768,-32350357,-5858496},{1658994,-2839449,-28313567,7061475,-17574999,-8797877,-9342524,5344120,-25293190,15552181},{1,0,0,0,0,0,0,0,0,0},{25198566,-9502321,-20275606,-7672056,7934651,15682691,-3707744,6768294,-16909297,509240}},
+        {{26908516,4237555,-6659467,-13227310,14326746,-3485614,-7413775,-2945725,8532061,-15022256},{-1833533,-11948885,6866028,7473722,23142417,-9485512,16118451,-3504219,-6002973,10098058},{1,0,0,0,0,0,0,0,0,0},{6216219,-15660309,-8356064,692810,-21992706,-7841558,19408439,10615265,7408722,7956550}},
+        {{-11956515,-1322817,8571496,13827127,24611521,4447935,19361894,-2288762,-33275711,9491221},{19383388,-14045479,5713889,2842187,31221182,16149686,25578680,1791748,-10087622,-2875393},{1,0,0,0,0,0,0,0,0,0},{122091,-10995759,-10013531,6455353,8257095,3677423,32191639,-16486494,-17318747,15536376}},
+        {{-7866820,-14524325,2740016,15364002,32133556,9535708,4590377,509053,-489557,9690318},{31115868,11189975,-22619070,14368440,-28095779,-6501078,-22233456,-2511268,25414328,14210215},{1,0,0,0,0,0,0,0,0,0},{-28116129,6693798,-21270388,-15239507,-14313793,-7274736,9666979,-10421188,-21823746,13882016}},
+        {{2192921,5794422,18777932,-14810610,-21797093,-2510344,4975082,13606997,-18988742,11638200},{-21956337,-3090917,-22768619,4966576,18963079,-3190899,1825540,8961781,-17341567,-4431438},{1,0,0,0,0,0,0,0,0,0},{28987153,8566067,-29776113,547878,-15544954,-10220917,-3678922,-1805916,10809902,16505687}},
+        {{-13025263,10105344,28854664,-16405951,28302743,9989439,-10091899,-5066422,28788430,7762841},{8757668,-8411630,16253862,16217696,23337939,-9754391,-15233766,349292,10655143,9505528},{1,0,0,0,0,0,0,0,0,0},{-6759161,-4417399,23154501,7564481,22409358,-15371429,4129264,-2429334,-2066204,-11687650}},
+        {{3475142,8092606,25464333,2430908,30382395,10861876,-32103898,-4696623,29682507,-6737696},{10153667,-6958783,19652046,-842356,14899049,-15981825,-22968143,-4515811,-13526277,-2003872},{1,0,0,0,0,0,0,0,0,0},{-9286396,3790697,16274314,3336412,-6690340,5540867,14740888,-12043786,1032860,7047231}},
+        {{30559077,6868222,-7662462,16282947,-27152148,12786974,12282181,-7421429,15948611,-10620039},{10768791,12437908,808160,-11848092,-11610656,13473956,-27957639,232020,8773639,-14010413},{1,0,0,0,0,0,0,0,0,0},{-8060862,12570491,-11890449,825961,9764112,5928979,3822193,-5554345,-21168651,-476488}},
+        {{-28391613,11999147,-3235510,-16516935,-23523810,5880563,26413020,-10718156,6483548,4078492},{-11580450,8367955,-899374,-10685641,14780600,4329958,20003483,828281,4079093,6134470},{1,0,0,0,0,0,0,0,0,0},{-22273502,12740886,10080905,10396705,10810677,16439354,13826690,12542588,16612285,16755707}},
+        {{-22410599,5041613,-13383367,-4784159,-8347578,-13433748,-4480335,-6337734,12563164,944415},{20419426,-6328788,-31093175,-6094364,12372559,-9227804,15491012,10378785,-575706,-12842483},{1,0,0,0,0,0,0,0,0,0},{23897350,2716347,8348943,-1762539,-23628541,-2369435,21211897,-8023680,-4969664,11615724}},
+        {{20863247,-4023383,5704037,16382263,-13485373,11707320,-18721796,10969958,-4488190,10583067},{19010676,-6582591,-25747167,13658064,-19393785,15913273,7008360,4890262,-12510353,6612471},{1,0,0,0,0,0,0,0,0,0},{21596302,-561520,-11459021,15607048,3676094,324763,-29557557,-13476843,26480162,-798012}},
+        {{-23774796,930617,-25298108,8914464,28390062,13002350,20576200,9149886,-17036062,11041516},{-24861228,-12257881,32567684,-1234569,-26608767,14346221,15677020,5480711,-13734258,11166849},{1,0,0,0,0,0,0,0,0,0},{-32072752,-13456195,-23035941,-3690190,-22556400,-5758478,4146017,-8206989,14412141,-9059777}},
+        {{5704308,15715573,-8125387,-14330212,-3058550,11988556,-9634850,-1396,332493,-12174255},{16932428,-14436950,20378642,-7851659,8377880,-10565287,-31824039,11303461,-18668113,-2006990},{1,0,0,0,0,0,0,0,0,0},{-32578043,-6934865,25260203,-14161761,-23496139,5274586,15924776,5364643,15081830,-4948900}},
+        {{18101760,14635366,-22218882,-2528694,-33012004,16089954,14852443,-8420855,-3505590,-4948560},{20889270,14980399,-24196751,-3813579,7600996,-8632149,19143386,-15427372,24257160,-5008349},{1,0,0,0,0,0,0,0,0,0},{27449249,-7218969,8778129,-14161098,31434321,12265083,11138000,9782414,-21769132,-8858087}},
+        {{-3324051,5691211,-18361528,-3596699,15425433,1970017,15090349,-3741203,-29937472,3288630},{-26297832,-2078859,4568570,-9223865,21785597,-9123920,5108288,-15506525,-10307613,-3529798},{1,0,0,0,0,0,0,0,0,0},{-15000542,4139291,-24565120,16059618,-857880,-10107609,-5822723,-13679495,11452495,12255833}},
+        {{8486367,10660526,-2579803,7071434,18105707,-11747391,13678249,3255943,2442241,13219205},{-7923333,-6113515,434818,7152284,-22550801,15199722,32785834,11647534,249874,-965900},{1,0,0,0,0,0,0,0,0,0},{30706442,2677579,27750865,2541648,-25805066,8370720,-27347520,13302664,-24081298,6292474}},
+        {{-13548725,-10571856,9448017,2486167,3817655,-10883985,-18790500,-4899351,-21419312,-10007957},{15686408,8005196,-31203777,-14996253,8774665,-6830845,-8933013,-8037501,-4165101,-13685093},{1,0,0,0,0,0,0,0,0,0},{24507568,-12176945,24161780,-14350281,4170291,8521173,14195174,-4223302,-27815326,-12401368}},
+        {{-31073560,7445094,-9365072,554313,-21992103,-5245871,-10294575,-13208782,-14221801,9619638},{-23118059,-1297619,21385119,13410171,-31029545,-10770147,-28115319,-3188893,11806829,-16624176},{1,0,0,0,0,0,0,0,0,0},{4537038,-7322098,17712868,-13585407,-5730333,6947942,-10007694,-10373296,14070908,3160141}},
+        {{10748868,-14259593,-26506563,547480,25024989,5558111,-17281289,-12426231,15011767,-9717766},{3678018,10729385,5766111,-5377912,-5415305,6966001,-30796454,-15348298,32279432,12952339},{1,0,0,0,0,0,0,0,0,0},{28253051,-4748326,-27479340,-14570869,-7356180,-16215681,-14324512,-12306304,15343852,11421451}},
+        {{-20774504,-9712056,17545988,1720042,-20676937,-5828240,-11170167,7141678,-21727578,-10571882},{-31624700,-16108458,18721366,14461079,-10360117,-3314920,20504737,-1530695,9608338,3604776},{1,0,0,0,0,0,0,0,0,0},{12405529,4315530,19415768,-15562527,5005729,1981055,21479270,15954090,-15413510,-2531124}},
+        {{-13923403,-10740980,-23880873,16377320,21368202,-14002659,-15237628,-9384904,-1565512,-9735967},{-29189534,-7624098,12629626,-3069189,-2568630,11793357,-1588534,4742751,12816834,-3838373},{1,0,0,0,0,0,0,0,0,0},{14750421,11228263,-2233605,9382545,18007015,12055832,5355996,-1428993,11908660,-14936768}},
+        {{32545813,4742261,-30918733,-13927866,-27516283,1216017,-5448659,-7679875,25745488,-13489060},{7951189,-3251859,-28697076,-13954571,22001548,-10738373,27012422,-1454072,14656399,5002382},{1,0,0,0,0,0,0,0,0,0},{-24090032,-2487021,-3775084,4056092,19877244,7701842,32247823,2407738,3317879,13837778}},
+        {{11229943,9120987,-23483635,8454055,21656855,-10789355,-316176,7144518,-10805536,-13512892},{-28768641,1561151,-33418121,-925800,-29740485,-9906494,-8638698,-10315090,696296,-6840746},{1,0,0,0,0,0,0,0,0,0},{-17865395,-9331808,-9704491,-4335778,9110660,-4753054,22739958,2473861,20851497,6099021}},
+        {{5426354,-333771,-1219039,3191457,-28091456,-10959310,19669922,14563469,-7089658,-988793},{-7649484,-13034815,8614280,-5593717,-18356503,-15049423,4553306,12795266,-2144887,5774822},{1,0,0,0,0,0,0,0,0,0},{-11196739,-2424784,13021437,11229219,22950593,-10815152,2315247,682629,-24949441,2555321}},
+        {{-15487019,1134193,5540716,-4785910,-4111704,-13287626,2010998,-8057704,-32292052,-16109136},{-20588033,8254941,8554155,-9335834,-8446157,-1802705,8003578,3107130,8406889,6904835},{1,0,0,0,0,0,0,0,0,0},{-21058766,-16371440,26868859,12843461,-32838713,7414771,-9106908,12044078,13204317,-8518112}},
+        {{12412351,-6540205,-9348376,-15175150,-18415733,-14179262,23585858,11410277,28452479,6596768},{-29223890,-12229759,-32713869,-5784342,1079065,-554563,-13687516,-10000654,-24689370,1623798},{1,0,0,0,0,0,0,0,0,0},{19102820,-6752674,18924458,2667853,-10663459,-4432443,30371320,-8991209,29989224,12239257}},
+        {{21073267,-3569123,17279285,5309633,-3029448,10708202,-13304245,283177,33021075,6034455},{7702453,-5110154,-1923534,13817058,-30191681,-14993079,-27983792,-1404343,-22830257,4555008},{1,0,0,0,0,0,0,0,0,0},{-26781865,-10892434,23548366,7020172,-8724099,-1579699,29976039,10905207,-24509908,-8356980}},
+        {{826025,-10950040,23437121,692883,-10813658,-8348643,-289170,-8902476,-10878694,-6319313},{-30640622,2916490,32399304,16475793,-15662375,-4862147,-17797532,9439989,-24689900,-10895671},{1,0,0,0,0,0,0,0,0,0},{15297433,6137765,-4384701,1435605,-31235135,15975112,-15420026,-8177170,14863634,12502843}},
+        {{31644513,8956508,30755561,-22383,-30214909,8162138,-31773704,13449685,18918704,13097444},{-26773548,2911394,5576706,-13144323,31284037,-8999769,-22507826,-16554595,22710884,-1703972},{1,0,0,0,0,0,0,0,0,0},{-658913,15543319,-1714636,13121703,22880719,-1507160,19383578,8536467,10061604,-15871538}},
+        {{-23260393,-2414369,17550577,12024272,28924427,-3051187,-3338534,2273071,6996470,15849022},{21169837,-625998,10887757,14029121,30362306,-6771412,-7804006,-14674391,4946677,-8797317},{1,0,0,0,0,0,0,0,0,0},{1023703,7396247,-4145229,-2596811,26655516,-7696039,1393762,15327601,-204027,10797249}},
+        {{19240213,-2378237,-31798806,9156646,23447373,-14948025,-32879130,15229126,-26499642,1249240},{-14701817,5007201,-21829588,11834235,19579465,-3042303,-3781004,-7558390,-17017552,-7074325},{1,0,0,0,0,0,0,0,0,0},{30753370,5083359,-26196050,9473039,-31540826,-10199833,-13664583,2041346,4221422,-11529917}},
+        {{10068534,11500371,-29441565,2060870,-2614774,-6791073,12881093,12594724,-25701222,-15219654},{-17637421,14510616,-28994812,-4278993,-1351060,-6661731,-11624915,8081548,4054953,535258},{1,0,0,0,0,0,0,0,0,0},{14176940,-14020411,-31968937,-8365547,-8091826,9388393,-31967100,-16573669,-12280399,12774535}},
+        {{17715920,11814623,949598,-13111517,8424877,-8679151,-9828983,-3194341,-13108986,14265591},{32338555,-6142920,30078659,-14572508,1609788,-4391015,-2351868,-8488837,5357093,12083774},{1,0,0,0,0,0,0,0,0,0},{-15832524,-3429725,-23201853,-6313543,2958049,14312809,21479828,10753325,-6016864,-3147666}},
+        {{-8182669,1346992,17645644,-7009043,1493196,10745102,27701743,3775486,-5335351,2620195},{-2811387,-12536802,-502505,5939053,-24867976,10872320,-5167396,-6043870,-24522286,635668},{1,0,0,0,0,0,0,0,0,0},{31023819,7839009,5377957,-10057955,3082244,-9356929,8095072,15700066,-30568529,3412250}},
+        {{32718877,-15852795,9910950,-6518152,-16610003,-13075559,22299576,-16669517,18889412,-442750},{-17338394,12437234,30925474,-5077319,-31894266,2039456,27671376,-3674465,-32346866,-5726873},{1,0,0,0,0,0,0,0,0,0},{-13527093,1920623,-28774334,7938208,29706681,1780880,-13307217,9436768,4382730,328457}},
+        {{6456719,4804594,-21382484,-11050855,15474613,4485732,31727161,-13125909,32812720,-1409909},{19643984,13787420,24825301,-9049979,-2170166,3265557,28069153,-7689010,22233314,2680412},{1,0,0,0,0,0,0,0,0,0},{29204187,-10137294,21876231,3898902,-925755,5912619,-26820132,999740,-5667515,-720342}},
+        {{22936698,9169033,-16387875,-13538322,-10281058,-16365540,-12467853,-11581641,20948756,-8432582},{-15567116,-10219340,-4886514,1194661,6478554,-1195730,-29204830,5063232,-6530328,-6854641},{1,0,0,0,0,0,0,0,0,0},{19128756,10034914,-32429117,10041736,13986818,13260472,-4054544,-14075353,-25749664,16106974}},
+        {{-7854088,-2566564,5173312,15786734,794284,-3348016,5041796,-6091562,-116822,-240884},{-31501593,-6880420,27334778,-13274885,30773436,-6100465,-25955040,13777094,3027937,5499507},{1,0,0,0,0,0,0,0,0,0},{21099561,4946790,25871288,7154730,13778724,-3367273,10552125,-9271497,-29596028,6577080}},
+        {{-4967587,15927255,6721294,5218430,11422953,-9713165,-14331237,2867805,16623899,-16473587},{9055926,9542872,18100183,1539016,30191008,10015952,-13491464,5797284,-6815719,4886830},{1,0,0,0,0,0,0,0,0,0},{15885592,-10104811,30303503,7568658,-8748085,-15966663,9444462,-4581471,2410481,13787404}},
+        {{11229561,-11578322,-21849621,-13803136,25217777,-9748540,-8655364,10022144,7251559,-1585510},{-12085202,13318937,14507560,-513370,9598280,-11068614,5594336,-14805118,-4158295,-7710357},{1,0,0,0,0,0,0,0,0,0},{24476990,-16420148,-8630349,13541396,-20861621,-16294231,13558493,4216368,-16361633,-14017513}},
+        {{-1298882,11879928,27933553,14699441,30743194,-1553340,-27631951,-8197875,-4492096,13952196},{-30123274,-6302329,-5583435,-5042129,-12143522,15072420,28720688,-9173114,28397864,-14786618},{1,0,0,0,0,0,0,0,0,0},{-2600954,2705402,-7850329,-1588987,-2235387,-13785334,47648,1989309,-1408007,4279024}},
+        {{-27233311,3963218,-18093931,14883305,-29988121,10523582,-9011036,-14798773,5691947,-10516056},{9592763,-14549101,22176609,9534176,-29305747,-7867022,32280807,-3913631,9727909,-2490943},{1,0,0,0,0,0,0,0,0,0},{5309307,-4986078,29225097,-10696993,-33395819,-1992492,-28799623,-1999083,25853977,-12699007}},
+        {{-7563152,2413075,8402903,-3527031,32773974,13759661,-32460748,-9449075,5230856,15907839},{-30258498,7054827,-14150201,-10967041,17776099,-15523176,-9739336,5292065,-20193674,7553161},{1,0,0,0,0,0,0,0,0,0},{-14977253,-1845967,22255479,239258,3727323,15106356,-24652379,-8850308,-25162955,15621014}},
+        {{-20636026,-366442,11984984,10498982,1705831,-7071596,12813764,7801745,-30845695,-9177434},{-24856302,-12560882,980109,15412544,26487188,5062129,-16831145,15135671,-4589433,11470936},{1,0,0,0,0,0,0,0,0,0},{19348477,-9395055,-6927267,-4678187,5625098,-14254509,27989849,10043057,-21154116,-4062008}},
+        {{4783465,6094039,-15524062,-6420232,10409325,-12668304,-22713328,-14032650,29696586,10157819},{-14668594,14996484,15909981,-11415340,-12131436,-4221212,8433654,1686110,25204503,-4663469},{1,0,0,0,0,0,0,0,0,0},{-20270731,11183248,-6783111,-7406170,7671013,-2554570,7951524,-11207010,22484212,8635456}},
+        {{3530427,-1710276,8160408,-13774816,4909357,14575278,29015298,-489942,2365038,-11701359},{14326441,9669867,10714138,93644,-27265969,4437582,-7662263,-14103238,15644345,14604852},{1,0,0,0,0,0,0,0,0,0},{-21245411,-12095050,-32477353,-6174322,32648197,3107837,-9133833,-4077270,22580279,-8873830}},
+        {{9467750,-6899834,-17720544,-16150173,2325699,-5483918,-7357015,14451088,19539234,13150229},{18734001,10105941,-27834676,13940160,-20222015,6093459,-9180405,-5968670,-17651014,13561464},{1,0,0,0,0,0,0,0,0,0},{-19392502,2470877,-27002393,-11286319,33044835,8647165,-29972139,-5945474,15326892,11317570}},
+        {{23038081,12237394,2863076,-3252846,-186972,-14508061,-11450899,-11999673,16912571,16412499},{-22257172,9202663,2417547,12826094,-25563120,-2652885,-156058,4681745,-15159327,-7487297},{1,0,0,0,0,0,0,0,0,0},{18993748,14559538,-25118058,12361023,19416600,12580096,22167220,-11078605,-21217645,6523396}},
+        {{-21989090,-1097324,347711,5668829,1952525,14457330,-29224058,-11003754,-16455429,9856365},{14769469,11827876,-3285002,12808165,31596507,-1835974,-15984196,4105617,-14082550,-1308321},{1,0,0,0,0,0,0,0,0,0},{-26936931,4336387,14961774,8562553,18203173,-3278117,-6212715,271606,22842531,2697823}},
+        {{26711185,5295623,4501612,2174105,7388711,-13220845,5079648,-7317680,1711838,2267164},{-8659036,-7877791,22766046,9315804,29739360,12402757,11868991,-2248430,22027057,-13837973},{1,0,0,0,0,0,0,0,0,0},{32459753,10622848,32636694,11152094,32077355,-15904402,-8173044,12634770,13863216,8069522}},
+        {{18834649,-3405348,12264030,-2705917,-11711286,-292168,-10041580,-13075575,23007201,7804681},{32236222,-12696806,-15321839,-9652562,-31230147,12734401,-6123894,13629517,5676778,-4795583},{1,0,0,0,0,0,0,0,0,0},{18409882,-13459936,-9077138,7690191,-29229463,-5606290,27679190,-4040452,1066917,15631299}},
+        {{-11621082,-10836302,8288308,-14019198,-31692298,2663026,17645147,12398468,28895600,-11951812},{23501760,3831145,13970796,-13647401,-30263684,-5678211,20171391,1036347,-3091355,-8782011},{1,0,0,0,0,0,0,0,0,0},{-22743868,10284543,-10824919,8892245,18500414,16569244,28843926,-5718573,9006387,-2359794}},
+        {{30448505,-8911884,11665553,4747196,-4413659,13504215,-18047718,-8997902,19079631,16047849},{317244,-7279047,20939359,8195934,-602898,-9491030,16442017,6075970,9378868,14078014},{1,0,0,0,0,0,0,0,0,0},{1894154,-9017785,10860110,9945132,-26590243,-4948289,29021999,5532121,-14942831,9171031}},
+        {{-27190199,10506900,-26851923,-12921700,28261693,3760699,-22312187,-12917457,-28597015,-13387300},{3101192,14093851,25891146,7525959,-11674368,16564476,12681823,1084777,31787223,11449761},{1,0,0,0,0,0,0,0,0,0},{14215953,-10463718,27792586,-4800509,6438159,14888625,-11602443,10166692,2401615,-14948279}},
+        {{13788772,14001226,-2837307,-6089169,-7507095,12290480,-6234126,6107624,1922674,-908634},{15810865,-8397938,-15223469,4578439,-2290706,-11165920,-29603326,1977938,2339882,-5364476},{1,0,0,0,0,0,0,0,0,0},{10516112,-4603536,-22430939,-427659,7800174,-15308623,32380182,-8608879,32684697,3379431}},
+        {{21347536,-8435179,-30027191,9150851,27343465,-930910,-15540240,-9679135,-17884429,4300277},{17000182,8783274,6498549,-7531105,19504270,3488350,8193432,-9989370,-29075508,245428},{1,0,0,0,0,0,0,0,0,0},{27047838,-1638729,30656150,5533465,-28062583,6924544,29938840,-5972344,31835132,-6516740}},
+        {{14564392,6054248,-18212942,4701283,7451790,6380146,16723624,-556174,-4167411,-10011779},{20784668,-11754227,10088825,-3581700,-3080473,-14998658,-2020272,-61909,-18826210,-8913110},{1,0,0,0,0,0,0,0,0,0},{23842683,-3480884,-3629533,12912040,6561388,-1129885,-16259810,10075925,-20567738,-2566312}},
+        {{13505233,-15767072,8186931,-6670552,-8592451,-16744408,-23904996,6445674,20274929,-12807736},{19335629,-5207663,-13277834,-15819423,-17634026,-6447863,-27979587,-7691333,-16065640,-12475693},{1,0,0,0,0,0,0,0,0,0},{-26976804,8311022,13546874,4829822,-3378138,-10700088,-24320222,-15003430,-31035585,8755832}},
+        {{-28566911,12018103,15011440,-15049815,10491328,-7188431,-4291958,4236089,833741,-9017321},{-3001966,-1059145,-32388965,1500577,20014004,-8482709,707483,-4486334,-16943147,9740873},{1,0,0,0,0,0,0,0,0,0},{-11308732,4681744,18048417,2114678,22480766,-2849827,-149505,-11214761,-24611987,-3009667}},
+        {{25038268,-9527866,-8924938,11486947,31874023,8325549,-980736,6712159,2548612,11686554},{-4681604,11016268,-23200081,8345165,-4664479,-3101239,-30837249,-12993240,-22397004,-2834456},{1,0,0,0,0,0,0,0,0,0},{4564885,-6461105,-30388070,-6377066,11632639,-1907385,-31314730,-8166733,-11512808,-4045565}},
+        {{31149445,15308254,33059668,-8934239,-3016660,-10559749,-6187682,1823616,-32940482,-3013387},{30205211,-14652416,25344076,12954700,-30064975,3559557,-28871682,-11157943,-13226230,13487732},{1,0,0,0,0,0,0,0,0,0},{27155948,6913936,9505842,15897383,11709099,12071045,17978035,13762976,-32516334,-7292022}},
+        {{-11226521,-11431835,4719822,5197227,-30022767,-12111955,7458707,7621135,9547046,3584766},{786738,4065744,-29672046,-5025960,22711579,4097463,-3816273,9001642,30954132,-16501093},{1,0,0,0,0,0,0,0,0,0},{-12511090,-9776850,-27992986,-15320634,21755047,4929538,15533971,246079,30313035,14341210}},
+        {{-20100674,2185726,-28115131,15686172,23336113,9788626,-10470699,15699988,-3770338,6896118},{-8664441,1282442,27092239,-5091073,18239217,-2710048,19877655,9698873,32281557,8042042},{1,0,0,0,0,0,0,0,0,0},{12422055,313044,-20508713,-3930161,-27483473,-10058655,19340094,13109925,14314820,-4712668}},
+        {{-1195756,-11531379,14027887,10487385,-14263347,-8975109,19421726,-2559773,33260676,-3681554},{-9547710,7015737,26197702,-8223556,17400920,-16511495,-31566651,-1007744,5875939,9741111},{1,0,0,0,0,0,0,0,0,0},{-14254064,8137632,16556162,2918281,-13308900,205899,-15422337,-5461410,27100284,11735295}},
+        {{4356162,16226530,-8907607,-164433,-17467776,7051758,15441623,-6843859,31506490,-10729772},{759346,10602760,29293929,-6217452,-15396391,-4112580,-31540429,-9205444,6576579,-5289731},{1,0,0,0,0,0,0,0,0,0},{-31035492,12200040,20442284,7082733,33338561,-1515698,18063897,-3798624,30296228,5241221}},
+        {{6360946,-7159969,22723308,-12161541,8091604,-3968371,26118056,1942068,23470621,-9761377},{-33371302,-8639851,17090842,16480728,7863911,14298139,-2431816,-130739,31338598,-7064648},{1,0,0,0,0,0,0,0,0,0},{16756987,7490359,-28658905,949882,-2578005,-203594,17292999,-2702169,-12152070,12699344}},
+        {{-28367913,-11002060,13772517,-11721021,-29177390,-14108987,30938778,-10153270,-2827904,-5900663},{28715054,-10189548,-1637702,-10942355,17433717,9619802,-1970020,-6921503,9082832,13604609},{1,0,0,0,0,0,0,0,0,0},{5374713,9826548,2014714,-97496,-28021295,4846733,30142165,-15374284,9405836,-15979050}},
+        {{25891437,-9360655,-9576205,12020017,-3993414,-5611127,-3825738,-13483946,-28304400,-11629920},{-14864224,10085496,29480832,2062082,21876977,-10731095,-14503684,13773701,12051548,8024032},{1,0,0,0,0,0,0,0,0,0},{-32674109,16755757,-26325501,11550899,-11213588,-10315294,31634401,-5693015,27134569,12222692}},
+        {{-33220869,-2976671,21820665,1683219,-19077205,4257521,17843207,-12921877,7438279,15116508},{-24365281,-13712392,15708054,2415414,-12032341,6683710,-6254529,2808361,9571183,-13552854},{1,0,0,0,0,0,0,0,0,0},{19791897,12932428,14830998,-10377029,33515000,527946,-3107498,-11271159,-7687743,-4798361}},
+        {{-21699684,480393,-23922240,210166,-6246378,12920740,-26992747,11677353,14522548,-3153218},{-3941484,12187770,-12969434,-8001566,-3659470,8782063,-18689633,12294414,27225649,2427174},{1,0,0,0,0,0,0,0,0,0},{27593595,-11109867,13780112,-8321179,4240923,15464391,25531672,7663602,-15234793,15614779}},
+        {{-14038550,2345041,-32365208,2893801,-18487928,-9822961,9776385,13448088,-18769252,-2126301},{12651934,16123852,-26459258,5681378,-6702723,11858840,-9138102,4683966,10728837,15068613},{1,0,0,0,0,0,0,0,0,0},{7915983,-10032518,321258,858110,-12578805,2420802,7075121,-16243183,5179447,3368943}},
+        {{14577956,9947863,19116536,7923034,2791852,4030707,17457930,-8402709,-7809187,8908960},{25157537,8740424,23024149,2332769,8283362,1519101,-8766857,-12116137,33315119,5529312},{1,0,0,0,0,0,0,0,0,0},{-23305353,72188,18873421,-3001062,-33360484,-16271179,14966300,-35183,16761011,12104013}},
+        {{23107337,10815749,1156194,-6865587,-29646775,-11211682,-32749485,8759261,7819740,2032337},{-18271247,-1859878,-29298957,8817718,5761465,3840624,11790229,11412118,-28944812,-5267815},{1,0,0,0,0,0,0,0,0,0},{-4632233,11478654,23854614,11424599,-24961286,-11160040,7136138,5163240,-32577361,10926581}},
+        {{3005437,-14538717,26371503,-8892434,20231631,-7241970,10396728,-10937008,-6925121,14000556},{30634800,12312236,25229336,11883792,-15253286,-7185788,-15768396,-8641737,15374836,12950089},{1,0,0,0,0,0,0,0,0,0},{26847223,9113516,-5020193,-4322878,17794469,1962014,-12333107,-7710392,26166415,-10940311}},
+        {{692669,-11817577,20821840,-1687623,-513457,-9439157,1662400,5111964,15039934,9152556},{-17820531,-4562974,-20350267,-9015499,-12446993,-9697732,7828140,7025558,22374734,-9962746},{1,0,0,0,0,0,0,0,0,0},{-25363198,-1581672,2382125,5864611,-13244064,-4703017,16496603,9662396,-8475496,3428736}},
+        {{-10076681,-41180,18656061,6868193,5070197,-3500673,-13574291,15890382,8255709,-11163539},{2539621,-2965743,15424023,-705278,-17554894,3614782,5317589,-614087,3069921,5849483},{1,0,0,0,0,0,0,0,0,0},{23173862,13257227,26379185,4879372,31440102,2425872,-17694593,2145386,-27646542,-14833674}},
+        {{30773009,558596,23454403,-7849540,-13969166,-3037922,28295056,6553453,28521012,-11440159},{-2606645,-5910914,-10422078,-14430783,6202048,1944175,22357604,-11844457,14594106,4349066},{1,0,0,0,0,0,0,0,0,0},{6034648,16183822,-24438184,12884223,-20187674,-6008972,1123370,9279363,-16925197,-3513861}},
+        {{31549987,2700069,-17469407,13181394,28117398,-2631617,-25559715,-4226275,-4697505,14843544},{688890,10784859,-24584174,9874898,27545525,11157129,14079379,-1286086,-29097399,8046008},{1,0,0,0,0,0,0,0,0,0},{-30965566,3627618,-2269572,14039179,-31507760,11976646,33076771,-15452516,14438311,11853347}},
+        {{-19123460,8352091,4416255,5610220,-29783281,-4920198,28358227,9795776,9280221,-8611244},{-1205235,1761128,22588886,4409639,14505198,15803514,-29609225,-7649318,21835409,-16751045},{1,0,0,0,0,0,0,0,0,0},{-29996629,-14614791,25558482,-7456129,2624031,1855329,2536167,-15695042,23857511,7597157}},
+        {{4329152,-3772181,-21544106,-14160687,28901974,5060941,-29440102,-4506952,-17682957,-3521882},{10246231,-737254,-33280295,-14155559,1800096,-6110803,-8037779,-58956,5559345,-47720},{1,0,0,0,0,0,0,0,0,0},{-5910662,-7135241,19761986,9942538,20979039,5155762,3104382,-6576851,-27105775,-15692420}},
+        {{-26992028,202924,-20330246,4525361,-8111656,7847809,33227920,-7531146,-9604988,13567505},{16032247,-10662756,4738993,-15009470,8580687,-6979931,-25315791,-11625411,-24361352,12806044},{1,0,0,0,0,0,0,0,0,0},{-26337321,5104592,16843913,-8008458,-22046649,-1626579,-29366740,-15110485,25406701,-14941799}},
+        {{-26020054,-7818430,-13643521,1429168,-2235793,-14655254,25098492,8294188,-1396064,7549897},{-19336061,-6145326,22563288,-10405275,10571464,-4849529,-22544487,11918098,-2647058,-8750649},{1,0,0,0,0,0,0,0,0,0},{-31372129,-11936757,-3882410,-5559333,-26131315,-14623003,8121003,-8740006,-29223358,13904419}},
+        {{-1610182,-921253,-3190845,14253914,-12611596,-6476207,21812387,-10669628,10284275,15192693},{22646436,-2557199,-24885730,-2857517,16737764,15152254,-30601747,1128009,-23957808,7961967},{1,0,0,0,0,0,0,0,0,0},{-6159622,-13436068,-28792827,6502403,-517448,-2079282,22671514,7379350,15109037,366973}},
+        {{-19247247,-10336195,-17061002,-7009191,30444531,-10410901,31564680,9137026,1245163,-1360639},{4332443,-12038259,-12425505,-1618987,-8413083,14431006,17501246,-4356383,-27600963,-14834397},{1,0,0,0,0,0,0,0,0,0},{27665872,-10669524,29990390,-16520536,8791528,2989979,-8151167,14524859,-8527638,4589830}},
+        {{6100397,10352357,-19172192,15322756,389840,6466983,-2582284,1547146,-26827547,-958416},{-22037457,-2537106,27953589,14422233,-25744182,1861420,-11449449,-5736414,21892787,7784114},{1,0,0,0,0,0,0,0,0,0},{4175471,-13378768,-981824,2867809,25323416,-4238567,15549972,4462568,1331084,13309244}},
+        {{-32746901,-11307614,33275786,-13196524,19803529,-2064998,29157242,5181013,-26065994,13528438},{4833851,12204752,-19339683,-7808432,4379142,-4096103,31743667,-2971696,-9385988,-5037927},{1,0,0,0,0,0,0,0,0,0},{23000960,-16669622,-33146042,6925414,-16894560,-8422382,-9645447,-15634237,13122881,9339995}},
+        {{24414076,16493612,-12789870,7559114,28834282,-5084329,22388650,4066469,-19511532,-7050578},{24082260,-6632051,7177415,-8451252,20466594,-353813,-6196635,-12631038,-22822628,-146697},{1,0,0,0,0,0,0,0,0,0},{-2254991,-7934108,1977995,-3656545,-256505,-14413231,-5072626,-14065600,-28975531,4820685}},
+        {{1771245,-8861558,19934405,600185,18460496,3766860,-24010036,-4699772,25465974,-10981081},{-5945931,10104980,-13969226,10564914,25935676,-2198800,20447856,-15620132,26697617,-1329628},{1,0,0,0,0,0,0,0,0,0},{2158375,-15801775,-4250903,3885309,18177470,-1673223,-21700529,-13648089,-4226915,-97275}},
+        {{12713629,-9925875,-22544973,4738038,9829239,-9405516,4661123,13940549,-1068591,-10011350},{-20120244,-6588175,8907536,-535672,-28464074,13554351,11593713,3131447,-21889984,11872949},{1,0,0,0,0,0,0,0,0,0},{-10266598,7788931,-390810,16636991,6234286,12306812,29625468,-8109649,15074008,12900797}},
+        {{-9530232,11870111,22483645,-1820640,25699831,-4224665,5682877,-15437943,8867478,-3044874},{20984986,6606411,-27112760,16097307,14987157,4099823,-16113151,11948185,19483694,-3035664},{1,0,0,0,0,0,0,0,0,0},{9820642,-4461940,-19039498,229707,15983740,-2331253,626968,7740704,7272844,8804643}},
+        {{-15835588,11141296,32635303,-11676902,-18824377,-5750758,-217445,15589669,-1014555,5235118},{-17160135,7980374,-120105,6244369,6322764,7688136,-743350,16176894,-13121122,-13460067},{1,0,0,0,0,0,0,0,0,0},{-14189591,-15679453,-65292,-3127782,32079290,7560174,23748698,-12121888,14203039,5787326}},
+        {{32738939,2902970,32723800,8739180,10910644,-7798118,557486,7622878,-26167348,13999118},{22985747,12192173,33343112,-15514320,-3012423,-4712650,-32561874,7458851,23723426,9819695},{1,0,0,0,0,0,0,0,0,0},{19868007,11925668,-15002992,9761299,5990995,11625075,3285704,1090006,28221779,-6696298}},
+        {{-16918410,14518634,-26334360,-15711315,-13785893,10765710,18728189,-6557433,-3081118,-4032289},{-29947753,8095124,12548922,-11430760,-4748255,-11300419,-22230150,-3501314,1282379,10564976},{1,0,0,0,0,0,0,0,0,0},{1312612,-9755818,26840681,3653540,22959814,5506854,10879220,13454180,20609202,16372118}},
+        {{-32185745,-1753175,-23557959,-14764615,-7670482,23103,28943368,5738602,-13604622,-5117693},{-11097762,-9279673,7000218,-3465562,-32565339,14641632,19848128,10947841,31167033,-13179873},{1,0,0,0,0,0,0,0,0,0},{5811662,-7054612,-5831342,-12199432,7382121,-4626737,-11519991,-13989646,20214294,-14277161}},
+        {{-7120833,-16328210,7511945,4024045,5156756,3366243,-2888592,-3271602,-15651786,8972184},{32669950,11903022,-5298019,-7648718,-280508,5610029,-15113564,-3237837,-3323124,10863422},{1,0,0,0,0,0,0,0,0,0},{13472911,15886329,-29747931,4472348,-17117665,3130544,8830665,-2613359,-10267210,13442151}},
+        {{-28554224,10333656,707971,-13730037,-676834,-9270362,30655572,4987402,17362189,1226306},{-1745134,-9659936,-3334912,13120729,-9664086,16250807,-33424964,-6746299,-22864262,9150213},{1,0,0,0,0,0,0,0,0,0},{1262585,12327779,-19694166,9730536,-15295531,12787459,12574414,10651336,-16628145,-2340218}},
+        {{9509031,10604957,-5025422,-835497,22940455,-8567680,-3923075,655696,-32834477,2825773},{-12053602,-4048833,29549842,9161020,-17334182,-12348870,17555083,5157258,21903813,-7679965},{1,0,0,0,0,0,0,0,0,0},{11762334,8630288,-8149057,-16531491,13773196,8547522,9199809,248766,17605857,-5683631}},
+        {{-6274489,-14465740,23525257,4264765,-22696081,-16653470,5007495,-15465331,-2758400,12198008},{-22409568,-12811227,-18436307,-15944421,32645832,-15558533,-10953871,-16345829,-18422926,-9896870},{1,0,0,0,0,0,0,0,0,0},{-13291448,1457381,12298163,-4286923,4523293,713734,-1446828,5790018,-29344124,-15262731}},
+        {{-26398200,-5735790,-2793941,-4913893,-27191890,-5851335,-2075116,3306277,-25626964,-8066706},{-5340872,4969584,-3713363,-10135099,5277699,-10196252,23760060,-10184182,-8835651,1226108},{1,0,0,0,0,0,0,0,0,0},{30086249,-9088285,-17666131,13015815,-32489387,-8631219,-17175677,-5243805,14666431,2535390}},
+        {{-29611560,-12527818,-25189395,16038241,-12190993,4023208,-18103457,16178052,14150273,6726798},{-22804815,-13294101,8840668,-7777762,-23644622,7757779,31678109,6435555,24254121,10142041},{1,0,0,0,0,0,0,0,0,0},{-14144787,-8480072,-14422145,-1022976,-14602518,5875957,-27225412,15138355,33086802,9629125}},
+        {{7439900,-15048529,28006353,-9680513,-29028014,-13775696,7907444,-4669528,-16078892,3702259},{-26460245,-10853235,-20569236,8412610,-30768013,-9950043,-17048514,-9324659,24432497,6693678},{1,0,0,0,0,0,0,0,0,0},{-18019572,-14248650,22544798,11311886,14210240,2954847,10353866,4635921,25719739,-1097793}},
+        {{-11922999,12184812,14494968,-6612339,-5036944,6864465,-2361368,3674814,-10623269,-10523744},{-9276036,-2130126,30170213,-4758656,-12846666,11219575,-7412136,5223544,-13309612,14453709},{1,0,0,0,0,0,0,0,0,0},{-17115250,8514094,-18855881,14747697,25923902,13464130,15155570,-12843776,-19898174,1674057}},
+        {{-891412,-1915308,-27853177,3353665,28120972,-7385179,12650878,5138872,-25636078,6795293},{-8676909,4740692,-5154872,9313724,26872906,5698194,28336358,-15988608,-6583619,14891235},{1,0,0,0,0,0,0,0,0,0},{30228561,7172774,-27740751,1655528,16575954,10780509,6696712,6813650,-11749235,1584838}},
+        {{-9823247,-16116126,-33304849,1449204,27329301,-4100891,20186432,6220876,1851069,9709805},{5787476,8183558,7380996,4285762,-32905318,-2716698,-8943305,9634338,11499967,12453788},{1,0,0,0,0,0,0,0,0,0},{10896906,4305952,5561070,-15408687,8329700,-3783650,19885162,10595611,-17656560,-15727640}},
+        {{16720464,4666230,10112634,8807663,6829786,10724630,23780105,12406,-9216432,16171712},{22776602,9783476,9463776,-14127600,-24685886,11077018,-7284562,-6481673,-30704779,3084032},{1,0,0,0,0,0,0,0,0,0},{32200640,-15451558,-5101398,-9914936,11038508,-335415,13076075,1041393,-29392231,5656640}},
+        {{24796742,4602201,2404395,-10374338,-672853,-5787553,17812749,3314125,32183546,-1137476},{-31872291,-11604010,32362765,-13105557,-15903506,-4240151,11383391,-15176421,-21026510,9700428},{1,0,0,0,0,0,0,0,0,0},{-5806339,8804429,-8622654,-426356,13150990,-16762496,-30942097,14081496,12977279,-11574378}},
+        {{-30845763,8337340,-2310681,5614990,-21610143,-7260797,-16418918,-3120954,12088276,11187209},{-32698901,-12713233,5899000,-6614270,2040416,-10167476,23281254,-1597700,16743656,7833061},{1,0,0,0,0,0,0,0,0,0},{-29146753,7720364,15544746,4283338,30365375,-12119186,-2152256,10693855,-27339924,-1175645}},
+        {{6008213,10912219,-14560425,-13154623,-15505651,14291554,13623473,4482291,2464101,5767227},{-20442350,-1361279,-8343398,-15719893,12874831,-7153171,-6362789,4454391,-24998221,4116828},{1,0,0,0,0,0,0,0,0,0},{-30256271,-12727324,-6535781,-11152245,-27323013,5387997,-21361545,5049259,-15429187,-14653945}},
+        {{-13756075,8565909,-1996971,4313832,30626032,15244628,7306642,12416183,-7581857,14204882},{-4395137,6439073,19247855,8150070,-31837700,-6992292,31100031,-15531883,-15771233,2522262},{1,0,0,0,0,0,0,0,0,0},{16899252,-14278333,-8713636,-11040165,27416421,9073315,8822765,-8579768,-4606767,-8997330}},
+        {{8564415,-3290610,-2496955,-12341347,3730367,5262813,7269021,-15253421,23054560,-614891},{11091108,-9944746,17074483,-15115276,9297530,5113590,21782559,16406999,-24809545,-13550264},{1,0,0,0,0,0,0,0,0,0},{5285103,13405365,24575721,-6928400,7985772,11894154,-29763041,7664960,16406955,-13580687}},
+        {{-3761270,13016990,-15313777,-5467432,7399620,5544694,-12770901,11776530,-29716,-7700735},{31265570,15607228,11294646,16713610,14611995,-10234266,3190782,-15279706,-23657342,1130165},{1,0,0,0,0,0,0,0,0,0},{-10526944,-12624448,-18683307,5099227,-1571111,-1373746,112538,2184735,-27210790,-10472278}},
+        {{28649305,-3590116,-30276837,-8073723,-22312652,2662793,-24077832,5168350,29877171,-15807815},{-11054055,9783902,-5175668,3206730,-19128812,14523195,-5006446,1346530,27263072,-9367290},{1,0,0,0,0,0,0,0,0,0},{-12462925,652432,26704237,-3976213,25503168,11824265,3779455,-15302735,-14581123,12425789}},
+        {{-785358,10873937,4614199,-6884357,-24034847,-3359474,16229793,242814,-7495630,1378831},{13224826,-5804528,-13939986,-5228244,27871905,8744571,21592118,-5363225,-25422893,-16338099},{1,0,0,0,0,0,0,0,0,0},{30591991,-6516910,13544556,1904967,-31157569,470032,-32595088,7820878,13510955,5680723}},
+        {{-6663288,-13788020,19162000,-13791084,27580035,-12514518,15210157,13319123,-21452623,-15436088},{-5162879,-12147170,7365253,-3659022,-2798622,-9194468,2372099,2506309,-29086862,7999566},{1,0,0,0,0,0,0,0,0,0},{10284430,10081212,12806310,3570949,3210193,9589700,-18404663,-5807973,14878806,-12134786}},
+        {{-15958296,2540351,-10941420,9771365,2387261,7517716,-23096707,10699173,-16417746,12773346},{-15564922,-7948206,5996342,2301607,-1370420,4776841,3501283,3448161,28174802,11408110},{1,0,0,0,0,0,0,0,0,0},{-16076077,15987854,-12308684,-7211193,13784201,-10031525,-9732743,9784072,-31692682,-1916706}},
+        {{-18004463,12503410,-17646885,9720757,-21129470,13581010,3355623,-9025544,30933058,-11241064},{13052270,13705684,29064204,6037024,-23180651,-1581323,-175205,-4120428,9367713,13202602},{1,0,0,0,0,0,0,0,0,0},{-4060105,8239241,-2752270,-3349905,30027321,-12998125,31193483,335312,4745889,1515922}},
+        {{-4237308,15204835,17890120,-9900496,-33333861,-2272569,26560223,16194248,-13401713,-4704727},{7632808,-2264176,-19121352,-1209853,-19229792,-9816748,-26102827,7402922,22623749,11848338},{1,0,0,0,0,0,0,0,0,0},{-23566148,-9982636,-1554714,-5070179,1617602,-6165567,28544955,-1593769,11389883,-12670058}},
+        {{-24019056,5107588,27936391,10666500,1615493,-8386094,-5586093,-15576525,-18141324,-15630408},{-9518331,-1316406,19080587,153876,-20792167,-2285426,-28377990,9867601,-27030937,-3984157},{1,0,0,0,0,0,0,0,0,0},{-19535801,-15483780,-9030203,-411088,14571900,15268855,33012994,16288829,14794739,12145222}},
+        {{-6063051,11300368,-11163047,3271431,26711946,-12854967,-19526274,2616809,6385946,-14239434},{-11711834,-9600120,24408741,1512672,-13147309,3863592,-21642180,-10094206,2827952,-5642780},{1,0,0,0,0,0,0,0,0,0},{11133022,12585964,30921990,-10346333,7657102,-2273859,-19335171,-11164499,29429252,-15926659}},
+        {{33423704,-10902005,2067470,10080287,13882994,217596,9044746,3441066,-7729719,12578766},{-14175030,-14480701,-23578651,-3507076,-17855217,10523791,26887982,9127558,-2138294,-13473809},{1,0,0,0,0,0,0,0,0,0},{-21128726,2106971,24555618,-15901386,-564370,8199529,22321998,-3705512,52717,751649}},
+        {{-27067391,67492,-2228402,5737216,-24223803,-16392586,-21214044,2056938,-17776182,16566282},{3878665,-7993244,-17388032,5850424,32703439,-4481405,249204,15153217,-29184504,4564634},{1,0,0,0,0,0,0,0,0,0},{24193022,9401341,-18014674,-11033780,-32192750,-5838995,26289958,8288712,23366618,13577583}},
+        {{-3780885,9294243,-12069287,14956953,3929972,14544443,7192791,-2719772,32439962,-6019117},{18967626,-12193320,-29805927,8789666,12714035,1039146,-17249552,4292300,26046622,-16694040},{1,0,0,0,0,0,0,0,0,0},{20370175,-13510393,6847993,-6334278,31277377,-12894909,-32342137,7740854,32420043,15720253}},
+        {{-10143847,-3400360,-9657694,-16326271,11410462,4550591,32845223,-8615452,-21276437,13248640},{19844620,3308506,-5145776,3376670,-10564877,8747661,-22215822,12501102,-15187976,821682},{1,0,0,0,0,0,0,0,0,0},{16774085,-5886264,-15236019,6887221,17405639,-6099966,30361547,-4612455,2118614,-16370375}},
+        {{23398079,1486810,-32251416,16175992,-25291618,-940348,15377208,-5403683,4564555,-5947428},{3608581,-11309991,-30782273,-16460348,-15834602,9838601,-11736909,-10115998,13516727,16482300},{1,0,0,0,0,0,0,0,0,0},{14574368,-10063120,-26691164,4973365,19555928,14650569,-20252612,11467259,15754534,250292}},
+        {{2674987,15624921,32131062,-710285,18455786,-980898,8882308,-10452353,-21663529,-973049},{-15857922,9394213,934730,9717329,-6757199,-510517,8107464,-6191006,-25995684,12928213},{1,0,0,0,0,0,0,0,0,0},{244966,-13234497,-28710795,-11907187,23383021,15701320,-9476309,-8514231,-18175775,9500488}},
+        {{28867950,-401685,-11425350,-9246040,9813359,5135790,-6638858,15658035,-6365291,1666264},{18120412,-106469,-13604603,16761114,-27429038,-9501287,-7468816,12378396,-8111713,-7418759},{1,0,0,0,0,0,0,0,0,0},{16579647,3460826,16118094,11578726,-20190664,9303230,-18689531,-3239622,22981991,-11777970}},
+        {{-29415149,6830953,14719325,14797709,-17288086,11361370,-22762232,-12801141,30198872,1535970},{-27484849,-8544342,19071818,3217272,-24371171,-9522081,8502625,6490604,31555128,-2446194},{1,0,0,0,0,0,0,0,0,0},{33470170,-2043296,-8052703,5239711,32633794,-13631879,29485910,-8644139,-17083063,-6548378}},
+        {{12900866,-8367262,-15975549,-2634970,13636359,-6335708,15151098,-10413199,5422411,-14939041},{-30330357,-767467,-18347043,7261699,15363726,-5211597,-1033070,-9459393,-461537,-4346705},{1,0,0,0,0,0,0,0,0,0},{31730520,-8415730,20180568,-9464602,289803,4565184,-20498428,-2508822,31499184,9691207}},
+        {{26561531,10900920,28467627,6081453,10181583,-11143029,-5530289,11397087,-10128085,-15454836},{30652454,2761727,-27578933,-2882239,17579942,1245425,-21116370,-5352872,32717581,15931493},{1,0,0,0,0,0,0,0,0,0},{16372743,-12894378,14628092,3846107,20804241,8221636,-25297042,11325034,24624348,-10931624}},
+        {{-4571870,-8886625,-20584602,2048501,-1088565,-4415446,1311325,14044438,-9379483,11356584},{8481932,8620638,-1789467,14358174,-13261796,-4533039,26711929,-5119504,30965727,-16127711},{1,0,0,0,0,0,0,0,0,0},{-9051658,-5834058,5013987,-6045857,16769125,-11939799,-21860673,-7236316,-2372253,1048155}},
+        {{-11159784,446647,29128762,-9241722,-8684022,10399122,-1014757,-15415836,12206252,2092131},{-8544491,-3139374,-5935751,-16128909,18742184,-1566723,13697786,12961001,-18610576,13022708},{1,0,0,0,0,0,0,0,0,0},{-9450886,10941247,33426909,-7048454,-32510576,14440990,30661456,16255386,-26222867,13900925}},
+        {{-12306274,11400331,18836861,1719076,-6273981,910795,13161963,-5751787,-3198602,9802870},{-11035473,-13842965,-4628303,635384,-23591601,13273228,873852,9744127,-31258082,-2470794},{1,0,0,0,0,0,0,0,0,0},{-12970289,2396096,25952804,9597789,16896065,15761010,27604601,16106355,12252778,2121413}},
+        {{6569750,-7573896,19378171,5646201,-6780191,14720050,17764257,-9806160,-2889075,3527704},{25011336,-10189866,5659989,1194572,659605,6219050,-6610125,-6664372,7231539,10454583},{1,0,0,0,0,0,0,0,0,0},{-5510530,1682931,-15209463,-1374979,10346627,-6064804,-33414330,-2392926,14679933,2123097}},
+        {{9514193,8604733,-5573359,-15574180,-24338124,3699212,-9674305,-11329047,-33461907,16128549},{32193866,-14174633,14650197,-3944709,17846639,-12149148,18152657,-16227887,9074760,-16736990},{1,0,0,0,0,0,0,0,0,0},{8048434,13894158,29420327,-8808171,-32443558,-9643773,22343618,12869396,-30403033,-2594916}},
+        {{29747930,1552747,-30952726,2519716,-14327381,-4746457,-8260181,-16338484,-18992218,6730608},{16501431,-8152468,-18553601,12651865,16421475,12859422,-13286153,16337321,2037093,-397049},{1,0,0,0,0,0,0,0,0,0},{-23475090,-7487223,-27062191,-1870964,-27983529,-9645040,-30969228,14627163,-7935912,-9081372}},
+        {{23891867,6577,-7631680,2504018,-165649,9411364,-8000271,39370,13932328,-2120986},{11136748,-999521,-1370963,943583,-21597291,417009,-9685479,-5663097,6459177,1936564},{1,0,0,0,0,0,0,0,0,0},{31354527,-14736754,29783996,13277692,9681295,-1668588,-4151017,-13697525,-9814927,-5862510}},
+        {{-23024435,-6720808,9807317,10846508,33453279,-10143831,29408939,7197400,-33019967,5969486},{-3033605,-7535402,23597925,8903137,-3932128,3083069,-17395754,15591734,-17462526,-9894720},{1,0,0,0,0,0,0,0,0,0},{15553225,-14384065,-27574328,11861992,20610182,-12714833,-5589295,-11751870,29047716,-8025136}},
+        {{-13612376,-6192085,13394594,8517975,29708988,7219878,-22293447,8614267,3647461,4939136},{26689542,-16476284,21616422,9548318,1111716,-14109439,-12007652,3180858,5195546,14739831},{1,0,0,0,0,0,0,0,0,0},{10743645,-12003552,-28283120,4043077,-1613866,-16771908,9884654,-8648840,22664637,-5760007}},
+        {{24717118,10328328,-11047972,316719,29274035,3027311,11105294,7777324,-28270404,15105080},{30982838,-11427593,-29275259,12033662,123275,13376958,23368856,-2808076,-27596445,3784536},{1,0,0,0,0,0,0,0,0,0},{22578758,-12077404,-30934746,-9374744,18836183,-7363589,-30561187,2107333,-4797243,14069817}},
+        {{-12176025,6780109,-4027864,733562,9613803,-12434224,-14300982,-14167439,-6922890,-6278571},{-10325446,11985241,-6021302,10343462,32883410,13148936,-16530271,-13887502,-9073600,-9499163},{1,0,0,0,0,0,0,0,0,0},{-792123,331606,29693616,13525828,-19705771,-3084129,1699696,3396464,32600550,-3375354}},
+        {{-8484088,-813574,-8352123,7319602,18424336,11252561,-22629266,-10419276,5821506,958532},{20785676,-15937112,-16756953,11431179,-17600755,-7202459,21138292,12858289,-26990063,-10614862},{1,0,0,0,0,0,0,0,0,0},{7141762,1719208,-27338267,-8710952,30798066,12606429,18040378,-16231190,14337887,16183831}},
+        {{6577071,4169317,-1666722,-9539900,29656658,-4753919,-30553005,6450607,-27294122,15544136},{8012321,3306956,7458208,13888314,24206227,7229969,-5483396,-5786711,-5818833,3911034},{1,0,0,0,0,0,0,0,0,0},{18413312,13284324,-31136257,-11826686,28468713,-7962033,-14557306,-15949493,-5075956,3286978}},
+        {{14936838,-740055,25884159,11399364,-32235953,-3380809,9835050,-15718089,31755334,-10593674},{-28028355,-7779906,6076913,-10651178,-13542961,-536328,28795719,3353392,-16259003,10132897},{1,0,0,0,0,0,0,0,0,0},{-28588926,-5671274,4776162,13224690,-13145508,14854517,-28639705,8188693,14745543,-9438172}},
+        {{-13784472,-15595650,-7244013,-4341945,33163932,-5760107,3897305,16510507,23956830,4671435},{9713912,15308363,-31948556,11425588,28616564,-15951869,-25756678,3324579,-25225522,-6622420},{1,0,0,0,0,0,0,0,0,0},{26000412,-5002960,-28852017,-1187134,-22955699,-8826580,-8383789,-16154767,32951732,-7019502}},
+        {{27847724,-9414596,-32169433,8687766,29607228,7934904,-1772690,-828373,12927968,-7418694},{-10384009,-12308177,-22832479,-11899702,31787037,-5917718,11991881,-6486679,-31423240,2113297},{1,0,0,0,0,0,0,0,0,0},{12895870,-1287368,-23622285,-10065967,24801262,1013367,-10782642,-4879638,-19693210,-1697451}},
+        {{16147833,-11140671,10947252,11421055,-16020496,4702895,2494104,-10270625,18138057,-7522326},{354504,-369334,-22424127,-14510153,3162231,-4460261,24650929,-10435596,-27144962,3447510},{1,0,0,0,0,0,0,0,0,0},{-7433393,9345510,5694378,-5128038,11131131,-6965808,28485439,-12885704,20310182,15441256}},
+        {{-16086655,2122774,26116094,-10697796,-102695,3929399,12664323,-3116347,-17343579,-4318119},{-3772379,8356970,-109474,1752230,-18805300,1443206,22515846,14532501,-4458880,-13398575},{1,0,0,0,0,0,0,0,0,0},{-15763915,1909434,26411465,-15282851,-7025818,3275010,7719949,-5050981,29641568,15834501}},
+        {{27185152,14134674,16488672,16022405,21243137,-5976194,30459212,-3881167,-29739921,-7026299},{17057366,2632056,-12284602,2935708,-3925894,15589176,19760507,-5109666,-22222095,-13436571},{1,0,0,0,0,0,0,0,0,0},{30998420,7758378,-29726792,-15876348,15172698,-4858862,-3840102,12073860,13998568,-16469265}},
+        {{29115853,-12316551,-29424137,14315901,11022094,-9456541,-19894619,-11361340,31888057,-9027799},{12139209,-16493220,2882982,-7373217,-19504934,1313712,8392460,10101730,-33002065,-14013557},{1,0,0,0,0,0,0,0,0,0},{9005872,-5298304,31097300,-4214333,-17908622,14306807,18262729,-14563142,693042,-4186253}},
+        {{29142519,4867277,-18496389,-2578977,-14410404,-2224227,-22052305,14140184,-10158414,8035900},{32910154,11153939,-4612830,14010816,-25500595,-8855245,-4618536,-1843245,26089444,4285629},{1,0,0,0,0,0,0,0,0,0},{18946785,-14846670,-32469500,-5465862,22542319,-825579,-3624079,16020970,-5300975,-16406802}},
+        {{24602532,-9867454,871210,11190910,-10288846,5791735,3021322,13392761,1913146,-7656562},{3210452,11577475,31094307,-12939649,-25922489,10422969,-25812396,-16197413,14583545,2753858},{1,0,0,0,0,0,0,0,0,0},{25873178,10057793,14673173,8962520,10966976,-2171036,-32028956,9219784,-14954757,8062163}},
+        {{-4290554,5630024,-16970051,-1017369,-20627783,-13407039,6441551,47629,-8131130,-91397},{-27348737,-9947717,-19182354,1543268,13515176,-15240942,22551515,-4344360,1412368,6267159},{1,0,0,0,0,0,0,0,0,0},{22281724,-15998493,21283323,3794379,1981130,417899,-14131545,12701300,-31336424,-982669}},
+        {{-1231086,-685124,-2523231,4744162,26001063,-3731468,25292595,8848571,-5345746,15682997},{-31849934,13701254,-30195316,12574829,9339107,5052911,19945325,-2351371,12825701,7014428},{1,0,0,0,0,0,0,0,0,0},{-20534974,-6514935,26320423,6667649,25052579,14120017,-25162487,8412903,32268134,2852587}},
+        {{-13813734,-15210245,4533334,7530998,27067997,13400019,-15932034,10200716,18694271,13489195},{33292868,-5721403,4939898,10468701,13167739,-15150040,5722010,10762528,-30274541,13202330},{1,0,0,0,0,0,0,0,0,0},{21782215,3474544,-10406975,-6017759,-13426445,16217974,30417166,8602004,-4725534,-10346946}},
+        {{-23860424,10636841,8475467,13655760,20884190,16686019,16500284,-1924519,-11022944,6183849},{11417705,-10727255,-19214933,-15660882,26504589,1802844,32102900,-2031576,29587939,-2388486},{1,0,0,0,0,0,0,0,0,0},{28475764,-7431777,10423411,2371429,102160,-13049395,-16793148,2303582,-27595004,-16362776}},
+        {{9519122,9020101,32344448,-3741168,5550240,-13061136,-20107488,-4391305,27710399,-16176916},{10306740,-15476327,590998,-14130540,23977047,-3976134,22320995,5620079,-1496778,14420721},{1,0,0,0,0,0,0,0,0,0},{30669177,13439830,-28761863,647485,-9695422,-2180024,-2381229,16103427,-4964498,4503288}},
+        {{-3833458,-3780003,33543472,13220254,28328028,4395185,-3079065,181325,-16066677,5984798},{24237439,6858493,-10011047,-2220081,446509,-4678106,29418515,-14774371,21552653,11082758},{1,0,0,0,0,0,0,0,0,0},{-5929531,-10094278,-5717829,-16570904,28109336,13285395,10234144,2224027,1854521,-476957}},
+        {{10483726,-2163994,30799456,9028122,27369168,-447879,8809198,-9276370,5790306,-10075522},{-2107286,301349,15964654,-14398574,1422552,-1224296,-50122,37266,9618003,11424691},{1,0,0,0,0,0,0,0,0,0},{22577342,15567935,-30902377,-15954174,2549882,5548505,28655410,-15415144,15467866,584572}},
+        {{11595369,16312087,8036105,881180,-28897712,-6548332,-29073687,969938,-31765703,14026987},{26394411,-9100951,-23577918,8249789,-14807648,13509373,-23874014,-9074703,8132439,11642253},{1,0,0,0,0,0,0,0,0,0},{-29239970,-12748438,-6998241,-2700796,-11166887,4240584,27122314,-16662350,18463446,-1652191}},
+        {{3508009,8159726,32295357,-9879220,23763490,-2327404,-33007398,-2618698,-10712259,-188022},{-24334207,-10623823,26874784,13308200,-2433397,-8777233,26821989,-7290976,-4560785,-15304603},{1,0,0,0,0,0,0,0,0,0},{-21115431,4057136,6155557,-4789689,6656389,1821677,18754584,7797748,-22704252,-5010751}},
+        {{-26112360,-6855853,5077673,-2831366,14187268,320718,-2063369,6158293,30544453,9165385},{6895419,7526225,-32015136,15461363,15915980,-14065040,25683102,2353461,13815429,7664582},{1,0,0,0,0,0,0,0,0,0},{-29173568,-4431512,-4527776,-3909138,20065589,2853436,-20459670,12301649,-18722712,-1617591}},
+        {{-25327756,-7137366,16761491,13772861,-23990844,-10075025,14022092,663831,986122,-1676036},{29064686,-63305,29851596,11742707,-24940438,-6450336,-16427421,-5472024,776054,3749191},{1,0,0,0,0,0,0,0,0,0},{1438932,3059870,-2547962,3243073,31343301,-4625885,7843074,-3658448,26800147,1632359}},
+        {{1823632,1362041,-345402,8501543,-28131357,-10595748,-15592878,-6005414,12526430,8311430},{-25360081,5561193,-6201571,-11926621,18496315,1022567,17220226,-489908,4569963,1314786},{1,0,0,0,0,0,0,0,0,0},{323360,16479328,24975851,-86313,-9274666,9880758,-29199632,-13417054,12234933,-968943}},
+        {{5823257,-15778502,21243544,15973334,-32176492,-5564115,12210805,11564833,-15950877,12449651},{-1790573,16088262,19867497,-7341632,9312199,-2846314,31875550,16739699,32766862,9251468},{1,0,0,0,0,0,0,0,0,0},{-14407728,6992917,33510495,-10609026,-11698067,2540472,6859737,4604409,2311885,-7774674}},
+        {{-3308319,13818482,-21417005,-13094380,20473258,4417063,-22534781,-11780371,-31595868,14286720},{21824947,-8625463,-32251549,14355874,-32523212,8676161,-3881083,10594532,14403179,16002037},{1,0,0,0,0,0,0,0,0,0},{23724601,-11290735,-2930395,-14060791,29921040,13911936,-31644884,-3385563,-29824065,5429771}},
+        {{-17569668,-807111,-27075024,2462187,-10051392,11198402,-31934167,10751726,3315203,-8504061},{-15505396,-15961757,10963595,5574346,27186045,1176906,31930333,-7896916,-7476760,2536183},{1,0,0,0,0,0,0,0,0,0},{8983568,13905550,-24244781,10907331,-4111531,-9860412,23867178,9751281,-19690807,3543146}},
+        {{-17272600,-293738,-942383,6307378,14564037,-15569959,9495158,-11825008,-6119836,14479540},{11060523,1271436,-5951914,-6556379,-22482381,-9280620,4776848,-247920,2136839,16002895},{1,0,0,0,0,0,0,0,0,0},{26919155,-7102166,9507985,10866033,-26481847,3702354,-30774899,11196326,-20993572,-14307910}},
+        {{32461497,5915892,-32845774,8757996,19197524,9739050,24653905,-211352,-33210876,10491999},{-32124711,-15252526,-29212964,-6220439,-425338,6329115,-30688020,-15051669,-1858349,-3238997},{1,0,0,0,0,0,0,0,0,0},{-13713300,-8134046,-738230,-70146,6887681,-14384844,17428944,-7207178,-15865064,-7481276}},
+        {{-2507168,12393554,-27703297,6733131,-28447639,11102925,-19930898,14979162,17531869,-11122016},{-11054567,-6307275,-32116152,-7717822,13716604,-601862,-5953556,-2970082,19985385,-9418887},{1,0,0,0,0,0,0,0,0,0},{31947706,12389745,-33483906,1231509,-18610361,-13123196,13201431,-13057865,28606951,1304939}},
+        {{-8017483,-1694870,-18160056,14841301,32656339,-9645018,-27823095,-4082455,384043,-1400322},{9777508,-13248691,21975239,-5577613,-3360718,-11423558,-11802493,-16420083,807744,-8503385},{1,0,0,0,0,0,0,0,0,0},{-15417977,6694122,-19808427,9537958,-15117274,-15408602,22091898,16222561,-5691666,-9883315}},
+        {{24840900,-15648091,7150502,413280,9967737,10146480,-16755135,10281651,4643447,-6531185},{13394446,-3143103,3161696,7825147,1985034,1538204,33371508,12001553,31347546,-9636769},{1,0,0,0,0,0,0,0,0,0},{-24661180,9603302,-24346637,-14425149,2880673,-15785228,2389611,2613740,14916470,771770}},
+        {{-9502233,1820800,27841624,5968629,-16103287,14339503,-9991783,-10250619,-10609788,-10628686},{1259876,14883336,-7708410,8377089,-14087667,-7676562,2888731,-7208207,-24698496,3560287},{1,0,0,0,0,0,0,0,0,0},{-11650567,-15150228,-14093348,756329,-4764764,-1726782,21713848,-9021179,25265142,417235}},
+        {{30342519,-15771440,26717284,1431602,-3917957,7768797,-16444221,8047217,-10554962,13325085},{12311460,-13813143,15216918,1588051,3532274,16462699,26699767,-9636996,23449936,342963},{1,0,0,0,0,0,0,0,0,0},{-20453629,-15883986,-8300537,-2596311,-12963957,-9829979,-31797440,7935834,18279325,13833403}},
+        {{-31607857,15594342,6047953,-2508103,14672218,-4580544,-12416473,1639063,-7959207,5139254},{-13306602,-14617706,4621705,8018784,19520672,8251167,5851844,-15024629,-9940277,-5763836},{1,0,0,0,0,0,0,0,0,0},{-4181471,-413810,-29799848,-13043414,16517019,11023147,-13313788,896480,-22018177,4984690}},
+        {{-2821199,-119735,6367238,10177619,-12341332,13133489,27093557,1563534,-171617,14918757},{14424582,846941,-26652258,-12953925,31928760,-13110174,30115600,-3049835,-6276465,11696049},{1,0,0,0,0,0,0,0,0,0},{11382826,10877016,16304206,-5821981,-10094602,13854411,-14152884,-10739592,15912711,9707957}},
+        {{-9738131,-7743496,32624276,-7004810,-8306697,7052939,-21820243,5753975,2387903,-14847987},{3750361,11372056,11571414,1238716,32210881,6329098,6986352,-12217797,-6460962,12672044},{1,0,0,0,0,0,0,0,0,0},{7962999,-11572795,-19714318,-14756654,-1671654,-1734650,33359431,-8618456,-9158076,-14577130}},
+        {{-11316046,14797003,2229256,-9335396,-2576713,7544353,23662484,6985893,21258231,879707},{23408954,-16332463,7133874,7131204,22583979,-1967448,-20742955,9218572,3798687,-3573510},{1,0,0,0,0,0,0,0,0,0},{26726449,9515733,-28955358,2687637,-21936588,2097106,26595942,-1981768,14756585,-8764132}},
+        {{-14031195,-13688720,-30986520,15010756,-20321219,-14980077,12359329,13010052,10914946,-16771061},{-6095663,11810232,-10583873,-3070169,-21016262,1005136,-26136424,-9375933,23514678,6844982},{1,0,0,0,0,0,0,0,0,0},{1899381,-10606157,22621887,-11169803,-17531621,-2801959,-10010216,-5105474,-30811968,6076415}},
+        {{-4065202,-11314962,4006347,-11165019,-28272602,5998675,11865126,-12234221,11583065,-14294548},{-31065050,-5036332,-22742538,11153593,-4095889,-14096262,32636455,3091804,84017,-4403718},{1,0,0,0,0,0,0,0,0,0},{-3322059,-3994035,-16616496,7270584,-12134234,-2871000,-2896669,3756686,19052111,-13596625}},
+        {{9135371,-5196465,-7422858,4274364,17200205,-8282248,-18228788,8576005,15498526,7822859},{-23218720,4415587,-10109956,14622893,26432392,-8162260,3886960,-3742199,-3265065,-13399696},{1,0,0,0,0,0,0,0,0,0},{-10795850,6907139,-6824562,-1710940,30088474,-2789500,-3698546,784673,11216505,-6528275}},
+        {{13463314,-7877546,12206917,-6654934,-25979042,-14924005,-8855518,9314162,-26410258,-9778708},{-7664203,3427723,27885624,6799517,-7444571,8217740,11686321,11376489,-5675807,-4828247},{1,0,0,0,0,0,0,0,0,0},{-6172044,1397912,-30455803,10077758,30655524,5619174,31733410,2964683,-8694576,-7157046}},
+        {{-18935342,5784789,3258068,-13593611,909535,-11343547,20718897,14367399,19624084,6699012},{24319597,14176550,-8801453,14662287,-21210827,-10895687,20499408,-14332466,-16354007,16065621},{1,0,0,0,0,0,0,0,0,0},{16809074,515645,-24814164,-14829302,-9018532,-2799688,20109988,15987891,11059180,5778817}},
+        {{22079668,15289839,-8371344,1708437,17724785,-5042781,17918508,-11709522,-4493639,2679387},{14955932,7751701,-29182599,9848561,17525491,3846540,31033003,-10399952,-31002628,2030405},{1,0,0,0,0,0,0,0,0,0},{23384860,7761587,7256884,-13023452,16219653,9207110,-3772174,-16616911,23525437,-9123084}},
+        {{3168467,9669629,-22278012,8512256,13567237,1470456,-10983350,-16611894,-8180279,9981114},{29125389,-1174121,-23379772,15537115,-18671594,-6530837,12114830,-1789832,-14705813,-1420585},{1,0,0,0,0,0,0,0,0,0},{-5972514,-8458441,31748036,10821724,-12648925,-1632676,16050551,-2538312,7552372,14647920}},
+        {{-4195216,980502,-27260589,-1522425,942067,-14615215,-32321474,-7320633,1847268,16498514},{-19421331,-3298379,4180833,8172288,-29981299,-3851308,15664238,-14469606,27087200,-5133652},{1,0,0,0,0,0,0,0,0,0},{-32202980,9505429,641462,6727525,-22701335,-6882752,12858987,9285746,27194151,-6073193}},
+        {{-4412082,-13404417,28403203,-13711140,30190339,-10830585,-4283934,3781615,29565460,-15377411},{676147,9832804,-23838796,2382612,-29249014,1635345,20949264,-10517033,24883636,11617343},{1,0,0,0,0,0,0,0,0,0},{-13342047,712218,-14376410,-2190777,-8843364,-2149827,-27939163,10585128,13615197,5794449}},
+        {{24104600,-3820660,18366035,-3284625,-12062408,-13678347,-31188066,-8326373,-6480843,-16425149},{-18450002,-91281,-24137480,-14727446,-19625583,15453800,1498418,-5517394,18074441,-4686841},{1,0,0,0,0,0,0,0,0,0},{14431782,219636,21752022,-4768093,-15808037,-13048003,12365736,9381350,-3369651,7317902}},
+        {{-23148758,11115516,-3654676,-6309047,21751792,-7985598,-12343311,-11858057,33265382,-10363303},{17918126,-9353059,24469637,-5795160,27929750,14232257,-4963145,15123813,6343492,-10630792},{1,0,0,0,0,0,0,0,0,0},{-15525147,14986282,23032809,5943844,26223061,12374675,19653892,7522887,-22658381,-2644362}},
+        {{-31576866,8204076,1725458,-4760984,32408292,13467225,17397138,15652537,222560,-39302},{-8542606,81537,-6772923,4752945,-17032,3774429,-6708645,6761925,-8862340,5059048},{1,0,0,0,0,0,0,0,0,0},{12396960,14700585,15847555,-10182992,2941242,13617661,-6363903,-16653587,-15816305,10506483}},
+        {{2951417,4321846,5165651,-15883158,-19859902,15894096,-5775152,10137102,6541949,8555971},{14773919,-11652764,-29534738,-194721,-14649786,9409248,29857955,-4388655,29232226,-1433401},{1,0,0,0,0,0,0,0,0,0},{-10760181,-11970605,-5166281,5231265,32754497,11815463,-12285584,15666514,-3545102,-13993168}},
+        {{-13901652,2677363,-28627523,3421364,7980435,2619315,-7636438,-11683482,-26922692,10802859},{-25569811,-10288431,26379567,16076321,8019958,-1699747,-8078808,5208668,20834760,-15025803},{1,0,0,0,0,0,0,0,0,0},{-12313944,7469891,-14921313,-897261,18726526,-15009292,10744922,-10386654,-23035646,6260008}},
+        {{-19533808,4659582,-8144394,-6509,-18992563,13162081,-16807306,-16183078,3320942,-12208919},{-2084617,5681942,10370486,-14215233,19815955,-12219432,-8144967,-8384793,12209426,-1458668},{1,0,0,0,0,0,0,0,0,0},{15251101,-11650747,27032745,-8468681,-5259853,13904073,-19380576,14474539,1367398,11087424}},
+        {{-21026300,3726925,15045110,13666713,27356464,5253018,-28001583,14802205,3665481,14109613},{5158920,6049141,-3210730,5026432,12517409,-12396944,11300847,5396569,14044966,12172076},{1,0,0,0,0,0,0,0,0,0},{7759852,-14190277,26391703,11817202,-12595691,-8382310,12878055,-2261420,-2473306,8412957}},
+        {{-28829057,-11162282,-18816154,8712617,32016342,8162512,12119311,14565285,4699246,-12373251},{-25774614,-3756367,19462873,1997392,-16101711,-5054654,-10773194,-8812204,22874857,11960429},{1,0,0,0,0,0,0,0,0,0},{20125626,-15631695,-32197414,-4983721,-20541136,-540486,9373807,5143635,16258428,-602380}},
+        {{28585507,-6453262,14432707,12968329,-29197591,-7781157,-8859217,-2194013,-24220680,-10615889},{29962275,4601295,-1412277,11128857,18332189,-13002402,10796656,11259080,9864428,-14028687},{1,0,0,0,0,0,0,0,0,0},{593904,-1137698,29856885,-15385053,-12961257,-9741743,22755096,735437,-9638383,-9030576}},
+        {{-6659178,12110860,-33508975,11581287,13872762,-7349008,30431056,15860550,-14486396,40727},{-7401284,15002083,16469220,12885980,-14763866,487896,-20584943,1042414,4196018,2645701},{1,0,0,0,0,0,0,0,0,0},{-219469,14942656,-16155066,4893081,-19975364,-15408594,5547784,13559266,-14634990,10919119}},
+        {{-4488767,14883781,11694134,-16400542,146580,4284667,-11450053,-15055214,-5244960,-2530863},{17325461,8692518,14167034,10497903,20027569,13752846,8271428,12447792,-32805032,-4324151},{1,0,0,0,0,0,0,0,0,0},{11945402,12382766,-31108374,-12763540,19727270,-15878351,-28049523,2500349,-23285123,8816988}},
+        {{12268685,-6158688,-5580768,15155365,987855,4215651,17135198,3820579,1258303,5850914},{-27477516,-1551106,23074855,-12425850,23557829,-12061958,25144553,14442888,164396,16259681},{1,0,0,0,0,0,0,0,0,0},{24002829,10602990,2943759,16315974,-25771956,-13538467,-7848534,2410781,19291973,6336242}},
+        {{30987164,11252962,20368274,-3256432,925447,6291895,1515411,14554457,21674853,-14071063},{-31036191,-8283048,-12164464,2149098,-16927707,-7241460,-26191164,-16676465,19030481,6069013},{1,0,0,0,0,0,0,0,0,0},{-21801457,-8060940,15019217,-16385658,-3197094,-2694354,21478143,10880385,-28532628,2121739}},
+        {{18314888,12856601,-15587949,-3305013,14834744,-341023,-23109973,5392172,-6279722,1883499},{10150887,-1451782,-16838969,2229893,3338939,3848950,-26364175,5654462,-18176324,4847051},{1,0,0,0,0,0,0,0,0,0},{-26957092,2748033,861855,16438569,-18420117,9144217,25185832,16573210,14402309,4844776}},
+        {{-20421266,7506980,4267921,-865365,19936762,-9790371,26913564,-2585884,28495650,9879251},{32175335,-14618157,12915077,6228480,-27438135,-6678031,-3484905,15699331,21463039,-11319213},{1,0,0,0,0,0,0,0,0,0},{29177567,6048815,-15919941,5136004,-7744134,-5672961,-7111962,-14209839,-12876230,-283541}},
+        {{-27062902,12516699,-14582303,11394502,-15550720,14958526,-19011790,5850974,-360586,-4295580},{-23040081,11783513,26790233,12798648,27523711,-9346166,-9176108,-6160023,-29263540,11151712},{1,0,0,0,0,0,0,0,0,0},{15949768,-7324218,26109956,-13610015,-22601296,5703718,10301157,14963237,-16745578,-9386307}},
+        {{16313006,-14094354,24176755,8804512,-2965629,4505421,19816791,-10665456,-1624558,-3113102},{-2252714,3275591,29510827,15251659,30805810,13286858,17815980,-6049370,-10100183,7341735},{1,0,0,0,0,0,0,0,0,0},{-10055103,1773259,-10518920,-4795721,-32610590,-12335078,-29610063,-16593973,16172179,-2065382}},
+        {{3360491,-6543224,23383075,12295517,19256816,-3888042,11987040,7630117,-25114009,-3134152},{23490064,12038391,-18046913,-2103652,-25348136,10380524,28271029,2526399,29374759,-12366688},{1,0,0,0,0,0,0,0,0,0},{25018256,-8034926,7977063,-5294266,13115956,7522705,5823498,6803130,5023683,11437311}},
+        {{22551601,-8408300,19763460,-6776385,5320227,-6993498,-29026496,-11937332,-30441839,10512708},{-9412807,-12918512,12528931,4295384,11306633,6714854,-27689180,9329221,-28434848,-8474658},{1,0,0,0,0,0,0,0,0,0},{-23675432,307411,22646315,5155499,-10035667,14628871,-21825978,12623597,16143781,8328420}},
+        {{13841131,-11450649,18823552,-4096929,16651818,2501747,17206128,-11125611,-31129889,217533},{-15151835,6098224,-27442814,-11339237,-29845008,-2308446,27449718,-9692475,-12354493,-12729652},{1,0,0,0,0,0,0,0,0,0},{1001519,3046491,5383595,-6201844,1908555,12702636,25505267,3763621,-24738030,8038320}},
+        {{-9602817,-12448628,23586033,-10942721,32004214,-16247351,15454980,-8583486,17137591,-5830341},{11872420,-15837218,5957660,9358658,12748057,6503798,-3816108,-15238809,23784350,-9624638},{1,0,0,0,0,0,0,0,0,0},{-29698283,-12470473,17628608,-968072,-16285028,-4620417,-6097013,-10531307,22648757,-3143787}},
+        {{16449119,-9428487,-29345176,-14692751,2906948,7817186,21226339,5761922,5877151,-10411505},{-27014717,7803183,7210361,-10800817,-15818833,10280555,1370130,11714199,15258763,-15859308},{1,0,0,0,0,0,0,0,0,0},{16605768,-11079983,1763587,-16252828,-23892129,4576808,16534960,14295082,-1064652,10509140}},
+        {{-6250221,16388151,-3070521,16103697,-6296147,-12755750,-7083473,-5600629,-20467751,9540912},{-12156656,12456054,-26821829,-16014378,-16716257,-4787953,-2698952,-1634756,-9971395,-14527191},{1,0,0,0,0,0,0,0,0,0},{30202271,10945516,17650053,13259634,11847093,6553916,30843132,-8270301,-20549132,-2765192}},
+        {{15196709,-11667986,-8415377,-3291255,5977174,-12060023,14632093,4693184,26157581,7025119},{-22788347,15241701,-31460524,14963027,-367763,2077714,20379383,11791136,5927802,15604514},{1,0,0,0,0,0,0,0,0,0},{30480429,1913256,-31276308,-15965374,24402843,958271,-18689894,-12147228,-3757238,10803357}},
+        {{7136986,8921993,-15833002,-9630942,-1671729,1537404,31713483,-8024731,-20818370,-1441058},{19684263,11677929,-22911781,1224024,-1251236,7853191,-32926425,-1756626,15313491,-6785543},{1,0,0,0,0,0,0,0,0,0},{892347,-11747492,25446491,16619088,-32476578,11278949,7468289,-11550263,-7948201,8798948}},
+        {{-19532097,-10637303,-16500319,16340561,27252461,-6879072,124517,-7142658,17036036,11759205},{-14310720,-6948520,-18558886,15489099,2390654,-12680377,-25878876,-2475437,-14083128,15287459},{1,0,0,0,0,0,0,0,0,0},{-29487637,11973371,26351919,12402279,4618115,12332285,8274258,-13245095,5606677,4392216}},
+        {{-30726797,5579975,-10112526,-6031678,-15582851,-7993329,-15313682,449592,-28041567,-16132695},{-24887968,10980550,9870534,16149075,-22417075,11742584,-27204420,-15070429,-16703612,15279230},{1,0,0,0,0,0,0,0,0,0},{20936995,-14158908,19261923,-4384368,12624782,-2879728,5840027,-9391777,-13370425,15062293}},
+        {{17060540,16716502,30475954,-9781455,-8542331,-1836196,-30102093,16308829,31978225,-9330893},{11615256,-4308998,-18007095,4295917,-3616584,-9604555,-6270199,13585629,-31743113,7259928},{1,0,0,0,0,0,0,0,0,0},{18838994,15752218,2585325,-13312807,-23722707,-11406874,175083,-7619843,8457231,-11417992}},
+        {{-16573398,1341789,21408996,1772703,-30101082,-10928915,8320925,570629,-5070727,-8387884},{-24501006,-1150861,9949270,10705829,-22689855,-4677476,-4989516,2498811,-11014313,-13655275},{1,0,0,0,0,0,0,0,0,0},{-26739913,12999666,-31087640,4031253,6483642,2850247,-9023374,2404698,-3779814,6009435}},
+        {{-12704487,-5922273,-3362203,7917707,26452851,-9582390,22609676,14104905,26651835,8970977},{33230608,4436599,-2257113,-7131217,-20723652,3452977,7780746,12443657,28287975,-9883260},{1,0,0,0,0,0,0,0,0,0},{-31253813,-4832717,6413220,-7577163,-17483275,15048177,-14950563,7370067,33411752,7619423}},
+        {{-23015091,4938474,-29011818,-6899843,-30879978,16013089,1675499,-6121197,33514885,-15045619},{16145913,-7444650,-19799634,12546560,6961863,11577804,17622929,-8952900,-21525213,11400918},{1,0,0,0,0,0,0,0,0,0},{-31691059,3217101,601232,1260631,9783955,16316541,20295932,-9795660,-1707236,-8498419}},
+        {{18647804,-15254444,-23222012,6684589,-23802095,-16674140,3818054,14538457,32019659,14472251},{-31295070,-4116850,-30037777,6535793,12632597,14304557,2651298,4812542,18318000,-667567},{1,0,0,0,0,0,0,0,0,0},{-30010790,-5396796,9440611,9527574,28456913,10424246,5263896,3791977,26946280,11028329}},
+        {{-3576923,-11496850,-22275018,2603834,7486761,-16217143,-17027772,427353,7972704,-15799083},{19169467,-521164,-28851606,-77165,791330,-10321759,11386488,11587133,14767982,-3868603},{1,0,0,0,0,0,0,0,0,0},{-13472116,-4446857,-29177018,-13790609,-3276717,14844557,19450392,-11952862,21768065,6415960}},
+        {{-28306551,7220562,-362058,16446510,-1683198,-4919746,13807640,14214349,23584774,3857944},{-7391695,-7687528,-30169648,1611434,-7552867,15950229,-25137779,5858256,25720366,3171770},{1,0,0,0,0,0,0,0,0,0},{-19389592,-12011732,-1465518,12628410,-33037938,-14589763,24607934,-4958346,5871318,12180363}},
+        {{-19616824,15015457,-27166444,-12616091,-5524203,3596231,-5962343,-1071179,2047540,-10255788},{-31347995,7672479,-14233718,6289787,-8978581,6933827,-22767523,-11181708,-15340258,7943979},{1,0,0,0,0,0,0,0,0,0},{19100879,11760929,13158003,-1499744,-12881522,-1188250,-10491162,-4846988,17161009,-16080188}},
+        {{-20840756,-1298639,26238245,-5898360,-14322724,-14306944,-28559645,3405331,7401925,-9365571},{-22519994,-7704627,-12028329,1144552,-11391867,-8156651,-25472049,-2895845,21666907,-15955049},{1,0,0,0,0,0,0,0,0,0},{3571917,-13461040,28862766,8048455,-7454982,2254911,-33266246,-850081,-19672138,11730005}},
+        {{9852489,-11616305,-30977090,101831,8889730,-11870002,10366982,-8260725,-30339575,14477218},{-30962237,1538808,-20560037,-10647325,-20808977,-13398681,-3855667,-1571553,23747165,-10584199},{1,0,0,0,0,0,0,0,0,0},{30483230,5488507,-16416999,-11788996,-23638616,-8576393,-28088604,-6044544,-5785674,591718}},
+        {{-18728883,9804960,10331969,10993788,-2038992,12153640,1409696,-13092107,-25636308,-2796615},{24546646,-9173486,-13892949,-394002,-17148208,-3587900,-25011946,-15097725,4889051,-10428751},{1,0,0,0,0,0,0,0,0,0},{26903823,-5233575,-13375897,13102239,6775555,6823929,17229055,13052526,32558265,-5885445}},
+        {{-21941812,5648828,-28238733,-8758220,-21359776,4535337,-16369579,6079910,29416417,-13054064},{17443666,-1900255,-29387209,8657481,23154262,-12144387,-26585616,-3212961,-28212965,11026177},{1,0,0,0,0,0,0,0,0,0},{-6981144,8105587,-10792858,-14049620,-12836506,1769795,-22501272,12232589,19443958,10230823}},
+        {{15829598,441093,-9162167,-3591909,-32856076,6545001,-9513500,6681459,-1245558,14919944},{2264122,-16156618,5884622,2912340,10140921,2813006,-32654517,-3148568,-21740809,-86926},{1,0,0,0,0,0,0,0,0,0},{19373933,2419984,30467962,-6658038,-33247849,8070010,17210936,-14954210,-12306874,-15418452}},
+        {{13904111,4404172,24265370,-169481,4850789,1077176,-25416930,15937236,2414065,11411270},{31373737,-12763627,27021368,751852,-11800632,-11418700,-20556129,1280149,-20186477,10830104},{1,0,0,0,0,0,0,0,0,0},{13733108,-8883393,-24682794,8598913,7683345,-5184912,-25389103,-14337028,-4314895,-16101488}},
+        {{-5363507,-6895426,-7266275,13985696,27456953,2475880,17377044,-6174964,23056311,14400825},{15520761,-11958463,13786995,-5717598,-21593146,-4626423,29110529,9708445,1364844,-11068393},{1,0,0,0,0,0,0,0,0,0},{18851069,-14378048,17143441,-1437944,-32458565,14460015,15452557,-6541375,9413996,13540498}},
+        {{31524574,584237,-12286150,6382609,-9251054,2516895,28062435,15818208,24100510,13310647},{-946255,9761100,30068306,-11403177,24520453,-9888350,21551339,4944900,-15842675,11544161},{1,0,0,0,0,0,0,0,0,0},{27035767,9814471,-15605552,-622108,4811316,-16154451,-2205789,4482181,-4358860,-9599963}},
+        {{13238446,-9873194,-11576295,-13241407,11351842,9043828,22233941,-5025543,14940802,3678461},{19599220,-7095100,-18684545,1352958,9033840,-7870669,26874842,-10792497,-6545787,-11747486},{1,0,0,0,0,0,0,0,0,0},{239250,3656105,-3365721,4121711,32159173,-6530902,-21017329,15674735,24998884,13457866}},
+        {{5955987,9331962,-1794986,-1705089,6955278,-486767,24852908,2779827,29169007,-4230308},{9420502,13203693,-1175752,-11909878,-3370197,10334886,23392930,7772905,23076383,-14918101},{1,0,0,0,0,0,0,0,0,0},{-3979784,-6427374,29813700,15138146,-10219849,-15659403,-11792289,-2479619,26327434,6650140}},
+        {{13563573,-14491644,25492439,-2392701,3284441,16326150,29193327,8416581,24712878,15228624},{27773639,-6422608,14989721,2639497,-10489723,-9013838,19286968,-4036042,-8461196,-2247614},{1,0,0,0,0,0,0,0,0,0},{-32389302,-1398234,-23968145,-4433414,6050194,-9788065,689679,3475666,-24889665,10060180}},
+        {{13513290,13173040,32549937,3988239,-4787449,-9276245,4919878,14697520,4420964,-13053800},{-5079933,8168166,3515535,15126159,28764832,15042709,14266782,8166295,-13831355,-5264745},{1,0,0,0,0,0,0,0,0,0},{-24054694,-12474491,-8126655,9259220,-5052417,-389533,-11036839,-10378956,18682811,-5127424}},
+        {{27896417,-6988945,-33278782,-1725551,3586580,1791585,-12454797,4472486,29849042,-2393336},{-25051966,-9890837,11071887,-5958169,24876653,13552193,-14823245,2400177,-32854222,-14477462},{1,0,0,0,0,0,0,0,0,0},{19919988,-5244274,10307750,-12388612,9035131,12287028,14859462,-13924307,-17814698,3364623}},
+        {{-6599665,9553837,31645868,16696586,15396102,-1898643,21247151,-13853839,-20472254,-14720457},{-32087781,8952180,8459102,-14547920,29341570,-8505434,20352212,-7914464,322424,8264253},{1,0,0,0,0,0,0,0,0,0},{21110166,10968028,-16195190,5257584,31519427,-4841172,15588038,-15163338,-8454625,-12505257}},
+        {{-2453310,-270,29091635,16222964,2091459,-7953477,6213076,14223990,3812398,-3576885},{-31917793,1620045,15045359,3412820,13960419,16410563,13275056,-5045368,-27292772,11245773},{1,0,0,0,0,0,0,0,0,0},{90728,-8650299,-28964054,13979371,-9700082,-5121182,28060935,-11370101,10882865,-7023195}},
+        {{-16748942,2402599,-29552538,12848038,-22403227,1892347,32406735,-3763811,18452905,10557277},{5904861,1218762,-25773111,7005979,-14447574,-15054049,18608919,9248608,-20175889,6606813},{1,0,0,0,0,0,0,0,0,0},{-14985625,-16509816,27002661,1991421,14353829,4501474,-22739737,-2266157,28315475,-15744382}},
+        {{-20037783,13011549,7813147,-6870158,1561622,12014761,-11093095,170160,18187599,9664578},{1296410,2794462,22898445,-6629977,19141186,14863029,15620138,-12447333,23678781,-4374282},{1,0,0,0,0,0,0,0,0,0},{-1185918,3110794,-18987739,3134086,-27344611,8656304,11581843,-8049789,20503270,-1390566}},
+        {{-28509311,15998102,-18707192,-10081569,18253623,-1692193,-18098615,-10026586,11550551,11607966},{18674338,6976222,-5012370,-14641041,24285812,-12298295,-6333615,-9706562,-32750099,-1184866},{1,0,0,0,0,0,0,0,0,0},{-14634271,-12888288,-32929853,-11018650,33017212,-4374606,-22272435,10124191,-20822518,4826250}},
+        {{-764735,-12601499,5190234,10107732,-6908723,4633163,26939642,8483901,-9266543,9102634},{-2676473,15463351,1145212,6442058,19082962,10658680,-12564920,10066152,-13871834,10517698},{1,0,0,0,0,0,0,0,0,0},{17528565,-11285946,-17293138,1955123,14191452,10212401,14556318,-15060888,-29456669,1545800}},
+        {{-19117545,-9737283,11381242,7846246,20081719,-15615381,22222645,14963389,-8314603,-8361121},{-29495164,-2367177,-26482062,12386247,-30950045,15381262,-12288944,-4312463,22309722,175783},{1,0,0,0,0,0,0,0,0,0},{14246173,-1606454,26204699,-5028888,-2621036,-11598497,14694053,-13454756,4913,15859359}},
+        {{-11172220,-5310381,21282920,11872534,22607971,8315930,27593308,-11843415,-32376879,5946649},{-18432870,-4934071,-20993485,-9812177,-13056766,-4924212,10154402,-212139,10547195,9699849},{1,0,0,0,0,0,0,0,0,0},{18654301,-4227332,8899489,13937521,5192845,-3389153,-23431021,-13692749,22228680,-7614653}},
+        {{18468802,16663186,-18043901,8261071,-5404403,-2545942,12435045,-5153890,20495609,12435094},{-27311158,-6570549,-17953307,-7059144,-9490849,7718353,18508748,14186040,15724602,14304078},{1,0,0,0,0,0,0,0,0,0},{28347428,-13998620,31166540,-12507651,-33184057,-4379151,-25383030,-943355,27555654,9590428}},
+        {{-5955853,-6840459,-6694728,10579090,16986495,14333654,23219133,16694740,5605847,14075191},{-12336905,-9617672,-27793275,16606484,-4173094,12687084,30243150,-15686097,9721237,-4490883},{1,0,0,0,0,0,0,0,0,0},{3581518,-9903968,1207988,6054874,-2108571,-16451791,-432289,15224148,-12957199,-2057979}},
+        {{-18421428,6712671,-20512470,-13327450,29099294,-4130947,32945133,-6997961,-29177627,4279915},{27195808,14741646,30281487,-1704056,-9623122,-11595735,-27356412,-14802420,-33496958,10738082},{1,0,0,0,0,0,0,0,0,0},{-13612233,505116,24269403,-3249842,-29058645,-9673323,30995820,555442,-6841729,-3889969}},
+        {{-16990644,-12362346,25284284,-623361,25610399,11398544,-28725449,-1072791,-19144730,-68286},{-18883940,-2381047,13283847,-12902734,-17300760,-5171470,-23374387,1547200,19223736,16579616},{1,0,0,0,0,0,0,0,0,0},{-32628889,-1149583,-4776586,-13850561,-5904482,999274,18016747,15426841,22918440,-15425290}},
+        {{-12404791,-8043858,-26179250,9607229,-13093573,-1193822,-27780120,-8297022,15122140,-8253333},{3546955,7489291,-7733226,-322979,-14131654,16647444,-20878417,-3982738,24042954,-9743868},{1,0,0,0,0,0,0,0,0,0},{605216,-3392388,4649234,10334307,14861662,-1802346,11579247,1165218,26506017,-14720691}},
+        {{-2657329,15286652,4147091,1805881,31980967,9475759,-10541318,4807112,-30745327,-15608546},{3356741,10527732,6417392,13040551,16587464,-15169863,27701807,8300627,11346609,-16333461},{1,0,0,0,0,0,0,0,0,0},{-1673810,7226616,19457070,9329005,18826566,-419305,-362006,-5680701,32047530,9446761}},
+        {{-12013493,-2554101,9583848,-16597745,19968204,13450525,-22271264,-2918554,-15076605,5273563},{-19628879,-4001036,-6687861,7974359,21952595,5043794,13535727,8277956,-5390925,3689893},{1,0,0,0,0,0,0,0,0,0},{-24441120,-9529086,-4846635,-4976489,-9544238,8117189,21022248,3178022,-25065065,-16412172}},
+        {{-1348701,-2837425,16611256,-7658758,5697220,-10022340,32601868,-1263599,24299576,15366056},{-22405305,4200067,6913061,-8276426,-22919181,7064082,4766456,294827,-7375398,-5639523},{1,0,0,0,0,0,0,0,0,0},{13887689,11555748,3011874,-12854025,-16398380,-8549372,-449682,16187012,18704489,9490274}},
+        {{22883966,9896234,10904928,15869684,-29688266,-5255255,-28856193,-6770337,769195,11566424},{-27433984,-10710015,-23724993,12639878,-4360310,4019696,-30784608,4497929,603474,-10071386},{1,0,0,0,0,0,0,0,0,0},{30953259,-3109111,7051103,-3961137,-28757836,-3920638,-18025129,3660360,-2377430,-3006071}},
+        {{28095733,-7596968,-13492450,12313217,-21256081,15900334,-15855020,-15531685,-29394254,-3055629},{-6318650,16007926,-19623210,-8567637,-14950030,-9315350,-13906583,-14257755,10077199,-8433004},{1,0,0,0,0,0,0,0,0,0},{12670180,7415690,8016703,-8842975,-727366,-8154172,-17975722,-4792346,-15878094,-9654632}},
+        {{-32929738,-14433299,-10894689,6203935,-19244165,755937,-22492716,3074179,32122725,-3339095},{-21271282,9851057,-12982816,10745474,-32944692,-5323283,-32728707,-869699,-27959718,3341567},{1,0,0,0,0,0,0,0,0,0},{-6305424,-14079891,4559916,-6827512,4978187,-9701276,3427912,1859869,3113757,-10598272}},
+        {{21621951,5506402,-31297363,-2856216,10858726,964609,19234498,15174268,30473313,-2581077},{21754143,-1584915,5380652,3726248,17946141,-8078954,-23109423,-6963012,20135539,-13465528},{1,0,0,0,0,0,0,0,0,0},{-22326055,-13485271,33147688,130194,-31668170,-3874673,-31912044,-3230868,-8663223,7842259}},
+        {{-12806603,6698040,-14247073,12192982,-15494957,11853162,-3886654,-9449841,-14618810,-6871256},{15975692,-14365376,30025754,6417632,30874939,13914513,-22342936,-6803985,7013949,11453171},{1,0,0,0,0,0,0,0,0,0},{-21704329,-10539334,31221175,-16530629,-32530975,-16087106,-1507384,15906097,27249106,3688492}},
+        {{25212290,-14144203,-24304066,4336060,27049798,14696730,-24052845,2673057,32956997,-14645050},{7899160,15021302,4544208,-3932460,7919941,-7228764,-31175008,5886654,-15304713,15123663},{1,0,0,0,0,0,0,0,0,0},{1752926,-8460418,29365451,-14149674,324101,-9713842,-32635708,-11644449,17189334,9061430}},
+        {{-11989692,-7632506,-1186123,12239189,28919146,15188761,8237776,6023998,-10075283,11448971},{-1314008,-4328184,26254210,2191434,-23387681,15386157,12160497,-7209181,8051935,4351893},{1,0,0,0,0,0,0,0,0,0},{-7660690,-7995440,-31245747,-14135501,3636963,-13544533,28766192,10242453,30505943,7248041}},
+        {{1588573,9973517,-22014718,-1438109,-16975564,1909599,-27821021,-9255403,-11795862,1666426},{29917553,-8100101,8023136,-14161524,-3891044,-8703927,12217625,-3863932,29114545,6061711},{1,0,0,0,0,0,0,0,0,0},{25056424,-9436975,-5813393,-1393756,-1247197,-9391269,-30384296,-12125944,-15891262,-7539898}},
+        {{13679676,3443845,17953682,4902885,1466917,5030685,-15695998,-9860478,-11119277,266643},{22867351,-7469029,-2167874,3431551,5622393,12130778,-30270115,-10998264,20470863,-14972635},{1,0,0,0,0,0,0,0,0,0},{17434872,-9339558,31183082,4700960,-2430859,-9019955,24194410,-9937026,-1773980,14077805}},
+        {{-27380219,7908815,17945641,-4625097,-24032105,-15555713,-10570222,-3224337,-641666,-1901655},{-9711213,1903817,-7898868,6598892,-1251949,15132396,-29202929,8086036,4240748,-14316931},{1,0,0,0,0,0,0,0,0,0},{-29437719,-5700720,30458728,9105767,1793662,-3398699,-14290805,-9199989,667688,-6620723}},
+        {{-11236718,-9236389,-30340806,-2288460,-5466160,14800371,-3644928,-13765031,-11398247,-11629089},{13365481,11903496,10253860,-5814782,-19804232,14298816,-23787631,-2400827,8263680,-3323113},{1,0,0,0,0,0,0,0,0,0},{-27134679,-8642625,18554461,-5275607,23400261,-15948634,19283966,-3563586,-8148229,10947540}},
+        {{22695689,3081211,9900018,3574965,-26535179,11931775,-4030266,-13908788,-10245577,11220661},{20650455,-10164862,9975448,-13613060,14871267,-16682607,-29078494,8640590,12335422,8980528},{1,0,0,0,0,0,0,0,0,0},{-16943001,-7476883,-1216544,-12856073,15495306,-3162413,22438075,-11981038,-4850267,-12605767}},
+        {{-9145736,-717858,18496357,7089061,-18187834,-5873524,-10978131,-9842006,-8271473,10651794},{33260042,7379388,-7092491,-8484711,-31164385,-4323316,4573235,4875360,-14247499,11297414},{1,0,0,0,0,0,0,0,0,0},{-4274922,-4936897,21985573,1865790,-27477821,-1672674,30186130,11384827,-31747938,-5788259}},
+        {{1034895,-15172286,19981689,-10365394,1458623,-14328799,-33043532,6969013,-24711138,-2713730},{-16908658,14849831,-5512682,-9980203,12955592,12312364,-25183985,-5089327,27358083,4995181},{1,0,0,0,0,0,0,0,0,0},{-27350911,-7071685,-28396718,9679538,21357712,1613238,-28310878,-2256664,-10837852,-13268097}},
+        {{30577477,15425672,-31546702,13608987,-464831,-9290262,-17102167,921367,13853529,-8376648},{-27216236,-15300713,1491196,-6297426,20389535,9381369,15938995,10878357,11977919,7948588},{1,0,0,0,0,0,0,0,0,0},{-8892698,2274028,11785899,-11698572,1620070,1572045,29816868,12835800,-16040463,-4230385}},
+        {{18167127,5981614,-6360074,-3249730,14577312,15939446,-23225830,-8502169,16888560,16143060},{-10742799,12528525,-125142,7774050,7591646,8268749,-10552423,-13479578,-18867331,4601130},{1,0,0,0,0,0,0,0,0,0},{956187,-16704028,-10885744,-12274076,-31091015,-1541186,-1035925,-1775161,28459428,16694365}},
+        {{5569954,293965,8354989,-6078071,2240091,-11267636,-11889501,1354818,-30345225,12697782},{-5778864,4109454,-149357,6379862,-27803503,11176453,-11933813,11997529,19262660,-10283194},{1,0,0,0,0,0,0,0,0,0},{12593121,-11188807,-27951616,13626247,-8518826,11224913,-30011956,-13453907,4514693,-2029436}},
+        {{28844922,13021272,13756043,10673660,24910802,5111710,17641418,8089657,18105533,-3651882},{24010557,14269243,19878511,-15078320,31699642,16156302,29029967,-4230574,-28549413,-11598707},{1,0,0,0,0,0,0,0,0,0},{-20012296,-6483054,-3888002,1480569,14560223,-705207,-31407473,-4678893,-11071068,1093636}},
+        {{24628050,1240307,11815610,2213941,16114241,13440791,15570444,15541348,24470554,-14743144},{-2393267,6345959,5664166,10872887,-11211206,-4628446,26559095,-15117752,26312633,-3507732},{1,0,0,0,0,0,0,0,0,0},{-20248326,-5415218,3631152,6201998,-13374377,8192182,-9203771,-15805669,12669283,767095}},
+        {{-6858326,13713293,-31802659,6437070,-12994898,1008460,2140235,646448,26730571,7718972},{600785,16623302,24974877,13227767,15520407,13687709,26427411,11808019,-5645083,-13978092},{1,0,0,0,0,0,0,0,0,0},{-15205397,-5119035,25800957,-15887399,19318910,-8144229,-9986281,12558129,-4542687,-3679568}},
+        {{23573265,11530485,4433960,1813367,14314451,10505178,-16655233,4427535,27850921,-10522153},{28165594,-10905057,19129946,-15976231,-27379940,-1754601,15071703,-3439189,-18881780,4621029},{1,0,0,0,0,0,0,0,0,0},{32907412,-2727820,-10032791,-14338121,5997941,-10450859,2845257,-8811890,-29370311,-3710980}},
+        {{-21585944,-13379820,11152298,-9830852,24958019,3368164,-9120419,-3543147,-29730673,8403091},{-11826646,1698825,-12869754,11282019,-11258652,-8788093,-31314284,-2386692,24466860,910800},{1,0,0,0,0,0,0,0,0,0},{-13211917,2011696,-24622773,-8301749,19029280,13166587,5778497,-7479931,-13082735,-13281819}},
+        {{-18153539,-2449303,22629504,-6619650,-15738725,12865112,1736851,-3427276,-23760818,3447024},{26297161,-5656890,13359195,-216849,27320789,12094748,-31993904,-5357173,16156824,6600079},{1,0,0,0,0,0,0,0,0,0},{25685649,5173934,-13315058,7398800,-28029383,7553470,-13533306,10429655,14033947,-12319643}},
+        {{17831462,16703998,-23445415,-933676,-24821267,2579019,-9003184,8406615,-1305410,6336315},{-14301474,-12290790,28927372,8848832,31403988,15039914,-8175895,13408241,15586550,8135521},{1,0,0,0,0,0,0,0,0,0},{5061228,-4283887,13238690,-15703855,-17633205,2041618,-23036212,16219317,17354773,9912747}},
+        {{-18082725,2306280,-14970883,-906117,-10977458,-9654873,-19938008,-9400908,22261539,16107282},{16209038,-12948429,-19169795,-4634494,29231886,1530455,12566372,-2118806,2318041,14338858},{1,0,0,0,0,0,0,0,0,0},{12729305,-12743,739441,-16558927,21014262,-16645298,-21232652,-16747297,-5675307,10460777}},
+        {{-11941949,5784499,-130773,-10967909,-29175425,-8354011,-24634312,-5096275,-31090820,-16223470},{8983362,-6714585,29044515,9118548,-741496,5291896,6286809,-7988738,-4207749,-11917445},{1,0,0,0,0,0,0,0,0,0},{25842826,-11676114,-30299837,-1750829,1804940,5472758,-14101611,3149486,12826407,8582508}},
+        {{24207188,-9807228,25438658,-12458345,28149447,12721536,-4779612,-1757041,28472483,7619919},{-27575598,4381955,-3152421,-10365173,-24091180,-12120463,32443524,15826762,-14781114,7080956},{1,0,0,0,0,0,0,0,0,0},{-26415117,15203805,-31120020,10251762,-8126492,-14314337,-22182550,6715537,-19900597,-7882259}},
+        {{-27567145,-9790427,-4749400,6732860,-20078706,9762736,-1954272,10310997,3634344,5410830},{-8272025,-11348163,-29047491,6057305,18694346,-13805297,21886532,3953811,-23944864,-5420707},{1,0,0,0,0,0,0,0,0,0},{-23356217,-101767,32086725,-16366662,10333002,16045712,2317799,1799983,20076339,15796353}},
+        {{25499991,-6348801,-9056123,-8852979,-33348437,-13161851,-13510623,2580726,-4689124,-3907079},{-15857755,-13003781,15920589,-14384546,2775515,-4329588,-6589735,12792945,-17401555,3828000},{1,0,0,0,0,0,0,0,0,0},{-5638086,-4610131,283982,14518344,-25664083,15674556,-3193094,9063075,12569617,14528449}},
+        {{12615816,-12559969,24589738,16673823,-32218599,-13292929,6526458,12287564,33329281,13218427},{-15294291,-11020669,1860228,-16011016,-24426297,-4464314,22021297,-1736962,-21886951,-13433701},{1,0,0,0,0,0,0,0,0,0},{19573258,-16402702,-28311152,16649901,15544491,6220364,-29185481,6287219,28309161,-14406539}},
+        {{7206564,-8965434,-26863245,-13048401,12552156,2657844,10965668,-14319824,-9349831,1788734},{-2726347,-10761259,-29476701,-5567634,-14837278,-6559959,30307511,9074460,-13375460,10384350},{1,0,0,0,0,0,0,0,0,0},{-28381655,-270602,-287459,14892102,-23307268,-13554021,3301479,-12590971,-20614621,2246314}},
+        {{-23011767,10448691,21147849,11660730,-25898454,-13823550,-17158160,7379426,21716940,-14494014},{-5046849,11469316,27731247,-1248310,-26959779,16736120,-14689680,-14196337,10789758,-16600441},{1,0,0,0,0,0,0,0,0,0},{-9776065,-3337634,-11771238,-6387520,25532686,-14670941,-9061864,6946249,-16907639,-9832405}},
+        {{30297069,-4017842,-6753251,15456736,-23951241,-13351514,-19573861,9200615,-27730413,10110973},{21003475,-15410322,4636875,13260680,930338,-9532296,33301881,-1567021,-9719756,5870235},{1,0,0,0,0,0,0,0,0,0},{-16311452,-12340119,24843659,-14125661,-982379,14427724,-29809328,2049524,21917906,205484}},
+        {{2273532,-10470939,30526104,7428116,7561094,-1428782,-27817155,2278342,-7155989,-5069439},{-15577922,15132066,-20815231,-3566193,9104583,3294865,14643931,-2380550,-11243684,-1330348},{1,0,0,0,0,0,0,0,0,0},{7768356,-4707315,22920484,2583930,792445,9551933,29183838,-1741228,-10603883,-10638243}},
+        {{11238513,-6386564,-20428708,-16174730,6310147,-9334102,-16740973,3649102,-11716991,-11636666},{-27943006,5711041,-22874138,1551028,18530117,7791915,14028481,10385271,-30197462,-9020147},{1,0,0,0,0,0,0,0,0,0},{30896982,7944341,14013356,-1049370,27322959,15338937,22075969,-14923089,-31276256,14245440}},
+        {{31885092,16139406,-21482554,-12530087,28748892,-10718615,25803095,-9044720,9741637,12357195},{26940624,13484659,-14818260,-15817391,29662293,-7262917,914354,-3372872,14155819,11764632},{1,0,0,0,0,0,0,0,0,0},{-21678220,-13340258,24271964,-4579911,-5926839,2209777,-18541767,2815626,-8766089,-13761557}},
+        {{23212632,2425578,11209782,-1965525,-12531687,13630754,-1059209,9931173,23398858,12606106},{14457809,9593562,-21711505,10807048,10867693,8264277,-23779727,-1805369,-13426362,-3536806},{1,0,0,0,0,0,0,0,0,0},{-1524803,-14457774,-17742338,14089836,12653060,12955980,-16815704,7806281,27598845,-6123565}},
+        {{2323321,-7374915,-14665102,8552152,14448709,1365021,-20935576,-14482725,26260150,-14389270},{28411862,9063240,15414834,11069538,17392829,-9404553,29011175,8647671,-10309926,-11269824},{1,0,0,0,0,0,0,0,0,0},{33246820,-9257180,-8552119,-6033952,-33231355,-3282005,-28481875,-6128626,9568758,-12383501}},
+        {{26129921,-6925563,29041031,-14065305,-29212303,-14338119,18208411,4969445,-6656326,14424693},{-29453047,2983150,25963359,11090906,4597844,-8640867,21263329,-1151812,33509171,1755405},{1,0,0,0,0,0,0,0,0,0},{-2871895,-11037901,12114669,-11532904,-21490157,-8911276,31230055,15906974,15252077,12663309}},
+        {{-21734525,-7712464,30114740,-11792177,-33207537,-14147914,-31255547,129891,32885419,-2090152},{14484574,11554584,-32825223,15715760,9755979,-125141,3137377,-3975613,12326435,7874966},{1,0,0,0,0,0,0,0,0,0},{31829202,14190571,17808490,1334780,16585656,9571089,16411818,2673589,17250340,-12968083}},
+        {{-7010066,-16740676,16647483,4126359,-30189554,-621854,-4238167,-9520421,-14014843,13165696},{-19933938,-16086222,-9367114,5081709,15460621,-4075015,21860100,7177340,6039280,-8565538},{1,0,0,0,0,0,0,0,0,0},{964794,4439658,20232187,-8024732,3783283,-2912977,-21166810,14748118,30703375,-1372538}},
+        {{-6289248,-10860825,19746977,9178471,26222093,4309358,-15396462,-4366527,-1835813,-3680181},{8067763,-9879794,12191568,5769466,33233077,-15022292,22328453,-3406604,32595469,873081},{1,0,0,0,0,0,0,0,0,0},{324238,6929659,27802052,814656,13636642,-14181151,-18987220,8614778,20643705,-8670062}},
+        {{9353857,-3461304,25005756,-11992582,-7376289,9576885,29429375,-14150364,-14999083,6727604},{1898984,10036720,28352267,-10573783,-30691672,-10839979,-23666883,4360894,8515415,-13130897},{1,0,0,0,0,0,0,0,0,0},{3605124,-13204651,-27776140,8158711,-14029433,-16146382,23470770,8059521,8121754,-7441725}},
+        {{24709892,6926870,-25968373,9393023,-14794320,-6813887,-19376243,-1468609,4552312,3372624},{16308211,6390676,-14829681,-9487000,21828519,-13504265,-19027872,14658929,-18637685,9323766},{1,0,0,0,0,0,0,0,0,0},{-15739582,-13318836,19565877,-9079628,7746788,9767214,-2704917,1162790,12893940,11389921}},
+        {{23186949,-9043888,-32523979,-7007042,16659103,4947302,-16353745,-9524963,32195596,7265476},{5036163,10872794,-21495224,11715740,6169903,8768259,-2621724,-9872635,20991633,-9395626},{1,0,0,0,0,0,0,0,0,0},{22356520,11906268,15350845,9297057,31142494,-3791416,-15405259,-9151866,5519706,-15200349}},
+        {{-15924608,-2970387,-4511811,10812789,3008740,-9375003,-24311642,10137976,5115541,-2280892},{20827801,-15718770,-23947198,-8033940,24938741,-5972558,-9844622,2850152,21793940,-6998119},{1,0,0,0,0,0,0,0,0,0},{-4903130,13886850,30783764,-5347842,-32891642,6919321,-25171498,112718,-11711763,-7458850}},
+        {{10159274,-610618,17622855,-1756314,26867303,-8373577,9887982,-14953076,-1828073,-13319691},{-19439144,-2831135,4439408,6895095,-27026919,3910755,28409782,-11068729,-9124059,-2979766},{1,0,0,0,0,0,0,0,0,0},{-32966971,989356,-33232999,-16583541,-24886272,8803051,-17406584,6372240,27508281,-12545373}},
+        {{19564368,5370147,21225622,-2374876,-3821844,-11451477,20443085,7950496,1869549,-7243151},{-28670832,12085887,32485677,-4556132,-8414802,9714708,-21796277,13793625,25887510,-16694152},{1,0,0,0,0,0,0,0,0,0},{13917045,-14533148,27402648,-5197983,16948480,-12855130,-30704356,8277614,3347502,-10136529}},
+        {{-19978316,-806578,-6689289,-3666865,-8581196,-11922836,-32284571,-10042430,-226372,3846016},{13906175,6097198,14394804,-10110111,-11503707,3365787,-15664257,7439012,-31655196,-11278202},{1,0,0,0,0,0,0,0,0,0},{20185406,-13000031,22143422,1687896,9101445,-11650576,-20047718,-5277597,24845318,5311571}},
+        {{-18007836,15355604,-22955798,-1093066,-15593539,13479258,13927352,-3999362,17315318,-15440781},{-16037246,-15343272,-3727401,-16528428,21266518,-14068972,-26563244,7108250,-29581716,8657679},{1,0,0,0,0,0,0,0,0,0},{21476514,-11102628,-7704786,-7183197,-30533613,15572733,-17222744,-14061685,22152723,15151223}},
+        {{981265,-9345571,-29803459,660245,1389994,-16003442,31401470,8960065,25217519,-14715931},{28946428,12677704,12611153,11824802,-3166307,4637954,11061074,10004865,-25334279,80371},{1,0,0,0,0,0,0,0,0,0},{19766648,-12427816,9390192,-12032592,-1061226,-11403529,650489,13648023,-21059455,14244144}},
+        {{32033358,-7568818,27348062,-8494476,3162057,-5235954,12634199,5166733,-7384063,5678806},{16289505,11096012,32068157,15758379,-27703860,6823390,30292648,-6829535,26049009,-15860034},{1,0,0,0,0,0,0,0,0,0},{-12814440,5028822,7756159,16721140,7519641,844956,27091595,1846295,-20290414,-8073776}},
+        {{-29946541,13272133,2165700,-465164,-15286594,-2812905,-1180382,5056524,18069580,-7323857},{11324386,2576733,-22122876,-8238847,24455387,-9776486,-16344052,-5052948,-17558213,5702084},{1,0,0,0,0,0,0,0,0,0},{30582338,8209241,8124086,15231176,7336811,-11578131,10758650,-16616165,25979602,-11701035}},
+        {{-5955797,3290665,2560381,15510664,2738811,-12483565,-23861438,270049,-7225513,-568776},{-10019451,2184657,2863839,8671154,-9848617,505626,-4307137,3618964,12761469,14978207},{1,0,0,0,0,0,0,0,0,0},{-3229195,108444,-24786659,-2572494,15617130,-1548846,-18338638,-1091123,14320446,10664712}},
+        {{16115477,-143799,18493691,8365717,-20689673,-14794832,3393939,9802870,-6679214,13164039},{4119344,-14490881,25683986,5038713,4135667,7210155,11375865,4960791,18003006,-8878466},{1,0,0,0,0,0,0,0,0,0},{-4432028,11717486,28838128,-16169396,7772369,2237470,-15177037,2970725,-32266573,-7139573}},
+        {{-11010576,-7388403,23060702,14282019,6396498,-12448059,-32807286,3704762,-30776360,7797864},{-8971041,-604970,24462696,6683177,9472064,-7003026,31316436,15730838,-11121206,-13322006},{1,0,0,0,0,0,0,0,0,0},{24498232,-4368500,1097351,-1982977,-14216677,2873600,-9586773,-10694833,-3692535,-14465902}},
+        {{4487969,7699586,18440057,-12407692,-23599071,-1842819,21411502,6664588,32536282,7931033},{13391773,-4355997,-26843915,4275353,28679396,5246919,25955102,2779836,26121951,12325283},{1,0,0,0,0,0,0,0,0,0},{-30584344,-10578311,32695479,15453051,-16091716,8592773,29066862,-2977011,-11548547,4920284}},
+        {{9395605,-5552139,23328025,-15320090,-6168336,-4920497,-24272523,14055976,-24555708,-112314},{-19962579,5319839,15474867,-739934,-13594643,-4437836,3125627,-1925953,24504738,13648171},{1,0,0,0,0,0,0,0,0,0},{-1197158,5754096,-16687587,7779268,-19725823,-7041493,-2759155,-10103742,31347019,-2059271}},
+        {{21915679,-5465760,5100874,-8071307,-32162850,4751891,21577450,11208391,16349373,3492102},{12530228,-15312121,20170018,1290817,11385949,8842777,5400091,8306012,23763164,13647964},{1,0,0,0,0,0,0,0,0,0},{21413030,15784235,-30271595,10108283,-13885321,11060111,-31613181,-8103177,-7405056,-16146084}},
+        {{30339028,-11911259,-9736980,16761104,-17452699,3324960,-19988870,1642641,-20916351,-7529384},{-2424718,4894257,-25381504,-15029030,8284512,-7530232,12018617,-15472406,22507316,-2440411},{1,0,0,0,0,0,0,0,0,0},{-1352944,-14724691,-8666577,-12692443,-23146232,12397668,8320266,4285501,-18502421,-13262130}},
+        {{-6394442,7817183,-29345211,3413506,32965246,1654819,-23662371,1799743,-15022242,-5019895},{32498478,14966671,20373961,-4778293,-30644976,4188065,29908101,-11925526,28959218,12511333},{1,0,0,0,0,0,0,0,0,0},{-6719053,-12834873,-21422010,8314840,-10220740,8852898,-18271294,-14330063,33036728,4169022}},
+        {{19994487,-14877870,24416823,-8296129,23894516,10418672,865743,7922981,-30688333,4613743},{-28376141,-9624158,1497408,-10320690,11130121,-1797542,5482134,-3598565,-15887393,-7035631},{1,0,0,0,0,0,0,0,0,0},{-12416588,-3536904,-14471861,-12412176,32088568,4661828,8354578,-6818154,-3124430,13318351}},
+        {{30795102,-7773606,-6822856,-11708829,8310134,13705348,-12940526,8034384,-18303818,-1784347},{7424855,-11937350,22252433,-160806,-16047007,-12389096,5860939,5761597,16361882,1288641},{1,0,0,0,0,0,0,0,0,0},{12627939,3784910,16528223,-8810316,-12862522,5557707,3448091,3153137,3522518,4178618}},
+        {{-24309427,-7758678,1009745,8510057,-14269823,643577,18410740,9074704,32475867,-13359193},{-9547030,-517538,12205469,14906944,-24718319,-8673864,28740703,-750676,-32127446,-12174464},{1,0,0,0,0,0,0,0,0,0},{24884039,4075883,20971558,-12596082,7633635,-6104860,487401,5670791,9181537,10149272}},
+        {{-14300716,-2278145,-29584001,13515442,11633828,1445255,14626430,15231816,19607397,8463986},{32312650,15710961,24083803,15729146,28353471,-5027534,-25492441,-9137210,-27280313,-9255358},{1,0,0,0,0,0,0,0,0,0},{-27778431,-11118340,29551567,-9406792,-11595654,-1554610,-11336209,-11885835,9286406,-3507227}},
+        {{15324071,-13177909,21311094,-11690643,-24134181,-14838284,-11590771,13865371,10082561,15522020},{-17867461,10003061,31188231,-12495192,-12580664,-9864660,-16262389,-14421567,22214264,1338195},{1,0,0,0,0,0,0,0,0,0},{16650243,5031382,-22856013,2396788,-15413057,384802,-31538072,16672233,27317303,14685090}},
+        {{2687086,15253084,-30974005,11728357,1262296,-12772760,-19274764,3529233,29443339,-4486964},{-1459214,14992756,8940485,-7604268,21494513,-6874358,-12066489,6921331,-21212186,5389742},{1,0,0,0,0,0,0,0,0,0},{23316807,-385697,18544357,-14831332,33393459,-115276,11295616,-9415012,-28278082,159022}},
+        {{-11571429,1387626,-16187550,-6198653,20268063,-7729416,-7352431,14374778,26119766,13480452},{-1188600,1909149,-19142812,3719092,26047491,-168644,13906808,12693258,690857,9646494},{1,0,0,0,0,0,0,0,0,0},{10506947,-2251632,4413566,-1574041,30539230,-11427610,5378251,-16396965,-28629923,-974951}},
+        {{-24776553,1296272,2240045,11885395,22984670,-11423134,3107936,-7392769,-26885519,16543540},{20328967,1469491,-31211802,-9199391,10131856,-15477981,9266381,5201027,-1081820,-4225731},{1,0,0,0,0,0,0,0,0,0},{5786637,-12822604,-29433433,-5009808,13893382,7746917,-16520540,-10138552,19500269,445412}},
+        {{4198244,1235588,28674600,15379682,-18183282,-4736322,127126,12616218,24672790,-5854024},{-11060276,14744425,12474001,-8881574,26809387,2015096,-22588471,851989,11067265,8664850},{1,0,0,0,0,0,0,0,0,0},{12854197,-15502095,26793703,-8230691,-3134752,-3608794,-16383047,-14925847,24894037,-488497}},
+        {{-27033725,-10911532,32176329,-1024861,1126127,-3670599,26794877,-396344,-17962718,1168458},{-15940001,-12916653,-33097868,-7429739,14032584,10994073,25782959,4332621,30870049,-16256573},{1,0,0,0,0,0,0,0,0,0},{-22055871,-2249495,10843086,16083952,-25243613,-11463578,3691353,2222471,-25876543,-8373737}},
+        {{23750932,7423794,30055437,-12343634,-9956823,-13565916,31009307,-6476430,2008315,-4181444},{10864360,11171766,9113028,-1478632,28787969,8999447,-28703653,14980996,-26434744,-1496011},{1,0,0,0,0,0,0,0,0,0},{5263499,7975621,-22052821,-8380131,29939922,-7898936,30666584,-10306758,11061415,4411623}},
+        {{-22972172,11742681,12898272,-4764424,-32893818,-11545786,-27579584,-6797770,10856637,1145177},{20522822,1382889,-15971646,4159016,909230,-3143130,-17016258,12454167,11401677,853450},{1,0,0,0,0,0,0,0,0,0},{29568174,3239890,-381945,-2294502,10340196,-15991552,-10579517,-8244927,-8143714,-15579379}},
+        {{6507167,-3002891,10525431,-3509047,2164178,-12192486,-23705793,558942,14117096,9892897},{-26410788,-4263650,-27643148,-1334566,622588,1820497,32286720,-13948077,10320511,-5869545},{1,0,0,0,0,0,0,0,0,0},{28682500,2849238,24969221,16255838,11382409,8025276,-4739664,9472848,9148864,5436169}},
+        {{26185804,14815242,-29408839,7341935,28203048,15603323,1383926,-6578313,-29669187,10282029},{1370865,15076774,-11573480,4266714,-2336849,-3230124,-25052679,-1584095,-10614990,-13134492},{1,0,0,0,0,0,0,0,0,0},{21995139,-5054022,25529043,13036715,8879072,-5311721,17098483,-8757721,4803164,14876553}},
+        {{15570802,11049992,-8878212,-15670559,-31627014,4024096,-1445838,936447,-12961196,-9964011},{-3310475,8374604,10115796,-14570838,-18743735,15653909,16978088,-3682158,8255328,7024},{1,0,0,0,0,0,0,0,0,0},{30670277,2576554,-11780513,-14454149,24178698,9481037,-25928675,-14732992,-6910414,7867755}},
+        {{12140966,-4664562,-20112550,-470901,-29742466,-10913485,23208497,1644645,-12346548,-4609221},{-27400924,4652678,25503008,3076576,21093499,-3921969,13971666,12862700,-18967781,-8647603},{1,0,0,0,0,0,0,0,0,0},{-6793720,-1564216,29194630,10952561,-17974901,8771383,-32775038,-284276,18804821,3125519}},
+        {{-27279955,-13661811,33390069,7607440,30916974,-10765591,18966278,10292926,792033,1250158},{16076622,-13622331,20773319,2550030,5244152,-3634194,25839848,-1624858,27172349,-11487410},{1,0,0,0,0,0,0,0,0,0},{-21143989,-14258123,-28525879,3871262,-15633350,-7073159,-24943670,-10943530,11560143,2765354}},
+        {{14545664,4468370,-21596118,11737056,-19440866,16259319,-30472875,-3875227,-16371070,2342072},{17660671,-1265625,-29404127,-3597987,-18986637,-4459558,6351141,-500926,3552545,-6391304},{1,0,0,0,0,0,0,0,0,0},{9908535,-15682900,-19170562,-7345465,-22405873,-11456738,-31856510,-2804365,-3093062,12473470}},
+        {{-26824957,4386006,8847120,11386349,-33392626,15703571,24445002,-12035044,-16694362,13783400},{-21489174,-16019034,746372,14325917,-356970,-16517533,-14701988,-13854112,16274231,11955153},{1,0,0,0,0,0,0,0,0,0},{6987309,15144256,24747955,-10600124,-22362,3924094,3018680,10865374,1868955,-14133884}},
+        {{-19259282,-16076986,10482419,-3776373,-31142626,-734000,3185701,-9828307,-12069424,11155461},{-18311465,-6941104,13884897,4834421,7056234,13695745,20242833,10948601,-28672086,-16647129},{1,0,0,0,0,0,0,0,0,0},{-4802268,6044441,-17621133,-12341851,1056365,-15097259,-24509562,-4732388,30386173,-13268517}},
+        {{-19415889,-9621622,24179839,-3696044,-8296162,-2264108,-9314255,213969,9460067,-1620052},{-27650723,4746300,-1558073,-12404872,-10052348,-4627620,11039879,15275889,-29060426,5554696},{1,0,0,0,0,0,0,0,0,0},{5790733,2107965,3232637,10068438,-10989051,6148882,33214463,-9542135,17506708,4287494}},
+        {{-19278490,11017824,20646866,-3004627,-33521760,15031775,-3733127,8794447,-10170489,13158442},{19442728,-2985655,-16448290,16390306,22268009,11567183,24713950,14897010,-20552595,5762140},{1,0,0,0,0,0,0,0,0,0},{-7627600,-2864580,-12568877,-11811851,13620744,13346119,23713816,13003571,30708029,1631180}},
+        {{19806708,-6281740,-20633039,-16400631,-20167974,-12478406,-10412741,-12751435,15247091,7129553},{-15148898,-10437689,-6383928,-7324414,-3629352,15949371,3265133,16705967,9154807,8500033},{1,0,0,0,0,0,0,0,0,0},{19949603,-12951554,24629732,14404119,-3010346,-14957922,-27601509,6248720,26957092,-3345548}},
+        {{25381352,8178865,-27721921,-4587335,7696798,-402544,29153782,-14313710,6785083,-5983509},{-8908270,1623645,-25690278,-4324683,-26926630,-9808051,-2332045,16056352,-5072435,-6044029},{1,0,0,0,0,0,0,0,0,0},{-2204620,-3301169,6007095,5131762,16145731,12443668,32591928,-4839769,-7330506,-14508457}},
+        {{20113287,11885151,-19706585,5349219,8292112,3088701,21275737,-11451553,-5802185,1230197},{31376964,8878655,-10934662,-6142480,-24355438,10245223,-6960933,-11567044,8610661,11107471},{1,0,0,0,0,0,0,0,0,0},{20412849,-10414197,-22835272,-11050150,13925375,3716150,-21130524,15787167,3614480,15979130}},
+        {{-18719149,676033,22623408,-8724717,-17671472,7591646,29486387,-7679575,33539009,-4699058},{-27102933,-1688026,30580540,-15349049,29431945,-5624756,20709094,15246053,18737919,6463142},{1,0,0,0,0,0,0,0,0,0},{-15050631,14907592,30256907,12372766,7541384,9471734,12914959,5911770,19660829,-1005172}},
+        {{16931058,-6293786,28856100,13711115,14723976,-6068246,1817626,-4328510,14883330,5032057},{-12866419,-2697267,30293438,-2629365,-32265781,-14476718,-26338886,-10902010,-15080686,-10630816},{1,0,0,0,0,0,0,0,0,0},{-18948154,-796586,10363486,-8068618,24156709,-5797506,19652344,12358022,-29470246,6504267}},
+        {{-11908914,15432028,18743631,-4435122,-27955241,-1565640,8192972,-11365900,31469490,-16099949},{-27722884,-9670635,14558932,-16226561,31168376,13879044,-11601077,-6167413,15336898,10354800},{1,0,0,0,0,0,0,0,0,0},{31339216,11594986,-27200904,-8989698,19424199,1191991,10203428,-11348750,17331062,-8078626}},
+        {{16185846,-3870903,-30433226,-15709132,-18803362,5731459,6695950,-9416943,-20866886,-11599352},{-3206276,10616131,14296210,8468306,25290460,16413751,-23290270,-5713613,-24184742,-8395503},{1,0,0,0,0,0,0,0,0,0},{-29850220,9305726,921249,1910607,-28203661,2842009,24800133,-16156645,-7246943,1347875}},
+        {{25585711,-12674005,8112463,10261079,-22239283,7329927,12606539,5808657,13183284,-9931392},{279452,-11410095,-19148333,10767298,28487013,5238299,8232268,5543436,13050390,-3102810},{1,0,0,0,0,0,0,0,0,0},{-32848895,-12388271,-22824705,-16654681,24667055,-14482448,-2527722,177684,-5178187,-3647607}},
+        {{-1331478,-1276115,27097967,3539087,8140767,6714475,29250750,4451513,-23109620,2237612},{16187808,7967070,-5111452,-9790637,-10881854,-10414552,-18715927,-10741457,11902869,15034257},{1,0,0,0,0,0,0,0,0,0},{825125,-4170082,11618903,-9065284,1571413,8154195,-6126461,-70387,1084164,-9058122}},
+        {{24578934,4230621,-4828495,-7531634,-15325526,-6149459,-33166191,9674329,20781347,8714386},{32258135,12166366,-5333516,13013332,-22536532,16116164,27763170,14630825,21559927,-7061908},{1,0,0,0,0,0,0,0,0,0},{25949667,-11659608,-7190954,10011630,10216728,2058518,-13471884,3050542,-16200382,14130187}},
+        {{-16363915,15060639,29871830,12512664,13202885,-5822010,-17353132,14383088,9615695,-7240057},{-4891366,-9886858,-2403578,-2147595,14458235,3536232,-27761058,-16736810,-12796520,10244189},{1,0,0,0,0,0,0,0,0,0},{18438590,-7508667,-431551,-16146203,22229822,13423039,-1809470,2612226,13498492,-15370536}},
+        {{13094000,2591742,-26161206,-10471892,6144196,-6191243,33251868,-8445989,13236882,8982898},{765664,2052001,22624837,3271598,28303337,13305070,-10831742,-10662307,-28935575,-5120498},{1,0,0,0,0,0,0,0,0,0},{16564404,-15490994,-4590868,9940299,-9516041,14830750,-3209586,12040865,13686146,271362}},
+        {{-2121003,5064520,10601927,-1496331,-31958944,16462210,8295574,-2599185,1374410,-1664579},{-29298148,4782120,17018177,-16242155,-24542858,1779166,-809790,-2629046,3992315,4891351},{1,0,0,0,0,0,0,0,0,0},{4658554,-5497532,5821401,4842882,15249375,12031378,-78331,-6151791,12763418,10316397}},
+        {{-21253607,9937371,1542264,14820655,13422126,-14542409,-6146437,6584243,22234228,13737390},{-3352435,8994576,29016323,-7811451,-29003004,3080480,-5167025,-2609840,24371358,8546648},{1,0,0,0,0,0,0,0,0,0},{19405399,5084712,18195351,-15750018,23040846,-15697954,-25746241,13537637,-742037,-12148774}},
+        {{25805599,1123950,-29464596,-12553596,-13109916,2915614,-654545,165251,-8247460,-14287457},{1528432,8327924,15486876,-14800923,937958,-9207061,-27284254,-7910258,-26072837,-3643857},{1,0,0,0,0,0,0,0,0,0},{9667056,-11037517,-17285064,1504594,-13940077,-10220996,585675,11723726,2277515,792113}},
+        {{-23325948,11024612,18275030,44529,26909961,-6377988,26692171,4807892,-12100948,-1740441},{-13368366,13442165,5448990,11086892,32555438,-7339222,25004257,11651532,20520432,707596},{1,0,0,0,0,0,0,0,0,0},{-11025542,-7987030,28685528,8137470,12086972,3468354,-22507369,14761149,22903785,-4633297}},
+        {{20572070,-11298012,13028414,-3268243,-12216477,-15801597,-24623980,4375315,-5571233,-8926735},{31738404,9761476,-13508891,8093938,-27085350,-5243598,-2581615,-5330949,-14344911,10746228},{1,0,0,0,0,0,0,0,0,0},{-15144085,-4440427,-19950509,-5109626,15295646,12292177,16418729,14580241,7994522,5494957}},
+        {{26246185,15964741,-15852358,16575811,-4155689,-11596869,-19253068,-8960100,-18247527,-7334217},{-5332080,15038072,-17223930,7598322,-20960522,-9255499,10789985,-2345970,78474,16046951},{1,0,0,0,0,0,0,0,0,0},{22238440,-12350409,3118407,7680905,-29024030,-11752724,19956980,-14181805,-11439521,15797047}},
+        {{-10991932,-2993619,13546605,-4159670,-32697746,-9907759,24390407,-13640640,-23813299,-16071080},{9954653,5601822,14908429,-5894754,-19024143,-2386496,12455057,-8181813,27592443,-3781445},{1,0,0,0,0,0,0,0,0,0},{-33552043,15898297,218543,-9666531,-1263043,14713395,30844632,-16140567,-32530988,-7005950}},
+        {{-13463438,-570035,14104337,-9264408,12493491,701767,-18026193,-15893413,15291369,-5906949},{-17352299,9701523,-24608000,-10467278,-21738423,5878772,-13055030,8319828,-4051938,-15116709},{1,0,0,0,0,0,0,0,0,0},{5829781,-3096987,-3108423,1365502,20110678,-14422436,21568300,-198963,30697588,-685187}},
+        {{2460337,-201744,-3867629,-16044279,-6974012,-10445160,31905177,-10118804,31441917,14410636},{-27559674,-16524120,25532877,-5361864,19680928,-6584178,25633433,16615535,-10330759,3215470},{1,0,0,0,0,0,0,0,0,0},{15861329,-281504,33518950,12139436,4087247,12212369,-30676321,7508312,21280934,-15630135}},
+        {{7058601,12788684,16140509,-10428757,-7131245,-13066085,4976471,-347690,13467723,-7182215},{25303564,10042120,29300121,7606339,-27511495,7903005,11075192,10561564,4087122,-9690346},{1,0,0,0,0,0,0,0,0,0},{-5677633,12018960,11893707,14420293,711013,-7211587,26857630,5428833,-5583735,5966611}},
+        {{-19810318,28610,-19893869,137053,-12698367,6912705,7988432,-8303964,6902852,10056653},{-23044162,-5352962,-25292589,12324712,9712246,12135890,-25670270,-5551864,-6666190,-13377811},{1,0,0,0,0,0,0,0,0,0},{-321850,15739067,5246810,-6001216,605762,-1765569,16734450,-12229722,2094901,-10380089}},
+        {{19916635,8052564,19108675,-5659507,20580717,-3519031,-20716769,14989007,8454765,4178378},{-14638853,-187210,14224241,14964149,23812204,5019463,-144643,11415529,26235442,-6103943},{1,0,0,0,0,0,0,0,0,0},{-32150968,-9184870,670331,-2700221,-3859079,4171690,-10031098,7812022,-10958571,14721915}},
+        {{-32920017,10228316,-4605935,7059916,-11548942,-4272558,-5960433,13301252,-23248071,-6809435},{-17000854,-16445438,-3021237,8911870,11406190,-9826506,29559374,-9407748,-24645644,3529192},{1,0,0,0,0,0,0,0,0,0},{4866158,3393619,8809168,-12467542,18513783,14441614,32269647,11051754,20247367,-9513053}},
+        {{6474141,-9489985,-32089757,3478904,-16468983,-305696,-23438837,14701684,-14251510,3638312},{-452123,11661928,-22468028,6428672,17813096,-13037094,8243931,12117443,21165798,16358414},{1,0,0,0,0,0,0,0,0,0},{-24117872,1438049,-25677586,-11279478,-1496898,-1116579,3382370,-9815376,-7589180,10533505}},
+        {{-424023,11402574,13409679,4919828,24721010,9803491,-7687211,-11612755,-19563497,2587869},{-18477800,-4033808,10910861,653195,32348984,-12883065,19526611,-9422251,27161268,7203721},{1,0,0,0,0,0,0,0,0,0},{23228151,8932625,24558314,-5018701,11526868,-12106038,23400674,12062511,10725981,-8965451}},
+        {{-3969142,11214994,-20826345,6846607,9458954,10399254,-336962,-12112491,28213765,3006052},{23593229,-3625836,-30873402,-13422187,-31228439,11448821,2379723,13002263,-12506053,-7854419},{1,0,0,0,0,0,0,0,0,0},{-9136296,4674932,-5246595,14354162,-14739971,-3278271,-27040068,-659722,-12301646,-2452746}},
+        {{-1468436,4424754,-33089387,2325316,-3164709,1660216,-23028824,-12597459,18179298,11677229},{32290499,-10616872,-2008564,12731531,25132881,-15181140,29749638,14941359,17145058,15634615},{1,0,0,0,0,0,0,0,0,0},{11647968,-14064014,-18889160,-9048552,2710500,-16099600,2425143,-4020004,-1058114,6382452}},
+        {{25690081,-9569203,-31047861,-15020786,17033307,-8996890,-18696186,2051949,-3074878,1295380},{-4441337,-6117288,19949360,-1143467,13608219,8661457,3445019,4410894,-21456094,7403725},{1,0,0,0,0,0,0,0,0,0},{18694800,-7197144,303174,-14674009,1526460,10666176,2019551,1926000,-8298296,9711316}},
+        {{-6730021,-385743,22702953,8984918,19912063,-12263325,32184790,16536308,18412626,-11887527},{-24731599,-2126137,13641527,14905935,-18299207,3410490,-30800322,-3553517,10399875,-11845668},{1,0,0,0,0,0,0,0,0,0},{-13306575,-5299162,-30523816,1689485,22995436,5003102,10108250,1783742,-17108718,7206202}},
+        {{-6871326,1701375,-22831879,1976620,13675168,-8746480,-9673435,4867258,22536831,11504297},{-7141386,15360553,-24293503,-6506368,-19262147,5044600,8358000,13812128,-28068393,6729791},{1,0,0,0,0,0,0,0,0,0},{21288519,-8123145,-4435513,-14656432,-33023297,-8578894,32666168,-14262662,28051465,-13351889}},
+        {{11957453,3086195,4153552,-14845268,-18366843,5927049,-29026312,-2409839,7619328,4903280},{-7475490,-11323026,18240689,130486,18416722,13357884,19496991,8500341,-17398621,11150322},{1,0,0,0,0,0,0,0,0,0},{-2140113,10527069,-15932766,2720982,-17919352,3326167,-30326187,-8766621,17056861,-13042717}},
+        {{-23220086,-5352053,-20441371,5418133,-9071908,15190513,-8857851,11841734,-33431299,-1052551},{11840271,5519604,19323032,-4005460,14027648,-4671378,-8302150,7570037,13829753,-14327834},{1,0,0,0,0,0,0,0,0,0},{12736802,-6249704,7297465,-1890689,12477729,8397601,-6575067,1063895,21168382,-12381483}},
+        {{26542450,4567247,-25186750,-11158630,-24852631,-7530215,-28538779,16224078,-16375049,4613066},{17794437,13073751,-6344619,5473871,-12284039,14307741,16596414,-7837449,-11044072,10944408},{1,0,0,0,0,0,0,0,0,0},{-3033345,-10015039,20782826,-10507068,8209738,14236890,23033800,-13309941,-19895523,-9843921}},
+        {{9843013,13041242,30683999,-14139636,-13742256,4396850,20461753,-7027701,6288981,-7738932},{6771121,967881,15780587,5694208,-24657156,4295777,15988877,16700712,8013541,-13350234},{1,0,0,0,0,0,0,0,0,0},{9558530,-16524123,17983809,7218962,-14264734,-4778224,-24935513,11891175,-7629136,-16032751}},
+        {{22486293,10973115,7696895,-16750186,-2299103,-6657868,-12727468,2689082,23381001,952112},{15711219,-14971079,16492456,10548133,30763955,3947432,2447680,-13374095,25329311,-4346195},{1,0,0,0,0,0,0,0,0,0},{-8455391,-15756772,-30207010,-5193874,11603856,-328689,11700993,14456807,12118559,12938991}},
+        {{-7021956,-11591548,-27503434,10988585,21236434,-8511657,-24382438,-13497643,21549851,5822299},{6939489,2831771,-33309061,6075630,29256095,-14631084,17284511,5007970,-3363669,8974240},{1,0,0,0,0,0,0,0,0,0},{1997278,11222733,9917041,-5088550,-32623034,344775,4627743,-14748765,-31234976,-13988132}},
+        {{-24114008,7777480,28091251,-4534074,-11253232,-12378210,-31661931,-13764437,-7252655,1189056},{31667562,2983015,-30353076,-666460,20279083,7385524,25095965,-13459798,25831482,3504201},{1,0,0,0,0,0,0,0,0,0},{-5187937,-1744301,5541692,14752610,25269924,-2483901,-32914212,-8317502,13816536,-13949993}},
+        {{-2535992,11270542,17282438,-10663735,-8432403,6388803,-12053063,142671,-17719709,-5899202},{21090766,289605,22150984,-13526280,29114723,-15522950,9351608,10040630,22410529,10950820},{1,0,0,0,0,0,0,0,0,0},{-24754654,10975721,-15878883,16489048,13420200,-11802694,7237905,-13485987,208342,4059960}},
+        {{-3981473,231693,-7613613,-10229396,13373356,8405974,-6000225,-15797940,7557134,-938686},{-8466735,-1045170,25067228,13802469,-29593926,16604894,-31763911,-846011,-23540487,8090689},{1,0,0,0,0,0,0,0,0,0},{-16954471,14101686,33368890,3967462,-9126332,16070224,-24105937,-1190579,-16283304,-5636751}},
+        {{8872559,-2236685,16464226,-9799805,4383481,3616880,-27351837,-14617336,14691837,5295939},{21754423,-9701763,21352436,6249193,-18081527,14956341,-29129131,-14176312,30140887,9298511},{1,0,0,0,0,0,0,0,0,0},{26282597,7151240,-19566006,-5357486,30983310,-15929855,3238780,-15835023,5329408,-11800279}},
+        {{-19663370,-16345669,-29554389,15770611,30371698,13180850,-8326298,-11587750,-20047521,-12968689},{-28718448,-2270924,-31428896,-7763925,-29811292,-5655572,-12332893,-13503592,-24281851,-4336132},{1,0,0,0,0,0,0,0,0,0},{-14851132,16515926,-2269806,-16625607,627146,11118887,23557281,393083,13279775,9022172}},
+        {{25061828,1430515,-3510467,7013852,-18785259,14226270,-31840150,6088133,-26911103,-13682066},{16790139,-14012350,-2104237,12018038,-5295631,-12851119,16363205,14737159,-20240129,-9819053},{1,0,0,0,0,0,0,0,0,0},{19069695,-13312012,16569147,11110018,-25163978,11294403,-21982279,10093789,13377724,-10776202}},
+        {{-26723384,4119830,-3281289,-217089,-33219239,-262289,-3068391,-4433008,-3026675,-4143070},{-9635194,6941794,7447191,2816777,-25254797,-10221180,25632908,-2313088,-31847533,-10083816},{1,0,0,0,0,0,0,0,0,0},{-717473,-7180949,24182393,10659628,27457149,-12771932,-2489624,8150108,-31214669,13391386}},
+        {{21055370,-7385018,-6386685,8094299,-10817362,-14150730,-6585746,-10266280,-6438938,14809638},{10917612,-13988840,-15740779,-9928140,-7006487,5059069,-20072097,-2325339,26830348,3352521},{1,0,0,0,0,0,0,0,0,0},{-20155312,-14363185,16072527,10435095,17091470,-4967208,13686799,9801865,-26659566,-8255072}},
+        {{-20391131,-6872539,16956378,84262,1822896,-5474677,-30922027,-8982189,-13861771,-11617864},{27761785,10324853,18888826,9895817,19645988,11840122,1362775,6737820,-1670059,-14269191},{1,0,0,0,0,0,0,0,0,0},{-7306045,-10217624,-2925948,-5345015,33531673,-6312527,33307963,13676697,25259883,-14026150}},
+        {{17303065,-3826992,-31239045,14891493,10646435,15574900,-2730733,13193162,-6787160,-13630590},{-21397036,-2096710,19623082,2482013,2626150,5274676,-23326356,9242568,198259,-15508026},{1,0,0,0,0,0,0,0,0,0},{-1208668,2947799,-14154657,16511999,1148969,-4511994,23850327,-809604,-23304440,3347228}},
+        {{-15920512,11919329,11480429,2814016,1992216,5894693,-14499642,7850845,1627266,-6748615},{-24183254,957113,27182434,-15500514,332725,11697913,23360751,-14874743,21617062,-9114625},{1,0,0,0,0,0,0,0,0,0},{11046679,5385152,6860140,-5860411,14771131,1697096,-15484605,-4260963,4646035,-15141778}},
+        {{19374561,-7953523,5920361,-12579315,-488902,-13406447,21713196,-8750478,-23922219,16169822},{-19721697,-8748331,24077675,3990674,8545033,15409142,-4418994,-12074371,-13528366,-2767777},{1,0,0,0,0,0,0,0,0,0},{-3254362,13500482,-32488056,-10338331,15099893,-14296464,-22855282,4685471,10278467,-13065463}},
+        {{32644794,-6480570,-30677020,-16324820,701426,4483126,-586294,-15398877,12789208,6794561},{32522740,-13773441,-19576834,-1555986,-6978644,16676635,33066025,8899426,25737207,14751299},{1,0,0,0,0,0,0,0,0,0},{-8801548,-489022,-23075112,-7168207,26219328,-139066,30090041,-11944419,12323841,-4141083}},
+        {{3265156,4437038,-7558523,5749408,-2653120,-14490271,18044729,7747901,6132492,-11990090},{5985376,-14962483,-9225234,11427553,7402711,4173859,-30553324,8622206,-19869897,-13668332},{1,0,0,0,0,0,0,0,0,0},{-18308318,-14319941,-19444755,6236244,6609358,3590862,-9620853,5187997,9271528,2983411}},
+        {{-9394243,-15655862,24109806,-12037318,21281830,14754621,-16077728,-2569229,5906186,-13136469},{-13444573,-7620180,5419681,-11160720,-17565906,11479784,-21628448,8522668,20655604,8453244},{1,0,0,0,0,0,0,0,0,0},{4815047,-4706195,-22926653,10539639,-17610936,2387839,-13669757,-14384589,16353769,-7703619}},
+        {{-10421638,-6770086,21851317,7766861,-24137772,3665841,1119452,-16642697,7018968,-640567},{7832166,-4993936,-12787393,-6677954,-21337800,5318104,27872299,-7137437,12226814,-116955},{1,0,0,0,0,0,0,0,0,0},{-19398623,-7335969,-15515027,-1541700,3318142,-2420393,-15009360,13349866,29734309,11926869}},
+        {{-10961180,-7544742,-2407937,7446228,15110046,-7525091,-1271122,16481115,4334062,-16702662},{12043926,-13972441,-25181984,16326319,33241624,2247571,23708046,5196207,-5720195,5535483},{1,0,0,0,0,0,0,0,0,0},{28347521,-7232899,-18139017,11582250,29698922,-12032075,-15517374,5668281,29661918,9769161}},
+        {{-1143408,-14624256,20223440,11574317,27965271,8629602,10287434,-4312903,-6355476,11122778},{-10794599,-7249556,-11066861,-9900125,-13614112,-8508825,-20739373,15774354,-10219850,-13019580},{1,0,0,0,0,0,0,0,0,0},{20015422,-3053500,-31766368,-13105433,-25411472,-11697020,-28299131,5187629,29352204,-1699882}},
+        {{8842287,-12455159,29887609,9991443,-12455769,-12544607,-1921388,-10844236,15326621,13337951},{26532977,-1578991,-31608839,15525752,17011954,2873602,17338737,-13977944,-29818456,13633407},{1,0,0,0,0,0,0,0,0,0},{-9817442,14167583,-5027353,-2742366,19819352,-14037258,-19509319,-11925651,-19544925,-8514073}},
+        {{-8521385,-10428035,-9907722,16537967,13132768,-16584588,24397992,-8352772,26753470,7907969},{-9544629,-12731977,-10846737,-4372993,-30730837,-6909989,18984695,-2643921,-28664321,8230263},{1,0,0,0,0,0,0,0,0,0},{16207000,-7474018,15586202,5794019,-31396999,14573359,-12714761,-1324714,-23185840,13339000}},
+        {{-14642415,-10651643,-30414909,14161228,-4069011,-10928359,-1687161,12453987,-32970163,12958047},{-27935985,9406292,-26878083,-2684450,-10441389,-11551138,-843885,-13150487,9589836,-5477876},{1,0,0,0,0,0,0,0,0,0},{-21055401,-2712683,-5696525,-6551680,-929943,3134760,-18606531,-1463815,-24075365,-13918923}},
+        {{-16528232,11425391,-4227566,-8503228,-17116447,-4447515,-30483785,-9908644,28683739,16307124},{20507349,14814735,30216414,-1853874,-15235022,3847424,-26758338,10480281,-13031960,-5961297},{1,0,0,0,0,0,0,0,0,0},{-22230683,10608508,-3339519,-12234891,-1286288,-6270651,23106305,-2668637,7939501,-10402894}},
+        {{-25592992,15364293,8028568,8284768,-25342269,-4034778,-17259256,-1996731,-6129871,-11235890},{3058786,-10690416,-5063078,10664067,-8476140,-727044,9277118,-11325320,-6937788,4908745},{1,0,0,0,0,0,0,0,0,0},{-25616403,-11270913,12525436,5613260,-16599056,9199192,16467442,-3149949,-20238159,-11581978}},
+        {{-20436289,-10275170,-10302891,-9254830,2195606,-14887350,17234383,-13758365,16203162,4360419},{-17097759,4012197,-8927854,13552297,254103,1618827,668993,678885,-33065105,-10526538},{1,0,0,0,0,0,0,0,0,0},{-33245215,16297298,12981154,7733248,-20077798,-3779023,13856388,-927558,-6053245,-12041522}},
+        {{7088658,-10306739,11637960,14836700,-9372814,-11295214,-9316360,7067963,23773427,-6560521},{11268849,-13278163,22925278,2296867,-30142300,-8742155,5529333,15308278,-26596153,-789436},{1,0,0,0,0,0,0,0,0,0},{-705375,2278031,-20139628,-1018681,6502189,11173263,8376891,-2846400,6441181,5808633}},
+        {{-18182733,-6589789,-17231945,-15876503,-28419885,-16323696,-26983325,-8500606,19439404,6005871},{-33231104,5297265,-8946084,11613159,-12384013,10887857,11785574,-9410264,1125755,9240347},{1,0,0,0,0,0,0,0,0,0},{30999570,15787382,-29061271,-4573135,-3691271,5189189,-4942032,16060592,20185096,6382032}},
+        {{24520159,14472809,-22727378,-13868909,-20541604,11841500,-14497233,12618070,-22556421,-14988901},{6314389,-10791763,9365747,3399839,1837171,-15778681,24025965,-11059145,-29051841,-15121450},{1,0,0,0,0,0,0,0,0,0},{-5913043,-4630972,7835195,-15390802,-32409523,-6062213,-2716521,12623827,22325338,10321459}},
+        {{-18543654,-7763413,-27662765,6132376,-3871846,7759811,-32672288,-922234,33198990,1354945},{20730950,-9508317,-12368637,12982334,-7778723,11146163,-1714787,-2199388,-17061840,3109180},{1,0,0,0,0,0,0,0,0,0},{18162243,6366946,27568129,-1494111,-5863303,-11136213,-5187884,15529697,31359244,11116022}},
+        {{3389410,5619912,-5234278,-12039776,17258613,14975563,-23882119,9449033,14287201,-10623567},{-3667371,-1838966,9219728,-7069053,33355040,-4220640,-23387635,-13740152,3953723,-16055626},{1,0,0,0,0,0,0,0,0,0},{-24856666,6702945,14088730,15315373,-5909196,-8334727,-9584765,14270969,13712653,-16132325}},
+        {{-16116031,-8515071,-8312321,8157036,-3581694,-7038695,3425111,-16747276,25261668,720054},{-29994302,-13338900,22379247,-796509,27305227,-549329,-5162230,-10886874,2525038,-1026061},{1,0,0,0,0,0,0,0,0,0},{24006589,2386196,-4171771,11951775,-21257076,-12928897,-1706146,-15240991,-10087714,16233494}},
+        {{-15571836,16501113,23794541,2337950,28600533,12981480,1720747,-7094212,-25380208,-401868},{-27736466,-13051994,-27881817,5041100,-5543031,14656334,-30450936,10292564,-32579304,15858319},{1,0,0,0,0,0,0,0,0,0},{-1855392,6179780,21180747,-14527539,27180531,-10657317,3492857,6666478,2869466,-10066438}},
+        {{10661240,-6601838,5272897,11483682,23705301,-5194136,-16399450,10374638,-21326790,7212376},{2304017,12488336,12596642,12637043,16071323,1881576,14669150,-1748180,-18350868,-11391492},{1,0,0,0,0,0,0,0,0,0},{-18693250,-16011930,5191573,2448072,-3881577,-8605432,-24867630,-9922386,18899139,471507}},
+        {{25392153,8216432,-2329871,-1916309,22659691,-7706991,20683715,8567672,15469442,7189969},{1210520,9570223,-8390127,4375735,-8137700,1886009,5478467,12617551,22063387,632580},{1,0,0,0,0,0,0,0,0,0},{-24520064,1414520,-17970689,-6234761,-2400289,8686873,-17519529,7586137,2056278,-4024866}},
+        {{11782541,-13086155,-14675284,-8349282,-6689379,13816672,30481221,9801105,-29077949,16253002},{-26706012,3233276,6451976,16659456,-27487902,-16495223,-32961150,6130338,-13337532,-2132216},{1,0,0,0,0,0,0,0,0,0},{-23070140,-212928,-28229670,2246709,31538814,4779578,-2657691,-10602037,-29025854,-16220111}},
+        {{24717478,11152196,-7754901,-6888417,-8568697,11749826,-11006785,12207900,-4568651,-4515725},{-2272641,14675217,1944606,16559659,10684008,-7846097,1654657,9467674,8060174,-12026412},{1,0,0,0,0,0,0,0,0,0},{-7000381,-2626095,-25240822,-7936341,2773569,-1735289,-3297713,3454056,-21383663,-10146162}},
+        {{7998099,-7301331,30423294,-3178849,20671729,14656722,-17793955,-1587128,28158290,-123906},{-129488,14857715,10280777,3616280,29768194,11508616,-11016989,15283034,14626521,-466250},{1,0,0,0,0,0,0,0,0,0},{-27613282,-3261749,9164681,11198989,14941081,542806,-31480368,-10558746,24589932,5058516}},
+        {{5570386,758339,-21470934,-12983341,-10399577,422212,24654222,-11264020,-14952379,1310138},{-27583367,-5341922,-32634556,-214240,-184371,-8943594,7463738,9637071,3846291,14452183},{1,0,0,0,0,0,0,0,0,0},{13746809,-14795743,10707748,12953989,-28216495,12054730,26328767,-4366749,32810906,-2430174}},
+        {{-4223144,13734743,-12271599,780954,-10221451,-12809042,15440084,4034453,-12176411,11648624},{9229042,-1012244,20395188,-14505903,24138171,-768477,-24145511,-10082475,-8064548,-4997963},{1,0,0,0,0,0,0,0,0,0},{1175069,4187103,-26893091,7764348,26805886,4238158,-21685488,-15146924,6690555,-8961365}},
+        {{17759787,11318277,5266997,16102023,30172107,-7523604,31871943,8515111,29359516,12635068},{-13324286,-11247842,30962157,-3384135,-18915205,13294634,6997095,9261118,-8956273,12746045},{1,0,0,0,0,0,0,0,0,0},{-4711035,12656650,2507819,-8725012,31387825,10627656,496396,9337101,-13416124,-2440911}},
+        {{1956955,-6318172,-122303,-2897348,-15657533,-1315301,-9740105,-13163784,-10372820,2810344},{20418899,1925512,25022016,15711373,-15607731,10390320,24915644,-2206752,-18546035,8718562},{1,0,0,0,0,0,0,0,0,0},{15986151,-14849806,-24337548,-1327265,-11191454,-7438272,27352546,-834668,-3787994,-9960485}},
+        {{-10127469,-15376681,1624313,16512649,16851345,-14064234,-2966004,-2079949,-23838446,4372689},{-23840611,-8975104,18338463,-2372204,-3328636,4277276,9139905,13459378,13814610,-6317911},{1,0,0,0,0,0,0,0,0,0},{23576520,-4924493,-29818887,6484516,-33014851,-10726075,11322679,-8812078,-23082949,9733742}},
+        {{8841008,12832643,20845671,7219408,23289867,5207262,-3814056,-15642512,27453184,-3199257},{-8765738,12097425,1555293,2510290,-4771439,-13605793,-13314354,-7236704,-15582550,10015960},{1,0,0,0,0,0,0,0,0,0},{5607507,-2184842,4961283,-1231760,-30948065,10871424,1753270,13116138,-19373541,-10758536}},
+        {{-18294047,-3970657,-30095133,16638027,23513092,6949879,-17667072,-531405,14133524,13862766},{-4139389,-2729182,21700036,-5019992,18580054,-9489680,19356655,7861317,-16857530,-5727203},{1,0,0,0,0,0,0,0,0,0},{17222724,-12452944,22418364,-3831393,27899702,-11627858,23064211,-16114858,-31711926,-10184495}},
+        {{-20654291,10782263,5947180,14052606,-18899408,-4454593,-4147361,-2632403,31433873,16575176},{-17440272,16141366,-13994375,3374081,4897971,10343774,32505548,-1231900,-32437967,5910870},{1,0,0,0,0,0,0,0,0,0},{30930839,14879186,10506742,-390902,5923615,2881924,33393079,15120263,-23468462,449652}},
+        {{-21022673,11076580,-24274836,10129534,-9220753,-13437929,17066763,-6347786,-3965512,4078371},{-2206889,1022582,3066524,9121587,-17450455,-11170515,-10141068,9769430,-4231714,-15485412},{1,0,0,0,0,0,0,0,0,0},{-11952450,400047,25106531,11700845,19590131,-1393244,-20816511,1297962,-16662856,11640420}},
+        {{-20330853,-6956783,-22405966,9924622,7287635,-12052051,7456681,16447835,-27383339,-9959065},{-10181276,8045168,-17472931,-10749641,-3099663,1877050,-12137744,-1470058,26659657,-5615227},{1,0,0,0,0,0,0,0,0,0},{-26834754,8748285,-5765669,11300200,3114288,135332,-5161912,-1132471,24041094,-13935405}},
+        {{-29525814,8572081,-11798360,-15439171,-17917613,-5342341,-27242885,-13213093,4177450,13917385},{-22448711,11437587,-5129159,-11439998,6140128,-9331767,7008789,-54575,-22060295,-7643315},{1,0,0,0,0,0,0,0,0,0},{-12454513,-2860620,-25033927,11369336,-19905803,15341544,-11413978,-978313,23628098,6211952}},
+        {{-33339536,1614413,1534325,-12184383,-23643804,-5155916,-14679390,-11895639,31914386,12070527},{3953235,-223027,-8728957,-6367812,8911594,-13826012,8353424,-3568698,29189213,-16629543},{1,0,0,0,0,0,0,0,0,0},{4748105,-8818621,9190229,-3321330,2946390,-15107355,8679378,308672,13298864,-4852103}},
+        {{-28724850,16652681,-18298818,-12681224,-7502277,10234503,23291056,11892553,1551276,5280951},{3757931,-4246184,312208,15505004,-2167275,-11074049,-6877537,-12598175,-30307402,-9072807},{1,0,0,0,0,0,0,0,0,0},{2796019,10594904,20508571,8100199,29995217,5105940,-11646888,14874871,23567521,-719527}},
+        {{1890098,-6584138,-20133262,-10728078,-23894702,-3655338,-10477265,-1678739,-28022534,11482485},{7598981,7243964,-9974931,13967675,-9051988,10855527,-29533553,6148042,-31570667,5679562},{1,0,0,0,0,0,0,0,0,0},{3991044,-219560,1099839,-16232499,31105834,15273416,28825678,13831172,1664876,-5196507}},
+        {{7436727,-12920724,13716644,13101930,-14638660,-11278301,-27327450,993494,-3049231,14871037},{-14495368,14858900,-8538370,5473911,9692520,-9204141,-4909165,13922821,-26496152,7993058},{1,0,0,0,0,0,0,0,0,0},{-19797676,13959506,29970964,-7192499,-29010666,-15152958,8600430,-13026948,-3962919,-4274645}},
+        {{8265798,-9219692,31125382,-10928496,2076238,-5183420,-25516705,6534433,19453088,10235659},{11238083,-4639850,-27231198,-15904903,12797828,9681455,21195980,14300902,-14898015,-1509625},{1,0,0,0,0,0,0,0,0,0},{-2107085,12779605,-16963041,5880595,-30929848,1050747,-32246670,14081799,17316938,-16092387}},
+        {{-12381733,-5565194,22607600,9553839,29623915,4432364,6597769,-12569743,23004664,-1459873},{23636759,6196339,17038353,-788187,-6789209,5804232,-12524155,-4054635,-12562611,4977227},{1,0,0,0,0,0,0,0,0,0},{14904335,783906,-27073548,15934866,16471116,-10729217,22337414,10270851,-24704723,-4285550}},
+        {{20443242,3338094,-25372525,3700744,-15664728,6245796,647203,12351896,23395014,8972047},{29018292,-3849007,29355380,13069339,27442790,-14477077,8087412,8405606,23682549,8408649},{1,0,0,0,0,0,0,0,0,0},{4878892,-16511644,-3027842,-15893570,-15080685,14240087,17117169,4491298,-25545562,8530276}},
+        {{-12958135,-2409285,23717379,-10613292,-8518730,9328702,-800844,-9621178,17288945,5349894},{-12402937,15120494,-24832845,-9800268,-2494595,-6987296,-2758418,5661940,-1603763,-748621},{1,0,0,0,0,0,0,0,0,0},{-2741459,-4806791,25427142,-15744403,-30870898,-5965209,-14855375,-12678070,25049386,16763119}},
+        {{-32129786,-6035268,10212961,13410902,33119695,11508561,-24067860,4430270,-18719608,-3164903},{-21072598,-683118,19417139,-13175398,-18871349,-5611475,-14368275,771171,7350653,16089953},{1,0,0,0,0,0,0,0,0,0},{8291426,-6013397,31754669,-6105744,-4847818,-8854464,-8765047,-14132116,109321,10163106}},
+        {{22329828,6509343,-1171613,7885865,29087879,8778986,25869386,15629992,33032034,1011019},{-18193671,10125874,19643943,-12054391,-31576482,1754491,32706395,12420604,24128597,-9372945},{1,0,0,0,0,0,0,0,0,0},{-14513444,2963163,-3055003,9932202,15831743,8437970,26234351,16704534,-32437741,-12572921}},
+        {{-14148427,-16377991,-18158838,39219,1225543,8376398,3430917,-11675055,-31387284,11816776},{25294647,-11075743,1619845,4006582,-2967339,-4117597,-8796418,-468376,-27061944,9206120},{1,0,0,0,0,0,0,0,0,0},{-793039,7332961,14920615,-12248672,27937713,8850584,11277550,12078115,32005179,-2154014}},
+        {{-18266695,-8866988,6027216,-10244603,-10925247,-566424,30710675,10771727,19960015,-5940920},{26944224,-3637418,17531102,14037881,-6498054,-14186667,-30963911,11021026,199668,-11780090},{1,0,0,0,0,0,0,0,0,0},{-30129837,4922433,22193562,-6022196,-7980063,8508105,12343979,-16766660,30264373,3505539}},
+        {{31104383,3725506,-7326596,-15031989,-29240580,3833628,13214953,-3493811,-3619215,-4136183},{-10625270,3863094,-1931265,12815030,-26940976,12234476,10734623,13077920,2604307,-4426062},{1,0,0,0,0,0,0,0,0,0},{20789292,12841725,-10569022,7205142,-23617778,5376774,-30140517,5973746,-17815652,13188983}},
+        {{15567278,16123475,-11714726,1914027,-25808202,-6079999,-20330155,-10513096,2974705,-8332126},{30398499,-2007749,-8812969,-6242362,12370944,16011765,-15591298,-6508368,-24884749,-7660757},{1,0,0,0,0,0,0,0,0,0},{-19915251,-3263394,-6464299,4848585,31615704,-3484688,-9752719,938893,-20593744,6143661}},
+        {{22256707,3008483,26704124,12539865,10098394,-2445344,-23174425,4770340,-18591065,228516},{-7259539,-6139803,18429907,6533815,-32209403,1889336,-2611300,-11222099,-14021654,-11083923},{1,0,0,0,0,0,0,0,0,0},{3407252,-5726007,3065101,-260941,-19206731,-4331819,24602091,-6016992,32190742,6263048}},
+        {{-22908496,-16441026,-31452150,-3635960,25381765,-6131602,24087726,-16516974,-29682022,14663687},{-14955470,126770,3238943,13256287,16194944,-6172454,23379489,3154410,-26022887,13590460},{1,0,0,0,0,0,0,0,0,0},{22507978,692324,-23020898,14520508,-12078405,6971122,12874771,12318058,29949363,5423792}},
+        {{12152129,-8631840,8515018,-4659549,-462954,8076518,4093620,-1509852,17557005,-5799749},{23107672,6111851,4500391,-15655894,5465892,-8938700,7372509,4764499,-32441897,-4647645},{1,0,0,0,0,0,0,0,0,0},{-982340,-15747165,-26111112,10284855,-10626726,8555666,11588049,8019889,3535468,16118186}},
+        {{6956367,-8369775,-8374551,2618113,-15640603,-14235433,-12156092,8400975,-5850995,-15305390},{-10132069,-2141105,10921489,8184567,7602617,-12209180,-24319218,-12626899,10340685,9314868},{1,0,0,0,0,0,0,0,0,0},{19371789,-14331967,-25784458,8683469,16494043,-11258598,13029682,-7428804,23019227,5106808}},
+        {{-27595432,-1078900,28934163,3254223,-662417,11281310,23633246,-16620863,30613715,4255366},{-12943271,-8893485,-31936183,-11573909,-14152335,-16126706,-5717915,6038682,28377979,-11153118},{1,0,0,0,0,0,0,0,0,0},{-12668199,10198233,32336365,11361695,6774680,-14182241,-24156884,12218205,33221247,-5621693}},
+        {{11263139,-11192071,-20699489,5633888,2598838,598644,13372416,1265469,-17557541,5315770},{26086368,9680720,9098413,4725948,1662428,-11601278,22515620,2536810,-11353931,7266163},{1,0,0,0,0,0,0,0,0,0},{-32405756,4403645,-19703948,-13064079,-30612178,6523272,-9090175,-5192385,5929909,12891877}},
+        {{-11773846,-14125855,-1167692,9073802,-1962773,-4873804,27661300,-5852598,10681504,-10779026},{-10473944,-8941599,-19208381,4867128,-6825052,-12438099,32796467,-6507127,9419095,13664056},{1,0,0,0,0,0,0,0,0,0},{-18524851,-8740543,-26399879,4221065,-33181787,4092132,26156704,-241657,8025977,12785635}},
+        {{-7392652,14677220,-18539574,-11543002,5679426,11653115,20924895,3344570,12805131,-2576236},{29948478,-6479480,5656007,4312683,12720192,-15648238,-16220069,9991344,-22449823,3302806},{1,0,0,0,0,0,0,0,0,0},{-31167803,2074261,7667304,16490987,466236,-13524098,-17805886,15513157,-1970847,-13919509}},
+        {{-11737495,9762023,5064562,12940736,-18935103,-11071895,-7761351,-5599224,2636583,-6203181},{-3345789,3190242,-10355657,-7315612,-4228381,-14702366,7997472,-2414787,10183344,1573585},{1,0,0,0,0,0,0,0,0,0},{-10202058,14534395,24077506,1479648,31753983,-16591540,-21546983,10439265,-26015804,-6613560}},
+        {{-6358058,-3375995,15631324,10406589,-8184916,-15025171,14561463,7699985,3653492,5143919},{30258741,-2995512,-12989109,-9288630,24550510,15568123,17098793,-6005934,-24854316,12024743},{1,0,0,0,0,0,0,0,0,0},{5636015,11426868,6726894,-5673245,-25653293,4463931,-23409322,3889058,-8423290,-9882786}},
+        {{5270208,8100971,-3670231,12791254,9139646,15643130,-31782312,9960737,-9218221,4074331},{24457136,9127637,-29373219,-7534541,1350115,-15252347,-24956655,6780765,20825593,6179881},{1,0,0,0,0,0,0,0,0,0},{13328384,882186,6554030,-547507,28086836,7791505,-11035509,-13378228,-28672828,-11413318}},
+        {{3464366,-1551295,-16807744,1734099,-912415,-5021059,13528814,-6876056,-2504220,-15590810},{24132489,-11608175,2805900,359010,10338738,1625436,8187933,-8104921,-30452429,4077301},{1,0,0,0,0,0,0,0,0,0},{32149004,3929716,2136379,-14379292,-8843841,5623542,19446963,-9377684,-11308704,4203576}},
+        {{-27059164,-11509824,23788574,-14140581,22481801,-9343258,30529465,-5475649,3506990,6385458},{6113373,9976760,12940837,-12812282,28827292,1713554,-5752959,9769845,6396578,-13243214},{1,0,0,0,0,0,0,0,0,0},{1748933,-6831519,-30139951,16109527,23372904,3784969,33462086,4372175,-13920040,12194586}},
+        {{-6375207,-9201218,-22266662,7009183,15467835,-6203046,29164389,5527007,17295126,-11874825},{14481528,-13555978,28336918,-1092157,6046554,-12157987,3495406,11487413,24147642,-14919695},{1,0,0,0,0,0,0,0,0,0},{-14165226,7979280,19722296,6116318,-15106530,-7832627,32697831,-6256835,-32991637,-9321036}},
+        {{-26471518,10588619,-11048896,-12647660,19954403,-13674733,-9368081,-2500108,21511257,-5219918},{4439891,998794,-13637195,-6724518,-28292422,12442159,-20153931,15286141,14646656,-8327127},{1,0,0,0,0,0,0,0,0,0},{23178647,-1556240,-2386614,697227,3361646,-25612,27207494,-13993739,-26186398,5253531}},
+        {{-8255404,-10389992,32042570,16220523,-19625590,5121378,-19890759,-10419511,-3056197,-43441},{-30630383,-15951654,-6759098,-8345296,-20352930,14388763,17877714,5245467,18211350,5450460},{1,0,0,0,0,0,0,0,0,0},{9310426,5788703,-20396383,13559372,29752067,-1417582,6083068,-10368997,-81005,6295399}},
+        {{4511047,14505323,-5675182,10180954,3529157,-12323826,-21825556,12154688,1455236,-12776822},{1515434,-1995152,-18102306,-10884150,-3718373,-15021394,-33105560,1880342,-22417078,11106771},{1,0,0,0,0,0,0,0,0,0},{13447165,-15144859,6172460,1778651,-2161007,-5491696,23828860,14006453,3892639,-7870381}},
+        {{5591286,-12270935,-19150685,3738243,-3732608,4616433,-22367576,3102699,2400409,-6623874},{1595190,2430459,9671425,9630447,-21667982,5190356,5045634,-10834529,-4945946,9422960},{1,0,0,0,0,0,0,0,0,0},{8233266,-11796210,-1026214,-3259002,17155376,-1580102,-24488400,-5600629,5213784,4175285}},
+        {{-30461195,-10979562,-18135041,-353030,-32908115,-16295693,6377226,13702278,-32119343,14096945},{32396898,13633262,26896497,16654072,-12548033,13014006,27493517,10560773,2794741,16100047},{1,0,0,0,0,0,0,0,0,0},{-3133834,-8723844,-16663907,4515568,-31229761,16246537,-19302977,-3972537,29121399,-5208299}},
+        {{-5508279,-5297581,-24320180,13570262,23133335,8846069,24142569,-9837583,4544892,-4257620},{3507216,6280334,-17890385,2991398,-25743019,-13301402,10104497,14526711,-29854760,-5853101},{1,0,0,0,0,0,0,0,0,0},{-27184370,6299195,-32337505,11257504,32776239,-2252941,-6618214,-9740267,2997784,-8249609}},
+        {{-23112568,-2972159,20422996,-4572106,30351151,-1513274,-20416807,-7543390,-12888534,-4172292},{13897811,12888945,-11673962,1409093,1097371,2105196,19046128,13638199,3241418,-1371042},{1,0,0,0,0,0,0,0,0,0},{3419964,2394811,7099400,12376306,-31514565,-15589160,-26836025,-2535501,24848209,3602956}},
+        {{14658807,-2578965,-12739301,11824088,-17577796,-11898080,23059818,14693298,26194520,16115678},{-16543621,6318876,23664543,-9351296,-13038478,-3849007,9361606,-6232737,-4519410,-15471033},{1,0,0,0,0,0,0,0,0,0},{-27032005,-13072596,10016056,-13248746,10970440,6466999,1400410,-13645,3344636,15094239}},
+        {{27890351,12876575,26092555,8465901,-15906020,7388809,-15281620,13037850,-3146931,12447019},{-10686645,11897829,-30119476,1206766,-29870591,1499300,-13378110,3977325,5405171,7210325},{1,0,0,0,0,0,0,0,0,0},{3365160,-8017127,6504949,-9978123,-12475649,5377304,-25928309,-8177607,-18823163,10944950}},
+        {{-8660873,-7852367,19240707,6869804,-1703296,7785387,-12064027,-4003605,11773110,-14195657},{15948240,16152013,-5469997,-1705942,4871352,-7891960,-10886171,-12136575,-27486604,-478109},{1,0,0,0,0,0,0,0,0,0},{-31360498,-3254786,-32252571,-16308574,-3401782,-7288961,5807282,10652237,-17096923,16336527}},
+        {{-8325684,-16536245,5143781,6186283,-22052652,8134728,11044675,-15297270,-31121247,8369545},{27321791,9821409,-28413435,8900708,-7177532,-6778096,7497323,2163719,10261336,-10128318},{1,0,0,0,0,0,0,0,0,0},{4269585,3433234,-32761154,-464364,29571562,-14424195,-19769794,-983003,657820,-1060169}},
+        {{15145741,-5975348,-5185064,5965313,23292275,-16210133,-14241243,-4684875,14889723,-18538},{5576300,741138,-18010760,12965812,-30516345,-6425346,-22245515,15032841,-7996643,4190661},{1,0,0,0,0,0,0,0,0,0},{7654017,-11703369,-20510433,-2351341,21434226,-7539704,-153537,-1736101,673867,4324575}},
+        {{2792273,15888468,-22356409,-8595215,7609811,14658939,8287800,-10613511,-3796826,-16105846},{-16939409,4978481,25313769,-3784009,3762197,-12897420,31991270,-8403395,1444849,14263240},{1,0,0,0,0,0,0,0,0,0},{-33260132,-10154903,27571959,-377640,-12202677,-4848550,22588247,-2428793,-10196081,-5894956}},
+        {{-19823528,-2239846,-30620915,-11723885,-595497,8715239,-14190056,-3148005,32537300,-9669090},{9940793,10239465,-22872238,-15947463,1589931,15783153,30309446,-11956949,25535442,-2672603},{1,0,0,0,0,0,0,0,0,0},{-22989414,6091135,-22301143,12940004,-18817674,-11053944,-31820889,-13444204,22952840,-7766140}},
+        {{29594715,-13154364,-11986121,13119493,-13548602,-11602798,-10320011,-6716265,-10164861,3409240},{-25847003,8051469,-23458311,-4283618,23763333,8062317,32726533,4199539,20088215,5336084},{1,0,0,0,0,0,0,0,0,0},{14968454,-16568623,-17031572,10550342,-25967120,11010504,-15860148,6217989,29103549,-11141720}},
+        {{9128460,-4393447,-25142431,8740027,-20895271,7571744,12421850,-7359053,-19596657,-15887949},{544301,10563164,94272,10324819,-23260438,-3792234,-28658852,-10346876,26035572,2868666},{1,0,0,0,0,0,0,0,0,0},{5790162,-6460292,19098706,-10408264,-25356244,-9663683,9782776,8860043,-3028841,-8321568}},
+        {{-29384104,6464220,-23748213,-13043258,-17788186,-235414,-9039486,8965007,-12970641,-6688042},{32736722,10420282,3649209,6510901,20374044,-9916287,-12887942,6263928,5068375,4016671},{1,0,0,0,0,0,0,0,0,0},{3121670,-7148961,-25654633,-5900292,25678644,-8478725,24042774,-7825061,-32744158,-772400}},
+        {{11589261,9116340,-4905224,-12991302,5744436,7949592,3202711,7014292,-9874828,-6904349},{-24051058,9026445,-3199436,5691564,-11165025,7237757,-14453128,-15719255,21739082,-11592765},{1,0,0,0,0,0,0,0,0,0},{-23182232,-3542984,1490407,-116804,8075611,-5447561,-15929448,9462152,20673393,11962144}},
+        {{-9203690,8341457,-28631466,-701771,-32274602,-10087781,8534242,-11181051,-9499782,-6382753},{-13657553,4109706,21099339,-8191124,10050733,3935071,-8945640,-13164364,-5901733,7628338},{1,0,0,0,0,0,0,0,0,0},{16611054,11419796,-24703951,-444405,-26093645,4355400,-23649441,-11862405,-4143859,-10179795}},
+        {{23901782,-13423157,29479583,-650523,-1108091,-2685156,1350745,12570869,22586608,11379636},{12939784,-8865416,-18545460,1508217,-17019891,1017325,12810269,3156587,-18649872,12280363},{1,0,0,0,0,0,0,0,0,0},{-17929298,10003092,-28561404,-4468793,25726604,-8910545,-19169393,2802042,-18817683,-12682892}},
+        {{-7920548,-1254134,22589621,-3480507,17885875,13645852,12616329,11630060,5361225,-4321469},{29918750,-7797278,4171026,-6767403,29132405,-8094586,24546701,-1646031,-3683246,2939840},{1,0,0,0,0,0,0,0,0,0},{-5731215,16449718,3831924,-10836122,-1795496,-3959373,-869935,-1431927,32997390,3167129}},
+        {{15244059,-11207322,4357812,-1806065,10918038,-6122149,-6018351,719363,7776330,53403},{27916109,-9850727,30148876,13846436,-13432316,13600011,26284279,-14051950,29711791,-5390686},{1,0,0,0,0,0,0,0,0,0},{-29942244,-14006530,-20760018,-8363381,19111871,-1349263,-24388270,-7088802,33007324,-13839164}},
+        {{-24081229,-9042202,1231799,3607341,26444844,-13787341,5894480,-9886015,10735273,16684805},{-13422978,8849162,5914469,-15704490,18216352,15091561,22250625,16440779,23569925,6596874},{1,0,0,0,0,0,0,0,0,0},{-12914145,1108295,4268718,-981966,-19337356,5889474,26740015,-16654483,-3607105,-16457649}},
+        {{17467692,-16645273,17610719,-10961364,31075271,-6027087,29525196,-1458000,29878286,9319188},{-18322774,-13440036,20176550,8650972,-19794750,15285138,8112741,-12710169,12569431,-8258360},{1,0,0,0,0,0,0,0,0,0},{32631195,-14715024,-18540536,4008523,6880433,-1782778,-31399738,-11390382,10658420,12073633}},
+        {{13995703,13417526,-6756680,-11209278,-18138739,-10327324,-9372133,-3546690,-20324459,11731519},{-9875154,10695840,32142167,-8230904,21712064,8637670,15191924,11060343,-16359888,14156499},{1,0,0,0,0,0,0,0,0,0},{3632696,-5428035,-18105615,-1016555,10229614,10807162,22928148,-13064668,5688119,1884841}},
+        {{15086557,-7695272,14441575,1139026,-13723349,-13053246,22208507,7672031,-22871729,13135879},{-30219983,-7089647,-2019609,2759560,1058227,6488914,-21158417,-4467823,-11041755,12841552},{1,0,0,0,0,0,0,0,0,0},{-3472768,2479472,-5977299,15474466,24006166,-15112753,8746824,10738538,-22393762,-14499984}},
+        {{5999076,-10665766,28123037,-3294871,18943544,-1734755,-11197158,5171738,-28655966,1133633},{-23847853,-15428416,-16139959,2151723,27894449,-7551865,9886063,-10584979,4249165,-3356583},{1,0,0,0,0,0,0,0,0,0},{-31727877,5187182,22190772,-16066011,-20598912,-6706906,-19729471,-7125249,-3532682,-6651945}},
+        {{-33065664,-12131643,-10522737,14336246,3587860,-481895,-29653664,-5030796,-10817540,-6294130},{29939929,3253176,5906297,4837689,-17884530,-16624981,-1166451,6423898,13267465,-16700261},{1,0,0,0,0,0,0,0,0,0},{-2335239,4590047,19559727,11991742,-31243732,2731421,4580466,12353255,30443077,-466497}},
+        {{-12389919,12788769,13653054,1910586,32328000,9976041,8623369,-7869734,27550858,13525786},{-16385334,-6882618,-3605654,4685545,-15697452,-16750426,8566718,-7999382,23993168,-1355578},{1,0,0,0,0,0,0,0,0,0},{15128171,-13489811,-31316120,-9210223,18670266,-15396445,-31363948,-11928740,7250658,11401239}},
+        {{25303886,-13095512,29716938,-2283688,-7088725,2012577,23438477,13046971,11865317,8201451},{-14231831,10012038,7389866,-8795241,32426135,2977091,-12113299,824071,-7990460,-866266},{1,0,0,0,0,0,0,0,0,0},{22777388,15748812,-29886758,6324772,28267647,7135554,18429494,-5962303,26408360,10338799}},
+        {{-22801150,1352448,-28211636,-3649906,-3880305,-6902995,10861616,635774,30815733,11389891},{-5407246,14913833,-19392849,-14175773,-16837432,7440220,-9248349,-15541224,-28905815,2930835},{1,0,0,0,0,0,0,0,0,0},{30534475,-10966240,-17035005,13163235,-33332129,10140757,23293431,-12489524,-11770701,-3165423}},
+        {{343468,12032365,20651611,-2728768,12873298,-4506294,-20855813,3497900,583145,9063989},{22391264,7553584,-23641222,12897376,-7486323,6638697,31351883,7019607,-27188058,-14890073},{1,0,0,0,0,0,0,0,0,0},{26162318,-2742721,12566029,-8686589,4373691,-12190998,-17892060,12260958,-419924,-4226853}},
+        {{-7209891,-13302388,17350940,-12114704,22805827,16153953,13184664,-7360386,-23509129,-4260251},{-11545213,5379735,30724781,-16048224,-11563968,14769163,26288311,12744729,-2503212,-13748552},{1,0,0,0,0,0,0,0,0,0},{32558881,14087190,12784963,-16014107,-5410431,1468219,-18235846,15616188,-24187687,-2255280}},
+        {{31050734,2324870,-31810123,-16663978,18942787,10714175,-14959453,8378903,-27187167,11529701},{-13373579,9589043,2150074,8526276,22161892,5154681,14262364,9593061,-6588965,16081433},{1,0,0,0,0,0,0,0,0,0},{3168844,-13273478,-26881466,-1417704,2096263,-6982111,4882201,14488424,13060078,-7259012}},
+        {{31649870,14125857,6089435,2995627,-6819970,-14991905,-3973110,790406,-26031112,-2982799},{-8443823,7556203,19125954,-13216772,14720980,-11586883,14766255,-8302861,28495922,-7062943},{1,0,0,0,0,0,0,0,0,0},{-21554025,-1062539,5044355,-13548105,18921972,-11382701,-4404584,-4717373,16419724,-4211753}},
+        {{23880278,15073052,15558320,-951120,26248721,4824134,12556140,10136959,20740712,-2941380},{-28241779,-13546553,-3549479,1833320,-29104798,-13236147,7229999,5934602,17612142,13417826},{1,0,0,0,0,0,0,0,0,0},{-12004815,-11134740,7111957,-15270224,11191408,-7799866,30890069,9573257,19718464,-3303143}},
+        {{22291129,-10776505,31523990,-4200827,-19256349,3893928,18314227,-8768722,-22866865,-8018477},{18863210,1788816,31405387,1153456,12888370,-7388255,-226170,-14045366,-1618748,-6381001},{1,0,0,0,0,0,0,0,0,0},{-22487926,-11455203,15116538,10327670,-19901529,-12767321,-21971325,-4494514,19822446,2614302}},
+        {{-597362,2829221,18517845,-1391187,-29111875,5027347,-28826217,8262618,-28625320,-8835637},{21765200,4083428,-6484279,4623794,-741684,-2271230,-1496456,646339,-24563283,4892337},{1,0,0,0,0,0,0,0,0,0},{-31261776,4009806,-24172718,-868709,14935953,-9969429,8479244,-1169891,-24426187,-16080636}},
+        {{-3955614,16309554,3762324,6302515,-25138958,-8797474,-10745222,-2365140,-23604752,-3878890},{-23864304,-11050347,31455591,1628610,-21105305,4043053,-12809370,2842446,25268418,-2125359},{1,0,0,0,0,0,0,0,0,0},{2877142,-12371933,-22880134,16093889,5976059,-16674046,30128150,957963,-14325393,-14078715}},
+        {{25109849,11889012,20736686,14093196,1207928,14055328,-10269583,8177139,10537874,14854830},{-7589820,-3874560,-26371146,9887405,-1302345,14265315,3588795,-4988807,-13275818,14641616},{1,0,0,0,0,0,0,0,0,0},{25683494,-9569744,30848846,14579810,-12984677,1762659,23223900,12118100,-20830335,16312819}},
+        {{-293980,-11180697,-16441266,-14496126,-27876375,14382158,24622277,3385531,33414650,4323714},{-15750991,-5069618,27314636,-528782,8060951,2015717,14725104,-1782634,-29703806,-14761757},{1,0,0,0,0,0,0,0,0,0},{-5067446,16499116,31265736,15715335,30979350,-15431555,-19566307,13126201,-17922814,3593417}},
+        {{-8774453,-8316149,-9684564,5267102,3220683,13807553,10379060,-4785289,-21002922,2349041},{28571993,-9515362,32266401,-16069050,-11144101,336560,-32177678,-15377140,7871116,-2233302},{1,0,0,0,0,0,0,0,0,0},{-7511525,-6192300,18522343,12423529,6710252,-16554730,10692380,-4612230,10929751,3587778}},
+        {{8372623,13100547,-11651581,-7503672,7229157,14529944,-29734567,16014132,1243992,11539991},{12661056,-2804466,-19328067,-15936025,-23710185,13793843,17720444,-8263480,-26829959,5871009},{1,0,0,0,0,0,0,0,0,0},{5577246,-3463111,-29727276,2146857,-14414904,13347961,-7811776,164940,19376897,-15854104}},
+        {{-14447570,-7597264,16945081,-2590381,-28603581,3443925,3931338,-15764211,3306054,1020068},{28117834,-9037011,-33382953,6670216,-5535110,-7727683,23811818,-1786193,-17407853,2857346},{1,0,0,0,0,0,0,0,0,0},{-23793911,-13888662,-2054467,2672926,12000218,-4575250,-11771561,-11835626,2127645,2890586}},
+        {{-31623665,-13167161,28293162,-9844770,-10846303,-9075475,-1610184,-15010016,8013248,-3770189},{-30825736,13384583,15313702,9798564,-25279908,-4659073,13619753,13638211,-27743052,-549088},{1,0,0,0,0,0,0,0,0,0},{25384666,16719328,28463330,-10694430,26097128,10762438,19815946,3061388,4807315,-5552162}},
+        {{-29898504,1319986,-32300310,3266521,8269786,3340351,19588683,4345931,16790669,-7759861},{-20213462,-2532895,5571046,-11145771,-2874226,-13576426,-32415757,-14456082,18626000,5403360},{1,0,0,0,0,0,0,0,0,0},{20626916,3314979,22720881,5242486,-19621345,11320392,-7505739,8448341,6077988,16190697}},
+        {{32851381,9235815,17505213,-11257536,24818257,-4071904,-17548677,11631912,26481280,11786612},{-1141384,5842943,7942350,9626340,19406409,-7027986,29282783,-11939584,21820317,15627817},{1,0,0,0,0,0,0,0,0,0},{-32379759,-6860479,5255898,-13686701,20304507,-5715082,-23043766,-12685358,-16866681,-14758403}},
+        {{5563067,15794034,-13304697,4374306,-11978599,5420606,29082528,7357685,26332619,14035918},{-30463975,-8912518,-27573213,6712420,-31841632,2445186,29076631,15172954,32296375,-10916267},{1,0,0,0,0,0,0,0,0,0},{-19271605,4739187,27598095,-9116459,31980423,-11861111,22399210,-3505024,-11678935,-14714699}},
+        {{-14088086,-6837182,24675808,-14980621,33087382,-12636055,-15643576,3407831,7695680,10792997},{449591,-6268692,-1762365,-2,24650693,9339134,25732154,-6173759,16175810,-10500863},{1,0,0,0,0,0,0,0,0,0},{-27495134,6366928,-12029323,14075589,12367912,4488547,-6122558,-15341281,-821223,-10226580}},
+        {{-8582526,-12765432,-13839195,-8283055,-23606730,12437930,-5807168,3881262,-4051745,13505557},{5660102,-16397625,22925126,9886949,-19718164,5838723,29433664,8611076,9768821,2282779},{1,0,0,0,0,0,0,0,0,0},{30474204,11205599,-2618168,112325,25115544,6982135,-17610499,7155950,-450271,-2743675}},
+        {{21942746,10385081,-22869658,-15102815,15368465,-6039100,32665213,4254737,-20693805,-10710181},{-1170414,6716588,-28292245,15831921,10011426,6662152,2387170,13667316,22861268,-6745610},{1,0,0,0,0,0,0,0,0,0},{-5049920,-15625573,28752602,13382064,-5671081,-15568199,14420928,16230928,32906196,-13752434}},
+        {{23672426,-83733,-20479940,-5090674,9263319,4105761,29542657,16740651,-27079853,13967831},{-17106517,16170691,30611300,-14192363,-15744779,-4563942,5912464,2777835,19742678,-4849786},{1,0,0,0,0,0,0,0,0,0},{-19478437,3113342,-3082765,7806580,15363114,13475839,-6217855,-5491516,4945496,15245752}},
+        {{-16700233,12550209,22625102,15051878,-4067355,2097865,3276080,-6233660,29895132,-3820877},{297507,-10844318,17608947,15591945,1785846,15110796,13196739,-6982764,16915425,-12374781},{1,0,0,0,0,0,0,0,0,0},{7142023,6201497,10792125,6958794,33304798,-14916622,24810839,7117227,32693189,11571314}},
+        {{3936083,-158163,-27387606,-3039998,-27469770,-13338576,22407600,4719490,6442804,-6033854},{-22525882,-11312665,-6306664,-10861316,-15020010,13331453,-2102513,302199,25601225,-15521136},{1,0,0,0,0,0,0,0,0,0},{-18404558,4637718,-14600650,6135770,-10160552,-14385506,-28211915,-8859420,-9229718,-14668575}},
+        {{17351293,10237387,-17080623,-16204050,198540,6272391,-7932996,12916376,-17553143,8191695},{7162601,16436046,13327849,-8327462,4373576,12954330,-6433059,13669054,-29276230,-5282925},{1,0,0,0,0,0,0,0,0,0},{22524474,-10495190,15027907,-1430892,-4411615,-7103741,-24535973,-13601446,-7839418,10613833}},
+        {{-28204202,-12965461,18362445,15952522,-24169902,-8187870,-30343063,10570432,12327702,12152379},{509270,10200509,11415260,-8317518,-3916126,8796938,-6856723,-12886727,-17180687,-12098865},{1,0,0,0,0,0,0,0,0,0},{-12910992,-4074714,22644243,4490409,15344035,-10904277,-7593377,-16775716,24696451,-10804875}},
+        {{-26267839,-15013113,15761357,12576581,14462898,-15116927,28885563,-9712953,-28952122,-14423394},{-4691457,-11831473,-15381360,11689251,-1105771,4629942,26057316,-12740588,-26751141,6350281},{1,0,0,0,0,0,0,0,0,0},{576121,-7989859,-21487023,10743606,-24492400,6519152,-6987176,-9111109,21876265,-5085778}},
+        {{1219916,-13213665,-232858,8058653,-6235507,-8143377,7814121,-16255971,-8055120,-12656314},{20408372,-1502904,24699297,-2503444,-22223394,580004,17297632,-13404562,11491773,8297097},{1,0,0,0,0,0,0,0,0,0},{-16194883,-12517437,-25639631,-4165649,27073999,15126752,25221884,-1561727,-31689826,9073778}},
+        {{-31697771,16134064,-22203643,13100415,-29162942,7641787,-9936069,615069,-7590696,8980114},{17248533,2638786,-13857708,5124454,-7767077,-4029947,-12740534,-11243386,-5456632,-3368002},{1,0,0,0,0,0,0,0,0,0},{6243178,-13312003,17610740,-10649120,-23016800,-1979779,-5479198,2938141,-25820939,11684271}},
+        {{-9632956,756241,10073275,7545950,-31234923,-10145488,-24821056,-7871923,-2842494,-704331},{870454,-3185877,14636969,13327923,14863433,13139739,-28006158,4451657,29174730,-14075461},{1,0,0,0,0,0,0,0,0,0},{-25215489,-12250443,-3422690,14531493,33421654,-15757017,2230661,5039106,4526066,-11638158}},
+        {{5712436,6964939,-31952181,2586092,15009153,3768697,-9114809,7961075,-15981421,-83496},{13773999,14488417,17471301,-5198891,-19611557,-6970701,30009192,-732021,16382295,-7645496},{1,0,0,0,0,0,0,0,0,0},{22462961,-7676328,1446523,-4416392,-10857073,-15298897,-9834578,9490900,20802001,-6459740}},
+        {{9658804,-7109370,2912193,40429,-2635203,11775774,30709500,-8361982,5127962,-11960074},{-24198018,-3583707,-7084835,4474236,3924548,-635171,-13494511,6125017,-20155765,8951650},{1,0,0,0,0,0,0,0,0,0},{33327640,13006281,-10389955,-14573966,-13780729,-13510876,23787759,-16605678,11616180,2598364}},
+        {{10280785,951028,-23650851,-12796241,27029159,6665246,30742698,3233698,-11904709,-7998956},{23600297,1003907,-32802898,8089167,17738699,10320270,-22066138,-15303502,-19585627,-13172085},{1,0,0,0,0,0,0,0,0,0},{-4485562,9670056,-15666024,-1463424,-25105093,-9461445,12882716,-5030474,11687040,8260946}},
+        {{-29362123,12981448,27568764,-4254612,-21938311,-1261902,21756654,-14759214,-4453064,3577651},{-9283937,11895828,9386600,10271665,2949004,14655095,22108941,10202662,30447552,3575628},{1,0,0,0,0,0,0,0,0,0},{10909144,13414146,22321432,702257,20272693,1626072,13024469,12459673,11662065,15401844}},
+        {{12808238,-13730972,-11623074,7810097,5987109,-16047920,-5554944,-6206510,-32806610,4083189},{-17810941,-4211494,24351429,-10356575,-24423577,4283427,-11423647,9603231,-15856963,-5272723},{1,0,0,0,0,0,0,0,0,0},{-1078241,423948,-14849094,-10096856,-24058847,-4128377,14753608,15727619,-13747537,-4913640}},
+        {{10210163,-1467654,-25122311,8566131,21864414,15505274,23775764,-5470656,20158734,1546887},{14733662,-1813177,33016738,-8111283,-13315458,-11825711,-15808549,7233966,-27208632,-417225},{1,0,0,0,0,0,0,0,0,0},{9294211,-11597200,32232103,9835178,16108655,7014266,-14414952,-10687064,29741387,-14550639}},
+        {{-13504292,6375820,26299572,-6874490,-23951128,1085626,-21466930,-1592348,22254591,7226767},{-2803270,-1032681,32468117,13169992,-15661040,-13843737,-7179609,-8387127,15801834,10955263},{1,0,0,0,0,0,0,0,0,0},{-32161247,-15983708,4509930,-1366974,-525728,15926866,8044565,11658065,-2737725,-8533207}},
+        {{-9062605,10362156,-2471387,-5725571,656129,-1196950,-14338553,-12504191,15817005,-5834673},{10104894,-2302025,16784279,-4037461,-12089036,-12642040,19126609,8843511,-32312916,8274786},{1,0,0,0,0,0,0,0,0,0},{-21707207,-1528742,5587069,15178031,-12248979,5345465,11625152,2136867,-23123011,-10724156}},
+        {{12100048,5229486,-16125451,1927042,28378791,-8932300,32509328,4325437,-27845757,-2339787},{-33419525,15584049,7862373,-15151482,26357686,14506640,-21861150,7489810,31075869,-14016368},{1,0,0,0,0,0,0,0,0,0},{-23208097,16138605,4421585,12257838,25092370,7358406,14457128,15052674,-15679413,12452343}},
+        {{-6053190,1743134,-26184182,-11912370,-26145417,15798510,16219943,-8123864,21522791,-3790532},{-25308414,410946,-441018,7246638,-7837934,1546321,-20998976,-1805303,19148539,-2155486},{1,0,0,0,0,0,0,0,0,0},{-25620504,3296574,-20906404,6839701,5315971,-6829290,-5444607,14257275,-29589232,5846739}},
+        {{-23119047,-262933,-29296510,-10570583,19679590,-15953233,-28794112,3573839,-4924621,6637242},{-8911000,-3567214,31034401,-593279,-27681206,-10852593,-9912513,3316398,-31401112,4214133},{1,0,0,0,0,0,0,0,0,0},{-19576959,8904081,-20250659,7842319,-12510457,-6400093,-9472088,-16700784,-3940719,6226169}},
+        {{10334281,-115849,30465370,-14723444,2733587,-754802,-1639126,12562529,29920265,6069323},{15435792,-14118766,6264118,-4710192,-23004013,7801312,-17545819,-6437793,20992387,8017767},{1,0,0,0,0,0,0,0,0,0},{-19840613,-8410922,11363056,-12199089,-14130014,5153886,-26688469,-6332103,22234822,-9311148}},
+        {{-1143312,11041671,-17302947,-7692104,13358197,12716297,-9589782,9073325,30064728,-7955459},{-28945688,8852467,15240342,-7657427,22809799,3778699,2530025,-11500520,2144485,-6503405},{1,0,0,0,0,0,0,0,0,0},{9629750,-4534013,-29406995,8246900,-331594,-11188640,26773032,-3820561,-31750038,-15803551}},
+        {{29435535,9199293,6257470,-13998881,19492866,16195868,19041573,-2909682,18253953,-6617734},{32673367,-14838606,31262919,10811672,-1901545,10310871,22474536,-7280350,-16066802,2091131},{1,0,0,0,0,0,0,0,0,0},{11608095,-16453561,11664482,-13400194,-14093066,-13791916,15032152,1239578,884940,-7467227}},
+        {{-10737658,12091226,-2800053,-13361342,15244441,-3320893,10890614,12099759,-17764534,8134169},{-29763578,-14635964,-5594309,-9993510,-30154311,14517830,-2887448,6531671,24900660,13985627},{1,0,0,0,0,0,0,0,0,0},{29103964,4261223,24214124,7477786,-28871901,16514353,11264949,-3509627,-29378669,12599842}},
+        {{-14483415,-2503821,-26738554,10417875,-4476750,4521978,-22966010,-5598105,-5080956,15596437},{5195054,-8561300,-32640439,-767941,-26910879,-13322123,-7478190,8595426,11549565,9492363},{1,0,0,0,0,0,0,0,0,0},{32992803,-5002763,-22511759,-1759656,15718001,4879343,-11755150,-2344178,14934049,2973712}},
+        {{28054517,-6282594,19008838,-4318844,-22190198,1236466,22366019,-1988933,-23407410,-7335222},{18249570,-14143031,2403203,4889707,24941267,-14290570,-21409314,2517073,-22293653,-6989092},{1,0,0,0,0,0,0,0,0,0},{-13443078,6226574,-20371304,9718822,-7916357,-3348107,13338910,7781640,13477496,-8360829}},
+        {{15185042,-13802062,-3914529,-3002966,28187868,-5049594,-23280248,13060349,24124785,-4502922},{-10404325,-1375937,-1162191,3841761,19190699,14376504,-11660926,-7594264,-29920298,6479918},{1,0,0,0,0,0,0,0,0,0},{20321796,-3740169,18097070,-8724336,-31192450,-3344377,-3726467,4351359,-24246562,-6914918}},
+        {{31647707,3335742,-5254688,-15913067,14115972,-3923275,-28817689,-4596704,-31213177,3784426},{5692653,13775670,23401687,-1325719,12160068,-6555751,20024015,14335271,-22644989,3906737},{1,0,0,0,0,0,0,0,0,0},{-8130690,-9108099,-4278949,9923941,-31380024,-15448301,-3785298,-7885965,30023760,-13824591}},
+        {{-19515751,-2749045,21631526,-15810674,-14830779,14644690,-15038494,6338706,-26775402,4840995},{12325688,5480537,-15029172,12894150,23097961,9303919,-25656670,11291437,9343169,-1362064},{1,0,0,0,0,0,0,0,0,0},{3609449,-5547909,-7391072,-1834242,12656796,1342479,2155956,-5958167,-7145219,-10935799}},
+        {{9956820,-12728618,24120955,-8307294,27216266,10756162,23370548,9858177,-30354792,8643497},{28109027,12396295,10637057,-11043781,-5778954,-3776109,12979681,15687285,-17120149,8282033},{1,0,0,0,0,0,0,0,0,0},{-24901166,5803152,-5052981,11140553,-13223245,-12548965,-28778557,7725018,6026006,16677628}},
+        {{-5981972,15842044,-18507358,643270,-23288680,285836,-5622889,-1546059,-29707706,6089612},{-17049864,14938412,33311501,-14054609,28807751,8431491,8770655,-13175091,10234053,7396878},{1,0,0,0,0,0,0,0,0,0},{19271049,-15083306,18661047,-10410487,3694424,-14378503,15667211,-12398261,18451850,15810523}},
+        {{6602341,16476934,-13378234,-13239959,-29209099,-15219257,22052784,13180479,-9266073,765361},{-32661805,16619256,-26204132,6498776,9418403,7415040,-25045620,-12060870,13455328,13383069},{1,0,0,0,0,0,0,0,0,0},{18077636,2521917,-2866066,-5739364,-26096272,16437279,7952201,2308046,19084032,5776127}},
+        {{-12264224,7910542,14100522,-3715954,9782641,-3030284,23088557,-10454332,-4569145,10105876},{-5450814,5091981,10729109,-8330696,8684823,-928107,33335583,12990047,-25242259,13874024},{1,0,0,0,0,0,0,0,0,0},{6352502,-16271575,-15089581,1470217,-20377879,2996435,26091577,10348874,-29632376,14893630}},
+        {{17876383,15484325,-24523286,5812280,-17164278,1492773,12718511,-12976075,17252294,-10474276},{19641593,-10562967,29016925,1741257,-22753198,5591260,3170475,5716561,26451862,-8468665},{1,0,0,0,0,0,0,0,0,0},{11709708,-9930392,-881562,6059270,13001443,-5331059,24789914,-8843184,-12541086,14228625}},
+        {{-24748696,12352447,-2351594,9826505,1721960,-11575590,-16782644,14003851,-10956616,11808350},{29860993,1763496,-8631086,-8354641,-5802694,-4105917,-22606440,11437083,-18678893,-3227618},{1,0,0,0,0,0,0,0,0,0},{-12669390,-10783736,-14423610,5420529,16660340,-7729431,-711205,7559546,-15118631,9331394}},
+        {{16263359,9847741,1685738,2254001,-29290547,-8448998,-31681791,-7370612,-7407327,-6199977},{24775928,-4182609,-29253378,-6206272,25510418,3697367,4429554,-12840223,8722271,7285870},{1,0,0,0,0,0,0,0,0,0},{6703822,-14939363,-23775415,-12787232,-17664726,6060889,31123871,-15955079,4251671,13722661}},
+        {{-27364119,1135362,3168545,-1201493,-26918193,13661297,-30286557,5460878,-31703596,10192788},{9425735,-8017054,27976879,15443805,-26906596,15731379,28120976,-5346262,3014290,-755032},{1,0,0,0,0,0,0,0,0,0},{9973851,16210312,-3095333,7848963,-24417233,-7896174,8973422,2685187,21112543,5331466}},
+        {{28264022,2932862,-17367846,14540598,-26086513,11382338,17245279,-3004410,32307215,4729295},{28198094,10606060,-16420579,-4531369,28622613,5871529,-17238130,-9127716,-8964109,9429272},{1,0,0,0,0,0,0,0,0,0},{13438312,-16162999,31104415,9888323,1755925,-2564187,-12847990,9139092,-28646932,-13658849}},
+        {{10759907,-13336168,13192115,-4529503,12472743,-16466896,26434056,3114197,-11521389,9643894},{27547991,-10297812,-24099432,-10578150,19849002,10024081,13365106,-3952891,-13271448,11014261},{1,0,0,0,0,0,0,0,0,0},{9149679,5264667,541377,9133277,28333193,11901426,20424889,14262489,9610867,-9200207}},
+        {{4914514,-15569112,-20673795,12187996,-11333097,-9809191,-8649250,3670906,-17393383,-7369587},{-5669523,-13058663,-14947849,-8574040,3093999,13556206,-24027471,11284344,-31371396,8806008},{1,0,0,0,0,0,0,0,0,0},{-407836,-9060915,-33444652,-12799195,33157541,-12647898,-9596328,-4866442,32252878,9718942}},
+        {{-17035186,4028974,-29036684,10481626,-9349419,3630407,1737923,-11879052,6997526,741022},{-10309530,-3374466,-16326689,6415724,12481262,-9248372,13775953,-13261031,15306650,6780884},{1,0,0,0,0,0,0,0,0,0},{-13057824,-6198713,-22666331,-13891158,19568997,4228477,-21595003,2267312,-32420640,16647195}},
+        {{-19556872,-3247769,5216460,10727539,-67449,15603636,20827703,-8971481,1278343,8385603},{1582442,-16388309,-15162242,-8390265,19286669,-8425248,-27839181,6344103,31582409,-16701233},{1,0,0,0,0,0,0,0,0,0},{1545214,-4409693,-25812119,11986570,15409796,3044146,-19650664,-6847915,-28567924,-5248996}},
+        {{-15655956,10436278,14451794,-2837478,-14907148,9714936,12424117,13301776,32066718,-14218570},{-835006,14616845,9365802,-3089151,12640848,-6094392,30794662,4717713,-30740595,-7870410},{1,0,0,0,0,0,0,0,0,0},{-9624292,-1783130,-12093889,2550832,-17713570,-5941817,-6337290,-10235564,22431573,15396807}},
+        {{29335859,9807761,21894658,2878288,21756019,447027,-17937949,9153193,5167739,-11802839},{27188900,-15921908,29554805,3080683,-2351106,-3621002,-32634190,-367612,8112780,3277287},{1,0,0,0,0,0,0,0,0,0},{-10757448,-14265485,-7066523,3149661,-32871161,12242838,20996433,-4843283,4791587,5856992}},
+        {{14986935,6131102,-4594607,-9778313,7970189,13255,12266594,-8838651,28375747,4901377},{-7291821,10412914,7507288,4060404,-11344632,-10592747,-13962593,-9798607,-15332624,-13125470},{1,0,0,0,0,0,0,0,0,0},{-33375911,-12118143,22759267,14384035,15431729,-14875040,30549507,3393125,9302704,-4463247}},
+        {{22495052,-4147867,-4594148,-13275417,-19988589,-15753522,2493123,-8384639,-9529954,797139},{-12584953,-1368436,23601518,6482819,-3359621,2487882,6518609,-7065987,-17019854,-530925},{1,0,0,0,0,0,0,0,0,0},{-29877754,15880334,-14084793,2905983,3831701,13301691,5748403,-8958448,-14031288,9315270}},
+        {{-22583667,3995721,5278481,2264578,5424016,-2997316,-2726861,-13659841,-6847969,6063225},{30954632,15411682,28113470,15914732,-16130791,-16324477,-26042036,-1049902,30797579,10332584},{1,0,0,0,0,0,0,0,0,0},{22285387,-12066516,-22443481,-8926589,-118380,16608606,-271143,8941775,19117109,9020043}},
+        {{-16217365,6400687,24000178,16268752,-14138038,-3299076,29016410,-13490918,-11256673,-15466209},{-12871487,13654297,14482106,-14699775,7288915,11435738,16689360,-16702480,-10295937,-14437388},{1,0,0,0,0,0,0,0,0,0},{-10590204,11270859,31789819,-8473050,14210380,16648243,-23891714,-15398961,930926,13942909}},
+        {{-7419244,-6736505,23957293,-7071026,-25053596,3307681,22395185,-4106861,24194930,7770751},{-12426339,1358284,-25557620,-15079111,26578445,96783,18677309,226799,-6994673,8199716},{1,0,0,0,0,0,0,0,0,0},{22812765,1991711,-2243145,-8700085,5669657,-6808085,-8391315,5965067,25364914,-11289690}},
+        {{-31445531,-13047443,19147798,7191932,-29497632,-7840347,-11372331,12930619,-22143920,-2049623},{4334780,10470260,-23943894,-14218366,-223794,-9504447,-12805866,12295249,3881029,-13200298},{1,0,0,0,0,0,0,0,0,0},{-11532432,2419267,7204586,13234252,30868963,14557892,-23779238,-1754654,14255646,-15431731}},
+        {{25642044,-4544786,-28118705,11910944,24443885,-4642489,33415053,2872976,12492113,-16609603},{-31002111,-16321810,7276450,-11281009,15419936,-13817599,-8480085,1090302,-21044702,4840318},{1,0,0,0,0,0,0,0,0,0},{32925663,15787699,-29637598,10968920,-31909059,1549221,-6702374,11952514,19904856,-870613}},
+        {{21585352,8086246,-10677619,9706465,-29394059,1216424,700742,7389732,29703993,10153680},{31413814,5830892,-11383202,6164045,31491194,-2424627,-18639887,-3430083,-4772672,13867117},{1,0,0,0,0,0,0,0,0,0},{-3764194,-10797723,22177082,-15405990,12301328,-13499862,-10270264,63630,-32858059,878002}},
+        {{10460308,-370180,-22279542,-7794327,-10407333,921045,-12706799,-2977359,7048184,3114945},{31855247,-13137931,-32716818,9633969,10738981,2905759,9062136,-1947028,6888381,-444410},{1,0,0,0,0,0,0,0,0,0},{-27723151,-9341094,-14523989,-16268940,8744250,9949441,-8778779,16721903,-32694718,-6238704}},
+        {{8337932,5450482,26973729,-11861160,-13524456,-11559437,12476921,3540660,28517775,-15661849},{2030617,11930207,-32531836,12332556,18901917,9112729,-20808796,9638127,7907485,6692402},{1,0,0,0,0,0,0,0,0,0},{22711487,-13839016,-21860190,-6320921,33343815,4928767,32006902,6212203,33453644,11930873}},
+        {{-32084861,-4572203,28219009,-3117605,20655347,-2702676,-10044610,14638570,27151284,4141166},{-2148515,-7706541,-14798162,13331274,-2134630,6128622,24365610,-5719986,1138652,13932242},{1,0,0,0,0,0,0,0,0,0},{-25102889,15655689,26296646,14980161,792629,-13787550,2090855,-4251882,-31878600,-5954458}},
+        {{-2384256,-10575873,2896366,1998486,-12507993,7346385,-26282624,-6725554,26526171,2164987},{12774559,9986267,-29362353,1417557,-23565961,-13348987,-11745891,-849909,7387424,-11077871},{1,0,0,0,0,0,0,0,0,0},{-1488816,3035003,11673065,12579807,-5359515,-14694807,23439448,-4494989,33096138,-9474566}},
+        {{-12890163,-12223963,8130274,-676967,-12418761,-8150343,19415241,-3870884,15252566,-4001663},{-23255339,16576155,-25198439,15020211,-16713438,7903996,-19686531,11675189,-29080390,4432935},{1,0,0,0,0,0,0,0,0,0},{9679276,-1730380,-16155422,4680321,2742298,-5594528,-13589392,2212296,31896783,8514375}},
+        {{2197167,3407868,-11213508,-8687295,17853290,-1415848,-6132758,15075735,-4313930,33796},{1234917,-9180678,-30536484,10516795,-11405365,-5714587,11942353,4711823,-14595700,175681},{1,0,0,0,0,0,0,0,0,0},{12435162,14997984,-9018376,-15464836,3488060,-15631167,8804649,10178454,10330609,-6076448}},
+        {{-13355273,13252673,-8446524,-8893759,-20055044,-9638867,4722855,6152747,-13628029,-15429138},{-18953016,-4902950,-30508937,-5564738,15637859,-2754095,-30115968,14183527,-27239936,4273812},{1,0,0,0,0,0,0,0,0,0},{-26721296,12120529,-8091602,-3792105,-31651265,-15887087,-29034481,6103898,-12578843,-4310471}},
+        {{8361841,5442763,-22882582,-805026,10821242,4118749,29630411,3375835,-4014936,6793096},{27498026,-10520489,4901578,-12974759,-25285333,-11353098,31310638,6926642,-8086729,-11682124},{1,0,0,0,0,0,0,0,0,0},{1478343,-11688416,-7600014,10660195,3276505,-10164742,-6703100,-15718009,-25132509,-3045373}},
+        {{7422873,10391503,-26066843,12375418,-28621443,-15697845,-22363207,9485908,10613154,-12545046},{-22770365,-8775869,28094076,4320019,24129620,-16753352,7530436,4848085,-25966578,-5238806},{1,0,0,0,0,0,0,0,0,0},{-6719846,-10309257,-29431119,11367104,15435531,-8352793,27771176,6074601,633847,15685147}},
+        {{24251173,12772546,-29207036,-12183184,7221217,-4975133,23935973,13552636,-22719126,5102040},{-32907227,-16295422,-30794949,9349818,18380493,-12030238,-24702281,-14347844,-26569214,-14603435},{1,0,0,0,0,0,0,0,0,0},{-22448603,2120313,7031840,16085608,11359977,1740164,-10473381,13122967,-19182498,9545616}},
+        {{24916252,-2048869,10427510,-7986048,30262036,-7243477,-30847648,7621557,11459640,3177424},{15811754,-14159252,14224114,-12869621,7068404,15117842,-5480296,5340937,25736904,-2923070},{1,0,0,0,0,0,0,0,0,0},{10423411,-14022338,-25552174,10681799,-9011121,-5607604,29108210,-728360,-8332158,10930019}},
+        {{33187816,-16611431,-18990540,-4460444,17217289,12595188,-3649810,-16568302,-1974343,-15119795},{27884130,1480358,-6395900,3268171,-7310313,-4826572,20218013,3999437,2864326,-16571398},{1,0,0,0,0,0,0,0,0,0},{-26100805,-16743948,-32219692,1395740,22042454,552942,-13610688,9506311,-6303942,-15939544}},
+        {{-8354256,-6291020,-30530836,-12704615,-4432048,6215212,-8046355,-16052517,32444518,-8397677},{-21642857,-1950741,-21212810,982419,1929631,-12061406,849870,8811291,27333006,15169745},{1,0,0,0,0,0,0,0,0,0},{-17068664,10169860,-26663648,4337611,-7311988,-2483488,13170628,-6771765,4837363,-14541080}},
+        {{-8062396,8684106,30872582,2782867,27121257,10736787,13844598,-10079781,7432604,3601048},{30613489,8888932,13942879,4160920,32127807,1907093,7522110,16756868,-3362247,-6571025},{1,0,0,0,0,0,0,0,0,0},{23049679,11728612,22898728,11764070,8432644,-10106868,21189812,9498973,1893180,-11712595}},
+        {{-11524566,-1923536,-552412,2962214,6953598,9728708,21987967,7462062,10402535,635053},{9636725,-10290325,2456010,9159714,4220357,-15408031,-26314254,2722721,25858386,-11293229},{1,0,0,0,0,0,0,0,0,0},{-11306910,10093025,10776308,-6421789,-31778594,-7336721,5507274,-14511156,-1544706,16544235}},
+        {{14024803,7037382,-13463871,14926835,-30523063,-8826274,17609736,-2122526,-16793546,7159699},{5928904,3276475,9946266,15683375,22994737,2269375,6886495,-9919867,14350370,-295063},{1,0,0,0,0,0,0,0,0,0},{-27649282,-7208777,16827425,5519137,-24000995,-15898360,-31902774,13797078,3571637,8554549}},
+        {{33264946,-11283568,17918575,15048835,-8680381,-11425400,8815670,-5680336,25630808,-14465388},{-12878563,7037377,-7761768,-1033,19824973,-7151683,-30837387,-13751579,10467584,14887180},{1,0,0,0,0,0,0,0,0,0},{25236706,12032577,26874778,-14790842,-1800189,-1865333,-9479516,5096163,16521178,5937201}},
+        {{-26700195,13002545,29004003,-2480414,25151804,13915294,-9754202,10149424,-3742331,10639677},{27433638,5972208,-5962417,-14876939,-3448098,-8829855,8957262,-7538041,12655774,15159615},{1,0,0,0,0,0,0,0,0,0},{-2207726,-1657564,7289183,-5970391,15761592,3283112,11268262,-7585938,-16026973,12348942}},
+        {{16671214,12113846,-4431926,-16222634,-18229913,13751103,15352678,-15000,-23739431,14886657},{22744533,-138069,-28702554,265097,7226217,-1711083,-10329200,-3686806,11677725,8335675},{1,0,0,0,0,0,0,0,0,0},{12184440,-14901266,-1075225,-7511441,-23005678,16078316,-8176269,6208611,31756516,5351379}},
+        {{19865019,9131809,-21221350,4840664,24313843,9962995,-25577273,-9365396,29529642,-5852256},{1825364,-10073021,-25142498,1573026,20635203,-7868288,-30137459,-14668494,27113371,13294236},{1,0,0,0,0,0,0,0,0,0},{-14951789,-15117134,-3803402,16433544,20362531,598543,16253627,8948153,-31442141,-15921407}},
+        {{-29749785,3115090,-24683417,13524186,-21009448,7057328,-648393,5294271,26633598,-16101324},{-30954180,-8084900,-24961905,-16305686,6280416,10123025,9862054,3854131,12599076,8129910},{1,0,0,0,0,0,0,0,0,0},{-10164779,-6306923,-20228468,6825770,5575024,12804536,32454069,-11119719,-18173171,8867431}},
+};
@@ -0,0 +1,18 @@
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "crypto/crypto-ops.h"
+
+// Number of Hi/Gi generators (i.e. maxN * maxM in bulletproofs.cc)
+#define BULLETPROOF_GENERATORS 1024
+
+// Precomputed bulletproof generator points; see bulletproofs_generators.c
+extern const ge_p3 bulletproof_Hi_p3[BULLETPROOF_GENERATORS];
+extern const ge_p3 bulletproof_Gi_p3[BULLETPROOF_GENERATORS];
+
+#ifdef __cplusplus
+}
+#endif
@@ -91,4 +91,15 @@ struct NO_ARGS : virtual RPC_COMMAND {};
 /// if specified).
 struct LEGACY : virtual RPC_COMMAND {};
 
+/// Specifies that a public RPC call is cheap and latency sensitive (e.g. status polls that other
+/// services depend on).  Such calls run in their own worker category, with reserved threads, so
+/// that they don't wait behind expensive calls.  (Non-public calls always run in the admin
+/// category, with or without this).
+struct FAST : virtual RPC_COMMAND {};
+
+/// Specifies that a public RPC call can be expensive (e.g. returning many blocks, transactions,
+/// or outputs).  Such calls run in their own worker category with a limit on how many may run at
+/// once, so that they can't tie up all of the RPC workers.
+struct HEAVY : virtual RPC_COMMAND {};
+
 }  // namespace cryptonote::rpc
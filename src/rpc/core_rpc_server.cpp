@@ -48,6 +48,7 @@
 #include "common/guts.h"
 #include "common/json_binary_proxy.h"
 #include "common/oxen.h"
+#include "common/profiler.h"
 #include "common/random.h"
 #include "common/sha256sum.h"
 #include "common/string_util.h"
@@ -67,6 +68,8 @@
 #include "cryptonote_core/service_node_rules.h"
 #include "cryptonote_core/tx_sanity_check.h"
 #include "cryptonote_core/uptime_proof.h"
+#include "epee/net/command_stats.h"
+#include "epee/net/connection_basic.hpp"
 #include "epee/net/network_throttle.hpp"
 #include "epee/string_tools.h"
 #include "l2_tracker/events.h"
@@ -90,6 +93,18 @@ static auto logcat = log::Cat("daemon.rpc");
 
 namespace {
 
+    template <typename RPC>
+    constexpr rpc_category rpc_category_of() {
+        if constexpr (!std::is_base_of_v<PUBLIC, RPC>)
+            return rpc_category::admin;
+        else if constexpr (std::is_base_of_v<FAST, RPC>)
+            return rpc_category::fast;
+        else if constexpr (std::is_base_of_v<HEAVY, RPC>)
+            return rpc_category::heavy;
+        else
+            return rpc_category::normal;
+    }
+
     template <typename RPC>
     void register_rpc_command(
             std::unordered_map<std::string, std::shared_ptr<const rpc_command>>& regs) {
@@ -97,10 +112,12 @@ namespace {
         auto cmd = std::make_shared<rpc_command>();
         cmd->is_public = std::is_base_of_v<PUBLIC, RPC>;
         cmd->is_legacy = std::is_base_of_v<LEGACY, RPC>;
+        cmd->category = rpc_category_of<RPC>();
 
         // Temporary: remove once RPC conversion is complete
         static_assert(!FIXME_has_nested_response_v<RPC>);
 
+        cmd->name = RPC::names()[0];
         cmd->invoke = make_invoke<RPC, core_rpc_server, rpc_command>();
 
         for (const auto& name : RPC::names())
@@ -112,8 +129,10 @@ namespace {
             std::unordered_map<std::string, std::shared_ptr<const rpc_command>>& regs) {
         static_assert(std::is_base_of_v<BINARY, RPC> && !std::is_base_of_v<LEGACY, RPC>);
         auto cmd = std::make_shared<rpc_command>();
+        cmd->name = RPC::names()[0];
         cmd->is_public = std::is_base_of_v<PUBLIC, RPC>;
         cmd->is_binary = true;
+        cmd->category = rpc_category_of<RPC>();
 
         // Legacy binary request; these still use epee serialization, and should be considered
         // deprecated (tentatively to be removed in Oxen 11).
@@ -157,6 +176,10 @@ namespace {
         return (value + quantum - 1) / quantum * quantum;
     }
 
+    int64_t to_microseconds(std::chrono::nanoseconds t) {
+        return std::chrono::duration_cast<std::chrono::microseconds>(t).count();
+    }
+
 }  // namespace
 
 const std::unordered_map<std::string, std::shared_ptr<const rpc_command>> rpc_commands =
@@ -172,7 +195,76 @@ void core_rpc_server::init_options(
 core_rpc_server::core_rpc_server(
         core& cr,
         nodetool::node_server<cryptonote::t_cryptonote_protocol_handler<cryptonote::core>>& p2p) :
-        m_core(cr), m_p2p(p2p) {}
+        m_core(cr), m_p2p(p2p) {
+    m_core.blockchain.hook_block_post_add([this](const auto&) { send_sn_changes(); });
+}
+//------------------------------------------------------------------------------------------------------------------------------
+void core_rpc_server::add_sn_changes_listener(
+        std::function<bool()> active,
+        std::function<void(std::shared_ptr<const sn_list_changes>)> f) {
+    std::lock_guard lock{m_sn_changes_mutex};
+    m_sn_changes_listeners.push_back({std::move(active), std::move(f)});
+}
+//------------------------------------------------------------------------------------------------------------------------------
+std::vector<sn_change_tracker::node> core_rpc_server::sn_change_nodes() {
+    auto& snl = m_core.service_node_list;
+    std::vector<sn_change_tracker::node> nodes;
+    for (auto& info : snl.get_service_node_list_state()) {
+        auto& n = nodes.emplace_back(std::move(info), 0);
+        snl.access_proof(n.info.pubkey, [&n](const auto& proof) {
+            n.proof_timestamp = proof.timestamp;
+        });
+    }
+    return nodes;
+}
+//------------------------------------------------------------------------------------------------------------------------------
+void core_rpc_server::prime_sn_changes() {
+    {
+        std::lock_guard lock{m_sn_changes_mutex};
+        if (m_sn_changes.primed())
+            return;
+    }
+    // Collect the list without holding our lock, as send_sn_changes gets called with the
+    // blockchain locked.
+    auto nodes = sn_change_nodes();
+    auto [height, hash] = m_core.blockchain.get_tail_id();
+    std::lock_guard lock{m_sn_changes_mutex};
+    if (!m_sn_changes.primed())
+        m_sn_changes.update(height, hash, std::move(nodes));
+}
+//------------------------------------------------------------------------------------------------------------------------------
+void core_rpc_server::send_sn_changes() {
+    {
+        std::lock_guard lock{m_sn_changes_mutex};
+        if (std::none_of(
+                    m_sn_changes_listeners.begin(),
+                    m_sn_changes_listeners.end(),
+                    [](const auto& l) { return l.active(); })) {
+            // Nobody to tell, so don't keep a copy of the list either; the next subscriber primes
+            // it again.
+            m_sn_changes.reset();
+            return;
+        }
+    }
+    // While syncing, leave the tracker as of the last notification: the first block once we are
+    // synced then reports everything that changed in the meantime.
+    if (!check_core_ready())
+        return;
+
+    OXEN_PROFILE_SCOPE("rpc::send_sn_changes");
+    auto nodes = sn_change_nodes();
+    // During a reorg this gets called for each of the new blocks, but the service node list is
+    // already at the last of them, so we report the whole change with the first call.
+    auto [height, hash] = m_core.blockchain.get_tail_id();
+
+    std::lock_guard lock{m_sn_changes_mutex};
+    auto changes = std::make_shared<const sn_list_changes>(
+            m_sn_changes.update(height, hash, std::move(nodes)));
+    if (changes->empty())
+        return;
+    for (const auto& l : m_sn_changes_listeners)
+        l.notify(changes);
+}
 //------------------------------------------------------------------------------------------------------------------------------
 bool core_rpc_server::check_core_ready() {
     return m_p2p.get_payload_object().is_synchronized();
@@ -315,8 +407,165 @@ void core_rpc_server::invoke(GET_NET_STATS& get_net_stats, rpc_context) {
         get_net_stats.response["total_packets_out"] = packets;
         get_net_stats.response["total_bytes_out"] = bytes;
     }
+    {
+        auto [writes, messages] = epee::net_utils::connection_basic::get_send_write_stats();
+        get_net_stats.response["total_writes_out"] = writes;
+        get_net_stats.response["total_messages_out"] = messages;
+    }
+    get_net_stats.response["incoming_tx_parses_skipped"] = m_core.get_incoming_tx_parses_skipped();
     get_net_stats.response["status"] = STATUS_OK;
 }
+//------------------------------------------------------------------------------------------------------------------------------
+namespace {
+    std::string levin_command_name(uint32_t id) {
+        switch (id) {
+            case nodetool::COMMAND_HANDSHAKE::ID: return "COMMAND_HANDSHAKE";
+            case nodetool::COMMAND_TIMED_SYNC::ID: return "COMMAND_TIMED_SYNC";
+            case nodetool::COMMAND_PING::ID: return "COMMAND_PING";
+            case nodetool::COMMAND_REQUEST_SUPPORT_FLAGS::ID: return "COMMAND_REQUEST_SUPPORT_FLAGS";
+            case NOTIFY_NEW_TRANSACTIONS::ID: return "NOTIFY_NEW_TRANSACTIONS";
+            case NOTIFY_REQUEST_GET_BLOCKS::ID: return "NOTIFY_REQUEST_GET_BLOCKS";
+            case NOTIFY_RESPONSE_GET_BLOCKS::ID: return "NOTIFY_RESPONSE_GET_BLOCKS";
+            case NOTIFY_REQUEST_CHAIN::ID: return "NOTIFY_REQUEST_CHAIN";
+            case NOTIFY_RESPONSE_CHAIN_ENTRY::ID: return "NOTIFY_RESPONSE_CHAIN_ENTRY";
+            case NOTIFY_NEW_FLUFFY_BLOCK::ID: return "NOTIFY_NEW_FLUFFY_BLOCK";
+            case NOTIFY_REQUEST_FLUFFY_MISSING_TX::ID: return "NOTIFY_REQUEST_FLUFFY_MISSING_TX";
+            case NOTIFY_NEW_COMPACT_BLOCK::ID: return "NOTIFY_NEW_COMPACT_BLOCK";
+            case NOTIFY_TX_ANNOUNCE::ID: return "NOTIFY_TX_ANNOUNCE";
+            case NOTIFY_BTENCODED_UPTIME_PROOF::ID: return "NOTIFY_BTENCODED_UPTIME_PROOF";
+            case NOTIFY_UPTIME_PROOF_ANNOUNCE::ID: return "NOTIFY_UPTIME_PROOF_ANNOUNCE";
+            case NOTIFY_REQUEST_UPTIME_PROOFS::ID: return "NOTIFY_REQUEST_UPTIME_PROOFS";
+            case NOTIFY_REQUEST_BLOCK_BLINKS::ID: return "NOTIFY_REQUEST_BLOCK_BLINKS";
+            case NOTIFY_RESPONSE_BLOCK_BLINKS::ID: return "NOTIFY_RESPONSE_BLOCK_BLINKS";
+            case NOTIFY_REQUEST_GET_TXS::ID: return "NOTIFY_REQUEST_GET_TXS";
+            case NOTIFY_NEW_SERVICE_NODE_VOTE::ID: return "NOTIFY_NEW_SERVICE_NODE_VOTE";
+        }
+        return std::to_string(id);
+    }
+
+    json json_command_stats(const epee::net_utils::command_stats& s, bool queued) {
+        json info{
+                {"count", s.count},
+                {"bytes_in", s.bytes_in},
+                {"bytes_out", s.bytes_out},
+                {"cpu_us", to_microseconds(s.cpu_time)},
+                {"max_cpu_us", to_microseconds(s.max_cpu_time)},
+        };
+        if (queued) {
+            info["queue_us"] = to_microseconds(s.queue_delay);
+            info["max_queue_us"] = to_microseconds(s.max_queue_delay);
+        }
+        return info;
+    }
+
+    // Appends `stats` to `out` in Prometheus text format, as `oxend_{kind}_{metric}` counters
+    // labelled with the command name.
+    template <typename Stats, typename NameFn>
+    void append_prometheus_stats(
+            std::string& out, std::string_view kind, const Stats& stats, NameFn name, bool queued) {
+        auto add_metric = [&](std::string_view metric, auto value) {
+            out += "# TYPE oxend_{}_{} counter\n"_format(kind, metric);
+            for (const auto& [key, s] : stats)
+                out += "oxend_{}_{}{{command=\"{}\"}} {}\n"_format(
+                        kind, metric, name(key), value(s));
+        };
+        using seconds_d = std::chrono::duration<double>;
+        add_metric("messages_total", [](const auto& s) { return s.count; });
+        add_metric("bytes_in_total", [](const auto& s) { return s.bytes_in; });
+        add_metric("bytes_out_total", [](const auto& s) { return s.bytes_out; });
+        add_metric("cpu_seconds_total", [](const auto& s) {
+            return seconds_d{s.cpu_time}.count();
+        });
+        if (queued)
+            add_metric("queue_seconds_total", [](const auto& s) {
+                return seconds_d{s.queue_delay}.count();
+            });
+    }
+}  // namespace
+//------------------------------------------------------------------------------------------------------------------------------
+void core_rpc_server::invoke(GET_COMMAND_STATS& get_command_stats, rpc_context) {
+    auto& stats = epee::net_utils::command_stats();
+    const auto levin = stats.levin.snapshot();
+    const auto omq = stats.omq.snapshot();
+    const auto rpc = stats.rpc.snapshot();
+
+    auto& res = get_command_stats.response;
+    res["levin"] = json::object();
+    for (const auto& [id, s] : levin) {
+        auto& info = res["levin"][levin_command_name(id)] = json_command_stats(s, false);
+        info["id"] = id;
+    }
+    res["omq"] = json::object();
+    for (const auto& [name, s] : omq)
+        res["omq"][name] = json_command_stats(s, false);
+    res["rpc"] = json::object();
+    for (const auto& [name, s] : rpc)
+        res["rpc"][name] = json_command_stats(s, true);
+
+    const auto categories = m_admission.stats();
+    auto& cats = res["rpc_categories"] = json::object();
+    for (size_t i = 0; i < categories.size(); i++) {
+        const auto& s = categories[i];
+        cats[std::string{to_string(static_cast<rpc_category>(i))}] = json{
+                {"started", s.started},
+                {"waited", s.waited},
+                {"rejected", s.rejected},
+                {"running", s.running},
+                {"queued", s.queued},
+                {"queue_us", to_microseconds(s.queue_time)},
+                {"max_queue_us", to_microseconds(s.max_queue_time)},
+                {"run_us", to_microseconds(s.run_time)},
+                {"max_run_us", to_microseconds(s.max_run_time)},
+        };
+    }
+
+    auto connections = m_p2p.get_payload_object().get_connections();
+    connections.sort([](const connection_info& a, const connection_info& b) {
+        return a.handler_cpu_time > b.handler_cpu_time;
+    });
+    auto& c = res["connections"] = json::array();
+    for (const auto& ci : connections)
+        c.push_back(json{
+                {"connection_id", ci.connection_id},
+                {"address", ci.address},
+                {"peer_id", ci.peer_id},
+                {"recv_count", ci.recv_count},
+                {"send_count", ci.send_count},
+                {"handled_count", ci.handled_count},
+                {"handler_cpu_us", to_microseconds(ci.handler_cpu_time)},
+        });
+
+    if (get_command_stats.request.prometheus) {
+        std::string text;
+        append_prometheus_stats(text, "levin", levin, levin_command_name, false);
+        append_prometheus_stats(text, "omq", omq, [](const auto& n) { return n; }, false);
+        append_prometheus_stats(text, "rpc", rpc, [](const auto& n) { return n; }, true);
+        res["prometheus"] = std::move(text);
+    }
+
+    res["status"] = STATUS_OK;
+}
+//------------------------------------------------------------------------------------------------------------------------------
+void core_rpc_server::invoke(PROFILE& profile, rpc_context) {
+    const auto& req = profile.request;
+    if (!req.format.empty() && req.format != "folded" && req.format != "chrome")
+        throw rpc_error{
+                ERROR_WRONG_PARAM,
+                "Invalid profile format '{}': expected 'folded' or 'chrome'"_format(req.format)};
+
+    if (req.enable)
+        tools::profiler::enable(*req.enable);
+    profile.response["enabled"] = tools::profiler::enabled();
+
+    if (!req.format.empty()) {
+        auto samples = tools::profiler::collect(std::chrono::seconds{req.seconds});
+        profile.response["samples"] = samples.size();
+        profile.response["profile"] = req.format == "chrome"
+                                            ? tools::profiler::to_chrome_trace(samples)
+                                            : tools::profiler::to_folded(samples);
+    }
+    profile.response["status"] = STATUS_OK;
+}
 namespace {
     //------------------------------------------------------------------------------------------------------------------------------
     class pruned_transaction {
@@ -1373,6 +1622,43 @@ void core_rpc_server::invoke(
     get_transaction_pool_hashes.response["status"] = STATUS_OK;
 }
 //------------------------------------------------------------------------------------------------------------------------------
+void core_rpc_server::invoke(GET_TRANSACTION_POOL_CHANGES& changes, rpc_context context) {
+    auto& res = changes.response;
+    std::optional<tx_memory_pool::pool_changes> delta;
+    if (changes.request.since)
+        delta = m_core.mempool.get_changes_since(changes.request.since, context.admin);
+
+    std::vector<crypto::hash> added;
+    if (delta) {
+        res["full"] = false;
+        res["cookie"] = delta->cookie;
+        added = std::move(delta->added);
+        changes.response_hex["removed"] = delta->removed;
+    } else {
+        // Take the cookie first: anything that changes while we fetch the pool will then show up
+        // (again) in the next call's changes, which is harmless.
+        res["full"] = true;
+        res["cookie"] = m_core.mempool.cookie();
+        m_core.mempool.get_transaction_hashes(added, context.admin);
+    }
+
+    if (changes.request.tx_blobs) {
+        std::vector<crypto::hash> found;
+        auto blobs = changes.response_hex["added_blobs"];
+        *blobs = json::array();
+        std::string blob;
+        for (const auto& txid : added) {
+            if (!m_core.mempool.get_transaction(txid, blob))
+                continue;
+            found.push_back(txid);
+            blobs.push_back(blob);
+        }
+        added = std::move(found);
+    }
+    changes.response_hex["added"] = added;
+    res["status"] = STATUS_OK;
+}
+//------------------------------------------------------------------------------------------------------------------------------
 void core_rpc_server::invoke(GET_TRANSACTION_POOL_STATS& stats, rpc_context) {
     auto txpool = m_core.mempool.get_transaction_stats(stats.request.include_unrelayed);
     json pool_stats{
@@ -1714,6 +2000,8 @@ static json json_connection_info(const connection_info& ci) {
             {"recv_idle_ms", ci.recv_idle_time.count()},
             {"send_count", ci.send_count},
             {"send_idle_ms", ci.send_idle_time.count()},
+            {"handled_count", ci.handled_count},
+            {"handler_cpu_us", to_microseconds(ci.handler_cpu_time)},
             {"state", ci.state},
             {"live_ms", ci.live_time.count()},
             {"avg_download", ci.avg_download},
@@ -2885,6 +3173,31 @@ void core_rpc_server::fill_sn_response_entry(
     }
 }
 
+//------------------------------------------------------------------------------------------------------------------------------
+json core_rpc_server::sn_changes_response(
+        const sn_list_changes& changes,
+        const std::unordered_set<std::string>& fields,
+        bool is_bt) {
+    const auto format = is_bt ? json_binary_proxy::fmt::bt : json_binary_proxy::fmt::hex;
+    json result{{"height", changes.height}};
+    json_binary_proxy binary{result, format};
+    binary["block_hash"] = changes.block_hash;
+    for (auto [key, nodes] :
+         {std::pair{"added", &changes.added},
+          std::pair{"changed", &changes.changed},
+          std::pair{"proof_updated", &changes.proof_updated}}) {
+        auto& entries = (result[key] = json::array());
+        for (const auto& sn_info : *nodes) {
+            auto& entry = entries.emplace_back(json::object());
+            fill_sn_response_entry(entry, is_bt, fields, sn_info, changes.height);
+            // Always included, whether requested or not, as it identifies the entry
+            json_binary_proxy{entry, format}["service_node_pubkey"] = sn_info.pubkey;
+        }
+    }
+    binary["removed"] = changes.removed;
+    return result;
+}
+
 //------------------------------------------------------------------------------------------------------------------------------
 void core_rpc_server::invoke(GET_SERVICE_NODES& sns, rpc_context) {
     auto& req = sns.request;
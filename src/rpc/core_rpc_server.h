@@ -43,6 +43,8 @@
 #include "cryptonote_protocol/cryptonote_protocol_handler.h"
 #include "p2p/net_node.h"
 #include "rpc/common/rpc_command.h"
+#include "rpc/rpc_admission.h"
+#include "rpc/sn_changes.h"
 
 #undef OXEN_DEFAULT_LOG_CATEGORY
 #define OXEN_DEFAULT_LOG_CATEGORY "daemon.rpc"
@@ -70,6 +72,8 @@ struct rpc_command {
     // Called with the incoming command data; returns the response body if all goes well,
     // otherwise throws an exception.
     result_type (*invoke)(rpc_request&&, core_rpc_server&);
+    std::string_view name;  // primary name of the command (e.g. for stats)
+    rpc_category category;  // the worker category the command runs in
     bool is_public;  // callable via restricted RPC
     bool is_binary;  // only callable at /name (for HTTP RPC), and binary data, not JSON.
     bool is_legacy;  // callable at /name (for HTTP RPC), even though it is JSON (for backwards
@@ -129,11 +133,37 @@ class core_rpc_server {
 
     network_type nettype() const { return m_core.get_nettype(); }
 
+    /// Admission control shared by all of the RPC listeners (HTTP and OMQ)
+    rpc_admission& admission() { return m_admission; }
+
+    /// Registers a callback to be invoked, after each new block, with the changes that the block
+    /// made to the service node list (if any).  The changes are computed once per block and shared
+    /// between all callbacks, which are called on the thread that added the block.  `active`
+    /// returns whether the listener currently has anyone to notify; while no listener does (and
+    /// while we are still syncing) the changes aren't worked out at all.
+    void add_sn_changes_listener(
+            std::function<bool()> active,
+            std::function<void(std::shared_ptr<const sn_list_changes>)> f);
+
+    /// Called by listeners when they gain a subscriber: starts tracking the service node list, if
+    /// it wasn't already, so that the next notification has something to compare against.
+    void prime_sn_changes();
+
+    /// Renders service node list changes as sent to sn_changes subscribers: the height and hash of
+    /// the block, the pubkey plus the requested `fields` (as accepted by get_service_nodes) of each
+    /// added, changed, and proof-updated node, and the pubkeys of removed nodes.
+    nlohmann::json sn_changes_response(
+            const sn_list_changes& changes,
+            const std::unordered_set<std::string>& fields,
+            bool is_bt);
+
     // JSON & bt-encoded RPC endpoints
     void invoke(ONS_RESOLVE& resolve, rpc_context context);
     void invoke(GET_HEIGHT& req, rpc_context context);
     void invoke(GET_INFO& info, rpc_context context);
     void invoke(GET_NET_STATS& get_net_stats, rpc_context context);
+    void invoke(GET_COMMAND_STATS& get_command_stats, rpc_context context);
+    void invoke(PROFILE& profile, rpc_context context);
     void invoke(GET_OUTPUTS& get_outputs, rpc_context context);
     void invoke(HARD_FORK_INFO& hfinfo, rpc_context context);
     void invoke(START_MINING& start_mining, rpc_context context);
@@ -143,6 +173,7 @@ class core_rpc_server {
     void invoke(GET_BLOCK_COUNT& getblockcount, rpc_context context);
     void invoke(MINING_STATUS& mining_status, rpc_context context);
     void invoke(GET_TRANSACTION_POOL_HASHES& get_transaction_pool_hashes, rpc_context context);
+    void invoke(GET_TRANSACTION_POOL_CHANGES& get_transaction_pool_changes, rpc_context context);
     void invoke(GET_TRANSACTION_POOL_STATS& get_transaction_pool_stats, rpc_context context);
     void invoke(GET_TRANSACTIONS& req, rpc_context context);
     void invoke(GET_CONNECTIONS& get_connections, rpc_context context);
@@ -226,6 +257,9 @@ class core_rpc_server {
   private:
     bool check_core_ready();
 
+    void send_sn_changes();
+    std::vector<sn_change_tracker::node> sn_change_nodes();
+
     void fill_sn_response_entry(
             nlohmann::json& entry,
             bool is_bt,
@@ -235,6 +269,15 @@ class core_rpc_server {
 
     core& m_core;
     nodetool::node_server<cryptonote::t_cryptonote_protocol_handler<cryptonote::core>>& m_p2p;
+    rpc_admission m_admission;
+
+    struct sn_changes_listener {
+        std::function<bool()> active;
+        std::function<void(std::shared_ptr<const sn_list_changes>)> notify;
+    };
+    std::mutex m_sn_changes_mutex;
+    sn_change_tracker m_sn_changes;
+    std::vector<sn_changes_listener> m_sn_changes_listeners;
 };
 
 }  // namespace cryptonote::rpc
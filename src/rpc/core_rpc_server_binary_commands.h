@@ -49,7 +49,7 @@ struct BINARY : virtual RPC_COMMAND {};
 /// Inputs:
 /// block_ids -- descending list of block IDs used to detect reorganizations and network status:
 /// the first 10 are the 10 most recent blocks, after which height decreases by a power of 2.
-struct GET_BLOCKS_BIN : PUBLIC, BINARY {
+struct GET_BLOCKS_BIN : PUBLIC, HEAVY, BINARY {
     static constexpr auto names() { return NAMES("get_blocks.bin", "getblocks.bin"); }
 
     static constexpr size_t MAX_COUNT = 1000;
@@ -99,7 +99,7 @@ void to_json(nlohmann::json& j, const GET_BLOCKS_BIN::block_output_indices& boi)
 
 OXEN_RPC_DOC_INTROSPECT
 // Get blocks by height. Binary request.
-struct GET_BLOCKS_BY_HEIGHT_BIN : PUBLIC, BINARY {
+struct GET_BLOCKS_BY_HEIGHT_BIN : PUBLIC, HEAVY, BINARY {
     static constexpr auto names() {
         return NAMES("get_blocks_by_height.bin", "getblocks_by_height.bin");
     }
@@ -140,7 +140,7 @@ struct GET_ALT_BLOCKS_HASHES_BIN : PUBLIC, BINARY {
 
 OXEN_RPC_DOC_INTROSPECT
 // Get hashes. Binary request.
-struct GET_HASHES_BIN : PUBLIC, BINARY {
+struct GET_HASHES_BIN : PUBLIC, HEAVY, BINARY {
     static constexpr auto names() { return NAMES("get_hashes.bin", "gethashes.bin"); }
 
     struct request {
@@ -197,7 +197,7 @@ struct get_outputs_out {
 
 OXEN_RPC_DOC_INTROSPECT
 // Get outputs. Binary request.
-struct GET_OUTPUTS_BIN : PUBLIC, BINARY {
+struct GET_OUTPUTS_BIN : PUBLIC, HEAVY, BINARY {
     static constexpr auto names() { return NAMES("get_outs.bin"); }
 
     /// Maximum outputs that may be requested in a single request (unless admin)
@@ -263,7 +263,7 @@ struct GET_TRANSACTION_POOL_HASHES_BIN : PUBLIC, BINARY {
 
 OXEN_RPC_DOC_INTROSPECT
 // Exactly like GET_OUTPUT_DISTRIBUTION, but does a binary RPC transfer instead of JSON
-struct GET_OUTPUT_DISTRIBUTION_BIN : PUBLIC, BINARY {
+struct GET_OUTPUT_DISTRIBUTION_BIN : PUBLIC, HEAVY, BINARY {
     static constexpr auto names() { return NAMES("get_output_distribution.bin"); }
 
     struct request : GET_OUTPUT_DISTRIBUTION::request {};
@@ -97,6 +97,10 @@ void parse_request(GET_OUTPUTS& get_outputs, rpc_input in) {
         get_values(in, "outputs", get_outputs.request.output_indices);
 }
 
+void parse_request(GET_TRANSACTION_POOL_CHANGES& changes, rpc_input in) {
+    get_values(in, "since", changes.request.since, "tx_blobs", changes.request.tx_blobs);
+}
+
 void parse_request(GET_TRANSACTION_POOL_STATS& pstats, rpc_input in) {
     get_values(in, "include_unrelayed", pstats.request.include_unrelayed);
 }
@@ -252,6 +256,21 @@ void parse_request(GET_COINBASE_TX_SUM& get_coinbase_tx_sum, rpc_input in) {
             get_coinbase_tx_sum.request.height);
 }
 
+void parse_request(GET_COMMAND_STATS& get_command_stats, rpc_input in) {
+    get_values(in, "prometheus", get_command_stats.request.prometheus);
+}
+
+void parse_request(PROFILE& profile, rpc_input in) {
+    get_values(
+            in,
+            "enable",
+            profile.request.enable,
+            "format",
+            profile.request.format,
+            "seconds",
+            profile.request.seconds);
+}
+
 void parse_request(GET_FEE_ESTIMATE& get_fee_estimate, rpc_input in) {
     get_values(in, "grace_blocks", get_fee_estimate.request.grace_blocks);
 }
@@ -24,6 +24,8 @@ void parse_request(GET_BLOCK_HEADER_BY_HASH& get_block_header_by_hash, rpc_input
 void parse_request(GET_BLOCK_HEADER_BY_HEIGHT& get_block_header_by_height, rpc_input in);
 void parse_request(GET_CHECKPOINTS& getcp, rpc_input in);
 void parse_request(GET_COINBASE_TX_SUM& get_coinbase_tx_sum, rpc_input in);
+void parse_request(GET_COMMAND_STATS& get_command_stats, rpc_input in);
+void parse_request(PROFILE& profile, rpc_input in);
 void parse_request(GET_QUORUM_STATE& get_quorum_state, rpc_input in);
 void parse_request(GET_LAST_BLOCK_HEADER& get_last_block_header, rpc_input in);
 void parse_request(GET_OUTPUTS& get_outputs, rpc_input in);
@@ -36,6 +38,7 @@ void parse_request(GET_SN_STATE_CHANGES& get_sn_state_changes, rpc_input in);
 void parse_request(GET_STAKING_REQUIREMENT& get_staking_requirement, rpc_input in);
 void parse_request(GET_TRANSACTIONS& get, rpc_input in);
 void parse_request(GET_TRANSACTION_POOL& get, rpc_input in);
+void parse_request(GET_TRANSACTION_POOL_CHANGES& changes, rpc_input in);
 void parse_request(GET_TRANSACTION_POOL_STATS& pstats, rpc_input in);
 void parse_request(HARD_FORK_INFO& hfinfo, rpc_input in);
 void parse_request(IN_PEERS& in_peers, rpc_input in);
@@ -112,7 +112,7 @@ const static std::string STATUS_OK = "OK", STATUS_FAILED = "FAILED", STATUS_BUSY
 /// - `immutable_hash` -- Hash of the highest block in the chain that cannot be reorganized.
 ///
 /// Example-JSON-Fetch
-struct GET_HEIGHT : PUBLIC, LEGACY, NO_ARGS {
+struct GET_HEIGHT : PUBLIC, FAST, LEGACY, NO_ARGS {
     static constexpr auto names() { return NAMES("get_height", "getheight"); }
 };
 
@@ -278,7 +278,7 @@ struct GET_HEIGHT : PUBLIC, LEGACY, NO_ARGS {
 ///   when `memory_pool` is set to true.  Each key is the key image (in hex, for json requests)
 ///   and each value is a list of transaction hashes that spend that key image (typically just
 ///   one, but in the case of conflicting transactions there can be multiple).
-struct GET_TRANSACTIONS : PUBLIC, LEGACY {
+struct GET_TRANSACTIONS : PUBLIC, HEAVY, LEGACY {
     static constexpr auto names() { return NAMES("get_transactions", "gettransactions"); }
 
     struct request_parameters {
@@ -363,7 +363,7 @@ struct IS_KEY_IMAGE_SPENT : PUBLIC, LEGACY {
 ///   - `txid` -- Transaction id; only present if requested via the `get_txid` parameter.
 ///   Otherwise, when `as_tuple` is set, these are 4- or 5-element arrays (depending on whether
 ///   `get_txid` is desired) containing the values in the order listed above.
-struct GET_OUTPUTS : PUBLIC, LEGACY {
+struct GET_OUTPUTS : PUBLIC, HEAVY, LEGACY {
     static constexpr auto names() { return NAMES("get_outs"); }
 
     /// Maximum outputs that may be requested in a single request (unless admin)
@@ -557,7 +557,7 @@ struct MINING_STATUS : LEGACY, NO_ARGS {
 /// - `free_space` -- Available disk space on the node.
 ///
 /// Example-JSON-Fetch
-struct GET_INFO : PUBLIC, LEGACY, NO_ARGS {
+struct GET_INFO : PUBLIC, FAST, LEGACY, NO_ARGS {
     static constexpr auto names() { return NAMES("get_info", "getinfo"); }
 };
 
@@ -575,10 +575,108 @@ struct GET_INFO : PUBLIC, LEGACY, NO_ARGS {
 /// - `total_bytes_in` -- something.
 /// - `total_packets_out` -- something.
 /// - `total_bytes_out` -- something.
+/// - `total_writes_out` -- number of socket writes started on all connections.  Queued outgoing
+///   messages are gathered into a single write where possible, so this is at most
+///   `total_messages_out`.
+/// - `total_messages_out` -- number of outgoing messages (or chunks of large messages) written.
+/// - `incoming_tx_parses_skipped` -- number of txs received from peers that we didn't need to fully
+///   parse because we already had them (or already knew them to be bad).
 struct GET_NET_STATS : LEGACY, NO_ARGS {
     static constexpr auto names() { return NAMES("get_net_stats"); }
 };
 
+/// RPC: daemon/get_command_stats
+///
+/// Retrieve what handling each kind of incoming message has cost the daemon: message counts,
+/// bytes received and sent, and handler CPU time, broken down per command and per p2p
+/// connection.  Intended for finding expensive commands and abusive peers.  Counts accumulate from
+/// daemon startup.
+///
+/// Inputs:
+///
+/// - `prometheus` -- if true then also return the command statistics in Prometheus text format.
+///
+/// Outputs:
+///
+/// - `status` -- General RPC status string. `"OK"` means everything looks good.
+/// - `levin` -- dict of p2p (levin) commands we have sent or received, keyed by command name (or
+///   id, if unknown); each value is a dict of:
+///   - `id` -- the levin command id
+///   - `count` -- number of these messages we have handled
+///   - `bytes_in` -- total size of the messages handled
+///   - `bytes_out` -- total size of these messages (or replies to them) that we have sent
+///   - `cpu_us` -- total CPU time spent handling the messages, in microseconds
+///   - `max_cpu_us` -- CPU time of the most expensive single message, in microseconds
+/// - `omq` -- dict of service node OxenMQ commands (such as `quorum.vote_ob`), keyed by
+///   `category.command`; each value is a dict of the same fields as `levin` (except `id`).
+/// - `rpc` -- dict of RPC endpoints (called over HTTP or OxenMQ), keyed by endpoint name; each
+///   value is a dict of the same fields as `omq` plus:
+///   - `queue_us` -- total time HTTP requests spent queued waiting for a worker thread, in
+///     microseconds.  (Requests made over OxenMQ are queued inside OxenMQ and not counted here).
+///   - `max_queue_us` -- longest time a single request spent queued, in microseconds
+/// - `rpc_categories` -- dict of the worker categories that RPC requests run in (`rpc_fast`,
+///   `rpc`, `rpc_heavy` and `admin`); each value is a dict of:
+///   - `started` -- number of requests started
+///   - `waited` -- number of those that had to wait for a running request to finish first
+///   - `rejected` -- number of requests rejected because too many were already waiting
+///   - `running` -- number of requests currently running
+///   - `queued` -- number of requests currently waiting
+///   - `queue_us` -- total time requests spent waiting to start, in microseconds
+///   - `max_queue_us` -- longest time a single request spent waiting to start, in microseconds
+///   - `run_us` -- total time spent running requests, in microseconds
+///   - `max_run_us` -- longest time a single request took to run, in microseconds
+/// - `connections` -- list of current p2p connections, most expensive first; each element is a
+///   dict containing:
+///   - `connection_id` -- the connection id, as returned by `get_connections`
+///   - `address` -- the remote address of the peer
+///   - `peer_id` -- a string that uniquely identifies the peer node
+///   - `recv_count` -- number of bytes of data received from this peer
+///   - `send_count` -- number of bytes of data sent to this peer
+///   - `handled_count` -- number of messages from this peer that we have handled
+///   - `handler_cpu_us` -- CPU time spent handling messages from this peer, in microseconds
+/// - `prometheus` -- the `levin`, `omq` and `rpc` statistics in the Prometheus text exposition
+///   format; only included if requested.
+struct GET_COMMAND_STATS : RPC_COMMAND {
+    static constexpr auto names() { return NAMES("get_command_stats"); }
+
+    struct request_parameters {
+        bool prometheus = false;
+    } request;
+};
+
+/// RPC: daemon/profile
+///
+/// Controls the daemon's built-in profiler and retrieves what it has recorded.  While enabled,
+/// the profiler records the time spent in the daemon's instrumented sections (block and
+/// transaction verification, database operations, service node list updates, RPC and quorumnet
+/// request handlers, etc.), keeping the most recent samples of each thread.
+///
+/// Inputs:
+///
+/// - `enable` -- if given, enables (true) or disables (false) the profiler.
+/// - `format` -- if given, return the samples recorded in the last `seconds` seconds in this
+///   format: `"folded"` for folded stacks (one `scope;inner_scope;... microseconds` line per
+///   stack, as used by flamegraph.pl and speedscope), or `"chrome"` for Chrome trace event JSON
+///   (for chrome://tracing or Perfetto).
+/// - `seconds` -- how many seconds of recent samples to return; defaults to 10.
+///
+/// Outputs:
+///
+/// - `status` -- General RPC status string. `"OK"` means everything looks good.
+/// - `enabled` -- true if the profiler is enabled (after applying `enable`).
+/// - `samples` -- the number of samples in `profile`; only included if `format` was given.
+/// - `profile` -- the recorded samples in the requested format; only included if `format` was
+///   given.
+struct PROFILE : RPC_COMMAND {
+    static constexpr auto names() { return NAMES("profile"); }
+
+    struct request_parameters {
+        std::optional<bool> enable;
+        std::string format;
+        uint32_t seconds = 10;
+    } request;
+};
+
 /// RPC: daemon/save_bc
 ///
 /// Save the blockchain. The blockchain does not need saving and is always saved when modified,
@@ -606,7 +704,7 @@ struct SAVE_BC : LEGACY, NO_ARGS {
 /// - `count` -- Number of blocks in logest chain seen by the node.
 ///
 /// Example-JSON-Fetch
-struct GET_BLOCK_COUNT : PUBLIC, NO_ARGS {
+struct GET_BLOCK_COUNT : PUBLIC, FAST, NO_ARGS {
     static constexpr auto names() { return NAMES("get_block_count", "getblockcount"); }
 };
 
@@ -702,7 +800,7 @@ struct GET_BLOCK_HASH : PUBLIC {
 /// ```
 ///
 /// Example-JSON-Fetch
-struct GET_LAST_BLOCK_HEADER : PUBLIC {
+struct GET_LAST_BLOCK_HEADER : PUBLIC, FAST {
     static constexpr auto names() { return NAMES("get_last_block_header", "getlastblockheader"); }
 
     struct request_parameters {
@@ -945,6 +1043,41 @@ struct GET_TRANSACTION_POOL_STATS : PUBLIC, LEGACY {
     } request;
 };
 
+/// RPC: blockchain/get_transaction_pool_changes
+///
+/// Get the transactions added to and removed from the transaction pool since a previous call, so
+/// that clients can keep track of the pool without repeatedly fetching all of it.
+///
+/// Inputs:
+///
+/// - `since` -- the `cookie` returned by a previous call.  Omit (or pass 0) to get the full pool.
+/// - `tx_blobs` -- if true then also return the blobs of the added transactions.
+///
+/// Outputs:
+///
+/// - `status` -- General RPC status string. `"OK"` means everything looks good.
+/// - `cookie` -- value to pass as `since` in the next call.
+/// - `full` -- true if `added` lists the entire pool rather than the changes since `since`, in
+///   which case the caller should discard whatever it knew about the pool before.  This happens
+///   when `since` is omitted, and also when it is too old (or is from before a restart of the
+///   node) for the node to still know all of the changes made since then.
+/// - `added` -- list of hashes of transactions added to the pool since `since` and still in it.
+/// - `removed` -- list of hashes of transactions removed from the pool since `since` (e.g. because
+///   they were mined) and not in it now.  This can include transactions that were added after
+///   `since` and then removed again, which the caller won't have seen.  Omitted when `full` is
+///   true.
+/// - `added_blobs` -- list of the transaction blobs of `added`, in the same order; only included
+///   if `tx_blobs` was requested.  (A transaction that left the pool again between working out
+///   the changes and fetching the blobs is omitted from both `added` and `added_blobs`).
+struct GET_TRANSACTION_POOL_CHANGES : PUBLIC {
+    static constexpr auto names() { return NAMES("get_transaction_pool_changes"); }
+
+    struct request_parameters {
+        uint64_t since = 0;
+        bool tx_blobs = false;
+    } request;
+};
+
 /// RPC: daemon/get_connections
 ///
 /// Retrieve information about incoming and outgoing P2P connections to your node.
@@ -965,6 +1098,8 @@ struct GET_TRANSACTION_POOL_STATS : PUBLIC, LEGACY {
 ///   - `recv_idle_ms` -- number of milliseconds since we last received data from this peer
 ///   - `send_count` -- number of bytes of data send to this peer
 ///   - `send_idle_ms` -- number of milliseconds since we last sent data to this peer
+///   - `handled_count` -- number of messages from this peer that we have handled
+///   - `handler_cpu_us` -- CPU time spent handling messages from this peer, in microseconds
 ///   - `state` -- returns the current state of the connection with this peer as a string, one of:
 ///     - `"before_handshake"` -- the connection is still being established/negotiated
 ///     - `"synchronizing"` -- we are synchronizing the blockchain with this peer
@@ -1073,7 +1208,7 @@ struct GET_CONNECTIONS : NO_ARGS {
 /// ```
 ///
 /// Example-JSON-Fetch
-struct GET_BLOCK_HEADERS_RANGE : PUBLIC {
+struct GET_BLOCK_HEADERS_RANGE : PUBLIC, HEAVY {
     static constexpr auto names() {
         return NAMES("get_block_headers_range", "getblockheadersrange");
     }
@@ -1214,7 +1349,7 @@ struct IN_PEERS : LEGACY {
 /// ```
 ///
 /// Example-JSON-Fetch
-struct HARD_FORK_INFO : PUBLIC {
+struct HARD_FORK_INFO : PUBLIC, FAST {
     static constexpr auto names() { return NAMES("hard_fork_info"); }
 
     struct request_parameters {
@@ -1374,7 +1509,7 @@ struct FLUSH_TRANSACTION_POOL : RPC_COMMAND {
 ///   - `uint64_t` -- total_instances
 ///   - `uint64_t` -- unlocked_instances
 ///   - `uint64_t` -- recent_instances
-struct GET_OUTPUT_HISTOGRAM : PUBLIC {
+struct GET_OUTPUT_HISTOGRAM : PUBLIC, HEAVY {
     static constexpr auto names() { return NAMES("get_output_histogram"); }
 
     struct request_parameters {
@@ -1405,7 +1540,7 @@ void from_json(const nlohmann::json& j, GET_OUTPUT_HISTOGRAM::entry& c);
 ///
 /// - `status` -- General RPC status string. `"OK"` means everything looks good.
 /// - `version` -- RPC current version.
-struct GET_VERSION : PUBLIC, NO_ARGS {
+struct GET_VERSION : PUBLIC, FAST, NO_ARGS {
     static constexpr auto names() { return NAMES("get_version"); }
 };
 
@@ -1486,7 +1621,7 @@ struct GET_COINBASE_TX_SUM : RPC_COMMAND {
 /// ```
 ///
 /// Example-JSON-Fetch
-struct GET_FEE_ESTIMATE : PUBLIC {
+struct GET_FEE_ESTIMATE : PUBLIC, FAST {
     static constexpr auto names() { return NAMES("get_fee_estimate"); }
 
     struct request_parameters {
@@ -1622,7 +1757,7 @@ struct output_distribution_data {
 /// ```
 ///
 /// Example-JSON-Fetch
-struct GET_OUTPUT_DISTRIBUTION : PUBLIC {
+struct GET_OUTPUT_DISTRIBUTION : PUBLIC, HEAVY {
     static constexpr auto names() { return NAMES("get_output_distribution"); }
 
     struct request {
@@ -2082,7 +2217,7 @@ struct GET_SERVICE_PRIVKEYS : NO_ARGS {
 /// ```
 ///
 /// Example-JSON-Fetch
-struct GET_SERVICE_NODES : PUBLIC {
+struct GET_SERVICE_NODES : PUBLIC, FAST {
     static constexpr auto names() {
         return NAMES("get_service_nodes", "get_n_service_nodes", "get_all_service_nodes");
     }
@@ -2281,7 +2416,7 @@ struct LOKINET_PING : RPC_COMMAND {
 /// - `status` -- generic RPC error code; "OK" means the request was successful.
 /// - `staking_requirement` -- The staking requirement in Oxen, in atomic units.
 /// - `height` -- The height requested (or current height if 0 was requested)
-struct GET_STAKING_REQUIREMENT : PUBLIC {
+struct GET_STAKING_REQUIREMENT : PUBLIC, FAST {
     static constexpr auto names() { return NAMES("get_staking_requirement"); }
 
     struct request_parameters {
@@ -2786,6 +2921,7 @@ using core_rpc_types = tools::type_list<
         GET_BLOCK_HEADER_BY_HEIGHT,
         GET_CHECKPOINTS,
         GET_COINBASE_TX_SUM,
+        GET_COMMAND_STATS,
         GET_CONNECTIONS,
         GET_HEIGHT,
         GET_INFO,
@@ -2811,6 +2947,7 @@ using core_rpc_types = tools::type_list<
         GET_STAKING_REQUIREMENT,
         GET_TRANSACTIONS,
         GET_TRANSACTION_POOL,
+        GET_TRANSACTION_POOL_CHANGES,
         GET_TRANSACTION_POOL_HASHES,
         GET_TRANSACTION_POOL_STATS,
         GET_VERSION,
@@ -2823,6 +2960,7 @@ using core_rpc_types = tools::type_list<
         ONS_RESOLVE,
         OUT_PEERS,
         POP_BLOCKS,
+        PROFILE,
         PRUNE_BLOCKCHAIN,
         REPORT_PEER_STATUS,
         SAVE_BC,
@@ -1,6 +1,7 @@
 
 #include "http_server.h"
 
+#include <oxenc/hex.h>
 #include <oxenc/variant.h>
 
 #include <chrono>
@@ -9,9 +10,11 @@
 
 #include "common/exception.h"
 #include "common/command_line.h"
+#include "common/profiler.h"
 #include "common/string_util.h"
 #include "cryptonote_config.h"
 #include "cryptonote_core/cryptonote_core.h"
+#include "epee/net/command_stats.h"
 #include "epee/net/jsonrpc_structs.h"
 #include "rpc/common/rpc_args.h"
 #include "rpc/core_rpc_server_commands_defs.h"
@@ -197,6 +200,8 @@ void http_server::create_rpc_endpoints(uWS::App& http) {
         handle_json_rpc_request(*res, *req);
     });
 
+    create_ws_endpoint(http);
+
     // Fallback to send a 404 for anything else:
     http.any("/*", [this](HttpResponse* res, HttpRequest* req) {
         if (m_login && !check_auth(*req, *res))
@@ -206,6 +211,222 @@ void http_server::create_rpc_endpoints(uWS::App& http) {
     });
 }
 
+void http_server::create_ws_endpoint(uWS::App& http) {
+    uWS::App::WebSocketBehavior<ws_subscriber> behavior;
+    behavior.compression = uWS::DISABLED;
+    behavior.maxPayloadLength = 16 * 1024;
+    behavior.idleTimeout = 120;
+    // ws_notify() does our own, gentler, backpressure handling; this is just a backstop against a
+    // client that keeps sending requests without ever reading the replies.
+    behavior.maxBackpressure = 2 * WS_MAX_BUFFERED;
+    behavior.upgrade = [this](HttpResponse* res, HttpRequest* req, us_socket_context_t* context) {
+        if (m_login && !check_auth(*req, *res))
+            return;
+        res->template upgrade<ws_subscriber>(
+                {},
+                req->getHeader("sec-websocket-key"),
+                req->getHeader("sec-websocket-protocol"),
+                req->getHeader("sec-websocket-extensions"),
+                context);
+    };
+    behavior.open = [this](WebSocket* ws) {
+        log::debug(logcat, "New websocket client {}", ws->getRemoteAddressAsText());
+        ws->getUserData()->id = ++m_ws_next_id;
+        m_ws_clients.insert(ws);
+    };
+    behavior.message = [this](WebSocket* ws, std::string_view message, uWS::OpCode) {
+        handle_ws_message(*ws, message);
+    };
+    behavior.drain = [](WebSocket* ws) {
+        auto& sub = *ws->getUserData();
+        if (sub.lagged && ws->getBufferedAmount() < WS_MAX_BUFFERED / 2) {
+            sub.lagged = false;
+            ws->send(R"({"notify":"lagged"})", uWS::OpCode::TEXT);
+        }
+    };
+    behavior.close = [this](WebSocket* ws, int /*code*/, std::string_view /*message*/) {
+        auto& sub = *ws->getUserData();
+        if (sub.block)
+            m_ws_block_subs--;
+        if (sub.mempool)
+            m_ws_mempool_subs--;
+        if (sub.sn_fields)
+            m_ws_sn_changes_subs--;
+        m_ws_clients.erase(ws);
+    };
+    http.ws<ws_subscriber>("/ws", std::move(behavior));
+}
+
+// Websocket subscriptions, at /ws.  Clients send JSON requests:
+// - {"subscribe": "block"} -- notifies of each new block
+// - {"subscribe": "mempool", "type": TYPE} -- notifies of new mempool txes, where TYPE is "all"
+//   (the default) or "blink" for only approved blink txes
+// - {"subscribe": "sn_changes", "fields": [...]} -- notifies of service node list changes; see
+//   sub.sn_changes in omq_server.cpp.  Without "fields" only pubkeys are sent.
+// - {"unsubscribe": FEED} -- cancels a subscription to one of the above
+// Each request gets a reply of {"subscribed": FEED}, {"unsubscribed": FEED}, or {"error": MSG}.
+// Subscriptions last for as long as the connection.
+//
+// Notifications are JSON objects with a "notify" key naming the feed, plus:
+// - block: "height" and (hex) "hash" of the new block
+// - mempool: (hex) "txid" and "tx" blob of the new transaction
+// - sn_changes: the keys of the notify.sn_changes dict, with binary values hex-encoded
+// A subscriber that falls too far behind has notifications dropped until it catches up, at which
+// point it is sent {"notify": "lagged"} and should resync (e.g. via get_service_nodes or
+// get_transaction_pool_changes) to recover whatever it missed.
+void http_server::handle_ws_message(WebSocket& ws, std::string_view message) {
+    auto& sub = *ws.getUserData();
+    nlohmann::json reply;
+    bool prime_sn_changes = false;
+    try {
+        auto req = nlohmann::json::parse(message);
+        const bool subscribe = req.contains("subscribe");
+        auto feed = req.at(subscribe ? "subscribe" : "unsubscribe").get<std::string>();
+        if (feed == "block") {
+            if (subscribe != sub.block)
+                m_ws_block_subs += subscribe ? 1 : -1;
+            sub.block = subscribe;
+        } else if (feed == "mempool") {
+            if (subscribe) {
+                auto type = req.value("type", "all"s);
+                if (type != "all" && type != "blink")
+                    throw std::invalid_argument{"invalid mempool subscription type '" + type + "'"};
+                if (!sub.mempool)
+                    m_ws_mempool_subs++;
+                sub.mempool = type == "blink";
+            } else if (sub.mempool) {
+                m_ws_mempool_subs--;
+                sub.mempool.reset();
+            }
+        } else if (feed == "sn_changes") {
+            if (subscribe) {
+                std::unordered_set<std::string> fields{"service_node_pubkey"};
+                if (auto it = req.find("fields"); it != req.end())
+                    fields = it->get<std::unordered_set<std::string>>();
+                if (!sub.sn_fields) {
+                    m_ws_sn_changes_subs++;
+                    prime_sn_changes = true;
+                }
+                sub.sn_fields_key = fields_key(fields);
+                sub.sn_fields = std::move(fields);
+            } else if (sub.sn_fields) {
+                m_ws_sn_changes_subs--;
+                sub.sn_fields.reset();
+            }
+        } else {
+            throw std::invalid_argument{"unknown feed '" + feed + "'"};
+        }
+        reply[subscribe ? "subscribed" : "unsubscribed"] = std::move(feed);
+    } catch (const std::exception& e) {
+        reply["error"] = "Invalid websocket request: "s + e.what();
+    }
+    if (!prime_sn_changes) {
+        ws.send(reply.dump(), uWS::OpCode::TEXT);
+        return;
+    }
+    // Priming collects the whole service node list, which we don't want to do on the uWS thread.
+    // We hold the reply until it is done so that the client gets every change made after it sees
+    // the reply.
+    m_server.get_core().omq().job([this, ws = &ws, id = sub.id, reply = reply.dump()]() mutable {
+        m_server.prime_sn_changes();
+        if (!m_ws_running)
+            return;
+        loop_defer([this, ws, id, reply = std::move(reply)] {
+            if (m_ws_clients.count(ws) && ws->getUserData()->id == id)
+                ws->send(reply, uWS::OpCode::TEXT);
+        });
+    });
+}
+
+void http_server::ws_notify(WebSocket& ws, std::string_view message) {
+    auto& sub = *ws.getUserData();
+    // Once lagging we keep dropping until the backlog clears (see the drain handler), so that the
+    // client gets told about the gap before it sees anything after it.
+    const auto buffered = ws.getBufferedAmount();
+    if (buffered > 0 && (sub.lagged || buffered + message.size() > WS_MAX_BUFFERED)) {
+        sub.lagged = true;
+        return;
+    }
+    if (sub.lagged) {
+        sub.lagged = false;
+        ws.send(R"({"notify":"lagged"})", uWS::OpCode::TEXT);
+    }
+    ws.send(message, uWS::OpCode::TEXT);
+}
+
+void http_server::ws_notify_all(
+        std::string message, std::function<bool(const ws_subscriber&)> want) {
+    if (!m_ws_running)
+        return;
+    loop_defer([this, message = std::move(message), want = std::move(want)] {
+        for (auto* ws : m_ws_clients)
+            if (want(*ws->getUserData()))
+                ws_notify(*ws, message);
+    });
+}
+
+void http_server::send_ws_block_notifications(const block& b) {
+    if (!m_ws_block_subs)
+        return;
+    ws_notify_all(
+            nlohmann::json{
+                    {"notify", "block"},
+                    {"height", b.get_height()},
+                    {"hash", tools::hex_guts(b.hash)}}
+                    .dump(),
+            [](const ws_subscriber& sub) { return sub.block; });
+}
+
+void http_server::send_ws_mempool_notifications(
+        const crypto::hash& id, const std::string& blob, const tx_pool_options& opts) {
+    if (!m_ws_mempool_subs)
+        return;
+    ws_notify_all(
+            nlohmann::json{
+                    {"notify", "mempool"},
+                    {"txid", tools::hex_guts(id)},
+                    {"tx", oxenc::to_hex(blob)}}
+                    .dump(),
+            [blink = opts.approved_blink](const ws_subscriber& sub) {
+                return sub.mempool && (!*sub.mempool || blink);
+            });
+}
+
+void http_server::send_ws_sn_changes(std::shared_ptr<const sn_list_changes> changes) {
+    if (!m_ws_sn_changes_subs || !m_ws_running)
+        return;
+    // Which fields subscribers want is only known in the uWS thread, but rendering them involves
+    // looking up service node details, which we don't want to hold up the uWS thread with.  So we
+    // collect the distinct field sets there, render each once on a worker, then go back to send.
+    loop_defer([this, changes = std::move(changes)] {
+        std::unordered_map<std::string, std::unordered_set<std::string>> wanted;
+        for (auto* ws : m_ws_clients)
+            if (const auto& sub = *ws->getUserData(); sub.sn_fields)
+                wanted.try_emplace(sub.sn_fields_key, *sub.sn_fields);
+        if (wanted.empty())
+            return;
+        m_server.get_core().omq().job([this, changes, wanted = std::move(wanted)] {
+            std::unordered_map<std::string, std::string> rendered;
+            for (const auto& [key, fields] : wanted) {
+                auto msg = m_server.sn_changes_response(*changes, fields, false /*hex*/);
+                msg["notify"] = "sn_changes";
+                rendered[key] = msg.dump();
+            }
+            if (!m_ws_running)
+                return;
+            loop_defer([this, rendered = std::move(rendered)] {
+                for (auto* ws : m_ws_clients) {
+                    const auto& sub = *ws->getUserData();
+                    if (!sub.sn_fields)
+                        continue;
+                    if (auto it = rendered.find(sub.sn_fields_key); it != rendered.end())
+                        ws_notify(*ws, it->second);
+                }
+            });
+        });
+    });
+}
+
 namespace {
 
     struct call_data {
@@ -220,6 +441,9 @@ namespace {
         bool jsonrpc{false};
         nlohmann::json jsonrpc_id{nullptr};
         std::vector<std::pair<std::string, std::string>> extra_headers;  // Extra headers to send
+        size_t request_size{0};  // Size of the request body, for command stats
+        std::chrono::steady_clock::time_point queued;  // When we handed the request to a worker
+        std::string client;  // Who the request counts as for admission (see admission_client())
 
         call_data(
                 http_server& http,
@@ -312,10 +536,9 @@ namespace {
             rpc::GET_TRANSACTION_POOL_HASHES_BIN::names()[0])
             return invoke_txpool_hashes_bin(std::move(dataptr));
 
-        const bool time_logging = logcat->should_log(log::Level::debug);
-        std::chrono::steady_clock::time_point start;
-        if (time_logging)
-            start = std::chrono::steady_clock::now();
+        OXEN_PROFILE_SCOPE(data.call->name);
+        const auto start = std::chrono::steady_clock::now();
+        const epee::net_utils::cpu_timer cpu;
 
         int json_error = -32603;
         std::string json_message = "Internal error";
@@ -359,6 +582,13 @@ namespace {
             log::warning(logcat, "HTTP RPC request '{}' raised an unknown exception", data.uri);
         }
 
+        epee::net_utils::command_stats().rpc.record(
+                data.call->name,
+                data.request_size,
+                result.size(),
+                cpu.elapsed(),
+                start - data.queued);
+
         if (json_error != 0) {
             data.http.loop_defer([data = std::move(dataptr),
                                   json_error,
@@ -374,22 +604,35 @@ namespace {
             return;
         }
 
-        std::string call_duration;
-        if (time_logging)
-            call_duration =
-                    " in " + tools::friendly_duration(std::chrono::steady_clock::now() - start);
         if (logcat->should_log(log::Level::debug))
             log::debug(
                     logcat,
-                    "HTTP RPC {} [{}] OK ({} bytes){}",
+                    "HTTP RPC {} [{}] OK ({} bytes) in {}",
                     data.uri,
                     data.request.context.remote,
                     result.size(),
-                    call_duration);
+                    tools::friendly_duration(std::chrono::steady_clock::now() - start));
 
         queue_response(std::move(dataptr), std::move(result));
     }
 
+    // Admits a fully received request into its RPC category, to be invoked on one of the
+    // category's workers once there is room.  If the category's queue is full the request gets
+    // dropped, which replies with a "server busy" error (see ~call_data).
+    void admit(std::shared_ptr<call_data> dataptr) {
+        auto& data = *dataptr;
+        auto& admission = data.core_rpc.admission();
+        const auto cat = data.call->category;
+        const bool admin = data.request.context.admin;
+        data.queued = std::chrono::steady_clock::now();
+        admission.admit(
+                cat,
+                std::move(data.client),
+                admin,
+                [data = std::move(dataptr)](auto /*slot*/) mutable { invoke_rpc(std::move(data)); },
+                false);
+    }
+
     std::string pool_hashes_response(std::vector<crypto::hash>&& pool_hashes) {
         GET_TRANSACTION_POOL_HASHES_BIN::response res{};
         res.tx_hashes = std::move(pool_hashes);
@@ -539,6 +782,9 @@ void http_server::handle_base_request(
     request.context.admin = !m_restricted;
     request.context.source = rpc_source::http;
     request.context.remote = get_remote_address(res);
+    // Local requests without a forwarding proxy aren't per-client limited: we have no identifier
+    // for their connection to tell them apart by.
+    data->client = admission_client(request.context.remote, req.getHeader("x-forwarded-for"), "");
     handle_cors(req, data->extra_headers);
     log::trace(
             logcat,
@@ -558,15 +804,9 @@ void http_server::handle_base_request(
         if (!done)
             return;
 
-        auto& omq = data->core_rpc.get_core().omq();
-        std::string cat{data->call->is_public ? "rpc" : "admin"};
-        std::string cmd{"http:" + data->uri};  // Used for OMQ job logging; prefixed with http: so
-                                               // we can distinguish it
-        std::string remote{data->request.context.remote};
-        omq.inject_task(
-                std::move(cat), std::move(cmd), std::move(remote), [data = std::move(data)] {
-                    invoke_rpc(std::move(data));
-                });
+        if (auto* body = std::get_if<std::string>(&data->request.body))
+            data->request_size = body->size();
+        admit(std::move(data));
     });
 }
 
@@ -577,6 +817,9 @@ void http_server::handle_json_rpc_request(HttpResponse& res, HttpRequest& req) {
     request.context.admin = !m_restricted;
     request.context.source = rpc_source::http;
     request.context.remote = get_remote_address(res);
+    // Local requests without a forwarding proxy aren't per-client limited: we have no identifier
+    // for their connection to tell them apart by.
+    data->client = admission_client(request.context.remote, req.getHeader("x-forwarded-for"), "");
     handle_cors(req, data->extra_headers);
 
     res.onAborted([data] { data->aborted = true; });
@@ -592,6 +835,7 @@ void http_server::handle_json_rpc_request(HttpResponse& res, HttpRequest& req) {
             body = d;  // bypass copying the string_view to a string
         else
             body = (buffer += d);
+        data->request_size = body.size();
 
         nlohmann::json jsonrpc;
         try {
@@ -648,15 +892,7 @@ void http_server::handle_json_rpc_request(HttpResponse& res, HttpRequest& req) {
         if (auto it = jsonrpc.find("params"); it != jsonrpc.end())
             data->request.body = *it;
 
-        auto& omq = data->core_rpc.get_core().omq();
-        std::string cat{data->call->is_public ? "rpc" : "admin"};
-        std::string cmd{"jsonrpc:" + *method};  // Used for OMQ job logging; prefixed with jsonrpc:
-                                                // so we can distinguish it
-        std::string remote{data->request.context.remote};
-        omq.inject_task(
-                std::move(cat), std::move(cmd), std::move(remote), [data = std::move(data)] {
-                    invoke_rpc(std::move(data));
-                });
+        admit(std::move(data));
     });
 }
 
@@ -678,6 +914,22 @@ void http_server::start() {
     auto& omq = m_server.get_core().omq();
     if (timer_started.insert(&omq).second)
         omq.add_timer(long_poll_process_timeouts, 1s);
+
+    auto& core = m_server.get_core();
+    core.blockchain.hook_block_post_add(
+            [this](const auto& info) { send_ws_block_notifications(info.block); });
+    core.mempool.add_notify([this](const crypto::hash& id,
+                                   const transaction& /*tx*/,
+                                   const std::string& blob,
+                                   const tx_pool_options& opts) {
+        send_ws_mempool_notifications(id, blob, opts);
+    });
+    m_server.add_sn_changes_listener(
+            [this] { return m_ws_running && m_ws_sn_changes_subs > 0; },
+            [this](std::shared_ptr<const sn_list_changes> changes) {
+                send_ws_sn_changes(std::move(changes));
+            });
+    m_ws_running = true;
 }
 
 void http_server::shutdown(bool join) {
@@ -686,6 +938,7 @@ void http_server::shutdown(bool join) {
 
     if (!m_sent_shutdown) {
         log::trace(logcat, "initiating shutdown");
+        m_ws_running = false;
         if (!m_sent_startup) {
             m_startup_promise.set_value(false);
             m_sent_startup = true;
@@ -698,6 +951,10 @@ void http_server::shutdown(bool join) {
 
                 m_closing = true;
 
+                log::trace(logcat, "closing {} websocket clients", m_ws_clients.size());
+                for (auto* ws : std::vector<WebSocket*>{m_ws_clients.begin(), m_ws_clients.end()})
+                    ws->end(1001, "Server shutting down");
+
                 {
                     // Destroy any pending long poll connections as well
                     log::trace(logcat, "closing pending long poll requests");
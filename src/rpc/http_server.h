@@ -31,6 +31,11 @@
 
 #pragma once
 
+#include <atomic>
+#include <functional>
+#include <optional>
+#include <unordered_set>
+
 #include "common/command_line.h"
 #include "common/password.h"
 #include "core_rpc_server.h"
@@ -77,9 +82,43 @@ class http_server : public http_server_base {
     /// during destruction.
     void shutdown(bool join = false);
 
+    /// Notifications are dropped for a websocket subscriber (which is then told, once it catches
+    /// up, that it missed some) while more than this many bytes are still waiting to be sent to it.
+    static constexpr size_t WS_MAX_BUFFERED = 1024 * 1024;
+
   private:
+    // Websocket subscriber state; only accessed from the uWS thread.
+    struct ws_subscriber {
+        bool block = false;
+        std::optional<bool> mempool;  // If subscribed: true for only approved blink txes
+        std::optional<std::unordered_set<std::string>> sn_fields;
+        std::string sn_fields_key;  // See rpc::fields_key()
+        bool lagged = false;        // Set if we dropped notifications because of backpressure
+        uint64_t id = 0;            // Distinguishes connections that reuse a closed one's address
+    };
+    using WebSocket = uWS::WebSocket<false /*SSL*/, true /*server*/, ws_subscriber>;
+
     void create_rpc_endpoints(uWS::App& http) override;
 
+    /// Adds the /ws endpoint through which clients can subscribe to block, mempool, and service
+    /// node list change notifications.
+    void create_ws_endpoint(uWS::App& http);
+
+    /// Handles a (JSON) subscribe/unsubscribe message from a websocket client
+    void handle_ws_message(WebSocket& ws, std::string_view message);
+
+    /// Sends a notification to a websocket subscriber, unless it isn't keeping up.
+    void ws_notify(WebSocket& ws, std::string_view message);
+
+    /// Sends a notification to every websocket subscriber that `want` returns true for.  Call
+    /// from any thread.
+    void ws_notify_all(std::string message, std::function<bool(const ws_subscriber&)> want);
+
+    void send_ws_block_notifications(const block& b);
+    void send_ws_mempool_notifications(
+            const crypto::hash& id, const std::string& blob, const tx_pool_options& opts);
+    void send_ws_sn_changes(std::shared_ptr<const sn_list_changes> changes);
+
     /// Handles a request for a base url, e.g. /foo (but not /json_rpc).  `call` is the callback
     /// we've already mapped the request to; restricted commands have also already been rejected
     /// (unless the RPC is unrestricted).
@@ -101,6 +140,14 @@ class http_server : public http_server_base {
     bool m_sent_startup{false}, m_sent_shutdown{false};
     // Whether this is restricted, i.e. public.  Unrestricted allows admin commands.
     bool m_restricted;
+    // Currently connected websocket clients; only accessed from the uWS thread
+    std::unordered_set<WebSocket*> m_ws_clients;
+    uint64_t m_ws_next_id = 0;
+    // Number of websocket clients subscribed to each feed, so that other threads can skip
+    // preparing notifications that nobody wants
+    std::atomic<int> m_ws_block_subs{0}, m_ws_mempool_subs{0}, m_ws_sn_changes_subs{0};
+    // Set while the uWS loop is accepting notifications (i.e. between start() and shutdown())
+    std::atomic<bool> m_ws_running{false};
 };
 
 }  // namespace cryptonote::rpc
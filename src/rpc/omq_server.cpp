@@ -1,15 +1,20 @@
 
 #include "omq_server.h"
 
+#include <algorithm>
 #include <common/exception.h>
 #include <fmt/core.h>
 #include <fmt/std.h>
 #include <oxenc/bt.h>
+#include <oxenc/bt_producer.h>
 #include <oxenmq/fmt.h>
 #include <oxenmq/oxenmq.h>
 
+#include "common/oxen.h"
+#include "common/profiler.h"
 #include "common/string_util.h"
 #include "cryptonote_config.h"
+#include "epee/net/command_stats.h"
 #include "rpc/common/param_parser.hpp"
 
 namespace cryptonote::rpc {
@@ -73,6 +78,24 @@ namespace {
             "0007"};
 #endif
 
+    const command_line::arg_descriptor<unsigned> arg_rpc_fast_threads{
+            "rpc-fast-threads",
+            "Number of worker threads reserved for cheap RPC requests (such as get_info) so that "
+            "they are answered promptly even while the other workers are busy.",
+            1};
+    const command_line::arg_descriptor<unsigned> arg_rpc_heavy_concurrency{
+            "rpc-heavy-concurrency",
+            "Maximum number of expensive RPC requests (such as get_blocks.bin or get_outs) to "
+            "process at once; further requests wait in a queue. 0 means no limit.",
+            2};
+    const command_line::arg_descriptor<unsigned> arg_rpc_client_concurrency{
+            "rpc-client-concurrency",
+            "Maximum number of non-admin RPC requests from a single client address to process "
+            "at once; further requests wait in a queue. 0 means no limit. Local OMQ clients are "
+            "limited per connection, and local HTTP clients are only limited when behind a proxy "
+            "that sets X-Forwarded-For, by the forwarded address.",
+            4};
+
     void check_omq_listen_addr(std::string_view addr) {
         // Crude check for basic validity; you can specify all sorts of invalid things, but at
         // least we can check the prefix for something that looks zmq-y.
@@ -99,7 +122,85 @@ namespace {
     // OMQ RPC responses consist of [CODE, DATA] for code we (partially) mimic HTTP error codes:
     // 200 means success, anything else means failure.  (We don't have codes for Forbidden or
     // Not Found because those happen at the OMQ protocol layer).
-    constexpr std::string_view OMQ_OK{"200"sv}, OMQ_BAD_REQUEST{"400"sv}, OMQ_ERROR{"500"sv};
+    constexpr std::string_view OMQ_OK{"200"sv}, OMQ_BAD_REQUEST{"400"sv}, OMQ_ERROR{"500"sv},
+                               OMQ_BUSY{"503"sv};
+
+    // Invokes an RPC command on behalf of an OMQ request with the given body (which must outlive
+    // the call), and sends the reply.
+    void invoke_rpc(
+            const rpc_command& call,
+            rpc_request request,
+            std::string_view body,
+            oxenmq::Message::DeferredSend& reply,
+            core_rpc_server& rpc) {
+        const std::string_view prefix = call.is_public ? "rpc." : "admin.";
+        request.body = body;
+
+        OXEN_PROFILE_SCOPE(call.name);
+        const epee::net_utils::cpu_timer cpu;
+        size_t reply_size = 0;
+        OXEN_DEFER {
+            epee::net_utils::command_stats().rpc.record(
+                    call.name, body.size(), reply_size, cpu.elapsed());
+        };
+
+        try {
+            auto result = var::visit(
+                    [](auto&& v) -> std::string {
+                        using T = decltype(v);
+                        if constexpr (std::is_same_v<oxenc::bt_value&&, T>)
+                            return bt_serialize(std::move(v));
+                        else if constexpr (std::is_same_v<nlohmann::json&&, T>)
+                            return v.dump();
+                        else {
+                            static_assert(std::is_same_v<std::string&&, T>);
+                            return std::move(v);
+                        }
+                    },
+                    call.invoke(std::move(request), rpc));
+            reply_size = result.size();
+            reply.reply(OMQ_OK, std::move(result));
+            return;
+        } catch (const parse_error& e) {
+            // This isn't really WARNable as it's the client fault; log at info level instead.
+            //
+            // TODO: for various parsing errors there are still some stupid forced ERROR-level
+            // warnings that get generated deep inside epee, for example when passing a string or
+            // number instead of a JSON object.  If you want to find some, `grep number2 epee`
+            // (for real).
+            log::info(
+                    logcat,
+                    "OMQ RPC request '{}{}' called with invalid/unparseable data: {}",
+                    prefix,
+                    call.name,
+                    e.what());
+            log::debug(logcat, "Bad request body: {}", body.empty() ? "(empty)"sv : body);
+            reply.reply(OMQ_BAD_REQUEST, "Unable to parse request: "s + e.what());
+            return;
+        } catch (const rpc_error& e) {
+            log::warning(
+                    logcat, "OMQ RPC request '{}{}' failed with: {}", prefix, call.name, e.what());
+            reply.reply(OMQ_ERROR, e.what());
+            return;
+        } catch (const std::exception& e) {
+            log::warning(
+                    logcat,
+                    "OMQ RPC request '{}{}' raised an exception: {}",
+                    prefix,
+                    call.name,
+                    e.what());
+        } catch (...) {
+            log::warning(
+                    logcat,
+                    "OMQ RPC request '{}{}' raised an unknown exception",
+                    prefix,
+                    call.name);
+        }
+        // Don't include the exception message in case it contains something that we don't want
+        // go back to the user.  If we want to support it eventually we could add some sort of
+        // `rpc::user_visible_exception` that carries a message to send back to the user.
+        reply.reply(OMQ_ERROR, "An exception occured while processing your request");
+    }
 
 }  // end anonymous namespace
 
@@ -113,6 +214,9 @@ void init_omq_options(boost::program_options::options_description& desc) {
 #ifndef _WIN32
     command_line::add_arg(desc, arg_omq_umask);
 #endif
+    command_line::add_arg(desc, arg_rpc_fast_threads);
+    command_line::add_arg(desc, arg_rpc_heavy_concurrency);
+    command_line::add_arg(desc, arg_rpc_client_concurrency);
 }
 
 omq_rpc::omq_rpc(
@@ -212,9 +316,16 @@ omq_rpc::omq_rpc(
     for (auto& pk : as_x_pubkeys(command_line::get_arg(vm, arg_omq_user)))
         auth.emplace(std::move(pk), AuthLevel::basic);
 
-    // basic (non-admin) rpc commands go into the "rpc." category (e.g. 'rpc.get_info')
+    // Public rpc commands go into the "rpc." category (e.g. 'rpc.get_info'), except for cheap
+    // commands tagged FAST, which go into "rpc_fast." with their own reserved thread(s) so that
+    // they stay responsive however busy the other workers are, and expensive ones tagged HEAVY,
+    // which go into "rpc_heavy.".  Both of those are also reachable via "rpc.", as before.
+    const auto fast_threads = command_line::get_arg(vm, arg_rpc_fast_threads);
+    omq.add_category("rpc_fast", AuthLevel::basic, fast_threads, 1000 /*max queued requests*/);
     omq.add_category(
             "rpc", AuthLevel::basic, 0 /*no reserved threads*/, 1000 /*max queued requests*/);
+    omq.add_category(
+            "rpc_heavy", AuthLevel::basic, 0 /*no reserved threads*/, 200 /*max queued requests*/);
 
     // Admin rpc commands go into "admin.".  We also always keep one (potential) thread reserved
     // for admin RPC commands; that way even if there are loads of basic commands being
@@ -222,95 +333,64 @@ omq_rpc::omq_rpc(
     // ones to finish.
     constexpr unsigned int admin_reserved_threads = 1;
     omq.add_category("admin", AuthLevel::admin, admin_reserved_threads);
+
+    // Requests (from both here and the HTTP server) are admitted into their category before they
+    // run; those that have to wait for room are later injected into the category's workers.
+    rpc_admission::limits limits;
+    limits.concurrency[static_cast<size_t>(rpc_category::heavy)] =
+            command_line::get_arg(vm, arg_rpc_heavy_concurrency);
+    limits.per_client = command_line::get_arg(vm, arg_rpc_client_concurrency);
+    rpc_.admission().set_limits(std::move(limits));
+    rpc_.admission().set_starter(
+            [&omq](rpc_category cat, const std::string& client, std::function<void()> start) {
+                omq.inject_task(std::string{to_string(cat)}, "rpc", client, std::move(start));
+            });
+
     for (auto& cmd : rpc_commands) {
+        const auto category = to_string(cmd.second->category);
         omq.add_request_command(
-                cmd.second->is_public ? "rpc" : "admin",
+                std::string{category},
                 cmd.first,
-                [name = std::string_view{cmd.first}, &call = *cmd.second, this](
-                        oxenmq::Message& m) {
-                    if (m.data.size() > 1)
+                [&call = *cmd.second, this](oxenmq::Message& m) {
+                    if (m.data.size() > 1) {
                         m.send_reply(
                                 OMQ_BAD_REQUEST,
                                 "Bad request: RPC commands must have at most one data part "
                                 "(received " +
                                         std::to_string(m.data.size()) + ")");
-
-                    rpc_request request{};
-                    request.context.admin = m.access.auth >= AuthLevel::admin;
-                    request.context.source = rpc_source::omq;
-                    request.context.remote = m.remote;
-                    if (!m.data.empty())
-                        request.body = m.data[0];
-
-                    try {
-                        auto result = var::visit(
-                                [](auto&& v) -> std::string {
-                                    using T = decltype(v);
-                                    if constexpr (std::is_same_v<oxenc::bt_value&&, T>)
-                                        return bt_serialize(std::move(v));
-                                    else if constexpr (std::is_same_v<nlohmann::json&&, T>)
-                                        return v.dump();
-                                    else {
-                                        static_assert(std::is_same_v<std::string&&, T>);
-                                        return std::move(v);
-                                    }
-                                },
-                                call.invoke(std::move(request), rpc_));
-                        m.send_reply(OMQ_OK, std::move(result));
-                        return;
-                    } catch (const parse_error& e) {
-                        // This isn't really WARNable as it's the client fault; log at info
-                        // level instead.
-                        //
-                        // TODO: for various parsing errors there are still some stupid forced
-                        // ERROR-level warnings that get generated deep inside epee, for example
-                        // when passing a string or number instead of a JSON object.  If you
-                        // want to find some, `grep number2 epee` (for real).
-                        log::info(
-                                logcat,
-                                "OMQ RPC request '{}{}' called with invalid/unparseable data: "
-                                "{}",
-                                (call.is_public ? "rpc." : "admin."),
-                                name,
-                                e.what());
-                        log::debug(
-                                logcat,
-                                "Bad request body: {}",
-                                m.data.empty() ? "(empty)" : m.data[0]);
-                        m.send_reply(OMQ_BAD_REQUEST, "Unable to parse request: "s + e.what());
-                        return;
-                    } catch (const rpc_error& e) {
-                        log::warning(
-                                logcat,
-                                "OMQ RPC request '{}{}' failed with: {}",
-                                (call.is_public ? "rpc." : "admin."),
-                                name,
-                                e.what());
-                        m.send_reply(OMQ_ERROR, e.what());
                         return;
-                    } catch (const std::exception& e) {
-                        log::warning(
-                                logcat,
-                                "OMQ RPC request '{}{}' raised an exception: {}",
-                                (call.is_public ? "rpc." : "admin."),
-                                name,
-                                e.what());
-                    } catch (...) {
-                        log::warning(
-                                logcat,
-                                "OMQ RPC request '{}{}' raised an unknown exception",
-                                (call.is_public ? "rpc." : "admin."),
-                                name);
                     }
-                    // Don't include the exception message in case it contains something that we
-                    // don't want go back to the user.  If we want to support it eventually we
-                    // could add some sort of `rpc::user_visible_exception` that carries a
-                    // message to send back to the user.
-                    m.send_reply(OMQ_ERROR, "An exception occured while processing your request");
+
+                    const bool admin = m.access.auth >= AuthLevel::admin;
+                    auto job = [this,
+                                &call,
+                                admin,
+                                remote = m.remote,
+                                body = m.data.empty() ? std::string{} : std::string{m.data[0]},
+                                reply = m.send_later()](auto /*slot*/) mutable {
+                        rpc_request request{};
+                        request.context.admin = admin;
+                        request.context.source = rpc_source::omq;
+                        request.context.remote = std::move(remote);
+                        invoke_rpc(call, std::move(request), body, reply, rpc_);
+                    };
+                    auto& admission = rpc_.admission();
+                    // Local (e.g. IPC) clients are told apart by connection
+                    auto client = admission_client(m.remote, "", "{}"_format(m.conn));
+                    if (admission.admit(
+                                call.category, std::move(client), admin, std::move(job), true) ==
+                        rpc_admission::admit_result::rejected)
+                        m.send_reply(OMQ_BUSY, "Server busy: too many pending requests");
                 });
+        if (category == "rpc_fast" || category == "rpc_heavy")
+            omq.add_command_alias("rpc." + cmd.first, std::string{category} + "." + cmd.first);
     }
 
-    omq.add_request_command("rpc", "get_blocks", [this](oxenmq::Message& m) { on_get_blocks(m); });
+    // get_blocks streams potentially large responses, so it runs with the other heavy commands
+    // (though outside of admission control, as it replies from its own handler).
+    omq.add_request_command(
+            "rpc_heavy", "get_blocks", [this](oxenmq::Message& m) { on_get_blocks(m); });
+    omq.add_command_alias("rpc.get_blocks", "rpc_heavy.get_blocks");
 
     // Subscription commands
 
@@ -324,6 +404,28 @@ omq_rpc::omq_rpc(
     omq.add_request_command(
             "sub", "block", [this](oxenmq::Message& m) { on_block_sub_request(m); });
 
+    omq.add_request_command("sub", "pool_changes", [this](oxenmq::Message& m) {
+        on_pool_changes_sub_request(m);
+    });
+    pool_changes_cookie_ = core_.mempool.cookie();
+    omq.add_timer([this] { send_pool_changes_notifications(); }, 1s);
+
+    omq.add_request_command("sub", "sn_changes", [this](oxenmq::Message& m) {
+        on_sn_changes_sub_request(m);
+    });
+    rpc_.add_sn_changes_listener(
+            [this] {
+                std::shared_lock lock{subs_mutex_};
+                auto now = std::chrono::steady_clock::now();
+                return std::any_of(
+                        sn_changes_subs_.begin(), sn_changes_subs_.end(), [now](const auto& sub) {
+                            return sub.second.expiry >= now;
+                        });
+            },
+            [this](std::shared_ptr<const sn_list_changes> changes) {
+                send_sn_changes_notifications(*changes);
+            });
+
     core_.blockchain.hook_block_post_add([this](const auto& info) {
         send_block_notifications(info.block);
         return true;
@@ -398,6 +500,61 @@ void omq_rpc::send_mempool_notifications(
     });
 }
 
+void omq_rpc::send_pool_changes_notifications() {
+    {
+        // Nobody to tell, so just keep up with the cookie.  A subscriber arriving after this
+        // gets a cookie at least as new, which the next notification's `since` then covers.
+        std::shared_lock lock{subs_mutex_};
+        if (pool_changes_subs_.empty()) {
+            pool_changes_cookie_ = core_.mempool.cookie();
+            return;
+        }
+    }
+    const auto since = pool_changes_cookie_;
+    auto changes = core_.mempool.get_changes_since(since, false /*no unrelayed*/);
+    const auto cookie = changes ? changes->cookie : core_.mempool.cookie();
+    if (cookie == since)
+        return;
+    pool_changes_cookie_ = cookie;
+    if (changes && changes->added.empty() && changes->removed.empty())
+        return;
+
+    oxenc::bt_dict_producer d;
+    if (changes) {
+        auto added = d.append_list("added");
+        for (const auto& txid : changes->added)
+            added.append(tools::view_guts(txid));
+    }
+    d.append("cookie", cookie);
+    if (!changes)
+        d.append("full", 1);
+    if (changes) {
+        auto removed = d.append_list("removed");
+        for (const auto& txid : changes->removed)
+            removed.append(tools::view_guts(txid));
+    }
+    d.append("since", since);
+    const auto msg = std::move(d).str();
+
+    auto& omq = core_.omq();
+    send_notifies(subs_mutex_, pool_changes_subs_, "pool changes", [&](auto& conn, auto& /*sub*/) {
+        omq.send(conn, "notify.pool_changes", msg);
+    });
+}
+
+void omq_rpc::send_sn_changes_notifications(const sn_list_changes& changes) {
+    auto& omq = core_.omq();
+    // Subscribers wanting the same fields get the same message, so render each distinct set once
+    std::unordered_map<std::string_view, std::string> rendered;
+    send_notifies(subs_mutex_, sn_changes_subs_, "sn changes", [&](auto& conn, auto& sub) {
+        auto [it, inserted] = rendered.try_emplace(sub.fields_key);
+        if (inserted)
+            it->second = oxenc::bt_serialize(
+                    json_to_bt(rpc_.sn_changes_response(changes, sub.fields, true /*bt*/)));
+        omq.send(conn, "notify.sn_changes", it->second);
+    });
+}
+
 /// Get a set of blocks, their transactions, and their created outputs' global indices
 ///
 /// Inputs:
@@ -624,6 +781,111 @@ void omq_rpc::on_mempool_sub_request(oxenmq::Message& m) {
     }
 }
 
+// Pool change subscriptions: [sub.pool_changes].  The reply is ["OK", COOKIE] for a new
+// subscription or ["ALREADY", COOKIE] for a renewed one, where COOKIE is the mempool cookie (as
+// used by the get_transaction_pool_changes RPC endpoint).  Subscriptions expire after 30 minutes,
+// as with mempool subscriptions.
+//
+// While subscribed, the node sends [notify.pool_changes, DICT] about once a second whenever the
+// mempool has changed, where DICT is a bt-encoded dict of:
+// - `since` -- the cookie as of the previous notification
+// - `cookie` -- the current cookie
+// - `added` -- list of (binary) hashes of txes added to the pool since `since` and still in it
+// - `removed` -- list of (binary) hashes of txes removed from the pool since `since`
+// - `full` -- set to 1 (and `added`/`removed` omitted) if there were too many changes to send;
+//   the client needs to refetch the whole pool via get_transaction_pool_changes.
+//
+// A client whose view of the pool is as of a cookie from `since` up to `cookie` can apply the
+// changes directly; otherwise (e.g. after a missed notification) it should catch up by calling
+// get_transaction_pool_changes with its cookie.
+void omq_rpc::on_pool_changes_sub_request(oxenmq::Message& m) {
+    std::unique_lock lock{subs_mutex_};
+    auto expiry = std::chrono::steady_clock::now() + 30min;
+    auto result = pool_changes_subs_.emplace(m.conn, pool_changes_sub{expiry});
+    auto cookie = std::to_string(core_.mempool.cookie());
+    if (!result.second) {
+        result.first->second.expiry = expiry;
+        log::trace(
+                logcat,
+                "Renewed pool changes subscription request from conn id {}@{}",
+                m.conn,
+                m.remote);
+        m.send_reply("ALREADY", cookie);
+    } else {
+        log::debug(
+                logcat, "New pool changes subscription request from conn {}@{}", m.conn, m.remote);
+        m.send_reply("OK", cookie);
+    }
+}
+
+// Service node list change subscriptions: [sub.sn_changes] or [sub.sn_changes, FIELDS], where
+// FIELDS is a bt-encoded or JSON list of the service node fields to include, as accepted by
+// get_service_nodes (e.g. `["active", "public_ip", "storage_port"]`, or `["all"]`).  Without
+// FIELDS only pubkeys are sent.  The reply is ["OK", HEIGHT] for a new subscription (or one with
+// different fields) or ["ALREADY", HEIGHT] for a renewed one, where HEIGHT is the current
+// blockchain height.  Subscriptions expire after 30 minutes, as with mempool subscriptions.
+//
+// Whenever a block changes the service node list the node sends [notify.sn_changes, DICT], where
+// DICT is a bt-encoded dict of:
+// - `height`, `block_hash` -- the block that the changes bring the list up to
+// - `added` -- list of dicts of newly registered nodes, each with `service_node_pubkey` plus any
+//   requested fields
+// - `changed` -- the same for nodes whose state changed (e.g. decommissions, recommissions,
+//   contributions, or being paid a reward)
+// - `proof_updated` -- the same for nodes whose state didn't change, but that sent an uptime proof
+// - `removed` -- list of (binary) pubkeys of nodes no longer registered
+//
+// These are worked out once per block by comparing against the list as of the previous
+// notification (or as of the subscription, for the first one), and are held back while the node
+// is still syncing, so a client that has fetched the list (via get_service_nodes) after
+// subscribing can keep it current by applying each notification to it.
+void omq_rpc::on_sn_changes_sub_request(oxenmq::Message& m) {
+    if (m.data.size() > 1) {
+        m.send_reply("Invalid subscription request: too many parts");
+        return;
+    }
+
+    std::unordered_set<std::string> fields;
+    try {
+        if (m.data.empty()) {
+            fields.insert("service_node_pubkey");
+        } else if (auto f = m.data[0]; !f.empty() && f.front() == 'l') {
+            oxenc::bt_list_consumer list{f};
+            while (!list.is_finished())
+                fields.insert(list.consume_string());
+        } else {
+            for (auto& field : nlohmann::json::parse(f))
+                fields.insert(field.get<std::string>());
+        }
+    } catch (const std::exception& e) {
+        m.send_reply("Invalid sn_changes subscription fields: "s + e.what());
+        return;
+    }
+    auto key = fields_key(fields);
+    auto height = std::to_string(core_.blockchain.get_current_blockchain_height());
+
+    std::unique_lock lock{subs_mutex_};
+    auto expiry = std::chrono::steady_clock::now() + 30min;
+    auto [it, inserted] = sn_changes_subs_.try_emplace(m.conn);
+    auto& sub = it->second;
+    sub.expiry = expiry;
+    if (!inserted && sub.fields_key == key) {
+        log::trace(
+                logcat,
+                "Renewed sn changes subscription request from conn id {}@{}",
+                m.conn,
+                m.remote);
+        m.send_reply("ALREADY", height);
+        return;
+    }
+    sub.fields = std::move(fields);
+    sub.fields_key = std::move(key);
+    log::debug(logcat, "New sn changes subscription request from conn {}@{}", m.conn, m.remote);
+    lock.unlock();
+    rpc_.prime_sn_changes();
+    m.send_reply("OK", height);
+}
+
 // New block subscriptions: [sub.block].  This sends a notification every time a new block is
 // added to the blockchain.
 //
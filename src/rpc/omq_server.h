@@ -58,11 +58,24 @@ class omq_rpc final {
         std::chrono::steady_clock::time_point expiry;
     };
 
+    struct pool_changes_sub {
+        std::chrono::steady_clock::time_point expiry;
+    };
+
+    struct sn_changes_sub {
+        std::chrono::steady_clock::time_point expiry;
+        std::unordered_set<std::string> fields;
+        std::string fields_key;  // See rpc::fields_key()
+    };
+
     cryptonote::core& core_;
     core_rpc_server& rpc_;
     std::shared_timed_mutex subs_mutex_;
     std::unordered_map<oxenmq::ConnectionID, mempool_sub> mempool_subs_;
     std::unordered_map<oxenmq::ConnectionID, block_sub> block_subs_;
+    std::unordered_map<oxenmq::ConnectionID, pool_changes_sub> pool_changes_subs_;
+    std::unordered_map<oxenmq::ConnectionID, sn_changes_sub> sn_changes_subs_;
+    uint64_t pool_changes_cookie_;  // The mempool cookie as of the last pool changes notification
 
   public:
     omq_rpc(cryptonote::core& core,
@@ -77,12 +90,20 @@ class omq_rpc final {
             const std::string& blob,
             const tx_pool_options& opts);
 
+    void send_sn_changes_notifications(const sn_list_changes& changes);
+
   private:
     void on_get_blocks(oxenmq::Message& m);
 
     void on_mempool_sub_request(oxenmq::Message& m);
 
     void on_block_sub_request(oxenmq::Message& m);
+
+    void on_pool_changes_sub_request(oxenmq::Message& m);
+
+    void on_sn_changes_sub_request(oxenmq::Message& m);
+
+    void send_pool_changes_notifications();
 };
 
 }  // namespace cryptonote::rpc
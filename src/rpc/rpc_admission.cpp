@@ -0,0 +1,163 @@
+#include "rpc_admission.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace cryptonote::rpc {
+
+std::string_view to_string(rpc_category cat) {
+    switch (cat) {
+        case rpc_category::fast: return "rpc_fast";
+        case rpc_category::normal: return "rpc";
+        case rpc_category::heavy: return "rpc_heavy";
+        case rpc_category::admin: return "admin";
+    }
+    return "rpc";
+}
+
+static bool is_local_address(std::string_view addr) {
+    return addr.empty() || addr.starts_with("127.") || addr.starts_with("::ffff:127.") ||
+           addr == "::1" || addr == "localhost";
+}
+
+std::string admission_client(
+        std::string_view remote, std::string_view forwarded_for, std::string local_client) {
+    if (!is_local_address(remote))
+        return std::string{remote};
+    if (auto pos = forwarded_for.rfind(','); pos != std::string_view::npos)
+        forwarded_for.remove_prefix(pos + 1);
+    while (!forwarded_for.empty() && forwarded_for.front() == ' ')
+        forwarded_for.remove_prefix(1);
+    while (!forwarded_for.empty() && forwarded_for.back() == ' ')
+        forwarded_for.remove_suffix(1);
+    if (!forwarded_for.empty())
+        return std::string{forwarded_for};
+    return local_client;
+}
+
+rpc_admission::slot::slot(
+        rpc_admission& admission, rpc_category cat, std::string client, bool admin) :
+        admission{admission},
+        cat{cat},
+        client{std::move(client)},
+        admin{admin},
+        limited{!admin && !this->client.empty()} {}
+
+rpc_admission::slot::~slot() {
+    if (running)
+        admission.finished(*this);
+}
+
+void rpc_admission::set_limits(limits l) {
+    std::lock_guard lock{m_mutex};
+    m_limits = std::move(l);
+}
+
+bool rpc_admission::can_start(const slot& s) const {
+    const auto i = static_cast<size_t>(s.cat);
+    if (m_limits.concurrency[i] && m_stats[i].running >= m_limits.concurrency[i])
+        return false;
+    if (s.limited && m_limits.per_client) {
+        if (auto it = m_client_running.find(s.client);
+            it != m_client_running.end() && it->second >= m_limits.per_client)
+            return false;
+    }
+    return true;
+}
+
+void rpc_admission::mark_running(slot& s) {
+    s.running = true;
+    m_stats[static_cast<size_t>(s.cat)].running++;
+    if (s.limited)
+        m_client_running[s.client]++;
+}
+
+std::function<void()> rpc_admission::wrap(std::shared_ptr<slot> s, job j) {
+    return [this, s = std::move(s), j = std::move(j)]() mutable {
+        s->started = std::chrono::steady_clock::now();
+        const auto waited = s->started - s->admitted;
+        {
+            std::lock_guard lock{m_mutex};
+            auto& st = m_stats[static_cast<size_t>(s->cat)];
+            st.started++;
+            st.queue_time += waited;
+            st.max_queue_time = std::max<std::chrono::nanoseconds>(st.max_queue_time, waited);
+        }
+        j(std::move(s));
+    };
+}
+
+rpc_admission::admit_result rpc_admission::admit(
+        rpc_category cat, std::string client, bool admin, job j, bool on_worker) {
+    std::shared_ptr<slot> s{new slot{*this, cat, std::move(client), admin}};
+    const auto i = static_cast<size_t>(cat);
+    {
+        std::lock_guard lock{m_mutex};
+        if (!can_start(*s)) {
+            if (m_queues[i].size() >= m_limits.max_queued[i]) {
+                m_stats[i].rejected++;
+                return admit_result::rejected;
+            }
+            m_stats[i].waited++;
+            m_queues[i].push_back({std::move(s), std::move(j)});
+            return admit_result::queued;
+        }
+        mark_running(*s);
+    }
+
+    if (on_worker)
+        wrap(std::move(s), std::move(j))();
+    else {
+        auto c = s->client;
+        m_start(cat, c, wrap(std::move(s), std::move(j)));
+    }
+    return admit_result::started;
+}
+
+void rpc_admission::finished(const slot& s) {
+    const auto ran = std::chrono::steady_clock::now() - s.started;
+    std::vector<std::shared_ptr<slot>> starting;
+    std::vector<job> jobs;
+    {
+        std::lock_guard lock{m_mutex};
+        auto& st = m_stats[static_cast<size_t>(s.cat)];
+        st.running--;
+        st.run_time += ran;
+        st.max_run_time = std::max<std::chrono::nanoseconds>(st.max_run_time, ran);
+        if (s.limited) {
+            if (auto it = m_client_running.find(s.client);
+                it != m_client_running.end() && --it->second == 0)
+                m_client_running.erase(it);
+        }
+
+        // Finishing may have made room for waiting requests in this category or, via the
+        // per-client limit, other categories; start whatever can now start, oldest first.
+        for (auto& q : m_queues) {
+            for (auto it = q.begin(); it != q.end();) {
+                if (can_start(*it->s)) {
+                    mark_running(*it->s);
+                    starting.push_back(std::move(it->s));
+                    jobs.push_back(std::move(it->j));
+                    it = q.erase(it);
+                } else
+                    ++it;
+            }
+        }
+    }
+
+    for (size_t i = 0; i < starting.size(); i++) {
+        const auto cat = starting[i]->cat;
+        const auto client = starting[i]->client;
+        m_start(cat, client, wrap(std::move(starting[i]), std::move(jobs[i])));
+    }
+}
+
+std::array<rpc_admission::category_stats, NUM_RPC_CATEGORIES> rpc_admission::stats() const {
+    std::lock_guard lock{m_mutex};
+    auto result = m_stats;
+    for (size_t i = 0; i < NUM_RPC_CATEGORIES; i++)
+        result[i].queued = m_queues[i].size();
+    return result;
+}
+
+}  // namespace cryptonote::rpc
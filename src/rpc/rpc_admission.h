@@ -0,0 +1,146 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace cryptonote::rpc {
+
+/// The worker categories that RPC requests are dispatched into, each of which is an OxenMQ
+/// category with its own reserved threads and queue.  Public commands are `normal` unless tagged
+/// FAST or HEAVY (see command_decorators.h); non-public commands are always `admin`.
+enum class rpc_category : uint8_t { fast, normal, heavy, admin };
+
+inline constexpr size_t NUM_RPC_CATEGORIES = 4;
+
+/// Returns the name of the OxenMQ category that requests of the given category run in.
+std::string_view to_string(rpc_category cat);
+
+/// Returns the client that a request counts as for the per-client limit of rpc_admission.
+///
+/// Requests are normally counted by the address they came from, `remote`.  Requests from the local
+/// host (loopback addresses, or an empty `remote` for IPC connections), however, would otherwise
+/// all count as the same client:
+/// - if `forwarded_for` (an X-Forwarded-For header) is set, the request was forwarded by a local
+///   reverse proxy and counts as the address the proxy received it from, i.e. the last one listed;
+/// - otherwise it counts as `local_client`, some identifier of its connection.  An empty
+///   `local_client` (used when there is no connection identifier to give) exempts the request from
+///   the per-client limit; it still counts towards its category's limits.
+///
+/// X-Forwarded-For is ignored on requests that don't come from the local host, as anyone could set
+/// it.
+std::string admission_client(
+        std::string_view remote, std::string_view forwarded_for, std::string local_client);
+
+/// Admission control for RPC requests.
+///
+/// Each request is admitted into its category before it runs.  A request starts right away if its
+/// category is below its concurrency limit and its client is below the per-client limit;
+/// otherwise it waits in its category's queue (or, if that is full, gets rejected) until a running
+/// request finishes and makes room for it.  This keeps expensive requests, or a single busy
+/// client, from occupying all of the workers that cheap requests from everyone else need.
+class rpc_admission {
+  public:
+    struct limits {
+        /// Maximum number of requests of each category running at once; 0 for no limit.
+        std::array<unsigned, NUM_RPC_CATEGORIES> concurrency{0, 0, 2, 0};
+        /// Maximum number of requests of each category waiting to start; further requests are
+        /// rejected.
+        std::array<size_t, NUM_RPC_CATEGORIES> max_queued{1000, 1000, 200, 100};
+        /// Maximum number of requests from a single non-admin client running at once; 0 for no
+        /// limit.
+        unsigned per_client = 4;
+    };
+
+    struct category_stats {
+        uint64_t started = 0;   // Requests started (including those that had to wait)
+        uint64_t waited = 0;    // Requests that had to wait in the queue before starting
+        uint64_t rejected = 0;  // Requests rejected because the queue was full
+        std::chrono::nanoseconds queue_time{0};  // Between admission and starting to run
+        std::chrono::nanoseconds max_queue_time{0};
+        std::chrono::nanoseconds run_time{0};
+        std::chrono::nanoseconds max_run_time{0};
+        size_t running = 0;  // Currently running
+        size_t queued = 0;   // Currently waiting
+    };
+
+    /// Held by a request while it runs; destroying the last reference to it releases the
+    /// request's admission slot and records its timing.
+    class slot {
+      public:
+        ~slot();
+        slot(const slot&) = delete;
+        slot& operator=(const slot&) = delete;
+
+      private:
+        friend class rpc_admission;
+        slot(rpc_admission& admission, rpc_category cat, std::string client, bool admin);
+
+        rpc_admission& admission;
+        rpc_category cat;
+        std::string client;
+        bool admin;
+        bool limited;          // Whether this counts towards the per-client limit
+        bool running = false;  // Whether this holds one of the category's (and client's) slots
+        std::chrono::steady_clock::time_point admitted = std::chrono::steady_clock::now();
+        std::chrono::steady_clock::time_point started;
+    };
+
+    /// A request to be run; called on a worker thread with the request's admission slot.
+    using job = std::function<void(std::shared_ptr<slot>)>;
+
+    /// Called to start an admitted request on a worker thread of the given category (e.g. by
+    /// injecting it into the category's OxenMQ workers).
+    using starter = std::function<void(
+            rpc_category, const std::string& client, std::function<void()> start)>;
+
+    enum class admit_result { started, queued, rejected };
+
+    rpc_admission() = default;
+    explicit rpc_admission(limits l) : m_limits{std::move(l)} {}
+
+    /// Sets the function used to start admitted requests.  Must be called before admit().
+    void set_starter(starter s) { m_start = std::move(s); }
+
+    void set_limits(limits l);
+
+    /// Admits a request of category `cat` from `client` (see admission_client()).  Requests from
+    /// admins, and with an empty `client`, don't count towards the per-client limit.  Returns `started` if `j` was started right away: if `on_worker` is true `j` has
+    /// been called (and has returned) on the calling thread, which must already be a worker of the
+    /// right category; otherwise it was handed to the starter.  Returns `queued` if `j` will be
+    /// handed to the starter later, once there is room, and `rejected` if the category's queue is
+    /// full, in which case `j` is not called at all.
+    admit_result admit(rpc_category cat, std::string client, bool admin, job j, bool on_worker);
+
+    /// Returns the current stats of each category
+    std::array<category_stats, NUM_RPC_CATEGORIES> stats() const;
+
+  private:
+    struct pending {
+        std::shared_ptr<slot> s;
+        job j;
+    };
+
+    // These require that m_mutex is held:
+    bool can_start(const slot& s) const;
+    void mark_running(slot& s);
+
+    std::function<void()> wrap(std::shared_ptr<slot> s, job j);
+    void finished(const slot& s);
+
+    mutable std::mutex m_mutex;
+    limits m_limits;
+    starter m_start;
+    std::array<std::deque<pending>, NUM_RPC_CATEGORIES> m_queues;
+    std::array<category_stats, NUM_RPC_CATEGORIES> m_stats;
+    std::unordered_map<std::string, unsigned> m_client_running;
+};
+
+}  // namespace cryptonote::rpc
@@ -0,0 +1,50 @@
+#include "sn_changes.h"
+
+#include <algorithm>
+
+namespace cryptonote::rpc {
+
+std::string fields_key(const std::unordered_set<std::string>& fields) {
+    std::vector<std::string_view> sorted{fields.begin(), fields.end()};
+    std::sort(sorted.begin(), sorted.end());
+    std::string key;
+    for (auto f : sorted) {
+        key += f;
+        key += '\0';
+    }
+    return key;
+}
+
+sn_list_changes sn_change_tracker::update(
+        uint64_t height, const crypto::hash& block_hash, std::vector<node> current) {
+    sn_list_changes changes;
+    changes.height = height;
+    changes.block_hash = block_hash;
+
+    std::unordered_map<crypto::public_key, last_state> next;
+    next.reserve(current.size());
+    for (auto& n : current) {
+        auto [it, inserted] =
+                next.emplace(n.info.pubkey, last_state{n.info.info, n.proof_timestamp});
+        if (!inserted || !m_primed)
+            continue;
+        auto last = m_last.find(n.info.pubkey);
+        if (last == m_last.end())
+            changes.added.push_back(std::move(n.info));
+        else if (last->second.info != n.info.info)
+            changes.changed.push_back(std::move(n.info));
+        else if (last->second.proof_timestamp != n.proof_timestamp)
+            changes.proof_updated.push_back(std::move(n.info));
+    }
+
+    if (m_primed)
+        for (const auto& [pubkey, last] : m_last)
+            if (!next.count(pubkey))
+                changes.removed.push_back(pubkey);
+
+    m_last = std::move(next);
+    m_primed = true;
+    return changes;
+}
+
+}  // namespace cryptonote::rpc
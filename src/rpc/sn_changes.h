@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "crypto/crypto.h"
+#include "crypto/hash.h"
+#include "cryptonote_core/service_node_list.h"
+
+namespace cryptonote::rpc {
+
+/// The changes to the service node list between two blocks, as delivered to sn_changes
+/// subscribers.  A node appears in at most one of the lists.
+struct sn_list_changes {
+    uint64_t height = 0;  // Height of the block the changes take the list to
+    crypto::hash block_hash{};
+    /// Nodes that are newly registered
+    std::vector<service_nodes::service_node_pubkey_info> added;
+    /// Nodes that are no longer registered (i.e. deregistered or unlocked)
+    std::vector<crypto::public_key> removed;
+    /// Nodes whose state (e.g. active/decommissioned, contributions, last reward) changed
+    std::vector<service_nodes::service_node_pubkey_info> changed;
+    /// Nodes whose state didn't change, but which sent us a new uptime proof
+    std::vector<service_nodes::service_node_pubkey_info> proof_updated;
+
+    bool empty() const {
+        return added.empty() && removed.empty() && changed.empty() && proof_updated.empty();
+    }
+};
+
+/// Returns a canonical string for a set of requested sn_changes fields, so that subscribers that
+/// want the same fields can share one rendering of each notification.
+std::string fields_key(const std::unordered_set<std::string>& fields);
+
+/// Tracks the service node list from one block to the next to work out what each block changed.
+///
+/// Service node states are shared (and never modified once shared) between successive states of
+/// the service node list, so a node's state changed if and only if it is held by a different
+/// pointer than before.  (The converse doesn't quite hold: a state rebuilt from scratch, e.g.
+/// after a reorg, shows every node as changed even if its state came out the same).
+class sn_change_tracker {
+  public:
+    struct node {
+        service_nodes::service_node_pubkey_info info;
+        uint64_t proof_timestamp;  // 0 if we have no proof from the node
+    };
+
+    /// Compares `current`, the full service node list as of the given block, against the list
+    /// passed to the previous call and returns the difference.  The first call only records the
+    /// list and returns no changes.
+    sn_list_changes update(
+            uint64_t height, const crypto::hash& block_hash, std::vector<node> current);
+
+    /// True once update() has recorded a list to compare against
+    bool primed() const { return m_primed; }
+
+    /// Forgets the recorded list, so that the next update() only records again
+    void reset() {
+        m_last.clear();
+        m_primed = false;
+    }
+
+  private:
+    struct last_state {
+        std::shared_ptr<const service_nodes::service_node_info> info;
+        uint64_t proof_timestamp;
+    };
+    std::unordered_map<crypto::public_key, last_state> m_last;
+    bool m_primed = false;
+};
+
+}  // namespace cryptonote::rpc
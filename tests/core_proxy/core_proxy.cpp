@@ -181,7 +181,16 @@ std::vector<cryptonote::tx_verification_batch_info> tests::proxy_core::parse_inc
     return tx_info;
 }
 
-bool tests::proxy_core::handle_parsed_txs(std::vector<cryptonote::tx_verification_batch_info> &parsed_txs, const tx_pool_options &opts, uint64_t *blink_rollback_height) {
+std::vector<tx_verification_batch_info> tests::proxy_core::parse_incoming_block_txs(const std::vector<cryptonote::block_complete_entry>& blocks) {
+    std::vector<tx_verification_batch_info> tx_info;
+    for (const auto& entry : blocks) {
+        auto parsed = parse_incoming_txs(entry.txs, tx_pool_options::from_block());
+        tx_info.insert(tx_info.end(), parsed.begin(), parsed.end());
+    }
+    return tx_info;
+}
+
+bool tests::proxy_core::handle_parsed_txs(std::span<cryptonote::tx_verification_batch_info> parsed_txs, const tx_pool_options &opts, uint64_t *blink_rollback_height) {
 
     if (blink_rollback_height) *blink_rollback_height = 0;
 
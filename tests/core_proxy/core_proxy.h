@@ -75,12 +75,16 @@ namespace tests
     bool deinit(){return true;}
     bool handle_incoming_tx(const std::string& tx_blob, cryptonote::tx_verification_context& tvc, const cryptonote::tx_pool_options &opts);
     std::vector<cryptonote::tx_verification_batch_info> parse_incoming_txs(const std::vector<std::string>& tx_blobs, const cryptonote::tx_pool_options &opts);
-    bool handle_parsed_txs(std::vector<cryptonote::tx_verification_batch_info> &parsed_txs, const cryptonote::tx_pool_options &opts, uint64_t *blink_rollback_height = nullptr);
+    std::vector<cryptonote::tx_verification_batch_info> parse_incoming_block_txs(const std::vector<cryptonote::block_complete_entry>& blocks);
+    bool handle_parsed_txs(std::span<cryptonote::tx_verification_batch_info> parsed_txs, const cryptonote::tx_pool_options &opts, uint64_t *blink_rollback_height = nullptr);
+    bool handle_parsed_block_txs(std::span<cryptonote::tx_verification_batch_info> parsed_txs) { return true; }
+    uint64_t get_block_txs_staged() const { return 0; }
     std::vector<cryptonote::tx_verification_batch_info> handle_incoming_txs(const std::vector<std::string>& tx_blobs, const cryptonote::tx_pool_options &opts);
     std::pair<std::vector<std::shared_ptr<cryptonote::blink_tx>>, std::unordered_set<crypto::hash>> parse_incoming_blinks(const std::vector<cryptonote::serializable_blink_metadata> &blinks);
     int add_blinks(const std::vector<std::shared_ptr<cryptonote::blink_tx>> &blinks) { return 0; }
     bool handle_incoming_block(const std::string& block_blob, const cryptonote::block *block, cryptonote::block_verification_context& bvc, cryptonote::checkpoint_t *checkpoint, bool update_miner_blocktemplate = true);
     bool handle_uptime_proof(const cryptonote::NOTIFY_BTENCODED_UPTIME_PROOF::request &proof, bool &my_uptime_proof_confirmation);
+    bool want_uptime_proof(const crypto::public_key &pubkey, uint64_t timestamp) const { return false; }
     void pause_mine(){}
     void resume_mine(){}
     bool on_idle(){return true;}
@@ -111,6 +115,8 @@ namespace tests
         bool have_block(const crypto::hash& id);
         bool get_blocks(uint64_t start_offset, size_t count, std::vector<std::pair<std::string, cryptonote::block>>& blocks, std::vector<std::string>& txs) const { return false; }
         bool get_transactions(const std::vector<crypto::hash>& txs_ids, std::vector<cryptonote::transaction>& txs, std::unordered_set<crypto::hash>* missed_txs = nullptr) const { return false; }
+        bool get_transactions_blobs(const std::vector<crypto::hash>& txs_ids, std::vector<std::string>& txs, std::unordered_set<crypto::hash>* missed_txs = nullptr, bool pruned = false) const { return false; }
+        bool have_tx(const crypto::hash &id) const { return false; }
         bool get_block_by_hash(const crypto::hash &h, cryptonote::block &blk, bool *orphan = NULL) const { return false; }
         bool get_short_chain_history(std::list<crypto::hash>& ids);
         bool blink_rollback(uint64_t rollback_height) { return false; }
@@ -143,6 +149,7 @@ namespace tests
       std::shared_ptr<cryptonote::blink_tx> get_blink(crypto::hash &) { return nullptr; }
       bool get_transaction(const crypto::hash& id, std::string& tx_blob) const { return false; }
       bool have_tx(const crypto::hash &txid) const { return false; }
+      void get_transaction_hashes(std::vector<crypto::hash>& txs, bool include_unrelayed_txes = true, bool include_only_blinked = false) const {}
       std::map<uint64_t, crypto::hash> get_blink_checksums() const { return {}; }
       std::vector<crypto::hash> get_mined_blinks(const std::set<uint64_t> &) const { return {}; }
       void keep_missing_blinks(std::vector<crypto::hash> &tx_hashes) const {}
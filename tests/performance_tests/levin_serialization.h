@@ -0,0 +1,98 @@
+// Copyright (c) 2014-2018, The Monero Project
+// 
+// All rights reserved.
+// 
+// Redistribution and use in source and binary forms, with or without modification, are
+// permitted provided that the following conditions are met:
+// 
+// 1. Redistributions of source code must retain the above copyright notice, this list of
+//    conditions and the following disclaimer.
+// 
+// 2. Redistributions in binary form must reproduce the above copyright notice, this list
+//    of conditions and the following disclaimer in the documentation and/or other
+//    materials provided with the distribution.
+// 
+// 3. Neither the name of the copyright holder nor the names of its contributors may be
+//    used to endorse or promote products derived from this software without specific
+//    prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+// MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL
+// THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF
+// THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+// 
+// Parts of this file are originally copyright (c) 2012-2013 The Cryptonote developers
+
+
+#pragma once
+
+#include "crypto/crypto.h"
+#include "cryptonote_protocol/cryptonote_protocol_defs.h"
+#include "epee/storages/portable_storage_template_helper.h"
+
+// Serializes (or deserializes) a span of blocks as sent in a NOTIFY_RESPONSE_GET_BLOCKS, either
+// directly or through an epee portable_storage.
+template<bool direct, bool store>
+class test_levin_serialization
+{
+public:
+  static const size_t loop_count = 100;
+
+  bool init()
+  {
+    for (size_t i = 0; i < 100; i++)
+    {
+      auto& b = m_request.blocks.emplace_back();
+      b.block = random_string(500);
+      for (size_t j = 0; j < 10; j++)
+        b.txs.push_back(random_string(2000));
+      auto& blink = b.blinks.emplace_back();
+      blink.tx_hash = crypto::rand<crypto::hash>();
+      blink.height = i;
+      blink.quorum = {0, 0, 1, 1};
+      blink.position = {0, 1, 2, 3};
+      blink.signature.resize(4);
+    }
+    m_request.current_blockchain_height = 100;
+    store_dom(m_blob);
+    return true;
+  }
+
+  bool test()
+  {
+    if (store)
+    {
+      std::string blob;
+      if (direct)
+        return epee::serialization::store_t_to_binary(m_request, blob);
+      return store_dom(blob);
+    }
+    cryptonote::NOTIFY_RESPONSE_GET_BLOCKS::request req;
+    if (direct)
+      return epee::serialization::load_t_from_binary(req, m_blob);
+    epee::serialization::portable_storage ps;
+    return ps.load_from_binary(m_blob) && req.load(ps);
+  }
+
+private:
+  static std::string random_string(size_t size)
+  {
+    std::string s(size, '\0');
+    crypto::rand(size, reinterpret_cast<uint8_t*>(s.data()));
+    return s;
+  }
+
+  bool store_dom(std::string& blob)
+  {
+    epee::serialization::portable_storage ps;
+    return m_request.store(ps) && ps.store_to_binary(blob);
+  }
+
+  cryptonote::NOTIFY_RESPONSE_GET_BLOCKS::request m_request;
+  std::string m_blob;
+};
@@ -58,6 +58,7 @@
 #include "crypto_ops.h"
 #include "multiexp.h"
 #include "sig_clsag.h"
+#include "levin_serialization.h"
 
 namespace po = boost::program_options;
 
@@ -212,6 +213,11 @@ int main(int argc, char** argv)
   TEST_PERFORMANCE2(filter, p, test_equality, verify32, false);
   TEST_PERFORMANCE2(filter, p, test_equality, verify32, false);
 
+  TEST_PERFORMANCE2(filter, p, test_levin_serialization, false, true); // store via portable_storage
+  TEST_PERFORMANCE2(filter, p, test_levin_serialization, true, true);
+  TEST_PERFORMANCE2(filter, p, test_levin_serialization, false, false); // load via portable_storage
+  TEST_PERFORMANCE2(filter, p, test_levin_serialization, true, false);
+
   TEST_PERFORMANCE2(filter, p, test_bulletproof, true, 1); // 1 bulletproof with 1 amount
   TEST_PERFORMANCE2(filter, p, test_bulletproof, false, 1);
 
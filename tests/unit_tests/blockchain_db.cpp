@@ -336,4 +336,42 @@ TYPED_TEST(BlockchainDBTest, RetrieveBlockData)
   ASSERT_HASH_EQ(get_block_hash(this->m_blocks[1].first), hashes[1]);
 }
 
+TYPED_TEST(BlockchainDBTest, KeyImages)
+{
+  fs::path tempPath = random_tmp_file();
+  std::string dirPath = tempPath.string();
+
+  this->set_prefix(dirPath);
+
+  ASSERT_NO_THROW(this->m_db->open(dirPath, network_type::FAKECHAIN));
+  this->get_filenames();
+
+  db_wtxn_guard guard{*this->m_db};
+
+  ASSERT_NO_THROW(this->m_db->add_block(this->m_blocks[0], t_sizes[0], t_sizes[0], t_diffs[0], t_coins[0], this->m_txs[0]));
+  ASSERT_NO_THROW(this->m_db->add_block(this->m_blocks[1], t_sizes[1], t_sizes[1], t_diffs[1], t_coins[1], this->m_txs[1]));
+
+  // Interleave the spent key images with unspent ones, in no particular order
+  std::vector<crypto::key_image> key_images;
+  std::vector<bool> expected;
+  for (auto& txs : this->m_txs)
+    for (auto& [tx, blob] : txs)
+      for (auto& in : tx.vin)
+        if (auto* in_to_key = std::get_if<txin_to_key>(&in))
+        {
+          key_images.push_back(in_to_key->k_image);
+          expected.push_back(true);
+          key_images.push_back(crypto::rand<crypto::key_image>());
+          expected.push_back(false);
+        }
+  ASSERT_FALSE(key_images.empty());
+  // Repeated lookups of the same key image work too
+  key_images.push_back(key_images.front());
+  expected.push_back(true);
+
+  EXPECT_EQ(this->m_db->has_key_images(key_images), expected);
+  for (size_t i = 0; i < key_images.size(); i++)
+    EXPECT_EQ(this->m_db->has_key_image(key_images[i]), expected[i]);
+}
+
 }  // anonymous namespace
@@ -35,10 +35,29 @@
 #include "ringct/rctOps.h"
 #include "ringct/rctSigs.h"
 #include "ringct/bulletproofs.h"
+#include "ringct/bulletproofs_generators.h"
+#include "common/varint.h"
+#include "cryptonote_config.h"
 #include "cryptonote_basic/cryptonote_format_utils.h"
 #include "device/device.hpp"
 #include "epee/misc_log_ex.h"
 
+TEST(bulletproofs, generators)
+{
+  // The precomputed generator table must match hashing the generators the slow way
+  for (size_t i = 0; i < 2 * BULLETPROOF_GENERATORS; ++i)
+  {
+    std::string hashed = std::string((const char*)rct::H.bytes, sizeof(rct::H)) +
+        std::string(cryptonote::hashkey::BULLETPROOF_EXPONENT) + tools::get_varint_data(i);
+    ge_p3 expected_p3;
+    rct::hash_to_p3(expected_p3, rct::hash2rct(crypto::cn_fast_hash(hashed.data(), hashed.size())));
+    rct::key expected, actual;
+    ge_p3_tobytes(expected.bytes, &expected_p3);
+    ge_p3_tobytes(actual.bytes, i % 2 ? &bulletproof_Gi_p3[i / 2] : &bulletproof_Hi_p3[i / 2]);
+    ASSERT_EQ(actual, expected) << "generator " << i;
+  }
+}
+
 TEST(bulletproofs, valid_zero)
 {
   rct::Bulletproof proof = bulletproof_PROVE(0, rct::skGen());
@@ -297,6 +316,9 @@ TEST(bulletproof, weight_pruned)
     ASSERT_TRUE(tx.version == cryptonote::txversion::v2_ringct);
     ASSERT_FALSE(tx.pruned);
     ASSERT_TRUE(rct::is_rct_bulletproof(tx.rct_signatures.type));
+    crypto::hash blob_tx_hash;
+    ASSERT_TRUE(cryptonote::calculate_transaction_hash_from_blob(bd, blob_tx_hash));
+    ASSERT_EQ(blob_tx_hash, tx_hash);
     const uint64_t tx_size = bd.size();
     const uint64_t tx_weight = cryptonote::get_transaction_weight(tx);
     ASSERT_TRUE(parse_and_validate_tx_base_from_blob(bd, pruned_tx));
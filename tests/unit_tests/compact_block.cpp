@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+
+#include "crypto/crypto.h"
+#include "cryptonote_protocol/compact_block.h"
+
+using namespace cryptonote;
+
+static std::vector<crypto::hash> random_hashes(size_t n) {
+    std::vector<crypto::hash> hashes(n);
+    for (auto& h : hashes)
+        h = crypto::rand<crypto::hash>();
+    return hashes;
+}
+
+TEST(compact_block, short_id_pack_unpack) {
+    auto block_hash = crypto::rand<crypto::hash>();
+    auto key = compact_block::make_short_id_key(block_hash, 42);
+    auto txids = random_hashes(20);
+
+    std::string packed;
+    for (const auto& txid : txids)
+        compact_block::append_short_id(packed, key, txid);
+    ASSERT_EQ(packed.size(), txids.size() * compact_block::SHORT_ID_BYTES);
+
+    auto ids = compact_block::unpack_short_ids(packed);
+    ASSERT_TRUE(ids);
+    ASSERT_EQ(ids->size(), txids.size());
+    for (size_t i = 0; i < txids.size(); i++) {
+        EXPECT_EQ((*ids)[i], compact_block::short_id(key, txids[i]));
+        EXPECT_LT((*ids)[i], uint64_t{1} << (8 * compact_block::SHORT_ID_BYTES));
+    }
+
+    EXPECT_FALSE(compact_block::unpack_short_ids(packed.substr(1)));
+    auto empty = compact_block::unpack_short_ids("");
+    ASSERT_TRUE(empty);
+    EXPECT_TRUE(empty->empty());
+}
+
+TEST(compact_block, short_id_salted) {
+    auto block_hash = crypto::rand<crypto::hash>();
+    auto txid = crypto::rand<crypto::hash>();
+    auto key1 = compact_block::make_short_id_key(block_hash, 1);
+    auto key2 = compact_block::make_short_id_key(block_hash, 2);
+    auto key3 = compact_block::make_short_id_key(crypto::rand<crypto::hash>(), 1);
+    EXPECT_EQ(key1, compact_block::make_short_id_key(block_hash, 1));
+    EXPECT_NE(key1, key2);
+    EXPECT_NE(key1, key3);
+    EXPECT_NE(compact_block::short_id(key1, txid), compact_block::short_id(key2, txid));
+}
+
+TEST(compact_block, match_short_ids) {
+    auto key = compact_block::make_short_id_key(crypto::rand<crypto::hash>(), 123);
+    auto pool = random_hashes(500);
+    auto missing = random_hashes(3);
+
+    std::vector<crypto::hash> block_txs{pool[7], missing[0], pool[499], pool[0], missing[1]};
+    std::vector<uint64_t> ids;
+    for (const auto& txid : block_txs)
+        ids.push_back(compact_block::short_id(key, txid));
+
+    // Duplicates of the same hash in the candidate list must not be treated as ambiguous
+    pool.push_back(pool[7]);
+
+    auto matched = compact_block::match_short_ids(key, ids, pool);
+    ASSERT_EQ(matched.size(), block_txs.size());
+    ASSERT_TRUE(matched[0]);
+    EXPECT_EQ(*matched[0], pool[7]);
+    EXPECT_FALSE(matched[1]);
+    ASSERT_TRUE(matched[2]);
+    EXPECT_EQ(*matched[2], pool[499]);
+    ASSERT_TRUE(matched[3]);
+    EXPECT_EQ(*matched[3], pool[0]);
+    EXPECT_FALSE(matched[4]);
+
+    EXPECT_TRUE(compact_block::match_short_ids(key, {}, pool).empty());
+    auto none = compact_block::match_short_ids(key, ids, {});
+    ASSERT_EQ(none.size(), ids.size());
+    for (const auto& m : none)
+        EXPECT_FALSE(m);
+}
@@ -50,6 +50,7 @@
 #include "epee/net/net_utils_base.h"
 #include "epee/net/local_ip.h"
 #include "epee/net/buffer.h"
+#include "epee/net/command_stats.h"
 #include "p2p/net_peerlist_boost_serialization.h"
 #include "epee/span.h"
 #include "epee/string_tools.h"
@@ -759,6 +760,43 @@ TEST(net_buffer, move)
   ASSERT_TRUE(!memcmp(span.data() + 1, std::string(4000, '0').c_str(), 4000));
 }
 
+TEST(command_stats, record)
+{
+  using namespace std::literals;
+  epee::net_utils::command_stats_table<std::string> table;
+
+  table.record("a"sv, 100, 10, 5ms);
+  table.record("a"sv, 50, 0, 2ms, 7ms);
+  table.record("b"sv, 1, 2, 1ms);
+  table.record_sent("c"sv, 42);
+
+  auto stats = table.snapshot();
+  ASSERT_EQ(stats.size(), 3);
+  const auto& a = stats.at("a");
+  EXPECT_EQ(a.count, 2);
+  EXPECT_EQ(a.bytes_in, 150);
+  EXPECT_EQ(a.bytes_out, 10);
+  EXPECT_EQ(a.cpu_time, 7ms);
+  EXPECT_EQ(a.max_cpu_time, 5ms);
+  EXPECT_EQ(a.queue_delay, 7ms);
+  EXPECT_EQ(a.max_queue_delay, 7ms);
+  EXPECT_EQ(stats.at("b").count, 1);
+  EXPECT_EQ(stats.at("c").count, 0);
+  EXPECT_EQ(stats.at("c").bytes_out, 42);
+
+  table.clear();
+  EXPECT_TRUE(table.snapshot().empty());
+}
+
+TEST(command_stats, cpu_timer)
+{
+  epee::net_utils::cpu_timer timer;
+  volatile uint64_t x = 0;
+  for (uint64_t i = 0; i < 10000000; ++i)
+    x = x + i;
+  EXPECT_GT(timer.elapsed().count(), 0);
+}
+
 TEST(parsing, isspace)
 {
   ASSERT_FALSE(epee::misc_utils::parse::isspace(0));
@@ -0,0 +1,54 @@
+#include "blockchain_db/key_image_filter.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using cryptonote::key_image_filter;
+
+TEST(key_image_filter, no_false_negatives) {
+    key_image_filter filter{1000};
+    std::vector<crypto::key_image> kis;
+    for (int i = 0; i < 1000; i++) {
+        kis.push_back(crypto::rand<crypto::key_image>());
+        filter.insert(kis.back());
+    }
+    EXPECT_EQ(filter.size(), 1000);
+    for (const auto& ki : kis)
+        EXPECT_TRUE(filter.maybe_contains(ki));
+}
+
+TEST(key_image_filter, false_positive_rate) {
+    key_image_filter filter{100'000};
+    for (int i = 0; i < 100'000; i++)
+        filter.insert(crypto::rand<crypto::key_image>());
+
+    int false_positives = 0;
+    for (int i = 0; i < 100'000; i++)
+        false_positives += filter.maybe_contains(crypto::rand<crypto::key_image>());
+    EXPECT_LT(false_positives, 2'000);
+}
+
+TEST(key_image_filter, grows) {
+    key_image_filter filter;
+    const auto initial_memory = filter.memory_usage();
+    std::vector<crypto::key_image> kis;
+    for (size_t i = 0; i < 4 * key_image_filter::MIN_CAPACITY; i++) {
+        kis.push_back(crypto::rand<crypto::key_image>());
+        filter.insert(kis.back());
+    }
+    EXPECT_GT(filter.memory_usage(), initial_memory);
+    for (const auto& ki : kis)
+        ASSERT_TRUE(filter.maybe_contains(ki));
+
+    // Growing shouldn't have made the false positive rate much worse
+    int false_positives = 0;
+    for (int i = 0; i < 100'000; i++)
+        false_positives += filter.maybe_contains(crypto::rand<crypto::key_image>());
+    EXPECT_LT(false_positives, 4'000);
+
+    filter.clear();
+    EXPECT_EQ(filter.size(), 0);
+    EXPECT_EQ(filter.memory_usage(), initial_memory);
+    EXPECT_FALSE(filter.maybe_contains(kis.front()));
+}
@@ -120,13 +120,14 @@ namespace
         epee::levin::async_protocol_handler<cryptonote::levin::detail::p2p_context> handler_;
 
     public:
-        test_connection(boost::asio::io_service& io_service, cryptonote::levin::connections& connections, boost::uuids::random_generator& random_generator, const bool is_incoming)
+        test_connection(boost::asio::io_service& io_service, cryptonote::levin::connections& connections, boost::uuids::random_generator& random_generator, const bool is_incoming, const uint32_t support_flags = 0)
           : endpoint_(io_service),
             context_(),
             handler_(std::addressof(endpoint_), connections, context_)
         {
             using base_type = epee::net_utils::connection_context_base;
             static_cast<base_type&>(context_) = base_type{random_generator(), {}, is_incoming};
+            context_.m_support_flags = support_flags;
             handler_.after_init_connection();
         }
 
@@ -227,6 +228,13 @@ namespace
             return notified_.size();
         }
 
+        int front_notified_command() const
+        {
+            if (notified_.empty())
+                throw std::logic_error{"Queue has no received messges"};
+            return notified_.front().command;
+        }
+
         template<typename T>
         std::pair<boost::uuids::uuid, typename T::request> get_invoked()
         {
@@ -264,9 +272,9 @@ namespace
             EXPECT_EQ(0u, receiver_.notified_size());
         }
 
-        void add_connection(const bool is_incoming)
+        void add_connection(const bool is_incoming, const uint32_t support_flags = 0)
         {
-            contexts_.emplace_back(io_service_, *connections_, random_generator_, is_incoming);
+            contexts_.emplace_back(io_service_, *connections_, random_generator_, is_incoming, support_flags);
             EXPECT_TRUE(connection_ids_.emplace(contexts_.back().get_id()).second);
             EXPECT_EQ(connection_ids_.size(), connections_->get_connections_count());
         }
@@ -504,6 +512,96 @@ TEST_F(levin_notify, flood)
     }
 }
 
+TEST_F(levin_notify, flood_announce)
+{
+    cryptonote::levin::notify notifier = make_notifier(0, true);
+
+    // Incoming connections with announcement support get hashes, everyone else the full txs
+    for (unsigned count = 0; count < 10; ++count)
+        add_connection(count % 2 == 0, count < 6 ? cryptonote::p2p::SUPPORT_FLAG_TX_ANNOUNCE : 0);
+
+    std::vector<std::string> txs(2);
+    txs[0].resize(100, 'f');
+    txs[1].resize(200, 'e');
+    std::vector<crypto::hash> hashes{crypto::rand<crypto::hash>(), crypto::rand<crypto::hash>()};
+
+    ASSERT_EQ(10u, contexts_.size());
+    {
+        auto context = contexts_.begin();
+        EXPECT_TRUE(notifier.send_txs(txs, context->get_id(), false, hashes));
+
+        io_service_.reset();
+        ASSERT_LT(0u, io_service_.poll());
+        EXPECT_EQ(0u, context->process_send_queue());
+
+        std::sort(txs.begin(), txs.end());
+        std::sort(hashes.begin(), hashes.end());
+        for (++context; context != contexts_.end(); ++context)
+        {
+            const std::size_t index = context - contexts_.begin();
+            EXPECT_EQ(1u, context->process_send_queue());
+            ASSERT_EQ(1u, receiver_.notified_size());
+            if (index % 2 == 0 && index < 6)
+            {
+                auto notification = receiver_.get_notification<cryptonote::NOTIFY_TX_ANNOUNCE>().second;
+                EXPECT_EQ(hashes, notification.txs);
+            }
+            else
+            {
+                auto notification = receiver_.get_notification<cryptonote::NOTIFY_NEW_TRANSACTIONS>().second;
+                EXPECT_EQ(txs, notification.txs);
+            }
+        }
+    }
+}
+
+TEST_F(levin_notify, flood_announce_outgoing)
+{
+    cryptonote::levin::notify notifier = make_notifier(0, true);
+
+    // Only a few outgoing connections get the full txs, the others get hashes
+    for (unsigned count = 0; count < 10; ++count)
+        add_connection(false, cryptonote::p2p::SUPPORT_FLAG_TX_ANNOUNCE);
+
+    std::vector<std::string> txs(2);
+    txs[0].resize(100, 'f');
+    txs[1].resize(200, 'e');
+    std::vector<crypto::hash> hashes{crypto::rand<crypto::hash>(), crypto::rand<crypto::hash>()};
+
+    ASSERT_EQ(10u, contexts_.size());
+    {
+        auto context = contexts_.begin();
+        EXPECT_TRUE(notifier.send_txs(txs, context->get_id(), false, hashes));
+
+        io_service_.reset();
+        ASSERT_LT(0u, io_service_.poll());
+        EXPECT_EQ(0u, context->process_send_queue());
+
+        std::sort(txs.begin(), txs.end());
+        std::sort(hashes.begin(), hashes.end());
+        std::size_t full = 0, announced = 0;
+        for (++context; context != contexts_.end(); ++context)
+        {
+            EXPECT_EQ(1u, context->process_send_queue());
+            ASSERT_EQ(1u, receiver_.notified_size());
+            if (receiver_.front_notified_command() == cryptonote::NOTIFY_TX_ANNOUNCE::ID)
+            {
+                auto notification = receiver_.get_notification<cryptonote::NOTIFY_TX_ANNOUNCE>().second;
+                EXPECT_EQ(hashes, notification.txs);
+                ++announced;
+            }
+            else
+            {
+                auto notification = receiver_.get_notification<cryptonote::NOTIFY_NEW_TRANSACTIONS>().second;
+                EXPECT_EQ(txs, notification.txs);
+                ++full;
+            }
+        }
+        EXPECT_EQ(cryptonote::p2p::TX_FULL_RELAY_OUTGOING_PEERS, full);
+        EXPECT_EQ(9u - cryptonote::p2p::TX_FULL_RELAY_OUTGOING_PEERS, announced);
+    }
+}
+
 TEST_F(levin_notify, private_flood)
 {
     cryptonote::levin::notify notifier = make_notifier(0, false);
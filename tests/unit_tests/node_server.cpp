@@ -37,6 +37,9 @@
 #include "cryptonote_core/blockchain.h"
 #include "cryptonote_core/cryptonote_tx_utils.h"
 
+#include <boost/uuid/uuid_generators.hpp>
+#include <oxenc/bt_producer.h>
+
 #define MAKE_IPV4_ADDRESS(a,b,c,d) epee::net_utils::ipv4_network_address{MAKE_IP(a,b,c,d),0}
 #define MAKE_IPV4_ADDRESS_PORT(a,b,c,d,e) epee::net_utils::ipv4_network_address{MAKE_IP(a,b,c,d),e}
 #define MAKE_IPV4_SUBNET(a,b,c,d,e) epee::net_utils::ipv4_network_subnet{MAKE_IP(a,b,c,d),e}
@@ -63,13 +66,19 @@ public:
   bool init(const boost::program_options::variables_map& vm) {return true ;}
   bool deinit(){return true;}
   std::vector<cryptonote::tx_verification_batch_info> parse_incoming_txs(const std::vector<std::string>& tx_blobs, const cryptonote::tx_pool_options &opts) { return {}; }
-  bool handle_parsed_txs(std::vector<cryptonote::tx_verification_batch_info> &parsed_txs, const cryptonote::tx_pool_options &opts, uint64_t *blink_rollback_height = nullptr) { if (blink_rollback_height) *blink_rollback_height = 0; return true; }
+  std::vector<cryptonote::tx_verification_batch_info> parse_incoming_block_txs(const std::vector<cryptonote::block_complete_entry>& blocks) { return {}; }
+  bool handle_parsed_txs(std::span<cryptonote::tx_verification_batch_info> parsed_txs, const cryptonote::tx_pool_options &opts, uint64_t *blink_rollback_height = nullptr) { if (blink_rollback_height) *blink_rollback_height = 0; return true; }
+  bool handle_parsed_block_txs(std::span<cryptonote::tx_verification_batch_info> parsed_txs) { return true; }
+  uint64_t get_block_txs_staged() const { return 0; }
   std::vector<cryptonote::tx_verification_batch_info> handle_incoming_txs(const std::vector<std::string>& tx_blobs, const cryptonote::tx_pool_options &opts) { return {}; }
   bool handle_incoming_tx(const std::string& tx_blob, cryptonote::tx_verification_context& tvc, const cryptonote::tx_pool_options &opts) { return true; }
   std::pair<std::vector<std::shared_ptr<cryptonote::blink_tx>>, std::unordered_set<crypto::hash>> parse_incoming_blinks(const std::vector<cryptonote::serializable_blink_metadata> &blinks) { return {}; }
   int add_blinks(const std::vector<std::shared_ptr<cryptonote::blink_tx>> &blinks) { return 0; }
   bool handle_incoming_block(const std::string& block_blob, const cryptonote::block *block, cryptonote::block_verification_context& bvc, cryptonote::checkpoint_t const *checkpoint, bool update_miner_blocktemplate = true) { return true; }
-  bool handle_uptime_proof(const cryptonote::NOTIFY_BTENCODED_UPTIME_PROOF::request &proof, bool &my_uptime_proof_confirmation) { return false; }
+  bool handle_uptime_proof(const cryptonote::NOTIFY_BTENCODED_UPTIME_PROOF::request &proof, bool &my_uptime_proof_confirmation) { uptime_proofs_handled++; return accept_uptime_proofs; }
+  int uptime_proofs_handled = 0;
+  bool accept_uptime_proofs = false;
+  bool want_uptime_proof(const crypto::public_key &pubkey, uint64_t timestamp) const { return false; }
   struct faker_miner {
       void pause() {}
       void resume() {}
@@ -83,6 +92,8 @@ public:
     bool have_block(const crypto::hash& id) const {return true;}
     bool get_blocks(uint64_t start_offset, size_t count, std::vector<std::pair<std::string, cryptonote::block>>& blocks, std::vector<std::string>& txs) const { return false; }
     bool get_transactions(const std::vector<crypto::hash>& txs_ids, std::vector<cryptonote::transaction>& txs, std::unordered_set<crypto::hash>* missed_txs) const { return false; }
+    bool get_transactions_blobs(const std::vector<crypto::hash>& txs_ids, std::vector<std::string>& txs, std::unordered_set<crypto::hash>* missed_txs = nullptr, bool pruned = false) const { return false; }
+    bool have_tx(const crypto::hash &id) const { return false; }
     bool get_block_by_hash(const crypto::hash &h, cryptonote::block &blk, bool *orphan = NULL) const { return false; }
     bool handle_get_blocks(cryptonote::NOTIFY_REQUEST_GET_BLOCKS::request& arg, cryptonote::NOTIFY_RESPONSE_GET_BLOCKS::request& rsp){return true;}
     bool handle_get_txs(cryptonote::NOTIFY_REQUEST_GET_TXS::request&, cryptonote::NOTIFY_NEW_TRANSACTIONS::request&) { return true; }
@@ -127,6 +138,7 @@ public:
       std::shared_ptr<cryptonote::blink_tx> get_blink(crypto::hash &) { return nullptr; }
       bool get_transaction(const crypto::hash& id, std::string& tx_blob) const { return false; }
       bool have_tx(const crypto::hash &txid) const { return false; }
+      void get_transaction_hashes(std::vector<crypto::hash>& txs, bool include_unrelayed_txes = true, bool include_only_blinked = false) const {}
       std::map<uint64_t, crypto::hash> get_blink_checksums() const { return {}; }
       std::vector<crypto::hash> get_mined_blinks(const std::set<uint64_t> &) const { return {}; }
       void keep_missing_blinks(std::vector<crypto::hash> &tx_hashes) const {}
@@ -350,5 +362,141 @@ TEST(node_server, bind_same_p2p_port)
   EXPECT_TRUE(init(new_node(), port_another));
 }
 
+namespace
+{
+  // Records what the protocol handler sends instead of sending it
+  struct proof_relay_endpoint : nodetool::p2p_endpoint_stub<cryptonote::cryptonote_connection_context>
+  {
+    std::vector<cryptonote::cryptonote_connection_context> connections;
+    std::vector<std::pair<int, boost::uuids::uuid>> sent; // command and connection of each notification
+
+    void for_each_connection(std::function<bool(cryptonote::cryptonote_connection_context&, nodetool::peerid_type)> f) override
+    {
+      for (auto& c : connections)
+        if (!f(c, 1))
+          break;
+    }
+    bool relay_notify_to_list(int command, const epee::span<const uint8_t> data_buff, std::vector<std::pair<epee::net_utils::zone, boost::uuids::uuid>> conns) override
+    {
+      for (const auto& [zone, conn] : conns)
+        sent.emplace_back(command, conn);
+      return true;
+    }
+    bool invoke_notify_to_peer(int command, const epee::span<const uint8_t> req_buff, const epee::net_utils::connection_context_base& context) override
+    {
+      sent.emplace_back(command, context.m_connection_id);
+      return true;
+    }
+    size_t count(int command, const boost::uuids::uuid& conn) const
+    {
+      return std::count(sent.begin(), sent.end(), std::make_pair(command, conn));
+    }
+  };
+
+  cryptonote::cryptonote_connection_context make_peer(uint32_t support_flags)
+  {
+    cryptonote::cryptonote_connection_context context;
+    static_cast<epee::net_utils::connection_context_base&>(context) =
+      epee::net_utils::connection_context_base{boost::uuids::random_generator{}(), MAKE_IPV4_ADDRESS(1,2,3,4), false};
+    context.m_state = cryptonote::cryptonote_connection_context::state_normal;
+    context.m_support_flags = support_flags;
+    return context;
+  }
+
+  // Just enough of a proof for the handler to announce it; parsing the rest is up to core
+  cryptonote::NOTIFY_BTENCODED_UPTIME_PROOF::request make_proof(uint64_t timestamp)
+  {
+    oxenc::bt_dict_producer d;
+    d.append("pke", std::string(32, 'k'));
+    d.append("t", timestamp);
+    cryptonote::NOTIFY_BTENCODED_UPTIME_PROOF::request proof;
+    proof.proof = std::move(d).str();
+    return proof;
+  }
+
+  template <typename Command>
+  void deliver(cryptonote::t_cryptonote_protocol_handler<test_core>& cprotocol, typename Command::request& req, cryptonote::cryptonote_connection_context& context)
+  {
+    std::string blob, out;
+    epee::serialization::store_t_to_binary(req, blob);
+    bool handled = false;
+    cprotocol.handle_invoke_map(true, Command::ID, epee::strspan<uint8_t>(blob), out, context, handled);
+    ASSERT_TRUE(handled);
+  }
+}
+
+TEST(uptime_proof_announce, handled_proofs_dropped_before_parsing)
+{
+  test_core pr_core;
+  pr_core.accept_uptime_proofs = true;
+  cryptonote::t_cryptonote_protocol_handler<test_core> cprotocol(pr_core);
+  proof_relay_endpoint p2p;
+  cprotocol.set_p2p_endpoint(&p2p);
+
+  auto sender = make_peer(0), other = make_peer(0);
+  auto proof = make_proof(1000);
+  deliver<cryptonote::NOTIFY_BTENCODED_UPTIME_PROOF>(cprotocol, proof, sender);
+  EXPECT_EQ(pr_core.uptime_proofs_handled, 1);
+
+  // Further copies of an accepted proof, from anyone, don't get as far as core
+  deliver<cryptonote::NOTIFY_BTENCODED_UPTIME_PROOF>(cprotocol, proof, sender);
+  deliver<cryptonote::NOTIFY_BTENCODED_UPTIME_PROOF>(cprotocol, proof, other);
+  EXPECT_EQ(pr_core.uptime_proofs_handled, 1);
+
+  // A different proof does
+  auto newer = make_proof(1001);
+  deliver<cryptonote::NOTIFY_BTENCODED_UPTIME_PROOF>(cprotocol, newer, other);
+  EXPECT_EQ(pr_core.uptime_proofs_handled, 2);
+}
+
+TEST(uptime_proof_announce, rejected_proofs_not_dropped)
+{
+  test_core pr_core;
+  cryptonote::t_cryptonote_protocol_handler<test_core> cprotocol(pr_core);
+  proof_relay_endpoint p2p;
+  cprotocol.set_p2p_endpoint(&p2p);
+
+  auto sender = make_peer(0);
+  auto proof = make_proof(1000);
+  deliver<cryptonote::NOTIFY_BTENCODED_UPTIME_PROOF>(cprotocol, proof, sender);
+  deliver<cryptonote::NOTIFY_BTENCODED_UPTIME_PROOF>(cprotocol, proof, sender);
+  EXPECT_EQ(pr_core.uptime_proofs_handled, 2);
+  EXPECT_TRUE(p2p.sent.empty());
+}
+
+TEST(uptime_proof_announce, serves_only_announced_proofs)
+{
+  test_core pr_core;
+  pr_core.accept_uptime_proofs = true;
+  cryptonote::t_cryptonote_protocol_handler<test_core> cprotocol(pr_core);
+  proof_relay_endpoint p2p;
+  cprotocol.set_p2p_endpoint(&p2p);
+
+  auto announcee = make_peer(cryptonote::p2p::SUPPORT_FLAG_PROOF_ANNOUNCE), full = make_peer(0);
+  p2p.connections = {announcee, full};
+  auto sender = make_peer(0), stranger = make_peer(cryptonote::p2p::SUPPORT_FLAG_PROOF_ANNOUNCE);
+
+  auto proof = make_proof(1000);
+  deliver<cryptonote::NOTIFY_BTENCODED_UPTIME_PROOF>(cprotocol, proof, sender);
+  EXPECT_EQ(p2p.count(cryptonote::NOTIFY_UPTIME_PROOF_ANNOUNCE::ID, announcee.m_connection_id), 1);
+  EXPECT_EQ(p2p.count(cryptonote::NOTIFY_BTENCODED_UPTIME_PROOF::ID, full.m_connection_id), 1);
+  EXPECT_EQ(p2p.sent.size(), 2);
+
+  cryptonote::NOTIFY_REQUEST_UPTIME_PROOFS::request req;
+  req.hashes.push_back(crypto::keccak(proof.proof));
+
+  // Peers we didn't announce it to don't get it...
+  deliver<cryptonote::NOTIFY_REQUEST_UPTIME_PROOFS>(cprotocol, req, stranger);
+  deliver<cryptonote::NOTIFY_REQUEST_UPTIME_PROOFS>(cprotocol, req, full);
+  EXPECT_EQ(p2p.sent.size(), 2);
+
+  // ...and the one we did gets it once
+  deliver<cryptonote::NOTIFY_REQUEST_UPTIME_PROOFS>(cprotocol, req, announcee);
+  EXPECT_EQ(p2p.count(cryptonote::NOTIFY_BTENCODED_UPTIME_PROOF::ID, announcee.m_connection_id), 1);
+  deliver<cryptonote::NOTIFY_REQUEST_UPTIME_PROOFS>(cprotocol, req, announcee);
+  EXPECT_EQ(p2p.count(cryptonote::NOTIFY_BTENCODED_UPTIME_PROOF::ID, announcee.m_connection_id), 1);
+  EXPECT_EQ(p2p.sent.size(), 3);
+}
+
 namespace nodetool { template class node_server<cryptonote::t_cryptonote_protocol_handler<test_core>>; }
 namespace cryptonote { template class t_cryptonote_protocol_handler<test_core>; }
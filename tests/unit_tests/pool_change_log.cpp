@@ -0,0 +1,107 @@
+#include "cryptonote_core/pool_change_log.h"
+
+#include "gtest/gtest.h"
+
+using cryptonote::pool_change;
+using cryptonote::pool_change_log;
+
+namespace {
+
+constexpr uint64_t START = 1'000'000;
+
+crypto::hash make_hash(unsigned char i) {
+    crypto::hash h{};
+    h.data()[0] = i;
+    return h;
+}
+
+}  // namespace
+
+TEST(pool_change_log, collapses_changes_per_tx) {
+    std::atomic<uint64_t> cookie{START};
+    pool_change_log log{cookie, 100};
+    const auto a = make_hash(1), b = make_hash(2), c = make_hash(3), d = make_hash(4);
+
+    log.record(a, pool_change::type::added, true);
+    log.record(b, pool_change::type::added, false);
+    log.record(b, pool_change::type::removed, false);
+    log.record(c, pool_change::type::removed, false);
+    log.record(c, pool_change::type::added, false);
+    log.record(a, pool_change::type::relayable, false);
+    log.record(d, pool_change::type::added, false);
+    EXPECT_EQ(cookie, START + 7);
+
+    auto changes = log.changes_since(START, false);
+    ASSERT_TRUE(changes);
+    EXPECT_EQ(changes->cookie, START + 7);
+    // Each tx shows up once, in the order of its last change
+    EXPECT_EQ(changes->added, (std::vector{c, a, d}));
+    EXPECT_EQ(changes->removed, (std::vector{b}));
+
+    // Starting part way through only sees the later changes
+    changes = log.changes_since(START + 4, false);
+    ASSERT_TRUE(changes);
+    EXPECT_EQ(changes->added, (std::vector{c, a, d}));
+    EXPECT_TRUE(changes->removed.empty());
+
+    changes = log.changes_since(START + 6, false);
+    ASSERT_TRUE(changes);
+    EXPECT_EQ(changes->added, (std::vector{d}));
+    EXPECT_TRUE(changes->removed.empty());
+}
+
+TEST(pool_change_log, do_not_relay_removals) {
+    std::atomic<uint64_t> cookie{START};
+    pool_change_log log{cookie, 100};
+    const auto a = make_hash(1), b = make_hash(2);
+
+    log.record(a, pool_change::type::added, true);
+    log.record(a, pool_change::type::removed, true);
+    log.record(b, pool_change::type::added, true);
+
+    auto changes = log.changes_since(START, false);
+    ASSERT_TRUE(changes);
+    EXPECT_TRUE(changes->removed.empty());
+    // Additions aren't filtered: the pool checks whether they are still do_not_relay
+    EXPECT_EQ(changes->added, (std::vector{b}));
+
+    changes = log.changes_since(START, true);
+    ASSERT_TRUE(changes);
+    EXPECT_EQ(changes->removed, (std::vector{a}));
+    EXPECT_EQ(changes->added, (std::vector{b}));
+}
+
+TEST(pool_change_log, falls_back_once_log_is_exceeded) {
+    std::atomic<uint64_t> cookie{START};
+    pool_change_log log{cookie, 3};
+
+    for (unsigned char i = 1; i <= 3; i++)
+        log.record(make_hash(i), pool_change::type::added, false);
+    EXPECT_TRUE(log.changes_since(START, false));
+
+    log.record(make_hash(4), pool_change::type::added, false);
+    EXPECT_FALSE(log.changes_since(START, false));
+
+    auto changes = log.changes_since(START + 1, false);
+    ASSERT_TRUE(changes);
+    EXPECT_EQ(changes->added, (std::vector{make_hash(2), make_hash(3), make_hash(4)}));
+}
+
+TEST(pool_change_log, stale_and_future_cookies) {
+    std::atomic<uint64_t> cookie{START};
+    pool_change_log log{cookie, 100};
+    log.record(make_hash(1), pool_change::type::added, false);
+
+    // From before the log started (e.g. before a restart), or not yet issued
+    EXPECT_FALSE(log.changes_since(START - 1, false));
+    EXPECT_FALSE(log.changes_since(0, false));
+    EXPECT_FALSE(log.changes_since(START + 2, false));
+
+    // Cookie bumps that aren't logged still leave the log usable
+    ++cookie;
+    auto changes = log.changes_since(START + 2, false);
+    ASSERT_TRUE(changes);
+    EXPECT_EQ(changes->cookie, START + 2);
+    EXPECT_TRUE(changes->added.empty());
+    EXPECT_TRUE(changes->removed.empty());
+}
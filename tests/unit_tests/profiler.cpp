@@ -0,0 +1,76 @@
+#include "common/profiler.h"
+
+#include <nlohmann/json.hpp>
+#include <thread>
+
+#include "gtest/gtest.h"
+
+using namespace std::literals;
+
+namespace {
+
+void inner() {
+    OXEN_PROFILE_SCOPE("test.inner");
+    std::this_thread::sleep_for(2ms);
+}
+
+void outer() {
+    OXEN_PROFILE_SCOPE("test.outer");
+    inner();
+    inner();
+    std::this_thread::sleep_for(1ms);
+}
+
+std::vector<tools::profiler::sample> test_samples(std::chrono::nanoseconds window) {
+    auto samples = tools::profiler::collect(window);
+    std::erase_if(samples, [](const auto& s) {
+        return !tools::profiler::stack_path(s.stack).starts_with("test.");
+    });
+    return samples;
+}
+
+}  // namespace
+
+TEST(profiler, disabled) {
+    tools::profiler::enable(false);
+    outer();
+    EXPECT_TRUE(test_samples(1min).empty());
+}
+
+TEST(profiler, nested_scopes) {
+    tools::profiler::enable();
+    const auto started = std::chrono::steady_clock::now();
+    outer();
+    std::thread{outer}.join();  // Dropped, along with the thread's buffer, when it exits
+    tools::profiler::enable(false);
+    outer();
+
+    auto samples = test_samples(std::chrono::steady_clock::now() - started);
+    // Sorted by start time, so the outer scope comes first
+    ASSERT_EQ(samples.size(), 3);
+    EXPECT_EQ(tools::profiler::stack_path(samples[0].stack), "test.outer");
+    EXPECT_EQ(tools::profiler::stack_name(samples[0].stack), "test.outer");
+    EXPECT_GE(samples[0].duration, 5ms);
+    EXPECT_EQ(tools::profiler::stack_path(samples[1].stack), "test.outer;test.inner");
+    EXPECT_EQ(tools::profiler::stack_name(samples[1].stack), "test.inner");
+    EXPECT_EQ(samples[1].stack, samples[2].stack);
+    EXPECT_LE(samples[1].start + samples[1].duration, samples[2].start);
+
+    auto folded = tools::profiler::to_folded(samples);
+    EXPECT_NE(folded.find("test.outer;test.inner "), std::string::npos);
+    EXPECT_NE(folded.find("test.outer "), std::string::npos);
+
+    auto trace = nlohmann::json::parse(tools::profiler::to_chrome_trace(samples));
+    ASSERT_EQ(trace["traceEvents"].size(), 3);
+    EXPECT_EQ(trace["traceEvents"][0]["name"], "test.outer");
+    EXPECT_EQ(trace["traceEvents"][0]["ph"], "X");
+    EXPECT_GE(trace["traceEvents"][0]["dur"].get<int64_t>(), 5000);
+}
+
+TEST(profiler, intern) {
+    std::string name = "test.interned";
+    auto a = tools::profiler::intern(name);
+    name[0] = 'T';
+    EXPECT_EQ(a, "test.interned");
+    EXPECT_EQ(tools::profiler::intern("test.interned"sv).data(), a.data());
+}
@@ -0,0 +1,161 @@
+#include "rpc/rpc_admission.h"
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+using namespace cryptonote::rpc;
+
+namespace {
+
+// Collects started requests instead of running them, so that tests control when they run
+struct test_starter {
+    struct started {
+        rpc_category cat;
+        std::string client;
+        std::function<void()> start;
+    };
+    std::vector<started> jobs;
+
+    explicit test_starter(rpc_admission& a) {
+        a.set_starter([this](rpc_category cat, const std::string& client, auto start) {
+            jobs.push_back({cat, client, std::move(start)});
+        });
+    }
+};
+
+// A job that holds onto its slot (so that it stays "running") until `held` is cleared
+rpc_admission::job holding(std::vector<std::shared_ptr<rpc_admission::slot>>& held, int id,
+        std::vector<int>& ran) {
+    return [&held, &ran, id](std::shared_ptr<rpc_admission::slot> s) {
+        ran.push_back(id);
+        held.push_back(std::move(s));
+    };
+}
+
+constexpr auto started = rpc_admission::admit_result::started;
+constexpr auto queued = rpc_admission::admit_result::queued;
+constexpr auto rejected = rpc_admission::admit_result::rejected;
+
+const auto heavy = rpc_category::heavy;
+const auto normal = rpc_category::normal;
+
+}  // namespace
+
+TEST(rpc_admission, concurrency_limit) {
+    rpc_admission::limits l;
+    l.concurrency[static_cast<size_t>(heavy)] = 2;
+    l.per_client = 0;
+    rpc_admission a{l};
+    test_starter st{a};
+    std::vector<std::shared_ptr<rpc_admission::slot>> held;
+    std::vector<int> ran;
+
+    EXPECT_EQ(a.admit(heavy, "a", false, holding(held, 1, ran), true), started);
+    EXPECT_EQ(a.admit(heavy, "b", false, holding(held, 2, ran), true), started);
+    EXPECT_EQ(a.admit(heavy, "c", false, holding(held, 3, ran), true), queued);
+    EXPECT_EQ(a.admit(normal, "d", false, holding(held, 4, ran), true), started);
+    EXPECT_EQ(ran, (std::vector<int>{1, 2, 4}));
+    EXPECT_TRUE(st.jobs.empty());
+
+    auto stats = a.stats()[static_cast<size_t>(heavy)];
+    EXPECT_EQ(stats.running, 2);
+    EXPECT_EQ(stats.queued, 1);
+    EXPECT_EQ(stats.waited, 1);
+
+    // Finishing one of the heavy requests hands the waiting one to the starter
+    held.erase(held.begin());
+    ASSERT_EQ(st.jobs.size(), 1);
+    EXPECT_EQ(st.jobs[0].cat, heavy);
+    EXPECT_EQ(st.jobs[0].client, "c");
+    st.jobs[0].start();
+    EXPECT_EQ(ran, (std::vector<int>{1, 2, 4, 3}));
+
+    held.clear();
+    stats = a.stats()[static_cast<size_t>(heavy)];
+    EXPECT_EQ(stats.started, 3);
+    EXPECT_EQ(stats.running, 0);
+    EXPECT_EQ(stats.queued, 0);
+}
+
+TEST(rpc_admission, per_client_limit) {
+    rpc_admission::limits l;
+    l.per_client = 2;
+    rpc_admission a{l};
+    test_starter st{a};
+    std::vector<std::shared_ptr<rpc_admission::slot>> held;
+    std::vector<int> ran;
+
+    EXPECT_EQ(a.admit(normal, "a", false, holding(held, 1, ran), true), started);
+    EXPECT_EQ(a.admit(heavy, "a", false, holding(held, 2, ran), true), started);
+    EXPECT_EQ(a.admit(normal, "a", false, holding(held, 3, ran), true), queued);
+    EXPECT_EQ(a.admit(normal, "b", false, holding(held, 4, ran), true), started);
+    // Admins aren't subject to the per-client limit, nor are requests without a client
+    EXPECT_EQ(a.admit(normal, "a", true, holding(held, 5, ran), true), started);
+    EXPECT_EQ(a.admit(normal, "", false, holding(held, 6, ran), true), started);
+    EXPECT_EQ(a.admit(normal, "", false, holding(held, 7, ran), true), started);
+    EXPECT_EQ(a.admit(normal, "", false, holding(held, 8, ran), true), started);
+    EXPECT_EQ(ran, (std::vector<int>{1, 2, 4, 5, 6, 7, 8}));
+
+    // Finishing client a's heavy request makes room for its waiting normal request
+    held.erase(held.begin() + 1);
+    ASSERT_EQ(st.jobs.size(), 1);
+    EXPECT_EQ(st.jobs[0].cat, normal);
+    st.jobs[0].start();
+    EXPECT_EQ(ran, (std::vector<int>{1, 2, 4, 5, 6, 7, 8, 3}));
+}
+
+TEST(rpc_admission, client_keys) {
+    // Remote clients count by address, whatever they claim to be forwarding for
+    EXPECT_EQ(admission_client("1.2.3.4", "", "conn1"), "1.2.3.4");
+    EXPECT_EQ(admission_client("1.2.3.4", "5.6.7.8", "conn1"), "1.2.3.4");
+    EXPECT_EQ(admission_client("2001:db8::1", "5.6.7.8", ""), "2001:db8::1");
+
+    // Local clients count by connection...
+    EXPECT_EQ(admission_client("127.0.0.1", "", "conn1"), "conn1");
+    EXPECT_EQ(admission_client("::1", "", "conn2"), "conn2");
+    EXPECT_EQ(admission_client("", "", "conn3"), "conn3");
+    EXPECT_EQ(admission_client("127.0.0.1", "", ""), "");
+
+    // ...unless forwarded by a proxy, in which case by the address the proxy got it from
+    EXPECT_EQ(admission_client("127.0.0.1", "5.6.7.8", ""), "5.6.7.8");
+    EXPECT_EQ(admission_client("::1", "10.0.0.1, 5.6.7.8 ", "conn1"), "5.6.7.8");
+    EXPECT_EQ(admission_client("127.0.0.1", " , ", "conn1"), "conn1");
+}
+
+TEST(rpc_admission, queue_full) {
+    rpc_admission::limits l;
+    l.concurrency[static_cast<size_t>(heavy)] = 1;
+    l.max_queued[static_cast<size_t>(heavy)] = 1;
+    rpc_admission a{l};
+    test_starter st{a};
+    std::vector<std::shared_ptr<rpc_admission::slot>> held;
+    std::vector<int> ran;
+
+    EXPECT_EQ(a.admit(heavy, "a", false, holding(held, 1, ran), true), started);
+    EXPECT_EQ(a.admit(heavy, "b", false, holding(held, 2, ran), true), queued);
+    EXPECT_EQ(a.admit(heavy, "c", false, holding(held, 3, ran), true), rejected);
+    EXPECT_EQ(a.stats()[static_cast<size_t>(heavy)].rejected, 1);
+
+    held.clear();
+    ASSERT_EQ(st.jobs.size(), 1);
+    st.jobs[0].start();
+    EXPECT_EQ(ran, (std::vector<int>{1, 2}));
+}
+
+TEST(rpc_admission, off_worker_start) {
+    rpc_admission a;
+    test_starter st{a};
+    std::vector<std::shared_ptr<rpc_admission::slot>> held;
+    std::vector<int> ran;
+
+    // When not already on a worker, even requests that can start right away go via the starter
+    EXPECT_EQ(a.admit(normal, "a", false, holding(held, 1, ran), false), started);
+    EXPECT_TRUE(ran.empty());
+    ASSERT_EQ(st.jobs.size(), 1);
+    EXPECT_EQ(a.stats()[static_cast<size_t>(normal)].running, 1);
+    st.jobs[0].start();
+    EXPECT_EQ(ran, std::vector<int>{1});
+    held.clear();
+    EXPECT_EQ(a.stats()[static_cast<size_t>(normal)].running, 0);
+}
@@ -32,8 +32,10 @@
 #include "cryptonote_core/service_node_swarm.h"
 #include "cryptonote_basic/cryptonote_basic.h"
 
+#include <algorithm>
 #include <functional>
 #include <iterator>
+#include <map>
 #include <random>
 
 #undef OXEN_DEFAULT_LOG_CATEGORY
@@ -626,3 +628,130 @@ TEST(swarm_to_snodes, deterministic_swarm_ids)
   EXPECT_EQ(ids[5046], 18442592317803069438ULL);
   EXPECT_EQ(ids[5047], 18445442251942264830ULL);
 }
+
+namespace {
+  struct test_snode {
+    bool active;
+    swarm_id_t swarm_id;
+  };
+
+  // How service_node_list used to gather the swarms before every swarm update: every active node,
+  // in pubkey order, grouped by swarm.
+  swarm_snode_map_t regroup_swarms(const std::map<crypto::public_key, test_snode>& snodes) {
+    swarm_snode_map_t swarms;
+    for (const auto& [pubkey, snode] : snodes)
+      if (snode.active)
+        swarms[snode.swarm_id].push_back(pubkey);
+    return swarms;
+  }
+}
+
+TEST(swarm_index, matches_regrouping)
+{
+  // Runs random registrations, removals, and decommissions/recommissions through both a
+  // swarm_index and the old regroup-everything approach, including a registration surge, and
+  // checks that they give calc_swarm_changes the same input and apply the same changes.
+  std::mt19937_64 rng{1234};
+  std::map<crypto::public_key, test_snode> snodes;
+  swarm_index index;
+  auto random_snode = [&] {
+    auto it = snodes.begin();
+    std::advance(it, rng() % snodes.size());
+    return it;
+  };
+
+  for (uint64_t block = 0; block < 300; block++)
+  {
+    const int changes = block >= 100 && block < 120 ? 50 : 5;
+    for (int i = 0; i < changes; i++)
+    {
+      const auto op = rng() % 10;
+      if (op < 5 || snodes.empty())
+      {
+        // Registration; most are fully funded (and thus active) right away
+        const auto pubkey = newPubKey();
+        const test_snode snode{rng() % 4 != 0, UNASSIGNED_SWARM_ID};
+        snodes[pubkey] = snode;
+        if (snode.active)
+          index.add(pubkey, snode.swarm_id);
+      }
+      else if (op < 7)
+      {
+        // Deregistration or expiry
+        auto it = random_snode();
+        if (it->second.active)
+          index.remove(it->first, it->second.swarm_id);
+        snodes.erase(it);
+      }
+      else
+      {
+        // Decommission, or recommission/funding
+        auto it = random_snode();
+        auto& snode = it->second;
+        if (snode.active)
+        {
+          index.remove(it->first, snode.swarm_id);
+          snode.active = false;
+          snode.swarm_id = UNASSIGNED_SWARM_ID;
+        }
+        else
+        {
+          snode.active = true;
+          index.add(it->first, snode.swarm_id);
+        }
+      }
+    }
+
+    auto swarms = regroup_swarms(snodes);
+    ASSERT_EQ(swarms, index.swarms());
+    calc_swarm_changes(swarms, block);
+
+    std::vector<std::pair<crypto::public_key, swarm_id_t>> expected_moved;
+    for (const auto& [swarm_id, pubkeys] : swarms)
+      for (const auto& pubkey : pubkeys)
+        if (auto& snode = snodes.at(pubkey); snode.swarm_id != swarm_id)
+        {
+          expected_moved.emplace_back(pubkey, swarm_id);
+          snode.swarm_id = swarm_id;
+        }
+
+    auto moved = index.assign(swarms);
+    std::sort(expected_moved.begin(), expected_moved.end());
+    std::sort(moved.begin(), moved.end());
+    ASSERT_EQ(expected_moved, moved);
+    ASSERT_EQ(regroup_swarms(snodes), index.swarms());
+  }
+
+  size_t active = 0;
+  for (const auto& [pubkey, snode] : snodes)
+    active += snode.active;
+  EXPECT_EQ(active, index.size());
+  EXPECT_GT(index.swarms().size(), 10);
+}
+
+TEST(swarm_index, copies_are_independent)
+{
+  swarm_index a;
+  const auto pk1 = newPubKey(), pk2 = newPubKey(), pk3 = newPubKey();
+  a.add(pk1, 1);
+  a.add(pk2, 1);
+
+  swarm_index b = a;
+  b.add(pk3, 1);
+  b.remove(pk1, 1);
+  b.add(pk1, 2);
+
+  auto expected_a = swarm_snode_map_t{{1, {pk1, pk2}}};
+  std::sort(expected_a[1].begin(), expected_a[1].end());
+  EXPECT_EQ(a.swarms(), expected_a);
+  EXPECT_EQ(a.size(), 2);
+
+  auto expected_b = swarm_snode_map_t{{1, {pk2, pk3}}, {2, {pk1}}};
+  std::sort(expected_b[1].begin(), expected_b[1].end());
+  EXPECT_EQ(b.swarms(), expected_b);
+  EXPECT_EQ(b.size(), 3);
+
+  // Removing something that isn't there does nothing
+  b.remove(pk1, 1);
+  EXPECT_EQ(b.size(), 3);
+}
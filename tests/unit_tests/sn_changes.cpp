@@ -0,0 +1,87 @@
+#include "rpc/sn_changes.h"
+
+#include <algorithm>
+
+#include "gtest/gtest.h"
+
+using namespace cryptonote::rpc;
+using service_nodes::service_node_info;
+
+namespace {
+
+crypto::public_key make_pubkey(unsigned char i) {
+    crypto::public_key pk{};
+    pk.data()[0] = i;
+    return pk;
+}
+
+sn_change_tracker::node make_node(
+        unsigned char i, std::shared_ptr<const service_node_info> info, uint64_t proof = 0) {
+    return {service_nodes::pubkey_and_sninfo{make_pubkey(i), std::move(info)}, proof};
+}
+
+std::vector<crypto::public_key> pubkeys(
+        const std::vector<service_nodes::service_node_pubkey_info>& infos) {
+    std::vector<crypto::public_key> pks;
+    for (const auto& i : infos)
+        pks.push_back(i.pubkey);
+    std::sort(pks.begin(), pks.end());
+    return pks;
+}
+
+}  // namespace
+
+TEST(sn_changes, first_update_only_records) {
+    sn_change_tracker tracker;
+    auto info = std::make_shared<service_node_info>();
+    auto changes = tracker.update(10, crypto::hash{}, {make_node(1, info), make_node(2, info)});
+    EXPECT_TRUE(changes.empty());
+    EXPECT_EQ(changes.height, 10);
+}
+
+TEST(sn_changes, reset_reprimes) {
+    sn_change_tracker tracker;
+    auto info = std::make_shared<service_node_info>();
+    tracker.update(10, crypto::hash{}, {make_node(1, info)});
+    EXPECT_TRUE(tracker.primed());
+
+    tracker.reset();
+    EXPECT_FALSE(tracker.primed());
+    auto changes = tracker.update(11, crypto::hash{}, {make_node(2, info)});
+    EXPECT_TRUE(changes.empty());
+    EXPECT_TRUE(tracker.primed());
+
+    changes = tracker.update(12, crypto::hash{}, {make_node(2, info), make_node(3, info)});
+    EXPECT_EQ(pubkeys(changes.added), std::vector{make_pubkey(3)});
+    EXPECT_TRUE(changes.removed.empty());
+}
+
+TEST(sn_changes, diff) {
+    sn_change_tracker tracker;
+    auto a = std::make_shared<service_node_info>();
+    auto b = std::make_shared<service_node_info>();
+    auto c = std::make_shared<service_node_info>();
+    tracker.update(
+            10, crypto::hash{}, {make_node(1, a, 100), make_node(2, b, 100), make_node(3, c)});
+
+    // Nothing changed
+    auto changes = tracker.update(
+            11, crypto::hash{}, {make_node(1, a, 100), make_node(2, b, 100), make_node(3, c)});
+    EXPECT_TRUE(changes.empty());
+
+    // 1 gets a new state, 2 a new proof, 3 goes away, and 4 appears
+    auto a2 = std::make_shared<service_node_info>();
+    auto d = std::make_shared<service_node_info>();
+    changes = tracker.update(
+            12, crypto::hash{}, {make_node(1, a2, 150), make_node(2, b, 160), make_node(4, d)});
+    EXPECT_EQ(changes.height, 12);
+    EXPECT_EQ(pubkeys(changes.changed), std::vector{make_pubkey(1)});
+    EXPECT_EQ(pubkeys(changes.proof_updated), std::vector{make_pubkey(2)});
+    EXPECT_EQ(changes.removed, std::vector{make_pubkey(3)});
+    EXPECT_EQ(pubkeys(changes.added), std::vector{make_pubkey(4)});
+
+    // Changes are relative to the previous update, not the first one
+    changes = tracker.update(
+            13, crypto::hash{}, {make_node(1, a2, 150), make_node(2, b, 160), make_node(4, d)});
+    EXPECT_TRUE(changes.empty());
+}
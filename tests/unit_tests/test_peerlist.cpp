@@ -71,6 +71,47 @@ TEST(peer_list, peer_list_general)
   ASSERT_EQ(plm.get_white_peers_count(), 4);
 }
 
+TEST(peer_list, peers_by_index)
+{
+  nodetool::peerlist_manager plm;
+  plm.init(nodetool::peerlist_types{}, false);
+
+  // Inserted in shuffled last_seen order; lookups by index must come back most recently seen first
+  const uint64_t seen[] = {500, 100, 900, 300, 700, 200, 800, 400, 600};
+  for (size_t i = 0; i < sizeof(seen) / sizeof(seen[0]); ++i)
+  {
+    ADD_WHITE_NODE(MAKE_IPV4_ADDRESS(10,0,0,i + 1, 8080), i + 1, seen[i]);
+    ADD_GRAY_NODE(MAKE_IPV4_ADDRESS(10,0,1,i + 1, 8080), i + 100, seen[i]);
+  }
+  ASSERT_EQ(plm.get_white_peers_count(), 9);
+  ASSERT_EQ(plm.get_gray_peers_count(), 9);
+
+  nodetool::peerlist_entry pe;
+  for (size_t i = 0; i < 9; ++i)
+  {
+    ASSERT_TRUE(plm.get_white_peer_by_index(pe, i));
+    ASSERT_EQ(pe.last_seen, 900 - 100 * i);
+    ASSERT_TRUE(plm.get_gray_peer_by_index(pe, i));
+    ASSERT_EQ(pe.last_seen, 900 - 100 * i);
+  }
+  ASSERT_FALSE(plm.get_white_peer_by_index(pe, 9));
+  ASSERT_FALSE(plm.get_gray_peer_by_index(pe, 9));
+
+  for (size_t i = 0; i < 20; ++i)
+  {
+    ASSERT_TRUE(plm.get_random_gray_peer(pe));
+    ASSERT_GE(pe.id, 100);
+    ASSERT_LT(pe.id, 109);
+  }
+
+  // Seeing a gray peer moves it to the white list, at the front
+  ASSERT_TRUE(plm.set_peer_just_seen(104, MAKE_IPV4_ADDRESS(10,0,1,5, 8080), 0));
+  ASSERT_EQ(plm.get_white_peers_count(), 10);
+  ASSERT_EQ(plm.get_gray_peers_count(), 8);
+  ASSERT_TRUE(plm.get_white_peer_by_index(pe, 0));
+  ASSERT_EQ(pe.id, 104);
+}
+
 
 TEST(peer_list, merge_peer_lists)
 {
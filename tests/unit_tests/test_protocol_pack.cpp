@@ -53,3 +53,154 @@ TEST(protocol_pack, protocol_pack_command)
     ASSERT_TRUE(r.total_height == 3);
   }
 }
+
+namespace {
+
+template <typename T>
+std::string store_dom(const T& t)
+{
+  epee::serialization::portable_storage ps;
+  std::string blob;
+  EXPECT_TRUE(t.store(ps));
+  EXPECT_TRUE(ps.store_to_binary(blob));
+  return blob;
+}
+
+template <typename T>
+bool load_dom(T& t, std::string_view blob)
+{
+  epee::serialization::portable_storage ps;
+  return ps.load_from_binary(blob) && t.load(ps);
+}
+
+cryptonote::NOTIFY_RESPONSE_GET_BLOCKS::request make_blocks_response(size_t blocks)
+{
+  cryptonote::NOTIFY_RESPONSE_GET_BLOCKS::request r;
+  for (size_t i = 0; i < blocks; i++)
+  {
+    auto& b = r.blocks.emplace_back();
+    b.block = std::string(100 + i, 'b');
+    for (size_t j = 0; j < i % 5; j++)
+      b.txs.push_back(std::string(j * 100, 't'));
+    if (i % 2)
+      b.checkpoint = "checkpoint";
+    if (i % 3 == 0)
+    {
+      auto& blink = b.blinks.emplace_back();
+      blink.tx_hash = crypto::rand<crypto::hash>();
+      blink.height = i;
+      blink.quorum = {0, 1};
+      blink.position = {3, 4};
+      blink.signature.resize(2);
+    }
+  }
+  r.missed_ids = {crypto::rand<crypto::hash>()};
+  r.current_blockchain_height = 123456;
+  return r;
+}
+
+void expect_equal(const cryptonote::NOTIFY_RESPONSE_GET_BLOCKS::request& a,
+                  const cryptonote::NOTIFY_RESPONSE_GET_BLOCKS::request& b)
+{
+  ASSERT_EQ(a.blocks.size(), b.blocks.size());
+  for (size_t i = 0; i < a.blocks.size(); i++)
+  {
+    EXPECT_EQ(a.blocks[i].block, b.blocks[i].block);
+    EXPECT_EQ(a.blocks[i].txs, b.blocks[i].txs);
+    EXPECT_EQ(a.blocks[i].checkpoint, b.blocks[i].checkpoint);
+    ASSERT_EQ(a.blocks[i].blinks.size(), b.blocks[i].blinks.size());
+    for (size_t j = 0; j < a.blocks[i].blinks.size(); j++)
+    {
+      EXPECT_EQ(a.blocks[i].blinks[j].tx_hash, b.blocks[i].blinks[j].tx_hash);
+      EXPECT_EQ(a.blocks[i].blinks[j].height, b.blocks[i].blinks[j].height);
+      EXPECT_EQ(a.blocks[i].blinks[j].quorum, b.blocks[i].blinks[j].quorum);
+      EXPECT_EQ(a.blocks[i].blinks[j].position, b.blocks[i].blinks[j].position);
+      EXPECT_EQ(a.blocks[i].blinks[j].signature.size(), b.blocks[i].blinks[j].signature.size());
+    }
+  }
+  EXPECT_EQ(a.missed_ids, b.missed_ids);
+  EXPECT_EQ(a.current_blockchain_height, b.current_blockchain_height);
+}
+
+}
+
+// The direct binary (de)serialization must stay wire compatible with portable_storage in both
+// directions.
+TEST(protocol_pack, direct_binary_compatible)
+{
+  for (size_t blocks : {0, 1, 10, 100})
+  {
+    auto r = make_blocks_response(blocks);
+    std::string direct, dom = store_dom(r);
+    ASSERT_TRUE(epee::serialization::store_t_to_binary(r, direct));
+    // Entries are written in a different order, but everything else is the same
+    EXPECT_EQ(direct.size(), dom.size());
+
+    cryptonote::NOTIFY_RESPONSE_GET_BLOCKS::request from_direct, from_dom;
+    ASSERT_TRUE(load_dom(from_direct, direct));
+    expect_equal(r, from_direct);
+    ASSERT_TRUE(epee::serialization::load_t_from_binary(from_dom, dom));
+    expect_equal(r, from_dom);
+
+    // Round-tripping the direct output through a portable_storage gives the DOM's output
+    epee::serialization::portable_storage ps;
+    ASSERT_TRUE(ps.load_from_binary(direct));
+    std::string restored;
+    ASSERT_TRUE(ps.store_to_binary(restored));
+    EXPECT_EQ(restored, dom);
+  }
+}
+
+TEST(protocol_pack, direct_binary_optional_fields)
+{
+  cryptonote::CORE_SYNC_DATA sync{};
+  sync.current_height = 5;
+  sync.top_version = cryptonote::hf::hf19_reward_batching;
+  sync.blink_blocks = {1, 2};
+  sync.blink_hash = {crypto::rand<crypto::hash>(), crypto::rand<crypto::hash>()};
+  std::string direct;
+  ASSERT_TRUE(epee::serialization::store_t_to_binary(sync, direct));
+  EXPECT_EQ(direct.size(), store_dom(sync).size()); // Default pruning_seed/support_flags omitted
+
+  cryptonote::CORE_SYNC_DATA loaded{};
+  loaded.pruning_seed = 42;
+  ASSERT_TRUE(load_dom(loaded, direct));
+  EXPECT_EQ(loaded.current_height, 5u);
+  EXPECT_EQ(loaded.top_version, cryptonote::hf::hf19_reward_batching);
+  EXPECT_EQ(loaded.pruning_seed, 0u);
+  EXPECT_EQ(loaded.blink_blocks, sync.blink_blocks);
+  EXPECT_EQ(loaded.blink_hash, sync.blink_hash);
+
+  cryptonote::NOTIFY_BTENCODED_UPTIME_PROOF::request proof, proof2;
+  proof.proof = "proof";
+  proof.ed_sig = "sig";
+  ASSERT_TRUE(epee::serialization::store_t_to_binary(proof, direct));
+  ASSERT_TRUE(epee::serialization::load_t_from_binary(proof2, direct));
+  EXPECT_EQ(proof2.proof, "proof");
+  EXPECT_FALSE(proof2.sig);
+  proof.sig = "legacy";
+  ASSERT_TRUE(epee::serialization::load_t_from_binary(proof2, store_dom(proof)));
+  EXPECT_EQ(proof2.sig, "legacy");
+}
+
+TEST(protocol_pack, direct_binary_rejects_bad_input)
+{
+  auto blob = store_dom(make_blocks_response(3));
+  cryptonote::NOTIFY_RESPONSE_GET_BLOCKS::request r;
+  // Truncated anywhere: the direct reader agrees with portable_storage on what loads
+  for (size_t len = 0; len < blob.size(); len++)
+  {
+    std::string_view truncated{blob.data(), len};
+    cryptonote::NOTIFY_RESPONSE_GET_BLOCKS::request a, b;
+    EXPECT_EQ(load_dom(a, truncated), epee::serialization::load_t_from_binary(b, truncated)) << len;
+  }
+  // A header with no root section
+  std::string_view header_only{"\x01\x11\x01\x01\x01\x01\x02\x01\x01", 9};
+  EXPECT_FALSE(epee::serialization::load_t_from_binary(r, header_only));
+
+  // A type mismatch fails the load, as with portable_storage
+  std::string bad = "\x01\x11\x01\x01\x01\x01\x02\x01\x01\x04\x19" "current_blockchain_height\x0a\x08hi";
+  cryptonote::NOTIFY_RESPONSE_GET_BLOCKS::request a;
+  EXPECT_FALSE(load_dom(a, bad));
+  EXPECT_FALSE(epee::serialization::load_t_from_binary(r, bad));
+}
@@ -34,6 +34,7 @@
 
 #include "common/util.h"
 #include "cryptonote_basic/cryptonote_basic.h"
+#include "cryptonote_basic/cryptonote_format_utils.h"
 #include "cryptonote_basic/tx_extra.h"
 #include "cryptonote_core/cryptonote_tx_utils.h"
 
@@ -148,6 +149,23 @@ TEST(parse_and_validate_tx_extra, is_valid_tx_extra_parsed)
   crypto::public_key tx_pub_key = cryptonote::get_tx_pub_key_from_extra(tx);
   ASSERT_NE(tx_pub_key, crypto::null<crypto::public_key>);
 }
+TEST(calculate_transaction_hash_from_blob, miner_tx)
+{
+  cryptonote::transaction tx{};
+  cryptonote::account_base acc;
+  acc.generate();
+  uint64_t block_rewards = 0;
+  bool r;
+  std::tie(r, block_rewards) = cryptonote::construct_miner_tx(0, 0, 10000000000000, 1000, TEST_FEE, tx, cryptonote::oxen_miner_tx_context::miner_block(cryptonote::network_type::FAKECHAIN, acc.get_keys().m_account_address), {}, {}, cryptonote::hf::none);
+  ASSERT_TRUE(r);
+  const std::string blob = cryptonote::tx_to_blob(tx);
+  crypto::hash hash;
+  ASSERT_TRUE(cryptonote::calculate_transaction_hash_from_blob(blob, hash));
+  ASSERT_EQ(hash, cryptonote::get_transaction_hash(tx));
+  ASSERT_FALSE(cryptonote::calculate_transaction_hash_from_blob(blob.substr(0, blob.size() / 2), hash));
+  ASSERT_FALSE(cryptonote::calculate_transaction_hash_from_blob("", hash));
+}
+
 TEST(parse_and_validate_tx_extra, fails_on_big_extra_nonce)
 {
   cryptonote::transaction tx{};
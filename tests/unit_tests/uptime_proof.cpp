@@ -0,0 +1,72 @@
+#include "cryptonote_core/uptime_proof.h"
+
+#include <oxenc/bt_producer.h>
+
+#include <cstring>
+
+#include "cryptonote_config.h"
+#include "gtest/gtest.h"
+
+using cryptonote::hf;
+
+namespace {
+
+uptime_proof::Proof make_proof() {
+    uptime_proof::Proof proof;
+    proof.version = {11, 2, 0};
+    proof.storage_server_version = {2, 8, 0};
+    proof.lokinet_version = {0, 9, 11};
+    proof.timestamp = 1'700'000'123;
+    proof.pubkey.data()[0] = 1;
+    proof.pubkey_ed25519.data()[0] = 2;
+    proof.public_ip = 0x0100007f;
+    proof.storage_https_port = 22021;
+    proof.storage_omq_port = 22020;
+    proof.qnet_port = 22025;
+    return proof;
+}
+
+}  // namespace
+
+TEST(uptime_proof, peek_with_primary_pubkey) {
+    auto proof = make_proof();
+    for (auto hardfork : {hf::hf19_reward_batching, cryptonote::feature::ETH_TRANSITION}) {
+        auto serialized = proof.bt_encode_uptime_proof(hardfork);
+        auto [pubkey, timestamp] = uptime_proof::peek_pubkey_and_timestamp(serialized);
+        EXPECT_EQ(pubkey, proof.pubkey);
+        EXPECT_EQ(timestamp, proof.timestamp);
+
+        // The same as a full parse of the proof gives
+        uptime_proof::Proof parsed{hardfork, serialized};
+        EXPECT_EQ(pubkey, parsed.pubkey);
+        EXPECT_EQ(timestamp, parsed.timestamp);
+    }
+}
+
+TEST(uptime_proof, peek_with_only_ed25519_pubkey) {
+    // When the primary and ed25519 pubkeys are the same the proof only has "pke"
+    auto proof = make_proof();
+    std::memcpy(proof.pubkey.data(), proof.pubkey_ed25519.data(), 32);
+    auto serialized = proof.bt_encode_uptime_proof(hf::hf19_reward_batching);
+    ASSERT_EQ(serialized.find("2:pk32:"), std::string::npos);
+
+    auto [pubkey, timestamp] = uptime_proof::peek_pubkey_and_timestamp(serialized);
+    EXPECT_EQ(pubkey, proof.pubkey);
+    EXPECT_EQ(timestamp, proof.timestamp);
+}
+
+TEST(uptime_proof, peek_missing_fields) {
+    const std::string pke(32, 'x');
+    {
+        oxenc::bt_dict_producer d;
+        d.append("pke", pke);
+        EXPECT_ANY_THROW(uptime_proof::peek_pubkey_and_timestamp(std::move(d).str()));
+    }
+    {
+        oxenc::bt_dict_producer d;
+        d.append("pk", pke);
+        d.append("t", 123);
+        EXPECT_ANY_THROW(uptime_proof::peek_pubkey_and_timestamp(std::move(d).str()));
+    }
+    EXPECT_ANY_THROW(uptime_proof::peek_pubkey_and_timestamp("not a proof"));
+}
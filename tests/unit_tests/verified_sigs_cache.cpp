@@ -0,0 +1,99 @@
+#include "cryptonote_core/verified_sigs_cache.h"
+
+#include "gtest/gtest.h"
+
+using cryptonote::verified_sigs_cache;
+
+namespace {
+
+crypto::hash make_hash(unsigned char i) {
+    crypto::hash h{};
+    h.data()[0] = i;
+    return h;
+}
+
+rct::ctkey make_member(unsigned char i) {
+    rct::ctkey k{};
+    k.dest[0] = i;
+    k.mask[0] = i + 100;
+    return k;
+}
+
+std::vector<std::vector<rct::ctkey>> make_rings(std::initializer_list<std::vector<int>> rings) {
+    std::vector<std::vector<rct::ctkey>> result;
+    for (const auto& ring : rings) {
+        auto& r = result.emplace_back();
+        for (int m : ring)
+            r.push_back(make_member(m));
+    }
+    return result;
+}
+
+}  // namespace
+
+TEST(verified_sigs_cache, recheck_after_block_skips_verification) {
+    verified_sigs_cache cache{10};
+    const auto txid = make_hash(1);
+    const auto rings = make_rings({{1, 2, 3}, {4, 5, 6}});
+
+    EXPECT_FALSE(cache.verified(txid, verified_sigs_cache::rings_hash(rings)));
+    cache.add(txid, verified_sigs_cache::rings_hash(rings));
+
+    // Looking the same ring members up again after a block gives the same hash
+    const auto again = make_rings({{1, 2, 3}, {4, 5, 6}});
+    EXPECT_TRUE(cache.verified(txid, verified_sigs_cache::rings_hash(again)));
+}
+
+TEST(verified_sigs_cache, changed_ring_member_forces_verification) {
+    verified_sigs_cache cache{10};
+    const auto txid = make_hash(1);
+    auto rings = make_rings({{1, 2, 3}, {4, 5, 6}});
+    cache.add(txid, verified_sigs_cache::rings_hash(rings));
+
+    // After a reorg the output at one of the ring's indices has a different key...
+    auto reorged = rings;
+    reorged[1][2].dest[0] = 42;
+    EXPECT_FALSE(cache.verified(txid, verified_sigs_cache::rings_hash(reorged)));
+
+    // ...or just a different commitment
+    reorged = rings;
+    reorged[0][0].mask[0] = 42;
+    EXPECT_FALSE(cache.verified(txid, verified_sigs_cache::rings_hash(reorged)));
+
+    // Verifying against the new members replaces the record
+    cache.add(txid, verified_sigs_cache::rings_hash(reorged));
+    EXPECT_TRUE(cache.verified(txid, verified_sigs_cache::rings_hash(reorged)));
+    EXPECT_FALSE(cache.verified(txid, verified_sigs_cache::rings_hash(rings)));
+}
+
+TEST(verified_sigs_cache, same_txid_different_rings_not_accepted) {
+    verified_sigs_cache cache{10};
+    const auto txid = make_hash(1);
+    cache.add(txid, verified_sigs_cache::rings_hash(make_rings({{1, 2, 3}, {4, 5, 6}})));
+
+    for (const auto& other : {
+                 make_rings({{1, 2, 3}, {4, 5, 7}}),
+                 make_rings({{1, 2, 3}}),
+                 make_rings({{1, 2, 3}, {4, 5, 6}, {7, 8, 9}}),
+                 make_rings({{4, 5, 6}, {1, 2, 3}}),
+                 // The same members split between the rings differently
+                 make_rings({{1, 2}, {3, 4, 5, 6}}),
+         })
+        EXPECT_FALSE(cache.verified(txid, verified_sigs_cache::rings_hash(other)));
+
+    // Nor does another tx get to use this one's record
+    EXPECT_FALSE(cache.verified(
+            make_hash(2), verified_sigs_cache::rings_hash(make_rings({{1, 2, 3}, {4, 5, 6}}))));
+}
+
+TEST(verified_sigs_cache, evicts_oldest) {
+    verified_sigs_cache cache{2};
+    const auto h = verified_sigs_cache::rings_hash(make_rings({{1, 2, 3}}));
+    cache.add(make_hash(1), h);
+    cache.add(make_hash(2), h);
+    cache.add(make_hash(1), h);  // Updating a record doesn't count as a new one
+    cache.add(make_hash(3), h);
+    EXPECT_FALSE(cache.verified(make_hash(1), h));
+    EXPECT_TRUE(cache.verified(make_hash(2), h));
+    EXPECT_TRUE(cache.verified(make_hash(3), h));
+}
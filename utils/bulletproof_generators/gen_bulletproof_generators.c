@@ -0,0 +1,110 @@
+// Generates src/ringct/bulletproofs_generators.c, the precomputed bulletproof Hi/Gi generator
+// points.  This must be rerun (and the output committed) if maxN or maxM in bulletproofs.cc
+// changes; the bulletproofs.generators unit test verifies the committed table.
+//
+// Build and run from the top-level source directory with:
+//
+//     gcc -O2 -Isrc -Icontrib/epee/include utils/bulletproof_generators/gen_bulletproof_generators.c \
+//         src/crypto/crypto-ops.c src/crypto/crypto-ops-data.c src/crypto/keccak.c \
+//         -o gen_bulletproof_generators
+//     ./gen_bulletproof_generators 1024 > src/ringct/bulletproofs_generators.c
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "crypto/crypto-ops.h"
+#include "crypto/keccak.h"
+
+// rct::H
+static const unsigned char H[32] = {
+        0x8b, 0x65, 0x59, 0x70, 0x15, 0x37, 0x99, 0xaf, 0x2a, 0xea, 0xdc, 0x9f, 0xf1, 0xad, 0xd0, 0xea,
+        0x6c, 0x72, 0x51, 0xd5, 0x41, 0x54, 0xcf, 0xa9, 0x2c, 0x17, 0x3a, 0x0d, 0xd3, 0x9c, 0x1f, 0x94};
+
+// cryptonote::hashkey::BULLETPROOF_EXPONENT
+static const char DOMAIN_SEPARATOR[] = "bulletproof";
+
+// Same as get_exponent() in bulletproofs.cc, followed by the ge_frombytes_vartime() that used to
+// be done at startup.
+static void get_exponent_p3(ge_p3* result, size_t idx) {
+    unsigned char buf[32 + sizeof(DOMAIN_SEPARATOR) + 10];
+    size_t n = 0;
+    memcpy(buf, H, 32);
+    n += 32;
+    memcpy(buf + n, DOMAIN_SEPARATOR, sizeof(DOMAIN_SEPARATOR) - 1);
+    n += sizeof(DOMAIN_SEPARATOR) - 1;
+    for (uint64_t v = idx; ; v >>= 7) {
+        buf[n++] = (v & 0x7f) | (v >= 0x80 ? 0x80 : 0);
+        if (v < 0x80)
+            break;
+    }
+
+    unsigned char hash[32], hash2[32];
+    keccak(buf, n, hash, 32);
+    keccak(hash, 32, hash2, 32);  // rct::hash_to_p3 hashes its input again
+
+    ge_p2 p2;
+    ge_p1p1 p1;
+    ge_p3 p3;
+    ge_fromfe_frombytes_vartime(&p2, hash2);
+    ge_mul8(&p1, &p2);
+    ge_p1p1_to_p3(&p3, &p1);
+
+    unsigned char e[32];
+    ge_p3_tobytes(e, &p3);
+    if (ge_frombytes_vartime(result, e) != 0) {
+        fprintf(stderr, "ge_frombytes_vartime failed\n");
+        exit(1);
+    }
+}
+
+static void print_fe(const fe f) {
+    printf("{");
+    for (int i = 0; i < 10; i++)
+        printf("%s%d", i ? "," : "", f[i]);
+    printf("}");
+}
+
+static void print_table(const char* name, size_t count, size_t offset) {
+    printf("const ge_p3 %s[BULLETPROOF_GENERATORS] = {\n", name);
+    for (size_t i = 0; i < count; i++) {
+        ge_p3 p;
+        get_exponent_p3(&p, i * 2 + offset);
+        printf("        {");
+        print_fe(p.X);
+        printf(",");
+        print_fe(p.Y);
+        printf(",");
+        print_fe(p.Z);
+        printf(",");
+        print_fe(p.T);
+        printf("},\n");
+    }
+    printf("};\n");
+}
+
+int main(int argc, char** argv) {
+    if (argc != 2) {
+        fprintf(stderr, "Usage: %s COUNT\n", argv[0]);
+        return 1;
+    }
+    size_t count = strtoul(argv[1], NULL, 10);
+
+    printf("// Generated by utils/bulletproof_generators/gen_bulletproof_generators.c; do not edit.\n");
+    printf("//\n");
+    printf("// The bulletproof generators Hi[i] = get_exponent(H, 2i), Gi[i] = get_exponent(H, 2i+1),\n");
+    printf("// precomputed (in extended coordinates) so that they don't have to be hashed to the curve\n");
+    printf("// every time a process first creates or verifies a bulletproof.\n");
+    printf("\n");
+    printf("#include \"bulletproofs_generators.h\"\n");
+    printf("\n");
+    printf("#if BULLETPROOF_GENERATORS != %zu\n", count);
+    printf("#error bulletproofs_generators.c needs to be regenerated\n");
+    printf("#endif\n");
+    printf("\n");
+    print_table("bulletproof_Hi_p3", count, 0);
+    printf("\n");
+    print_table("bulletproof_Gi_p3", count, 1);
+    return 0;
+}
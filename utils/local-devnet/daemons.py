@@ -151,7 +151,8 @@ class Daemon(RPCDaemon):
             datadir=None,
             service_node=False,
             log_level=3,
-            peers=()):
+            peers=(),
+            extra_args=()):
         self.rpc_port = rpc_port or next_port()
         if name is None:
             name = 'oxend@{}'.format(self.rpc_port)
@@ -164,10 +165,12 @@ class Daemon(RPCDaemon):
         self.peers     = []
         self.keys      = None
 
+        self.datadir   = '{}/oxen-{}'.format(datadir or '.', self.rpc_port)
+
         self.args = [oxend] + list(self.__class__.base_args)
         self.args += (
                 # '--data-dir={}/oxen-{}-{}'.format(datadir or '.', self.listen_ip, self.rpc_port),
-                '--data-dir={}/oxen-{}'.format(datadir or '.', self.rpc_port),
+                '--data-dir={}'.format(self.datadir),
                 '--log-level={}'.format(log_level),
                 '--log-file=oxen.log'.format(self.listen_ip, self.p2p_port),
                 '--p2p-bind-ip={}'.format(self.listen_ip),
@@ -187,6 +190,8 @@ class Daemon(RPCDaemon):
                     '--storage-server-port={}'.format(self.ss_port),
                     )
 
+        self.args += extra_args
+
 
     def arguments(self):
         return self.args + [
@@ -228,6 +233,9 @@ class Daemon(RPCDaemon):
     def height(self):
         return self.rpc("/get_height").json()["height"]
 
+    def log_path(self):
+        return '{}/oxen.log'.format(self.datadir)
+
     def get_staking_requirement(self):
         rpc_result = self.json_rpc("get_staking_requirement").json()
         if rpc_result["result"]["status"] != "OK":
@@ -0,0 +1,149 @@
+#!/usr/bin/python3
+
+# Pulse latency benchmark: spins up a local service node network (see service_node_network.py)
+# with simulated link conditions on every service node's incoming Pulse messages (the oxend
+# --dev-pulse-delay/--dev-pulse-jitter/--dev-pulse-loss options), lets Pulse produce blocks for a
+# while and then reports per-stage round timings and block production latency percentiles, as
+# parsed from the "Pulse round timings:" lines that every quorum participant logs at the end of a
+# round.
+
+import service_node_network
+from service_node_network import SNNetwork, vprint
+
+import argparse
+import collections
+import math
+import os
+import pathlib
+import re
+import shutil
+import time
+
+TIMINGS_RE = re.compile(r'Pulse round timings: (.*)$')
+FIELD_RE = re.compile(r'(\w+)=(\S+)')
+
+
+def percentile(values, p):
+    """Nearest-rank percentile of a non-empty list of values"""
+    values = sorted(values)
+    return values[max(0, math.ceil(p / 100 * len(values)) - 1)]
+
+
+def parse_round_timings(path, offset):
+    """Yields a dict of fields for each round timings line in the log at `path` after byte `offset`"""
+    if not os.path.exists(path):
+        return
+    with open(path, errors='replace') as f:
+        f.seek(offset)
+        for line in f:
+            m = TIMINGS_RE.search(line)
+            if not m:
+                continue
+            fields = dict(FIELD_RE.findall(m.group(1)))
+            for k, v in fields.items():
+                if v.endswith('ms'):
+                    fields[k] = float(v[:-2])
+            fields['height'] = int(fields['height'])
+            fields['round'] = int(fields['round'])
+            yield fields
+
+
+def print_distribution(name, values):
+    if not values:
+        return
+    print('  {:<22} n={:<5} p50={:>8.1f}ms p90={:>8.1f}ms p99={:>8.1f}ms max={:>8.1f}ms'.format(
+        name, len(values), percentile(values, 50), percentile(values, 90), percentile(values, 99),
+        max(values)))
+
+
+def report(rounds):
+    stage_keys = ('start_lag', 'transition_lag', 'handshakes', 'send_bitset', 'bitsets',
+                  'send_template', 'template', 'random_value_hashes', 'random_values',
+                  'signed_blocks')
+
+    print('Per stage timings over {} participant rounds:'.format(len(rounds)))
+    for key in stage_keys:
+        print_distribution(key, [r[key] for r in rounds if key in r])
+
+    results = collections.Counter(r['result'] for r in rounds)
+    print('Round results: {}'.format(', '.join('{}={}'.format(k, v) for k, v in sorted(results.items()))))
+
+    # Block production latency: from the scheduled start of the round until the block was added,
+    # taken from the first validator that added it.
+    blocks = {}
+    for r in rounds:
+        if r['result'] == 'block':
+            key = (r['height'], r['round'])
+            blocks[key] = min(blocks.get(key, math.inf), r['total'])
+    print('Produced {} blocks, {} of them after round 0'.format(
+        len(blocks), sum(1 for height, rnd in blocks if rnd > 0)))
+    print_distribution('block_latency', list(blocks.values()))
+
+
+def run():
+    arg_parser = argparse.ArgumentParser(formatter_class=argparse.ArgumentDefaultsHelpFormatter)
+    arg_parser.add_argument('--oxen-bin-dir', default="../../build/bin", type=pathlib.Path,
+                            help='Set the directory where Oxen binaries (oxend, wallet rpc, ...) are located.')
+    arg_parser.add_argument('--anvil-path', type=pathlib.Path,
+                            help='Path to Foundry\'s `anvil`; see service_node_network.py')
+    arg_parser.add_argument('--eth-sn-contracts-dir', type=pathlib.Path,
+                            help='Path to the `eth-sn-contracts` repository; see service_node_network.py')
+    arg_parser.add_argument('--sns', type=int, default=12, help='Number of service nodes to run')
+    arg_parser.add_argument('--blocks', type=int, default=20,
+                            help='Number of Pulse blocks to wait for before reporting')
+    arg_parser.add_argument('--delay', type=int, default=0,
+                            help='Delay in milliseconds added to every incoming Pulse message')
+    arg_parser.add_argument('--jitter', type=int, default=0,
+                            help='Further random delay of up to this many milliseconds per message')
+    arg_parser.add_argument('--loss', type=float, default=0,
+                            help='Percentage of incoming Pulse messages to drop')
+    arg_parser.add_argument('--slow-nodes', type=int, default=0,
+                            help='Number of service nodes that use --slow-delay instead of --delay')
+    arg_parser.add_argument('--slow-delay', type=int, default=0,
+                            help='Incoming Pulse message delay in milliseconds for the slow nodes')
+    args = arg_parser.parse_args()
+
+    if args.anvil_path is not None and args.eth_sn_contracts_dir is None:
+        raise RuntimeError('--eth-sn-contracts-dir must be specified when --anvil-path is set')
+
+    def sn_args(i):
+        delay = args.slow_delay if i < args.slow_nodes else args.delay
+        return ['--dev-pulse-delay={}'.format(delay),
+                '--dev-pulse-jitter={}'.format(args.jitter),
+                '--dev-pulse-loss={}'.format(args.loss)]
+
+    datadir = service_node_network.datadirectory + '/'
+    if os.path.isdir(datadir):
+        shutil.rmtree(datadir)
+
+    snn = SNNetwork(oxen_bin_dir=args.oxen_bin_dir,
+                    anvil_path=args.anvil_path,
+                    eth_sn_contracts_dir=args.eth_sn_contracts_dir,
+                    datadir=datadir,
+                    sns=args.sns,
+                    sn_args=sn_args)
+
+    # Only look at rounds that happen from here on, i.e. not during the network setup
+    offsets = {sn.log_path(): os.path.getsize(sn.log_path()) if os.path.exists(sn.log_path()) else 0
+               for sn in snn.sns}
+
+    start_height = snn.sns[0].height()
+    target_height = start_height + args.blocks
+    vprint("Waiting for Pulse to produce {} blocks (height {} -> {})".format(args.blocks, start_height, target_height))
+    last = start_height
+    while last < target_height:
+        time.sleep(5)
+        height = snn.sns[0].height()
+        if height != last:
+            vprint("Height {}/{}".format(height, target_height))
+            last = height
+
+    rounds = []
+    for path, offset in offsets.items():
+        rounds += parse_round_timings(path, offset)
+
+    report(rounds)
+
+
+if __name__ == '__main__':
+    run()
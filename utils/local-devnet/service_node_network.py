@@ -58,7 +58,7 @@ def all_service_nodes_proofed(sn):
     return result
 
 class SNNetwork:
-    def __init__(self, datadir, *, oxen_bin_dir, anvil_path, eth_sn_contracts_dir, sns=12, nodes=3):
+    def __init__(self, datadir, *, oxen_bin_dir, anvil_path, eth_sn_contracts_dir, sns=12, nodes=3, sn_args=()):
         begin_time = time.perf_counter()
 
         # Setup directories
@@ -108,7 +108,8 @@ class SNNetwork:
         nodeopts = dict(oxend=str(self.oxen_bin_dir / 'oxend'), datadir=datadir)
 
         self.ethsns = [Daemon(service_node=True, **nodeopts) for _ in range(1)]
-        self.sns    = [Daemon(service_node=True, **nodeopts) for _ in range(sns)]
+        self.sns    = [Daemon(service_node=True, extra_args=sn_args(i) if callable(sn_args) else sn_args, **nodeopts)
+                       for i in range(sns)]
         self.nodes  = [Daemon(**nodeopts) for _ in range(nodes)]
 
         self.all_nodes = self.sns + self.nodes + self.ethsns